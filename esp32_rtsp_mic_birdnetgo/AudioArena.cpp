@@ -0,0 +1,52 @@
+#include "AudioArena.h"
+#include "AutoGain.h"
+#include "FilterChain.h"
+#include "HttpAudio.h"
+#include "Recorder.h"
+
+#define AUDIO_ARENA_STR2(x) #x
+#define AUDIO_ARENA_STR(x) AUDIO_ARENA_STR2(x)
+#pragma message("Audio arena: capture = " AUDIO_ARENA_STR(AUDIO_MAX_BUFFER_SAMPLES) " samples x 4 B, filter, agc, rec pages, http carry (static), budget " AUDIO_ARENA_STR(AUDIO_ARENA_BUDGET_BYTES) " B")
+
+struct AudioArenaEntry {
+    const char *name;
+    uint32_t offset;
+    uint32_t bytes;
+};
+
+// Regions back to back, each starting on AUDIO_ARENA_ALIGN.
+static constexpr uint32_t ARENA_OFF_CAPTURE = 0;
+static constexpr uint32_t ARENA_OFF_FILTER = ARENA_OFF_CAPTURE + audioArenaAlignUp(AUDIO_ARENA_CAPTURE_BYTES);
+static constexpr uint32_t ARENA_OFF_AGC = ARENA_OFF_FILTER + audioArenaAlignUp(FILTER_CHAIN_ARENA_BYTES);
+static constexpr uint32_t ARENA_OFF_REC_PAGES = ARENA_OFF_AGC + audioArenaAlignUp(AGC_ARENA_BYTES);
+static constexpr uint32_t ARENA_OFF_HTTP_CARRY = ARENA_OFF_REC_PAGES + audioArenaAlignUp(REC_ARENA_BYTES);
+static constexpr uint32_t AUDIO_ARENA_BYTES = ARENA_OFF_HTTP_CARRY + audioArenaAlignUp(HTTP_AUDIO_ARENA_BYTES);
+
+static_assert(AUDIO_ARENA_BYTES <= AUDIO_ARENA_BUDGET_BYTES,
+              "audio arena exceeds AUDIO_ARENA_BUDGET_BYTES (lower AUDIO_MAX_BUFFER_SAMPLES or raise the budget)");
+
+static const AudioArenaEntry AUDIO_ARENA_LAYOUT[ARENA_REGION_COUNT] = {
+    {"capture", ARENA_OFF_CAPTURE, AUDIO_ARENA_CAPTURE_BYTES},
+    {"filter", ARENA_OFF_FILTER, FILTER_CHAIN_ARENA_BYTES},
+    {"agc", ARENA_OFF_AGC, AGC_ARENA_BYTES},
+    {"rec_pages", ARENA_OFF_REC_PAGES, REC_ARENA_BYTES},
+    {"http_carry", ARENA_OFF_HTTP_CARRY, HTTP_AUDIO_ARENA_BYTES},
+};
+
+alignas(AUDIO_ARENA_ALIGN) static uint8_t audioArena[AUDIO_ARENA_BYTES];
+
+uint8_t *audioarena_region(AudioArenaRegion region) {
+    return region < ARENA_REGION_COUNT ? audioArena + AUDIO_ARENA_LAYOUT[region].offset : nullptr;
+}
+
+uint32_t audioarena_regionBytes(AudioArenaRegion region) {
+    return region < ARENA_REGION_COUNT ? AUDIO_ARENA_LAYOUT[region].bytes : 0;
+}
+
+const char *audioarena_regionName(AudioArenaRegion region) {
+    return region < ARENA_REGION_COUNT ? AUDIO_ARENA_LAYOUT[region].name : "";
+}
+
+uint32_t audioarena_totalBytes() {
+    return AUDIO_ARENA_BYTES;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <stdint.h>
+
+// Static audio arena (ESP32 RTSP Mic for BirdNET-Go)
+//
+// All audio-path buffers live in one statically allocated block sized for the largest
+// supported configuration, laid out at compile time. Changing buffer size, sample rate or
+// restarting I2S only changes how much of a region is used; nothing on the audio path is
+// allocated or freed at run time, so parameter changes cannot fragment the heap or fail.
+//
+// To add a buffer: add a region id below, give its module header a *_ARENA_BYTES constant and
+// add an entry in AudioArena.cpp. The build fails if the total exceeds AUDIO_ARENA_BUDGET_BYTES,
+// and AudioArena.cpp prints the layout as a compiler note. audioarena_region() only reads
+// constant data, so a module may bind its view of a region in a static initializer.
+
+#ifndef AUDIO_MAX_BUFFER_SAMPLES
+#define AUDIO_MAX_BUFFER_SAMPLES 8192     // largest Buffer Size accepted by the UI/API
+#endif
+#ifndef AUDIO_ARENA_BUDGET_BYTES
+#define AUDIO_ARENA_BUDGET_BYTES 57344    // 56 KB
+#endif
+
+enum AudioArenaRegion : uint8_t {
+    // I2S read (32-bit) and, converted in place, the 16-bit RTP payload: sample i is read
+    // from bytes 4i..4i+3 before 2i..2i+1 is written, so both views share the memory.
+    // With a filter chain the 32-bit words are first turned into floats in place (same size).
+    ARENA_CAPTURE,
+    ARENA_FILTER,       // biquad coefficients and state (FilterChain.cpp)
+    ARENA_AGC,          // look-ahead delay line and chunk peaks (AutoGain.cpp)
+    ARENA_REC_PAGES,    // the recorder's two ADPCM pages (Recorder.cpp)
+    ARENA_HTTP_CARRY,   // one unsent chunk rest per HTTP audio listener (HttpAudio.cpp)
+    ARENA_REGION_COUNT
+};
+
+static constexpr uint32_t AUDIO_ARENA_ALIGN = 16;
+
+constexpr uint32_t audioArenaAlignUp(uint32_t n) {
+    return (n + AUDIO_ARENA_ALIGN - 1) & ~(AUDIO_ARENA_ALIGN - 1);
+}
+
+static constexpr uint32_t AUDIO_ARENA_CAPTURE_BYTES = AUDIO_MAX_BUFFER_SAMPLES * sizeof(int32_t);
+
+uint8_t *audioarena_region(AudioArenaRegion region);
+uint32_t audioarena_regionBytes(AudioArenaRegion region);
+const char *audioarena_regionName(AudioArenaRegion region);
+uint32_t audioarena_totalBytes();
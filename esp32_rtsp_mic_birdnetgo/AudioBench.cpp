@@ -0,0 +1,173 @@
+#include "AudioBench.h"
+#include <math.h>
+#include <string.h>
+
+BenchStatus benchStatus = {};
+
+static const char *const BENCH_SIGNAL_NAMES[BENCH_SIGNAL_COUNT] = {"sweep", "noise", "impulse"};
+static const char *const BENCH_SINK_NAMES[BENCH_SINK_COUNT] = {"null", "loopback", "tcp"};
+static const char *const BENCH_STAGE_NAMES[BENCH_STAGE_COUNT] = {"gen", "dsp", "pack", "sink", "peer"};
+
+const char *bench_signalName(uint8_t signal) {
+    return signal < BENCH_SIGNAL_COUNT ? BENCH_SIGNAL_NAMES[signal] : "unknown";
+}
+
+const char *bench_sinkName(uint8_t sink) {
+    return sink < BENCH_SINK_COUNT ? BENCH_SINK_NAMES[sink] : "unknown";
+}
+
+const char *bench_stageName(uint8_t stage) {
+    return stage < BENCH_STAGE_COUNT ? BENCH_STAGE_NAMES[stage] : "unknown";
+}
+
+bool bench_signalFromName(const String &name, BenchSignal &out) {
+    for (uint8_t i = 0; i < BENCH_SIGNAL_COUNT; i++) {
+        if (name == BENCH_SIGNAL_NAMES[i]) {
+            out = (BenchSignal)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool bench_sinkFromName(const String &name, BenchSink &out) {
+    for (uint8_t i = 0; i < BENCH_SINK_COUNT; i++) {
+        if (name == BENCH_SINK_NAMES[i]) {
+            out = (BenchSink)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void bench_plan(BenchSignal signal, BenchSink sink, uint16_t caseMs, uint16_t maxBuffer, uint32_t nowMs) {
+    BenchStatus &b = benchStatus;
+    uint32_t runs = b.runs;
+    memset(&b, 0, sizeof(b));
+    b.runs = runs + 1;
+    b.state = BENCH_RUNNING;
+    b.signal = signal;
+    b.sink = sink;
+    b.caseMs = caseMs;
+    b.cpuMhz = getCpuFrequencyMhz();
+    b.startedMs = nowMs;
+    for (uint8_t pass = 0; pass < 2; pass++) {
+        uint8_t s = pass == 0 ? (uint8_t)BENCH_SINK_NULL : (uint8_t)sink;
+        if (pass == 1 && s == BENCH_SINK_NULL) break;
+        for (uint8_t i = 0; i < BENCH_BUFFER_COUNT; i++) {
+            if (BENCH_BUFFERS[i] > maxBuffer) break;
+            BenchCase &c = b.cases[b.caseCount++];
+            c.buffer = BENCH_BUFFERS[i];
+            c.sink = s;
+        }
+    }
+}
+
+void bench_finish(BenchState state, const char *error, uint32_t nowMs) {
+    benchStatus.state = state;
+    if (error) benchStatus.error = error;
+    benchStatus.finishedMs = nowMs;
+}
+
+// ---- Generator ----
+
+static int16_t benchSine[256];
+static bool benchSineReady = false;
+static BenchSignal benchGenSignal = BENCH_SWEEP;
+static uint32_t benchGenRate = 48000;
+static uint32_t benchPhase = 0;
+static float benchPhaseInc = 0.0f;      // per sample, in 2^32 units
+static float benchIncStart = 0.0f;
+static float benchIncEnd = 0.0f;
+static float benchIncStep = 1.0f;       // per 32-sample chunk (log sweep)
+static uint32_t benchNoise = 0x12345678;
+static uint32_t benchSampleIdx = 0;
+
+void bench_genBegin(BenchSignal signal, uint32_t sampleRate) {
+    if (!benchSineReady) {
+        for (int i = 0; i < 256; i++) benchSine[i] = (int16_t)lroundf(16383.0f * sinf(6.2831853f * i / 256.0f));
+        benchSineReady = true;
+    }
+    benchGenSignal = signal;
+    benchGenRate = sampleRate ? sampleRate : 48000;
+    benchPhase = 0;
+    benchSampleIdx = 0;
+    benchIncStart = 50.0f / benchGenRate * 4294967296.0f;
+    benchIncEnd = 0.45f * 4294967296.0f;
+    // 2 s sweep in chunks of 32 samples: step^(chunks) = end/start
+    float chunks = 2.0f * benchGenRate / 32.0f;
+    benchIncStep = expf(logf(benchIncEnd / benchIncStart) / chunks);
+    benchPhaseInc = benchIncStart;
+}
+
+void bench_genFill(int32_t *dst, uint16_t samples) {
+    switch (benchGenSignal) {
+        case BENCH_SWEEP:
+            for (uint16_t i = 0; i < samples; i++) {
+                if ((benchSampleIdx++ & 31) == 0) {
+                    benchPhaseInc *= benchIncStep;
+                    if (benchPhaseInc > benchIncEnd) benchPhaseInc = benchIncStart;
+                }
+                benchPhase += (uint32_t)benchPhaseInc;
+                dst[i] = (int32_t)benchSine[benchPhase >> 24] << 16;    // -6 dBFS
+            }
+            break;
+        case BENCH_NOISE:
+            for (uint16_t i = 0; i < samples; i++) {
+                uint32_t x = benchNoise;        // xorshift32
+                x ^= x << 13;
+                x ^= x >> 17;
+                x ^= x << 5;
+                benchNoise = x;
+                dst[i] = ((int32_t)x >> 1) & ~0xFF;   // 24-bit, -6 dBFS peak
+            }
+            break;
+        case BENCH_IMPULSE:
+        default: {
+            uint32_t period = benchGenRate / 10;
+            for (uint16_t i = 0; i < samples; i++) {
+                dst[i] = (benchSampleIdx == 0) ? (int32_t)0x7FFFFF00 : 0;
+                if (++benchSampleIdx >= period) benchSampleIdx = 0;
+            }
+            break;
+        }
+    }
+}
+
+// ---- Accounting ----
+
+void bench_record(BenchCase &c, uint16_t samples, const uint32_t *stageCycles) {
+    c.blocks++;
+    c.samples += samples;
+    for (uint8_t s = 0; s < BENCH_STAGE_COUNT; s++) {
+        c.stage[s].cycles += stageCycles[s];
+        if (stageCycles[s] > c.stage[s].maxCycles) c.stage[s].maxCycles = stageCycles[s];
+    }
+}
+
+uint32_t bench_loadCyclesPerBlock(const BenchCase &c) {
+    if (!c.blocks) return 0;
+    uint64_t load = c.stage[BENCH_STAGE_DSP].cycles + c.stage[BENCH_STAGE_PACK].cycles +
+                    c.stage[BENCH_STAGE_SINK].cycles;
+    return (uint32_t)(load / c.blocks);
+}
+
+float bench_samplesPerSec(const BenchCase &c) {
+    uint32_t perBlock = bench_loadCyclesPerBlock(c);
+    if (!perBlock || !benchStatus.cpuMhz) return 0.0f;
+    float blockUs = (float)perBlock / (float)benchStatus.cpuMhz;
+    return (float)c.samples / (float)c.blocks * 1e6f / blockUs;
+}
+
+float bench_cpuPct(const BenchCase &c, uint32_t sampleRate) {
+    float sps = bench_samplesPerSec(c);
+    return sps > 0.0f ? 100.0f * (float)sampleRate / sps : 0.0f;
+}
+
+uint32_t bench_maxRate(const BenchCase &c) {
+    uint32_t best = 0;
+    for (uint8_t i = 0; i < BENCH_RATE_COUNT; i++) {
+        if (c.blocks && bench_cpuPct(c, BENCH_RATES[i]) <= (float)BENCH_RT_LIMIT_PCT) best = BENCH_RATES[i];
+    }
+    return best;
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include <Arduino.h>
+
+// Synthetic source and self-benchmark (ESP32 RTSP Mic for BirdNET-Go)
+//
+// Replaces i2s_read() with a generator (log sine sweep, white noise or impulses) in the I2S
+// word format and pushes the blocks through the streaming path: the same DSP block function
+// (shift, high-pass, gain, clip), RTP packetization and either a null sink or a real TCP
+// socket. Each case (buffer size x sink) runs unpaced for a fixed time, so the result is the
+// pipeline's capacity: cycles per block per stage, samples/s, and from that the CPU share and
+// the highest sample rate each buffer size sustains in real time.
+//
+// Stage cycles come from the CPU cycle counter, so they are wall time on the loop task's core
+// (including anything that preempted it, e.g. the lwIP task handling the socket write).
+// The sketch pins the clock at its maximum for the run (power_holdMax()), so cpuMhz holds.
+// Runs only while no RTSP stream is active; PLAY aborts a running bench.
+
+#ifndef BENCH_CASE_MS
+#define BENCH_CASE_MS 1000U          // default run time per case
+#endif
+#ifndef BENCH_SLICE_MS
+#define BENCH_SLICE_MS 20U           // longest uninterrupted run per loop() iteration
+#endif
+#ifndef BENCH_RT_LIMIT_PCT
+#define BENCH_RT_LIMIT_PCT 70U       // CPU share above which a rate/buffer pair is not "real time"
+#endif
+#ifndef BENCH_LOOPBACK_PORT
+#define BENCH_LOOPBACK_PORT 8556
+#endif
+
+static const uint16_t BENCH_BUFFERS[] = {256, 512, 1024, 2048, 4096, 8192};
+static const uint8_t BENCH_BUFFER_COUNT = sizeof(BENCH_BUFFERS) / sizeof(BENCH_BUFFERS[0]);
+static const uint32_t BENCH_RATES[] = {8000, 16000, 22050, 24000, 32000, 44100, 48000, 96000};
+static const uint8_t BENCH_RATE_COUNT = sizeof(BENCH_RATES) / sizeof(BENCH_RATES[0]);
+
+enum BenchSignal : uint8_t {
+    BENCH_SWEEP,              // log sine sweep 50 Hz .. 0.45 fs over 2 s, -6 dBFS
+    BENCH_NOISE,              // white noise, -6 dBFS peak
+    BENCH_IMPULSE,            // full-scale impulse every 100 ms
+    BENCH_SIGNAL_COUNT
+};
+
+enum BenchSink : uint8_t {
+    BENCH_SINK_NULL,          // packets are built and dropped
+    BENCH_SINK_LOOPBACK,      // TCP to a listener on 127.0.0.1, drained in the same task
+    BENCH_SINK_TCP,           // TCP to a host given by the client (e.g. `nc -lk 9000 > /dev/null`)
+    BENCH_SINK_COUNT
+};
+
+enum BenchStage : uint8_t {
+    BENCH_STAGE_GEN,          // generator (stands in for i2s_read, not counted as load)
+    BENCH_STAGE_DSP,
+    BENCH_STAGE_PACK,         // RTP/interleaved header + byte swap
+    BENCH_STAGE_SINK,         // socket write
+    BENCH_STAGE_PEER,         // loopback only: reading the data back (receiver side, not counted)
+    BENCH_STAGE_COUNT
+};
+
+enum BenchState : uint8_t {
+    BENCH_IDLE,
+    BENCH_RUNNING,
+    BENCH_DONE,
+    BENCH_FAILED
+};
+
+struct BenchStageStats {
+    uint64_t cycles;
+    uint32_t maxCycles;
+};
+
+struct BenchCase {
+    uint16_t buffer;
+    uint8_t sink;
+    uint32_t blocks;
+    uint64_t samples;
+    uint32_t runMs;           // wall time the case ran
+    uint32_t sinkErrors;
+    BenchStageStats stage[BENCH_STAGE_COUNT];
+};
+
+struct BenchStatus {
+    BenchState state;
+    const char *error;        // BENCH_FAILED, or why socket cases were cut short
+    uint8_t signal;
+    uint8_t sink;
+    uint16_t caseMs;
+    uint32_t cpuMhz;
+    uint32_t startedMs;
+    uint32_t finishedMs;
+    uint8_t current;          // case being run
+    uint8_t caseCount;
+    BenchCase cases[BENCH_BUFFER_COUNT * 2];
+    uint32_t runs;
+};
+
+extern BenchStatus benchStatus;
+
+const char *bench_signalName(uint8_t signal);
+const char *bench_sinkName(uint8_t sink);
+const char *bench_stageName(uint8_t stage);
+bool bench_signalFromName(const String &name, BenchSignal &out);
+bool bench_sinkFromName(const String &name, BenchSink &out);
+
+// Clears the results and lays out the cases: every buffer size up to maxBuffer with the null
+// sink, then again with `sink` unless that is the null sink.
+void bench_plan(BenchSignal signal, BenchSink sink, uint16_t caseMs, uint16_t maxBuffer, uint32_t nowMs);
+void bench_finish(BenchState state, const char *error, uint32_t nowMs);
+
+// Generator: restart at a sample rate, then fill blocks of I2S words (24-bit left-justified).
+void bench_genBegin(BenchSignal signal, uint32_t sampleRate);
+void bench_genFill(int32_t *dst, uint16_t samples);
+
+void bench_record(BenchCase &c, uint16_t samples, const uint32_t *stageCycles);
+
+// Derived figures; load counts DSP + packetization + sink.
+uint32_t bench_loadCyclesPerBlock(const BenchCase &c);
+float bench_samplesPerSec(const BenchCase &c);
+float bench_cpuPct(const BenchCase &c, uint32_t sampleRate);
+uint32_t bench_maxRate(const BenchCase &c);   // highest BENCH_RATES entry under the limit, 0 if none
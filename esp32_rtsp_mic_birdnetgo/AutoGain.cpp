@@ -0,0 +1,207 @@
+#include "AutoGain.h"
+#include <math.h>
+#include <string.h>
+
+AgcStatus agcStatus = {};
+
+static const int AGC_LA = AGC_LOOKAHEAD_SAMPLES;
+static const int AGC_MAX_CHUNKS = AUDIO_MAX_BUFFER_SAMPLES / AGC_LOOKAHEAD_SAMPLES + 1;
+static const uint32_t AGC_UNITY_Q15 = 32768;
+
+// Levels on the 16-bit output scale (the samples arrive shifted, before gain)
+static uint32_t agcTargetAbs = 8231;        // -12 dBFS
+static uint32_t agcCeilAbs = 29204;         // -1 dBFS
+static uint32_t agcGateAbs = 33;            // -60 dBFS
+static uint32_t agcMaxQ16 = 8 * 65536;
+static uint32_t agcMinQ16 = (uint32_t)(AGC_MIN_GAIN * 65536.0f);
+
+// Loop steps (Q16), recomputed when the block length or the sample rate changes
+static int agcStepSamples = 0;
+static uint32_t agcStepRate = 0;
+static uint32_t agcAttackQ16 = 65536;       // per block, < 1
+static uint32_t agcReleaseQ16 = 65536;      // per block, > 1
+static uint32_t agcLimitRelQ16 = 65536;     // per chunk, > 1
+
+// Look-ahead buffers, in the audio arena (ARENA_AGC)
+struct AgcBuffers {
+    float delay[AGC_LA];                    // last AGC_LA samples of the previous block (after the slow gain)
+    float head[AGC_LA];                     // first chunk of the block, before the output overwrites it
+    float next[AGC_LA];
+    uint32_t chunkPeak[AGC_MAX_CHUNKS];
+};
+static_assert(sizeof(AgcBuffers) <= AGC_ARENA_BYTES, "AGC_ARENA_BYTES too small for the AGC buffers");
+static AgcBuffers &agcBuf = *reinterpret_cast<AgcBuffers *>(audioarena_region(ARENA_AGC));
+static float (&agcDelay)[AGC_LA] = agcBuf.delay;
+static float (&agcHead)[AGC_LA] = agcBuf.head;
+static float (&agcNext)[AGC_LA] = agcBuf.next;
+static uint32_t (&agcChunkPeak)[AGC_MAX_CHUNKS] = agcBuf.chunkPeak;
+static uint32_t agcDelayPeak = 0;
+static uint32_t agcLimitQ15 = AGC_UNITY_Q15;   // limiter gain where the last block ended
+
+static uint32_t dbToQ16(float db) {
+    return (uint32_t)lroundf(65536.0f * powf(10.0f, db / 20.0f));
+}
+
+static uint32_t dbfsToAbs(float dbfs) {
+    return (uint32_t)lroundf(32767.0f * powf(10.0f, dbfs / 20.0f));
+}
+
+static uint32_t absOf(float peak) {
+    return peak < 4.0e9f ? (uint32_t)peak : 4000000000UL;
+}
+
+// Gain (Q15) that keeps a chunk with this peak (after the slow gain) under the ceiling
+static uint32_t limitFor(uint64_t peak) {
+    if (peak <= agcCeilAbs) return AGC_UNITY_Q15;
+    return (uint32_t)((uint64_t)agcCeilAbs * AGC_UNITY_Q15 / peak);
+}
+
+void agc_configure(float targetDbfs, float maxGain, float initialGain) {
+    agcTargetAbs = dbfsToAbs(targetDbfs);
+    agcCeilAbs = dbfsToAbs(AGC_LIMIT_CEILING_DBFS);
+    agcGateAbs = dbfsToAbs(AGC_GATE_DBFS);
+    if (agcGateAbs < 1) agcGateAbs = 1;
+    agcMinQ16 = (uint32_t)(AGC_MIN_GAIN * 65536.0f);
+    agcMaxQ16 = (uint32_t)(maxGain * 65536.0f);
+    if (agcMaxQ16 < agcMinQ16) agcMaxQ16 = agcMinQ16;
+    uint32_t g = (uint32_t)(initialGain * 65536.0f);
+    if (g < agcMinQ16) g = agcMinQ16;
+    if (g > agcMaxQ16) g = agcMaxQ16;
+    memset(&agcStatus, 0, sizeof(agcStatus));
+    agcStatus.gainQ16 = g;
+    agcStatus.limitQ15 = AGC_UNITY_Q15;
+    agcStatus.limitPeakQ15 = AGC_UNITY_Q15;
+    agcStepSamples = 0;
+    agc_reset();
+}
+
+void agc_reset() {
+    memset(agcDelay, 0, sizeof(agcDelay));
+    agcDelayPeak = 0;
+    agcLimitQ15 = AGC_UNITY_Q15;
+}
+
+float agc_gain() {
+    return agcStatus.gainQ16 / 65536.0f;
+}
+
+float agc_limitDb() {
+    return 20.0f * log10f(agcStatus.limitQ15 / (float)AGC_UNITY_Q15);
+}
+
+float agc_process(float *buf, int16_t *out, int samples, uint32_t sampleRate) {
+    const int n = samples;
+    if (n <= 0 || n > AUDIO_MAX_BUFFER_SAMPLES || sampleRate == 0) return 0.0f;
+    if (n != agcStepSamples || sampleRate != agcStepRate) {
+        float blockSec = (float)n / (float)sampleRate;
+        agcAttackQ16 = dbToQ16(-AGC_ATTACK_DB_PER_S * blockSec);
+        agcReleaseQ16 = dbToQ16(AGC_RELEASE_DB_PER_S * blockSec);
+        agcLimitRelQ16 = dbToQ16(AGC_LIMIT_RELEASE_DB_PER_S * AGC_LA / (float)sampleRate);
+        agcStepSamples = n;
+        agcStepRate = sampleRate;
+    }
+
+    // Envelopes: peak of each input chunk, before gain
+    const int xChunks = (n + AGC_LA - 1) / AGC_LA;
+    uint32_t inPeak = 0;
+    for (int c = 0; c < xChunks; c++) {
+        int end = (c + 1) * AGC_LA < n ? (c + 1) * AGC_LA : n;
+        float p = 0.0f;
+        for (int i = c * AGC_LA; i < end; i++) {
+            float a = fabsf(buf[i]);
+            if (a > p) p = a;
+        }
+        agcChunkPeak[c] = absOf(p);
+        if (agcChunkPeak[c] > inPeak) inPeak = agcChunkPeak[c];
+    }
+
+    // Slow loop: one step per block towards the gain that puts the peak on target
+    AgcStatus &st = agcStatus;
+    st.blocks++;
+    uint32_t g = st.gainQ16;
+    if (inPeak < agcGateAbs) {
+        st.gatedBlocks++;
+    } else {
+        uint64_t want = (uint64_t)agcTargetAbs * 65536ULL / inPeak;
+        if (want < g) {
+            uint32_t down = (uint32_t)(((uint64_t)g * agcAttackQ16) >> 16);
+            g = want > down ? (uint32_t)want : down;
+        } else if (want > g) {
+            uint32_t up = (uint32_t)(((uint64_t)g * agcReleaseQ16) >> 16);
+            g = want < up ? (uint32_t)want : up;
+        }
+    }
+    if (g < agcMinQ16) g = agcMinQ16;
+    if (g >= agcMaxQ16) {
+        g = agcMaxQ16;
+        st.cappedBlocks++;
+    }
+    st.gainQ16 = g;
+    const float gf = g / 65536.0f;
+
+    // Keep what the output pass overwrites or runs past: the first chunk and the new delay
+    // (s = delay ++ gain * buf; this block plays s[0..n), the next one starts at s[n]).
+    const int head = n < AGC_LA ? n : AGC_LA;
+    for (int i = 0; i < head; i++) agcHead[i] = buf[i];
+    float nextPeak = 0.0f;
+    for (int t = 0; t < AGC_LA; t++) {
+        int j = n + t;
+        float v = j < AGC_LA ? agcDelay[j] : buf[j - AGC_LA] * gf;
+        agcNext[t] = v;
+        float a = fabsf(v);
+        if (a > nextPeak) nextPeak = a;
+    }
+    const uint32_t nextLimit = limitFor(absOf(nextPeak));
+
+    // Limiter: chunk k of s is the delay (k = 0) or input chunk k-1. The gain ramps to the lower
+    // of this chunk's and the next chunk's limit, so both ends (and the line between) stay
+    // under this chunk's limit.
+    const int lastChunk = (n - 1) / AGC_LA;
+    uint32_t gPrev = agcLimitQ15;
+    uint32_t limitMin = AGC_UNITY_Q15;
+    float outPeak = 0.0f;
+    uint32_t limitK = limitFor(agcDelayPeak);
+    for (int k = 0; k <= lastChunk; k++) {
+        uint32_t limitNext = k < lastChunk ? limitFor(((uint64_t)agcChunkPeak[k] * g) >> 16) : nextLimit;
+        uint32_t target = limitK < limitNext ? limitK : limitNext;
+        uint32_t rel = (uint32_t)(((uint64_t)gPrev * agcLimitRelQ16) >> 16);
+        if (rel > AGC_UNITY_Q15) rel = AGC_UNITY_Q15;
+        if (target > rel) target = rel;
+        if (target < limitMin) limitMin = target;
+
+        const int start = k * AGC_LA;
+        const int len = (start + AGC_LA < n ? start + AGC_LA : n) - start;
+        const float *src;
+        float scale;
+        if (k == 0) {
+            src = agcDelay;
+            scale = 1.0f;
+        } else {
+            src = k == 1 ? agcHead : buf + start - AGC_LA;
+            scale = gf;
+        }
+        const float g0 = gPrev / (float)AGC_UNITY_Q15 * scale;
+        const float dg = ((float)target - (float)gPrev) / (float)AGC_UNITY_Q15 * scale / (float)len;
+        int16_t *dst = out + start;
+        // In place: dst[i] overwrites bytes of buf[(start + i) / 2], which is never ahead of
+        // src[i] once k >= 2 (chunks 0 and 1 read from the copies).
+        for (int i = 0; i < len; i++) {
+            float y = src[i] * (g0 + dg * (float)(i + 1));
+            float a = fabsf(y);
+            if (a > outPeak) outPeak = a;
+            if (y > 32767.0f) y = 32767.0f;
+            if (y < -32768.0f) y = -32768.0f;
+            dst[i] = (int16_t)y;
+        }
+        gPrev = target;
+        limitK = limitNext;
+    }
+
+    memcpy(agcDelay, agcNext, sizeof(agcDelay));
+    agcDelayPeak = absOf(nextPeak);
+    agcLimitQ15 = gPrev;
+    st.limitQ15 = (uint16_t)limitMin;
+    if (limitMin < st.limitPeakQ15) st.limitPeakQ15 = (uint16_t)limitMin;
+    if (limitMin < AGC_UNITY_Q15) st.limitBlocks++;
+    return outPeak;
+}
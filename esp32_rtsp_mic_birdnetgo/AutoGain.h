@@ -0,0 +1,74 @@
+#pragma once
+#include <Arduino.h>
+#include "AudioArena.h"
+
+// Automatic gain control and look-ahead peak limiter (ESP32 RTSP Mic for BirdNET-Go)
+//
+// Replaces the fixed gain stage when enabled (agc_enable). Two loops, both driven by block
+// envelopes so the per-sample work is one multiply:
+//  - a slow target-level loop: once per block the input peak sets the gain that would bring
+//    it to the target (agc_target, dBFS peak); the gain moves towards it at AGC_ATTACK_DB_PER_S
+//    down and AGC_RELEASE_DB_PER_S up, never above agc_max_gain, and holds while the input is
+//    below AGC_GATE_DBFS (quiet nights do not pump the noise floor up);
+//  - a look-ahead limiter: the output is delayed by AGC_LOOKAHEAD_SAMPLES, the delayed stream
+//    is cut into chunks of that length and each chunk gets the gain that keeps its peak under
+//    AGC_LIMIT_CEILING_DBFS. The gain ramps linearly to the lower of the current and the next
+//    chunk's limit, so it is already down when a transient arrives, and recovers at
+//    AGC_LIMIT_RELEASE_DB_PER_S.
+// Gains and chunk limits are fixed point (slow gain Q16, limiter Q15); only the ramp runs in
+// float. Clipping of the 16-bit output is then left to blocks louder than the ceiling allows
+// for a single sample (none, normally).
+
+#ifndef AGC_LOOKAHEAD_SAMPLES
+#define AGC_LOOKAHEAD_SAMPLES 64         // also the limiter chunk; 1.3 ms at 48 kHz
+#endif
+#ifndef AGC_LIMIT_CEILING_DBFS
+#define AGC_LIMIT_CEILING_DBFS -1.0f
+#endif
+#ifndef AGC_LIMIT_RELEASE_DB_PER_S
+#define AGC_LIMIT_RELEASE_DB_PER_S 60.0f
+#endif
+#ifndef AGC_ATTACK_DB_PER_S
+#define AGC_ATTACK_DB_PER_S 6.0f
+#endif
+#ifndef AGC_RELEASE_DB_PER_S
+#define AGC_RELEASE_DB_PER_S 2.0f
+#endif
+#ifndef AGC_GATE_DBFS
+#define AGC_GATE_DBFS -60.0f             // input peak (before gain) below which the gain holds
+#endif
+#ifndef AGC_MIN_GAIN
+#define AGC_MIN_GAIN 0.1f
+#endif
+
+// Arena region ARENA_AGC: three look-ahead windows (delay line, head of the block, next delay
+// line) and one peak per limiter chunk of the largest block.
+static constexpr uint32_t AGC_ARENA_BYTES =
+    (3 * AGC_LOOKAHEAD_SAMPLES + AUDIO_MAX_BUFFER_SAMPLES / AGC_LOOKAHEAD_SAMPLES + 1) * 4;
+
+static_assert(AGC_LOOKAHEAD_SAMPLES >= 8 && AGC_LOOKAHEAD_SAMPLES <= 128,
+              "AGC_LOOKAHEAD_SAMPLES must be 8..128 (half the smallest buffer at most)");
+
+struct AgcStatus {
+    uint32_t gainQ16;         // slow-loop gain
+    uint16_t limitQ15;        // lowest limiter gain in the last block (32768 = not limiting)
+    uint16_t limitPeakQ15;    // lowest since the stats were cleared
+    uint32_t blocks;
+    uint32_t limitBlocks;     // blocks where the limiter reduced the gain
+    uint32_t gatedBlocks;     // blocks where the input was below the gate (gain held)
+    uint32_t cappedBlocks;    // blocks where the gain sat at the max-gain cap
+};
+
+extern AgcStatus agcStatus;
+
+// Sets the target and the cap and restarts the slow loop at initialGain (clamped).
+void agc_configure(float targetDbfs, float maxGain, float initialGain);
+// Clears the look-ahead delay and the limiter (stream start, I2S restart); keeps the gain.
+void agc_reset();
+float agc_gain();
+float agc_limitDb();          // limiter gain of the last block, dB (0 or negative)
+
+// Gain + limiter for one block. buf holds the samples before gain (floats, any scale) and is
+// overwritten; out may alias the start of buf (the 16-bit view of the capture buffer).
+// Returns the output peak before the 16-bit clamp.
+float agc_process(float *buf, int16_t *out, int samples, uint32_t sampleRate);
@@ -0,0 +1,324 @@
+#include "FilterChain.h"
+#include "AudioArena.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+FilterChainStats filterChainStats = {};
+
+static const char *const FILTER_TYPE_NAMES[FILTER_TYPE_COUNT] = {"hp", "notch", "peak", "lowshelf", "hum"};
+static const uint8_t FILTER_RUN_MAX = FILTER_CHAIN_MAX_SECTIONS + 1;   // + legacy HPF
+
+struct BiquadRun {
+    BiquadCoeffs c;
+    float z1, z2;
+};
+
+static_assert(sizeof(BiquadRun) * FILTER_RUN_MAX <= FILTER_CHAIN_ARENA_BYTES, "FILTER_CHAIN_ARENA_BYTES too small");
+static BiquadRun (&filterRun)[FILTER_RUN_MAX] =
+    *reinterpret_cast<BiquadRun (*)[FILTER_RUN_MAX]>(audioarena_region(ARENA_FILTER));
+static uint8_t filterRunCount = 0;
+
+const char *filterchain_typeName(uint8_t type) {
+    return type < FILTER_TYPE_COUNT ? FILTER_TYPE_NAMES[type] : "unknown";
+}
+
+uint8_t filterchain_sectionCount(const FilterSpec &spec) {
+    return spec.type == FILTER_HUM ? spec.harmonics : 1;
+}
+
+// ---- JSON (the subset used here: an array of flat objects with string/number values) ----
+
+static void skipWs(const char *&p) {
+    while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') p++;
+}
+
+static bool parseString(const char *&p, char *out, size_t outLen) {
+    if (*p != '"') return false;
+    p++;
+    size_t n = 0;
+    while (*p && *p != '"') {
+        if (*p == '\\' || n + 1 >= outLen) return false;
+        out[n++] = *p++;
+    }
+    if (*p != '"') return false;
+    p++;
+    out[n] = '\0';
+    return true;
+}
+
+static bool parseNumber(const char *&p, float &out) {
+    char *end = nullptr;
+    out = strtof(p, &end);
+    if (end == p || !isfinite(out)) return false;
+    p = end;
+    return true;
+}
+
+static bool filterTypeFromName(const char *name, uint8_t &out) {
+    for (uint8_t i = 0; i < FILTER_TYPE_COUNT; i++) {
+        if (strcmp(name, FILTER_TYPE_NAMES[i]) == 0) {
+            out = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parseSection(const char *&p, FilterSpec &s, const char *&error) {
+    bool haveType = false;
+    bool haveFreq = false;
+    bool haveQ = false;
+    float harmonics = 3.0f;
+    s.gainDb = 0.0f;
+    if (*p != '{') { error = "expected_object"; return false; }
+    p++;
+    skipWs(p);
+    while (*p != '}') {
+        char key[16];
+        if (!parseString(p, key, sizeof(key))) { error = "bad_key"; return false; }
+        skipWs(p);
+        if (*p != ':') { error = "expected_colon"; return false; }
+        p++;
+        skipWs(p);
+        if (strcmp(key, "type") == 0) {
+            char name[16];
+            if (!parseString(p, name, sizeof(name)) || !filterTypeFromName(name, s.type)) {
+                error = "bad_type";
+                return false;
+            }
+            haveType = true;
+        } else {
+            float v;
+            if (!parseNumber(p, v)) { error = "bad_number"; return false; }
+            if (strcmp(key, "f") == 0 || strcmp(key, "freq") == 0) { s.freqHz = v; haveFreq = true; }
+            else if (strcmp(key, "q") == 0) { s.q = v; haveQ = true; }
+            else if (strcmp(key, "gain") == 0) s.gainDb = v;
+            else if (strcmp(key, "harmonics") == 0) harmonics = v;
+            else { error = "unknown_field"; return false; }
+        }
+        skipWs(p);
+        if (*p == ',') {
+            p++;
+            skipWs(p);
+        } else if (*p != '}') {
+            error = "expected_comma";
+            return false;
+        }
+    }
+    p++;
+
+    if (!haveType || !haveFreq) { error = "missing_type_or_f"; return false; }
+    if (!haveQ) {
+        static const float defaultQ[FILTER_TYPE_COUNT] = {0.70710678f, 30.0f, 1.0f, 0.70710678f, 30.0f};
+        s.q = defaultQ[s.type];
+    }
+    if (s.freqHz < 10.0f || s.freqHz > 20000.0f) { error = "bad_f"; return false; }
+    if (s.q < 0.1f || s.q > 100.0f) { error = "bad_q"; return false; }
+    if (s.gainDb < -24.0f || s.gainDb > 24.0f) { error = "bad_gain"; return false; }
+    s.harmonics = 1;
+    if (s.type == FILTER_HUM) {
+        if (s.freqHz < 40.0f || s.freqHz > 70.0f) { error = "bad_f"; return false; }
+        if (harmonics < 1.0f || harmonics > FILTER_CHAIN_MAX_SECTIONS || harmonics != floorf(harmonics)) {
+            error = "bad_harmonics";
+            return false;
+        }
+        s.harmonics = (uint8_t)harmonics;
+    }
+    return true;
+}
+
+bool filterchain_parse(const String &json, FilterSpec *out, uint8_t &count, const char *&error) {
+    count = 0;
+    error = nullptr;
+    if (json.length() > FILTER_CHAIN_JSON_MAX) { error = "too_long"; return false; }
+    const char *p = json.c_str();
+    uint8_t sections = 0;
+    skipWs(p);
+    if (*p != '[') { error = "expected_array"; return false; }
+    p++;
+    skipWs(p);
+    while (*p != ']') {
+        if (count >= FILTER_CHAIN_MAX_SECTIONS) { error = "too_many_sections"; return false; }
+        FilterSpec s = {};
+        if (!parseSection(p, s, error)) return false;
+        sections += filterchain_sectionCount(s);
+        if (sections > FILTER_CHAIN_MAX_SECTIONS) { error = "too_many_sections"; return false; }
+        out[count++] = s;
+        skipWs(p);
+        if (*p == ',') {
+            p++;
+            skipWs(p);
+        } else if (*p != ']') {
+            error = "expected_comma";
+            return false;
+        }
+    }
+    p++;
+    skipWs(p);
+    if (*p != '\0') { error = "trailing_data"; return false; }
+    return true;
+}
+
+String filterchain_toJson(const FilterSpec *specs, uint8_t count) {
+    String json = "[";
+    for (uint8_t i = 0; i < count; i++) {
+        const FilterSpec &s = specs[i];
+        if (i) json += ",";
+        json += "{\"type\":\"" + String(filterchain_typeName(s.type)) + "\",\"f\":" + String(s.freqHz, 1) +
+                ",\"q\":" + String(s.q, 3);
+        if (s.type == FILTER_PEAK || s.type == FILTER_LOWSHELF) json += ",\"gain\":" + String(s.gainDb, 1);
+        if (s.type == FILTER_HUM) json += ",\"harmonics\":" + String(s.harmonics);
+        json += "}";
+    }
+    return json + "]";
+}
+
+// ---- Design (RBJ audio EQ cookbook) ----
+
+BiquadCoeffs filterchain_design(uint8_t type, float freqHz, float q, float gainDb, float sampleRate) {
+    float fs = sampleRate;
+    float fc = freqHz;
+    if (fc < 10.0f) fc = 10.0f;
+    if (fc > fs * 0.45f) fc = fs * 0.45f;
+    const float pi = 3.14159265358979323846f;
+    float w0 = 2.0f * pi * (fc / fs);
+    float cosw0 = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * q);
+    float A = powf(10.0f, gainDb / 40.0f);
+    float b0, b1, b2, a0, a1, a2;
+    switch (type) {
+        case FILTER_HP:
+        default:
+            b0 = (1.0f + cosw0) * 0.5f;
+            b1 = -(1.0f + cosw0);
+            b2 = (1.0f + cosw0) * 0.5f;
+            a0 = 1.0f + alpha;
+            a1 = -2.0f * cosw0;
+            a2 = 1.0f - alpha;
+            break;
+        case FILTER_NOTCH:
+        case FILTER_HUM:
+            b0 = 1.0f;
+            b1 = -2.0f * cosw0;
+            b2 = 1.0f;
+            a0 = 1.0f + alpha;
+            a1 = -2.0f * cosw0;
+            a2 = 1.0f - alpha;
+            break;
+        case FILTER_PEAK:
+            b0 = 1.0f + alpha * A;
+            b1 = -2.0f * cosw0;
+            b2 = 1.0f - alpha * A;
+            a0 = 1.0f + alpha / A;
+            a1 = -2.0f * cosw0;
+            a2 = 1.0f - alpha / A;
+            break;
+        case FILTER_LOWSHELF: {
+            float s = 2.0f * sqrtf(A) * alpha;
+            b0 = A * ((A + 1.0f) - (A - 1.0f) * cosw0 + s);
+            b1 = 2.0f * A * ((A - 1.0f) - (A + 1.0f) * cosw0);
+            b2 = A * ((A + 1.0f) - (A - 1.0f) * cosw0 - s);
+            a0 = (A + 1.0f) + (A - 1.0f) * cosw0 + s;
+            a1 = -2.0f * ((A - 1.0f) + (A + 1.0f) * cosw0);
+            a2 = (A + 1.0f) + (A - 1.0f) * cosw0 - s;
+            break;
+        }
+    }
+    BiquadCoeffs c;
+    c.b0 = b0 / a0;
+    c.b1 = b1 / a0;
+    c.b2 = b2 / a0;
+    c.a1 = a1 / a0;
+    c.a2 = a2 / a0;
+    return c;
+}
+
+// ---- Running chain ----
+
+void filterchain_configure(uint16_t hpCutoffHz, const FilterSpec *specs, uint8_t count, float sampleRate) {
+    uint8_t n = 0;
+    if (hpCutoffHz) {
+        filterRun[n++].c = filterchain_design(FILTER_HP, hpCutoffHz, 0.70710678f, 0.0f, sampleRate);
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        const FilterSpec &s = specs[i];
+        for (uint8_t h = 1; h <= filterchain_sectionCount(s) && n < FILTER_RUN_MAX; h++) {
+            float f = s.freqHz * (s.type == FILTER_HUM ? h : 1);
+            if (s.type == FILTER_HUM && f > sampleRate * 0.45f) break;   // harmonic above the band
+            filterRun[n++].c = filterchain_design(s.type, f, s.q, s.gainDb, sampleRate);
+        }
+    }
+    filterRunCount = n;
+    filterchain_reset();
+    FilterChainStats &st = filterChainStats;
+    st.sections = n;
+    st.cyclesPerSampleX10 = 0;
+    st.maxBlockCycles = 0;
+    st.loadPctX10 = 0;
+    st.loadPeakPctX10 = 0;
+    st.overBudget = false;
+}
+
+void filterchain_reset() {
+    for (uint8_t i = 0; i < filterRunCount; i++) filterRun[i].z1 = filterRun[i].z2 = 0.0f;
+}
+
+bool filterchain_active() {
+    return filterRunCount > 0;
+}
+
+void filterchain_process(float *buf, int samples) {
+    for (uint8_t s = 0; s < filterRunCount; s++) {
+        BiquadRun &r = filterRun[s];
+        const float b0 = r.c.b0, b1 = r.c.b1, b2 = r.c.b2, a1 = r.c.a1, a2 = r.c.a2;
+        float z1 = r.z1, z2 = r.z2;
+        for (int i = 0; i < samples; i++) {
+            float x = buf[i];
+            float y = b0 * x + z1;
+            z1 = b1 * x - a1 * y + z2;
+            z2 = b2 * x - a2 * y;
+            buf[i] = y;
+        }
+        r.z1 = z1;
+        r.z2 = z2;
+    }
+}
+
+void filterchain_account(uint32_t cycles, int samples, uint32_t periodCycles) {
+    FilterChainStats &st = filterChainStats;
+    if (samples <= 0) return;
+    uint32_t cps = (uint32_t)((uint64_t)cycles * 10 / (uint32_t)samples);
+    uint32_t load = periodCycles ? (uint32_t)((uint64_t)cycles * 1000 / periodCycles) : 0;
+    if (load > 65535) load = 65535;
+    if (st.blocks == 0) {
+        st.cyclesPerSampleX10 = cps;
+        st.loadPctX10 = (uint16_t)load;
+    } else {
+        st.cyclesPerSampleX10 = st.cyclesPerSampleX10 - st.cyclesPerSampleX10 / 8 + cps / 8;
+        st.loadPctX10 = (uint16_t)(st.loadPctX10 - st.loadPctX10 / 8 + load / 8);
+    }
+    st.blocks++;
+    if (cycles > st.maxBlockCycles) st.maxBlockCycles = cycles;
+    if (load > st.loadPeakPctX10) st.loadPeakPctX10 = (uint16_t)load;
+    if (load > FILTER_CHAIN_BUDGET_PCT * 10U) {
+        st.overBudgetBlocks++;
+        st.overBudget = true;
+    }
+}
+
+float filterchain_responseDb(float freqHz, float sampleRate) {
+    // Double precision: near a low notch the numerator is a small difference of O(1) terms.
+    const double pi = 3.14159265358979323846;
+    double w = 2.0 * pi * freqHz / sampleRate;
+    double c1 = cos(w), s1 = sin(w), c2 = cos(2.0 * w), s2 = sin(2.0 * w);
+    double db = 0.0;
+    for (uint8_t i = 0; i < filterRunCount; i++) {
+        const BiquadCoeffs &c = filterRun[i].c;
+        double nr = c.b0 + c.b1 * c1 + c.b2 * c2, ni = -(c.b1 * s1 + c.b2 * s2);
+        double dr = 1.0 + c.a1 * c1 + c.a2 * c2, di = -(c.a1 * s1 + c.a2 * s2);
+        double num = nr * nr + ni * ni, den = dr * dr + di * di;
+        db += 10.0 * log10((num > 1e-20 ? num : 1e-20) / (den > 1e-20 ? den : 1e-20));
+    }
+    return (float)db;
+}
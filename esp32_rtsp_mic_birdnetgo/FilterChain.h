@@ -0,0 +1,88 @@
+#pragma once
+#include <Arduino.h>
+
+// Capture-path filter chain (ESP32 RTSP Mic for BirdNET-Go)
+//
+// A cascade of biquad sections (RBJ cookbook designs) run block-wise over the capture buffer:
+// each section processes the whole block before the next one, in transposed direct form II.
+// Coefficients are computed only when the chain, the sample rate or the HPF setting changes.
+//
+// The chain is the legacy high-pass (hp_enable/hp_cutoff) followed by up to
+// FILTER_CHAIN_MAX_SECTIONS user sections, set as a JSON array through /api/set key "filters":
+//   [{"type":"hum","f":50,"harmonics":3},{"type":"lowshelf","f":120,"gain":-6},
+//    {"type":"peak","f":2500,"q":2,"gain":-4}]
+// Types: hp (f, q), notch (f, q), peak (f, q, gain), lowshelf (f, q, gain), and hum, which
+// expands to notches at f and its harmonics (each counts as a section).
+//
+// Cycle budget: the filter pass may use FILTER_CHAIN_BUDGET_PCT of the block period. Its cost is
+// measured every block; going over is reported (filter_over_budget) and logged once, not
+// enforced, since the cost depends on the CPU clock and the sample rate.
+
+#ifndef FILTER_CHAIN_MAX_SECTIONS
+#define FILTER_CHAIN_MAX_SECTIONS 8
+#endif
+#ifndef FILTER_CHAIN_BUDGET_PCT
+#define FILTER_CHAIN_BUDGET_PCT 25
+#endif
+#ifndef FILTER_CHAIN_JSON_MAX
+#define FILTER_CHAIN_JSON_MAX 512
+#endif
+
+enum FilterType : uint8_t {
+    FILTER_HP,
+    FILTER_NOTCH,
+    FILTER_PEAK,
+    FILTER_LOWSHELF,
+    FILTER_HUM,               // notch at f, 2f, ... (harmonics sections)
+    FILTER_TYPE_COUNT
+};
+
+struct FilterSpec {
+    uint8_t type;
+    uint8_t harmonics;        // FILTER_HUM only
+    float freqHz;
+    float q;
+    float gainDb;             // FILTER_PEAK / FILTER_LOWSHELF
+};
+
+struct BiquadCoeffs {
+    float b0, b1, b2, a1, a2; // normalised, a0 = 1
+};
+
+// Arena region ARENA_FILTER: coefficients and two state words per section, legacy HPF included.
+static constexpr uint32_t FILTER_CHAIN_ARENA_BYTES =
+    (FILTER_CHAIN_MAX_SECTIONS + 1) * (sizeof(BiquadCoeffs) + 2 * sizeof(float));
+
+struct FilterChainStats {
+    uint8_t sections;         // active biquads, HPF included
+    uint32_t blocks;
+    uint32_t cyclesPerSampleX10;  // EWMA (1/8)
+    uint32_t maxBlockCycles;
+    uint16_t loadPctX10;      // EWMA share of the block period
+    uint16_t loadPeakPctX10;
+    bool overBudget;
+    uint32_t overBudgetBlocks;
+};
+
+extern FilterChainStats filterChainStats;
+
+const char *filterchain_typeName(uint8_t type);
+uint8_t filterchain_sectionCount(const FilterSpec &spec);
+
+// Parses a JSON array of sections; error is a short code on failure.
+bool filterchain_parse(const String &json, FilterSpec *out, uint8_t &count, const char *&error);
+String filterchain_toJson(const FilterSpec *specs, uint8_t count);
+
+// One section's coefficients; the frequency is clamped to 10 Hz .. 0.45 fs.
+BiquadCoeffs filterchain_design(uint8_t type, float freqHz, float q, float gainDb, float sampleRate);
+
+// Rebuilds the running chain (state cleared). hpCutoffHz = 0 leaves the high-pass out.
+void filterchain_configure(uint16_t hpCutoffHz, const FilterSpec *specs, uint8_t count, float sampleRate);
+void filterchain_reset();
+bool filterchain_active();
+void filterchain_process(float *buf, int samples);
+// Accounts one block: its filter cycles against the block period in cycles.
+void filterchain_account(uint32_t cycles, int samples, uint32_t periodCycles);
+
+// Magnitude response of the running chain at freqHz, in dB.
+float filterchain_responseDb(float freqHz, float sampleRate);
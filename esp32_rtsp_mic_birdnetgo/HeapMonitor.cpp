@@ -0,0 +1,116 @@
+#include "HeapMonitor.h"
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static const char *const HEAP_SYS_NAMES[HEAP_SYS_COUNT] = {
+    "other",
+    "web",
+    "mqtt",
+    "rtsp",
+    "log",
+};
+
+static const uint8_t HEAP_TAGGED_TASKS = 4;
+
+HeapStatus heapStatus = {};
+HeapAllocStats heapAllocStats[HEAP_SYS_COUNT] = {};
+volatile uint8_t heapmonLoopScope = HEAP_SYS_OTHER;
+
+static TaskHandle_t heapLoopTask = nullptr;
+static TaskHandle_t heapTaskHandles[HEAP_TAGGED_TASKS] = {};
+static uint8_t heapTaskSys[HEAP_TAGGED_TASKS] = {};
+
+static HeapSample heapTrend[HEAP_TREND_SAMPLES];
+static uint8_t heapTrendHead = 0;    // next write position
+static uint8_t heapTrendCount = 0;
+static uint32_t heapTrendLastMs = 0;
+
+const char *heapmon_subsystemName(uint8_t sys) {
+    return sys < HEAP_SYS_COUNT ? HEAP_SYS_NAMES[sys] : "";
+}
+
+void heapmon_begin() {
+    heapLoopTask = xTaskGetCurrentTaskHandle();
+    heapStatus.minLargestBlock = 0xFFFFFFFF;
+    heapmon_sample(millis());
+    heapTrendLastMs = millis();
+}
+
+void heapmon_tagCurrentTask(HeapSubsystem sys) {
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    for (uint8_t i = 0; i < HEAP_TAGGED_TASKS; i++) {
+        if (heapTaskHandles[i] == self || heapTaskHandles[i] == nullptr) {
+            heapTaskSys[i] = sys;
+            heapTaskHandles[i] = self;
+            return;
+        }
+    }
+}
+
+static void heapTrendPush(uint32_t nowMs) {
+    HeapSample &s = heapTrend[heapTrendHead];
+    s.uptimeMin = nowMs / 60000UL;
+    s.freeBytes = heapStatus.freeBytes;
+    s.largestBlock = heapStatus.largestBlock;
+    s.fragPct = heapStatus.fragPct;
+    heapTrendHead = (uint8_t)((heapTrendHead + 1) % HEAP_TREND_SAMPLES);
+    if (heapTrendCount < HEAP_TREND_SAMPLES) heapTrendCount++;
+}
+
+void heapmon_sample(uint32_t nowMs) {
+    HeapStatus &h = heapStatus;
+    h.freeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    h.largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    h.minFreeEver = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    h.fragPct = (h.freeBytes > 0 && h.largestBlock < h.freeBytes)
+        ? (uint8_t)(100UL - (uint32_t)(((uint64_t)h.largestBlock * 100ULL) / h.freeBytes))
+        : 0;
+    if (h.largestBlock < h.minLargestBlock) h.minLargestBlock = h.largestBlock;
+    if (h.fragPct > h.fragMaxPct) h.fragMaxPct = h.fragPct;
+    h.samples++;
+    if (heapTrendCount == 0 || nowMs - heapTrendLastMs >= HEAP_TREND_INTERVAL_MS) {
+        heapTrendLastMs = nowMs;
+        heapTrendPush(nowMs);
+    }
+}
+
+uint8_t heapmon_trendCount() {
+    return heapTrendCount;
+}
+
+bool heapmon_trendAt(uint8_t i, HeapSample &out) {
+    if (i >= heapTrendCount) return false;
+    uint8_t first = (uint8_t)((heapTrendHead + HEAP_TREND_SAMPLES - heapTrendCount) % HEAP_TREND_SAMPLES);
+    out = heapTrend[(first + i) % HEAP_TREND_SAMPLES];
+    return true;
+}
+
+#if HEAP_MONITOR_HOOKS
+
+// Called by the IDF allocator for every heap operation, from any task and possibly with the
+// flash cache disabled: IRAM only, no locking (counters are diagnostic; a rare lost update
+// from preemption is acceptable).
+static IRAM_ATTR uint8_t heapCallerSubsystem() {
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    if (self == heapLoopTask) return heapmonLoopScope;
+    for (uint8_t i = 0; i < HEAP_TAGGED_TASKS; i++) {
+        if (heapTaskHandles[i] == self) return heapTaskSys[i];
+    }
+    return HEAP_SYS_OTHER;
+}
+
+extern "C" IRAM_ATTR void esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps) {
+    (void)caps;
+    if (!ptr) return;
+    HeapAllocStats &s = heapAllocStats[heapCallerSubsystem()];
+    s.allocs++;
+    s.allocBytes += size;
+}
+
+extern "C" IRAM_ATTR void esp_heap_trace_free_hook(void *ptr) {
+    if (!ptr) return;
+    heapAllocStats[heapCallerSubsystem()].frees++;
+}
+
+#endif
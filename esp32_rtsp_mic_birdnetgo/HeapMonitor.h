@@ -0,0 +1,87 @@
+#pragma once
+#include <Arduino.h>
+
+// Heap health monitor (ESP32 RTSP Mic for BirdNET-Go)
+//
+// Sampled from the loop() heap job: free bytes, largest free block and the fragmentation
+// ratio (share of free memory not usable as one block), with worst values since boot and a
+// coarse trend ring that covers about a day, so a slow leak or growing fragmentation shows
+// up long before the scheduled reset would hide it.
+//
+// Allocation counts per subsystem need the ESP-IDF heap hooks (CONFIG_HEAP_USE_HOOKS, not
+// set in the stock Arduino core). With them, every malloc/free is attributed to the task
+// that made it: tasks tagged with heapmon_tagCurrentTask() count for their subsystem, the
+// loop task counts for the innermost HEAP_SCOPE(), everything else for "other".
+
+#if defined(CONFIG_HEAP_USE_HOOKS)
+#define HEAP_MONITOR_HOOKS 1
+#else
+#define HEAP_MONITOR_HOOKS 0
+#endif
+
+#ifndef HEAP_TREND_SAMPLES
+#define HEAP_TREND_SAMPLES 96
+#endif
+#ifndef HEAP_TREND_INTERVAL_MS
+#define HEAP_TREND_INTERVAL_MS (15UL * 60UL * 1000UL)   // 96 x 15 min = 24 h
+#endif
+
+enum HeapSubsystem : uint8_t {
+    HEAP_SYS_OTHER,
+    HEAP_SYS_WEB,
+    HEAP_SYS_MQTT,
+    HEAP_SYS_RTSP,
+    HEAP_SYS_LOG,
+    HEAP_SYS_COUNT
+};
+
+struct HeapAllocStats {
+    uint32_t allocs;
+    uint32_t frees;
+    uint64_t allocBytes;
+};
+
+struct HeapSample {
+    uint32_t uptimeMin;
+    uint32_t freeBytes;
+    uint32_t largestBlock;
+    uint8_t fragPct;
+};
+
+struct HeapStatus {
+    uint32_t freeBytes;
+    uint32_t largestBlock;
+    uint32_t minFreeEver;      // heap_caps low-water mark since boot
+    uint32_t minLargestBlock;  // smallest largest-block seen by heapmon_sample()
+    uint8_t fragPct;
+    uint8_t fragMaxPct;
+    uint32_t samples;
+};
+
+extern HeapStatus heapStatus;
+extern HeapAllocStats heapAllocStats[HEAP_SYS_COUNT];
+
+void heapmon_begin();   // call from setup() (runs in the loop task)
+void heapmon_tagCurrentTask(HeapSubsystem sys);
+// Reads the heap counters; pushes a trend sample every HEAP_TREND_INTERVAL_MS.
+void heapmon_sample(uint32_t nowMs);
+const char *heapmon_subsystemName(uint8_t sys);
+
+// Trend ring, oldest first; returns false past the end.
+uint8_t heapmon_trendCount();
+bool heapmon_trendAt(uint8_t i, HeapSample &out);
+
+extern volatile uint8_t heapmonLoopScope;
+
+class HeapScope {
+public:
+    explicit HeapScope(HeapSubsystem sys) : prev_(heapmonLoopScope) { heapmonLoopScope = sys; }
+    ~HeapScope() { heapmonLoopScope = prev_; }
+
+private:
+    uint8_t prev_;
+};
+
+#define HEAP_SCOPE_CAT2(a, b) a##b
+#define HEAP_SCOPE_CAT(a, b) HEAP_SCOPE_CAT2(a, b)
+#define HEAP_SCOPE(sys) HeapScope HEAP_SCOPE_CAT(heapScope_, __LINE__)(sys)
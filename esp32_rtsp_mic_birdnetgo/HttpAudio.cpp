@@ -0,0 +1,261 @@
+#include "HttpAudio.h"
+#include "AudioArena.h"
+#include <errno.h>
+#include <lwip/sockets.h>
+#include <string.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+HttpAudioStats httpAudioStats = {0, 0, 0, 0, 0, 0, 0, 0, 0, "none"};
+
+struct Listener {
+    WiFiClient client;
+    bool used;
+    uint32_t sampleRate;
+    uint32_t lastProgressMs;
+    uint8_t *carry;             // unsent rest of one chunk after a partial write (arena slot)
+    uint32_t carryLen;
+    uint32_t carryOff;
+};
+
+static Listener listeners[HTTP_AUDIO_MAX_SLOTS];
+
+// Largest block payload and how many chunks it is cut into
+static const size_t MAX_PAYLOAD = AUDIO_MAX_BUFFER_SAMPLES * sizeof(int16_t);
+static const int MAX_CHUNKS = (int)((MAX_PAYLOAD + HTTP_AUDIO_CHUNK_BYTES - 1) / HTTP_AUDIO_CHUNK_BYTES);
+static_assert(HTTP_AUDIO_CHUNK_BYTES % sizeof(int16_t) == 0, "HTTP_AUDIO_CHUNK_BYTES must hold whole samples");
+static const size_t HEAD_MAX = 320;
+static_assert(HTTP_AUDIO_CARRY_BYTES >= HEAD_MAX + 50, "carry slot must hold the response head and WAV header");
+
+static uint8_t *carrySlot(const Listener &l) {
+    return audioarena_region(ARENA_HTTP_CARRY) + (size_t)(&l - listeners) * HTTP_AUDIO_CARRY_BYTES;
+}
+
+// Bytes taken (0 if the socket is full), or -1 if the connection is gone.
+static int sendNow(Listener &l, const struct iovec *iov, int iovCount) {
+    int fd = l.client.fd();
+    if (fd < 0) return -1;
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = (struct iovec *)iov;
+    msg.msg_iovlen = iovCount;
+    int n = (int)sendmsg(fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (n < 0) return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+    return n;
+}
+
+// iov is a run of units of `group` entries each (one HTTP chunk, or the response head). After
+// a partial write the rest of the unit that was cut goes to the listener's carry slot; the
+// units after it are dropped, whole. false if the rest does not fit (no unit is that large).
+static bool keepRest(Listener &l, const struct iovec *iov, int iovCount, int group, size_t sent) {
+    int u = 0;
+    for (; u < iovCount; u += group) {
+        size_t unit = 0;
+        for (int i = u; i < u + group; i++) unit += iov[i].iov_len;
+        if (sent < unit) break;
+        sent -= unit;
+    }
+    l.carryLen = l.carryOff = 0;
+    if (u >= iovCount || sent == 0) {
+        httpAudioStats.blocksDropped++;   // cut at a chunk boundary: the rest is simply not sent
+        return true;
+    }
+    uint32_t out = 0;
+    for (int i = u; i < u + group; i++) {
+        const uint8_t *b = (const uint8_t *)iov[i].iov_base;
+        size_t len = iov[i].iov_len;
+        if (sent >= len) { sent -= len; continue; }
+        if (out + (len - sent) > HTTP_AUDIO_CARRY_BYTES) return false;
+        memcpy(l.carry + out, b + sent, len - sent);
+        out += (uint32_t)(len - sent);
+        sent = 0;
+    }
+    l.carryLen = out;
+    httpAudioStats.partialWrites++;
+    return true;
+}
+
+// finish: end the chunked body properly (device-side close) if no chunk is half sent.
+static void closeListener(Listener &l, const char *reason, bool finish) {
+    if (finish && l.carryLen == 0) {
+        struct iovec end = {(void *)"0\r\n\r\n", 5};
+        sendNow(l, &end, 1);
+    }
+    l.client.stop();
+    l.client = WiFiClient();
+    l.carryLen = l.carryOff = 0;
+    l.used = false;
+    httpAudioStats.clients--;
+    httpAudioStats.lastCloseReason = reason;
+}
+
+// Sends the block's chunks, or as much of them as fits. false: the connection is gone.
+static bool sendChunks(Listener &l, const struct iovec *iov, int iovCount, size_t total, uint32_t nowMs) {
+    int n = sendNow(l, iov, iovCount);
+    if (n < 0) return false;
+    if (n == 0) {
+        httpAudioStats.blocksDropped++;
+        return true;
+    }
+    httpAudioStats.bytesSent += (uint32_t)n;
+    if ((size_t)n < total) return keepRest(l, iov, iovCount, 3, (size_t)n);
+    httpAudioStats.blocksSent++;
+    l.lastProgressMs = nowMs;
+    return true;
+}
+
+// The rest of an earlier chunk goes first. true once it is out.
+static bool flushCarry(Listener &l, uint32_t nowMs, bool &gone) {
+    if (l.carryLen == 0) return true;
+    struct iovec iov = {l.carry + l.carryOff, l.carryLen - l.carryOff};
+    int n = sendNow(l, &iov, 1);
+    if (n < 0) { gone = true; return false; }
+    httpAudioStats.bytesSent += (uint32_t)n;
+    l.carryOff += (uint32_t)n;
+    if (l.carryOff < l.carryLen) return false;
+    l.carryLen = l.carryOff = 0;
+    l.lastProgressMs = nowMs;
+    return true;
+}
+
+static void put16(uint8_t *p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+static void put32(uint8_t *p, uint32_t v) { put16(p, (uint16_t)v); put16(p + 2, (uint16_t)(v >> 16)); }
+
+// PCM 16-bit mono, sizes unknown (0xFFFFFFFF), as players expect from a live stream.
+static void buildWavHeader(uint8_t *h, uint32_t sampleRate) {
+    memcpy(h, "RIFF", 4);
+    put32(h + 4, 0xFFFFFFFFUL);
+    memcpy(h + 8, "WAVEfmt ", 8);
+    put32(h + 16, 16);
+    put16(h + 20, 1);
+    put16(h + 22, 1);
+    put32(h + 24, sampleRate);
+    put32(h + 28, sampleRate * 2);
+    put16(h + 32, 2);
+    put16(h + 34, 16);
+    memcpy(h + 36, "data", 4);
+    put32(h + 40, 0xFFFFFFFFUL);
+}
+
+bool httpaudio_attach(WiFiClient &client, bool wav, uint32_t sampleRate, uint8_t maxClients, const char *&error) {
+    if (maxClients > HTTP_AUDIO_MAX_SLOTS) maxClients = HTTP_AUDIO_MAX_SLOTS;
+    if (maxClients == 0 || httpAudioStats.clients >= maxClients) {
+        httpAudioStats.rejects++;
+        error = maxClients == 0 ? "disabled" : "busy";
+        return false;
+    }
+    Listener *l = nullptr;
+    for (uint8_t i = 0; i < HTTP_AUDIO_MAX_SLOTS && !l; i++) {
+        if (!listeners[i].used) l = &listeners[i];
+    }
+    if (!l) {
+        httpAudioStats.rejects++;
+        error = "busy";
+        return false;
+    }
+
+    char head[HEAD_MAX];
+    int len = snprintf(head, sizeof(head),
+                       "HTTP/1.1 200 OK\r\n"
+                       "Content-Type: %s\r\n"
+                       "X-Audio-Format: s16le; rate=%lu; channels=1\r\n"
+                       "Transfer-Encoding: chunked\r\n"
+                       "Cache-Control: no-cache, no-store\r\n"
+                       "Connection: close\r\n\r\n",
+                       wav ? "audio/wav" : "application/octet-stream", (unsigned long)sampleRate);
+    uint8_t wavChunk[4 + 44 + 2];
+    memcpy(wavChunk, "2c\r\n", 4);   // one chunk: the 44-byte header
+    buildWavHeader(wavChunk + 4, sampleRate);
+    memcpy(wavChunk + 48, "\r\n", 2);
+    struct iovec iov[2] = {{head, (size_t)len}, {wavChunk, 50}};
+    const int iovCount = wav ? 2 : 1;
+    const size_t total = (size_t)len + (wav ? 50 : 0);
+
+    l->client = client;
+    l->client.setNoDelay(true);
+    l->carry = carrySlot(*l);
+    l->carryLen = l->carryOff = 0;
+    int n = sendNow(*l, iov, iovCount);
+    if (n <= 0 || ((size_t)n < total && !keepRest(*l, iov, iovCount, iovCount, (size_t)n))) {
+        l->carryLen = 0;
+        l->client = WiFiClient();
+        httpAudioStats.rejects++;
+        error = "send_failed";
+        return false;
+    }
+    httpAudioStats.bytesSent += (uint32_t)n;
+    l->used = true;
+    l->sampleRate = sampleRate;
+    l->lastProgressMs = millis();
+    httpAudioStats.clients++;
+    httpAudioStats.connects++;
+    return true;
+}
+
+uint8_t httpaudio_block(const int16_t *pcm, int samples, uint32_t sampleRate, uint32_t nowMs) {
+    if (httpAudioStats.clients == 0 || samples <= 0) return 0;
+    // Chunks of at most HTTP_AUDIO_CHUNK_BYTES, straight from the capture buffer, in one
+    // sendmsg(); only the last one can be shorter.
+    const size_t payload = (size_t)samples * sizeof(int16_t);
+    if (payload > MAX_PAYLOAD) return 0;
+    char sizeFull[8], sizeLast[8];
+    const int fullLen = snprintf(sizeFull, sizeof(sizeFull), "%x\r\n", (unsigned)HTTP_AUDIO_CHUNK_BYTES);
+    struct iovec iov[3 * MAX_CHUNKS];
+    int iovCount = 0;
+    size_t total = 0;
+    for (size_t off = 0; off < payload; off += HTTP_AUDIO_CHUNK_BYTES) {
+        const size_t n = payload - off < HTTP_AUDIO_CHUNK_BYTES ? payload - off : HTTP_AUDIO_CHUNK_BYTES;
+        iov[iovCount].iov_base = sizeFull;
+        iov[iovCount].iov_len = (size_t)fullLen;
+        if (n < HTTP_AUDIO_CHUNK_BYTES) {
+            iov[iovCount].iov_base = sizeLast;
+            iov[iovCount].iov_len = (size_t)snprintf(sizeLast, sizeof(sizeLast), "%x\r\n", (unsigned)n);
+        }
+        iov[iovCount + 1].iov_base = (uint8_t *)pcm + off;
+        iov[iovCount + 1].iov_len = n;
+        iov[iovCount + 2].iov_base = (void *)"\r\n";
+        iov[iovCount + 2].iov_len = 2;
+        total += iov[iovCount].iov_len + n + 2;
+        iovCount += 3;
+    }
+
+    uint8_t closed = 0;
+    for (uint8_t i = 0; i < HTTP_AUDIO_MAX_SLOTS; i++) {
+        Listener &l = listeners[i];
+        if (!l.used) continue;
+        if (l.sampleRate != sampleRate) {
+            httpAudioStats.errorDisconnects++;
+            closeListener(l, "rate_changed", true);
+            closed++;
+            continue;
+        }
+        bool gone = false;
+        bool ok = flushCarry(l, nowMs, gone);
+        if (!gone) {
+            if (ok) gone = !sendChunks(l, iov, iovCount, total, nowMs);
+            else httpAudioStats.blocksDropped++;
+        }
+        if (gone) {
+            httpAudioStats.errorDisconnects++;
+            closeListener(l, "closed", false);
+            closed++;
+        } else if (nowMs - l.lastProgressMs > HTTP_AUDIO_STALL_MS) {
+            httpAudioStats.stallDisconnects++;
+            closeListener(l, "stalled", false);
+            closed++;
+        }
+    }
+    return closed;
+}
+
+uint8_t httpaudio_clients() {
+    return httpAudioStats.clients;
+}
+
+void httpaudio_closeAll(const char *reason) {
+    for (uint8_t i = 0; i < HTTP_AUDIO_MAX_SLOTS; i++) {
+        if (listeners[i].used) closeListener(listeners[i], reason, true);
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+
+// HTTP live audio (ESP32 RTSP Mic for BirdNET-Go)
+//
+// GET /audio.wav and /audio.pcm on the web UI port, for consumers that cannot speak RTSP
+// (curl, a Python script, a browser <audio> tag). The web handler hands its socket over with
+// httpaudio_attach(); from then on every processed block that goes to sendRTPPacket() (or that
+// is captured for the listeners alone while no RTSP client streams) is written to each
+// listener as HTTP chunks of at most HTTP_AUDIO_CHUNK_BYTES straight from the capture buffer:
+// size lines, samples and CRLFs in a single sendmsg() with MSG_DONTWAIT. The core's
+// WiFiClient::write() waits for socket space, so it is not used here. Capture never waits for
+// a listener and never allocates:
+//   - a block that cannot go out at all is dropped for that listener (counted);
+//   - after a partial write, the rest of the chunk that was cut is copied to the listener's
+//     carry slot (HTTP_AUDIO_CARRY_BYTES in the audio arena, the only copy), the block's
+//     later chunks are dropped, and so are the following blocks until the rest is out, so
+//     the chunk framing stays intact;
+//   - a listener that has not taken a whole block for HTTP_AUDIO_STALL_MS is disconnected.
+// /audio.wav starts with a WAV header of unknown length (sizes 0xFFFFFFFF), /audio.pcm is the
+// bare samples (s16le, mono). Both end when the sample rate changes, since the header would be
+// wrong.
+
+#ifndef HTTP_AUDIO_MAX_SLOTS
+#define HTTP_AUDIO_MAX_SLOTS 4
+#endif
+#ifndef HTTP_AUDIO_DEFAULT_CLIENTS
+#define HTTP_AUDIO_DEFAULT_CLIENTS 2
+#endif
+#ifndef HTTP_AUDIO_STALL_MS
+#define HTTP_AUDIO_STALL_MS 5000UL
+#endif
+#ifndef HTTP_AUDIO_CHUNK_BYTES
+#define HTTP_AUDIO_CHUNK_BYTES 2048        // payload per HTTP chunk; bounds the carry slot
+#endif
+
+// Arena region ARENA_HTTP_CARRY: one chunk (size line, payload, CRLF) per listener slot.
+static constexpr uint32_t HTTP_AUDIO_CARRY_BYTES = HTTP_AUDIO_CHUNK_BYTES + 16;
+static constexpr uint32_t HTTP_AUDIO_ARENA_BYTES = HTTP_AUDIO_MAX_SLOTS * HTTP_AUDIO_CARRY_BYTES;
+
+struct HttpAudioStats {
+    uint8_t clients;
+    uint32_t connects;
+    uint32_t rejects;           // over the client limit, or disabled
+    uint32_t blocksSent;        // summed over listeners
+    uint32_t blocksDropped;
+    uint32_t partialWrites;
+    uint32_t stallDisconnects;
+    uint32_t errorDisconnects;  // closed by the peer, reset, rate change
+    uint64_t bytesSent;
+    const char *lastCloseReason;
+};
+
+extern HttpAudioStats httpAudioStats;
+
+// Sends the response head (and the WAV header) and keeps the socket as a listener. On false
+// nothing has been sent and the caller answers with an error; error is "disabled", "busy" or
+// "send_failed".
+bool httpaudio_attach(WiFiClient &client, bool wav, uint32_t sampleRate, uint8_t maxClients, const char *&error);
+
+// One processed block for every listener. Must run before sendRTPPacket(), which byte-swaps
+// the buffer in place. Returns how many listeners were closed (reason in lastCloseReason).
+uint8_t httpaudio_block(const int16_t *pcm, int samples, uint32_t sampleRate, uint32_t nowMs);
+
+uint8_t httpaudio_clients();
+
+// Ends every stream cleanly (last chunk) with reason as lastCloseReason.
+void httpaudio_closeAll(const char *reason);
@@ -0,0 +1,106 @@
+#include "JobScheduler.h"
+#include <string.h>
+
+int JobScheduler::add(const char *name, JobFn fn, uint32_t periodMs, JobPriority prio, uint32_t budgetUs,
+                      uint32_t maxDeferMs, uint32_t nowMs, uint32_t firstDelayMs) {
+    if (count_ >= JOB_SCHEDULER_MAX_JOBS || !fn || periodMs == 0) return -1;
+    Job &j = jobs_[count_];
+    memset(&j, 0, sizeof(j));
+    j.name = name;
+    j.fn = fn;
+    j.periodMs = periodMs;
+    j.budgetUs = budgetUs;
+    j.maxDeferMs = maxDeferMs;
+    j.prio = prio;
+    j.dueMs = nowMs + firstDelayMs;
+    j.stats.avgUs = budgetUs;
+    return (int)count_++;
+}
+
+void JobScheduler::setPeriod(int id, uint32_t periodMs) {
+    if (id < 0 || (size_t)id >= count_ || periodMs == 0) return;
+    Job &j = jobs_[id];
+    // Keep the last run as the phase reference.
+    j.dueMs = j.dueMs - j.periodMs + periodMs;
+    j.periodMs = periodMs;
+}
+
+void JobScheduler::trigger(int id, uint32_t nowMs) {
+    if (id < 0 || (size_t)id >= count_) return;
+    jobs_[id].dueMs = nowMs;
+}
+
+void JobScheduler::resetStats() {
+    for (size_t i = 0; i < count_; i++) {
+        uint32_t avg = jobs_[i].stats.avgUs;
+        memset(&jobs_[i].stats, 0, sizeof(jobs_[i].stats));
+        jobs_[i].stats.avgUs = avg;
+    }
+    iterationsOverBudget_ = 0;
+}
+
+// Highest priority due job (oldest due time first) that may run now; audio backlog holds
+// back non-urgent jobs until they have waited maxDeferMs.
+int JobScheduler::pickNext(uint32_t nowMs, bool audioBacklog, const bool *done) {
+    int best = -1;
+    for (size_t i = 0; i < count_; i++) {
+        const Job &j = jobs_[i];
+        if (done[i] || !isDue(j, nowMs)) continue;
+        if (audioBacklog && j.prio != JOB_URGENT && (nowMs - j.dueMs) < j.maxDeferMs) {
+            if (!j.waitingAudio) jobs_[i].stats.deferredAudio++;
+            jobs_[i].waitingAudio = true;
+            continue;
+        }
+        if (best < 0 || j.prio < jobs_[best].prio ||
+            (j.prio == jobs_[best].prio && (int32_t)(j.dueMs - jobs_[best].dueMs) < 0)) {
+            best = (int)i;
+        }
+    }
+    return best;
+}
+
+uint8_t JobScheduler::runDue(uint32_t nowMs, bool audioBacklog) {
+    bool done[JOB_SCHEDULER_MAX_JOBS] = {};
+    uint32_t startUs = clockUs_();
+    uint32_t usedUs = 0;
+    uint8_t ran = 0;
+
+    for (;;) {
+        int id = pickNext(nowMs, audioBacklog, done);
+        if (id < 0) break;
+        Job &j = jobs_[id];
+        done[id] = true;
+        // Always run one job; further ones only if their typical run time still fits.
+        if (ran > 0 && usedUs + j.stats.avgUs > iterationBudgetUs_) {
+            if (!j.waitingBusy) j.stats.deferredBusy++;
+            j.waitingBusy = true;
+            continue;
+        }
+
+        uint32_t lateMs = nowMs - j.dueMs;
+        uint32_t t0 = clockUs_();
+        j.fn();
+        uint32_t dt = clockUs_() - t0;
+
+        JobStats &s = j.stats;
+        s.runs++;
+        s.totalUs += dt;
+        s.lastUs = dt;
+        if (dt > s.maxUs) s.maxUs = dt;
+        if (dt > j.budgetUs) s.overBudget++;
+        s.avgUs = (s.runs == 1) ? dt : (s.avgUs - (s.avgUs >> 3) + (dt >> 3));
+        if (lateMs > s.lateMaxMs) s.lateMaxMs = lateMs;
+        s.lastRunMs = nowMs;
+        j.waitingAudio = false;
+        j.waitingBusy = false;
+
+        // Keep the phase; skip missed periods instead of catching up in a burst.
+        j.dueMs += j.periodMs;
+        if (isDue(j, nowMs)) j.dueMs = nowMs + j.periodMs;
+
+        ran++;
+        usedUs = clockUs_() - startUs;
+    }
+    if (usedUs > iterationBudgetUs_) iterationsOverBudget_++;
+    return ran;
+}
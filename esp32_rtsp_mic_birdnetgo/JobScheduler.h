@@ -0,0 +1,85 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Cooperative job scheduler for loop() housekeeping (ESP32 RTSP Mic for BirdNET-Go)
+//
+// Replaces the chain of `if (millis() - lastX > N)` blocks. runDue() is called once per
+// loop() iteration and runs due jobs in priority order until the iteration budget is used
+// up, so periodic work that falls due together is spread over consecutive iterations
+// instead of landing in one. While the audio path reports a backlog, only JOB_URGENT jobs
+// run; other jobs wait up to their maxDeferMs.
+//
+// Plain C++ with an injected microsecond clock: the core runs on a host with a virtual
+// clock (now is passed in, run time is read through clockUs).
+
+#ifndef JOB_SCHEDULER_MAX_JOBS
+#define JOB_SCHEDULER_MAX_JOBS 16
+#endif
+
+enum JobPriority : uint8_t {
+    JOB_URGENT,       // runs even with audio backlog
+    JOB_NORMAL,
+    JOB_BACKGROUND
+};
+
+typedef void (*JobFn)();
+typedef uint32_t (*JobClockUs)();
+
+struct JobStats {
+    uint32_t runs;
+    uint64_t totalUs;
+    uint32_t maxUs;
+    uint32_t lastUs;
+    uint32_t avgUs;           // EWMA (1/8), start value = budget; used to plan iterations
+    uint32_t overBudget;      // runs longer than budgetUs
+    uint32_t deferredBusy;    // postponed: iteration budget used up
+    uint32_t deferredAudio;   // postponed: audio backlog
+    uint32_t lateMaxMs;       // worst start delay past the due time
+    uint32_t lastRunMs;
+};
+
+struct Job {
+    const char *name;
+    JobFn fn;
+    uint32_t periodMs;
+    uint32_t budgetUs;
+    uint32_t maxDeferMs;      // audio backlog may postpone the job at most this long
+    JobPriority prio;
+    uint32_t dueMs;
+    bool waitingAudio;        // currently held back (counts each episode once)
+    bool waitingBusy;
+    JobStats stats;
+};
+
+class JobScheduler {
+public:
+    explicit JobScheduler(JobClockUs clockUs) : clockUs_(clockUs) {}
+
+    // Returns the job id, or -1 if the table is full. firstDelayMs staggers start-up.
+    int add(const char *name, JobFn fn, uint32_t periodMs, JobPriority prio, uint32_t budgetUs,
+            uint32_t maxDeferMs, uint32_t nowMs, uint32_t firstDelayMs);
+    void setPeriod(int id, uint32_t periodMs);
+    // Makes the job due now (e.g. after a settings change).
+    void trigger(int id, uint32_t nowMs);
+    void setIterationBudgetUs(uint32_t us) { iterationBudgetUs_ = us; }
+    uint32_t iterationBudgetUs() const { return iterationBudgetUs_; }
+
+    // Runs due jobs; returns how many ran.
+    uint8_t runDue(uint32_t nowMs, bool audioBacklog);
+
+    size_t count() const { return count_; }
+    const Job &job(size_t i) const { return jobs_[i]; }
+    uint32_t iterationsOverBudget() const { return iterationsOverBudget_; }
+    void resetStats();
+
+private:
+    static bool isDue(const Job &j, uint32_t nowMs) { return (int32_t)(nowMs - j.dueMs) >= 0; }
+    int pickNext(uint32_t nowMs, bool audioBacklog, const bool *done);
+
+    JobClockUs clockUs_;
+    Job jobs_[JOB_SCHEDULER_MAX_JOBS];
+    size_t count_ = 0;
+    uint32_t iterationBudgetUs_ = 2000;
+    uint32_t iterationsOverBudget_ = 0;
+};
@@ -0,0 +1,84 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+// Rolling latency histogram (ESP32 RTSP Mic for BirdNET-Go)
+//
+// Log-linear buckets: 4 sub-buckets per power of two, so any reported percentile is within
+// ~25% of the true value from 1 us up to several seconds, in 176 bytes per window.
+// Two windows are kept; percentiles cover the current and the previous window, so the
+// figures always describe the last 1..2 window lengths.
+//
+// Plain C++, no Arduino types, so it can be checked on a host.
+
+struct LatencyHistogram {
+    static const uint8_t SUB_BITS = 2;
+    static const uint8_t BUCKETS = 88;   // top bucket starts at ~7.3 s
+
+    uint16_t counts[2][BUCKETS];
+    uint32_t maxUs[2];
+    uint8_t cur;
+
+    void clear() {
+        memset(this, 0, sizeof(*this));
+    }
+
+    static uint8_t bucketOf(uint32_t us) {
+        if (us < (1u << SUB_BITS)) return (uint8_t)us;
+        uint8_t e = (uint8_t)(31 - __builtin_clz(us));
+        uint32_t idx = ((uint32_t)(e - SUB_BITS + 1) << SUB_BITS) | ((us >> (e - SUB_BITS)) & ((1u << SUB_BITS) - 1));
+        return idx < BUCKETS ? (uint8_t)idx : (uint8_t)(BUCKETS - 1);
+    }
+
+    // Largest value that falls into bucket idx.
+    static uint32_t bucketUpper(uint8_t idx) {
+        if (idx < (1u << SUB_BITS)) return idx;
+        uint8_t e = (uint8_t)((idx >> SUB_BITS) + SUB_BITS - 1);
+        uint32_t sub = idx & ((1u << SUB_BITS) - 1);
+        return ((((1u << SUB_BITS) + sub + 1) << (e - SUB_BITS)) - 1);
+    }
+
+    void record(uint32_t us) {
+        uint16_t &c = counts[cur][bucketOf(us)];
+        if (c != 0xFFFF) c++;
+        if (us > maxUs[cur]) maxUs[cur] = us;
+    }
+
+    // Starts a new window; the oldest one is dropped.
+    void rotate() {
+        cur ^= 1;
+        memset(counts[cur], 0, sizeof(counts[cur]));
+        maxUs[cur] = 0;
+    }
+
+    uint32_t total() const {
+        uint32_t n = 0;
+        for (uint8_t w = 0; w < 2; w++) {
+            for (uint8_t i = 0; i < BUCKETS; i++) n += counts[w][i];
+        }
+        return n;
+    }
+
+    uint32_t max() const {
+        return maxUs[0] > maxUs[1] ? maxUs[0] : maxUs[1];
+    }
+
+    // Upper bound of the bucket holding the p-th percentile (p in 0..100), capped at max().
+    uint32_t percentile(float p) const {
+        uint32_t n = total();
+        if (n == 0) return 0;
+        uint32_t rank = (uint32_t)((p / 100.0f) * (float)n + 0.999f);
+        if (rank < 1) rank = 1;
+        if (rank > n) rank = n;
+        uint32_t seen = 0;
+        for (uint8_t i = 0; i < BUCKETS; i++) {
+            seen += (uint32_t)counts[0][i] + counts[1][i];
+            if (seen >= rank) {
+                uint32_t upper = bucketUpper(i);
+                uint32_t m = max();
+                return upper < m ? upper : m;
+            }
+        }
+        return max();
+    }
+};
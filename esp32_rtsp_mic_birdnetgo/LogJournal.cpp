@@ -0,0 +1,366 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include "LogJournal.h"
+#include "HeapMonitor.h"
+
+// Persistent log journal (ESP32 RTSP Mic for BirdNET-Go) – see LogJournal.h for the format.
+
+static const char* JOURNAL_DIR = "/log";
+static const char* JOURNAL_TMP = "/log/j.tmp";
+static const uint32_t JOURNAL_TASK_STACK = 4096;
+static const UBaseType_t JOURNAL_TASK_PRIO = 1;   // same as loopTask; it sleeps until notified
+
+// RAM batch: appenders fill jBuf[jActive]; a full (or timed-out) buffer becomes jPending
+// and is written by the journal task while the other buffer keeps collecting lines.
+static uint8_t jBuf[2][LOGJOURNAL_PAYLOAD_MAX];
+static size_t jFill[2] = {0, 0};
+static int jActive = 0;
+static int jPending = -1;
+static portMUX_TYPE jMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Flash state (guarded by jFsMutex)
+static SemaphoreHandle_t jFsMutex = nullptr;
+static TaskHandle_t jTask = nullptr;
+static bool jMounted = false;
+static uint32_t jNextSeq = 1;
+static int jSegIdx = 0;                               // segment being appended
+static uint32_t jSegSize = 0;                         // file bytes in that segment
+static uint32_t jSegText[LOGJOURNAL_SEGMENTS];        // payload bytes per segment
+static uint32_t jSegGen[LOGJOURNAL_SEGMENTS];         // bumped when a segment is recycled
+static unsigned long jLastFlushMs = 0;
+static LogJournalStats jStats = {};
+
+static void segPath(int idx, char *out, size_t cap) {
+    snprintf(out, cap, "%s/j%d.bin", JOURNAL_DIR, idx);
+}
+
+// Walks the blocks of one segment, verifying each CRC without loading whole blocks.
+// Returns the size of the valid prefix.
+static uint32_t scanSegment(int idx, uint32_t *textBytes, uint32_t *firstSeq, uint32_t *lastSeq,
+                            uint32_t *fileSize) {
+    char path[24];
+    segPath(idx, path, sizeof(path));
+    *textBytes = 0; *firstSeq = 0; *lastSeq = 0; *fileSize = 0;
+    File f = LittleFS.open(path, "r");
+    if (!f) return 0;
+    *fileSize = (uint32_t)f.size();
+    uint32_t off = 0;
+    uint8_t chunk[256];
+    while (true) {
+        LogJournalBlockHeader h;
+        if (f.read(reinterpret_cast<uint8_t*>(&h), sizeof(h)) != sizeof(h)) break;
+        if (!logjournal_headerPlausible(h) || (*lastSeq != 0 && h.seq <= *lastSeq)) break;
+        uint32_t crc = logjournal_crc32(0, &h.seq, sizeof(h.seq));
+        crc = logjournal_crc32(crc, &h.len, sizeof(h.len));
+        size_t left = h.len;
+        while (left > 0) {
+            size_t n = left < sizeof(chunk) ? left : sizeof(chunk);
+            if (f.read(chunk, n) != n) break;
+            crc = logjournal_crc32(crc, chunk, n);
+            left -= n;
+        }
+        if (left != 0 || crc != h.crc) break;
+        if (*firstSeq == 0) *firstSeq = h.seq;
+        *lastSeq = h.seq;
+        *textBytes += h.len;
+        off += sizeof(h) + h.len;
+    }
+    f.close();
+    return off;
+}
+
+// LittleFS has no truncate() in the Arduino FS API: copy the valid prefix and swap files.
+static bool truncateSegment(int idx, uint32_t validSize) {
+    char path[24];
+    segPath(idx, path, sizeof(path));
+    File src = LittleFS.open(path, "r");
+    File dst = LittleFS.open(JOURNAL_TMP, "w");
+    if (!src || !dst) return false;
+    uint8_t chunk[256];
+    uint32_t left = validSize;
+    while (left > 0) {
+        size_t n = left < sizeof(chunk) ? left : sizeof(chunk);
+        if (src.read(chunk, n) != n || dst.write(chunk, n) != n) break;
+        left -= n;
+    }
+    src.close();
+    dst.close();
+    if (left != 0) {
+        LittleFS.remove(JOURNAL_TMP);
+        return false;
+    }
+    LittleFS.remove(path);
+    return LittleFS.rename(JOURNAL_TMP, path);
+}
+
+static void recycleSegmentLocked(int idx) {
+    char path[24];
+    segPath(idx, path, sizeof(path));
+    LittleFS.remove(path);
+    jSegText[idx] = 0;
+    jSegGen[idx]++;
+}
+
+static void writeBlockLocked(const uint8_t *payload, size_t len) {
+    if (len == 0) return;
+    if (jSegSize + sizeof(LogJournalBlockHeader) + len > LOGJOURNAL_SEGMENT_BYTES) {
+        jSegIdx = (jSegIdx + 1) % LOGJOURNAL_SEGMENTS;
+        recycleSegmentLocked(jSegIdx);
+        jSegSize = 0;
+    }
+    LogJournalBlockHeader h;
+    logjournal_makeHeader(h, jNextSeq, payload, (uint16_t)len);
+    char path[24];
+    segPath(jSegIdx, path, sizeof(path));
+    File f = LittleFS.open(path, "a");
+    bool ok = f && f.write(reinterpret_cast<const uint8_t*>(&h), sizeof(h)) == sizeof(h) &&
+              f.write(payload, len) == len;
+    if (f) f.close();
+    if (!ok) {
+        // Whatever reached flash would sit in front of every later block and make the boot scan
+        // stop there: cut the segment back to its last good block, or leave it behind.
+        jStats.writeErrors++;
+        if (!truncateSegment(jSegIdx, jSegSize)) jSegSize = LOGJOURNAL_SEGMENT_BYTES;
+        return;
+    }
+    jNextSeq++;
+    jSegSize += sizeof(h) + len;
+    jSegText[jSegIdx] += len;
+    jStats.blocksWritten++;
+    jStats.bytesWritten += sizeof(h) + len;
+}
+
+static void writePendingLocked() {
+    portENTER_CRITICAL(&jMux);
+    int idx = jPending;
+    portEXIT_CRITICAL(&jMux);
+    if (idx < 0) return;
+    // Appenders never touch the pending buffer, so it can be written outside the spinlock.
+    writeBlockLocked(jBuf[idx], jFill[idx]);
+    portENTER_CRITICAL(&jMux);
+    jFill[idx] = 0;
+    jPending = -1;
+    portEXIT_CRITICAL(&jMux);
+}
+
+// Moves the active buffer to pending if it has data and the writer is idle.
+static bool swapActiveToPending() {
+    bool swapped = false;
+    portENTER_CRITICAL(&jMux);
+    if (jPending < 0 && jFill[jActive] > 0) {
+        jPending = jActive;
+        jActive ^= 1;
+        swapped = true;
+    }
+    portEXIT_CRITICAL(&jMux);
+    return swapped;
+}
+
+static void journalTask(void *) {
+    heapmon_tagCurrentTask(HEAP_SYS_LOG);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (xSemaphoreTake(jFsMutex, portMAX_DELAY) == pdTRUE) {
+            writePendingLocked();
+            xSemaphoreGive(jFsMutex);
+        }
+    }
+}
+
+bool logjournal_begin() {
+    if (jMounted) return true;
+    if (!LittleFS.begin(true)) return false;
+    if (!LittleFS.exists(JOURNAL_DIR)) LittleFS.mkdir(JOURNAL_DIR);
+    LittleFS.remove(JOURNAL_TMP);
+
+    // The newest segment is the one holding the highest block sequence number.
+    uint32_t bestSeq = 0;
+    bool tornUnfixed = false;
+    for (int i = 0; i < LOGJOURNAL_SEGMENTS; i++) {
+        uint32_t text, first, last, fileSize;
+        uint32_t valid = scanSegment(i, &text, &first, &last, &fileSize);
+        jSegText[i] = text;
+        jSegGen[i] = 0;
+        bool torn = fileSize > valid;
+        if (torn) {
+            // Torn tail from a reset mid-write: keep the valid prefix, drop the rest.
+            if (truncateSegment(i, valid)) {
+                jStats.tornRecovered++;
+                torn = false;
+            }
+        }
+        if (last > bestSeq || (bestSeq == 0 && i == 0)) {
+            bestSeq = last;
+            jSegIdx = i;
+            jSegSize = valid;
+            tornUnfixed = torn;
+        }
+    }
+    jNextSeq = bestSeq + 1;
+    // Never append behind garbage we could not cut off; start a fresh segment instead.
+    if (tornUnfixed) jSegSize = LOGJOURNAL_SEGMENT_BYTES;
+
+    jFsMutex = xSemaphoreCreateMutex();
+    if (!jFsMutex) return false;
+    if (xTaskCreate(journalTask, "logjournal", JOURNAL_TASK_STACK, nullptr, JOURNAL_TASK_PRIO, &jTask) != pdPASS) {
+        return false;
+    }
+    jMounted = true;
+    jLastFlushMs = millis();
+    // Lines queued before mount may already fill a batch.
+    xTaskNotifyGive(jTask);
+    return true;
+}
+
+void logjournal_append(const char *prefix, size_t prefixLen, const char *text, size_t textLen) {
+    if (prefixLen > LOGJOURNAL_PAYLOAD_MAX - 1) prefixLen = LOGJOURNAL_PAYLOAD_MAX - 1;
+    if (textLen > LOGJOURNAL_PAYLOAD_MAX - 1 - prefixLen) textLen = LOGJOURNAL_PAYLOAD_MAX - 1 - prefixLen;
+    const size_t need = prefixLen + textLen + 1;
+    bool kick = false;
+
+    portENTER_CRITICAL(&jMux);
+    if (jFill[jActive] + need > LOGJOURNAL_PAYLOAD_MAX) {
+        if (jPending >= 0) {
+            // Writer still busy with the other page: drop rather than block the caller.
+            jStats.linesDropped++;
+            portEXIT_CRITICAL(&jMux);
+            return;
+        }
+        jPending = jActive;
+        jActive ^= 1;
+        kick = true;
+    }
+    uint8_t *dst = jBuf[jActive] + jFill[jActive];
+    if (prefixLen) memcpy(dst, prefix, prefixLen);
+    if (textLen) memcpy(dst + prefixLen, text, textLen);
+    dst[prefixLen + textLen] = '\n';
+    jFill[jActive] += need;
+    portEXIT_CRITICAL(&jMux);
+
+    if (kick && jTask) xTaskNotifyGive(jTask);
+}
+
+void logjournal_tick() {
+    if (!jMounted) return;
+    unsigned long now = millis();
+    if (now - jLastFlushMs < LOGJOURNAL_FLUSH_INTERVAL_MS) return;
+    jLastFlushMs = now;
+    if (swapActiveToPending()) xTaskNotifyGive(jTask);
+}
+
+bool logjournal_flush(uint32_t timeoutMs) {
+    if (!jMounted) return false;
+    if (xSemaphoreTake(jFsMutex, pdMS_TO_TICKS(timeoutMs)) != pdTRUE) return false;
+    writePendingLocked();
+    if (swapActiveToPending()) writePendingLocked();
+    xSemaphoreGive(jFsMutex);
+    jLastFlushMs = millis();
+    return true;
+}
+
+void logjournal_getStats(LogJournalStats &out) {
+    portENTER_CRITICAL(&jMux);
+    out = jStats;
+    out.bufferedBytes = (uint32_t)(jFill[0] + jFill[1]);
+    portEXIT_CRITICAL(&jMux);
+    out.mounted = jMounted;
+    out.textBytes = (uint32_t)logjournal_textSize();
+}
+
+size_t logjournal_textSize() {
+    if (!jMounted) return 0;
+    size_t total = 0;
+    if (xSemaphoreTake(jFsMutex, portMAX_DELAY) != pdTRUE) return 0;
+    for (int i = 0; i < LOGJOURNAL_SEGMENTS; i++) total += jSegText[i];
+    xSemaphoreGive(jFsMutex);
+    return total;
+}
+
+bool logjournal_snapshot(LogJournalSnapshot &out) {
+    memset(&out, 0, sizeof(out));
+    if (!jMounted) return false;
+    if (xSemaphoreTake(jFsMutex, portMAX_DELAY) != pdTRUE) return false;
+    out.newest = jSegIdx;
+    memcpy(out.segText, jSegText, sizeof(out.segText));
+    memcpy(out.segGen, jSegGen, sizeof(out.segGen));
+    xSemaphoreGive(jFsMutex);
+    for (int i = 0; i < LOGJOURNAL_SEGMENTS; i++) out.textBytes += out.segText[i];
+    return true;
+}
+
+size_t logjournal_read(size_t offset, size_t len, LogJournalSink sink, void *ctx) {
+    LogJournalSnapshot snap;
+    if (!logjournal_snapshot(snap)) return 0;
+    return logjournal_readSnapshot(snap, offset, len, sink, ctx);
+}
+
+size_t logjournal_readSnapshot(const LogJournalSnapshot &snap, size_t offset, size_t len, LogJournalSink sink,
+                               void *ctx) {
+    if (!jMounted || len == 0) return 0;
+    if (offset >= snap.textBytes) return 0;
+    if (len > snap.textBytes - offset) len = snap.textBytes - offset;
+    uint8_t chunk[512];
+    char path[24];
+    size_t delivered = 0;
+    size_t pos = 0;  // text position of the current block
+
+    // Oldest segment first: the one after the segment being appended.
+    const int newest = snap.newest;
+    const uint32_t *segText = snap.segText;
+    const uint32_t *segGen = snap.segGen;
+
+    for (int k = 1; k <= LOGJOURNAL_SEGMENTS && delivered < len; k++) {
+        const int idx = (newest + k) % LOGJOURNAL_SEGMENTS;
+        const size_t segStart = pos;
+        if (pos + segText[idx] <= offset) {
+            pos += segText[idx];
+            continue;
+        }
+        segPath(idx, path, sizeof(path));
+        uint32_t fileOff = 0;
+        // The mutex is held only around each file access so the writer is never stalled by
+        // a slow HTTP client.
+        while (delivered < len) {
+            if (xSemaphoreTake(jFsMutex, portMAX_DELAY) != pdTRUE) return delivered;
+            if (jSegGen[idx] != segGen[idx]) {  // recycled underneath us
+                xSemaphoreGive(jFsMutex);
+                return delivered;
+            }
+            File f = LittleFS.open(path, "r");
+            LogJournalBlockHeader h;
+            bool ok = f && f.seek(fileOff) &&
+                      f.read(reinterpret_cast<uint8_t*>(&h), sizeof(h)) == sizeof(h) &&
+                      logjournal_headerPlausible(h);
+            size_t n = 0;
+            size_t start = 0;
+            bool skip = false;
+            if (ok) {
+                const size_t want = offset + delivered;
+                if (pos + h.len <= want) {
+                    skip = true;
+                } else {
+                    start = want > pos ? want - pos : 0;
+                    n = h.len - start;
+                    if (n > sizeof(chunk)) n = sizeof(chunk);
+                    if (n > len - delivered) n = len - delivered;
+                    ok = f.seek(fileOff + sizeof(h) + start) && f.read(chunk, n) == n;
+                }
+            }
+            if (f) f.close();
+            xSemaphoreGive(jFsMutex);
+            if (!ok) break;  // end of segment
+            if (!skip) {
+                if (!sink(chunk, n, ctx)) return delivered;
+                delivered += n;
+                if (start + n < h.len) continue;
+            }
+            fileOff += sizeof(h) + h.len;
+            pos += h.len;
+        }
+        pos = segStart + segText[idx];
+    }
+    return delivered;
+}
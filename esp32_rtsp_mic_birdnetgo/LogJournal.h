@@ -0,0 +1,131 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Persistent log journal (ESP32 RTSP Mic for BirdNET-Go)
+//
+// Log lines are batched in RAM (double-buffered page) and written by a low-priority task
+// as one block per page, so flash I/O never happens on the audio path. Blocks are appended
+// to a small set of rotating segment files on LittleFS; the oldest segment is recycled
+// when the newest one is full.
+//
+// On-flash format (plain C++, no Arduino types, so it can be checked on a host):
+//   segment  = block*
+//   block    = LogJournalBlockHeader + payload[len]   (payload: '\n'-terminated text lines)
+//   crc      = CRC-32 over header.seq, header.len and the payload
+// A block that does not validate ends the segment (torn write after a reset); the tail is
+// cut off on the next boot.
+
+#ifndef LOGJOURNAL_BLOCK_BYTES
+#define LOGJOURNAL_BLOCK_BYTES 4096        // one flash page per write
+#endif
+#ifndef LOGJOURNAL_SEGMENT_BYTES
+#define LOGJOURNAL_SEGMENT_BYTES (32 * 1024)
+#endif
+#ifndef LOGJOURNAL_SEGMENTS
+#define LOGJOURNAL_SEGMENTS 4
+#endif
+#ifndef LOGJOURNAL_FLUSH_INTERVAL_MS
+#define LOGJOURNAL_FLUSH_INTERVAL_MS 60000UL
+#endif
+
+static const uint32_t LOGJOURNAL_MAGIC = 0x4A4C4D45u;  // "EMLJ"
+
+struct LogJournalBlockHeader {
+    uint32_t magic;
+    uint32_t seq;       // monotonically increasing across segments
+    uint16_t len;       // payload bytes
+    uint16_t reserved;  // 0
+    uint32_t crc;
+};
+static_assert(sizeof(LogJournalBlockHeader) == 16, "journal header must stay 16 bytes");
+
+static const size_t LOGJOURNAL_PAYLOAD_MAX = LOGJOURNAL_BLOCK_BYTES - sizeof(LogJournalBlockHeader);
+
+inline uint32_t logjournal_crc32(uint32_t crc, const void *data, size_t len) {
+    const uint8_t *p = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+    while (len--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+
+inline uint32_t logjournal_blockCrc(const LogJournalBlockHeader &h, const void *payload) {
+    uint32_t crc = logjournal_crc32(0, &h.seq, sizeof(h.seq));
+    crc = logjournal_crc32(crc, &h.len, sizeof(h.len));
+    return logjournal_crc32(crc, payload, h.len);
+}
+
+inline void logjournal_makeHeader(LogJournalBlockHeader &h, uint32_t seq, const void *payload, uint16_t len) {
+    h.magic = LOGJOURNAL_MAGIC;
+    h.seq = seq;
+    h.len = len;
+    h.reserved = 0;
+    h.crc = logjournal_blockCrc(h, payload);
+}
+
+// Header-only plausibility check (before the payload is read).
+inline bool logjournal_headerPlausible(const LogJournalBlockHeader &h) {
+    return h.magic == LOGJOURNAL_MAGIC && h.len > 0 && h.len <= LOGJOURNAL_PAYLOAD_MAX && h.reserved == 0;
+}
+
+// Returns the size of the valid block prefix of an in-memory segment image and the last
+// valid block sequence number (0 if none).
+inline size_t logjournal_validPrefix(const uint8_t *data, size_t size, uint32_t *lastSeq) {
+    size_t off = 0;
+    uint32_t seq = 0;
+    while (size - off >= sizeof(LogJournalBlockHeader)) {
+        LogJournalBlockHeader h;
+        memcpy(&h, data + off, sizeof(h));
+        if (!logjournal_headerPlausible(h) || size - off - sizeof(h) < h.len) break;
+        if (seq != 0 && h.seq <= seq) break;
+        if (logjournal_blockCrc(h, data + off + sizeof(h)) != h.crc) break;
+        seq = h.seq;
+        off += sizeof(h) + h.len;
+    }
+    if (lastSeq) *lastSeq = seq;
+    return off;
+}
+
+struct LogJournalStats {
+    bool mounted;
+    uint32_t blocksWritten;
+    uint32_t bytesWritten;
+    uint32_t linesDropped;      // RAM batch full while the writer was busy
+    uint32_t writeErrors;
+    uint32_t tornRecovered;     // torn tails cut off at boot
+    uint32_t bufferedBytes;     // not yet on flash
+    uint32_t textBytes;         // readable bytes on flash
+};
+
+// Mount LittleFS, recover the newest segment and start the writer task.
+bool logjournal_begin();
+// Queue a log line (prefix + text + '\n'). Safe before logjournal_begin(); never blocks.
+void logjournal_append(const char *prefix, size_t prefixLen, const char *text, size_t textLen);
+// Periodic flush trigger (call from loop()).
+void logjournal_tick();
+// Synchronously write everything buffered; used right before a reset or deep sleep.
+bool logjournal_flush(uint32_t timeoutMs);
+void logjournal_getStats(LogJournalStats &out);
+
+// Reading back: the journal is exposed as one text stream, oldest line first.
+typedef bool (*LogJournalSink)(const uint8_t *data, size_t len, void *ctx);
+size_t logjournal_textSize();
+// Streams [offset, offset + len) to sink; returns bytes delivered.
+size_t logjournal_read(size_t offset, size_t len, LogJournalSink sink, void *ctx);
+
+// The segment set taken once, for a reader that announces a length before it reads (HTTP
+// Content-Length): a read with it delivers textBytes unless the writer recycles one of its
+// segments in the meantime, in which case it comes up short.
+struct LogJournalSnapshot {
+    int newest;
+    uint32_t segText[LOGJOURNAL_SEGMENTS];
+    uint32_t segGen[LOGJOURNAL_SEGMENTS];
+    size_t textBytes;
+};
+bool logjournal_snapshot(LogJournalSnapshot &out);
+size_t logjournal_readSnapshot(const LogJournalSnapshot &snap, size_t offset, size_t len, LogJournalSink sink,
+                               void *ctx);
@@ -0,0 +1,53 @@
+#include "LoopProfiler.h"
+
+static const char *const PROF_SECTION_NAMES[PROF_SECTION_COUNT] = {
+    "loop",
+    "ota",
+    "webui",
+    "temperature",
+    "heap",
+    "performance",
+    "wifi_health",
+    "time_sync",
+    "schedule",
+    "scheduled_reset",
+    "mqtt",
+    "log_journal",
+    "stream_watchdog",
+    "power",
+    "task_stats",
+    "nvs_save",
+    "rtsp",
+    "stream",
+    "wifi_reconnect",
+};
+
+const char *profiler_sectionName(uint8_t section) {
+    return section < PROF_SECTION_COUNT ? PROF_SECTION_NAMES[section] : "";
+}
+
+#if LOOP_PROFILER_ENABLED
+
+ProfilerStats profilerStats[PROF_SECTION_COUNT];
+void profiler_begin() {
+    profiler_reset();
+}
+
+void profiler_reset() {
+    memset(profilerStats, 0, sizeof(profilerStats));
+}
+
+void profiler_takeWindow(uint32_t &loopMaxUs, uint8_t &worstSection, uint32_t &worstUs) {
+    loopMaxUs = profilerStats[PROF_LOOP].windowMaxUs;
+    worstSection = PROF_SECTION_COUNT;
+    worstUs = 0;
+    for (uint8_t i = 0; i < PROF_SECTION_COUNT; i++) {
+        if (i != PROF_LOOP && profilerStats[i].windowMaxUs > worstUs) {
+            worstUs = profilerStats[i].windowMaxUs;
+            worstSection = i;
+        }
+        profilerStats[i].windowMaxUs = 0;
+    }
+}
+
+#endif
@@ -0,0 +1,108 @@
+#pragma once
+#include <Arduino.h>
+
+// Loop latency profiler (ESP32 RTSP Mic for BirdNET-Go)
+//
+// Every subsystem call in loop() is wrapped in a PROFILE_SECTION() scope that reads micros()
+// on entry and exit. Not the cycle counter: the power manager changes the CPU clock at run
+// time (software DFS, or the PM framework between loop iterations), so a cycle count cannot
+// be turned back into time with one fixed MHz figure. Per section we keep a log2 histogram
+// of the duration in microseconds, the all-time max with the millis() when it happened, and
+// a "window" max that the MQTT publisher takes and resets. Recording runs in loop() only (the
+// web handlers that read the stats run there too), so no locking is needed.
+//
+// Build with -DLOOP_PROFILER_ENABLED=0 to compile the scopes out completely.
+
+#ifndef LOOP_PROFILER_ENABLED
+#define LOOP_PROFILER_ENABLED 1
+#endif
+
+enum ProfilerSection : uint8_t {
+    PROF_LOOP,            // whole loop() iteration
+    PROF_OTA,
+    PROF_WEBUI,
+    PROF_TEMPERATURE,
+    PROF_HEAP,
+    PROF_PERFORMANCE,
+    PROF_WIFI_HEALTH,
+    PROF_TIME_SYNC,
+    PROF_SCHEDULE,
+    PROF_SCHEDULED_RESET,
+    PROF_MQTT,
+    PROF_LOG_JOURNAL,
+    PROF_STREAM_WATCHDOG,
+    PROF_POWER,
+    PROF_TASK_STATS,
+    PROF_NVS_SAVE,
+    PROF_RTSP,            // client accept/timeout + processRTSP()
+    PROF_STREAM,          // streamAudio()
+    PROF_WIFI_RECONNECT,  // deferred Wi-Fi reconnect (blocking by design)
+    PROF_SECTION_COUNT
+};
+
+static const uint8_t PROF_BUCKETS = 20;   // bucket b: [2^b, 2^(b+1)) us, last bucket open-ended
+
+struct ProfilerStats {
+    uint32_t count;
+    uint64_t totalUs;
+    uint32_t maxUs;
+    uint32_t maxAtMs;       // millis() of the max
+    uint32_t windowMaxUs;   // since profiler_takeWindow()
+    uint32_t hist[PROF_BUCKETS];
+};
+
+const char *profiler_sectionName(uint8_t section);
+
+#if LOOP_PROFILER_ENABLED
+
+extern ProfilerStats profilerStats[PROF_SECTION_COUNT];
+
+void profiler_begin();
+void profiler_reset();
+
+inline uint8_t profiler_bucket(uint32_t us) {
+    uint8_t b = (uint8_t)(31 - __builtin_clz(us | 1u));
+    return b < PROF_BUCKETS ? b : (uint8_t)(PROF_BUCKETS - 1);
+}
+
+inline void profiler_record(uint8_t section, uint32_t us) {
+    ProfilerStats &s = profilerStats[section];
+    s.count++;
+    s.totalUs += us;
+    s.hist[profiler_bucket(us)]++;
+    if (us > s.windowMaxUs) s.windowMaxUs = us;
+    if (us > s.maxUs) {
+        s.maxUs = us;
+        s.maxAtMs = millis();
+    }
+}
+
+class ProfilerScope {
+public:
+    explicit ProfilerScope(uint8_t section) : section_(section), start_(micros()) {}
+    ~ProfilerScope() { profiler_record(section_, micros() - start_); }
+
+private:
+    uint8_t section_;
+    uint32_t start_;
+};
+
+#define PROFILE_CAT2(a, b) a##b
+#define PROFILE_CAT(a, b) PROFILE_CAT2(a, b)
+#define PROFILE_SECTION(section) ProfilerScope PROFILE_CAT(profScope_, __LINE__)(section)
+
+// Window max of the whole loop and of the worst subsystem, then starts a new window.
+void profiler_takeWindow(uint32_t &loopMaxUs, uint8_t &worstSection, uint32_t &worstUs);
+
+#else
+
+inline void profiler_begin() {}
+inline void profiler_reset() {}
+inline void profiler_takeWindow(uint32_t &loopMaxUs, uint8_t &worstSection, uint32_t &worstUs) {
+    loopMaxUs = 0;
+    worstSection = PROF_SECTION_COUNT;
+    worstUs = 0;
+}
+#define PROFILE_SECTION(section) do {} while (0)
+
+#endif
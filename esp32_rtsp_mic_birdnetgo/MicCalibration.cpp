@@ -0,0 +1,173 @@
+#include "MicCalibration.h"
+#include <math.h>
+#include <string.h>
+
+MicCalStatus micCalStatus = {};
+
+static const char *const MICCAL_STATE_NAMES[] = {"idle", "running", "done", "failed"};
+static const char *const MICCAL_BOOT_NAMES[MICCAL_BOOT_MODE_COUNT] = {"off", "propose", "apply"};
+
+static const float FS24 = 8388608.0f;
+
+// Accumulators
+static uint32_t calSettleLeft = 0;
+static int64_t calSum = 0;
+static int32_t calMin = 0;
+static int32_t calMax = 0;
+static uint32_t calWindowLen = 960;
+static uint32_t calWindowN = 0;
+static int64_t calWindowSum = 0;
+static uint64_t calWindowSq = 0;
+static uint32_t calWindows = 0;
+static uint16_t calHist[CAL_HIST_BINS];
+
+const char *miccal_stateName(uint8_t state) {
+    return state <= MICCAL_FAILED ? MICCAL_STATE_NAMES[state] : "unknown";
+}
+
+const char *miccal_bootModeName(uint8_t mode) {
+    return mode < MICCAL_BOOT_MODE_COUNT ? MICCAL_BOOT_NAMES[mode] : "unknown";
+}
+
+bool miccal_bootModeFromName(const String &name, MicCalBootMode &out) {
+    for (uint8_t i = 0; i < MICCAL_BOOT_MODE_COUNT; i++) {
+        if (name == MICCAL_BOOT_NAMES[i]) {
+            out = (MicCalBootMode)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static float dbfs(float v, float fullScale) {
+    return v > 0.0f ? 20.0f * log10f(v / fullScale) : -144.0f;
+}
+
+void miccal_begin(uint32_t sampleRate, uint16_t seconds, uint8_t marginDb, bool acPeak, bool apply,
+                  bool boot, uint8_t curShift, float curGain, uint32_t nowMs) {
+    MicCalStatus &c = micCalStatus;
+    uint32_t runs = c.runs;
+    memset(&c, 0, sizeof(c));
+    c.runs = runs + 1;
+    c.state = MICCAL_RUNNING;
+    c.apply = apply;
+    c.boot = boot;
+    c.acPeak = acPeak;
+    c.marginDb = marginDb;
+    c.seconds = seconds;
+    c.sampleRate = sampleRate;
+    c.startedMs = nowMs;
+    c.samplesWanted = sampleRate * seconds;
+    c.prevShift = curShift;
+    c.prevGain = curGain;
+
+    calSettleLeft = (uint32_t)((uint64_t)sampleRate * CAL_SETTLE_MS / 1000);
+    calSum = 0;
+    calMin = INT32_MAX;
+    calMax = INT32_MIN;
+    calWindowLen = sampleRate * CAL_WINDOW_MS / 1000;
+    if (calWindowLen < 16) calWindowLen = 16;
+    calWindowN = 0;
+    calWindowSum = 0;
+    calWindowSq = 0;
+    calWindows = 0;
+    memset(calHist, 0, sizeof(calHist));
+}
+
+static void closeWindow() {
+    double n = calWindowN;
+    double mean = (double)calWindowSum / n;
+    double var = (double)calWindowSq / n - mean * mean;
+    float rms = var > 0.0 ? (float)sqrt(var) : 0.0f;
+    int bin = (int)(-dbfs(rms, FS24));
+    if (bin < 0) bin = 0;
+    if (bin >= CAL_HIST_BINS) bin = CAL_HIST_BINS - 1;
+    if (calHist[bin] < 0xFFFF) calHist[bin]++;
+    calWindows++;
+    calWindowN = 0;
+    calWindowSum = 0;
+    calWindowSq = 0;
+}
+
+bool miccal_feed(const int32_t *raw, int samples) {
+    MicCalStatus &c = micCalStatus;
+    if (c.state != MICCAL_RUNNING) return false;
+    int i = 0;
+    if (calSettleLeft) {
+        int skip = (uint32_t)samples < calSettleLeft ? samples : (int)calSettleLeft;
+        calSettleLeft -= skip;
+        i = skip;
+    }
+    for (; i < samples && c.samples < c.samplesWanted; i++) {
+        int32_t x = raw[i] >> 8;             // 24-bit sample
+        calSum += x;
+        if (x < calMin) calMin = x;
+        if (x > calMax) calMax = x;
+        calWindowSum += x;
+        calWindowSq += (uint64_t)((int64_t)x * x);
+        if (++calWindowN >= calWindowLen) closeWindow();
+        c.samples++;
+    }
+    return c.samples >= c.samplesWanted;
+}
+
+void miccal_finish(uint32_t nowMs) {
+    MicCalStatus &c = micCalStatus;
+    if (c.state != MICCAL_RUNNING) return;
+    c.finishedMs = nowMs;
+    if (c.samples == 0 || calWindows == 0) {
+        c.state = MICCAL_FAILED;
+        c.error = "no_samples";
+        return;
+    }
+    float dc = (float)((double)calSum / c.samples);
+    float absPeak = fmaxf(fabsf((float)calMin), fabsf((float)calMax));
+    float acPeak = fmaxf((float)calMax - dc, dc - (float)calMin);
+    c.dcOffset = dc;
+    c.dcDbfs = dbfs(fabsf(dc), FS24);
+    c.peakDbfs = dbfs(absPeak, FS24);
+    c.acPeakDbfs = dbfs(acPeak, FS24);
+    if (calMax == calMin) {
+        c.state = MICCAL_FAILED;
+        c.error = calMax == 0 ? "no_signal" : "stuck_signal";
+        return;
+    }
+
+    // Noise floor: 10th percentile of the window levels
+    uint32_t need = calWindows / 10 + 1, seen = 0;
+    int bin = CAL_HIST_BINS - 1;
+    while (bin > 0) {
+        seen += calHist[bin];
+        if (seen >= need) break;
+        bin--;
+    }
+    c.noiseDbfs = -(float)bin - 0.5f;
+
+    // Shift and gain: peak (in 32-bit word units) to `margin` dB under 16-bit full scale
+    float peak = c.acPeak ? acPeak : absPeak;
+    c.dynamicRangeDb = dbfs(peak, FS24) - c.noiseDbfs;
+    float peak32 = peak * 256.0f;
+    float target = 32767.0f * powf(10.0f, -(float)c.marginDb / 20.0f);
+    uint8_t shift = 0;
+    while (shift < 24 && peak32 / (float)(1UL << shift) > target) shift++;
+    float gain = target * (float)(1UL << shift) / peak32;
+    if (gain > 100.0f) gain = 100.0f;
+    gain = floorf(gain * 100.0f) / 100.0f;
+    if (gain < 0.1f) gain = 0.1f;
+    c.shift = shift;
+    c.gain = gain;
+    float scale = 256.0f * gain / (float)(1UL << shift);   // 24-bit sample -> 16-bit output
+    c.peakOutDbfs = dbfs(peak * scale, 32767.0f);
+    float noiseOutLsb = FS24 * powf(10.0f, c.noiseDbfs / 20.0f) * scale;
+    c.noiseOutDbfs = dbfs(noiseOutLsb, 32767.0f);
+    c.noiseBelowLsb = noiseOutLsb < 1.0f;
+    c.state = MICCAL_DONE;
+}
+
+void miccal_abort(const char *error, uint32_t nowMs) {
+    MicCalStatus &c = micCalStatus;
+    if (c.state != MICCAL_RUNNING) return;
+    c.state = MICCAL_FAILED;
+    c.error = error;
+    c.finishedMs = nowMs;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <Arduino.h>
+
+// Microphone level calibration (ESP32 RTSP Mic for BirdNET-Go)
+//
+// Analyses a few seconds of raw I2S words (24-bit left-justified in 32 bits) and proposes the
+// i2sShiftBits and gain that put the measured peak `margin` dB under 16-bit full scale: the
+// smallest shift that fits, then a gain of 1..2 for the remaining fraction of a bit.
+// Measured: DC offset, peak (absolute and around the DC; the latter counts when the high-pass
+// is on, since it removes the offset before the 16-bit clamp) and the noise floor, the 10th
+// percentile of 20 ms window RMS levels. The proposal reports where peak and noise floor land
+// in the 16-bit output; a noise floor under 1 LSB means the margin is costing resolution.
+//
+// Samples come from the streaming path while a stream runs, otherwise from i2s_read() in
+// loop(); the first CAL_SETTLE_MS are skipped (microphone start-up, DC settling).
+// Runs on /api/action/calibrate and, unless cal_boot=off, once after boot (boot grace period).
+
+#ifndef CAL_DEFAULT_SECONDS
+#define CAL_DEFAULT_SECONDS 3
+#endif
+#ifndef CAL_MAX_SECONDS
+#define CAL_MAX_SECONDS 30
+#endif
+#ifndef CAL_DEFAULT_MARGIN_DB
+#define CAL_DEFAULT_MARGIN_DB 18         // headroom above the calibration peak (3 bits)
+#endif
+#ifndef CAL_MAX_MARGIN_DB
+#define CAL_MAX_MARGIN_DB 40
+#endif
+#ifndef CAL_SETTLE_MS
+#define CAL_SETTLE_MS 200
+#endif
+#ifndef CAL_WINDOW_MS
+#define CAL_WINDOW_MS 20
+#endif
+
+static const uint8_t CAL_HIST_BINS = 145;    // 1 dB bins, 0 .. -144 dBFS (24-bit)
+
+enum MicCalState : uint8_t {
+    MICCAL_IDLE,
+    MICCAL_RUNNING,
+    MICCAL_DONE,
+    MICCAL_FAILED
+};
+
+enum MicCalBootMode : uint8_t {
+    MICCAL_BOOT_OFF,
+    MICCAL_BOOT_PROPOSE,          // measure and report only
+    MICCAL_BOOT_APPLY,            // measure and apply (and save) the proposal
+    MICCAL_BOOT_MODE_COUNT
+};
+
+struct MicCalStatus {
+    MicCalState state;
+    const char *error;
+    bool apply;
+    bool boot;                    // started by the boot run
+    bool acPeak;                  // proposal based on the peak around the DC (HPF on)
+    uint8_t marginDb;
+    uint16_t seconds;
+    uint32_t sampleRate;
+    uint32_t startedMs;
+    uint32_t finishedMs;
+    uint32_t samples;             // analysed (after settling)
+    uint32_t samplesWanted;
+    uint32_t runs;
+    // Measurements, 24-bit scale (dBFS re 2^23)
+    float dcOffset;               // in 24-bit LSB
+    float dcDbfs;
+    float peakDbfs;
+    float acPeakDbfs;
+    float noiseDbfs;
+    float dynamicRangeDb;         // used peak - noise floor
+    // Proposal
+    uint8_t shift;
+    float gain;
+    float peakOutDbfs;            // at the 16-bit output with the proposal
+    float noiseOutDbfs;
+    bool noiseBelowLsb;
+    uint8_t prevShift;
+    float prevGain;
+    bool applied;
+};
+
+extern MicCalStatus micCalStatus;
+
+const char *miccal_stateName(uint8_t state);
+const char *miccal_bootModeName(uint8_t mode);
+bool miccal_bootModeFromName(const String &name, MicCalBootMode &out);
+
+void miccal_begin(uint32_t sampleRate, uint16_t seconds, uint8_t marginDb, bool acPeak, bool apply,
+                  bool boot, uint8_t curShift, float curGain, uint32_t nowMs);
+// Accumulates one block of raw I2S words; true once enough samples were analysed.
+bool miccal_feed(const int32_t *raw, int samples);
+// Computes the measurements and the proposal (state DONE, or FAILED with an error code).
+void miccal_finish(uint32_t nowMs);
+void miccal_abort(const char *error, uint32_t nowMs);
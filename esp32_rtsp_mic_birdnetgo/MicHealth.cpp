@@ -0,0 +1,232 @@
+#include "MicHealth.h"
+#include <math.h>
+#include <string.h>
+
+MicHealthStatus micHealth = {0, 0, -144.0f, -144.0f, 0, 0, 0, -1};
+
+static const char *const MH_FLAG_NAMES[MH_FLAG_COUNT] = {
+    "silent", "stuck", "low_rms", "dropouts", "dc", "stuck_bits", "lsb_zero"};
+static const char *const MH_ACTION_NAMES[] = {"none", "alert", "probe_channel", "restart_i2s", "recovered"};
+
+static const uint32_t DATA_MASK = 0xFFFFFF00UL;   // 24 data bits, left-justified
+static const float FS24 = 8388608.0f;
+
+struct BlockStats {
+    uint32_t orBits;
+    uint32_t andBits;
+    int64_t sum;
+    uint64_t sumSq;
+    int maxRun;
+    uint32_t dropouts;
+};
+
+// Running second
+static uint32_t accBlocks = 0;
+static uint32_t accSamples = 0;
+static uint32_t accOr = 0;
+static uint32_t accAnd = 0xFFFFFFFFUL;
+static int64_t accSum = 0;
+static uint64_t accSq = 0;
+static uint32_t accStuckBlocks = 0;
+static uint32_t accDropouts = 0;
+
+// Flag debounce
+static uint8_t raiseRun[MH_FLAG_COUNT];
+static uint8_t clearRun[MH_FLAG_COUNT];
+static uint16_t pendingAlert = 0;
+
+// Dead-mic episode
+static bool epProbed = false;
+static uint8_t epRestarts = 0;
+static uint32_t epLastMs = 0;
+
+const char *michealth_flagName(uint16_t flag) {
+    for (uint8_t i = 0; i < MH_FLAG_COUNT; i++) {
+        if (flag == (1U << i)) return MH_FLAG_NAMES[i];
+    }
+    return "unknown";
+}
+
+const char *michealth_actionName(uint8_t action) {
+    return action <= MH_RECOVERED ? MH_ACTION_NAMES[action] : "unknown";
+}
+
+const char *michealth_summary(uint16_t flags) {
+    for (uint8_t i = 0; i < MH_FLAG_COUNT; i++) {
+        if (flags & (1U << i)) return MH_FLAG_NAMES[i];
+    }
+    return "ok";
+}
+
+static void blockStats(const int32_t *raw, int samples, BlockStats &s) {
+    uint32_t o = 0, a = 0xFFFFFFFFUL;
+    int64_t sum = 0;
+    uint64_t sq = 0;
+    uint32_t prev = (uint32_t)raw[0] & DATA_MASK;
+    int run = 0, maxRun = 0;
+    uint32_t drops = 0;
+    for (int i = 0; i < samples; i++) {
+        uint32_t w = (uint32_t)raw[i] & DATA_MASK;
+        o |= w;
+        a &= w;
+        int32_t x = (int32_t)w >> 8;
+        sum += x;
+        sq += (uint64_t)((int64_t)x * x);
+        if (w == prev) {
+            run++;
+        } else {
+            if (run >= MICHEALTH_DROPOUT_RUN) drops++;
+            if (run > maxRun) maxRun = run;
+            run = 1;
+            prev = w;
+        }
+    }
+    if (run > maxRun) maxRun = run;
+    // Runs crossing a block boundary count per block (split or missed): good enough for a rate
+    if (run >= MICHEALTH_DROPOUT_RUN && maxRun < samples) drops++;
+    s.orBits = o;
+    s.andBits = a;
+    s.sum = sum;
+    s.sumSq = sq;
+    s.maxRun = maxRun;
+    s.dropouts = maxRun < samples ? drops : 0;
+}
+
+static float dbfs24(double v) {
+    return v > 0.0 ? (float)(20.0 * log10(v / FS24)) : -144.0f;
+}
+
+static double acRms(int64_t sum, uint64_t sumSq, uint32_t n) {
+    double mean = (double)sum / n;
+    double var = (double)sumSq / n - mean * mean;
+    return var > 0.0 ? sqrt(var) : 0.0;
+}
+
+void michealth_block(const int32_t *raw, int samples) {
+    if (samples <= 0) return;
+    BlockStats s;
+    blockStats(raw, samples, s);
+    accBlocks++;
+    accSamples += samples;
+    accOr |= s.orBits;
+    accAnd &= s.andBits;
+    accSum += s.sum;
+    accSq += s.sumSq;
+    if (s.orBits != 0 && s.maxRun >= samples) accStuckBlocks++;
+    accDropouts += s.dropouts;
+    micHealth.blocks++;
+}
+
+void michealth_discard() {
+    accBlocks = 0;
+    accSamples = 0;
+    accOr = 0;
+    accAnd = 0xFFFFFFFFUL;
+    accSum = 0;
+    accSq = 0;
+    accStuckBlocks = 0;
+    accDropouts = 0;
+}
+
+bool michealth_blockAlive(const int32_t *raw, int samples) {
+    if (samples <= 0) return false;
+    BlockStats s;
+    blockStats(raw, samples, s);
+    if (s.orBits == 0 || s.maxRun >= samples) return false;
+    return dbfs24(acRms(s.sum, s.sumSq, samples)) >= MICHEALTH_MIN_RMS_DBFS;
+}
+
+// Conditions of the second just captured
+static uint16_t judgeSecond(uint8_t shift) {
+    MicHealthStatus &h = micHealth;
+    uint16_t c = 0;
+    double mean = (double)accSum / accSamples;
+    h.rmsDbfs = dbfs24(acRms(accSum, accSq, accSamples));
+    h.dcDbfs = dbfs24(fabs(mean));
+    h.orBits = accOr;
+    h.andBits = accAnd;
+    h.stuckBitMask = 0;
+    h.lowestBit = accOr ? (int8_t)__builtin_ctz(accOr) : -1;
+    h.dropouts += accDropouts;
+
+    if (accOr == 0) return MH_SILENT;
+    if (accStuckBlocks == accBlocks) return MH_STUCK;
+    if (h.rmsDbfs < MICHEALTH_MIN_RMS_DBFS) return MH_LOW_RMS;
+
+    if (accDropouts) c |= MH_DROPOUTS;
+    if (h.dcDbfs > MICHEALTH_MAX_DC_DBFS) c |= MH_DC;
+    // Bit patterns only mean something for a signal that crosses zero: small negative words
+    // set all the high bits, small positive ones clear them.
+    bool bothSigns = (accOr & 0x80000000UL) && !(accAnd & 0x80000000UL);
+    if (bothSigns) {
+        uint32_t above = 0x7FFFFF00UL & (0xFFFFFFFFUL << h.lowestBit);
+        h.stuckBitMask = (~accOr & above) | (accAnd & 0x7FFFFF00UL);
+        if (h.stuckBitMask) c |= MH_STUCK_BITS;
+        if (h.lowestBit > (int)shift) c |= MH_LSB_ZERO;
+    }
+    return c;
+}
+
+MicHealthAction michealth_tick(uint8_t shift, bool autoRecovery, uint32_t nowMs) {
+    if (accBlocks == 0 || accSamples == 0) return MH_NONE;   // not capturing: no verdict
+    MicHealthStatus &h = micHealth;
+    uint16_t cond = judgeSecond(shift);
+    michealth_discard();
+    h.seconds++;
+    h.lastSecond = cond;
+
+    const uint16_t old = h.flags;
+    uint16_t flags = old;
+    for (uint8_t i = 0; i < MH_FLAG_COUNT; i++) {
+        uint16_t bit = 1U << i;
+        if (cond & bit) {
+            clearRun[i] = 0;
+            if (raiseRun[i] < 255) raiseRun[i]++;
+            if (raiseRun[i] >= MICHEALTH_RAISE_S) flags |= bit;
+        } else {
+            raiseRun[i] = 0;
+            if (clearRun[i] < 255) clearRun[i]++;
+            if (clearRun[i] >= MICHEALTH_CLEAR_S) flags &= ~bit;
+        }
+    }
+    if (flags != old) {
+        h.flags = flags;
+        h.lastChangeMs = nowMs;
+    }
+    pendingAlert |= flags & ~old & ~MH_DEAD_MASK;
+    pendingAlert &= flags;
+
+    const bool wasDead = old & MH_DEAD_MASK;
+    const bool dead = flags & MH_DEAD_MASK;
+    if (dead && !wasDead) {
+        h.episodes++;
+        h.alerts++;
+        epProbed = false;
+        epRestarts = 0;
+        epLastMs = nowMs;
+        return MH_ALERT;
+    }
+    if (!dead && wasDead) return MH_RECOVERED;
+    if (dead && autoRecovery) {
+        uint32_t elapsed = nowMs - epLastMs;
+        if (!epProbed && elapsed >= MICHEALTH_ESCALATE_S * 1000UL) {
+            epProbed = true;
+            epLastMs = nowMs;
+            h.probes++;
+            return MH_PROBE_CHANNEL;
+        }
+        uint32_t wait = (epRestarts == 0 ? MICHEALTH_ESCALATE_S : MICHEALTH_RESTART_INTERVAL_S) * 1000UL;
+        if (epProbed && epRestarts < MICHEALTH_MAX_RESTARTS && elapsed >= wait) {
+            epRestarts++;
+            epLastMs = nowMs;
+            h.restarts++;
+            return MH_RESTART_I2S;
+        }
+    }
+    if (pendingAlert) {
+        pendingAlert = 0;
+        h.alerts++;
+        return MH_ALERT;
+    }
+    return MH_NONE;
+}
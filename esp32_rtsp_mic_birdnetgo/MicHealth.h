@@ -0,0 +1,107 @@
+#pragma once
+#include <Arduino.h>
+
+// Microphone health monitor (ESP32 RTSP Mic for BirdNET-Go)
+//
+// A dead or disconnected mic still streams zeros (or a constant) at the full packet rate, so
+// the stream watchdog never sees it. This looks at the raw I2S words of every block (one pass:
+// OR/AND of the words, sum and sum of squares, runs of identical words) and folds them into a
+// verdict once per second:
+//   silent     every word zero: no data (mic unpowered, DOUT open, or it answers on the other
+//              L/R slot)
+//   stuck      every block a single repeated non-zero word
+//   low_rms    AC level under MICHEALTH_MIN_RMS_DBFS, well below any MEMS mic's self-noise
+//   dropouts   runs of MICHEALTH_DROPOUT_RUN identical words inside live audio (contact, DMA)
+//   dc         |DC| above MICHEALTH_MAX_DC_DBFS
+//   stuck_bits a data bit that never toggles although the signal crosses zero and lower bits do
+//   lsb_zero   the lowest bit that ever toggles is above i2sShiftBits, so the low bits of the
+//              16-bit output are always zero (wrong shift, or a 16-bit source)
+// A condition becomes a flag after MICHEALTH_RAISE_S seconds in a row and clears after
+// MICHEALTH_CLEAR_S clean seconds. silent, stuck and low_rms mean a dead mic: tick() then
+// climbs alert -> probe the other L/R slot -> restart I2S (again every
+// MICHEALTH_RESTART_INTERVAL_S, at most MICHEALTH_MAX_RESTARTS per episode). The other flags
+// only alert. Like StreamWatchdog, tick() decides and the caller acts.
+
+#ifndef MICHEALTH_RAISE_S
+#define MICHEALTH_RAISE_S 10
+#endif
+#ifndef MICHEALTH_CLEAR_S
+#define MICHEALTH_CLEAR_S 30
+#endif
+#ifndef MICHEALTH_ESCALATE_S
+#define MICHEALTH_ESCALATE_S 10
+#endif
+#ifndef MICHEALTH_RESTART_INTERVAL_S
+#define MICHEALTH_RESTART_INTERVAL_S 300
+#endif
+#ifndef MICHEALTH_MAX_RESTARTS
+#define MICHEALTH_MAX_RESTARTS 3
+#endif
+#ifndef MICHEALTH_MIN_RMS_DBFS
+#define MICHEALTH_MIN_RMS_DBFS -110.0f   // 24-bit scale; ICS-43434/INMP441 self-noise is ~-90
+#endif
+#ifndef MICHEALTH_MAX_DC_DBFS
+#define MICHEALTH_MAX_DC_DBFS -30.0f
+#endif
+#ifndef MICHEALTH_DROPOUT_RUN
+#define MICHEALTH_DROPOUT_RUN 32         // identical words in a row inside live audio
+#endif
+
+enum MicHealthFlag : uint16_t {
+    MH_SILENT = 1 << 0,
+    MH_STUCK = 1 << 1,
+    MH_LOW_RMS = 1 << 2,
+    MH_DROPOUTS = 1 << 3,
+    MH_DC = 1 << 4,
+    MH_STUCK_BITS = 1 << 5,
+    MH_LSB_ZERO = 1 << 6,
+    MH_FLAG_COUNT = 7
+};
+static const uint16_t MH_DEAD_MASK = MH_SILENT | MH_STUCK | MH_LOW_RMS;
+
+enum MicHealthAction : uint8_t {
+    MH_NONE,
+    MH_ALERT,                 // a flag was raised: log and publish
+    MH_PROBE_CHANNEL,         // dead mic: try the other L/R slot once per episode
+    MH_RESTART_I2S,
+    MH_RECOVERED              // the dead-mic flags cleared
+};
+
+struct MicHealthStatus {
+    uint16_t flags;           // raised conditions (MicHealthFlag)
+    uint16_t lastSecond;      // conditions seen in the last judged second
+    // Last judged second
+    float rmsDbfs;            // AC RMS, 24-bit scale
+    float dcDbfs;
+    uint32_t orBits;          // OR / AND of the data bits over the second
+    uint32_t andBits;
+    uint32_t stuckBitMask;
+    int8_t lowestBit;         // lowest toggling bit of the 32-bit word, -1 if none
+    // Totals
+    uint32_t seconds;
+    uint32_t blocks;
+    uint32_t dropouts;
+    uint32_t episodes;        // dead-mic episodes
+    uint32_t probes;
+    uint32_t restarts;
+    uint32_t alerts;
+    bool lrSwitched;          // a probe found the mic on the other slot and switched to it
+    uint32_t lastChangeMs;
+};
+
+extern MicHealthStatus micHealth;
+
+const char *michealth_flagName(uint16_t flag);
+const char *michealth_actionName(uint8_t action);
+// "ok" or the name of the most serious raised flag.
+const char *michealth_summary(uint16_t flags);
+
+// Per block of raw I2S words, in the capture path before any processing.
+void michealth_block(const int32_t *raw, int samples);
+// Once per second. shift is i2sShiftBits; autoRecovery false limits the ladder to alerts.
+MicHealthAction michealth_tick(uint8_t shift, bool autoRecovery, uint32_t nowMs);
+// Forget the running second (after an I2S restart or a slot change).
+void michealth_discard();
+
+// True if a block looks like a live microphone (used to probe the other slot).
+bool michealth_blockAlive(const int32_t *raw, int samples);
@@ -0,0 +1,268 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// MQTT telemetry encoder (ESP32 RTSP Mic for BirdNET-Go)
+//
+// The state payload is described by a static field table; loop() fills a fixed snapshot
+// (no heap) and the encoders below turn it into JSON or MessagePack. A field mask selects
+// which fields are written, so the same code produces full snapshots and deltas.
+//
+// Plain C++, no Arduino types, so it can be checked on a host.
+
+#ifndef TELEMETRY_STR_MAX
+#define TELEMETRY_STR_MAX 40   // incl. terminator; longer values are cut
+#endif
+
+enum TelemetryType : uint8_t {
+    TELEMETRY_UINT,      // num >= 0
+    TELEMETRY_INT,
+    TELEMETRY_BOOL,      // num 0/1
+    TELEMETRY_FIXED1,    // num = value * 10
+    TELEMETRY_FIXED2,    // num = value * 100
+    TELEMETRY_STR
+};
+
+struct TelemetryField {
+    const char *key;
+    TelemetryType type;
+};
+
+struct TelemetryValue {
+    bool null;           // JSON null / MessagePack nil
+    int64_t num;
+    char str[TELEMETRY_STR_MAX];
+};
+
+typedef uint64_t TelemetryMask;
+static const size_t TELEMETRY_MAX_FIELDS = 64;
+
+inline TelemetryMask telemetry_fullMask(size_t count) {
+    return count >= TELEMETRY_MAX_FIELDS ? ~(TelemetryMask)0 : (((TelemetryMask)1 << count) - 1);
+}
+
+inline void telemetry_setNum(TelemetryValue &v, int64_t num) {
+    v.null = false;
+    v.num = num;
+    v.str[0] = '\0';
+}
+
+inline void telemetry_setStr(TelemetryValue &v, const char *s) {
+    v.null = false;
+    v.num = 0;
+    size_t n = s ? strlen(s) : 0;
+    if (n >= sizeof(v.str)) n = sizeof(v.str) - 1;
+    if (n) memcpy(v.str, s, n);
+    v.str[n] = '\0';
+}
+
+inline void telemetry_setNull(TelemetryValue &v) {
+    v.null = true;
+    v.num = 0;
+    v.str[0] = '\0';
+}
+
+// Value*scale rounded to the nearest integer (for the FIXED types).
+inline int64_t telemetry_fixed(float value, int scale) {
+    float x = value * (float)scale;
+    return (int64_t)(x < 0 ? x - 0.5f : x + 0.5f);
+}
+
+inline bool telemetry_equal(const TelemetryValue &a, const TelemetryValue &b) {
+    return a.null == b.null && a.num == b.num && strcmp(a.str, b.str) == 0;
+}
+
+// Bit i set for every field that differs between prev and cur.
+inline TelemetryMask telemetry_diff(const TelemetryValue *prev, const TelemetryValue *cur, size_t count) {
+    TelemetryMask mask = 0;
+    for (size_t i = 0; i < count && i < TELEMETRY_MAX_FIELDS; i++) {
+        if (!telemetry_equal(prev[i], cur[i])) mask |= (TelemetryMask)1 << i;
+    }
+    return mask;
+}
+
+// Bounded output buffer. len keeps counting past cap, so an overflow is detectable and
+// cap = 0 measures the encoded size without writing anything.
+struct TelemetryWriter {
+    uint8_t *buf;
+    size_t cap;
+    size_t len;
+
+    void put(uint8_t b) {
+        if (len < cap) buf[len] = b;
+        len++;
+    }
+    void put(const void *data, size_t n) {
+        const uint8_t *p = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < n; i++) put(p[i]);
+    }
+    void puts(const char *s) { put(s, strlen(s)); }
+    bool ok() const { return len <= cap; }
+};
+
+inline void telemetry_jsonString(TelemetryWriter &w, const char *s) {
+    static const char hex[] = "0123456789abcdef";
+    w.put('"');
+    for (; *s; ++s) {
+        uint8_t c = (uint8_t)*s;
+        if (c == '"' || c == '\\') {
+            w.put('\\');
+            w.put(c);
+        } else if (c == '\n') {
+            w.puts("\\n");
+        } else if (c == '\r') {
+            w.puts("\\r");
+        } else if (c == '\t') {
+            w.puts("\\t");
+        } else if (c < 0x20) {
+            w.puts("\\u00");
+            w.put(hex[c >> 4]);
+            w.put(hex[c & 0x0F]);
+        } else {
+            w.put(c);
+        }
+    }
+    w.put('"');
+}
+
+inline void telemetry_jsonFixed(TelemetryWriter &w, int64_t num, int decimals) {
+    int64_t scale = (decimals == 1) ? 10 : 100;
+    char tmp[32];
+    uint64_t mag = (num < 0) ? (uint64_t)(-num) : (uint64_t)num;
+    snprintf(tmp, sizeof(tmp), "%s%lu.%0*lu", num < 0 ? "-" : "", (unsigned long)(mag / scale), decimals,
+             (unsigned long)(mag % scale));
+    w.puts(tmp);
+}
+
+// {"key":value,...} for every field in mask. Returns the encoded length (may exceed cap).
+inline size_t telemetry_encodeJson(const TelemetryField *fields, const TelemetryValue *values, size_t count,
+                                   TelemetryMask mask, TelemetryWriter &w) {
+    bool first = true;
+    w.put('{');
+    for (size_t i = 0; i < count && i < TELEMETRY_MAX_FIELDS; i++) {
+        if (!(mask & ((TelemetryMask)1 << i))) continue;
+        if (!first) w.put(',');
+        first = false;
+        telemetry_jsonString(w, fields[i].key);
+        w.put(':');
+        const TelemetryValue &v = values[i];
+        if (v.null) {
+            w.puts("null");
+            continue;
+        }
+        char tmp[24];
+        switch (fields[i].type) {
+            case TELEMETRY_UINT:
+                snprintf(tmp, sizeof(tmp), "%lu", (unsigned long)v.num);
+                w.puts(tmp);
+                break;
+            case TELEMETRY_INT:
+                snprintf(tmp, sizeof(tmp), "%ld", (long)v.num);
+                w.puts(tmp);
+                break;
+            case TELEMETRY_BOOL:
+                w.puts(v.num ? "true" : "false");
+                break;
+            case TELEMETRY_FIXED1:
+                telemetry_jsonFixed(w, v.num, 1);
+                break;
+            case TELEMETRY_FIXED2:
+                telemetry_jsonFixed(w, v.num, 2);
+                break;
+            case TELEMETRY_STR:
+                telemetry_jsonString(w, v.str);
+                break;
+        }
+    }
+    w.put('}');
+    return w.len;
+}
+
+// ---- MessagePack (https://msgpack.org/ spec subset: map, str, int, float32, bool, nil) ----
+
+inline void telemetry_mpBe(TelemetryWriter &w, uint64_t v, int bytes) {
+    for (int i = bytes - 1; i >= 0; i--) w.put((uint8_t)(v >> (8 * i)));
+}
+
+inline void telemetry_mpStr(TelemetryWriter &w, const char *s) {
+    size_t n = strlen(s);
+    if (n < 32) {
+        w.put((uint8_t)(0xA0 | n));
+    } else if (n < 256) {
+        w.put(0xD9);
+        w.put((uint8_t)n);
+    } else {
+        w.put(0xDA);
+        telemetry_mpBe(w, n, 2);
+    }
+    w.put(s, n);
+}
+
+inline void telemetry_mpInt(TelemetryWriter &w, int64_t v) {
+    if (v >= 0) {
+        if (v < 128) w.put((uint8_t)v);
+        else if (v < 0x100) { w.put(0xCC); telemetry_mpBe(w, (uint64_t)v, 1); }
+        else if (v < 0x10000) { w.put(0xCD); telemetry_mpBe(w, (uint64_t)v, 2); }
+        else if (v < 0x100000000LL) { w.put(0xCE); telemetry_mpBe(w, (uint64_t)v, 4); }
+        else { w.put(0xCF); telemetry_mpBe(w, (uint64_t)v, 8); }
+    } else {
+        if (v >= -32) w.put((uint8_t)(int8_t)v);
+        else if (v >= -128) { w.put(0xD0); telemetry_mpBe(w, (uint64_t)v, 1); }
+        else if (v >= -32768) { w.put(0xD1); telemetry_mpBe(w, (uint64_t)v, 2); }
+        else if (v >= -2147483648LL) { w.put(0xD2); telemetry_mpBe(w, (uint64_t)v, 4); }
+        else { w.put(0xD3); telemetry_mpBe(w, (uint64_t)v, 8); }
+    }
+}
+
+inline void telemetry_mpFloat(TelemetryWriter &w, float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    w.put(0xCA);
+    telemetry_mpBe(w, bits, 4);
+}
+
+// Same content as telemetry_encodeJson, as a MessagePack map. Fixed-point values are sent
+// as float32, everything else keeps its JSON type.
+inline size_t telemetry_encodeMsgpack(const TelemetryField *fields, const TelemetryValue *values, size_t count,
+                                      TelemetryMask mask, TelemetryWriter &w) {
+    size_t n = 0;
+    for (size_t i = 0; i < count && i < TELEMETRY_MAX_FIELDS; i++) {
+        if (mask & ((TelemetryMask)1 << i)) n++;
+    }
+    if (n < 16) {
+        w.put((uint8_t)(0x80 | n));
+    } else {
+        w.put(0xDE);
+        telemetry_mpBe(w, n, 2);
+    }
+    for (size_t i = 0; i < count && i < TELEMETRY_MAX_FIELDS; i++) {
+        if (!(mask & ((TelemetryMask)1 << i))) continue;
+        telemetry_mpStr(w, fields[i].key);
+        const TelemetryValue &v = values[i];
+        if (v.null) {
+            w.put(0xC0);
+            continue;
+        }
+        switch (fields[i].type) {
+            case TELEMETRY_UINT:
+            case TELEMETRY_INT:
+                telemetry_mpInt(w, v.num);
+                break;
+            case TELEMETRY_BOOL:
+                w.put(v.num ? 0xC3 : 0xC2);
+                break;
+            case TELEMETRY_FIXED1:
+                telemetry_mpFloat(w, (float)v.num / 10.0f);
+                break;
+            case TELEMETRY_FIXED2:
+                telemetry_mpFloat(w, (float)v.num / 100.0f);
+                break;
+            case TELEMETRY_STR:
+                telemetry_mpStr(w, v.str);
+                break;
+        }
+    }
+    return w.len;
+}
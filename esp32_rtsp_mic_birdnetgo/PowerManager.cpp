@@ -0,0 +1,196 @@
+#include "PowerManager.h"
+#include <WiFi.h>
+#if POWER_PM_FRAMEWORK
+#include <esp_pm.h>
+#endif
+
+static const char *const POWER_PROFILE_NAMES[POWER_PROFILE_COUNT] = {
+    "performance",
+    "balanced",
+    "saver",
+};
+
+// Software DFS thresholds (no PM framework): up at once, down after a quiet spell.
+static const uint8_t POWER_DFS_UP_PCT = 60;
+static const uint8_t POWER_DFS_DOWN_PCT = 25;
+static const uint8_t POWER_DFS_DOWN_SEC = 5;
+
+PowerStatus powerStatus = {};
+
+static bool powerBusy = false;
+static uint32_t powerBusyStartUs = 0;
+static uint32_t powerBusyAccUs = 0;
+static uint32_t powerWindowStartUs = 0;
+static uint8_t powerLowSec = 0;
+static bool powerPmActive = false;   // esp_pm_configure() accepted the profile
+static bool powerHoldMax = false;
+
+#if POWER_PM_FRAMEWORK
+static esp_pm_lock_handle_t powerCpuLock = nullptr;
+static bool powerLockHeld = false;
+static esp_pm_lock_handle_t powerHoldLock = nullptr;
+#endif
+
+const char *power_profileName(uint8_t profile) {
+    return profile < POWER_PROFILE_COUNT ? POWER_PROFILE_NAMES[profile] : "";
+}
+
+bool power_profileFromName(const String &name, PowerProfile &out) {
+    for (uint8_t i = 0; i < POWER_PROFILE_COUNT; i++) {
+        if (name == POWER_PROFILE_NAMES[i]) {
+            out = (PowerProfile)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void power_busy() {
+    if (powerBusy) return;
+    powerBusy = true;
+    powerBusyStartUs = micros();
+#if POWER_PM_FRAMEWORK
+    if (powerPmActive && powerCpuLock && !powerLockHeld) {
+        esp_pm_lock_acquire(powerCpuLock);
+        powerLockHeld = true;
+    }
+#endif
+}
+
+void power_idle() {
+    if (!powerBusy) return;
+    powerBusy = false;
+    powerBusyAccUs += micros() - powerBusyStartUs;
+#if POWER_PM_FRAMEWORK
+    if (powerLockHeld) {
+        esp_pm_lock_release(powerCpuLock);
+        powerLockHeld = false;
+    }
+#endif
+}
+
+void power_yield(bool streaming) {
+    power_idle();
+    if (powerStatus.profile != POWER_PERFORMANCE && !streaming) {
+        delay(1);
+    }
+}
+
+void power_holdMax(bool hold) {
+    if (hold == powerHoldMax) return;
+    powerHoldMax = hold;
+#if POWER_PM_FRAMEWORK
+    if (!powerHoldLock) esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "hold_max", &powerHoldLock);
+    if (powerHoldLock) {
+        if (hold) esp_pm_lock_acquire(powerHoldLock);
+        else esp_pm_lock_release(powerHoldLock);
+    }
+#endif
+    if (hold && !powerPmActive && getCpuFrequencyMhz() < powerStatus.maxMhz) {
+        setCpuFrequencyMhz(powerStatus.maxMhz);
+        powerStatus.freqSwitches++;
+    }
+    powerLowSec = 0;
+}
+
+void power_apply(PowerProfile profile, uint16_t maxMhz) {
+    PowerStatus &s = powerStatus;
+    if (profile >= POWER_PROFILE_COUNT) profile = POWER_PERFORMANCE;
+    s.profile = profile;
+    if (profile == POWER_PERFORMANCE) {
+        s.maxMhz = s.minMhz = maxMhz;
+    } else {
+        s.maxMhz = maxMhz < POWER_MIN_CPU_MHZ ? POWER_MIN_CPU_MHZ : maxMhz;
+        s.minMhz = POWER_MIN_CPU_MHZ;
+    }
+    s.modemSleep = (profile == POWER_SAVER);
+    WiFi.setSleep(s.modemSleep);
+    s.lightSleep = false;
+    powerPmActive = false;
+    powerLowSec = 0;
+
+#if POWER_PM_FRAMEWORK
+    if (!powerCpuLock) {
+        esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "audio_loop", &powerCpuLock);
+    }
+    esp_pm_config_t cfg = {};
+    cfg.max_freq_mhz = s.maxMhz;
+    cfg.min_freq_mhz = s.minMhz;
+    cfg.light_sleep_enable = (profile == POWER_SAVER);
+    esp_err_t err = esp_pm_configure(&cfg);
+    if (err != ESP_OK && cfg.light_sleep_enable) {
+        // Light sleep needs tickless idle in the IDF build; keep DFS without it.
+        cfg.light_sleep_enable = false;
+        err = esp_pm_configure(&cfg);
+    }
+    if (err == ESP_OK) {
+        powerPmActive = (profile != POWER_PERFORMANCE);
+        s.lightSleep = cfg.light_sleep_enable;
+    }
+#endif
+    s.pmFramework = powerPmActive;
+    if (!powerPmActive) {
+        setCpuFrequencyMhz(s.maxMhz);
+    }
+}
+
+static float powerLerpMa(uint16_t mhz, float at80, float at160) {
+    return at80 + (at160 - at80) * ((float)mhz - 80.0f) / 80.0f;
+}
+
+void power_sample(uint32_t nowMs, bool streaming) {
+    (void)nowMs;
+    PowerStatus &s = powerStatus;
+    uint32_t nowUs = micros();
+    if (powerBusy) {
+        // Called from inside loop(): count the running period up to now.
+        powerBusyAccUs += nowUs - powerBusyStartUs;
+        powerBusyStartUs = nowUs;
+    }
+    uint32_t windowUs = nowUs - powerWindowStartUs;
+    powerWindowStartUs = nowUs;
+    uint32_t busyUs = powerBusyAccUs;
+    powerBusyAccUs = 0;
+    if (windowUs == 0 || s.samples++ == 0) return;   // first call only opens the window
+
+    uint32_t load = (uint32_t)(((uint64_t)busyUs * 100ULL) / windowUs);
+    if (load > 100) load = 100;
+    s.loadPct = (uint8_t)load;
+    s.loadAvgPct = (s.samples <= 2) ? s.loadPct : (uint8_t)((s.loadAvgPct * 7U + s.loadPct + 4U) / 8U);
+    if (s.loadPct > s.loadPeakPct) s.loadPeakPct = s.loadPct;
+
+    uint16_t curMhz = (uint16_t)getCpuFrequencyMhz();
+    if (s.profile != POWER_PERFORMANCE && !powerPmActive) {
+        if (s.loadPct >= POWER_DFS_UP_PCT) {
+            powerLowSec = 0;
+            if (curMhz < s.maxMhz) {
+                setCpuFrequencyMhz(s.maxMhz);
+                s.freqSwitches++;
+            }
+        } else if (s.loadPct <= POWER_DFS_DOWN_PCT) {
+            if (powerLowSec < POWER_DFS_DOWN_SEC) powerLowSec++;
+            if (powerLowSec >= POWER_DFS_DOWN_SEC && curMhz > s.minMhz && !powerHoldMax) {
+                setCpuFrequencyMhz(s.minMhz);
+                s.freqSwitches++;
+            }
+        } else {
+            powerLowSec = 0;
+        }
+        curMhz = (uint16_t)getCpuFrequencyMhz();
+    }
+
+    // Clock while busy / while waiting, per profile and mechanism.
+    uint16_t busyMhz = powerPmActive ? s.maxMhz : curMhz;
+    uint16_t idleMhz = powerPmActive ? s.minMhz : curMhz;
+    if (s.profile == POWER_PERFORMANCE) busyMhz = idleMhz = s.maxMhz;
+    s.maxClockPct = powerPmActive ? s.loadPct : (curMhz >= s.maxMhz ? 100 : 0);
+
+    float busyShare = s.loadPct / 100.0f;
+    float cpuMa = busyShare * powerLerpMa(busyMhz, POWER_EST_CPU_ACTIVE_MA_80, POWER_EST_CPU_ACTIVE_MA_160);
+    // The I2S driver blocks light sleep while it runs.
+    float idleMa = (s.lightSleep && !streaming)
+        ? POWER_EST_LIGHT_SLEEP_MA
+        : powerLerpMa(idleMhz, POWER_EST_CPU_IDLE_MA_80, POWER_EST_CPU_IDLE_MA_160);
+    cpuMa += (1.0f - busyShare) * idleMa;
+    s.estMa = cpuMa + (s.modemSleep ? POWER_EST_WIFI_MODEM_SLEEP_MA : POWER_EST_WIFI_RX_MA);
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <Arduino.h>
+
+// Power profiles (ESP32 RTSP Mic for BirdNET-Go)
+//
+//   performance - fixed CPU clock, Wi-Fi power save off (the classic behaviour)
+//   balanced    - dynamic frequency scaling between 80 MHz and the configured CPU clock
+//   saver       - balanced + Wi-Fi modem sleep + automatic light sleep when idle
+//
+// loop() marks its work with power_busy()/power_idle(): the time between them is the CPU
+// load, and with the ESP-IDF power management framework (CONFIG_PM_ENABLE) it holds a
+// CPU_FREQ_MAX lock, so the clock drops to 80 MHz (or the chip light-sleeps) while the
+// loop waits for the next I2S DMA block. Without the framework the frequency is switched in
+// software from the measured load, and light sleep is not available.
+//
+// Note: the legacy I2S driver holds its own PM lock while running, so light sleep only
+// happens while no stream is active; during streaming the saving comes from DFS and modem
+// sleep.
+
+#if defined(CONFIG_PM_ENABLE)
+#define POWER_PM_FRAMEWORK 1
+#else
+#define POWER_PM_FRAMEWORK 0
+#endif
+
+#ifndef POWER_MIN_CPU_MHZ
+#define POWER_MIN_CPU_MHZ 80          // lowest clock Wi-Fi runs at
+#endif
+
+// Rough ESP32-C6 supply current figures at 3.3 V (datasheet typicals), used only for the
+// estimate in the status report: good enough to compare profiles, not a measurement.
+#ifndef POWER_EST_CPU_ACTIVE_MA_80
+#define POWER_EST_CPU_ACTIVE_MA_80 24.0f
+#endif
+#ifndef POWER_EST_CPU_ACTIVE_MA_160
+#define POWER_EST_CPU_ACTIVE_MA_160 38.0f
+#endif
+#ifndef POWER_EST_CPU_IDLE_MA_80
+#define POWER_EST_CPU_IDLE_MA_80 18.0f
+#endif
+#ifndef POWER_EST_CPU_IDLE_MA_160
+#define POWER_EST_CPU_IDLE_MA_160 27.0f
+#endif
+#ifndef POWER_EST_LIGHT_SLEEP_MA
+#define POWER_EST_LIGHT_SLEEP_MA 0.2f
+#endif
+#ifndef POWER_EST_WIFI_RX_MA
+#define POWER_EST_WIFI_RX_MA 75.0f    // receiver always on (power save off)
+#endif
+#ifndef POWER_EST_WIFI_MODEM_SLEEP_MA
+#define POWER_EST_WIFI_MODEM_SLEEP_MA 22.0f   // average with DTIM modem sleep
+#endif
+
+enum PowerProfile : uint8_t {
+    POWER_PERFORMANCE,
+    POWER_BALANCED,
+    POWER_SAVER,
+    POWER_PROFILE_COUNT
+};
+
+struct PowerStatus {
+    uint8_t profile;
+    bool pmFramework;         // ESP-IDF PM (locks) instead of software DFS
+    bool lightSleep;          // automatic light sleep configured
+    bool modemSleep;          // Wi-Fi power save on
+    uint16_t minMhz;
+    uint16_t maxMhz;
+    uint8_t loadPct;          // loop task busy share over the last second
+    uint8_t loadAvgPct;       // EWMA, alpha = 1/8
+    uint8_t loadPeakPct;
+    uint8_t maxClockPct;      // share of the last second at maxMhz
+    float estMa;              // estimated supply current
+    uint32_t freqSwitches;    // software DFS only
+    uint32_t samples;
+};
+
+extern PowerStatus powerStatus;
+
+// Applies a profile; maxMhz is the configured CPU clock. Safe to call again at run time.
+void power_apply(PowerProfile profile, uint16_t maxMhz);
+// Once per second from loop(): load, software DFS and the current estimate.
+void power_sample(uint32_t nowMs, bool streaming);
+
+const char *power_profileName(uint8_t profile);
+bool power_profileFromName(const String &name, PowerProfile &out);
+
+// Pins the CPU at maxMhz until released, e.g. while the self-benchmark runs so its cycle counts
+// all convert at one clock. Holds a CPU_FREQ_MAX lock with the PM framework; with software DFS
+// it switches up and keeps power_sample() from switching down.
+void power_holdMax(bool hold);
+
+// Hot path, called from the loop task only.
+void power_busy();
+void power_idle();
+// Between loop() iterations: lets the idle task run (and the PM framework clock down or light-sleep)
+// when nothing is streaming; a no-op in the performance profile.
+void power_yield(bool streaming);
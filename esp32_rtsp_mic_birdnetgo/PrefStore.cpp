@@ -0,0 +1,170 @@
+#include "PrefStore.h"
+#include <string.h>
+
+PrefStoreStats prefStoreStats = {};
+
+struct PrefShadow {
+    const char *key;          // string literal owned by the caller
+    uint32_t bits;            // value bits, or FNV-1a hash of a string
+    uint16_t len;             // string length + 1 (0 for numbers)
+    bool valid;
+};
+
+static PrefShadow prefShadow[PREF_STORE_MAX_KEYS];
+static uint8_t prefShadowCount = 0;
+static Preferences *prefFlushTarget = nullptr;
+static bool prefPriming = false;
+static uint32_t prefFirstDirtyMs = 0;
+static uint32_t prefLastDirtyMs = 0;
+static uint32_t prefFlushStartUs = 0;
+static uint16_t prefFlushKeys = 0;
+
+void prefstore_primeBegin() {
+    prefPriming = true;
+}
+
+void prefstore_primeEnd() {
+    prefPriming = false;
+}
+
+void prefstore_invalidate() {
+    for (uint8_t i = 0; i < prefShadowCount; i++) prefShadow[i].valid = false;
+}
+
+void prefstore_markDirty(uint32_t nowMs) {
+    PrefStoreStats &s = prefStoreStats;
+    s.marks++;
+    if (s.pending) {
+        s.coalesced++;
+    } else {
+        s.pending = true;
+        prefFirstDirtyMs = nowMs;
+    }
+    prefLastDirtyMs = nowMs;
+}
+
+bool prefstore_dirty() {
+    return prefStoreStats.pending;
+}
+
+bool prefstore_due(uint32_t nowMs) {
+    if (!prefStoreStats.pending) return false;
+    return (nowMs - prefLastDirtyMs) >= PREF_STORE_QUIET_MS ||
+           (nowMs - prefFirstDirtyMs) >= PREF_STORE_MAX_DELAY_MS;
+}
+
+void prefstore_flushBegin(Preferences &prefs) {
+    prefFlushTarget = &prefs;
+    prefFlushKeys = 0;
+    prefFlushStartUs = micros();
+}
+
+void prefstore_flushEnd(uint32_t nowMs) {
+    PrefStoreStats &s = prefStoreStats;
+    uint32_t us = micros() - prefFlushStartUs;
+    s.flushes++;
+    s.lastKeys = prefFlushKeys;
+    s.lastFlushMs = nowMs;
+    s.lastFlushUs = us;
+    if (us > s.maxFlushUs) s.maxFlushUs = us;
+    if (prefFlushTarget) s.freeEntries = (uint32_t)prefFlushTarget->freeEntries();
+    s.pending = false;
+    prefFlushTarget = nullptr;
+}
+
+static PrefShadow *prefShadowFor(const char *key) {
+    for (uint8_t i = 0; i < prefShadowCount; i++) {
+        if (prefShadow[i].key == key || strcmp(prefShadow[i].key, key) == 0) return &prefShadow[i];
+    }
+    if (prefShadowCount >= PREF_STORE_MAX_KEYS) return nullptr;   // untracked: always written
+    PrefShadow &e = prefShadow[prefShadowCount++];
+    e.key = key;
+    e.valid = false;
+    return &e;
+}
+
+static uint32_t prefHash(const String &v) {
+    uint32_t h = 2166136261UL;
+    for (size_t i = 0; i < v.length(); i++) {
+        h ^= (uint8_t)v[i];
+        h *= 16777619UL;
+    }
+    return h;
+}
+
+// True if the key has to be written; false if it matches the persisted value (or while priming).
+static bool prefChanged(const char *key, uint32_t bits, uint16_t len, PrefShadow *&entry) {
+    entry = prefShadowFor(key);
+    if (entry && entry->valid && entry->bits == bits && entry->len == len) {
+        if (!prefPriming) prefStoreStats.keysSkipped++;
+        return false;
+    }
+    if (prefPriming) {
+        if (entry) {
+            entry->bits = bits;
+            entry->len = len;
+            entry->valid = true;
+        }
+        return false;
+    }
+    return prefFlushTarget != nullptr;
+}
+
+static void prefWritten(PrefShadow *entry, size_t written, uint32_t bits, uint16_t len) {
+    if (written == 0) {
+        prefStoreStats.writeErrors++;
+        if (entry) entry->valid = false;
+        return;
+    }
+    prefStoreStats.keysWritten++;
+    prefFlushKeys++;
+    if (entry) {
+        entry->bits = bits;
+        entry->len = len;
+        entry->valid = true;
+    }
+}
+
+void prefstore_putBool(const char *key, bool v) {
+    PrefShadow *e;
+    uint32_t bits = v ? 1 : 0;
+    if (prefChanged(key, bits, 0, e)) prefWritten(e, prefFlushTarget->putBool(key, v), bits, 0);
+}
+
+void prefstore_putUChar(const char *key, uint8_t v) {
+    PrefShadow *e;
+    if (prefChanged(key, v, 0, e)) prefWritten(e, prefFlushTarget->putUChar(key, v), v, 0);
+}
+
+void prefstore_putUShort(const char *key, uint16_t v) {
+    PrefShadow *e;
+    if (prefChanged(key, v, 0, e)) prefWritten(e, prefFlushTarget->putUShort(key, v), v, 0);
+}
+
+void prefstore_putUInt(const char *key, uint32_t v) {
+    PrefShadow *e;
+    if (prefChanged(key, v, 0, e)) prefWritten(e, prefFlushTarget->putUInt(key, v), v, 0);
+}
+
+void prefstore_putInt(const char *key, int32_t v) {
+    PrefShadow *e;
+    uint32_t bits = (uint32_t)v;
+    if (prefChanged(key, bits, 0, e)) prefWritten(e, prefFlushTarget->putInt(key, v), bits, 0);
+}
+
+void prefstore_putFloat(const char *key, float v) {
+    PrefShadow *e;
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    if (prefChanged(key, bits, 0, e)) prefWritten(e, prefFlushTarget->putFloat(key, v), bits, 0);
+}
+
+void prefstore_putString(const char *key, const String &v) {
+    PrefShadow *e;
+    uint32_t bits = prefHash(v);
+    uint16_t len = (uint16_t)(v.length() + 1);   // +1: an empty string still differs from "no value"
+    if (prefChanged(key, bits, len, e)) {
+        size_t n = prefFlushTarget->putString(key, v);
+        prefWritten(e, (n || v.length() == 0) ? len : 0, bits, len);   // putString returns strlen()
+    }
+}
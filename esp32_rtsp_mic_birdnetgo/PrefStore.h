@@ -0,0 +1,64 @@
+#pragma once
+#include <Arduino.h>
+#include <Preferences.h>
+
+// Debounced settings persistence (ESP32 RTSP Mic for BirdNET-Go)
+//
+// Settings changes only mark the store dirty; a loop() job writes them once the UI has been
+// quiet for PREF_STORE_QUIET_MS (or at the latest PREF_STORE_MAX_DELAY_MS after the first
+// change), so a slider drag or a batch of /api/set calls ends in one flush.
+//
+// A flush still visits every setting through the prefstore_put*() calls, but each one is
+// compared with a shadow of the last value persisted under that key and only differing keys
+// reach NVS. Numbers are kept bit-exact, strings as an FNV-1a hash plus length, so secrets
+// such as the MQTT password are not copied again into RAM.
+
+#ifndef PREF_STORE_MAX_KEYS
+#define PREF_STORE_MAX_KEYS 56
+#endif
+#ifndef PREF_STORE_QUIET_MS
+#define PREF_STORE_QUIET_MS 2000UL
+#endif
+#ifndef PREF_STORE_MAX_DELAY_MS
+#define PREF_STORE_MAX_DELAY_MS 10000UL
+#endif
+
+struct PrefStoreStats {
+    uint32_t marks;           // settings changes reported
+    uint32_t coalesced;       // changes that joined an already pending flush
+    uint32_t flushes;
+    uint32_t keysWritten;     // NVS writes since boot
+    uint32_t keysSkipped;     // values equal to the persisted one
+    uint32_t writeErrors;
+    uint16_t lastKeys;        // written by the last flush
+    uint32_t lastFlushMs;     // uptime of the last flush
+    uint32_t lastFlushUs;     // duration of the last flush
+    uint32_t maxFlushUs;
+    uint32_t freeEntries;     // NVS entries left after the last flush
+    bool pending;
+};
+
+extern PrefStoreStats prefStoreStats;
+
+// Priming: the put calls of a flush made right after loading only record the shadow.
+void prefstore_primeBegin();
+void prefstore_primeEnd();
+// Forget the shadow (after Preferences::clear()): the next flush writes every key.
+void prefstore_invalidate();
+
+void prefstore_markDirty(uint32_t nowMs);
+bool prefstore_dirty();
+bool prefstore_due(uint32_t nowMs);
+
+// Wrap the put calls of one flush. The caller opens the namespace before flushBegin() and
+// closes it after flushEnd().
+void prefstore_flushBegin(Preferences &prefs);
+void prefstore_flushEnd(uint32_t nowMs);
+
+void prefstore_putBool(const char *key, bool v);
+void prefstore_putUChar(const char *key, uint8_t v);
+void prefstore_putUShort(const char *key, uint16_t v);
+void prefstore_putUInt(const char *key, uint32_t v);
+void prefstore_putInt(const char *key, int32_t v);
+void prefstore_putFloat(const char *key, float v);
+void prefstore_putString(const char *key, const String &v);
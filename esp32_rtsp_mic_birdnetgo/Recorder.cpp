@@ -0,0 +1,643 @@
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include "Recorder.h"
+#include "AudioArena.h"
+
+// Store-and-forward recorder (ESP32 RTSP Mic for BirdNET-Go) – see Recorder.h for the format.
+
+#ifdef RECORDER_SD_CS_PIN
+#include <SD.h>
+#define REC_FS SD
+#else
+#include <LittleFS.h>
+#define REC_FS LittleFS
+#endif
+
+static const char *REC_DIR = "/rec";
+static const char *REC_BENCH_PATH = "/rec/bench.tmp";
+static const uint32_t REC_TASK_STACK = 4096;
+static const UBaseType_t REC_TASK_PRIO = 1;          // same as loopTask; it sleeps until notified
+static const uint32_t REC_FREE_CHECK_PAGES = 16;     // re-measure free space every N pages
+
+struct RecPage {
+    uint8_t *data;            // REC_PAGE_BYTES in the audio arena (ARENA_REC_PAGES)
+    uint32_t bytes;           // whole blocks
+    uint32_t samples;         // real samples (the last block of a segment may be padded)
+    bool start;               // first page of a segment
+    uint32_t rate;
+    RecSegmentInfo info;
+};
+
+// Feed side (loop task): encodes into recPages[recActive]; a full page becomes recPending
+// and is written by the recorder task while the other page keeps filling.
+static RecPage recPages[2] = {{audioarena_region(ARENA_REC_PAGES)},
+                               {audioarena_region(ARENA_REC_PAGES) + REC_PAGE_BYTES}};
+static int recActive = 0;
+static int recPending = -1;
+static uint32_t recCloseSeq = 0;     // segment to close once its pages are written
+static portMUX_TYPE recMux = portMUX_INITIALIZER_UNLOCKED;
+static RecorderConfig recCfg = {false, REC_DEFAULT_SEGMENT_S, REC_DEFAULT_QUOTA_KB, 0, 1};
+static RecAdpcmEncoder recEnc;
+static bool recSegOpen = false;
+static uint32_t recSegSeq = 0;
+static uint32_t recSegRate = 0;
+static uint32_t recSegSamples = 0;
+static uint32_t recSegTarget = 0;
+static uint32_t recNextSeq = 1;
+static bool recCarryStart = false;   // a dropped page started a segment: the next one does
+static int32_t recDecAcc = 0;
+static uint8_t recDecN = 0;
+
+// Writer side (guarded by recFsMutex)
+static SemaphoreHandle_t recFsMutex = nullptr;
+static TaskHandle_t recTask = nullptr;
+static bool recMounted = false;
+static File recFile;
+static bool recFileOpen = false;
+static uint32_t recFileSeq = 0;
+static uint32_t recFileRate = 0;
+static RecSegmentInfo recFileInfo = {};
+static uint32_t recFileData = 0;
+static uint32_t recFileSamples = 0;
+static uint32_t recSyncPages = 0;
+static uint32_t recFreeCheck = 0;
+static uint64_t recFsFree = 0;
+static volatile bool recBenchReq = false;
+static RecorderStats recStats = {};
+
+static void segPath(uint32_t seq, char *out, size_t cap) {
+    snprintf(out, cap, "%s/%08lu.wav", REC_DIR, (unsigned long)seq);
+}
+
+static bool parseSegName(const char *name, uint32_t &seq) {
+    const char *base = strrchr(name, '/');
+    base = base ? base + 1 : name;
+    if (strlen(base) != 12 || strcmp(base + 8, ".wav") != 0) return false;
+    uint32_t v = 0;
+    for (int i = 0; i < 8; i++) {
+        if (base[i] < '0' || base[i] > '9') return false;
+        v = v * 10 + (uint32_t)(base[i] - '0');
+    }
+    seq = v;
+    return v > 0;
+}
+
+static bool readHeader(uint32_t seq, RecSegmentHeader &h, uint32_t &fileSize) {
+    char path[24];
+    segPath(seq, path, sizeof(path));
+    File f = REC_FS.open(path, "r");
+    if (!f) return false;
+    uint8_t buf[REC_HEADER_BYTES];
+    fileSize = (uint32_t)f.size();
+    bool ok = f.read(buf, sizeof(buf)) == sizeof(buf) && rec_parseHeader(buf, h);
+    f.close();
+    return ok;
+}
+
+static void measureFree() {
+    uint64_t total = REC_FS.totalBytes();
+    uint64_t used = REC_FS.usedBytes();
+    recStats.fsTotal = total;
+    recStats.fsUsed = used;
+    recFsFree = total > used ? total - used : 0;
+    recFreeCheck = 0;
+}
+
+// ---- Writer side ----
+
+static void removeSegmentLocked(uint32_t seq) {
+    char path[24];
+    segPath(seq, path, sizeof(path));
+    File f = REC_FS.open(path, "r");
+    if (!f) return;
+    uint32_t size = (uint32_t)f.size();
+    f.close();
+    if (!REC_FS.remove(path)) return;
+    portENTER_CRITICAL(&recMux);
+    recStats.bytes = recStats.bytes > size ? recStats.bytes - size : 0;
+    if (recStats.segments) recStats.segments--;
+    portEXIT_CRITICAL(&recMux);
+    recFsFree += size;
+    if (seq == recStats.oldestSeq) {
+        // Manual deletes can leave gaps: move to the next segment that exists.
+        uint32_t s = seq + 1;
+        while (s <= recStats.newestSeq) {
+            segPath(s, path, sizeof(path));
+            if (REC_FS.exists(path)) break;
+            s++;
+        }
+        recStats.oldestSeq = recStats.segments ? s : 0;
+    }
+}
+
+static bool overBudget() {
+    return recStats.bytes > (uint64_t)recCfg.quotaKB * 1024ULL || recFsFree < REC_MIN_FREE_BYTES + REC_PAGE_BYTES;
+}
+
+// Deletes the oldest closed segments while over the quota / free-space floor, or (newEpoch
+// given) older than keepHours. Never touches the segment being written.
+static void enforceRetentionLocked(uint32_t newEpoch) {
+    while (recStats.segments > 0 && recStats.oldestSeq != 0 &&
+           !(recFileOpen && recStats.oldestSeq == recFileSeq)) {
+        bool drop = overBudget();
+        if (!drop && newEpoch && recCfg.keepHours) {
+            RecSegmentHeader h;
+            uint32_t size;
+            if (readHeader(recStats.oldestSeq, h, size) && h.info.startEpoch &&
+                newEpoch - h.info.startEpoch > (uint32_t)recCfg.keepHours * 3600UL) {
+                drop = true;
+            }
+        }
+        if (!drop) break;
+        removeSegmentLocked(recStats.oldestSeq);
+        recStats.segmentsDeleted++;
+    }
+    recStats.full = overBudget();
+}
+
+static void closeSegmentLocked() {
+    if (!recFileOpen) return;
+    if (recFileData > 0) {
+        uint8_t hdr[REC_HEADER_BYTES];
+        rec_buildHeader(hdr, recFileRate, recFileInfo, recFileData, recFileSamples);
+        if (!recFile.seek(0) || recFile.write(hdr, sizeof(hdr)) != sizeof(hdr)) recStats.writeErrors++;
+    }
+    recFile.close();
+    recFileOpen = false;
+    portENTER_CRITICAL(&recMux);
+    recStats.recording = false;
+    portEXIT_CRITICAL(&recMux);
+    if (recFileData == 0) removeSegmentLocked(recFileSeq);   // nothing made it to flash
+}
+
+static bool openSegmentLocked(const RecSegmentInfo &info, uint32_t rate) {
+    measureFree();
+    enforceRetentionLocked(info.startEpoch);
+    if (recStats.full) return false;
+    char path[24];
+    segPath(info.seq, path, sizeof(path));
+    recFile = REC_FS.open(path, "w");
+    if (!recFile) {
+        recStats.writeErrors++;
+        return false;
+    }
+    uint8_t hdr[REC_HEADER_BYTES];
+    rec_buildHeader(hdr, rate, info, 0, 0);
+    if (recFile.write(hdr, sizeof(hdr)) != sizeof(hdr)) {
+        recStats.writeErrors++;
+        recFile.close();
+        REC_FS.remove(path);
+        return false;
+    }
+    recFileOpen = true;
+    recFileSeq = info.seq;
+    recFileRate = rate;
+    recFileInfo = info;
+    recFileData = 0;
+    recFileSamples = 0;
+    recSyncPages = 0;
+    recFsFree = recFsFree > REC_HEADER_BYTES ? recFsFree - REC_HEADER_BYTES : 0;
+    portENTER_CRITICAL(&recMux);
+    recStats.recording = true;
+    recStats.sampleRate = rate;
+    recStats.segments++;
+    recStats.bytes += REC_HEADER_BYTES;
+    recStats.newestSeq = info.seq;
+    if (recStats.oldestSeq == 0) recStats.oldestSeq = info.seq;
+    portEXIT_CRITICAL(&recMux);
+    return true;
+}
+
+static void writePageLocked(const RecPage &p) {
+    if (p.start) {
+        closeSegmentLocked();
+        openSegmentLocked(p.info, p.rate);
+    }
+    if (!recFileOpen || p.bytes == 0) {
+        if (p.bytes) recStats.pagesDropped++;
+        return;
+    }
+    if (++recFreeCheck >= REC_FREE_CHECK_PAGES) measureFree();
+    if (overBudget()) enforceRetentionLocked(0);
+    if (recStats.full) {
+        recStats.pagesDropped++;
+        return;
+    }
+    uint32_t t0 = micros();
+    size_t w = recFile.write(p.data, p.bytes);
+    if (w == p.bytes && ++recSyncPages >= REC_SYNC_PAGES) {
+        recFile.flush();      // LittleFS commit: bounds what a reset can lose
+        recSyncPages = 0;
+    }
+    uint32_t us = micros() - t0;
+    if (w != p.bytes) {
+        recStats.writeErrors++;
+        closeSegmentLocked();
+        return;
+    }
+    recFileData += p.bytes;
+    recFileSamples += p.samples;
+    recFsFree = recFsFree > p.bytes ? recFsFree - p.bytes : 0;
+    portENTER_CRITICAL(&recMux);
+    recStats.bytes += p.bytes;
+    recStats.pagesWritten++;
+    recStats.writeLastUs = us;
+    if (us > recStats.writeMaxUs) recStats.writeMaxUs = us;
+    portEXIT_CRITICAL(&recMux);
+}
+
+// Writes and reads back `kb` KB in page-sized requests; the recorder is paused meanwhile.
+// The pending page is written before this runs and recorder_feed() stays out during the bench,
+// so the active page is free to use as the buffer.
+static void runBenchLocked() {
+    const uint32_t kb = recStats.benchKB;
+    const char *err = nullptr;
+    uint32_t writeUs = 0, readUs = 0, maxUs = 0;
+    uint32_t pages = (kb * 1024UL + REC_PAGE_BYTES - 1) / REC_PAGE_BYTES;
+    portENTER_CRITICAL(&recMux);
+    uint8_t *buf = recPages[recActive].data;
+    portEXIT_CRITICAL(&recMux);
+    measureFree();
+    if (recFsFree < (uint64_t)pages * REC_PAGE_BYTES + REC_MIN_FREE_BYTES) {
+        err = "no_space";
+    } else {
+        for (uint32_t i = 0; i < REC_PAGE_BYTES; i++) buf[i] = (uint8_t)(i * 31 + 7);
+        File f = REC_FS.open(REC_BENCH_PATH, "w");
+        if (!f) err = "open_failed";
+        uint32_t t0 = micros();
+        for (uint32_t i = 0; !err && i < pages; i++) {
+            uint32_t w0 = micros();
+            if (f.write(buf, REC_PAGE_BYTES) != REC_PAGE_BYTES) err = "write_failed";
+            uint32_t dt = micros() - w0;
+            if (dt > maxUs) maxUs = dt;
+        }
+        if (f) {
+            f.flush();
+            f.close();
+        }
+        writeUs = micros() - t0;
+        if (!err) {
+            f = REC_FS.open(REC_BENCH_PATH, "r");
+            t0 = micros();
+            for (uint32_t i = 0; f && i < pages; i++) {
+                if (f.read(buf, REC_PAGE_BYTES) != REC_PAGE_BYTES) {
+                    err = "read_failed";
+                    break;
+                }
+            }
+            readUs = micros() - t0;
+            if (!f) err = "open_failed";
+            else f.close();
+        }
+        REC_FS.remove(REC_BENCH_PATH);
+    }
+    uint32_t bytes = pages * REC_PAGE_BYTES;
+    portENTER_CRITICAL(&recMux);
+    recStats.benchError = err;
+    recStats.benchState = err ? REC_BENCH_FAILED : REC_BENCH_DONE;
+    recStats.benchWriteKBps = writeUs ? (uint32_t)((uint64_t)bytes * 1000000ULL / 1024ULL / writeUs) : 0;
+    recStats.benchReadKBps = readUs ? (uint32_t)((uint64_t)bytes * 1000000ULL / 1024ULL / readUs) : 0;
+    recStats.benchMaxWriteUs = maxUs;
+    recStats.benchAvgWriteUs = pages ? writeUs / pages : 0;
+    portEXIT_CRITICAL(&recMux);
+}
+
+static void recorderTask(void *) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (xSemaphoreTake(recFsMutex, portMAX_DELAY) != pdTRUE) continue;
+        portENTER_CRITICAL(&recMux);
+        int idx = recPending;
+        portEXIT_CRITICAL(&recMux);
+        if (idx >= 0) {
+            writePageLocked(recPages[idx]);
+            portENTER_CRITICAL(&recMux);
+            recPending = -1;
+            portEXIT_CRITICAL(&recMux);
+        }
+        portENTER_CRITICAL(&recMux);
+        uint32_t closeSeq = recCloseSeq;
+        recCloseSeq = 0;
+        portEXIT_CRITICAL(&recMux);
+        if (closeSeq && recFileOpen && recFileSeq == closeSeq) closeSegmentLocked();
+        if (recBenchReq) {
+            recBenchReq = false;
+            runBenchLocked();
+        }
+        xSemaphoreGive(recFsMutex);
+    }
+}
+
+// Boot scan: count segments, repair the ones a reset left unclosed, drop unreadable ones.
+static void scanSegments() {
+    REC_FS.remove(REC_BENCH_PATH);
+    File dir = REC_FS.open(REC_DIR);
+    if (!dir || !dir.isDirectory()) return;
+    for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+        uint32_t seq;
+        if (f.isDirectory() || !parseSegName(f.name(), seq)) continue;
+        uint32_t size = (uint32_t)f.size();
+        uint8_t hdr[REC_HEADER_BYTES];
+        RecSegmentHeader h;
+        bool ok = f.read(hdr, sizeof(hdr)) == sizeof(hdr) && rec_parseHeader(hdr, h);
+        f.close();
+        char path[24];
+        segPath(seq, path, sizeof(path));
+        uint32_t whole = rec_wholeBlockBytes(size);
+        if (!ok || (h.dataBytes == 0 && whole == 0)) {
+            REC_FS.remove(path);
+            recStats.segmentsDeleted++;
+            continue;
+        }
+        if (h.dataBytes == 0) {
+            rec_buildHeader(hdr, h.sampleRate, h.info, whole, whole / REC_ADPCM_BLOCK_BYTES * REC_SAMPLES_PER_BLOCK);
+            File w = REC_FS.open(path, "r+");
+            if (w && w.write(hdr, sizeof(hdr)) == sizeof(hdr)) recStats.segmentsRepaired++;
+            else recStats.writeErrors++;
+            if (w) w.close();
+        }
+        recStats.segments++;
+        recStats.bytes += size;
+        if (recStats.oldestSeq == 0 || seq < recStats.oldestSeq) recStats.oldestSeq = seq;
+        if (seq > recStats.newestSeq) recStats.newestSeq = seq;
+    }
+    recNextSeq = recStats.newestSeq + 1;
+}
+
+bool recorder_begin() {
+    if (recMounted) return true;
+#ifdef RECORDER_SD_CS_PIN
+    if (!SD.begin(RECORDER_SD_CS_PIN)) return false;
+    recStats.sdCard = true;
+#else
+    if (!LittleFS.begin(true)) return false;   // already mounted by the log journal
+#endif
+    if (!REC_FS.exists(REC_DIR)) REC_FS.mkdir(REC_DIR);
+    scanSegments();
+    measureFree();
+
+    recFsMutex = xSemaphoreCreateMutex();
+    if (!recFsMutex) return false;
+    if (xTaskCreate(recorderTask, "recorder", REC_TASK_STACK, nullptr, REC_TASK_PRIO, &recTask) != pdPASS) {
+        return false;
+    }
+    recMounted = true;
+    recStats.mounted = true;
+    return true;
+}
+
+// ---- Feed side ----
+
+static void resetPage(RecPage &p) {
+    p.bytes = 0;
+    p.samples = 0;
+    p.start = false;
+}
+
+static void submitPage() {
+    RecPage &p = recPages[recActive];
+    bool kick = false;
+    portENTER_CRITICAL(&recMux);
+    if (recPending >= 0) {
+        // Writer still busy with the other page: drop rather than block the audio path.
+        recStats.pagesDropped++;
+        if (p.start) recCarryStart = true;
+    } else {
+        recPending = recActive;
+        recActive ^= 1;
+        kick = true;
+    }
+    portEXIT_CRITICAL(&recMux);
+    RecPage &next = recPages[recActive];
+    RecSegmentInfo info = p.info;
+    uint32_t rate = p.rate;
+    resetPage(next);
+    next.info = info;
+    next.rate = rate;
+    if (recCarryStart) {
+        next.start = true;
+        recCarryStart = false;
+    }
+    if (kick && recTask) xTaskNotifyGive(recTask);
+}
+
+static void startSegment(uint32_t rate, uint32_t sourceRate, uint32_t epoch, uint32_t nowMs) {
+    RecPage &p = recPages[recActive];
+    resetPage(p);
+    p.start = true;
+    p.rate = rate;
+    p.info.seq = recNextSeq++;
+    p.info.startEpoch = epoch;
+    p.info.startUptimeS = nowMs / 1000;
+    p.info.sourceRate = sourceRate;
+    recEnc.reset();
+    recSegOpen = true;
+    recSegSeq = p.info.seq;
+    recSegRate = rate;
+    recSegSamples = 0;
+    recSegTarget = (uint32_t)recCfg.segmentSec * rate;
+    recDecAcc = 0;
+    recDecN = 0;
+}
+
+// Pads the last block, hands over the partial page and asks the writer to close the segment.
+static void endSegment() {
+    if (!recSegOpen) return;
+    RecPage &p = recPages[recActive];
+    if (recEnc.pos > 0) {
+        int16_t pad = (int16_t)recEnc.predictor;
+        while (!recEnc.put(pad, p.data + p.bytes)) {}
+        p.bytes += REC_ADPCM_BLOCK_BYTES;
+    }
+    if (p.bytes > 0) submitPage();
+    portENTER_CRITICAL(&recMux);
+    recCloseSeq = recSegSeq;
+    portEXIT_CRITICAL(&recMux);
+    if (recTask) xTaskNotifyGive(recTask);
+    recSegOpen = false;
+}
+
+void recorder_configure(const RecorderConfig &cfg) {
+    bool wasEnabled = recCfg.enabled;
+    recCfg = cfg;
+    if (recCfg.decimate < 1) recCfg.decimate = 1;
+    if (recCfg.segmentSec == 0) recCfg.segmentSec = REC_DEFAULT_SEGMENT_S;
+    if (wasEnabled && !cfg.enabled) endSegment();
+}
+
+void recorder_feed(const int16_t *pcm, int samples, uint32_t sampleRate, uint32_t epoch, uint32_t nowMs) {
+    if (!recCfg.enabled || !recMounted || samples <= 0 || sampleRate == 0) return;
+    if (recStats.benchState == REC_BENCH_RUNNING) return;
+    const uint8_t dec = (recCfg.decimate > 1 && sampleRate % recCfg.decimate == 0) ? recCfg.decimate : 1;
+    const uint32_t rate = sampleRate / dec;
+    if (recSegOpen && rate != recSegRate) endSegment();
+    for (int i = 0; i < samples; i++) {
+        int32_t s = pcm[i];
+        if (dec > 1) {
+            recDecAcc += s;
+            if (++recDecN < dec) continue;
+            s = recDecAcc / dec;
+            recDecAcc = 0;
+            recDecN = 0;
+        }
+        if (!recSegOpen) startSegment(rate, sampleRate, epoch, nowMs);
+        RecPage &p = recPages[recActive];
+        p.samples++;
+        recSegSamples++;
+        if (!recEnc.put((int16_t)s, p.data + p.bytes)) continue;
+        p.bytes += REC_ADPCM_BLOCK_BYTES;
+        if (p.bytes < REC_PAGE_BYTES) continue;
+        submitPage();
+        if (recSegSamples >= recSegTarget) endSegment();   // on a page boundary: nothing to pad
+    }
+}
+
+void recorder_pause(uint32_t timeoutMs) {
+    endSegment();
+    uint32_t start = millis();
+    for (;;) {
+        portENTER_CRITICAL(&recMux);
+        bool busy = recPending >= 0 || recCloseSeq != 0;
+        portEXIT_CRITICAL(&recMux);
+        if (!busy || millis() - start >= timeoutMs) break;
+        vTaskDelay(1);
+    }
+}
+
+bool recorder_isRecording() {
+    return recSegOpen;
+}
+
+void recorder_getStats(RecorderStats &out) {
+    portENTER_CRITICAL(&recMux);
+    out = recStats;
+    portEXIT_CRITICAL(&recMux);
+    out.mounted = recMounted;
+}
+
+bool recorder_benchStart(uint32_t kb, const char *&error) {
+    if (!recMounted) { error = "not_mounted"; return false; }
+    if (recStats.benchState == REC_BENCH_RUNNING) { error = "busy"; return false; }
+    if (recSegOpen) { error = "recording"; return false; }
+    portENTER_CRITICAL(&recMux);
+    recStats.benchState = REC_BENCH_RUNNING;
+    recStats.benchError = nullptr;
+    recStats.benchKB = kb;
+    portEXIT_CRITICAL(&recMux);
+    recBenchReq = true;
+    xTaskNotifyGive(recTask);
+    return true;
+}
+
+// ---- Reading back ----
+
+uint32_t recorder_list(uint32_t fromSeq, uint32_t limit, RecorderListFn fn, void *ctx) {
+    if (!recMounted) return 0;
+    uint32_t count = 0;
+    if (xSemaphoreTake(recFsMutex, portMAX_DELAY) != pdTRUE) return 0;
+    uint32_t seq = fromSeq > recStats.oldestSeq ? fromSeq : recStats.oldestSeq;
+    const uint32_t newest = recStats.newestSeq;
+    xSemaphoreGive(recFsMutex);
+    for (; seq != 0 && seq <= newest && count < limit; seq++) {
+        // The mutex is held per file so the writer is never stalled by a long listing.
+        if (xSemaphoreTake(recFsMutex, portMAX_DELAY) != pdTRUE) break;
+        RecorderSegmentEntry e = {};
+        RecSegmentHeader h;
+        uint32_t size = 0;
+        bool ok = readHeader(seq, h, size);
+        if (ok) {
+            e.seq = seq;
+            e.fileBytes = size;
+            e.sampleRate = h.sampleRate;
+            e.samples = h.samples;
+            e.startEpoch = h.info.startEpoch;
+            if (recFileOpen && recFileSeq == seq) {
+                e.open = true;
+                e.samples = recFileSamples;
+            }
+        }
+        xSemaphoreGive(recFsMutex);
+        if (!ok) continue;
+        fn(e, ctx);
+        count++;
+    }
+    return count;
+}
+
+bool recorder_segmentSize(uint32_t seq, uint32_t &size) {
+    if (!recMounted) return false;
+    if (xSemaphoreTake(recFsMutex, portMAX_DELAY) != pdTRUE) return false;
+    bool ok = false;
+    if (!(recFileOpen && recFileSeq == seq)) {
+        char path[24];
+        segPath(seq, path, sizeof(path));
+        File f = REC_FS.open(path, "r");
+        if (f) {
+            size = (uint32_t)f.size();
+            f.close();
+            ok = true;
+        }
+    }
+    xSemaphoreGive(recFsMutex);
+    return ok;
+}
+
+size_t recorder_read(uint32_t seq, size_t offset, size_t len, RecorderSink sink, void *ctx) {
+    if (!recMounted || len == 0) return 0;
+    uint8_t chunk[1024];
+    char path[24];
+    segPath(seq, path, sizeof(path));
+    size_t delivered = 0;
+    while (delivered < len) {
+        if (xSemaphoreTake(recFsMutex, portMAX_DELAY) != pdTRUE) break;
+        size_t n = 0;
+        if (!(recFileOpen && recFileSeq == seq)) {
+            File f = REC_FS.open(path, "r");
+            if (f && f.seek(offset + delivered)) {
+                size_t want = len - delivered < sizeof(chunk) ? len - delivered : sizeof(chunk);
+                n = f.read(chunk, want);
+            }
+            if (f) f.close();
+        }
+        xSemaphoreGive(recFsMutex);
+        if (n == 0) break;     // deleted underneath us, or end of file
+        if (!sink(chunk, n, ctx)) break;
+        delivered += n;
+    }
+    return delivered;
+}
+
+bool recorder_remove(uint32_t seq) {
+    if (!recMounted) return false;
+    if (xSemaphoreTake(recFsMutex, portMAX_DELAY) != pdTRUE) return false;
+    bool ok = false;
+    if (!(recFileOpen && recFileSeq == seq)) {
+        char path[24];
+        segPath(seq, path, sizeof(path));
+        ok = REC_FS.exists(path);
+        if (ok) removeSegmentLocked(seq);
+    }
+    xSemaphoreGive(recFsMutex);
+    return ok;
+}
+
+uint32_t recorder_removeAll() {
+    if (!recMounted) return 0;
+    uint32_t removed = 0;
+    if (xSemaphoreTake(recFsMutex, portMAX_DELAY) != pdTRUE) return 0;
+    const uint32_t newest = recStats.newestSeq;
+    for (uint32_t seq = recStats.oldestSeq; seq != 0 && seq <= newest && recStats.segments > 0; seq++) {
+        if (recFileOpen && recFileSeq == seq) continue;
+        char path[24];
+        segPath(seq, path, sizeof(path));
+        if (!REC_FS.exists(path)) continue;
+        removeSegmentLocked(seq);
+        removed++;
+    }
+    if (recStats.segments == 0) recStats.oldestSeq = 0;
+    else if (recFileOpen) recStats.oldestSeq = recFileSeq;
+    xSemaphoreGive(recFsMutex);
+    return removed;
+}
@@ -0,0 +1,284 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Store-and-forward recorder (ESP32 RTSP Mic for BirdNET-Go)
+//
+// While no RTSP client is streaming, the processed audio (HPF, filters, gain/AGC) is encoded
+// to IMA ADPCM (4 bits per sample) and written to rotating WAV segments under /rec on LittleFS,
+// or on an SPI SD card when built with RECORDER_SD_CS_PIN. Encoded pages are double-buffered
+// in RAM and written by a low-priority task, one page per write, so flash I/O never happens on
+// the audio path; a page that finds the writer still busy is dropped and counted.
+// Retention: the oldest segments are deleted first to keep /rec under the quota, the file
+// system's free space above REC_MIN_FREE_BYTES and, with keepHours and synced time, to drop
+// segments older than that.
+//
+// Segment format (plain C++, no Arduino types, so it can be checked on a host):
+//   file    = header[REC_HEADER_BYTES] + block*
+//   header  = RIFF/WAVE with fmt (format 0x0011 IMA ADPCM, mono, 4 bits, block align
+//             REC_ADPCM_BLOCK_BYTES, samples per block), fact (sample count), "emrc"
+//             (RecSegmentInfo), JUNK padding and the data chunk header. Padded to 512 bytes so
+//             blocks and page writes stay sector-aligned (SD) and whole pages (LittleFS).
+//   block   = predictor (int16 LE) + step index (uint8) + 0 + nibbles, low nibble first
+// The sizes are written when a segment is closed. A segment cut short by a reset has zeros
+// there and is repaired on the next boot (whole blocks kept, header rewritten).
+
+#ifndef REC_ADPCM_BLOCK_BYTES
+#define REC_ADPCM_BLOCK_BYTES 1024
+#endif
+#ifndef REC_PAGE_BLOCKS
+#define REC_PAGE_BLOCKS 4                  // page = one write = 4 KB
+#endif
+#ifndef REC_SYNC_PAGES
+#define REC_SYNC_PAGES 4                   // file sync (LittleFS commit) every N pages
+#endif
+#ifndef REC_MIN_FREE_BYTES
+#define REC_MIN_FREE_BYTES (96 * 1024)     // left for the log journal and settings
+#endif
+#ifndef REC_DEFAULT_SEGMENT_S
+#define REC_DEFAULT_SEGMENT_S 300
+#endif
+#ifndef REC_DEFAULT_QUOTA_KB
+#define REC_DEFAULT_QUOTA_KB 1024
+#endif
+#ifndef REC_BENCH_DEFAULT_KB
+#define REC_BENCH_DEFAULT_KB 256
+#endif
+
+static const uint32_t REC_HEADER_BYTES = 512;
+static const uint32_t REC_PAGE_BYTES = REC_ADPCM_BLOCK_BYTES * REC_PAGE_BLOCKS;
+static constexpr uint32_t REC_ARENA_BYTES = 2 * REC_ADPCM_BLOCK_BYTES * REC_PAGE_BLOCKS;   // ARENA_REC_PAGES
+static const uint32_t REC_SAMPLES_PER_BLOCK = (REC_ADPCM_BLOCK_BYTES - 4) * 2 + 1;
+static const uint16_t REC_WAVE_FORMAT_IMA_ADPCM = 0x0011;
+static_assert(REC_ADPCM_BLOCK_BYTES % 512 == 0, "ADPCM blocks must be whole sectors");
+
+// "emrc" chunk: where the segment came from
+struct RecSegmentInfo {
+    uint32_t seq;             // file name /rec/<seq, 8 digits>.wav
+    uint32_t startEpoch;      // UTC seconds, 0 if the clock was not synced
+    uint32_t startUptimeS;
+    uint32_t sourceRate;      // capture rate before decimation
+};
+static_assert(sizeof(RecSegmentInfo) == 16, "segment info must stay 16 bytes");
+
+struct RecSegmentHeader {
+    uint32_t sampleRate;
+    uint32_t dataBytes;       // whole blocks
+    uint32_t samples;         // fact
+    RecSegmentInfo info;
+};
+
+inline void rec_put16(uint8_t *p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+inline void rec_put32(uint8_t *p, uint32_t v) { rec_put16(p, (uint16_t)v); rec_put16(p + 2, (uint16_t)(v >> 16)); }
+inline uint16_t rec_get16(const uint8_t *p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+inline uint32_t rec_get32(const uint8_t *p) { return rec_get16(p) | ((uint32_t)rec_get16(p + 2) << 16); }
+
+// Chunk layout of the header (offsets into it)
+static const uint32_t REC_OFF_FMT = 12;
+static const uint32_t REC_OFF_FACT = REC_OFF_FMT + 8 + 20;
+static const uint32_t REC_OFF_INFO = REC_OFF_FACT + 8 + 4;
+static const uint32_t REC_OFF_JUNK = REC_OFF_INFO + 8 + sizeof(RecSegmentInfo);
+static const uint32_t REC_OFF_DATA = REC_HEADER_BYTES - 8;
+
+// samples: the true count (the last block may be padded); dataBytes: whole blocks.
+inline void rec_buildHeader(uint8_t *h, uint32_t sampleRate, const RecSegmentInfo &info, uint32_t dataBytes,
+                            uint32_t samples) {
+    memset(h, 0, REC_HEADER_BYTES);
+    memcpy(h, "RIFF", 4);
+    rec_put32(h + 4, dataBytes ? REC_HEADER_BYTES - 8 + dataBytes : 0);
+    memcpy(h + 8, "WAVE", 4);
+    uint8_t *f = h + REC_OFF_FMT;
+    memcpy(f, "fmt ", 4);
+    rec_put32(f + 4, 20);
+    rec_put16(f + 8, REC_WAVE_FORMAT_IMA_ADPCM);
+    rec_put16(f + 10, 1);
+    rec_put32(f + 12, sampleRate);
+    rec_put32(f + 16, (uint32_t)((uint64_t)sampleRate * REC_ADPCM_BLOCK_BYTES / REC_SAMPLES_PER_BLOCK));
+    rec_put16(f + 20, REC_ADPCM_BLOCK_BYTES);
+    rec_put16(f + 22, 4);
+    rec_put16(f + 24, 2);
+    rec_put16(f + 26, (uint16_t)REC_SAMPLES_PER_BLOCK);
+    uint8_t *c = h + REC_OFF_FACT;
+    memcpy(c, "fact", 4);
+    rec_put32(c + 4, 4);
+    rec_put32(c + 8, samples);
+    c = h + REC_OFF_INFO;
+    memcpy(c, "emrc", 4);
+    rec_put32(c + 4, sizeof(RecSegmentInfo));
+    rec_put32(c + 8, info.seq);
+    rec_put32(c + 12, info.startEpoch);
+    rec_put32(c + 16, info.startUptimeS);
+    rec_put32(c + 20, info.sourceRate);
+    c = h + REC_OFF_JUNK;
+    memcpy(c, "JUNK", 4);
+    rec_put32(c + 4, REC_OFF_DATA - REC_OFF_JUNK - 8);
+    c = h + REC_OFF_DATA;
+    memcpy(c, "data", 4);
+    rec_put32(c + 4, dataBytes);
+}
+
+// Accepts only headers this recorder wrote (fixed layout). An unclosed segment parses with
+// dataBytes == 0.
+inline bool rec_parseHeader(const uint8_t *h, RecSegmentHeader &out) {
+    const uint8_t *f = h + REC_OFF_FMT;
+    if (memcmp(h, "RIFF", 4) || memcmp(h + 8, "WAVE", 4) || memcmp(f, "fmt ", 4)) return false;
+    if (rec_get16(f + 8) != REC_WAVE_FORMAT_IMA_ADPCM || rec_get16(f + 10) != 1 ||
+        rec_get16(f + 20) != REC_ADPCM_BLOCK_BYTES || rec_get16(f + 26) != REC_SAMPLES_PER_BLOCK) {
+        return false;
+    }
+    if (memcmp(h + REC_OFF_FACT, "fact", 4) || memcmp(h + REC_OFF_INFO, "emrc", 4) ||
+        memcmp(h + REC_OFF_DATA, "data", 4)) {
+        return false;
+    }
+    out.sampleRate = rec_get32(f + 12);
+    out.samples = rec_get32(h + REC_OFF_FACT + 8);
+    const uint8_t *c = h + REC_OFF_INFO + 8;
+    out.info.seq = rec_get32(c);
+    out.info.startEpoch = rec_get32(c + 4);
+    out.info.startUptimeS = rec_get32(c + 8);
+    out.info.sourceRate = rec_get32(c + 12);
+    out.dataBytes = rec_get32(h + REC_OFF_DATA + 4);
+    return out.sampleRate > 0 && out.dataBytes % REC_ADPCM_BLOCK_BYTES == 0;
+}
+
+// Whole blocks in a file of this size (repair of an unclosed segment).
+inline uint32_t rec_wholeBlockBytes(uint32_t fileSize) {
+    if (fileSize <= REC_HEADER_BYTES) return 0;
+    return (fileSize - REC_HEADER_BYTES) / REC_ADPCM_BLOCK_BYTES * REC_ADPCM_BLOCK_BYTES;
+}
+
+inline const int16_t *rec_imaStepTable() {
+    static const int16_t t[89] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66,
+        73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+        449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+        2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+        9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+        32767};
+    return t;
+}
+
+inline const int8_t *rec_imaIndexTable() {
+    static const int8_t t[16] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+    return t;
+}
+
+// Streaming IMA ADPCM encoder: one sample at a time into a block buffer, so no PCM needs
+// to be held back. The step index carries over between blocks.
+struct RecAdpcmEncoder {
+    int32_t predictor;
+    int8_t index;
+    uint32_t pos;             // samples written into the current block
+
+    void reset() { predictor = 0; index = 0; pos = 0; }
+
+    // Returns true when the block is complete.
+    bool put(int16_t sample, uint8_t *block) {
+        if (pos == 0) {
+            predictor = sample;
+            rec_put16(block, (uint16_t)sample);
+            block[2] = (uint8_t)index;
+            block[3] = 0;
+            pos = 1;
+            return false;
+        }
+        const int16_t *steps = rec_imaStepTable();
+        int32_t step = steps[index];
+        int32_t diff = (int32_t)sample - predictor;
+        uint8_t nibble = 0;
+        if (diff < 0) { nibble = 8; diff = -diff; }
+        int32_t delta = step >> 3;
+        if (diff >= step) { nibble |= 4; diff -= step; delta += step; }
+        step >>= 1;
+        if (diff >= step) { nibble |= 2; diff -= step; delta += step; }
+        step >>= 1;
+        if (diff >= step) { nibble |= 1; delta += step; }
+        predictor += (nibble & 8) ? -delta : delta;
+        if (predictor > 32767) predictor = 32767;
+        if (predictor < -32768) predictor = -32768;
+        int idx = index + rec_imaIndexTable()[nibble];
+        index = (int8_t)(idx < 0 ? 0 : (idx > 88 ? 88 : idx));
+
+        uint8_t *b = block + 4 + (pos - 1) / 2;
+        if ((pos - 1) & 1) *b |= (uint8_t)(nibble << 4);
+        else *b = nibble;
+        if (++pos < REC_SAMPLES_PER_BLOCK) return false;
+        pos = 0;
+        return true;
+    }
+};
+
+// ---- Device side (Recorder.cpp) ----
+
+struct RecorderConfig {
+    bool enabled;
+    uint16_t segmentSec;
+    uint32_t quotaKB;
+    uint16_t keepHours;       // 0 = no age limit
+    uint8_t decimate;         // 1..4, boxcar average (a rate that does not divide stays at 1)
+};
+
+enum RecorderBenchState : uint8_t { REC_BENCH_IDLE, REC_BENCH_RUNNING, REC_BENCH_DONE, REC_BENCH_FAILED };
+
+struct RecorderStats {
+    bool mounted;
+    bool sdCard;
+    bool recording;           // a segment is open
+    bool full;                // nothing left to delete and still no space: pages are dropped
+    uint32_t sampleRate;      // of the open segment
+    uint32_t segments;
+    uint32_t oldestSeq;
+    uint32_t newestSeq;
+    uint64_t bytes;           // in /rec
+    uint64_t fsTotal;
+    uint64_t fsUsed;
+    uint32_t pagesWritten;
+    uint32_t pagesDropped;
+    uint32_t writeErrors;
+    uint32_t writeMaxUs;
+    uint32_t writeLastUs;
+    uint32_t segmentsDeleted;
+    uint32_t segmentsRepaired;
+    // Write-throughput benchmark
+    RecorderBenchState benchState;
+    const char *benchError;
+    uint32_t benchKB;
+    uint32_t benchWriteKBps;
+    uint32_t benchReadKBps;
+    uint32_t benchMaxWriteUs;
+    uint32_t benchAvgWriteUs;
+};
+
+struct RecorderSegmentEntry {
+    uint32_t seq;
+    uint32_t fileBytes;
+    uint32_t sampleRate;
+    uint32_t samples;
+    uint32_t startEpoch;
+    bool open;                // being written (not downloadable yet)
+};
+
+// Mount (LittleFS is already up from the log journal; SD is mounted here), repair unclosed
+// segments and start the writer task.
+bool recorder_begin();
+void recorder_configure(const RecorderConfig &cfg);
+// One block of processed 16-bit audio (loop task). Never blocks.
+void recorder_feed(const int16_t *pcm, int samples, uint32_t sampleRate, uint32_t epoch, uint32_t nowMs);
+// Ends the open segment (stream start, settings change, reset). Waits up to timeoutMs for the
+// writer to close it.
+void recorder_pause(uint32_t timeoutMs);
+bool recorder_isRecording();
+void recorder_getStats(RecorderStats &out);
+bool recorder_benchStart(uint32_t kb, const char *&error);
+
+// Oldest first, at most `limit` entries from sequence number `fromSeq` on; returns the count.
+typedef void (*RecorderListFn)(const RecorderSegmentEntry &e, void *ctx);
+uint32_t recorder_list(uint32_t fromSeq, uint32_t limit, RecorderListFn fn, void *ctx);
+// Size of a closed segment file; false if it does not exist or is still being written.
+bool recorder_segmentSize(uint32_t seq, uint32_t &size);
+typedef bool (*RecorderSink)(const uint8_t *data, size_t len, void *ctx);
+// Streams [offset, offset + len) of a closed segment to sink; returns bytes delivered.
+size_t recorder_read(uint32_t seq, size_t offset, size_t len, RecorderSink sink, void *ctx);
+bool recorder_remove(uint32_t seq);
+uint32_t recorder_removeAll();
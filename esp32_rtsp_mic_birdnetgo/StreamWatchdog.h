@@ -0,0 +1,216 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+// Real-time stream watchdog (ESP32 RTSP Mic for BirdNET-Go)
+//
+// Fed once per second with the cumulative packet and sample counters. Keeps a sliding
+// window of the last STREAM_WD_WINDOW_S one-second packet counts, EWMAs of packet and
+// sample rate, and detects two faults:
+//   stall     - no packet at all for stallSec seconds while streaming
+//   degraded  - packet-rate EWMA below minRate for degradeSec seconds
+// A fault climbs a ladder of responses, one step per escalateSec while it persists:
+// log -> reset DSP -> restart I2S -> reconnect Wi-Fi. Each action is followed by settleSec
+// seconds without judgement. recoverSec healthy seconds end the episode and credit the last
+// action with a recovery.
+//
+// Plain C++: tick() only decides and returns the action, the caller performs it, so the
+// logic can be driven on a host with synthetic counters.
+
+#ifndef STREAM_WD_WINDOW_S
+#define STREAM_WD_WINDOW_S 10
+#endif
+
+enum WatchdogAction : uint8_t {
+    WD_NONE,
+    WD_LOG,
+    WD_RESET_DSP,
+    WD_RESTART_I2S,
+    WD_RECONNECT_WIFI,
+    WD_ACTION_COUNT
+};
+
+enum WatchdogFault : uint8_t {
+    WD_FAULT_NONE,
+    WD_FAULT_STALL,
+    WD_FAULT_DEGRADED
+};
+
+struct WatchdogConfig {
+    uint32_t minRate;            // pkt/s
+    uint8_t stallSec = 3;
+    uint8_t degradeSec = 10;
+    uint8_t escalateSec = 5;
+    uint8_t settleSec = 5;
+    uint8_t recoverSec = 10;
+    uint8_t warmupSec = 3;       // after (re)start of streaming
+    bool autoRecovery = true;    // false: only WD_LOG
+};
+
+struct WatchdogStats {
+    uint32_t actions[WD_ACTION_COUNT];
+    uint32_t recoveries[WD_ACTION_COUNT];   // episode ended healthy after this as last action
+    uint32_t stalls;
+    uint32_t degradations;
+    uint32_t longestStallSec;
+    uint32_t lastActionMs;
+    uint8_t lastAction;
+};
+
+class StreamWatchdog {
+public:
+    void reset() {
+        WatchdogStats keep = stats_;
+        memset(this, 0, sizeof(*this));
+        stats_ = keep;
+    }
+
+    // Call once per second. expectedRate is the nominal pkt/s (sample rate / buffer size).
+    WatchdogAction tick(const WatchdogConfig &cfg, uint32_t nowMs, bool streaming,
+                        uint32_t packets, uint32_t samples, uint32_t expectedRate) {
+        if (!streaming) {
+            streaming_ = false;
+            fault_ = WD_FAULT_NONE;
+            level_ = 0;
+            return WD_NONE;
+        }
+        if (!streaming_) {
+            // New stream: seed the averages with the nominal rate so start-up is not a fault.
+            streaming_ = true;
+            warmup_ = cfg.warmupSec;
+            lastPackets_ = packets;
+            lastSamples_ = samples;
+            pktEwma_ = expectedRate << EWMA_SHIFT;
+            smpEwma_ = 0;
+            memset(window_, 0, sizeof(window_));
+            windowFill_ = 0;
+            stallSec_ = lowSec_ = healthySec_ = 0;
+            settle_ = escalateIn_ = 0;
+            return WD_NONE;
+        }
+
+        // The sketch zeroes its counters on PLAY and recovery; a smaller value restarts them.
+        uint32_t dp = packets >= lastPackets_ ? packets - lastPackets_ : packets;
+        uint32_t ds = samples >= lastSamples_ ? samples - lastSamples_ : samples;
+        lastPackets_ = packets;
+        lastSamples_ = samples;
+        window_[windowPos_] = (uint16_t)(dp > 0xFFFF ? 0xFFFF : dp);
+        windowPos_ = (uint8_t)((windowPos_ + 1) % STREAM_WD_WINDOW_S);
+        if (windowFill_ < STREAM_WD_WINDOW_S) windowFill_++;
+        // EWMA, alpha = 1/4, 4 fractional bits; restarts from the first second after a stall
+        if (stallSec_ > 0 && dp > 0) pktEwma_ = dp << EWMA_SHIFT;
+        else pktEwma_ = pktEwma_ - (pktEwma_ >> 2) + ((dp << EWMA_SHIFT) >> 2);
+        smpEwma_ = (smpEwma_ == 0) ? (ds << EWMA_SHIFT) : (smpEwma_ - (smpEwma_ >> 2) + ((ds << EWMA_SHIFT) >> 2));
+
+        if (warmup_ > 0) {
+            warmup_--;
+            return WD_NONE;
+        }
+
+        stallSec_ = (dp == 0) ? stallSec_ + 1 : 0;
+        lowSec_ = (dp > 0 && packetRate() < cfg.minRate) ? lowSec_ + 1 : 0;   // a stall is not "degraded"
+        if (stallSec_ > stats_.longestStallSec) stats_.longestStallSec = stallSec_;
+
+        WatchdogFault now = WD_FAULT_NONE;
+        if (stallSec_ >= cfg.stallSec) now = WD_FAULT_STALL;
+        else if (lowSec_ >= cfg.degradeSec) now = WD_FAULT_DEGRADED;
+
+        if (settle_ > 0) {
+            settle_--;
+            return WD_NONE;
+        }
+
+        if (now == WD_FAULT_NONE) {
+            if (fault_ != WD_FAULT_NONE && dp > 0 && ++healthySec_ >= cfg.recoverSec) {
+                stats_.recoveries[stats_.lastAction]++;
+                fault_ = WD_FAULT_NONE;
+                level_ = 0;
+            }
+            return WD_NONE;
+        }
+        healthySec_ = 0;
+
+        if (fault_ == WD_FAULT_NONE) {
+            fault_ = now;
+            if (now == WD_FAULT_STALL) stats_.stalls++;
+            else stats_.degradations++;
+            escalateIn_ = 0;
+        } else if (now == WD_FAULT_STALL && fault_ == WD_FAULT_DEGRADED) {
+            fault_ = now;   // got worse; keep the ladder position
+            stats_.stalls++;
+        }
+        if (escalateIn_ > 0) {
+            escalateIn_--;
+            return WD_NONE;
+        }
+
+        WatchdogAction a = (WatchdogAction)(level_ + 1);
+        if (a >= WD_ACTION_COUNT) a = WD_RECONNECT_WIFI;   // top of the ladder: repeat
+        if (!cfg.autoRecovery && a > WD_LOG) {
+            escalateIn_ = cfg.escalateSec;
+            return WD_NONE;
+        }
+        level_ = a;
+        escalateIn_ = cfg.escalateSec;
+        if (a > WD_LOG) settle_ = cfg.settleSec;
+        stats_.actions[a]++;
+        stats_.lastAction = a;
+        stats_.lastActionMs = nowMs;
+        return a;
+    }
+
+    // Rates in units of 1/16 pkt/s (or sample/s) for display with one decimal.
+    uint32_t packetRateX16() const { return pktEwma_; }
+    uint32_t sampleRateX16() const { return smpEwma_; }
+    uint32_t packetRate() const { return (pktEwma_ + (1u << (EWMA_SHIFT - 1))) >> EWMA_SHIFT; }
+    uint32_t sampleRate() const { return (smpEwma_ + (1u << (EWMA_SHIFT - 1))) >> EWMA_SHIFT; }
+    // Packets per second over the sliding window (x10 for one decimal).
+    uint32_t windowRateX10() const {
+        if (windowFill_ == 0) return 0;
+        uint32_t sum = 0;
+        for (uint8_t i = 0; i < STREAM_WD_WINDOW_S; i++) sum += window_[i];
+        return (sum * 10u) / windowFill_;
+    }
+    uint32_t windowMin() const {
+        uint32_t m = 0xFFFFFFFF;
+        for (uint8_t i = 0; i < windowFill_; i++) {
+            uint8_t idx = (uint8_t)((windowPos_ + STREAM_WD_WINDOW_S - 1 - i) % STREAM_WD_WINDOW_S);
+            if (window_[idx] < m) m = window_[idx];
+        }
+        return windowFill_ ? m : 0;
+    }
+    uint32_t stallSeconds() const { return stallSec_; }
+    WatchdogFault fault() const { return fault_; }
+    uint8_t level() const { return level_; }
+    const WatchdogStats &stats() const { return stats_; }
+    void clearStats() { memset(&stats_, 0, sizeof(stats_)); }
+
+    static const char *actionName(uint8_t a) {
+        static const char *const names[WD_ACTION_COUNT] = {"none", "log", "reset_dsp", "restart_i2s", "reconnect_wifi"};
+        return a < WD_ACTION_COUNT ? names[a] : "";
+    }
+    static const char *faultName(uint8_t f) {
+        return f == WD_FAULT_STALL ? "stall" : (f == WD_FAULT_DEGRADED ? "degraded" : "ok");
+    }
+
+private:
+    static const uint8_t EWMA_SHIFT = 4;
+
+    uint16_t window_[STREAM_WD_WINDOW_S];
+    uint8_t windowPos_;
+    uint8_t windowFill_;
+    uint32_t lastPackets_;
+    uint32_t lastSamples_;
+    uint32_t pktEwma_;
+    uint32_t smpEwma_;
+    uint32_t stallSec_;
+    uint32_t lowSec_;
+    uint32_t healthySec_;
+    uint8_t warmup_;
+    uint8_t settle_;
+    uint8_t escalateIn_;
+    uint8_t level_;
+    WatchdogFault fault_;
+    bool streaming_;
+    WatchdogStats stats_;
+};
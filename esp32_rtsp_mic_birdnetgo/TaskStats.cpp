@@ -0,0 +1,129 @@
+#include "TaskStats.h"
+#include <string.h>
+
+#ifndef portNUM_PROCESSORS
+#define portNUM_PROCESSORS 1
+#endif
+
+TaskStatsSnapshot taskStats = {};
+
+static TaskHandle_t taskStatsLoopTask = nullptr;
+static TaskStatsSample taskStatsRing[TASK_STATS_RING];
+static uint8_t taskStatsHead = 0;    // next write position
+static uint8_t taskStatsCount = 0;
+static uint32_t taskStatsLastMs = 0;
+
+#if TASK_STATS_AVAILABLE
+static TaskStatus_t taskStatsRaw[TASK_STATS_MAX_TASKS];
+// Run-time counters of the previous sample, matched by handle. 32-bit deltas stay correct
+// across a counter wrap as long as samples are less than ~71 min apart.
+static TaskHandle_t taskStatsPrevHandle[TASK_STATS_MAX_TASKS];
+static uint32_t taskStatsPrevRun[TASK_STATS_MAX_TASKS];
+static uint8_t taskStatsPrevCount = 0;
+static uint32_t taskStatsPrevTotal = 0;
+#endif
+
+void taskstats_begin() {
+    taskStatsLoopTask = xTaskGetCurrentTaskHandle();
+    taskstats_sample(millis());
+}
+
+static void taskStatsPush(uint32_t nowMs) {
+    TaskStatsSample &s = taskStatsRing[taskStatsHead];
+    s.uptimeS = nowMs / 1000UL;
+    s.idlePermille = taskStats.idlePermille;
+    s.loopPermille = taskStats.loopPermille;
+    taskStatsHead = (uint8_t)((taskStatsHead + 1) % TASK_STATS_RING);
+    if (taskStatsCount < TASK_STATS_RING) taskStatsCount++;
+}
+
+static void taskStatsSetName(char *dst, const char *src) {
+    strlcpy(dst, src ? src : "", TASK_STATS_NAME_LEN);
+}
+
+void taskstats_sample(uint32_t nowMs) {
+    TaskStatsSnapshot &t = taskStats;
+    t.windowMs = t.samples ? nowMs - taskStatsLastMs : nowMs;
+    taskStatsLastMs = nowMs;
+    t.samples++;
+
+#if TASK_STATS_AVAILABLE
+    t.totalTasks = (uint8_t)uxTaskGetNumberOfTasks();
+    uint32_t totalRun = 0;
+    UBaseType_t n = uxTaskGetSystemState(taskStatsRaw, TASK_STATS_MAX_TASKS, &totalRun);
+    if (n == 0) {
+        t.count = 0;   // more tasks than TASK_STATS_MAX_TASKS
+        return;
+    }
+    // The counters cover the time since boot on every core.
+    uint64_t denom = (uint64_t)(totalRun - taskStatsPrevTotal) * portNUM_PROCESSORS;
+    uint16_t idle = 0;
+    uint16_t loop = 0;
+    t.minStackFree = 0xFFFFFFFF;
+    t.count = 0;
+    for (UBaseType_t i = 0; i < n; i++) {
+        const TaskStatus_t &r = taskStatsRaw[i];
+        uint32_t prev = 0;
+        for (uint8_t k = 0; k < taskStatsPrevCount; k++) {
+            if (taskStatsPrevHandle[k] == r.xHandle) {
+                prev = taskStatsPrevRun[k];
+                break;
+            }
+        }
+        uint32_t run = (uint32_t)r.ulRunTimeCounter;
+        uint32_t permille = denom ? (uint32_t)(((uint64_t)(run - prev) * 1000ULL) / denom) : 0;
+        if (permille > 1000) permille = 1000;
+
+        TaskCpuInfo info;
+        taskStatsSetName(info.name, r.pcTaskName);
+        info.cpuPermille = (uint16_t)permille;
+        info.stackFreeMin = (uint32_t)r.usStackHighWaterMark;
+        info.priority = (uint8_t)r.uxCurrentPriority;
+        if (strncmp(info.name, "IDLE", 4) == 0) idle = (uint16_t)(idle + permille);
+        if (r.xHandle == taskStatsLoopTask) loop = (uint16_t)permille;
+        if (info.stackFreeMin < t.minStackFree) {
+            t.minStackFree = info.stackFreeMin;
+            taskStatsSetName(t.minStackTask, info.name);
+        }
+        // Insert sorted by CPU share, busiest first.
+        uint8_t pos = t.count;
+        while (pos > 0 && t.tasks[pos - 1].cpuPermille < info.cpuPermille) {
+            t.tasks[pos] = t.tasks[pos - 1];
+            pos--;
+        }
+        t.tasks[pos] = info;
+        t.count++;
+    }
+    t.idlePermille = idle > 1000 ? 1000 : idle;
+    t.loopPermille = loop;
+
+    for (UBaseType_t i = 0; i < n; i++) {
+        taskStatsPrevHandle[i] = taskStatsRaw[i].xHandle;
+        taskStatsPrevRun[i] = (uint32_t)taskStatsRaw[i].ulRunTimeCounter;
+    }
+    taskStatsPrevCount = (uint8_t)n;
+    taskStatsPrevTotal = totalRun;
+#else
+    // Only what is available everywhere: the loop task's own stack.
+    t.totalTasks = (uint8_t)uxTaskGetNumberOfTasks();
+    t.count = 1;
+    taskStatsSetName(t.tasks[0].name, pcTaskGetName(taskStatsLoopTask));
+    t.tasks[0].cpuPermille = 0;
+    t.tasks[0].stackFreeMin = (uint32_t)uxTaskGetStackHighWaterMark(taskStatsLoopTask);
+    t.tasks[0].priority = (uint8_t)uxTaskPriorityGet(taskStatsLoopTask);
+    t.minStackFree = t.tasks[0].stackFreeMin;
+    taskStatsSetName(t.minStackTask, t.tasks[0].name);
+#endif
+    if (t.samples > 1) taskStatsPush(nowMs);   // the first one (from begin) covers the boot
+}
+
+uint8_t taskstats_historyCount() {
+    return taskStatsCount;
+}
+
+bool taskstats_historyAt(uint8_t i, TaskStatsSample &out) {
+    if (i >= taskStatsCount) return false;
+    uint8_t first = (uint8_t)((taskStatsHead + TASK_STATS_RING - taskStatsCount) % TASK_STATS_RING);
+    out = taskStatsRing[(first + i) % TASK_STATS_RING];
+    return true;
+}
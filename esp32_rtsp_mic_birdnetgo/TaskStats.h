@@ -0,0 +1,67 @@
+#pragma once
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// FreeRTOS task statistics (ESP32 RTSP Mic for BirdNET-Go)
+//
+// Sampled from a loop() job every TASK_STATS_INTERVAL_MS: the CPU share of every task over
+// the interval (from the run-time counters), the idle share and each task's stack
+// high-water mark. A ring keeps the idle and loop-task share of the last samples, so the
+// headroom of a buffer size / sample rate change can be read off before it is rolled out.
+//
+// Needs configUSE_TRACE_FACILITY and configGENERATE_RUN_TIME_STATS in the FreeRTOS
+// config. Without them only the loop task's stack is reported.
+
+#if defined(configUSE_TRACE_FACILITY) && configUSE_TRACE_FACILITY && \
+    defined(configGENERATE_RUN_TIME_STATS) && configGENERATE_RUN_TIME_STATS
+#define TASK_STATS_AVAILABLE 1
+#else
+#define TASK_STATS_AVAILABLE 0
+#endif
+
+#ifndef TASK_STATS_MAX_TASKS
+#define TASK_STATS_MAX_TASKS 32
+#endif
+#ifndef TASK_STATS_INTERVAL_MS
+#define TASK_STATS_INTERVAL_MS 10000UL
+#endif
+#ifndef TASK_STATS_RING
+#define TASK_STATS_RING 30              // 30 x 10 s = 5 min
+#endif
+
+static const uint8_t TASK_STATS_NAME_LEN = 16;
+
+struct TaskCpuInfo {
+    char name[TASK_STATS_NAME_LEN];
+    uint16_t cpuPermille;       // share of all CPU time over the last interval
+    uint32_t stackFreeMin;      // least free stack since the task started (bytes on ESP-IDF)
+    uint8_t priority;
+};
+
+struct TaskStatsSample {
+    uint32_t uptimeS;
+    uint16_t idlePermille;
+    uint16_t loopPermille;
+};
+
+struct TaskStatsSnapshot {
+    TaskCpuInfo tasks[TASK_STATS_MAX_TASKS];   // busiest first
+    uint8_t count;
+    uint8_t totalTasks;         // more than count if the table was too small
+    uint16_t idlePermille;
+    uint16_t loopPermille;
+    uint32_t minStackFree;      // smallest stackFreeMin of all tasks
+    char minStackTask[TASK_STATS_NAME_LEN];
+    uint32_t windowMs;          // length of the interval the shares cover
+    uint32_t samples;
+};
+
+extern TaskStatsSnapshot taskStats;
+
+void taskstats_begin();   // call from setup() (runs in the loop task)
+void taskstats_sample(uint32_t nowMs);
+
+// Ring of the last TASK_STATS_RING samples, oldest first; returns false past the end.
+uint8_t taskstats_historyCount();
+bool taskstats_historyAt(uint8_t i, TaskStatsSample &out);
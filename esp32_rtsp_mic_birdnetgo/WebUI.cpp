@@ -9,6 +9,23 @@
 #include <ESPmDNS.h>
 #include "WebUI.h"
 #include "WebUI_gz.h"
+#include "LogJournal.h"
+#include "LoopProfiler.h"
+#include "LatencyStats.h"
+#include "JobScheduler.h"
+#include "HeapMonitor.h"
+#include "AudioArena.h"
+#include "StreamWatchdog.h"
+#include "PowerManager.h"
+#include "TaskStats.h"
+#include "PrefStore.h"
+#include "AudioBench.h"
+#include "FilterChain.h"
+#include "AutoGain.h"
+#include "MicCalibration.h"
+#include "MicHealth.h"
+#include "Recorder.h"
+#include "HttpAudio.h"
 
 // External variables and functions from main (.ino) – ESP32 RTSP Mic for BirdNET-Go
 extern WiFiServer rtspServer;
@@ -22,9 +39,12 @@ extern uint32_t rtspPlayCount;
 extern unsigned long lastRtspClientConnectMs;
 extern unsigned long bootTime;
 extern unsigned long lastRTSPActivity;
-extern unsigned long lastWiFiCheck;
-extern unsigned long lastTempCheck;
+extern JobScheduler loopJobs;
 extern uint32_t minFreeHeap;
+extern uint8_t heapFragAlertPct;
+extern bool heapFragAlertActive;
+extern uint32_t heapFragAlerts;
+extern StreamWatchdog streamWatchdog;
 extern float maxTemperature;
 extern bool rtspServerEnabled;
 extern uint32_t audioPacketsSent;
@@ -32,10 +52,13 @@ extern uint32_t currentSampleRate;
 extern float currentGainFactor;
 extern uint16_t currentBufferSize;
 extern uint8_t i2sShiftBits;
+extern bool i2sRightSlot;
 extern uint32_t minAcceptableRate;
 extern uint32_t performanceCheckInterval;
 extern bool autoRecoveryEnabled;
 extern uint8_t cpuFrequencyMhz;
+extern uint8_t powerProfile;
+extern void applyPowerProfile();
 extern wifi_power_t currentWifiPowerLevel;
 extern void resetToDefaultSettings();
 extern bool autoThresholdEnabled;
@@ -46,6 +69,8 @@ extern void scheduleReboot(bool factoryReset, uint32_t delayMs);
 extern void scheduleWifiReconnect(const uint8_t *bssid, uint32_t delayMs);
 extern uint16_t lastPeakAbs16;
 extern uint32_t audioClipCount;
+extern LatencyHistogram audioLatency[];
+extern uint32_t audioLatencyBlocks;
 extern bool audioClippedLastBlock;
 extern uint16_t peakHoldAbs16;
 extern bool overheatProtectionEnabled;
@@ -59,6 +84,23 @@ extern bool overheatSensorFault;
 extern float lastTemperatureC;
 extern bool lastTemperatureValid;
 extern bool overheatLatched;
+extern FilterSpec filterSpecs[];
+extern uint8_t filterSpecCount;
+extern bool agcEnabled;
+extern float agcTargetDbfs;
+extern float agcMaxGain;
+extern bool benchStart(BenchSignal signal, BenchSink sink, const String &host, uint16_t port, uint16_t caseMs,
+                       const char *&error);
+extern void benchStop(BenchState state, const char *error);
+extern bool calStart(bool apply, uint8_t marginDb, uint16_t seconds, bool boot, const char *&error);
+extern uint8_t calBootMode;
+extern uint8_t calMarginDb;
+extern bool recEnabled;
+extern uint16_t recSegmentSec;
+extern uint32_t recQuotaKB;
+extern uint16_t recKeepHours;
+extern uint8_t recDecimate;
+extern uint8_t httpAudioMaxClients;
 
 // Local helper: snap requested Wi‑Fi TX power (dBm) to nearest supported step
 static float snapWifiTxDbm(float dbm) {
@@ -85,6 +127,9 @@ extern String formatSince(unsigned long eventMs);
 extern void restartI2S();
 extern void saveAudioSettings();
 extern void applyWifiTxPower(bool log);
+extern void updateHighpassCoeffs();
+extern void updateAgcConfig();
+extern void updateRecorderConfig();
 extern const char* FW_VERSION_STR;
 extern bool timeSynced;
 extern unsigned long lastTimeSyncSuccess;
@@ -107,8 +152,24 @@ extern String mqttTopicPrefix;
 extern String mqttDiscoveryPrefix;
 extern String mqttClientId;
 extern uint16_t mqttPublishIntervalSec;
+extern bool mqttDeltaEnabled;
+extern uint16_t mqttFullEvery;
+extern bool mqttMsgpackEnabled;
+extern bool mqttProfileEnabled;
+extern uint32_t mqttStatePublishCount;
+extern uint32_t mqttStateFullCount;
+extern uint32_t mqttStateJsonBytesLast;
+extern uint64_t mqttStateJsonBytesTotal;
+extern uint64_t mqttStateFullJsonBytesTotal;
+extern uint32_t mqttStateMsgpackBytesLast;
+extern uint64_t mqttStateMsgpackBytesTotal;
 extern bool mqttConnected;
 extern String mqttLastError;
+extern uint32_t mqttConnectAttempts;
+extern uint32_t mqttLastConnectMs;
+extern uint32_t mqttLoopStallMaxUs;
+extern uint64_t mqttLoopStallTotalUs;
+extern uint32_t mqttLoopStallOverCount;
 extern bool isStreamScheduleAllowedNow(bool* timeValidOut);
 extern String mdnsHostname;
 extern bool attemptTimeSync(bool logResult, bool quickMode);
@@ -117,18 +178,89 @@ extern void configureTimeService(bool enableNtp);
 extern void applyMdnsSetting();
 extern void mqttRequestReconnect(bool forceDiscovery);
 extern void mqttPublishDiscoverySoon();
+extern void mqttRequestFullState();
+extern void mqttRefreshDiscovery();
+extern bool bootFastResume;
+extern bool bootCachedLease;
+extern uint32_t bootWifiMs;
+extern uint32_t bootI2sReadyMs;
+extern uint32_t bootFirstPacketMs;
 
-// Web server and in-memory log ring buffer
+// Web server and in-memory log ring buffer.
+// Lines live in a fixed byte arena as variable-length records [seq:u32][len:u16][text]
+// (records may wrap around the arena end). The oldest records are evicted to make room,
+// so pushing a line never allocates and the UI can fetch only lines newer than a cursor.
 static WebServer web(80);
-static const size_t LOG_CAP = 120;
-static String logBuffer[LOG_CAP];
-static size_t logHead = 0;
-static size_t logCount = 0;
+static const size_t LOG_REC_HDR = 6;
+static const size_t LOG_LINE_MAX = WEBUI_LOG_LINE_MAX;
+static_assert(WEBUI_LOG_ARENA_BYTES >= 2 * (LOG_REC_HDR + LOG_LINE_MAX), "log arena too small");
+static uint8_t logArena[WEBUI_LOG_ARENA_BYTES];
+static size_t logHeadOff = 0;                // oldest record
+static size_t logUsed = 0;                   // bytes in use
+static size_t logCount = 0;                  // records in arena
+static uint32_t logFirstSeq = 1;             // seq of the oldest record
+static uint32_t logNextSeq = 1;              // seq assigned to the next line
+static uint32_t logDropped = 0;              // lines evicted since boot
+// Lines are pushed from loop() and from the MQTT task; readers copy records out under the
+// same lock (short memcpy only, never while sending).
+static portMUX_TYPE logMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void logArenaWrite(size_t off, const void *src, size_t len) {
+    const uint8_t *p = static_cast<const uint8_t*>(src);
+    size_t first = WEBUI_LOG_ARENA_BYTES - off;
+    if (first > len) first = len;
+    memcpy(logArena + off, p, first);
+    if (len > first) memcpy(logArena, p + first, len - first);
+}
+
+static void logArenaRead(size_t off, void *dst, size_t len) {
+    uint8_t *p = static_cast<uint8_t*>(dst);
+    size_t first = WEBUI_LOG_ARENA_BYTES - off;
+    if (first > len) first = len;
+    memcpy(p, logArena + off, first);
+    if (len > first) memcpy(p + first, logArena, len - first);
+}
+
+static inline size_t logArenaWrap(size_t off) {
+    return off % WEBUI_LOG_ARENA_BYTES;
+}
+
+static uint16_t logRecordLen(size_t off) {
+    uint16_t len;
+    logArenaRead(logArenaWrap(off + 4), &len, sizeof(len));
+    return len;
+}
+
+void webui_pushLog(const char *prefix, size_t prefixLen, const char *text, size_t textLen) {
+    if (prefixLen > LOG_LINE_MAX) prefixLen = LOG_LINE_MAX;
+    if (textLen > LOG_LINE_MAX - prefixLen) textLen = LOG_LINE_MAX - prefixLen;
+    const uint16_t len = (uint16_t)(prefixLen + textLen);
+    const size_t need = LOG_REC_HDR + len;
+
+    portENTER_CRITICAL(&logMux);
+    while (logCount > 0 && WEBUI_LOG_ARENA_BYTES - logUsed < need) {
+        size_t recBytes = LOG_REC_HDR + logRecordLen(logHeadOff);
+        logHeadOff = logArenaWrap(logHeadOff + recBytes);
+        logUsed -= recBytes;
+        logCount--;
+        logFirstSeq++;
+        logDropped++;
+    }
+
+    size_t off = logArenaWrap(logHeadOff + logUsed);
+    uint32_t seq = logNextSeq++;
+    logArenaWrite(off, &seq, sizeof(seq));
+    logArenaWrite(logArenaWrap(off + 4), &len, sizeof(len));
+    if (prefixLen) logArenaWrite(logArenaWrap(off + LOG_REC_HDR), prefix, prefixLen);
+    if (textLen) logArenaWrite(logArenaWrap(off + LOG_REC_HDR + prefixLen), text, textLen);
+    logUsed += need;
+    if (logCount == 0) logFirstSeq = seq;
+    logCount++;
+    portEXIT_CRITICAL(&logMux);
+}
 
 void webui_pushLog(const String &line) {
-    logBuffer[logHead] = line;
-    logHead = (logHead + 1) % LOG_CAP;
-    if (logCount < LOG_CAP) logCount++;
+    webui_pushLog(nullptr, 0, line.c_str(), line.length());
 }
 
 static String jsonEscape(const String &s) {
@@ -184,17 +316,47 @@ static bool requireMutationAuth() {
 }
 
 // HTML UI (gzip-compressed in PROGMEM)
-static void httpIndex() {
-    // Avoid stale UI after firmware updates (browser caches).
-    web.sendHeader("Cache-Control", "no-store");
-    web.sendHeader("Content-Encoding", "gzip");
+// Every asset carries a content hash from gen_webui_gzip_header.sh. The page itself is
+// revalidated on each load (cheap 304), while app.js/app.css are referenced by hash
+// (`/app.js?v=<hash>`) and can be cached forever: a firmware update with a changed UI
+// changes the page hash and therefore the asset URLs.
+static const char* UI_IF_NONE_MATCH_HEADER = "If-None-Match";
+
+static bool etagMatches(const String &etag) {
+    if (!web.hasHeader(UI_IF_NONE_MATCH_HEADER)) return false;
+    String inm = web.header(UI_IF_NONE_MATCH_HEADER);
+    inm.trim();
+    if (inm == "*") return true;
+    return inm.indexOf(etag) >= 0; // also matches weak (W/"...") and lists
+}
+
+static void sendGzAsset(const char* contentType, const uint8_t* data, size_t len,
+                        const char* hash, bool immutable) {
+    String etag = String('"') + hash + '"';
+    web.sendHeader("ETag", etag);
+    web.sendHeader("Cache-Control", immutable ? "public, max-age=31536000, immutable" : "no-cache");
     web.sendHeader("Vary", "Accept-Encoding");
-    web.send_P(
-        200,
-        PSTR("text/html; charset=utf-8"),
-        reinterpret_cast<PGM_P>(WEBUI_INDEX_GZ),
-        WEBUI_INDEX_GZ_LEN
-    );
+    if (etagMatches(etag)) {
+        web.send(304);
+        return;
+    }
+    web.sendHeader("Content-Encoding", "gzip");
+    web.send_P(200, contentType, reinterpret_cast<PGM_P>(data), len);
+}
+
+static void httpIndex() {
+    sendGzAsset(PSTR("text/html; charset=utf-8"), WEBUI_INDEX_GZ, WEBUI_INDEX_GZ_LEN,
+                WEBUI_INDEX_HASH, false);
+}
+
+static void httpAppJs() {
+    sendGzAsset(PSTR("application/javascript; charset=utf-8"), WEBUI_APP_JS_GZ, WEBUI_APP_JS_GZ_LEN,
+                WEBUI_APP_JS_HASH, true);
+}
+
+static void httpAppCss() {
+    sendGzAsset(PSTR("text/css; charset=utf-8"), WEBUI_APP_CSS_GZ, WEBUI_APP_CSS_GZ_LEN,
+                WEBUI_APP_CSS_HASH, true);
 }
 
 // HTTP handlery
@@ -217,6 +379,11 @@ static void httpStatus() {
     json += "\"free_heap_kb\":" + String(ESP.getFreeHeap()/1024) + ",";
     json += "\"min_free_heap_kb\":" + String(minFreeHeap/1024) + ",";
     json += "\"uptime\":\"" + uptimeStr + "\",";
+    json += "\"boot_ttfp_ms\":" + String(bootFirstPacketMs) + ",";
+    json += "\"boot_wifi_ms\":" + String(bootWifiMs) + ",";
+    json += "\"boot_i2s_ms\":" + String(bootI2sReadyMs) + ",";
+    json += "\"boot_fast_resume\":" + String(bootFastResume?"true":"false") + ",";
+    json += "\"boot_cached_lease\":" + String(bootCachedLease?"true":"false") + ",";
     json += "\"time_synced\":" + String(timeSynced?"true":"false") + ",";
     json += "\"time_sync_enabled\":" + String(timeSyncEnabled?"true":"false") + ",";
     json += "\"last_time_sync\":\"" + jsonEscape(timeSynced ? formatSince(lastTimeSyncSuccess) : String("never")) + "\",";
@@ -234,6 +401,20 @@ static void httpStatus() {
     json += "\"mqtt_client_id\":\"" + jsonEscape(mqttClientId) + "\",";
     json += "\"mqtt_interval_sec\":" + String((uint32_t)mqttPublishIntervalSec) + ",";
     json += "\"mqtt_last_error\":\"" + jsonEscape(mqttLastError) + "\",";
+    json += "\"mqtt_delta\":" + String(mqttDeltaEnabled?"true":"false") + ",";
+    json += "\"mqtt_full_every\":" + String((uint32_t)mqttFullEvery) + ",";
+    json += "\"mqtt_msgpack\":" + String(mqttMsgpackEnabled?"true":"false") + ",";
+    json += "\"mqtt_profile\":" + String(mqttProfileEnabled?"true":"false") + ",";
+    {
+        uint32_t n = mqttStatePublishCount;
+        json += "\"mqtt_state_publishes\":" + String(n) + ",";
+        json += "\"mqtt_state_full_publishes\":" + String(mqttStateFullCount) + ",";
+        json += "\"mqtt_state_bytes_last\":" + String(mqttStateJsonBytesLast) + ",";
+        json += "\"mqtt_state_bytes_avg\":" + String(n ? (uint32_t)(mqttStateJsonBytesTotal / n) : 0) + ",";
+        json += "\"mqtt_state_full_bytes_avg\":" + String(n ? (uint32_t)(mqttStateFullJsonBytesTotal / n) : 0) + ",";
+        json += "\"mqtt_msgpack_bytes_last\":" + String(mqttStateMsgpackBytesLast) + ",";
+        json += "\"mqtt_msgpack_bytes_avg\":" + String(n ? (uint32_t)(mqttStateMsgpackBytesTotal / n) : 0) + ",";
+    }
     bool schedTimeValid = false;
     bool schedAllowNow = isStreamScheduleAllowedNow(&schedTimeValid);
     json += "\"stream_schedule_enabled\":" + String(streamScheduleEnabled?"true":"false") + ",";
@@ -249,7 +430,15 @@ static void httpStatus() {
     json += "\"streaming\":" + String(isStreaming?"true":"false") + ",";
     json += "\"current_rate_pkt_s\":" + String(currentRate) + ",";
     json += "\"last_rtsp_connect\":\"" + jsonEscape(formatSince(lastRtspClientConnectMs)) + "\",";
-    json += "\"last_stream_start\":\"" + jsonEscape(formatSince(lastRtspPlayMs)) + "\"";
+    json += "\"last_stream_start\":\"" + jsonEscape(formatSince(lastRtspPlayMs)) + "\",";
+    LogJournalStats js;
+    logjournal_getStats(js);
+    json += "\"log_journal_ok\":" + String(js.mounted?"true":"false") + ",";
+    json += "\"log_journal_bytes\":" + String(js.textBytes) + ",";
+    json += "\"log_journal_buffered\":" + String(js.bufferedBytes) + ",";
+    json += "\"log_journal_blocks\":" + String(js.blocksWritten) + ",";
+    json += "\"log_journal_dropped\":" + String(js.linesDropped) + ",";
+    json += "\"log_journal_torn\":" + String(js.tornRecovered);
     json += "}";
     apiSendJSON(json);
 }
@@ -260,12 +449,64 @@ static void httpAudioStatus() {
     json += "\"sample_rate\":" + String(currentSampleRate) + ",";
     json += "\"gain\":" + String(currentGainFactor,2) + ",";
     json += "\"buffer_size\":" + String(currentBufferSize) + ",";
+    json += "\"max_buffer_size\":" + String(AUDIO_MAX_BUFFER_SAMPLES) + ",";
+    json += "\"audio_arena_bytes\":" + String(audioarena_totalBytes()) + ",";
     json += "\"i2s_shift\":" + String(i2sShiftBits) + ",";
+    json += "\"i2s_channel\":\"" + String(i2sRightSlot?"right":"left") + "\",";
     json += "\"latency_ms\":" + String(latency_ms,1) + ",";
     extern bool highpassEnabled; extern uint16_t highpassCutoffHz;
     json += "\"profile\":\"" + jsonEscape(profileName(currentBufferSize)) + "\",";
     json += "\"hp_enable\":" + String(highpassEnabled?"true":"false") + ",";
     json += "\"hp_cutoff_hz\":" + String((uint32_t)highpassCutoffHz) + ",";
+    json += "\"filters\":" + filterchain_toJson(filterSpecs, filterSpecCount) + ",";
+    json += "\"filter_sections\":" + String(filterChainStats.sections) + ",";
+    // AGC: gain now (the manual gain only seeds it), limiter reduction in the last block / peak
+    const AgcStatus &agc = agcStatus;
+    json += "\"agc_enable\":" + String(agcEnabled?"true":"false") + ",";
+    json += "\"agc_target_dbfs\":" + String(agcTargetDbfs,1) + ",";
+    json += "\"agc_max_gain\":" + String(agcMaxGain,2) + ",";
+    json += "\"agc_gain\":" + String(agc_gain(),2) + ",";
+    json += "\"agc_gain_db\":" + String(20.0f * log10f(agc_gain()),1) + ",";
+    json += "\"agc_at_max\":" + String(agc.gainQ16 >= (uint32_t)(agcMaxGain * 65536.0f)?"true":"false") + ",";
+    json += "\"agc_limit_db\":" + String(agc_limitDb(),1) + ",";
+    json += "\"agc_limit_peak_db\":" + String(20.0f * log10f(agc.limitPeakQ15 / 32768.0f),1) + ",";
+    json += "\"agc_limit_blocks\":" + String(agc.limitBlocks) + ",";
+    json += "\"agc_gated_blocks\":" + String(agc.gatedBlocks) + ",";
+    json += "\"agc_capped_blocks\":" + String(agc.cappedBlocks) + ",";
+    // Mic health (raw I2S words, last judged second; 24-bit dBFS)
+    const MicHealthStatus &mh = micHealth;
+    json += "\"mic_health\":\"" + String(michealth_summary(mh.flags)) + "\",";
+    json += "\"mic_fault\":" + String((mh.flags & MH_DEAD_MASK)?"true":"false") + ",";
+    json += "\"mic_flags\":[";
+    for (uint8_t i = 0, n = 0; i < MH_FLAG_COUNT; i++) {
+        if (!(mh.flags & (1U << i))) continue;
+        if (n++) json += ",";
+        json += "\"" + String(michealth_flagName(1U << i)) + "\"";
+    }
+    json += "],";
+    json += "\"mic_rms_dbfs\":" + String(mh.rmsDbfs,1) + ",";
+    json += "\"mic_dc_dbfs\":" + String(mh.dcDbfs,1) + ",";
+    json += "\"mic_lowest_bit\":" + String(mh.lowestBit) + ",";
+    char stuckHex[11];
+    snprintf(stuckHex, sizeof(stuckHex), "0x%08lx", (unsigned long)mh.stuckBitMask);
+    json += "\"mic_stuck_bits\":\"" + String(stuckHex) + "\",";
+    json += "\"mic_dropouts\":" + String(mh.dropouts) + ",";
+    json += "\"mic_episodes\":" + String(mh.episodes) + ",";
+    json += "\"mic_probes\":" + String(mh.probes) + ",";
+    json += "\"mic_restarts\":" + String(mh.restarts) + ",";
+    json += "\"mic_lr_switched\":" + String(mh.lrSwitched?"true":"false") + ",";
+    // HTTP live audio listeners (/audio.wav, /audio.pcm)
+    const HttpAudioStats &ha = httpAudioStats;
+    json += "\"http_audio_clients\":" + String(ha.clients) + ",";
+    json += "\"http_audio_max_clients\":" + String(httpAudioMaxClients) + ",";
+    json += "\"http_audio_connects\":" + String(ha.connects) + ",";
+    json += "\"http_audio_rejects\":" + String(ha.rejects) + ",";
+    json += "\"http_audio_blocks_sent\":" + String(ha.blocksSent) + ",";
+    json += "\"http_audio_blocks_dropped\":" + String(ha.blocksDropped) + ",";
+    json += "\"http_audio_partial_writes\":" + String(ha.partialWrites) + ",";
+    json += "\"http_audio_stalls\":" + String(ha.stallDisconnects) + ",";
+    json += "\"http_audio_sent_kb\":" + String((uint32_t)(ha.bytesSent / 1024)) + ",";
+    json += "\"http_audio_last_close\":\"" + String(ha.lastCloseReason) + "\",";
     // Metering/clipping
     uint16_t p = (peakHoldAbs16 > 0) ? peakHoldAbs16 : lastPeakAbs16;
     float peak_pct = (p <= 0) ? 0.0f : (100.0f * (float)p / 32767.0f);
@@ -273,7 +514,18 @@ static void httpAudioStatus() {
     json += "\"peak_pct\":" + String(peak_pct,1) + ",";
     json += "\"peak_dbfs\":" + String(peak_dbfs,1) + ",";
     json += "\"clip\":" + String(audioClippedLastBlock?"true":"false") + ",";
-    json += "\"clip_count\":" + String(audioClipCount);
+    json += "\"clip_count\":" + String(audioClipCount) + ",";
+    // Measured per-block latency (last 30..60 s), microseconds
+    json += "\"lat_blocks\":" + String(audioLatencyBlocks);
+    static const char *const stages[] = {"queue", "dsp", "net", "total"};
+    for (uint8_t i = 0; i < sizeof(stages) / sizeof(stages[0]); i++) {
+        const LatencyHistogram &h = audioLatency[i];
+        String k = String(",\"lat_") + stages[i];
+        json += k + "_p50_us\":" + String(h.percentile(50.0f));
+        json += k + "_p95_us\":" + String(h.percentile(95.0f));
+        json += k + "_p99_us\":" + String(h.percentile(99.0f));
+        json += k + "_max_us\":" + String(h.max());
+    }
     json += "}";
     apiSendJSON(json);
 }
@@ -286,10 +538,191 @@ static void httpPerfStatus() {
     json += "\"auto_threshold\":" + String(autoThresholdEnabled?"true":"false") + ",";
     json += "\"recommended_min_rate\":" + String(computeRecommendedMinRate()) + ",";
     json += "\"scheduled_reset\":" + String(scheduledResetEnabled?"true":"false") + ",";
-    json += "\"reset_hours\":" + String(resetIntervalHours) + "}";
+    json += "\"reset_hours\":" + String(resetIntervalHours) + ",";
+    json += "\"mqtt_loop_stall_max_us\":" + String(mqttLoopStallMaxUs) + ",";
+    json += "\"mqtt_loop_stall_total_ms\":" + String((uint32_t)(mqttLoopStallTotalUs / 1000ULL)) + ",";
+    json += "\"mqtt_loop_stall_over_5ms\":" + String(mqttLoopStallOverCount) + ",";
+    json += "\"mqtt_connect_attempts\":" + String(mqttConnectAttempts) + ",";
+    json += "\"mqtt_last_connect_ms\":" + String(mqttLastConnectMs) + ",";
+    // Stream watchdog (1 s resolution)
+    const StreamWatchdog &wd = streamWatchdog;
+    const WatchdogStats &ws = wd.stats();
+    json += "\"wd_state\":\"" + String(StreamWatchdog::faultName(wd.fault())) + "\",";
+    json += "\"wd_level\":\"" + String(StreamWatchdog::actionName(wd.level())) + "\",";
+    json += "\"wd_pkt_rate\":" + String(wd.packetRateX16() / 16.0f, 1) + ",";
+    json += "\"wd_sample_rate\":" + String(wd.sampleRate()) + ",";
+    json += "\"wd_window_pkt_rate\":" + String(wd.windowRateX10() / 10.0f, 1) + ",";
+    json += "\"wd_window_min_pkt\":" + String(wd.windowMin()) + ",";
+    json += "\"wd_stall_s\":" + String(wd.stallSeconds()) + ",";
+    json += "\"wd_stalls\":" + String(ws.stalls) + ",";
+    json += "\"wd_degradations\":" + String(ws.degradations) + ",";
+    json += "\"wd_longest_stall_s\":" + String(ws.longestStallSec) + ",";
+    json += "\"wd_last_action\":\"" + String(StreamWatchdog::actionName(ws.lastAction)) + "\",";
+    json += "\"wd_last_action_ago_s\":" + String(ws.lastActionMs ? (uint32_t)((millis() - ws.lastActionMs) / 1000UL) : 0) + ",";
+    for (uint8_t i = WD_LOG; i < WD_ACTION_COUNT; i++) {
+        String k = String("\"wd_") + StreamWatchdog::actionName(i);
+        json += k + "_count\":" + String(ws.actions[i]) + ",";
+        json += k + "_recovered\":" + String(ws.recoveries[i]) + ",";
+    }
+    // FreeRTOS run-time stats (TaskStats, shares over the last interval)
+    const TaskStatsSnapshot &ts = taskStats;
+    json += "\"task_stats_available\":" + String(TASK_STATS_AVAILABLE?"true":"false") + ",";
+    json += "\"task_interval_s\":" + String((uint32_t)(TASK_STATS_INTERVAL_MS / 1000UL)) + ",";
+    json += "\"task_window_ms\":" + String(ts.windowMs) + ",";
+    json += "\"task_count\":" + String(ts.totalTasks) + ",";
+    if (TASK_STATS_AVAILABLE && ts.count > 0) {
+        json += "\"cpu_idle_pct\":" + String(ts.idlePermille / 10.0f, 1) + ",";
+        json += "\"cpu_loop_pct\":" + String(ts.loopPermille / 10.0f, 1) + ",";
+    } else {
+        json += "\"cpu_idle_pct\":null,\"cpu_loop_pct\":null,";
+    }
+    json += "\"stack_min_free\":" + String(ts.count ? ts.minStackFree : 0) + ",";
+    json += "\"stack_min_task\":\"" + jsonEscape(String(ts.count ? ts.minStackTask : "")) + "\",";
+    json += "\"tasks\":[";
+    for (uint8_t i = 0; i < ts.count; i++) {
+        const TaskCpuInfo &ti = ts.tasks[i];
+        if (i) json += ",";
+        json += "{\"name\":\"" + jsonEscape(String(ti.name)) + "\",\"cpu_pct\":" + String(ti.cpuPermille / 10.0f, 1) +
+                ",\"stack_free\":" + String(ti.stackFreeMin) + ",\"prio\":" + String(ti.priority) + "}";
+    }
+    json += "],";
+    const PrefStoreStats &ns = prefStoreStats;
+    json += "\"nvs_pending\":" + String(ns.pending?"true":"false") + ",";
+    json += "\"nvs_flushes\":" + String(ns.flushes) + ",";
+    json += "\"nvs_keys_written\":" + String(ns.keysWritten) + ",";
+    json += "\"nvs_keys_skipped\":" + String(ns.keysSkipped) + ",";
+    json += "\"nvs_write_errors\":" + String(ns.writeErrors) + ",";
+    json += "\"nvs_changes\":" + String(ns.marks) + ",";
+    json += "\"nvs_coalesced\":" + String(ns.coalesced) + ",";
+    json += "\"nvs_last_keys\":" + String(ns.lastKeys) + ",";
+    json += "\"nvs_last_flush_ago_s\":" + (ns.flushes ? String((uint32_t)((millis() - ns.lastFlushMs) / 1000UL)) : String("null")) + ",";
+    json += "\"nvs_last_flush_us\":" + String(ns.lastFlushUs) + ",";
+    json += "\"nvs_max_flush_us\":" + String(ns.maxFlushUs) + ",";
+    json += "\"nvs_free_entries\":" + String(ns.freeEntries) + ",";
+    const FilterChainStats &fc = filterChainStats;
+    json += "\"filter_sections\":" + String(fc.sections) + ",";
+    json += "\"filter_cycles_per_sample\":" + String(fc.cyclesPerSampleX10 / 10.0f, 1) + ",";
+    json += "\"filter_max_block_cycles\":" + String(fc.maxBlockCycles) + ",";
+    json += "\"filter_load_pct\":" + String(fc.loadPctX10 / 10.0f, 1) + ",";
+    json += "\"filter_load_peak_pct\":" + String(fc.loadPeakPctX10 / 10.0f, 1) + ",";
+    json += "\"filter_budget_pct\":" + String(FILTER_CHAIN_BUDGET_PCT) + ",";
+    json += "\"filter_over_budget\":" + String(fc.overBudget?"true":"false") + ",";
+    const HeapStatus &h = heapStatus;
+    json += "\"heap_free\":" + String(h.freeBytes) + ",";
+    json += "\"heap_min_free\":" + String(h.minFreeEver) + ",";
+    json += "\"heap_largest_block\":" + String(h.largestBlock) + ",";
+    json += "\"heap_min_largest_block\":" + String(h.minLargestBlock) + ",";
+    json += "\"heap_frag_pct\":" + String(h.fragPct) + ",";
+    json += "\"heap_frag_max_pct\":" + String(h.fragMaxPct) + ",";
+    json += "\"heap_frag_alert_pct\":" + String(heapFragAlertPct) + ",";
+    json += "\"heap_frag_alert\":" + String(heapFragAlertActive?"true":"false") + ",";
+    json += "\"heap_frag_alerts\":" + String(heapFragAlerts) + ",";
+    json += "\"heap_alloc_tracking\":" + String(HEAP_MONITOR_HOOKS?"true":"false") + ",";
+#if HEAP_MONITOR_HOOKS
+    for (uint8_t i = 0; i < HEAP_SYS_COUNT; i++) {
+        const HeapAllocStats &a = heapAllocStats[i];
+        String k = String("\"heap_") + heapmon_subsystemName(i);
+        json += k + "_allocs\":" + String(a.allocs) + ",";
+        json += k + "_frees\":" + String(a.frees) + ",";
+        json += k + "_alloc_bytes\":" + String((uint32_t)a.allocBytes) + ",";
+    }
+#endif
+    json += "\"heap_trend_interval_min\":" + String((uint32_t)(HEAP_TREND_INTERVAL_MS / 60000UL));
+    // Trends only on request (?trend=1): up to a day of samples is too large for the UI poll.
+    if (web.hasArg("trend")) {
+        json += ",\"heap_trend_cols\":[\"uptime_min\",\"free\",\"largest_block\",\"frag_pct\"],\"heap_trend\":[";
+        HeapSample hs;
+        for (uint8_t i = 0; heapmon_trendAt(i, hs); i++) {
+            if (i) json += ",";
+            json += "[" + String(hs.uptimeMin) + "," + String(hs.freeBytes) + "," + String(hs.largestBlock) + "," + String(hs.fragPct) + "]";
+        }
+        json += "]";
+        json += ",\"task_trend_cols\":[\"uptime_s\",\"idle_pct\",\"loop_pct\"],\"task_trend\":[";
+        TaskStatsSample tss;
+        for (uint8_t i = 0; taskstats_historyAt(i, tss); i++) {
+            if (i) json += ",";
+            json += "[" + String(tss.uptimeS) + "," + String(tss.idlePermille / 10.0f, 1) + "," + String(tss.loopPermille / 10.0f, 1) + "]";
+        }
+        json += "]";
+    }
+    json += "}";
+    apiSendJSON(json);
+}
+
+// Per-subsystem loop() timing: count, average, max (+ when), log2 histogram in microseconds.
+static void httpProfile() {
+#if LOOP_PROFILER_ENABLED
+    unsigned long now = millis();
+    String json = "{\"enabled\":true,";
+    json += "\"cpu_mhz\":" + String(getCpuFrequencyMhz()) + ",";
+    json += "\"uptime_ms\":" + String((uint32_t)now) + ",";
+    json += "\"buckets\":\"log2_us\",\"sections\":[";
+    for (uint8_t i = 0; i < PROF_SECTION_COUNT; i++) {
+        const ProfilerStats &st = profilerStats[i];
+        if (i) json += ",";
+        json += "{\"name\":\"" + String(profiler_sectionName(i)) + "\",";
+        json += "\"count\":" + String(st.count) + ",";
+        json += "\"avg_us\":" + String(st.count ? (uint32_t)(st.totalUs / st.count) : 0) + ",";
+        json += "\"max_us\":" + String(st.maxUs) + ",";
+        json += "\"max_at_ms\":" + String(st.maxAtMs) + ",";
+        json += "\"max_ago_s\":" + String(st.count ? (uint32_t)((now - st.maxAtMs) / 1000UL) : 0) + ",";
+        json += "\"hist\":[";
+        for (uint8_t b = 0; b < PROF_BUCKETS; b++) {
+            if (b) json += ",";
+            json += String(st.hist[b]);
+        }
+        json += "]}";
+    }
+    json += "]}";
+    apiSendJSON(json);
+#else
+    apiSendJSON(F("{\"enabled\":false}"));
+#endif
+}
+
+static void httpProfileReset() {
+    if (!requireMutationAuth()) return;
+    profiler_reset();
+    webui_pushLog(F("UI action: profile_reset"));
+    apiSendJSON(F("{\"ok\":true}"));
+}
+
+// loop() housekeeping jobs: period, run time, budget overruns and how often they were postponed.
+static void httpJobs() {
+    static const char *const prioNames[] = {"urgent", "normal", "background"};
+    unsigned long now = millis();
+    String json = "{\"iteration_budget_us\":" + String(loopJobs.iterationBudgetUs()) + ",";
+    json += "\"iterations_over_budget\":" + String(loopJobs.iterationsOverBudget()) + ",";
+    json += "\"jobs\":[";
+    for (size_t i = 0; i < loopJobs.count(); i++) {
+        const Job &j = loopJobs.job(i);
+        const JobStats &st = j.stats;
+        if (i) json += ",";
+        json += "{\"name\":\"" + String(j.name) + "\",";
+        json += "\"prio\":\"" + String(prioNames[j.prio]) + "\",";
+        json += "\"period_ms\":" + String(j.periodMs) + ",";
+        json += "\"budget_us\":" + String(j.budgetUs) + ",";
+        json += "\"runs\":" + String(st.runs) + ",";
+        json += "\"avg_us\":" + String(st.runs ? (uint32_t)(st.totalUs / st.runs) : 0) + ",";
+        json += "\"max_us\":" + String(st.maxUs) + ",";
+        json += "\"last_us\":" + String(st.lastUs) + ",";
+        json += "\"over_budget\":" + String(st.overBudget) + ",";
+        json += "\"deferred_busy\":" + String(st.deferredBusy) + ",";
+        json += "\"deferred_audio\":" + String(st.deferredAudio) + ",";
+        json += "\"late_max_ms\":" + String(st.lateMaxMs) + ",";
+        json += "\"last_run_ago_ms\":" + String(st.runs ? (uint32_t)(now - st.lastRunMs) : 0) + "}";
+    }
+    json += "]}";
     apiSendJSON(json);
 }
 
+static void httpJobsReset() {
+    if (!requireMutationAuth()) return;
+    loopJobs.resetStats();
+    webui_pushLog(F("UI action: jobs_reset"));
+    apiSendJSON(F("{\"ok\":true}"));
+}
+
 static void httpThermal() {
     String since = "";
     if (overheatTripTemp > 0.0f && overheatTriggeredAt != 0) {
@@ -305,6 +738,23 @@ static void httpThermal() {
     json += "\"current_valid\":" + String(lastTemperatureValid?"true":"false") + ",";
     json += "\"max_c\":" + String(maxTemperature,1) + ",";
     json += "\"cpu_mhz\":" + String(getCpuFrequencyMhz()) + ",";
+    json += "\"cpu_max_mhz\":" + String(cpuFrequencyMhz) + ",";
+    {
+        const PowerStatus &p = powerStatus;
+        json += "\"power_profile\":\"" + String(power_profileName(p.profile)) + "\",";
+        json += "\"power_pm_framework\":" + String(p.pmFramework?"true":"false") + ",";
+        json += "\"power_light_sleep\":" + String(p.lightSleep?"true":"false") + ",";
+        json += "\"power_modem_sleep\":" + String(p.modemSleep?"true":"false") + ",";
+        json += "\"power_min_mhz\":" + String(p.minMhz) + ",";
+        json += "\"power_max_mhz\":" + String(p.maxMhz) + ",";
+        json += "\"cpu_load_pct\":" + String(p.loadPct) + ",";
+        json += "\"cpu_load_avg_pct\":" + String(p.loadAvgPct) + ",";
+        json += "\"cpu_load_peak_pct\":" + String(p.loadPeakPct) + ",";
+        json += "\"cpu_max_clock_pct\":" + String(p.maxClockPct) + ",";
+        json += "\"power_est_ma\":" + String(p.estMa,1) + ",";
+        json += "\"power_est_mw\":" + String(p.estMa * 3.3f,0) + ",";
+        json += "\"power_freq_switches\":" + String(p.freqSwitches) + ",";
+    }
     json += "\"protection_enabled\":" + String(overheatProtectionEnabled?"true":"false") + ",";
     json += "\"shutdown_c\":" + String(overheatShutdownC,0) + ",";
     json += "\"latched\":" + String(overheatLockoutActive?"true":"false") + ",";
@@ -342,17 +792,138 @@ static void httpThermalClear() {
     }
 }
 
+// Persistent journal download: plain text, oldest first, with single-range support
+// (`Range: bytes=a-b`, `bytes=a-`, `bytes=-n`) so large logs can be fetched in pieces.
+static const char* UI_RANGE_HEADER = "Range";
+
+static bool parseByteRange(const String &hdr, size_t total, size_t &start, size_t &end) {
+    if (!hdr.startsWith("bytes=") || hdr.indexOf(',') >= 0) return false;
+    String spec = hdr.substring(6);
+    spec.trim();
+    int dash = spec.indexOf('-');
+    if (dash < 0) return false;
+    String a = spec.substring(0, dash);
+    String b = spec.substring(dash + 1);
+    char *endp = nullptr;
+    if (a.length() == 0) {                       // suffix: last n bytes
+        unsigned long n = strtoul(b.c_str(), &endp, 10);
+        if (b.length() == 0 || *endp != '\0' || n == 0) return false;
+        start = (n >= total) ? 0 : total - n;
+        end = total - 1;
+        return total > 0;
+    }
+    unsigned long s0 = strtoul(a.c_str(), &endp, 10);
+    if (*endp != '\0' || s0 >= total) return false;
+    start = s0;
+    end = total - 1;
+    if (b.length()) {
+        unsigned long e0 = strtoul(b.c_str(), &endp, 10);
+        if (*endp != '\0' || e0 < s0) return false;
+        if (e0 < end) end = e0;
+    }
+    return true;
+}
+
+static bool journalSink(const uint8_t *data, size_t len, void *) {
+    web.sendContent(reinterpret_cast<const char*>(data), len);
+    return web.client().connected();
+}
+
+static void httpPersistLogs() {
+    // Content-Length and the read come from the same snapshot of the segments.
+    LogJournalSnapshot snap;
+    logjournal_snapshot(snap);
+    size_t total = snap.textBytes;
+    size_t start = 0, end = total ? total - 1 : 0;
+    bool partial = false;
+    if (web.hasHeader(UI_RANGE_HEADER)) {
+        if (!parseByteRange(web.header(UI_RANGE_HEADER), total, start, end)) {
+            web.sendHeader("Content-Range", String("bytes */") + String(total));
+            web.send(416, "text/plain", "");
+            return;
+        }
+        partial = true;
+    }
+    size_t len = total ? end - start + 1 : 0;
+    if (web.hasArg("download")) {
+        web.sendHeader("Content-Disposition", "attachment; filename=\"esp32mic-log-persist.txt\"");
+    }
+    web.sendHeader("Cache-Control", "no-cache");
+    web.sendHeader("Accept-Ranges", "bytes");
+    if (partial) {
+        web.sendHeader("Content-Range", String("bytes ") + String(start) + "-" + String(end) + "/" + String(total));
+    }
+    web.setContentLength(len);
+    web.send(partial ? 206 : 200, "text/plain; charset=utf-8", "");
+    // Short only if the writer recycled a segment meanwhile: close so the client does not
+    // wait for the bytes announced in Content-Length.
+    if (len && logjournal_readSnapshot(snap, start, len, journalSink, nullptr) < len) web.client().stop();
+}
+
 static void httpLogs() {
-    String out;
-    for (size_t i=0;i<logCount;i++){
-        size_t idx = (logHead + LOG_CAP - logCount + i) % LOG_CAP;
-        out += logBuffer[idx]; out += '\n';
+    if (web.hasArg("persist") && web.arg("persist") == "1") {
+        httpPersistLogs();
+        return;
     }
+    // ?since=<seq> returns only lines with a higher sequence number. The response headers
+    // carry the cursor for the next poll and the eviction state of the arena, so a client
+    // can tell when it fell behind (X-Log-First > since + 1).
+    uint32_t since = 0;
+    if (web.hasArg("since")) {
+        since = (uint32_t)strtoul(web.arg("since").c_str(), nullptr, 10);
+    }
+    portENTER_CRITICAL(&logMux);
+    const uint32_t firstSeq = logFirstSeq;
+    const uint32_t nextSeq = logNextSeq;
+    const uint32_t dropped = logDropped;
+    portEXIT_CRITICAL(&logMux);
     if (web.hasArg("download")) {
         web.sendHeader("Content-Disposition", "attachment; filename=\"esp32mic-log.txt\"");
     }
     web.sendHeader("Cache-Control", "no-cache");
-    web.send(200, "text/plain; charset=utf-8", out);
+    web.sendHeader("X-Log-First", String(firstSeq));
+    web.sendHeader("X-Log-Next", String(nextSeq));
+    web.sendHeader("X-Log-Dropped", String(dropped));
+    web.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    web.send(200, "text/plain; charset=utf-8", "");
+
+    // Stream records through a small stack buffer instead of building one big String.
+    // Each round copies the next records after `cursor` under the lock, then sends them;
+    // lines pushed after the headers were sent are left for the next poll. Records do not
+    // move once written, so a round resumes at the offset where the last one stopped unless
+    // that record was evicted meanwhile (then from the oldest one).
+    char chunk[LOG_LINE_MAX + 1];
+    uint32_t cursor = since;
+    size_t resumeOff = 0;
+    uint32_t resumeSeq = 0;      // record at resumeOff; 0 = start at the oldest
+    for (;;) {
+        size_t fill = 0;
+        portENTER_CRITICAL(&logMux);
+        size_t off = logHeadOff;
+        uint32_t seq = logFirstSeq;
+        if (resumeSeq >= logFirstSeq) {
+            off = resumeOff;
+            seq = resumeSeq;
+        }
+        const uint32_t endSeq = logFirstSeq + (uint32_t)logCount;
+        for (; seq < endSeq && seq < nextSeq; seq++) {
+            uint16_t len = logRecordLen(off);
+            if (seq > cursor) {
+                if (fill + len + 1 > sizeof(chunk)) break;
+                logArenaRead(logArenaWrap(off + LOG_REC_HDR), chunk + fill, len);
+                fill += len;
+                chunk[fill++] = '\n';
+                cursor = seq;
+            }
+            off = logArenaWrap(off + LOG_REC_HDR + len);
+        }
+        portEXIT_CRITICAL(&logMux);
+        resumeOff = off;
+        resumeSeq = seq;
+        if (!fill) break;
+        web.sendContent(chunk, fill);
+    }
+    web.sendContent("");
 }
 
 static void httpActionServerStart(){
@@ -455,9 +1026,8 @@ static void httpActionMqttDiscovery(){
     apiSendJSON(F("{\"ok\":true}"));
 }
 
-static bool valueArgTrimmed(String& out) {
-    if (!web.hasArg("value")) return false;
-    out = web.arg("value");
+static bool valueTrimmed(const String& value, String& out) {
+    out = value;
     out.trim();
     return out.length() > 0;
 }
@@ -506,308 +1076,859 @@ static bool parseFloatStrict(const String& input, float& out) {
     return true;
 }
 
-static inline bool argToFloat(float &out) {
+static inline bool argToFloat(const String &value, float &out) {
     String v;
-    if (!valueArgTrimmed(v)) return false;
+    if (!valueTrimmed(value, v)) return false;
     return parseFloatStrict(v, out);
 }
-static inline bool argToUInt(uint32_t &out) {
+static inline bool argToUInt(const String &value, uint32_t &out) {
     String v;
-    if (!valueArgTrimmed(v)) return false;
+    if (!valueTrimmed(value, v)) return false;
     return parseUInt32Strict(v, out);
 }
-static inline bool argToUShort(uint16_t &out) {
+static inline bool argToUShort(const String &value, uint16_t &out) {
     uint32_t v = 0;
-    if (!argToUInt(v) || v > 65535u) return false;
+    if (!argToUInt(value, v) || v > 65535u) return false;
     out = (uint16_t)v;
     return true;
 }
-static inline bool argToUChar(uint8_t &out) {
+static inline bool argToUChar(const String &value, uint8_t &out) {
     uint32_t v = 0;
-    if (!argToUInt(v) || v > 255u) return false;
+    if (!argToUInt(value, v) || v > 255u) return false;
     out = (uint8_t)v;
     return true;
 }
-static inline bool argToInt(int32_t &out) {
+static inline bool argToInt(const String &value, int32_t &out) {
     String v;
-    if (!valueArgTrimmed(v)) return false;
+    if (!valueTrimmed(value, v)) return false;
     return parseInt32Strict(v, out);
 }
 
-static void httpSet() {
-    if (!requireMutationAuth()) return;
+// Side effects of /api/set, collected while the keys are applied and run once afterwards,
+// so a batch that touches several audio settings restarts I2S only once.
+struct SetEffects {
+    bool save;
+    bool restartI2S;
+    bool minRate;           // recompute the auto packet-rate threshold
+    bool wifiTx;
+    bool power;
+    bool highpass;
+    bool agc;               // restart the AGC loop (target/cap changed, or just enabled)
+    bool recorder;
+    bool timeService;
+    bool timeSyncNow;
+    bool mdns;
+    bool mdnsRestart;       // hostname changed: re-announce under the new name
+    bool mqttReconnect;
+    bool mqttFullState;
+    bool mqttDiscovery;
+};
 
-    if (!web.hasArg("key")) {
-        apiSendJSON(F("{\"ok\":false,\"error\":\"missing_key\"}"));
-        return;
-    }
-
-    String key = web.arg("key");
-    String val = web.hasArg("value") ? web.arg("value") : String("");
-    if (key == "mqtt_pass") {
-        webui_pushLog(F("UI set: mqtt_pass=<hidden>"));
-    } else if (val.length()) {
-        webui_pushLog(String("UI set: ")+key+"="+val);
-    }
+static const uint8_t SET_BATCH_MAX_KEYS = 32;
 
+// Validates one key/value (apply=false) or validates and applies it (apply=true).
+// Returns nullptr on success or the API error code.
+static const char *applySetting(const String &key, const String &val, bool apply, SetEffects &fx) {
     bool handled = false;
     bool applied = false;
 
     if (key == "gain") {
         handled = true;
         float v;
-        if (argToFloat(v) && v >= 0.1f && v <= 100.0f) { currentGainFactor = v; saveAudioSettings(); restartI2S(); applied = true; }
+        if (argToFloat(val, v) && v >= 0.1f && v <= 100.0f) { if (apply) { currentGainFactor = v; fx.save = true; fx.restartI2S = true; } applied = true; }
     }
     else if (key == "rate") {
         handled = true;
         uint32_t v;
-        if (argToUInt(v) && v >= 8000 && v <= 96000) { currentSampleRate = v; if (autoThresholdEnabled) { minAcceptableRate = computeRecommendedMinRate(); } saveAudioSettings(); restartI2S(); applied = true; }
+        if (argToUInt(val, v) && v >= 8000 && v <= 96000) { if (apply) { currentSampleRate = v; fx.minRate = true; fx.save = true; fx.restartI2S = true; } applied = true; }
     }
     else if (key == "buffer") {
         handled = true;
         uint16_t v;
-        if (argToUShort(v) && v >= 256 && v <= 8192) { currentBufferSize = v; if (autoThresholdEnabled) { minAcceptableRate = computeRecommendedMinRate(); } saveAudioSettings(); restartI2S(); applied = true; }
+        if (argToUShort(val, v) && v >= 256 && v <= AUDIO_MAX_BUFFER_SAMPLES) { if (apply) { currentBufferSize = v; fx.minRate = true; fx.save = true; fx.restartI2S = true; } applied = true; }
     }
     else if (key == "shift") {
         handled = true;
         uint8_t v;
-        if (argToUChar(v) && v <= 24) { i2sShiftBits = v; saveAudioSettings(); restartI2S(); applied = true; }
+        if (argToUChar(val, v) && v <= 24) { if (apply) { i2sShiftBits = v; fx.save = true; fx.restartI2S = true; } applied = true; }
+    }
+    else if (key == "i2s_channel") {
+        handled = true;
+        String v = val;
+        if (v == "left" || v == "right") { if (apply) { i2sRightSlot = (v == "right"); fx.save = true; fx.restartI2S = true; } applied = true; }
     }
     else if (key == "wifi_tx") {
         handled = true;
         float v;
-        if (argToFloat(v) && v >= -1.0f && v <= 19.5f) { extern float wifiTxPowerDbm; wifiTxPowerDbm = snapWifiTxDbm(v); applyWifiTxPower(true); saveAudioSettings(); applied = true; }
+        if (argToFloat(val, v) && v >= -1.0f && v <= 19.5f) { if (apply) { extern float wifiTxPowerDbm; wifiTxPowerDbm = snapWifiTxDbm(v); fx.wifiTx = true; fx.save = true; } applied = true; }
     }
     else if (key == "auto_recovery") {
         handled = true;
-        String v = web.arg("value");
-        if (v == "on" || v == "off") { autoRecoveryEnabled = (v == "on"); saveAudioSettings(); applied = true; }
+        String v = val;
+        if (v == "on" || v == "off") { if (apply) { autoRecoveryEnabled = (v == "on"); fx.save = true; } applied = true; }
     }
     else if (key == "thr_mode") {
         handled = true;
-        String v = web.arg("value");
-        if (v == "auto") { autoThresholdEnabled = true; minAcceptableRate = computeRecommendedMinRate(); saveAudioSettings(); applied = true; }
-        else if (v == "manual") { autoThresholdEnabled = false; saveAudioSettings(); applied = true; }
+        String v = val;
+        if (v == "auto") { if (apply) { autoThresholdEnabled = true; fx.minRate = true; fx.save = true; } applied = true; }
+        else if (v == "manual") { if (apply) { autoThresholdEnabled = false; fx.save = true; } applied = true; }
     }
     else if (key == "min_rate") {
         handled = true;
         uint32_t v;
-        if (argToUInt(v) && v >= 5 && v <= 200) { minAcceptableRate = v; saveAudioSettings(); applied = true; }
+        if (argToUInt(val, v) && v >= 5 && v <= 200) { if (apply) { minAcceptableRate = v; fx.save = true; } applied = true; }
     }
     else if (key == "check_interval") {
         handled = true;
         uint32_t v;
-        if (argToUInt(v) && v >= 1 && v <= 60) { performanceCheckInterval = v; saveAudioSettings(); applied = true; }
+        if (argToUInt(val, v) && v >= 1 && v <= 60) { if (apply) { performanceCheckInterval = v; fx.save = true; } applied = true; }
     }
     else if (key == "sched_reset") {
         handled = true;
-        String v = web.arg("value");
-        if (v == "on" || v == "off") { extern bool scheduledResetEnabled; scheduledResetEnabled = (v == "on"); saveAudioSettings(); applied = true; }
+        String v = val;
+        if (v == "on" || v == "off") { if (apply) { extern bool scheduledResetEnabled; scheduledResetEnabled = (v == "on"); fx.save = true; } applied = true; }
     }
     else if (key == "reset_hours") {
         handled = true;
         uint32_t v;
-        if (argToUInt(v) && v >= 1 && v <= 168) { extern uint32_t resetIntervalHours; resetIntervalHours = v; saveAudioSettings(); applied = true; }
+        if (argToUInt(val, v) && v >= 1 && v <= 168) { if (apply) { extern uint32_t resetIntervalHours; resetIntervalHours = v; fx.save = true; } applied = true; }
+    }
+    else if (key == "heap_frag_alert") {
+        handled = true;
+        uint32_t v;
+        if (argToUInt(val, v) && v <= 99) { if (apply) { heapFragAlertPct = (uint8_t)v; if (v == 0) heapFragAlertActive = false; fx.save = true; } applied = true; }
     }
     else if (key == "cpu_freq") {
         handled = true;
         uint32_t v;
-        if (argToUInt(v) && v >= 40 && v <= 160) { cpuFrequencyMhz = (uint8_t)v; setCpuFrequencyMhz(cpuFrequencyMhz); saveAudioSettings(); applied = true; }
+        if (argToUInt(val, v) && v >= 40 && v <= 160) { if (apply) { cpuFrequencyMhz = (uint8_t)v; fx.power = true; fx.save = true; } applied = true; }
+    }
+    else if (key == "power_profile") {
+        handled = true;
+        PowerProfile p;
+        if (power_profileFromName(val, p)) { if (apply) { powerProfile = p; fx.power = true; fx.save = true; } applied = true; }
     }
     else if (key == "hp_enable") {
         handled = true;
-        String v = web.arg("value");
-        if (v == "on" || v == "off") { extern bool highpassEnabled; highpassEnabled = (v == "on"); extern void updateHighpassCoeffs(); updateHighpassCoeffs(); saveAudioSettings(); applied = true; }
+        String v = val;
+        if (v == "on" || v == "off") { if (apply) { extern bool highpassEnabled; highpassEnabled = (v == "on"); fx.highpass = true; fx.save = true; } applied = true; }
     }
     else if (key == "hp_cutoff") {
         handled = true;
         uint32_t v;
-        if (argToUInt(v) && v >= 10 && v <= 10000) { extern uint16_t highpassCutoffHz; highpassCutoffHz = (uint16_t)v; extern void updateHighpassCoeffs(); updateHighpassCoeffs(); saveAudioSettings(); applied = true; }
+        if (argToUInt(val, v) && v >= 10 && v <= 10000) { if (apply) { extern uint16_t highpassCutoffHz; highpassCutoffHz = (uint16_t)v; fx.highpass = true; fx.save = true; } applied = true; }
+    }
+    else if (key == "agc_enable") {
+        handled = true;
+        String v = val;
+        if (v == "on" || v == "off") { if (apply) { agcEnabled = (v == "on"); fx.agc = true; fx.save = true; } applied = true; }
+    }
+    else if (key == "agc_target") {
+        handled = true;
+        float v;
+        if (argToFloat(val, v) && v >= -40.0f && v <= -3.0f) { if (apply) { agcTargetDbfs = v; fx.agc = true; fx.save = true; } applied = true; }
+    }
+    else if (key == "agc_max_gain") {
+        handled = true;
+        float v;
+        if (argToFloat(val, v) && v >= 1.0f && v <= 100.0f) { if (apply) { agcMaxGain = v; fx.agc = true; fx.save = true; } applied = true; }
+    }
+    else if (key == "cal_boot") {
+        handled = true;
+        MicCalBootMode m;
+        if (miccal_bootModeFromName(val, m)) { if (apply) { calBootMode = m; fx.save = true; } applied = true; }
+    }
+    else if (key == "cal_margin") {
+        handled = true;
+        uint8_t v;
+        if (argToUChar(val, v) && v <= CAL_MAX_MARGIN_DB) { if (apply) { calMarginDb = v; fx.save = true; } applied = true; }
+    }
+    else if (key == "rec_enable") {
+        handled = true;
+        String v = val;
+        if (v == "on" || v == "off") { if (apply) { recEnabled = (v == "on"); fx.recorder = true; fx.save = true; } applied = true; }
+    }
+    else if (key == "rec_segment_s") {
+        handled = true;
+        uint16_t v;
+        if (argToUShort(val, v) && v >= 10 && v <= 3600) { if (apply) { recSegmentSec = v; fx.recorder = true; fx.save = true; } applied = true; }
+    }
+    else if (key == "rec_quota_kb") {
+        handled = true;
+        uint32_t v;
+        if (argToUInt(val, v) && v >= 64 && v <= 32UL * 1024 * 1024) { if (apply) { recQuotaKB = v; fx.recorder = true; fx.save = true; } applied = true; }
+    }
+    else if (key == "rec_keep_h") {
+        handled = true;
+        uint16_t v;
+        if (argToUShort(val, v) && v <= 8760) { if (apply) { recKeepHours = v; fx.recorder = true; fx.save = true; } applied = true; }
+    }
+    else if (key == "rec_decimate") {
+        handled = true;
+        uint8_t v;
+        if (argToUChar(val, v) && v >= 1 && v <= 4) { if (apply) { recDecimate = v; fx.recorder = true; fx.save = true; } applied = true; }
+    }
+    else if (key == "http_audio_clients") {
+        handled = true;
+        uint8_t v;
+        if (argToUChar(val, v) && v <= HTTP_AUDIO_MAX_SLOTS) {
+            if (apply) {
+                httpAudioMaxClients = v;
+                if (v == 0) httpaudio_closeAll("disabled");   // disabled: end the streams too
+                fx.save = true;
+            }
+            applied = true;
+        }
+    }
+    else if (key == "filters") {
+        handled = true;
+        FilterSpec specs[FILTER_CHAIN_MAX_SECTIONS];
+        uint8_t count = 0;
+        const char *perr = nullptr;
+        if (filterchain_parse(val, specs, count, perr)) {
+            if (apply) {
+                for (uint8_t i = 0; i < count; i++) filterSpecs[i] = specs[i];
+                filterSpecCount = count;
+                fx.highpass = true;
+                fx.save = true;
+            }
+            applied = true;
+        } else {
+            webui_pushLog(String("UI set: filters rejected (") + perr + ")");
+        }
     }
     else if (key == "oh_enable") {
         handled = true;
-        String v = web.arg("value");
-        if (v == "on" || v == "off") { overheatProtectionEnabled = (v == "on"); if (!overheatProtectionEnabled) { overheatLockoutActive = false; } saveAudioSettings(); applied = true; }
+        String v = val;
+        if (v == "on" || v == "off") { if (apply) { overheatProtectionEnabled = (v == "on"); if (!overheatProtectionEnabled) { overheatLockoutActive = false; } fx.save = true; } applied = true; }
     }
     else if (key == "oh_limit") {
         handled = true;
         uint32_t v;
-        if (argToUInt(v) && v >= OH_MIN && v <= OH_MAX) { uint32_t snapped = OH_MIN + ((v - OH_MIN) / OH_STEP) * OH_STEP; overheatShutdownC = (float)snapped; overheatLockoutActive = false; saveAudioSettings(); applied = true; }
+        if (argToUInt(val, v) && v >= OH_MIN && v <= OH_MAX) { if (apply) { uint32_t snapped = OH_MIN + ((v - OH_MIN) / OH_STEP) * OH_STEP; overheatShutdownC = (float)snapped; overheatLockoutActive = false; fx.save = true; } applied = true; }
     }
     else if (key == "time_offset") {
         handled = true;
         int32_t v;
-        if (argToInt(v) && v >= -720 && v <= 840) { timeOffsetMinutes = v; configureTimeService(timeSyncEnabled); saveAudioSettings(); applied = true; }
+        if (argToInt(val, v) && v >= -720 && v <= 840) { if (apply) { timeOffsetMinutes = v; fx.timeService = true; fx.save = true; } applied = true; }
     }
     else if (key == "time_sync") {
         handled = true;
-        String v = web.arg("value");
+        String v = val;
         if (v == "on" || v == "off") {
-            timeSyncEnabled = (v == "on");
-            configureTimeService(timeSyncEnabled);
-            if (timeSyncEnabled) {
-                attemptTimeSync(false, true);
+            if (apply) {
+                timeSyncEnabled = (v == "on");
+                fx.timeService = true;
+                fx.timeSyncNow = timeSyncEnabled;
+                fx.save = true;
             }
-            saveAudioSettings();
             applied = true;
         }
     }
     else if (key == "stream_sched") {
         handled = true;
-        String v = web.arg("value");
-        if (v == "on" || v == "off") { streamScheduleEnabled = (v == "on"); saveAudioSettings(); applied = true; }
+        String v = val;
+        if (v == "on" || v == "off") { if (apply) { streamScheduleEnabled = (v == "on"); fx.save = true; } applied = true; }
     }
     else if (key == "stream_start_min") {
         handled = true;
         uint32_t v;
-        if (argToUInt(v) && v <= 1439) { streamScheduleStartMin = (uint16_t)v; saveAudioSettings(); applied = true; }
+        if (argToUInt(val, v) && v <= 1439) { if (apply) { streamScheduleStartMin = (uint16_t)v; fx.save = true; } applied = true; }
     }
     else if (key == "stream_stop_min") {
         handled = true;
         uint32_t v;
-        if (argToUInt(v) && v <= 1439) { streamScheduleStopMin = (uint16_t)v; saveAudioSettings(); applied = true; }
+        if (argToUInt(val, v) && v <= 1439) { if (apply) { streamScheduleStopMin = (uint16_t)v; fx.save = true; } applied = true; }
     }
     else if (key == "deep_sleep_sched") {
         handled = true;
-        String v = web.arg("value");
+        String v = val;
         if (v == "on" || v == "off") {
-            deepSleepScheduleEnabled = (v == "on");
-            if (!deepSleepScheduleEnabled) {
-                deepSleepStatusCode = "disabled";
-                deepSleepNextSleepSec = 0;
+            if (apply) {
+                deepSleepScheduleEnabled = (v == "on");
+                if (!deepSleepScheduleEnabled) {
+                    deepSleepStatusCode = "disabled";
+                    deepSleepNextSleepSec = 0;
+                }
+                fx.save = true;
             }
-            saveAudioSettings();
             applied = true;
         }
     }
     else if (key == "mdns_enable") {
         handled = true;
-        String v = web.arg("value");
-        if (v == "on" || v == "off") { mdnsEnabled = (v == "on"); applyMdnsSetting(); saveAudioSettings(); applied = true; }
+        String v = val;
+        if (v == "on" || v == "off") { if (apply) { mdnsEnabled = (v == "on"); fx.mdns = true; fx.save = true; } applied = true; }
     }
     else if (key == "mdns_hostname") {
         handled = true;
-        String v = web.arg("value");
+        String v = val;
         v.trim();
         extern String sanitizeMdnsHostname(const String &input, const String &fallback);
         String next = sanitizeMdnsHostname(v, mdnsHostname);
         if (next.length() > 0) {
-            mdnsHostname = next;
-            if (mdnsRunning) {
-                MDNS.end();
-                mdnsRunning = false;
+            if (apply) {
+                mdnsHostname = next;
+                fx.mdnsRestart = true;
+                fx.save = true;
             }
-            applyMdnsSetting();
-            saveAudioSettings();
             applied = true;
         }
     }
     else if (key == "mqtt_enable") {
         handled = true;
-        String v = web.arg("value");
+        String v = val;
         if (v == "on" || v == "off") {
-            mqttEnabled = (v == "on");
-            saveAudioSettings();
-            mqttRequestReconnect(true);
+            if (apply) {
+                mqttEnabled = (v == "on");
+                fx.save = true;
+                fx.mqttReconnect = true;
+            }
             applied = true;
         }
     }
     else if (key == "mqtt_host") {
         handled = true;
-        String v = web.arg("value");
+        String v = val;
         v.trim();
         if (v.length() <= 96) {
-            mqttHost = v;
-            saveAudioSettings();
-            mqttRequestReconnect(true);
+            if (apply) {
+                mqttHost = v;
+                fx.save = true;
+                fx.mqttReconnect = true;
+            }
             applied = true;
         }
     }
     else if (key == "mqtt_port") {
         handled = true;
         uint32_t v;
-        if (argToUInt(v) && v >= 1 && v <= 65535) {
-            mqttPort = (uint16_t)v;
-            saveAudioSettings();
-            mqttRequestReconnect(true);
+        if (argToUInt(val, v) && v >= 1 && v <= 65535) {
+            if (apply) {
+                mqttPort = (uint16_t)v;
+                fx.save = true;
+                fx.mqttReconnect = true;
+            }
             applied = true;
         }
     }
     else if (key == "mqtt_user") {
         handled = true;
-        String v = web.arg("value");
+        String v = val;
         v.trim();
         if (v.length() <= 96) {
-            mqttUser = v;
-            saveAudioSettings();
-            mqttRequestReconnect(true);
+            if (apply) {
+                mqttUser = v;
+                fx.save = true;
+                fx.mqttReconnect = true;
+            }
             applied = true;
         }
     }
     else if (key == "mqtt_pass") {
         handled = true;
-        String v = web.arg("value");
+        String v = val;
         if (v.length() <= 128) {
-            mqttPassword = v;
-            saveAudioSettings();
-            mqttRequestReconnect(true);
+            if (apply) {
+                mqttPassword = v;
+                fx.save = true;
+                fx.mqttReconnect = true;
+            }
             applied = true;
         }
     }
     else if (key == "mqtt_topic") {
         handled = true;
-        String v = web.arg("value");
+        String v = val;
         v.trim();
         if (v.length() <= 128) {
-            mqttTopicPrefix = v;
-            saveAudioSettings();
-            mqttRequestReconnect(true);
+            if (apply) {
+                mqttTopicPrefix = v;
+                fx.save = true;
+                fx.mqttReconnect = true;
+            }
             applied = true;
         }
     }
     else if (key == "mqtt_discovery") {
         handled = true;
-        String v = web.arg("value");
+        String v = val;
         v.trim();
         if (v.length() <= 128) {
-            mqttDiscoveryPrefix = v;
-            saveAudioSettings();
-            mqttRequestReconnect(true);
+            if (apply) {
+                mqttDiscoveryPrefix = v;
+                fx.save = true;
+                fx.mqttReconnect = true;
+            }
             applied = true;
         }
     }
     else if (key == "mqtt_client_id") {
         handled = true;
-        String v = web.arg("value");
+        String v = val;
         v.trim();
         if (v.length() <= 96) {
-            mqttClientId = v;
-            saveAudioSettings();
-            mqttRequestReconnect(true);
+            if (apply) {
+                mqttClientId = v;
+                fx.save = true;
+                fx.mqttReconnect = true;
+            }
             applied = true;
         }
     }
     else if (key == "mqtt_interval") {
         handled = true;
         uint32_t v;
-        if (argToUInt(v) && v >= 10 && v <= 3600) {
-            mqttPublishIntervalSec = (uint16_t)v;
-            saveAudioSettings();
+        if (argToUInt(val, v) && v >= 10 && v <= 3600) {
+            if (apply) {
+                mqttPublishIntervalSec = (uint16_t)v;
+                fx.save = true;
+            }
             applied = true;
         }
     }
+    else if (key == "mqtt_delta") {
+        handled = true;
+        String v = val;
+        if (v == "on" || v == "off") {
+            if (apply) {
+                mqttDeltaEnabled = (v == "on");
+                fx.save = true;
+                fx.mqttFullState = true;
+            }
+            applied = true;
+        }
+    }
+    else if (key == "mqtt_full_every") {
+        handled = true;
+        uint32_t v;
+        if (argToUInt(val, v) && v >= 1 && v <= 100) {
+            if (apply) {
+                mqttFullEvery = (uint16_t)v;
+                fx.save = true;
+            }
+            applied = true;
+        }
+    }
+    else if (key == "mqtt_msgpack") {
+        handled = true;
+        String v = val;
+        if (v == "on" || v == "off") {
+            if (apply) {
+                mqttMsgpackEnabled = (v == "on");
+                fx.save = true;
+                fx.mqttFullState = true;
+            }
+            applied = true;
+        }
+    }
+    else if (key == "mqtt_profile") {
+        handled = true;
+        String v = val;
+        if (v == "on" || v == "off") {
+            if (apply) {
+                mqttProfileEnabled = (v == "on");
+                fx.save = true;
+                fx.mqttDiscovery = true;
+            }
+            applied = true;
+        }
+    }
+
+
+    if (!handled) return "unknown_key";
+    if (!applied) return "invalid_value";
+    return nullptr;
+}
+
+static void applySetEffects(const SetEffects &fx) {
+    if (fx.minRate && autoThresholdEnabled) minAcceptableRate = computeRecommendedMinRate();
+    if (fx.power) applyPowerProfile();
+    if (fx.wifiTx) applyWifiTxPower(true);
+    if (fx.highpass) updateHighpassCoeffs();
+    if (fx.agc) updateAgcConfig();
+    if (fx.recorder) updateRecorderConfig();
+    if (fx.timeService) {
+        configureTimeService(timeSyncEnabled);
+        if (fx.timeSyncNow && timeSyncEnabled) attemptTimeSync(false, true);
+    }
+    if (fx.mdnsRestart && mdnsRunning) {
+        MDNS.end();
+        mdnsRunning = false;
+    }
+    if (fx.mdns || fx.mdnsRestart) applyMdnsSetting();
+    if (fx.save) saveAudioSettings();
+    if (fx.restartI2S) restartI2S();
+    if (fx.mqttReconnect) mqttRequestReconnect(true);
+    if (fx.mqttFullState) mqttRequestFullState();
+    if (fx.mqttDiscovery) mqttRefreshDiscovery();
+}
+
+static void logSetting(const String &key, const String &val) {
+    if (key == "mqtt_pass") {
+        webui_pushLog(F("UI set: mqtt_pass=<hidden>"));
+    } else if (val.length()) {
+        webui_pushLog(String("UI set: ")+key+"="+val);
+    }
+}
+
+// Single setting:  key=<name>&value=<value>
+// Batch:           <name>=<value>&<name>=<value>...  (no "key" argument)
+// A batch is all-or-nothing: every pair is validated before the first one is applied, and the
+// side effects (I2S restart, MQTT reconnect, one settings flush) run once for the whole batch.
+static void httpSet() {
+    if (!requireMutationAuth()) return;
+
+    SetEffects fx = {};
+    if (web.hasArg("key")) {
+        String key = web.arg("key");
+        String val = web.hasArg("value") ? web.arg("value") : String("");
+        logSetting(key, val);
+        const char *err = applySetting(key, val, true, fx);
+        if (err) {
+            apiSendJSON(String("{\"ok\":false,\"error\":\"") + err + "\"}");
+            return;
+        }
+        applySetEffects(fx);
+        apiSendJSON(F("{\"ok\":true}"));
+        return;
+    }
+
+    uint8_t count = 0;
+    for (int i = 0; i < web.args(); i++) {
+        String key = web.argName(i);
+        if (key == "plain") continue;   // raw request body
+        if (++count > SET_BATCH_MAX_KEYS) {
+            apiSendJSON(F("{\"ok\":false,\"error\":\"too_many_keys\"}"));
+            return;
+        }
+        String val = web.arg(i);
+        logSetting(key, val);
+        const char *err = applySetting(key, val, false, fx);
+        if (err) {
+            apiSendJSON(String("{\"ok\":false,\"error\":\"") + err + "\",\"key\":\"" + jsonEscape(key) + "\"}");
+            return;
+        }
+    }
+    if (count == 0) {
+        apiSendJSON(F("{\"ok\":false,\"error\":\"missing_key\"}"));
+        return;
+    }
+    for (int i = 0; i < web.args(); i++) {
+        String key = web.argName(i);
+        if (key == "plain") continue;
+        applySetting(key, web.arg(i), true, fx);
+    }
+    applySetEffects(fx);
+    apiSendJSON(String("{\"ok\":true,\"applied\":") + String(count) + "}");
+}
+
+// Self-benchmark (AudioBench.h): GET reports progress and results, /start and /stop control it.
+static void httpBench() {
+    static const char *const stateNames[] = {"idle", "running", "done", "failed"};
+    extern bool highpassEnabled; extern uint16_t highpassCutoffHz;
+    const BenchStatus &b = benchStatus;
+    uint32_t now = millis();
+    String json = "{\"state\":\"" + String(stateNames[b.state]) + "\",";
+    json += "\"error\":" + (b.error ? "\"" + String(b.error) + "\"" : String("null")) + ",";
+    json += "\"runs\":" + String(b.runs) + ",";
+    if (b.runs == 0) {
+        json += "\"cases\":[]}";
+        apiSendJSON(json);
+        return;
+    }
+    json += "\"signal\":\"" + String(bench_signalName(b.signal)) + "\",";
+    json += "\"sink\":\"" + String(bench_sinkName(b.sink)) + "\",";
+    json += "\"case_ms\":" + String(b.caseMs) + ",";
+    json += "\"progress\":" + String(b.state == BENCH_DONE ? b.caseCount : b.current) + ",";
+    json += "\"case_count\":" + String(b.caseCount) + ",";
+    json += "\"elapsed_ms\":" + String((b.state == BENCH_RUNNING ? now : b.finishedMs) - b.startedMs) + ",";
+    json += "\"cpu_mhz\":" + String(b.cpuMhz) + ",";
+    json += "\"rt_limit_pct\":" + String(BENCH_RT_LIMIT_PCT) + ",";
+    json += "\"sample_rate\":" + String(currentSampleRate) + ",";
+    json += "\"gain\":" + String(currentGainFactor, 2) + ",";
+    json += "\"agc_enable\":" + String(agcEnabled ? "true" : "false") + ",";
+    json += "\"shift\":" + String(i2sShiftBits) + ",";
+    json += "\"hp_enable\":" + String(highpassEnabled ? "true" : "false") + ",";
+    json += "\"hp_cutoff_hz\":" + String((uint32_t)highpassCutoffHz) + ",";
+    json += "\"cases\":[";
+    for (uint8_t i = 0; i < b.caseCount; i++) {
+        const BenchCase &c = b.cases[i];
+        if (i) json += ",";
+        json += "{\"sink\":\"" + String(bench_sinkName(c.sink)) + "\",";
+        json += "\"buffer\":" + String(c.buffer) + ",";
+        json += "\"blocks\":" + String(c.blocks) + ",";
+        json += "\"run_ms\":" + String(c.runMs) + ",";
+        json += "\"samples_per_s\":" + String((uint32_t)bench_samplesPerSec(c)) + ",";
+        json += "\"load_cycles_per_block\":" + String(bench_loadCyclesPerBlock(c)) + ",";
+        json += "\"cycles_per_sample\":" + String(c.blocks ? (float)bench_loadCyclesPerBlock(c) / c.buffer : 0.0f, 2) + ",";
+        json += "\"cpu_pct\":" + String(bench_cpuPct(c, currentSampleRate), 1) + ",";
+        json += "\"max_rate\":" + String(bench_maxRate(c)) + ",";
+        json += "\"sink_errors\":" + String(c.sinkErrors) + ",";
+        json += "\"cycles\":{";
+        for (uint8_t st = 0; st < BENCH_STAGE_COUNT; st++) {
+            if (st) json += ",";
+            json += "\"" + String(bench_stageName(st)) + "\":{\"avg\":" +
+                    String(c.blocks ? (uint32_t)(c.stage[st].cycles / c.blocks) : 0) +
+                    ",\"max\":" + String(c.stage[st].maxCycles) + "}";
+        }
+        json += "}}";
+    }
+    json += "]}";
+    apiSendJSON(json);
+}
 
-    if (!handled) {
-        apiSendJSON(F("{\"ok\":false,\"error\":\"unknown_key\"}"));
+static void httpBenchStart() {
+    if (!requireMutationAuth()) return;
+    BenchSignal signal = BENCH_SWEEP;
+    BenchSink sink = BENCH_SINK_LOOPBACK;
+    uint32_t caseMs = BENCH_CASE_MS;
+    uint16_t port = 0;
+    String host;
+    if (web.hasArg("signal") && !bench_signalFromName(web.arg("signal"), signal)) {
+        apiSendJSON(F("{\"ok\":false,\"error\":\"invalid_signal\"}"));
+        return;
+    }
+    if (web.hasArg("sink") && !bench_sinkFromName(web.arg("sink"), sink)) {
+        apiSendJSON(F("{\"ok\":false,\"error\":\"invalid_sink\"}"));
+        return;
+    }
+    if (web.hasArg("case_ms") && (!argToUInt(web.arg("case_ms"), caseMs) || caseMs < 200 || caseMs > 10000)) {
+        apiSendJSON(F("{\"ok\":false,\"error\":\"invalid_case_ms\"}"));
         return;
     }
-    if (!applied) {
-        apiSendJSON(F("{\"ok\":false,\"error\":\"invalid_value\"}"));
+    if (sink == BENCH_SINK_TCP) {
+        host = web.arg("host");
+        host.trim();
+        if (host.length() == 0 || !argToUShort(web.arg("port"), port) || port == 0) {
+            apiSendJSON(F("{\"ok\":false,\"error\":\"invalid_target\"}"));
+            return;
+        }
+    }
+    const char *err = nullptr;
+    if (!benchStart(signal, sink, host, port, (uint16_t)caseMs, err)) {
+        apiSendJSON(String("{\"ok\":false,\"error\":\"") + err + "\"}");
         return;
     }
+    webui_pushLog(String("UI action: bench_start ") + bench_signalName(signal) + " " + bench_sinkName(sink));
+    apiSendJSON(String("{\"ok\":true,\"cases\":") + String(benchStatus.caseCount) + ",\"eta_s\":" +
+                String((benchStatus.caseCount * caseMs + 999) / 1000) + "}");
+}
+
+static void httpBenchStop() {
+    if (!requireMutationAuth()) return;
+    benchStop(BENCH_FAILED, "stopped");
+    webui_pushLog(F("UI action: bench_stop"));
     apiSendJSON(F("{\"ok\":true}"));
 }
 
+static void httpCalibration() {
+    const MicCalStatus &c = micCalStatus;
+    String json = "{";
+    json += "\"state\":\"" + String(miccal_stateName(c.state)) + "\",";
+    json += "\"error\":" + (c.error ? "\"" + String(c.error) + "\"" : String("null")) + ",";
+    json += "\"runs\":" + String(c.runs) + ",";
+    json += "\"boot_mode\":\"" + String(miccal_bootModeName(calBootMode)) + "\",";
+    json += "\"margin_db\":" + String(c.runs ? c.marginDb : calMarginDb) + ",";
+    json += "\"boot\":" + String(c.boot ? "true" : "false") + ",";
+    json += "\"apply\":" + String(c.apply ? "true" : "false") + ",";
+    json += "\"seconds\":" + String(c.seconds) + ",";
+    json += "\"progress_pct\":" + String(c.samplesWanted ? (uint32_t)((uint64_t)c.samples * 100 / c.samplesWanted) : 0) + ",";
+    json += "\"sample_rate\":" + String(c.sampleRate) + ",";
+    json += "\"current_shift\":" + String(i2sShiftBits) + ",";
+    json += "\"current_gain\":" + String(currentGainFactor, 2);
+    if (c.state == MICCAL_DONE) {
+        json += ",\"samples\":" + String(c.samples);
+        json += ",\"dc_offset\":" + String((int32_t)c.dcOffset);
+        json += ",\"dc_dbfs\":" + String(c.dcDbfs, 1);
+        json += ",\"peak_dbfs\":" + String(c.peakDbfs, 1);
+        json += ",\"ac_peak_dbfs\":" + String(c.acPeakDbfs, 1);
+        json += ",\"peak_basis\":\"" + String(c.acPeak ? "ac" : "absolute") + "\"";
+        json += ",\"noise_floor_dbfs\":" + String(c.noiseDbfs, 1);
+        json += ",\"dynamic_range_db\":" + String(c.dynamicRangeDb, 1);
+        json += ",\"proposed_shift\":" + String(c.shift);
+        json += ",\"proposed_gain\":" + String(c.gain, 2);
+        json += ",\"peak_out_dbfs\":" + String(c.peakOutDbfs, 1);
+        json += ",\"noise_out_dbfs\":" + String(c.noiseOutDbfs, 1);
+        json += ",\"noise_below_lsb\":" + String(c.noiseBelowLsb ? "true" : "false");
+        json += ",\"previous_shift\":" + String(c.prevShift);
+        json += ",\"previous_gain\":" + String(c.prevGain, 2);
+        json += ",\"applied\":" + String(c.applied ? "true" : "false");
+    }
+    json += "}";
+    apiSendJSON(json);
+}
+
+// Body: apply=1 (default: propose only), margin_db=<0..40>, seconds=<1..30>
+static void httpActionCalibrate() {
+    if (!requireMutationAuth()) return;
+    uint32_t margin = calMarginDb;
+    uint32_t seconds = CAL_DEFAULT_SECONDS;
+    if (web.hasArg("margin_db") && (!argToUInt(web.arg("margin_db"), margin) || margin > CAL_MAX_MARGIN_DB)) {
+        apiSendJSON(F("{\"ok\":false,\"error\":\"invalid_margin\"}"));
+        return;
+    }
+    if (web.hasArg("seconds") && (!argToUInt(web.arg("seconds"), seconds) || seconds < 1 || seconds > CAL_MAX_SECONDS)) {
+        apiSendJSON(F("{\"ok\":false,\"error\":\"invalid_seconds\"}"));
+        return;
+    }
+    bool apply = web.arg("apply") == "1";
+    const char *err = nullptr;
+    if (!calStart(apply, (uint8_t)margin, (uint16_t)seconds, false, err)) {
+        apiSendJSON(String("{\"ok\":false,\"error\":\"") + err + "\"}");
+        return;
+    }
+    webui_pushLog(String("UI action: calibrate") + (apply ? " apply" : ""));
+    apiSendJSON(String("{\"ok\":true,\"eta_s\":") + String(seconds + 1) + "}");
+}
+
+static const char *const REC_BENCH_STATE_NAMES[] = {"idle", "running", "done", "failed"};
+
+static void recordingListEntry(const RecorderSegmentEntry &e, void *ctx) {
+    String &json = *static_cast<String *>(ctx);
+    if (json[json.length() - 1] != '[') json += ",";
+    json += "{\"seq\":" + String(e.seq);
+    json += ",\"bytes\":" + String(e.fileBytes);
+    json += ",\"sample_rate\":" + String(e.sampleRate);
+    json += ",\"duration_s\":" + String(e.sampleRate ? (float)e.samples / e.sampleRate : 0.0f, 1);
+    json += ",\"start_epoch\":" + String(e.startEpoch);
+    json += ",\"open\":" + String(e.open ? "true" : "false") + "}";
+}
+
+// Recorder status and segment list. ?from=<seq> (default: oldest), ?limit=<n> (default 50, max 500)
+static void httpRecordings() {
+    RecorderStats r;
+    recorder_getStats(r);
+    uint32_t from = 0, limit = 50;
+    if (web.hasArg("from")) argToUInt(web.arg("from"), from);
+    if (web.hasArg("limit") && argToUInt(web.arg("limit"), limit) && limit > 500) limit = 500;
+    String json = "{";
+    json += "\"enable\":" + String(recEnabled ? "true" : "false") + ",";
+    json += "\"mounted\":" + String(r.mounted ? "true" : "false") + ",";
+    json += "\"storage\":\"" + String(r.sdCard ? "sd" : "littlefs") + "\",";
+    json += "\"recording\":" + String(r.recording ? "true" : "false") + ",";
+    json += "\"full\":" + String(r.full ? "true" : "false") + ",";
+    json += "\"sample_rate\":" + String(r.sampleRate) + ",";
+    json += "\"segment_s\":" + String(recSegmentSec) + ",";
+    json += "\"quota_kb\":" + String(recQuotaKB) + ",";
+    json += "\"keep_h\":" + String(recKeepHours) + ",";
+    json += "\"decimate\":" + String(recDecimate) + ",";
+    json += "\"segments\":" + String(r.segments) + ",";
+    json += "\"used_kb\":" + String((uint32_t)(r.bytes / 1024)) + ",";
+    json += "\"fs_total_kb\":" + String((uint32_t)(r.fsTotal / 1024)) + ",";
+    json += "\"fs_used_kb\":" + String((uint32_t)(r.fsUsed / 1024)) + ",";
+    json += "\"oldest_seq\":" + String(r.oldestSeq) + ",";
+    json += "\"newest_seq\":" + String(r.newestSeq) + ",";
+    json += "\"pages_written\":" + String(r.pagesWritten) + ",";
+    json += "\"pages_dropped\":" + String(r.pagesDropped) + ",";
+    json += "\"write_errors\":" + String(r.writeErrors) + ",";
+    json += "\"write_last_us\":" + String(r.writeLastUs) + ",";
+    json += "\"write_max_us\":" + String(r.writeMaxUs) + ",";
+    json += "\"segments_deleted\":" + String(r.segmentsDeleted) + ",";
+    json += "\"segments_repaired\":" + String(r.segmentsRepaired) + ",";
+    json += "\"bench\":{\"state\":\"" + String(REC_BENCH_STATE_NAMES[r.benchState]) + "\",";
+    json += "\"error\":" + (r.benchError ? "\"" + String(r.benchError) + "\"" : String("null")) + ",";
+    json += "\"kb\":" + String(r.benchKB) + ",";
+    json += "\"write_kbps\":" + String(r.benchWriteKBps) + ",";
+    json += "\"read_kbps\":" + String(r.benchReadKBps) + ",";
+    json += "\"avg_write_us\":" + String(r.benchAvgWriteUs) + ",";
+    json += "\"max_write_us\":" + String(r.benchMaxWriteUs) + "},";
+    json += "\"list\":[";
+    recorder_list(from, limit, recordingListEntry, &json);
+    json += "]}";
+    apiSendJSON(json);
+}
+
+// Segment download: ?seq=<n>, WAV (IMA ADPCM), single-range support as for the journal
+static void httpRecording() {
+    uint32_t seq = 0, total = 0;
+    if (!argToUInt(web.arg("seq"), seq) || !recorder_segmentSize(seq, total)) {
+        web.send(404, "text/plain", "no such segment (or still recording)");
+        return;
+    }
+    size_t start = 0, end = total ? total - 1 : 0;
+    bool partial = false;
+    if (web.hasHeader(UI_RANGE_HEADER)) {
+        if (!parseByteRange(web.header(UI_RANGE_HEADER), total, start, end)) {
+            web.sendHeader("Content-Range", String("bytes */") + String(total));
+            web.send(416, "text/plain", "");
+            return;
+        }
+        partial = true;
+    }
+    size_t len = total ? end - start + 1 : 0;
+    if (web.hasArg("download")) {
+        web.sendHeader("Content-Disposition", "attachment; filename=\"esp32mic-rec-" + String(seq) + ".wav\"");
+    }
+    web.sendHeader("Cache-Control", "no-cache");
+    web.sendHeader("Accept-Ranges", "bytes");
+    if (partial) {
+        web.sendHeader("Content-Range", String("bytes ") + String(start) + "-" + String(end) + "/" + String(total));
+    }
+    web.setContentLength(len);
+    web.send(partial ? 206 : 200, "audio/wav", "");
+    if (len) recorder_read(seq, start, len, journalSink, nullptr);
+}
+
+// Body: seq=<n> or all=1 (the segment being written is kept)
+static void httpActionRecDelete() {
+    if (!requireMutationAuth()) return;
+    uint32_t seq = 0;
+    if (web.arg("all") == "1") {
+        uint32_t n = recorder_removeAll();
+        webui_pushLog("UI action: rec_delete all (" + String(n) + ")");
+        apiSendJSON(String("{\"ok\":true,\"deleted\":") + String(n) + "}");
+        return;
+    }
+    if (!argToUInt(web.arg("seq"), seq) || !recorder_remove(seq)) {
+        apiSendJSON(F("{\"ok\":false,\"error\":\"not_found\"}"));
+        return;
+    }
+    webui_pushLog("UI action: rec_delete " + String(seq));
+    apiSendJSON(F("{\"ok\":true,\"deleted\":1}"));
+}
+
+// Write-throughput benchmark of the recording storage. Body: kb=<16..4096> (default 256)
+static void httpActionRecBench() {
+    if (!requireMutationAuth()) return;
+    uint32_t kb = REC_BENCH_DEFAULT_KB;
+    if (web.hasArg("kb") && (!argToUInt(web.arg("kb"), kb) || kb < 16 || kb > 4096)) {
+        apiSendJSON(F("{\"ok\":false,\"error\":\"invalid_kb\"}"));
+        return;
+    }
+    recorder_pause(500);      // resumes on its own once the bench is done
+    const char *err = nullptr;
+    if (!recorder_benchStart(kb, err)) {
+        apiSendJSON(String("{\"ok\":false,\"error\":\"") + err + "\"}");
+        return;
+    }
+    webui_pushLog("UI action: rec_bench " + String(kb) + " KB");
+    apiSendJSON(F("{\"ok\":true}"));
+}
+
+// Live audio over chunked HTTP: the socket is handed to HttpAudio.cpp and fed from the capture
+// path, this handler only answers when it is refused.
+static void httpLiveAudio(bool wav) {
+    WiFiClient client = web.client();
+    const char *err = nullptr;
+    if (benchStatus.state == BENCH_RUNNING) {   // the bench replaces capture: nothing to send
+        web.sendHeader("Retry-After", "10");
+        web.send(503, "text/plain", "audio bench_running");
+        return;
+    }
+    if (!httpaudio_attach(client, wav, currentSampleRate, httpAudioMaxClients, err)) {
+        if (!strcmp(err, "send_failed")) return;
+        if (!strcmp(err, "busy")) web.sendHeader("Retry-After", "10");
+        web.send(!strcmp(err, "busy") ? 503 : 403, "text/plain", String("audio ") + err);
+        return;
+    }
+    webui_pushLog("HTTP audio: " + client.remoteIP().toString() + (wav ? " on /audio.wav (" : " on /audio.pcm (") +
+                  String(httpaudio_clients()) + "/" + String(httpAudioMaxClients) + ")");
+}
+
+static void httpAudioWav() { httpLiveAudio(true); }
+static void httpAudioPcm() { httpLiveAudio(false); }
+
 static void httpActionReboot(){
     if (!requireMutationAuth()) return;
 
@@ -826,9 +1947,15 @@ static void httpActionFactoryReset(){
 
 void webui_begin() {
     web.on("/", httpIndex);
+    web.on("/app.js", httpAppJs);
+    web.on("/app.css", httpAppCss);
     web.on("/api/status", httpStatus);
     web.on("/api/audio_status", httpAudioStatus);
     web.on("/api/perf_status", httpPerfStatus);
+    web.on("/api/profile", httpProfile);
+    web.on("/api/profile/reset", HTTP_POST, httpProfileReset);
+    web.on("/api/jobs", httpJobs);
+    web.on("/api/jobs/reset", HTTP_POST, httpJobsReset);
     web.on("/api/thermal", httpThermal);
     web.on("/api/thermal/clear", HTTP_POST, httpThermalClear);
     web.on("/api/logs", httpLogs);
@@ -842,8 +1969,19 @@ void webui_begin() {
     web.on("/api/action/reboot", HTTP_POST, httpActionReboot);
     web.on("/api/action/factory_reset", HTTP_POST, httpActionFactoryReset);
     web.on("/api/set", HTTP_POST, httpSet);
-    static const char* headerKeys[] = { UI_MUTATION_HEADER };
-    web.collectHeaders(headerKeys, 1);
+    web.on("/api/bench", HTTP_GET, httpBench);
+    web.on("/api/bench/start", HTTP_POST, httpBenchStart);
+    web.on("/api/bench/stop", HTTP_POST, httpBenchStop);
+    web.on("/api/calibration", HTTP_GET, httpCalibration);
+    web.on("/api/action/calibrate", HTTP_POST, httpActionCalibrate);
+    web.on("/api/recordings", HTTP_GET, httpRecordings);
+    web.on("/api/recording", HTTP_GET, httpRecording);
+    web.on("/api/action/rec_delete", HTTP_POST, httpActionRecDelete);
+    web.on("/api/action/rec_bench", HTTP_POST, httpActionRecBench);
+    web.on("/audio.wav", HTTP_GET, httpAudioWav);
+    web.on("/audio.pcm", HTTP_GET, httpAudioPcm);
+    static const char* headerKeys[] = { UI_MUTATION_HEADER, UI_IF_NONE_MATCH_HEADER, UI_RANGE_HEADER };
+    web.collectHeaders(headerKeys, 3);
     web.begin();
 }
 
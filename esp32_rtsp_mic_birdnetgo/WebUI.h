@@ -5,5 +5,14 @@
 void webui_begin();
 void webui_handleClient();
 
+// Size of the Web UI log arena in bytes (override with -DWEBUI_LOG_ARENA_BYTES=...)
+#ifndef WEBUI_LOG_ARENA_BYTES
+#define WEBUI_LOG_ARENA_BYTES 12288
+#endif
+// Longest log line kept by the arena (longer lines are truncated)
+#define WEBUI_LOG_LINE_MAX 512
+
 // Push a log line from main into the Web UI ring buffer
 void webui_pushLog(const String &line);
+// Same, composed from two parts (e.g. timestamp prefix + message) without a temporary String
+void webui_pushLog(const char *prefix, size_t prefixLen, const char *text, size_t textLen);
@@ -2,1338 +2,1595 @@
 #include <Arduino.h>
 #include <pgmspace.h>
 
+// Generated by tools/gen_webui_gzip_header.sh from webui/ - do not edit.
+
 static const uint8_t WEBUI_INDEX_GZ[] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xec, 0x3c,
-  0x6b, 0x72, 0xdb, 0x48, 0x73, 0x57, 0xc1, 0x67, 0xd7, 0x2e, 0xc4, 0x14,
-  0x48, 0x81, 0xe0, 0x43, 0x24, 0x24, 0x31, 0xf1, 0xda, 0xeb, 0xb5, 0xab,
-  0x6c, 0xaf, 0x62, 0x79, 0xf3, 0xa5, 0x6a, 0x6b, 0xa3, 0x02, 0x81, 0x21,
-  0x89, 0x08, 0x04, 0xf0, 0x01, 0x03, 0x8a, 0x5a, 0x16, 0xab, 0x72, 0x8b,
-  0xdc, 0x20, 0x17, 0xc9, 0x4d, 0x72, 0x92, 0x74, 0xcf, 0x0c, 0xde, 0x00,
-  0x01, 0x92, 0x72, 0xea, 0xfb, 0x11, 0x3f, 0x48, 0x62, 0x1e, 0xdd, 0x3d,
-  0xfd, 0x9e, 0x1e, 0x00, 0x37, 0x7f, 0xb1, 0x3c, 0x93, 0x3e, 0xfb, 0x44,
-  0x5a, 0xd1, 0xb5, 0x33, 0xbb, 0x11, 0x9f, 0xc4, 0xb0, 0x66, 0x37, 0x6b,
-  0x42, 0x0d, 0xc9, 0x5c, 0x19, 0x41, 0x48, 0xe8, 0xad, 0x1c, 0xd1, 0x45,
-  0x77, 0x22, 0x8b, 0x56, 0xd7, 0x58, 0x93, 0x5b, 0x79, 0x63, 0x93, 0x27,
-  0xdf, 0x0b, 0xa8, 0x2c, 0x99, 0x9e, 0x4b, 0x89, 0x0b, 0xa3, 0x9e, 0x6c,
-  0x8b, 0xae, 0x6e, 0x2d, 0xb2, 0xb1, 0x4d, 0xd2, 0x65, 0x17, 0x8a, 0xed,
-  0xda, 0xd4, 0x36, 0x9c, 0x6e, 0x68, 0x1a, 0x0e, 0xb9, 0xed, 0xe7, 0x41,
-  0x98, 0x9e, 0xe3, 0x05, 0xd0, 0xb5, 0x22, 0x6b, 0x92, 0x01, 0xe3, 0xd8,
-  0xcb, 0x15, 0x95, 0x2c, 0x23, 0x78, 0x84, 0xe1, 0xd4, 0xa6, 0x0e, 0x99,
-  0xfd, 0x7c, 0x7f, 0x37, 0xd0, 0xa4, 0xaf, 0xdf, 0xee, 0xef, 0xa4, 0xcf,
-  0xb6, 0x29, 0x2d, 0xbc, 0x40, 0xfa, 0xc9, 0x0e, 0xac, 0x2f, 0x3f, 0x7f,
-  0xeb, 0xfe, 0xe2, 0xdd, 0x5c, 0xf2, 0x41, 0x37, 0x21, 0x7d, 0x86, 0x2f,
-  0x3d, 0xf0, 0x3c, 0xba, 0xcb, 0xc2, 0xd6, 0x53, 0x88, 0xd7, 0xdd, 0xee,
-  0x7c, 0xa9, 0xbf, 0x5e, 0x8c, 0x17, 0x57, 0x8b, 0x39, 0xbb, 0xd0, 0xf4,
-  0xd7, 0x84, 0x2c, 0xb4, 0xc5, 0x04, 0xae, 0x16, 0xd0, 0xa5, 0x2e, 0xfa,
-  0x57, 0x9a, 0x01, 0x17, 0xeb, 0x88, 0x12, 0x4b, 0x7f, 0x3d, 0xd2, 0xc6,
-  0xea, 0xd5, 0x14, 0xae, 0x4d, 0x23, 0xb0, 0xf4, 0x60, 0x39, 0x37, 0x2e,
-  0xb4, 0xd1, 0x48, 0x89, 0xff, 0xf7, 0x26, 0x93, 0x8e, 0xe8, 0xd4, 0x2a,
-  0x7a, 0xaf, 0x34, 0xec, 0x9d, 0x7b, 0x81, 0x45, 0x02, 0xde, 0xdd, 0x87,
-  0x9e, 0x81, 0x32, 0xd4, 0x94, 0x5e, 0x9f, 0xf5, 0x19, 0xa6, 0x09, 0x48,
-  0x89, 0x31, 0x22, 0x53, 0x7e, 0x05, 0x04, 0xf5, 0xd5, 0xf9, 0x74, 0xd2,
-  0x87, 0xcb, 0x27, 0x23, 0x70, 0x81, 0xda, 0xd1, 0x94, 0xa8, 0x8c, 0x5a,
-  0x03, 0x08, 0x22, 0x8b, 0x21, 0xfc, 0x81, 0xab, 0x70, 0x65, 0x58, 0xde,
-  0x93, 0xae, 0x4a, 0xfd, 0xa1, 0xbf, 0x95, 0x06, 0xf8, 0x51, 0xc4, 0xa0,
-  0x76, 0x92, 0x71, 0x1a, 0x0c, 0x9c, 0xc0, 0x90, 0xfe, 0xa4, 0x3c, 0x4e,
-  0x65, 0x6b, 0x08, 0x00, 0x58, 0xb1, 0x63, 0x20, 0x3a, 0xb4, 0x52, 0xcf,
-  0x08, 0x7b, 0x16, 0x36, 0x71, 0xaa, 0x98, 0x72, 0xa5, 0x76, 0xf6, 0xff,
-  0xb4, 0x26, 0x96, 0x6d, 0x48, 0x17, 0x7e, 0x40, 0x16, 0x24, 0x08, 0xbb,
-  0x39, 0x89, 0xa0, 0x2c, 0x3a, 0x3b, 0x2e, 0x2a, 0x2e, 0x12, 0xf5, 0x4a,
-  0x35, 0xfa, 0xc3, 0x58, 0x24, 0xea, 0xbc, 0x3f, 0x1e, 0x68, 0x42, 0x24,
-  0x64, 0x02, 0x12, 0x32, 0x53, 0x91, 0x18, 0x57, 0xf3, 0x81, 0x39, 0xcf,
-  0x89, 0x24, 0x25, 0xec, 0x4a, 0x2d, 0xc8, 0x23, 0xed, 0x1a, 0x8d, 0x8a,
-  0xc2, 0xd0, 0xb4, 0x31, 0x74, 0x6a, 0x8a, 0x36, 0x54, 0x81, 0x5b, 0xc3,
-  0x4e, 0x8e, 0xab, 0xc8, 0xa8, 0x61, 0xc2, 0x55, 0x55, 0xc1, 0xbf, 0x02,
-  0x46, 0xca, 0xd2, 0xbe, 0x0a, 0x03, 0x34, 0xad, 0x30, 0x6a, 0xa8, 0xe6,
-  0x18, 0x9a, 0xe3, 0x8d, 0x3a, 0xcc, 0xf3, 0x34, 0xdf, 0x39, 0x3e, 0xc4,
-  0x56, 0x98, 0xba, 0xdf, 0x33, 0xa6, 0xfd, 0x6e, 0x19, 0xd4, 0xe8, 0x52,
-  0xe4, 0xa5, 0x30, 0x18, 0xf9, 0x8f, 0x0a, 0x9d, 0xff, 0xfb, 0x53, 0xf7,
-  0xbf, 0x73, 0xa5, 0x2d, 0x33, 0x97, 0xf9, 0xa1, 0x02, 0x6f, 0x33, 0x9e,
-  0xe4, 0xff, 0xd5, 0xb6, 0x9d, 0xda, 0xfe, 0xc3, 0x6e, 0xee, 0x6d, 0xbb,
-  0xa1, 0xfd, 0xa7, 0xed, 0x2e, 0x75, 0xbe, 0x16, 0x58, 0xd2, 0x76, 0x3f,
-  0xf7, 0xac, 0xe7, 0xdd, 0x02, 0x5c, 0x7f, 0x77, 0x61, 0xac, 0x6d, 0xe7,
-  0x59, 0x8f, 0x6c, 0x40, 0x12, 0xb9, 0x16, 0xb1, 0x94, 0x57, 0xf7, 0xef,
-  0xa5, 0xbb, 0xc0, 0x93, 0xbe, 0xf2, 0xeb, 0x57, 0xd0, 0x40, 0x96, 0x1e,
-  0x91, 0x7e, 0xfb, 0x28, 0xfd, 0x8b, 0x11, 0xd8, 0xc6, 0xdc, 0x21, 0x99,
-  0xb6, 0x57, 0x4a, 0xf8, 0x1c, 0x52, 0xb2, 0xee, 0x46, 0xb6, 0xd2, 0x35,
-  0x7c, 0xdf, 0x21, 0x5d, 0xde, 0xa0, 0x84, 0x86, 0x1b, 0x76, 0x43, 0x12,
-  0xd8, 0x8b, 0xeb, 0xb5, 0x11, 0x2c, 0x6d, 0x57, 0x57, 0xaf, 0x99, 0x3c,
-  0xf5, 0x8d, 0x11, 0x5c, 0xa0, 0xb0, 0x3a, 0xd7, 0x73, 0xc3, 0x7c, 0x5c,
-  0x32, 0xc4, 0x7a, 0x60, 0x58, 0x18, 0xb2, 0x96, 0xf8, 0x0d, 0x01, 0xe9,
-  0xa2, 0xdf, 0x57, 0x91, 0x5b, 0x57, 0xec, 0xd3, 0xa0, 0x52, 0x5f, 0xfb,
-  0x41, 0xea, 0xf6, 0xd5, 0x1f, 0x14, 0x2e, 0xa7, 0xa1, 0xd2, 0x1f, 0xa3,
-  0xac, 0x06, 0x20, 0x8a, 0x49, 0x47, 0xa1, 0x01, 0x60, 0xf3, 0x8d, 0x00,
-  0x66, 0x4a, 0x63, 0xf5, 0x87, 0x8e, 0x52, 0x04, 0x37, 0xcd, 0x43, 0x9b,
-  0xaa, 0x00, 0x4d, 0x4b, 0xa0, 0x8d, 0x95, 0xfe, 0x64, 0xa4, 0xf4, 0xb5,
-  0x29, 0x40, 0x1b, 0xe7, 0xa1, 0x8d, 0x46, 0x00, 0xcd, 0xb1, 0x5d, 0x62,
-  0x04, 0x19, 0xe2, 0x26, 0xaa, 0x45, 0x96, 0x0a, 0x5f, 0xc8, 0x7c, 0xd9,
-  0x49, 0x7e, 0x69, 0x9d, 0xce, 0xf5, 0xda, 0x76, 0xbb, 0x2b, 0x82, 0x8e,
-  0x40, 0x87, 0x35, 0x6c, 0x56, 0x7b, 0x83, 0xeb, 0xb1, 0x6e, 0xbb, 0x2b,
-  0x60, 0x07, 0xdd, 0xf7, 0x7c, 0x63, 0x49, 0x76, 0x6b, 0x63, 0xcb, 0xc3,
-  0xb5, 0xce, 0x97, 0x9a, 0x70, 0x49, 0x32, 0x22, 0xea, 0x5d, 0xfb, 0x86,
-  0x65, 0xa1, 0xd4, 0x98, 0x66, 0xf5, 0xc7, 0xa8, 0x38, 0xa0, 0x5e, 0xfb,
-  0x1e, 0x2a, 0xeb, 0x2e, 0xc3, 0x37, 0x8e, 0x19, 0x5b, 0x81, 0x9d, 0x5c,
-  0x5b, 0xfb, 0x30, 0x38, 0xf4, 0x1c, 0xdb, 0x92, 0x04, 0x59, 0xac, 0x39,
-  0xee, 0xee, 0xe2, 0x22, 0xa2, 0x50, 0x47, 0x98, 0x29, 0x96, 0x61, 0x86,
-  0x80, 0x6b, 0xa6, 0x34, 0x5c, 0xb5, 0x39, 0x04, 0xa1, 0xc2, 0x5c, 0x60,
-  0x56, 0xe0, 0xf9, 0xa0, 0x75, 0x0e, 0x05, 0x54, 0x73, 0x27, 0x0a, 0x2e,
-  0x50, 0xad, 0x3b, 0x7c, 0x55, 0x33, 0x4e, 0x1f, 0x87, 0x04, 0x88, 0x29,
-  0xf5, 0xd6, 0x0c, 0xf8, 0xbe, 0x47, 0x3d, 0x7f, 0xe7, 0x7b, 0x21, 0x64,
-  0x26, 0x9e, 0xab, 0x87, 0xd4, 0x36, 0x1f, 0x9f, 0xaf, 0xa1, 0x0d, 0xd0,
-  0xfd, 0xd9, 0xb5, 0x41, 0xd3, 0xb6, 0xfa, 0x48, 0xdd, 0xf7, 0x80, 0x43,
-  0xde, 0xce, 0xb2, 0x43, 0xdf, 0x31, 0x9e, 0xf5, 0x85, 0x43, 0xb6, 0xd7,
-  0xff, 0x1e, 0xc1, 0xe0, 0xc5, 0x73, 0x57, 0x64, 0x2a, 0x3a, 0x08, 0x06,
-  0x12, 0x9d, 0x39, 0xa1, 0x4f, 0x84, 0xb8, 0xd7, 0x06, 0x78, 0x5c, 0xb7,
-  0x6b, 0x83, 0xc2, 0x85, 0x6c, 0x78, 0x37, 0xa4, 0x46, 0x40, 0xaf, 0x97,
-  0x86, 0xaf, 0xf7, 0xb5, 0xec, 0x9a, 0x58, 0xe7, 0x53, 0x00, 0xed, 0xf8,
-  0xc1, 0x11, 0xcd, 0x2c, 0x7b, 0xa3, 0x2f, 0xec, 0x20, 0xa4, 0x5d, 0x73,
-  0x65, 0x3b, 0x40, 0x37, 0x10, 0xcd, 0x65, 0xc2, 0x27, 0xe8, 0x7d, 0xa9,
-  0x2f, 0x0d, 0xc6, 0x2a, 0xd2, 0x3f, 0x07, 0xa5, 0xb0, 0xf2, 0xa4, 0x35,
-  0x21, 0x2f, 0xe2, 0x64, 0x19, 0x13, 0xb7, 0xbb, 0x27, 0xae, 0x20, 0x93,
-  0x11, 0x20, 0xc2, 0x6b, 0xb0, 0x51, 0xa2, 0xf7, 0xa7, 0x30, 0xc9, 0x21,
-  0x14, 0x38, 0xdb, 0xc5, 0x65, 0xa2, 0x64, 0x7a, 0x08, 0x08, 0xf5, 0x2f,
-  0xd1, 0xa9, 0x5e, 0x7f, 0xdf, 0x0b, 0xa3, 0x39, 0x07, 0x96, 0xb5, 0x28,
-  0xe6, 0xf1, 0x3a, 0x59, 0x78, 0x5a, 0x6f, 0x54, 0x9a, 0x3d, 0x14, 0x3c,
-  0xe9, 0x22, 0xf3, 0x51, 0x07, 0xbc, 0x0d, 0x09, 0x16, 0x8e, 0xf7, 0xc4,
-  0x29, 0x35, 0xdc, 0xe7, 0x27, 0xe0, 0x0d, 0xb9, 0x7e, 0x02, 0x6d, 0xe9,
-  0xce, 0x03, 0x62, 0x3c, 0xea, 0xec, 0xb3, 0x8b, 0x0d, 0x29, 0x66, 0xc9,
-  0xc8, 0xe1, 0x86, 0x14, 0xaa, 0x73, 0x4d, 0xc9, 0x96, 0x76, 0x2d, 0x62,
-  0x7a, 0x81, 0xc1, 0xa4, 0xec, 0x7a, 0x2e, 0xb9, 0x4e, 0xdc, 0x0e, 0xd7,
-  0x85, 0x44, 0x37, 0x33, 0x46, 0x76, 0x32, 0x09, 0xfa, 0x0a, 0x67, 0xee,
-  0x72, 0x28, 0x78, 0xca, 0xa3, 0x97, 0xdc, 0x04, 0x38, 0x63, 0x10, 0xa2,
-  0x61, 0x81, 0xe9, 0xc5, 0x42, 0xb4, 0x5d, 0xc6, 0x9a, 0x92, 0x2c, 0x4d,
-  0xa0, 0x89, 0x04, 0x4c, 0x8e, 0xc8, 0xa0, 0x26, 0xb3, 0x2a, 0x1a, 0x23,
-  0xb8, 0xeb, 0xce, 0x75, 0x85, 0x60, 0x62, 0x63, 0xc3, 0x30, 0x81, 0x36,
-  0x53, 0x30, 0xc8, 0xe9, 0x14, 0xc5, 0x9f, 0x95, 0x1e, 0xaa, 0x1d, 0x00,
-  0x4b, 0xe8, 0x5d, 0x06, 0xb6, 0x75, 0x8d, 0x1f, 0x5d, 0x20, 0x13, 0x5a,
-  0x28, 0xc1, 0xc5, 0x46, 0x6b, 0x37, 0xd4, 0x03, 0xe2, 0x13, 0x83, 0x5e,
-  0xa0, 0xeb, 0x00, 0xdb, 0xa4, 0x0a, 0x68, 0x32, 0x38, 0x98, 0x0b, 0x6d,
-  0x02, 0x78, 0x94, 0xfe, 0x22, 0x00, 0xbf, 0xc4, 0xd4, 0x12, 0x4d, 0x71,
-  0xa5, 0xed, 0xf2, 0x58, 0x52, 0xd7, 0xc3, 0x63, 0xd4, 0x75, 0x9d, 0x56,
-  0xc5, 0x5a, 0xab, 0xaa, 0x25, 0x35, 0xed, 0x0f, 0xc9, 0x9a, 0x2b, 0x00,
-  0x13, 0x2c, 0x6c, 0x16, 0xd6, 0x7a, 0xe4, 0xfb, 0x24, 0x30, 0x8d, 0x90,
-  0xec, 0x2d, 0xd8, 0x7f, 0xd8, 0x4e, 0xc8, 0xbc, 0xc3, 0x2c, 0x8c, 0xd6,
-  0x80, 0xf0, 0x19, 0xe4, 0xb8, 0xde, 0x39, 0x36, 0x18, 0x1f, 0xdb, 0x42,
-  0x70, 0x6d, 0x31, 0xa3, 0x20, 0x04, 0xd4, 0xbe, 0x67, 0x33, 0x11, 0xd4,
-  0x9a, 0x9b, 0x10, 0xd1, 0x61, 0xe7, 0xc0, 0x56, 0xac, 0x66, 0xdc, 0x9c,
-  0x2a, 0x69, 0x31, 0xef, 0xb3, 0x4b, 0xd6, 0x52, 0x59, 0x94, 0xd4, 0x34,
-  0x27, 0xeb, 0xda, 0x75, 0xe8, 0x3a, 0xf0, 0x66, 0xfe, 0x68, 0xa3, 0xfa,
-  0xb3, 0x11, 0x5d, 0xe8, 0x79, 0x04, 0xd5, 0x8c, 0x17, 0x80, 0x8b, 0xab,
-  0x9d, 0x2d, 0x81, 0x44, 0x62, 0x7a, 0xc0, 0xc3, 0xaf, 0xc8, 0x66, 0xc7,
-  0xbd, 0x90, 0x86, 0xea, 0x27, 0x2c, 0x57, 0x1b, 0xd7, 0x68, 0x4c, 0x83,
-  0x7a, 0xb6, 0x54, 0xf6, 0x22, 0x27, 0x45, 0x73, 0x85, 0x26, 0x54, 0xeb,
-  0x7b, 0x56, 0x3f, 0xa6, 0xa8, 0x1f, 0x59, 0xa7, 0xc3, 0x17, 0xa5, 0xcf,
-  0x09, 0xa8, 0x05, 0xfa, 0x2c, 0x8e, 0x42, 0xde, 0xc8, 0x7b, 0x49, 0xf0,
-  0xe4, 0x77, 0xcf, 0x27, 0xee, 0x1f, 0x39, 0xa6, 0x54, 0xcf, 0xf9, 0x37,
-  0x79, 0x9f, 0xe5, 0x3b, 0x73, 0x00, 0x7c, 0x68, 0xec, 0x06, 0xea, 0xed,
-  0xbf, 0x92, 0x74, 0xad, 0xb3, 0xa7, 0x98, 0xd4, 0x08, 0x96, 0x43, 0x2c,
-  0xfe, 0xe1, 0x3a, 0x85, 0xe4, 0x18, 0x7e, 0x48, 0xf4, 0x90, 0x80, 0xa3,
-  0x02, 0x73, 0x8b, 0x3b, 0x62, 0xad, 0x67, 0x79, 0xf2, 0x9e, 0x5a, 0xbb,
-  0x24, 0x8e, 0xaa, 0x89, 0x6d, 0x57, 0x72, 0x49, 0xcc, 0x47, 0xd7, 0xdb,
-  0x10, 0xa5, 0x1b, 0x14, 0x91, 0x06, 0x12, 0xb5, 0x72, 0xb1, 0x4b, 0xcc,
-  0x73, 0xc8, 0x82, 0x36, 0xc1, 0x06, 0xf4, 0x6c, 0x5c, 0x92, 0x0a, 0x94,
-  0x0c, 0xa0, 0xd4, 0x2d, 0x10, 0x3a, 0x46, 0x11, 0x5f, 0xc0, 0x25, 0xdc,
-  0x8c, 0x90, 0x0d, 0x3c, 0x80, 0xb1, 0xd4, 0x0f, 0x7c, 0xed, 0x3d, 0x56,
-  0x05, 0x38, 0x2e, 0xa8, 0xe1, 0xf0, 0x87, 0x52, 0xa8, 0xc3, 0x29, 0x9b,
-  0x5c, 0x80, 0xbd, 0xca, 0x07, 0xd8, 0x01, 0x8c, 0x99, 0x47, 0x80, 0xcf,
-  0x55, 0x42, 0xe2, 0x10, 0x93, 0x2a, 0xb6, 0xeb, 0x47, 0x94, 0x4d, 0x89,
-  0xf3, 0xb3, 0xc4, 0x5b, 0x4c, 0x51, 0x96, 0xfd, 0x92, 0xd5, 0x65, 0x68,
-  0x6f, 0x1f, 0x13, 0x58, 0x96, 0xde, 0x29, 0x26, 0xc0, 0x7b, 0xcf, 0xc7,
-  0x40, 0x99, 0xcd, 0xe7, 0x5e, 0x2f, 0x16, 0x0b, 0x31, 0x4c, 0x6c, 0x13,
-  0x05, 0xc1, 0xbb, 0x9a, 0x38, 0x93, 0x77, 0x98, 0x05, 0x37, 0x2d, 0xe6,
-  0xe6, 0xe3, 0xe4, 0xf1, 0x06, 0x22, 0xa0, 0x80, 0x2b, 0x41, 0x4b, 0xb1,
-  0x76, 0x1e, 0xea, 0x3f, 0x7d, 0xd6, 0x61, 0x4e, 0x4c, 0x80, 0xeb, 0xd1,
-  0xae, 0xe1, 0x40, 0x0c, 0x27, 0x96, 0x18, 0xde, 0x33, 0x4c, 0x6a, 0x6f,
-  0x48, 0x96, 0xee, 0xaa, 0xdc, 0xfd, 0xba, 0x99, 0xaa, 0x22, 0xd7, 0x04,
-  0x7c, 0xcb, 0x70, 0x97, 0xb8, 0xaa, 0x02, 0x7c, 0x6d, 0x30, 0x55, 0xc6,
-  0x13, 0xfc, 0xc7, 0x76, 0xbf, 0x65, 0xf0, 0x99, 0x01, 0x83, 0x51, 0x01,
-  0x5a, 0x2d, 0xa7, 0x32, 0x93, 0x0a, 0x8c, 0x2a, 0x21, 0x1d, 0x27, 0x0c,
-  0x5b, 0x78, 0x66, 0x14, 0x76, 0x37, 0x76, 0x68, 0x03, 0xdb, 0x84, 0xc6,
-  0x15, 0x1a, 0x99, 0xfe, 0x15, 0xda, 0x8c, 0xfc, 0xf5, 0xce, 0x8b, 0x28,
-  0xba, 0x53, 0x7d, 0x90, 0x68, 0x5b, 0x89, 0x4d, 0xb0, 0x90, 0x6b, 0x31,
-  0xac, 0xeb, 0x2d, 0x16, 0x21, 0x81, 0x80, 0x81, 0xe9, 0x03, 0xca, 0xc0,
-  0x73, 0xc3, 0x7c, 0xde, 0x9a, 0xcf, 0x4b, 0x59, 0x98, 0x9c, 0x24, 0x21,
-  0x91, 0x3b, 0x27, 0x74, 0x61, 0xe5, 0x28, 0xb1, 0x7f, 0x6d, 0x58, 0x60,
-  0x5f, 0x38, 0x7d, 0x6e, 0x84, 0x76, 0xc8, 0xbd, 0x65, 0x29, 0xe1, 0xac,
-  0xcf, 0x7d, 0x18, 0xf0, 0x61, 0x29, 0x27, 0x1d, 0x8c, 0xf6, 0x3d, 0xef,
-  0xb1, 0x98, 0x50, 0x82, 0xe2, 0x49, 0x3d, 0x2c, 0xc6, 0xe5, 0x3a, 0xb0,
-  0x01, 0x3b, 0x20, 0x95, 0xcb, 0xb5, 0xc3, 0x75, 0x67, 0x0f, 0x8e, 0xd9,
-  0x05, 0x48, 0x0a, 0xfb, 0xc6, 0x91, 0xfc, 0x17, 0x8e, 0x6d, 0x19, 0x07,
-  0x63, 0xe3, 0xd7, 0x0e, 0x25, 0x69, 0x27, 0x65, 0x84, 0x85, 0x9c, 0xab,
-  0x68, 0xa9, 0xbd, 0xb5, 0xe7, 0x7a, 0xc5, 0x4d, 0x39, 0xb6, 0xb1, 0x9c,
-  0x46, 0xb9, 0x7f, 0xff, 0x19, 0x7e, 0x77, 0xbf, 0x92, 0x65, 0xe4, 0x18,
-  0x81, 0xf2, 0x99, 0xb8, 0x8e, 0xa7, 0x40, 0x93, 0x61, 0x7a, 0xca, 0x5b,
-  0x90, 0xb0, 0x07, 0xae, 0x59, 0x79, 0xf5, 0xc9, 0x9e, 0x13, 0x9e, 0x7c,
-  0x4b, 0x38, 0x1c, 0x36, 0xea, 0x6f, 0xbd, 0x28, 0xb0, 0x21, 0x44, 0x7e,
-  0x21, 0x4f, 0xaf, 0x94, 0x04, 0x5c, 0x26, 0x89, 0x66, 0x78, 0x15, 0x74,
-  0x9c, 0xfc, 0xe7, 0xee, 0xa8, 0x64, 0x9c, 0xa9, 0xef, 0xef, 0x58, 0xce,
-  0xbe, 0x75, 0xa3, 0x35, 0x20, 0xff, 0x23, 0x8e, 0xa3, 0x03, 0xdc, 0x35,
-  0x49, 0x5c, 0xe7, 0x33, 0x1b, 0xab, 0x7e, 0x9f, 0xb5, 0xf7, 0x98, 0x5e,
-  0x54, 0x78, 0xf7, 0x7d, 0x8f, 0xb9, 0xca, 0x5d, 0x53, 0xe6, 0x17, 0x2b,
-  0x6d, 0x71, 0x8f, 0x15, 0xb9, 0x36, 0x6d, 0xda, 0x15, 0xa1, 0x61, 0xac,
-  0x88, 0xe3, 0xef, 0xce, 0xcb, 0x8d, 0x44, 0x8e, 0xa6, 0x66, 0x72, 0x34,
-  0xb5, 0x4a, 0x39, 0xaa, 0x3d, 0x6d, 0x63, 0xee, 0x5f, 0xaa, 0x96, 0x08,
-  0xfb, 0x64, 0x11, 0x7e, 0x92, 0x4f, 0x31, 0x4a, 0x28, 0xb0, 0x4e, 0x97,
-  0x0f, 0x0d, 0x7c, 0xc9, 0xc2, 0xbf, 0xc5, 0xdb, 0x77, 0x16, 0x74, 0x5d,
-  0x12, 0x86, 0x17, 0x7d, 0xac, 0xd3, 0xc1, 0x18, 0x18, 0xbb, 0xcb, 0x38,
-  0x82, 0x49, 0xb6, 0x48, 0xc0, 0x92, 0x9b, 0x36, 0xd1, 0x2f, 0x1f, 0x2f,
-  0x87, 0x55, 0xe9, 0x10, 0x2b, 0xba, 0x95, 0x5c, 0x7b, 0xf3, 0xe6, 0x35,
-  0x53, 0x9b, 0xa8, 0x2b, 0xa8, 0xc1, 0xda, 0xf7, 0x3d, 0xcb, 0x0e, 0xe8,
-  0xf3, 0x61, 0x3f, 0x3e, 0x1e, 0x75, 0xfe, 0x62, 0xaf, 0xf1, 0x38, 0xc5,
-  0x80, 0x3d, 0x68, 0x0e, 0x30, 0xfe, 0x1d, 0xc4, 0x60, 0xf3, 0xbe, 0xfd,
-  0xa0, 0xeb, 0x57, 0x01, 0xf3, 0x72, 0x15, 0x33, 0x50, 0xe4, 0x46, 0xc5,
-  0x1d, 0x55, 0xd3, 0x5e, 0xf9, 0x48, 0xbf, 0x12, 0x8b, 0x67, 0xdc, 0x76,
-  0x5b, 0xc9, 0x32, 0x25, 0x20, 0xf3, 0xdc, 0xac, 0xa0, 0xe7, 0x40, 0xc8,
-  0x6c, 0x6d, 0xa8, 0x4f, 0x2b, 0x68, 0x66, 0x99, 0x33, 0x6e, 0xf5, 0x58,
-  0xe0, 0x69, 0x53, 0xbc, 0x28, 0xc4, 0xaa, 0xa2, 0x29, 0xb2, 0x6e, 0xe2,
-  0x5a, 0xc9, 0xc1, 0x47, 0x5a, 0x56, 0xbb, 0xc2, 0xba, 0x4d, 0x67, 0xc7,
-  0xab, 0x6d, 0x89, 0x0e, 0xc7, 0x7e, 0x9d, 0x95, 0x6c, 0xc5, 0x12, 0x32,
-  0x99, 0x7f, 0x25, 0x7c, 0x5e, 0xd6, 0xc9, 0x2f, 0x20, 0x58, 0x1b, 0x0e,
-  0x9f, 0x5e, 0xf6, 0x71, 0x53, 0x8d, 0x33, 0x38, 0xaf, 0x07, 0xea, 0x7e,
-  0xef, 0xc3, 0x4e, 0x26, 0x0b, 0x06, 0xae, 0xd9, 0xda, 0xaa, 0x9d, 0xeb,
-  0xc1, 0x3d, 0xc4, 0x31, 0xc6, 0x97, 0x5d, 0x7c, 0x52, 0x6b, 0xd1, 0x59,
-  0x99, 0x31, 0xa3, 0xf5, 0xb6, 0x0b, 0x59, 0x03, 0x6e, 0x87, 0x01, 0xb0,
-  0x2a, 0x55, 0x14, 0x94, 0xc1, 0x3f, 0x48, 0x40, 0xf1, 0x6b, 0xc7, 0x5b,
-  0x86, 0x3b, 0x61, 0x92, 0xc3, 0xd1, 0x66, 0x05, 0xb1, 0x1b, 0x60, 0x82,
-  0x0e, 0xa4, 0xf5, 0xbd, 0x85, 0xbd, 0x25, 0xd6, 0x35, 0x83, 0xa8, 0xab,
-  0xd7, 0xd9, 0x4d, 0xf0, 0x11, 0xfe, 0xb5, 0x68, 0x68, 0x99, 0xaa, 0x7a,
-  0x5c, 0x32, 0x04, 0xe5, 0x9e, 0x26, 0xe8, 0x21, 0x27, 0xf0, 0xb6, 0x27,
-  0xd6, 0x46, 0x13, 0x16, 0xb1, 0x4a, 0x6b, 0xd9, 0x8a, 0x58, 0xb5, 0xb4,
-  0xe8, 0xac, 0x98, 0x0d, 0xb3, 0xf5, 0xc4, 0x24, 0xa7, 0x3a, 0xa0, 0x8d,
-  0x39, 0x90, 0xca, 0x4a, 0x6a, 0x67, 0x7f, 0x73, 0xc9, 0xcf, 0x4d, 0x6f,
-  0x2e, 0xf9, 0xc9, 0x2f, 0x56, 0xe4, 0x67, 0x37, 0x96, 0xbd, 0x91, 0x6c,
-  0xeb, 0x56, 0xf6, 0x36, 0x81, 0x2c, 0x99, 0x10, 0xd1, 0x43, 0xfc, 0xcd,
-  0x16, 0x27, 0xf3, 0x5e, 0xd1, 0x08, 0x70, 0xe5, 0x78, 0xe4, 0xc3, 0x3a,
-  0x5c, 0xca, 0xb3, 0xaf, 0x84, 0x69, 0x29, 0xac, 0xe1, 0x7f, 0xfe, 0xe3,
-  0xbf, 0x6e, 0x2e, 0x61, 0xec, 0x4c, 0x7c, 0x66, 0xa6, 0xa1, 0x29, 0xe4,
-  0x01, 0x21, 0x73, 0x24, 0x70, 0xf4, 0xf9, 0x56, 0x2c, 0x8e, 0xf2, 0x96,
-  0x3c, 0x56, 0x2c, 0x81, 0xe6, 0x47, 0xb2, 0x1c, 0x82, 0x93, 0x42, 0x1f,
-  0xf8, 0x45, 0xd3, 0xb9, 0x31, 0x83, 0x8a, 0x69, 0x59, 0x02, 0x16, 0x8b,
-  0x72, 0x1c, 0xc6, 0xe2, 0x69, 0x03, 0xf0, 0x2f, 0xb1, 0xb7, 0x82, 0xfc,
-  0x38, 0x67, 0x91, 0xc5, 0x7c, 0x8e, 0x35, 0xa0, 0xa1, 0xff, 0xe0, 0x18,
-  0x73, 0xe2, 0x00, 0x17, 0x00, 0xa9, 0x2e, 0xe6, 0x4b, 0x37, 0x06, 0x1b,
-  0xc1, 0xfa, 0x6d, 0x3f, 0x61, 0x28, 0x26, 0x39, 0xb2, 0xb4, 0x0a, 0xc8,
-  0x82, 0xf7, 0xe9, 0x97, 0x97, 0x24, 0xf4, 0x07, 0xda, 0xda, 0x36, 0x7b,
-  0x8e, 0x67, 0x1a, 0x8e, 0x3e, 0x19, 0x8d, 0x86, 0x97, 0x46, 0x64, 0xd9,
-  0x30, 0x0e, 0x98, 0xba, 0xc4, 0xc3, 0xf8, 0x87, 0x39, 0xd8, 0xfa, 0xa3,
-  0x3c, 0x6b, 0x9a, 0x71, 0x73, 0x69, 0x64, 0xa8, 0x63, 0xb8, 0xd7, 0x96,
-  0x1b, 0x3e, 0xa0, 0x99, 0xcb, 0x12, 0x13, 0x3a, 0x90, 0x90, 0x8f, 0xe4,
-  0x32, 0xd0, 0x9a, 0x59, 0x90, 0x17, 0xc8, 0x33, 0x2f, 0xa8, 0x5a, 0x05,
-  0x42, 0xfa, 0xbf, 0x5c, 0x47, 0x4e, 0x10, 0x25, 0x71, 0xa0, 0xf3, 0x03,
-  0x51, 0x18, 0x82, 0x86, 0x15, 0xa5, 0x7e, 0x08, 0x20, 0x97, 0x36, 0x5d,
-  0x45, 0xf3, 0x9e, 0xe9, 0xad, 0x2f, 0xef, 0xa3, 0x47, 0x62, 0xfe, 0x79,
-  0x39, 0x07, 0xe9, 0xbb, 0x84, 0x2e, 0xbd, 0x2e, 0x43, 0xd7, 0x45, 0xdc,
-  0x5d, 0x40, 0x5a, 0xa2, 0x2a, 0x86, 0xbc, 0x5c, 0xc9, 0xb3, 0x5f, 0x6c,
-  0xfa, 0x21, 0x9a, 0xa7, 0xec, 0x8c, 0x57, 0x8d, 0x71, 0x22, 0x51, 0x38,
-  0x76, 0x13, 0xc3, 0xec, 0x1b, 0x3b, 0x1f, 0x8c, 0xa9, 0xe5, 0xee, 0x98,
-  0x8f, 0xc0, 0x8e, 0x7b, 0x54, 0x8c, 0x1b, 0xbe, 0xd3, 0xe6, 0x36, 0xe3,
-  0x8b, 0x99, 0x0f, 0xe8, 0x02, 0x65, 0xf0, 0x04, 0x4e, 0x04, 0x42, 0x61,
-  0x17, 0xb3, 0x37, 0xf0, 0x79, 0x73, 0xc9, 0x47, 0xd7, 0xcc, 0xe2, 0x27,
-  0xbf, 0xf1, 0x34, 0x7e, 0x35, 0xfb, 0x84, 0x5f, 0x0d, 0x13, 0xd9, 0xa9,
-  0x66, 0x3c, 0x8f, 0xdf, 0x6a, 0xf1, 0x0e, 0x3e, 0xd3, 0x59, 0x97, 0x9c,
-  0xf6, 0x3c, 0xc7, 0x4b, 0x7c, 0x87, 0x28, 0x50, 0x36, 0x62, 0x68, 0x59,
-  0x69, 0x82, 0x2d, 0xe0, 0x09, 0x68, 0x14, 0xca, 0xb3, 0x7b, 0xf6, 0x0d,
-  0x2e, 0x46, 0x9b, 0xdd, 0xb0, 0x1a, 0x17, 0x7c, 0x05, 0xf0, 0xdf, 0x8a,
-  0x27, 0x3e, 0xc6, 0x8c, 0x04, 0xf3, 0x98, 0x7d, 0xbc, 0x93, 0xde, 0x58,
-  0x56, 0x00, 0xc9, 0xe0, 0xcd, 0x25, 0xb5, 0xb2, 0xc3, 0x36, 0x7c, 0x18,
-  0x0e, 0xe2, 0x5d, 0x97, 0x0c, 0x4c, 0x35, 0xa8, 0x27, 0x7b, 0x61, 0x3f,
-  0x04, 0x61, 0x68, 0xcb, 0xb3, 0xbf, 0xda, 0xef, 0x6d, 0xe9, 0xeb, 0xfd,
-  0xfd, 0xc7, 0x1a, 0x80, 0x7c, 0x54, 0x4b, 0x90, 0x74, 0x2b, 0x00, 0x7e,
-  0xfb, 0x57, 0xe9, 0xce, 0x7b, 0x22, 0x41, 0x0d, 0xd0, 0x27, 0x1c, 0xd8,
-  0x0c, 0x13, 0xdc, 0x2e, 0x2c, 0xe7, 0x7d, 0x40, 0x88, 0xf4, 0x01, 0x7e,
-  0x42, 0xe2, 0x60, 0xbb, 0x9d, 0x1a, 0x90, 0x7c, 0x6c, 0x33, 0xcc, 0x08,
-  0xc4, 0x88, 0xfa, 0xf8, 0x1b, 0xfb, 0xae, 0x01, 0x16, 0x0f, 0x6a, 0x06,
-  0xc7, 0x4c, 0x3e, 0x24, 0x01, 0x04, 0x00, 0xee, 0xd9, 0xa4, 0x7b, 0x76,
-  0x51, 0x03, 0x38, 0x0c, 0x36, 0x6d, 0xa0, 0x9a, 0x0e, 0x1e, 0x61, 0xca,
-  0xb3, 0xb7, 0xec, 0xbb, 0x06, 0x56, 0x3c, 0xa8, 0x19, 0x5c, 0x48, 0x21,
-  0x5f, 0x01, 0xde, 0x2d, 0x51, 0xdd, 0xc4, 0xcf, 0x3a, 0x02, 0x59, 0x7f,
-  0x1b, 0xa0, 0xfe, 0x23, 0xac, 0xde, 0xa0, 0xc0, 0xa5, 0x3b, 0x88, 0xe6,
-  0x90, 0x95, 0x7c, 0x85, 0x8b, 0x3a, 0x25, 0x62, 0xe3, 0x9a, 0x61, 0x62,
-  0xe9, 0xf2, 0x01, 0x32, 0x0c, 0x17, 0x0c, 0x0c, 0xcc, 0x15, 0xae, 0x78,
-  0x88, 0x7a, 0xcb, 0x9b, 0x6a, 0xa0, 0x3b, 0x30, 0xa3, 0x35, 0x74, 0x9f,
-  0xc5, 0x69, 0x06, 0x9a, 0xf3, 0x02, 0xbe, 0x20, 0x26, 0xd7, 0x81, 0xe6,
-  0xc3, 0x33, 0xb0, 0x2f, 0x85, 0x91, 0x66, 0x4c, 0x5b, 0xd4, 0x6f, 0x60,
-  0x18, 0x2f, 0x29, 0x49, 0x9e, 0x0b, 0xb2, 0x31, 0x1f, 0x6f, 0x5f, 0x41,
-  0xcf, 0x85, 0xcc, 0xb5, 0xe3, 0x81, 0x85, 0x7e, 0xb9, 0xf3, 0x8a, 0xc1,
-  0x9d, 0x3f, 0x80, 0x26, 0x3c, 0x20, 0xd9, 0x5c, 0x5d, 0xa4, 0x5f, 0xbf,
-  0xdc, 0x5c, 0xf2, 0xd9, 0x4d, 0x50, 0x20, 0x0f, 0xc8, 0x03, 0x59, 0x2c,
-  0x52, 0x28, 0xef, 0xdf, 0x37, 0x80, 0x01, 0xd7, 0x41, 0xc0, 0x95, 0x68,
-  0x61, 0x0a, 0x84, 0x35, 0xb1, 0xe4, 0x04, 0x84, 0xf8, 0x51, 0xbb, 0xaf,
-  0x87, 0x10, 0x90, 0xb9, 0xe7, 0xd1, 0x2f, 0xde, 0xd3, 0x45, 0x66, 0x32,
-  0x36, 0xe1, 0x6c, 0xfc, 0xae, 0x9f, 0x6a, 0x91, 0x85, 0x11, 0x39, 0x34,
-  0xcc, 0x4d, 0x8e, 0x1b, 0x93, 0x98, 0xc2, 0xeb, 0x7b, 0xe0, 0x71, 0x45,
-  0x47, 0x0a, 0x2f, 0xce, 0xba, 0x0c, 0x6b, 0x93, 0x8c, 0x5e, 0x00, 0x46,
-  0x58, 0x34, 0x8f, 0x36, 0xb5, 0x9e, 0xb8, 0xe8, 0x78, 0xb9, 0x65, 0x7f,
-  0x83, 0x4f, 0xe9, 0x47, 0xe9, 0x0b, 0xa1, 0x90, 0xc5, 0x3f, 0x1e, 0x74,
-  0xbf, 0xb9, 0x44, 0x06, 0x67, 0x3f, 0x84, 0xcf, 0xae, 0xf9, 0x40, 0x5c,
-  0x01, 0xe5, 0x1e, 0xae, 0x92, 0xb8, 0x96, 0x89, 0x82, 0xb8, 0x95, 0x17,
-  0xbe, 0x29, 0x9d, 0x26, 0xcf, 0xfe, 0x31, 0x89, 0xd8, 0x45, 0x8d, 0xcb,
-  0x91, 0xcd, 0x2a, 0x2c, 0x72, 0x2e, 0x52, 0xc2, 0xcf, 0x2c, 0xa0, 0x38,
-  0x7e, 0x89, 0x58, 0x85, 0xca, 0x84, 0x5a, 0x54, 0x88, 0x6e, 0x71, 0x2f,
-  0x6a, 0x09, 0x53, 0x8f, 0x52, 0x1c, 0x13, 0xa2, 0x62, 0x22, 0xa1, 0x6e,
-  0x66, 0x85, 0xa8, 0x16, 0xa9, 0x04, 0xe1, 0x6a, 0x73, 0x21, 0xa7, 0xf8,
-  0x95, 0x1c, 0x39, 0x3d, 0x86, 0xa7, 0xf3, 0x0a, 0x34, 0x31, 0xa3, 0x05,
-  0x42, 0x24, 0x19, 0xc3, 0xe4, 0xee, 0xc0, 0x7b, 0xca, 0xa0, 0xc1, 0x72,
-  0x46, 0x92, 0x75, 0x65, 0xb7, 0x21, 0x32, 0x67, 0x8f, 0xe7, 0x20, 0xbf,
-  0x6e, 0x65, 0xad, 0x90, 0xff, 0xb2, 0x69, 0x4c, 0x2a, 0x5b, 0x5a, 0x04,
-  0x57, 0x85, 0xba, 0xd2, 0x27, 0x64, 0xf8, 0x89, 0x72, 0x94, 0xe2, 0x70,
-  0x5c, 0xe9, 0x0d, 0xb2, 0xcc, 0x6f, 0xe7, 0x6d, 0xf8, 0x60, 0xee, 0x6d,
-  0x98, 0x9a, 0x54, 0x7b, 0x99, 0x74, 0x68, 0x0b, 0xb8, 0x98, 0x04, 0x0a,
-  0x2d, 0x7e, 0xc7, 0xee, 0x28, 0x95, 0x3e, 0x61, 0x93, 0xf4, 0xad, 0x2a,
-  0x9e, 0x49, 0x3c, 0x03, 0x65, 0x58, 0x32, 0x13, 0x5b, 0xc4, 0x49, 0x6a,
-  0x8a, 0xb1, 0xbf, 0x7d, 0x7b, 0xdb, 0x08, 0x3b, 0x1d, 0x7d, 0x00, 0x72,
-  0xce, 0x90, 0x78, 0x01, 0x5c, 0x98, 0xd0, 0xaf, 0xec, 0xa2, 0xc9, 0x88,
-  0xe2, 0x29, 0xe7, 0x59, 0x50, 0x0c, 0x45, 0x18, 0xc8, 0xac, 0xdb, 0xd7,
-  0x8a, 0x46, 0x03, 0x6d, 0xfd, 0x8a, 0x36, 0xb5, 0xdc, 0x36, 0x2d, 0x37,
-  0x4d, 0xca, 0x4d, 0x57, 0xe5, 0xa6, 0x71, 0xb9, 0x69, 0x54, 0x6e, 0x1a,
-  0x96, 0x9b, 0x06, 0xe5, 0xa6, 0x2a, 0xfa, 0x4b, 0x7e, 0x80, 0x73, 0x81,
-  0x58, 0xb3, 0xf2, 0x2a, 0xca, 0x6b, 0x2d, 0x43, 0x2c, 0xa3, 0x2d, 0xd3,
-  0x56, 0x5e, 0x40, 0x79, 0x95, 0x65, 0x56, 0x94, 0xf9, 0x55, 0x66, 0x6a,
-  0x05, 0xeb, 0x2b, 0x24, 0x94, 0x15, 0x64, 0xe2, 0xdd, 0xb2, 0xca, 0x84,
-  0x75, 0x67, 0x79, 0xb6, 0x8a, 0xd5, 0xa7, 0xe0, 0xf8, 0xb8, 0x62, 0x94,
-  0xbd, 0x1e, 0x57, 0xce, 0x8b, 0x23, 0x7c, 0x9b, 0x80, 0xf4, 0x22, 0x8e,
-  0x2d, 0x0b, 0xab, 0xd9, 0xab, 0xe5, 0x4c, 0x8c, 0xe7, 0x72, 0x0f, 0x78,
-  0x6b, 0xa6, 0xc5, 0xc2, 0x55, 0x9c, 0xf0, 0x60, 0x43, 0xe4, 0x90, 0x26,
-  0x7b, 0x2b, 0xcd, 0x3f, 0xcf, 0xf0, 0x4a, 0xe0, 0xbe, 0x53, 0x00, 0x2b,
-  0xe0, 0xa9, 0x0c, 0x63, 0xd9, 0x31, 0x3c, 0x92, 0x15, 0x66, 0x1d, 0x1d,
-  0xcf, 0x8a, 0x58, 0x5f, 0x44, 0xf8, 0x95, 0x40, 0x4f, 0xd4, 0x02, 0x96,
-  0x7e, 0xce, 0xf2, 0x39, 0x6f, 0x3b, 0xf9, 0xf3, 0x99, 0x47, 0x0a, 0x9f,
-  0x1d, 0x3a, 0xf1, 0x2d, 0xa9, 0x9b, 0x87, 0x24, 0xb1, 0x93, 0x28, 0x16,
-  0x4c, 0x91, 0x41, 0xc4, 0xbf, 0x95, 0xc7, 0xaa, 0x5c, 0x2b, 0x46, 0x9c,
-  0x53, 0x96, 0x21, 0x5f, 0x47, 0xac, 0xc9, 0x18, 0x44, 0x50, 0xa8, 0x3c,
-  0xc3, 0x3e, 0x5a, 0x66, 0x0c, 0xc5, 0x8b, 0x0a, 0x2c, 0x85, 0x78, 0xaa,
-  0xb4, 0xb0, 0xdc, 0x97, 0x08, 0xcb, 0xf3, 0x5b, 0xcb, 0x0a, 0xe7, 0xbd,
-  0x88, 0xa8, 0x00, 0xd0, 0xb1, 0x92, 0xf2, 0xfc, 0xb6, 0x82, 0x62, 0x9b,
-  0x98, 0xe3, 0xe5, 0x04, 0x08, 0x5e, 0x56, 0x4c, 0x31, 0xc0, 0xd6, 0xf9,
-  0x62, 0xce, 0x22, 0xb1, 0x86, 0x03, 0x78, 0xe3, 0xc5, 0x1d, 0x4e, 0x1e,
-  0xab, 0x66, 0xb6, 0xd5, 0x0a, 0x8b, 0x10, 0x60, 0xad, 0xc3, 0x3e, 0x99,
-  0xcb, 0x82, 0xcc, 0x8f, 0xf8, 0xd2, 0x3d, 0xb6, 0x48, 0x17, 0xbf, 0x46,
-  0x34, 0xb4, 0x2d, 0x22, 0xfd, 0xd5, 0x76, 0xb1, 0x6e, 0xdd, 0xa4, 0x2a,
-  0x65, 0x60, 0xe7, 0xf9, 0xf5, 0x32, 0xbc, 0xef, 0xe4, 0xd8, 0x8b, 0x88,
-  0xca, 0xca, 0x86, 0x5c, 0x61, 0x4c, 0x61, 0x22, 0x39, 0x26, 0x64, 0x97,
-  0x60, 0xbf, 0x88, 0x9e, 0x55, 0x43, 0x6d, 0xad, 0x6c, 0xd9, 0xe9, 0x5c,
-  0x61, 0x32, 0x62, 0x3f, 0xa8, 0x6c, 0xe5, 0x99, 0xcd, 0xd8, 0x58, 0xe1,
-  0x7a, 0xb6, 0x7e, 0xf7, 0xe5, 0xfe, 0x34, 0x3d, 0xe0, 0xf3, 0xbf, 0x93,
-  0xec, 0x59, 0x7d, 0xbe, 0x2a, 0x92, 0xb3, 0x0e, 0xe2, 0xe2, 0xd6, 0x9d,
-  0x07, 0x72, 0x6c, 0x68, 0x1b, 0xbd, 0x0b, 0x26, 0x87, 0x6b, 0x97, 0x3e,
-  0x78, 0x21, 0xc5, 0xa7, 0xf0, 0x4e, 0x71, 0x9e, 0x8c, 0x98, 0x15, 0x00,
-  0x90, 0xa5, 0xb5, 0xb1, 0x75, 0x88, 0xbb, 0xa4, 0xab, 0x5b, 0x79, 0xa0,
-  0xc9, 0x12, 0xa8, 0x8f, 0x49, 0x56, 0x9e, 0x63, 0x91, 0xe0, 0x56, 0x8e,
-  0x0b, 0xfa, 0x5d, 0xa3, 0x3f, 0xd7, 0xcc, 0x41, 0x45, 0xe1, 0x08, 0xd7,
-  0xf6, 0xd5, 0x78, 0x12, 0xcb, 0x5b, 0x09, 0x92, 0x64, 0x25, 0x8b, 0xe3,
-  0xb4, 0x45, 0xe6, 0xfd, 0x18, 0x96, 0x8b, 0x59, 0x85, 0xed, 0xe2, 0xe3,
-  0x5d, 0xa7, 0x6a, 0xc5, 0xfc, 0x60, 0x23, 0x0a, 0x9c, 0xf2, 0xe9, 0x4c,
-  0xf1, 0xb4, 0x82, 0x9f, 0x46, 0xb4, 0x44, 0xcc, 0x95, 0x85, 0xa3, 0x46,
-  0xb6, 0x57, 0x22, 0x4f, 0x3c, 0x20, 0xe2, 0x4f, 0x4f, 0x68, 0xb2, 0x54,
-  0x55, 0x9c, 0xb6, 0x54, 0xd3, 0x95, 0x71, 0x70, 0x27, 0xd6, 0xf1, 0xd2,
-  0xdd, 0x7f, 0x5a, 0x7f, 0xc3, 0x82, 0x83, 0x8b, 0xa5, 0x7e, 0x56, 0x3c,
-  0x60, 0x7b, 0xd9, 0x2f, 0xde, 0x53, 0x43, 0x0d, 0x8e, 0x57, 0xdf, 0x49,
-  0x5c, 0xe7, 0x4c, 0xa0, 0x15, 0xda, 0x67, 0x5f, 0xe3, 0x9f, 0xe0, 0xd9,
-  0xbb, 0xef, 0xed, 0x7a, 0xa8, 0x30, 0x6c, 0x61, 0x07, 0xeb, 0x2f, 0x84,
-  0xb2, 0x22, 0x5e, 0x5a, 0x60, 0x73, 0x61, 0xe7, 0xc0, 0xcb, 0x7b, 0xc5,
-  0x0a, 0x1b, 0xaf, 0xf6, 0x15, 0xe0, 0xb6, 0xac, 0xa0, 0xf1, 0xd3, 0xaa,
-  0xd9, 0x1b, 0x7e, 0x04, 0xd5, 0xb6, 0x72, 0xc6, 0x6b, 0xc0, 0xf7, 0xc6,
-  0xda, 0x87, 0x48, 0xc9, 0x6b, 0xc5, 0x87, 0xe3, 0x14, 0x9f, 0x90, 0xc4,
-  0xa6, 0x4a, 0x27, 0x8b, 0x63, 0x0e, 0xba, 0xea, 0x8c, 0x39, 0x1c, 0x67,
-  0xca, 0x0c, 0xbb, 0x48, 0x80, 0xf8, 0x5d, 0x53, 0x71, 0x0a, 0xd4, 0x57,
-  0x55, 0x15, 0xec, 0xdb, 0x06, 0xe7, 0x3f, 0xe1, 0x3f, 0x8d, 0xed, 0xad,
-  0x3c, 0x1d, 0xe3, 0xef, 0xaa, 0xfd, 0xe6, 0x87, 0x3f, 0x6b, 0x36, 0x9c,
-  0x8c, 0xf8, 0x2a, 0x9f, 0xc6, 0x70, 0x2b, 0x82, 0x88, 0xa3, 0x77, 0x22,
-  0x8d, 0x3c, 0x69, 0x1d, 0xbe, 0x52, 0x48, 0x47, 0x66, 0xb1, 0x4b, 0xc3,
-  0x06, 0xbf, 0xff, 0x0b, 0x7c, 0x36, 0x09, 0x99, 0x8f, 0x3c, 0x27, 0x61,
-  0x65, 0x10, 0x2a, 0x05, 0xa5, 0xf6, 0xfa, 0x42, 0x4e, 0xfc, 0x17, 0x8a,
-  0xa9, 0x5f, 0x23, 0xa4, 0xff, 0xfe, 0xcf, 0x1a, 0x21, 0x21, 0xf8, 0x4a,
-  0x21, 0x31, 0xbc, 0x8a, 0x20, 0xe0, 0x68, 0x21, 0x31, 0xb0, 0x2f, 0x22,
-  0xa4, 0x14, 0xd2, 0x91, 0x42, 0x5a, 0xf9, 0x10, 0x7c, 0x3f, 0xd8, 0xcb,
-  0x55, 0xd7, 0x37, 0xf0, 0x3c, 0xf1, 0xb0, 0xa0, 0xd8, 0xe8, 0xf3, 0x12,
-  0xc5, 0x95, 0x2f, 0x37, 0x27, 0x00, 0x87, 0xd3, 0x87, 0xba, 0xf4, 0x60,
-  0xe5, 0x57, 0xca, 0x08, 0x9a, 0xb3, 0xa9, 0xc1, 0xca, 0x3f, 0x5a, 0x4e,
-  0xb0, 0xec, 0x97, 0x11, 0x53, 0x02, 0xe8, 0x78, 0x29, 0x3d, 0x98, 0x11,
-  0xba, 0x91, 0xbb, 0xf7, 0xd2, 0xdb, 0x88, 0x02, 0xc7, 0x5a, 0x88, 0x8a,
-  0x4f, 0x39, 0xc7, 0xac, 0x80, 0x75, 0x26, 0xc3, 0x56, 0xe7, 0x04, 0x85,
-  0x69, 0xf5, 0xd5, 0xd4, 0xb2, 0x8e, 0x75, 0x80, 0x82, 0xd0, 0x3a, 0xd1,
-  0x09, 0xfc, 0x4a, 0x96, 0x9a, 0x93, 0x04, 0x88, 0x38, 0x5e, 0x4c, 0x88,
-  0x09, 0xb0, 0x23, 0x05, 0x39, 0x8f, 0x40, 0xd5, 0x7f, 0x8a, 0x16, 0x0b,
-  0x12, 0x48, 0xf7, 0xf6, 0x9f, 0x8d, 0xe1, 0x8f, 0x8d, 0x3f, 0xcf, 0xe0,
-  0x18, 0x88, 0xa4, 0xa6, 0x3b, 0x2a, 0x57, 0x63, 0x47, 0xe5, 0xda, 0x77,
-  0x5a, 0x28, 0xee, 0xab, 0x5a, 0xb9, 0xc6, 0xab, 0xa9, 0xc3, 0x72, 0xc1,
-  0x76, 0xa8, 0x4e, 0xcb, 0xb0, 0x27, 0xfd, 0x69, 0xbb, 0x7a, 0x6c, 0xc8,
-  0x52, 0x82, 0xb0, 0x46, 0x47, 0x60, 0x0d, 0x95, 0xfa, 0x31, 0x67, 0x9c,
-  0xe4, 0x76, 0x0d, 0xbf, 0x8f, 0xd6, 0x0b, 0x84, 0xfb, 0x22, 0x3a, 0x91,
-  0x00, 0x6a, 0x9d, 0x7b, 0xe3, 0x43, 0x81, 0xae, 0xc9, 0x4e, 0xa1, 0xd9,
-  0x8f, 0xda, 0x53, 0x21, 0xda, 0xbe, 0x42, 0xe0, 0x90, 0x0d, 0xde, 0x42,
-  0x73, 0x6f, 0x2f, 0x5d, 0xc3, 0x91, 0x3e, 0xe1, 0x55, 0x93, 0x82, 0x89,
-  0x29, 0xf5, 0x2a, 0xc6, 0xa9, 0xe0, 0xa3, 0xaa, 0x99, 0xc8, 0x3a, 0x5f,
-  0x86, 0x8d, 0x19, 0x50, 0xad, 0x19, 0xe9, 0x07, 0xde, 0xc2, 0xc6, 0x5b,
-  0xcd, 0xee, 0xf8, 0x8f, 0x9a, 0x25, 0x24, 0xc3, 0x2a, 0xd2, 0xff, 0xc6,
-  0x64, 0xd7, 0x27, 0xc1, 0x02, 0xd3, 0x65, 0xc7, 0x36, 0xe6, 0xb6, 0x63,
-  0xd3, 0xe7, 0xf6, 0x19, 0x6f, 0x7a, 0xb3, 0x92, 0x84, 0xa9, 0xfc, 0x86,
-  0x04, 0xcf, 0x4d, 0x32, 0xe1, 0x53, 0x4e, 0xb7, 0x7a, 0x70, 0x95, 0x1c,
-  0xc4, 0x77, 0xda, 0x86, 0x23, 0xf0, 0x4a, 0x73, 0x64, 0x1d, 0x81, 0x58,
-  0x25, 0x73, 0xd9, 0xd8, 0x72, 0xb4, 0x55, 0x32, 0x30, 0x2f, 0xa2, 0x4f,
-  0x29, 0xa4, 0x23, 0xfd, 0x34, 0x5d, 0x05, 0x0f, 0x6b, 0xcf, 0x62, 0xb7,
-  0xac, 0xc1, 0xde, 0x09, 0xf7, 0xec, 0xd2, 0x67, 0xb8, 0x6e, 0x3c, 0xe2,
-  0x4f, 0xe6, 0x9d, 0x25, 0xbe, 0x14, 0x4c, 0x41, 0x48, 0x07, 0x6e, 0x7d,
-  0x13, 0x23, 0xd6, 0x86, 0x1b, 0x19, 0x60, 0xab, 0x9f, 0xd9, 0x77, 0x8b,
-  0x93, 0xfe, 0x55, 0x80, 0x98, 0xaa, 0xcf, 0xf9, 0x63, 0x32, 0x94, 0x0c,
-  0x4d, 0xc7, 0x1f, 0xf2, 0x0b, 0x0c, 0x2f, 0x73, 0xc4, 0x2f, 0xa8, 0xa8,
-  0x97, 0x6a, 0x16, 0xef, 0xcb, 0xe1, 0x6c, 0x46, 0xb7, 0x8e, 0xf7, 0x8b,
-  0x87, 0xd5, 0x2a, 0xb9, 0x01, 0x58, 0x4a, 0x34, 0xab, 0x85, 0x52, 0x9d,
-  0x97, 0xc6, 0x21, 0x80, 0xea, 0x04, 0x4e, 0xe4, 0x6f, 0x23, 0x91, 0xbe,
-  0x69, 0x35, 0xc9, 0x9b, 0xff, 0x48, 0x2f, 0xeb, 0x62, 0x33, 0x72, 0xa7,
-  0xb2, 0x26, 0x17, 0xf3, 0x43, 0x28, 0xcf, 0x89, 0xe5, 0xb8, 0xdc, 0xb9,
-  0x08, 0xaf, 0x2c, 0xc7, 0xa5, 0x76, 0x4b, 0x62, 0x05, 0x8c, 0xc6, 0x53,
-  0x91, 0x73, 0xeb, 0xdb, 0xb8, 0xf7, 0x3b, 0xb1, 0xa6, 0x9d, 0x26, 0x52,
-  0xed, 0x4e, 0x2d, 0xab, 0x2b, 0xda, 0x78, 0x56, 0xc9, 0x7a, 0x78, 0x19,
-  0x47, 0x89, 0x09, 0x3a, 0xfe, 0x7c, 0xf2, 0xe5, 0xaa, 0xda, 0x47, 0x95,
-  0xb2, 0xf3, 0x9b, 0x19, 0x2f, 0x0a, 0xc2, 0xb8, 0xf8, 0xf4, 0x66, 0x41,
-  0x49, 0xd0, 0xb8, 0x97, 0xe1, 0x33, 0xce, 0xda, 0xc9, 0x30, 0x10, 0x07,
-  0x8d, 0x20, 0xa9, 0x0e, 0x8c, 0x27, 0xf2, 0x31, 0xb7, 0x0c, 0x30, 0xd0,
-  0xd5, 0x25, 0x1c, 0x76, 0x9f, 0x1d, 0x47, 0xad, 0xc4, 0x44, 0x1c, 0xbf,
-  0x79, 0x61, 0xf0, 0x5f, 0x66, 0xeb, 0x92, 0x82, 0x2a, 0xa3, 0x6c, 0xce,
-  0x86, 0x66, 0x9f, 0xff, 0xf9, 0xdb, 0x37, 0xe9, 0x47, 0xe9, 0x83, 0xb7,
-  0x26, 0xd2, 0x9b, 0x30, 0xb4, 0x43, 0x7c, 0x20, 0xeb, 0x70, 0x2e, 0x84,
-  0x53, 0x4e, 0x3c, 0x4a, 0xf8, 0x1b, 0xa5, 0xdf, 0xe3, 0x16, 0x81, 0xa2,
-  0x9f, 0xe2, 0x68, 0x32, 0x67, 0x07, 0xbc, 0xe1, 0x44, 0x7f, 0xf5, 0x53,
-  0xe0, 0x3d, 0xc2, 0xe6, 0x0e, 0x0f, 0x10, 0x2e, 0x3f, 0xde, 0x9d, 0x74,
-  0x7e, 0x80, 0xf8, 0xf9, 0xf9, 0x81, 0x38, 0x7a, 0x25, 0x5b, 0x5a, 0x38,
-  0x3c, 0x80, 0x6d, 0x55, 0x0f, 0xf4, 0xb4, 0xd7, 0xef, 0xf5, 0x55, 0xc9,
-  0x0b, 0x24, 0x9c, 0xc3, 0x9f, 0x0c, 0xa8, 0x3e, 0x47, 0xf8, 0x0c, 0xfd,
-  0x48, 0xd2, 0xc5, 0xa9, 0xeb, 0xb9, 0xf3, 0xaa, 0x6e, 0x8f, 0x6d, 0xb9,
-  0x18, 0xfe, 0x22, 0xc4, 0xbc, 0xed, 0xe5, 0x4c, 0x6e, 0x3c, 0x1a, 0x0d,
-  0x46, 0xa9, 0x3d, 0xd6, 0x2e, 0x01, 0xa9, 0x38, 0x7e, 0x09, 0xbf, 0x85,
-  0x24, 0x38, 0xf9, 0x30, 0x07, 0xe9, 0x8f, 0x42, 0x12, 0xe4, 0x85, 0x81,
-  0x79, 0x98, 0xe9, 0xe1, 0x96, 0x95, 0x42, 0x5b, 0x24, 0x10, 0xd4, 0x13,
-  0x8e, 0x24, 0x1c, 0x4f, 0xf8, 0x1d, 0xfc, 0xc0, 0xe7, 0xcb, 0x4e, 0x67,
-  0x3c, 0xf4, 0xc7, 0x84, 0xfb, 0x02, 0x58, 0x91, 0x78, 0x33, 0x0a, 0xf0,
-  0xd5, 0x3e, 0xdd, 0xb4, 0x3f, 0xa7, 0x69, 0x9f, 0x88, 0xb1, 0x21, 0x12,
-  0x59, 0xfb, 0xf4, 0x59, 0x82, 0x3d, 0xcc, 0x23, 0x9e, 0x3a, 0x82, 0xc2,
-  0x99, 0x0e, 0x31, 0x82, 0x03, 0x82, 0x02, 0x60, 0xc7, 0xaf, 0xf7, 0x9b,
-  0xe7, 0xdb, 0xa6, 0x74, 0x17, 0x90, 0x85, 0xbd, 0x3d, 0x79, 0xcd, 0x14,
-  0x81, 0x1c, 0x30, 0x9d, 0xf8, 0xdc, 0xed, 0x92, 0xbf, 0x89, 0xb3, 0x7e,
-  0x0d, 0x8c, 0x9a, 0xe3, 0x17, 0xf1, 0xce, 0x0e, 0xf9, 0x06, 0xe8, 0xdc,
-  0x85, 0x58, 0x31, 0xa0, 0x03, 0x8b, 0x59, 0x81, 0x27, 0x36, 0x62, 0x47,
-  0x5c, 0xbf, 0x94, 0x84, 0xa6, 0xe3, 0x97, 0xc3, 0x9f, 0x3e, 0x90, 0x3e,
-  0xbe, 0x3b, 0x79, 0x1d, 0xfc, 0x11, 0x85, 0x07, 0xdb, 0x6a, 0x21, 0x94,
-  0xee, 0x16, 0xfe, 0xd4, 0xaf, 0x83, 0x13, 0xf3, 0xd1, 0x3a, 0xc1, 0x94,
-  0xa2, 0xb9, 0x63, 0x87, 0x2b, 0xe9, 0x23, 0x3e, 0xfd, 0xb7, 0xc1, 0x8d,
-  0xd1, 0x89, 0xab, 0xb1, 0x05, 0x80, 0x6a, 0x7f, 0x16, 0xd7, 0x41, 0x07,
-  0x63, 0x3c, 0x13, 0x4a, 0xfd, 0x59, 0x45, 0xc1, 0xab, 0x90, 0x4d, 0x14,
-  0x97, 0x1a, 0x13, 0x7a, 0xfc, 0x52, 0x59, 0x90, 0x3e, 0x78, 0x63, 0x00,
-  0x17, 0x8b, 0xe7, 0x1e, 0x7e, 0x60, 0x82, 0xdf, 0xb1, 0xfc, 0x73, 0x10,
-  0x78, 0xc1, 0xa1, 0xbb, 0x7e, 0x79, 0xb8, 0x0c, 0x82, 0x33, 0x1f, 0x90,
-  0x28, 0xa8, 0x3c, 0xac, 0xfa, 0x2b, 0xe9, 0xfa, 0x42, 0x6a, 0x89, 0xfe,
-  0x1e, 0x7d, 0x4c, 0x49, 0x57, 0x04, 0x1f, 0x00, 0x66, 0x8f, 0x9e, 0xe1,
-  0x8f, 0x23, 0x6e, 0xf2, 0xc7, 0x09, 0x58, 0x5d, 0xa2, 0xec, 0x1c, 0xf6,
-  0x57, 0x40, 0xbf, 0x22, 0x06, 0xc5, 0x57, 0x2e, 0x62, 0x0b, 0xac, 0xa5,
-  0x79, 0xdf, 0x96, 0x83, 0x70, 0xe6, 0x1d, 0xcb, 0xab, 0x38, 0x49, 0xf9,
-  0x5e, 0x65, 0x9d, 0x14, 0x43, 0x31, 0x45, 0x4a, 0x7b, 0x94, 0x1c, 0x29,
-  0x27, 0x94, 0x02, 0x90, 0x23, 0x98, 0x7f, 0x26, 0x6c, 0x39, 0x7f, 0x73,
-  0x5e, 0x02, 0x79, 0x74, 0xad, 0x07, 0x21, 0x38, 0xf6, 0x1a, 0xcd, 0xf2,
-  0x7e, 0x15, 0x51, 0xcb, 0x7b, 0x72, 0xa5, 0x4f, 0x78, 0xdd, 0x4e, 0xc2,
-  0x62, 0xea, 0xd9, 0xf2, 0x15, 0x70, 0x92, 0xbb, 0xad, 0xcb, 0xf7, 0x3b,
-  0x0f, 0x46, 0x15, 0x65, 0xf7, 0x72, 0x53, 0x79, 0xd4, 0xa8, 0x3c, 0x6a,
-  0x54, 0x71, 0xa7, 0x76, 0x79, 0xd4, 0xb8, 0x3c, 0xea, 0xaa, 0x3c, 0xea,
-  0x6a, 0x54, 0x7f, 0x82, 0x30, 0x29, 0x0f, 0x9f, 0x94, 0x81, 0x4e, 0xcb,
-  0xa3, 0xa6, 0xa3, 0x56, 0x27, 0x07, 0x3f, 0x5a, 0x64, 0x79, 0xfd, 0xb6,
-  0xee, 0x76, 0xee, 0x98, 0xab, 0x15, 0x2a, 0xcd, 0x3b, 0x94, 0x2c, 0xf3,
-  0xcf, 0x51, 0x68, 0x81, 0xe7, 0xe5, 0xd4, 0x39, 0x56, 0x87, 0xb6, 0x0f,
-  0xb1, 0xb0, 0x99, 0xc5, 0x27, 0x4a, 0xab, 0x1f, 0x61, 0xc9, 0x0d, 0x6d,
-  0x0b, 0x9a, 0xdd, 0xe2, 0xf2, 0x96, 0x67, 0x8b, 0xd2, 0x37, 0xc8, 0x08,
-  0x0f, 0x42, 0x67, 0xa3, 0xdb, 0x82, 0x86, 0x98, 0x09, 0x21, 0x9a, 0x18,
-  0x8f, 0xcd, 0x70, 0xd9, 0xd0, 0xb6, 0x70, 0x4d, 0x3f, 0x02, 0x92, 0xef,
-  0x7e, 0x93, 0xde, 0xc2, 0xde, 0xe8, 0xf1, 0x20, 0x5c, 0x36, 0xf4, 0x48,
-  0x97, 0x01, 0xf1, 0x31, 0x7e, 0xae, 0x47, 0xb8, 0x8d, 0x06, 0x17, 0x90,
-  0xa2, 0x63, 0x73, 0x73, 0x2a, 0xd0, 0x42, 0xcf, 0x1c, 0x83, 0x9a, 0xab,
-  0x13, 0x55, 0x4c, 0xc2, 0x97, 0x2c, 0x15, 0xf5, 0x8c, 0x03, 0xac, 0x08,
-  0xa3, 0xdc, 0x49, 0x15, 0x9e, 0x82, 0x17, 0xaf, 0x99, 0x91, 0x2b, 0x4a,
-  0x80, 0x8c, 0x83, 0x6c, 0x4b, 0x50, 0xb8, 0xc7, 0x28, 0x73, 0x7f, 0x12,
-  0x76, 0x8b, 0x28, 0xfc, 0x09, 0xf1, 0x62, 0x66, 0x53, 0x6f, 0x64, 0x85,
-  0x6a, 0x04, 0x7f, 0xf9, 0x60, 0xfc, 0xf4, 0x5f, 0x48, 0x4c, 0xb9, 0x10,
-  0xf1, 0xc5, 0xbb, 0x06, 0xd3, 0x37, 0x10, 0xac, 0x73, 0x77, 0x2b, 0x59,
-  0x1b, 0xc3, 0x35, 0x79, 0x6d, 0x0d, 0x5f, 0xbd, 0x00, 0x6a, 0xff, 0x46,
-  0x34, 0x49, 0xf7, 0xa2, 0x89, 0xa7, 0x06, 0x59, 0x07, 0x83, 0x2f, 0x2b,
-  0x84, 0xed, 0x52, 0x60, 0x1b, 0xdd, 0x95, 0x6d, 0x59, 0x04, 0x38, 0x4b,
-  0x83, 0x88, 0x64, 0x5e, 0x7c, 0x20, 0xb0, 0xb6, 0xcb, 0x28, 0xc2, 0x95,
-  0xbd, 0x00, 0x39, 0x7f, 0xd4, 0xee, 0x41, 0x5f, 0xe0, 0x67, 0x63, 0xe1,
-  0x92, 0x8f, 0x3f, 0xeb, 0x46, 0x6e, 0x06, 0xe2, 0x60, 0xd9, 0x2b, 0x4e,
-  0x59, 0xb5, 0x61, 0x65, 0x9e, 0x3a, 0xb7, 0x69, 0x5d, 0xe5, 0x97, 0x01,
-  0xaf, 0xae, 0x56, 0x32, 0xb4, 0x4a, 0x4c, 0xc0, 0xf1, 0x75, 0x4a, 0x06,
-  0xf9, 0x65, 0xea, 0x94, 0x29, 0xa8, 0x23, 0xf3, 0x02, 0x73, 0x85, 0xdb,
-  0x9f, 0x15, 0x31, 0x1f, 0x33, 0xbb, 0x86, 0xc3, 0x12, 0x63, 0x53, 0xce,
-  0x91, 0x17, 0x02, 0x68, 0x55, 0xa4, 0x1c, 0x57, 0x17, 0xea, 0xd7, 0xe9,
-  0xcd, 0x56, 0x05, 0x61, 0x01, 0xe4, 0x4a, 0x51, 0x99, 0xb8, 0xc0, 0x74,
-  0x57, 0xa3, 0x70, 0x22, 0x8e, 0x96, 0x18, 0x82, 0x7f, 0x11, 0x79, 0x25,
-  0x80, 0x0e, 0xfb, 0xc3, 0xed, 0x0b, 0x1d, 0xed, 0x6c, 0x4f, 0x52, 0x0d,
-  0xf1, 0x9e, 0x03, 0x00, 0x9d, 0xbe, 0xe3, 0xa0, 0x21, 0x53, 0xdc, 0x9e,
-  0xfd, 0xd0, 0xef, 0x36, 0xfb, 0xb8, 0x62, 0xaf, 0x9c, 0x2f, 0x69, 0x15,
-  0x6d, 0xa3, 0x8a, 0xb6, 0xab, 0x8a, 0xb6, 0x49, 0x6f, 0x54, 0xf1, 0x70,
-  0x5d, 0xc5, 0xc0, 0xfe, 0xa0, 0xdc, 0x98, 0xb9, 0x5b, 0xa4, 0x0a, 0x5f,
-  0xbf, 0x0a, 0x61, 0xbf, 0x12, 0xe3, 0xb4, 0x6a, 0xe4, 0xb4, 0xd7, 0x2e,
-  0x11, 0xb4, 0x7e, 0x5a, 0xd7, 0x1d, 0x51, 0x6d, 0x2b, 0x55, 0x3f, 0x7e,
-  0x5b, 0x05, 0x7f, 0x88, 0x79, 0xfb, 0x02, 0x07, 0x54, 0x49, 0xbe, 0xf1,
-  0x3e, 0x20, 0x7f, 0x8b, 0xf8, 0x6d, 0x1d, 0x0d, 0x1e, 0x03, 0x67, 0x9c,
-  0xa7, 0x18, 0x3c, 0x73, 0x89, 0x05, 0x59, 0xc1, 0x40, 0xed, 0x90, 0xc4,
-  0xb2, 0x39, 0xff, 0x01, 0xe6, 0x7e, 0xae, 0xbd, 0x7f, 0x0b, 0xd0, 0x57,
-  0x3b, 0x16, 0x68, 0x5f, 0x00, 0x1b, 0x38, 0x7b, 0xe1, 0xea, 0x78, 0x9f,
-  0x02, 0x10, 0x5e, 0xc6, 0xa7, 0xc4, 0x80, 0x0e, 0xa5, 0x19, 0x3c, 0xc3,
-  0x48, 0x53, 0x8d, 0x6c, 0x7a, 0x21, 0xe1, 0x4b, 0x8f, 0x9b, 0x72, 0x0c,
-  0x7c, 0xdb, 0x16, 0xa4, 0x83, 0xde, 0x99, 0x99, 0x44, 0xab, 0x92, 0x09,
-  0xe6, 0x9a, 0x8e, 0x67, 0x58, 0x88, 0x2d, 0xbd, 0xd3, 0x1b, 0x28, 0x78,
-  0xb0, 0x1c, 0x79, 0xf6, 0x4e, 0xf4, 0x4a, 0x9c, 0x98, 0x3c, 0xab, 0xfd,
-  0x80, 0x88, 0x27, 0xc1, 0x97, 0x85, 0x9b, 0xe6, 0x61, 0x04, 0x74, 0x66,
-  0x79, 0x91, 0x2d, 0xb2, 0x84, 0x66, 0x60, 0xfb, 0x74, 0x66, 0x02, 0x41,
-  0x90, 0xfe, 0xdf, 0xee, 0x88, 0xab, 0xef, 0xd8, 0x4b, 0x9e, 0x74, 0xf9,
-  0xe0, 0x7b, 0xa4, 0x40, 0xfe, 0x6c, 0xa3, 0xa1, 0xcb, 0x7c, 0x4f, 0x02,
-  0x21, 0xc6, 0xd7, 0xe5, 0xf4, 0x1d, 0x36, 0xb2, 0x92, 0xbc, 0x88, 0x46,
-  0x97, 0x93, 0x17, 0xd1, 0x88, 0x56, 0xba, 0x15, 0x6d, 0xb1, 0x9f, 0x95,
-  0x15, 0x7c, 0xc7, 0x8b, 0x2e, 0x17, 0xde, 0x07, 0x23, 0x2b, 0xfc, 0x6d,
-  0x2d, 0xba, 0xcc, 0x5f, 0xe9, 0x22, 0x2b, 0x99, 0x77, 0xb2, 0xe8, 0x72,
-  0xe6, 0x9d, 0x2c, 0xb2, 0xc2, 0xeb, 0x91, 0xba, 0xcc, 0x8b, 0x89, 0x48,
-  0x9e, 0x78, 0x1b, 0x0a, 0x52, 0x18, 0xbf, 0x23, 0x45, 0x89, 0xdf, 0x6c,
-  0xa2, 0xcb, 0x99, 0x37, 0x9b, 0xc8, 0x4a, 0xf6, 0xe5, 0x24, 0xba, 0x5c,
-  0x7a, 0x39, 0x89, 0x18, 0xc0, 0xb4, 0x54, 0x2e, 0xbd, 0x5f, 0x44, 0x56,
-  0x38, 0x8d, 0xf9, 0xf7, 0x4e, 0xf0, 0x56, 0xf6, 0x18, 0x01, 0x50, 0x90,
-  0xbe, 0x7f, 0x20, 0xd3, 0xfe, 0x00, 0xcc, 0x96, 0x93, 0xf7, 0x4c, 0x08,
-  0x24, 0x7c, 0x42, 0xf2, 0x5a, 0x01, 0x68, 0x4d, 0x9e, 0xed, 0xd7, 0xe5,
-  0xd2, 0x4b, 0x01, 0x80, 0x43, 0xe2, 0xf1, 0x7c, 0xe0, 0x91, 0x78, 0x98,
-  0x5f, 0x60, 0x88, 0x5c, 0x63, 0x03, 0xf2, 0x46, 0x43, 0x80, 0xbe, 0xf4,
-  0x42, 0xba, 0x88, 0x5c, 0x44, 0x42, 0x2c, 0xe0, 0xaf, 0x78, 0x57, 0xad,
-  0x9c, 0x79, 0x54, 0x5f, 0x56, 0xf0, 0xc1, 0x0b, 0x5d, 0xc6, 0x47, 0x37,
-  0x62, 0x36, 0x3e, 0xa0, 0x70, 0x93, 0x87, 0x49, 0x92, 0xd6, 0xff, 0xad,
-  0xee, 0x49, 0x77, 0x1b, 0x37, 0x9a, 0x7c, 0x15, 0x0e, 0x90, 0x31, 0xc5,
-  0x35, 0xad, 0xf1, 0x38, 0x07, 0xf2, 0x59, 0xd1, 0x0c, 0xe6, 0xcc, 0x18,
-  0xf1, 0x1c, 0xc8, 0x38, 0xfb, 0xe5, 0x43, 0x36, 0x70, 0x74, 0x50, 0x16,
-  0x6d, 0x49, 0x14, 0x48, 0xca, 0x47, 0x6c, 0x03, 0xfb, 0x10, 0xfb, 0x20,
-  0xfb, 0x0c, 0xfb, 0x28, 0xfb, 0x24, 0x5b, 0x57, 0xdf, 0x4d, 0x39, 0xc9,
-  0xb7, 0xfb, 0x63, 0x81, 0x64, 0x2c, 0x76, 0x55, 0x1f, 0x55, 0xdd, 0x5d,
-  0x5d, 0xdd, 0x5d, 0x5d, 0xc5, 0x88, 0xd6, 0x4b, 0x0f, 0x80, 0xc8, 0xb3,
-  0x09, 0xa1, 0x59, 0x3d, 0x9b, 0x48, 0x73, 0xfd, 0x5e, 0x01, 0x32, 0x98,
-  0x07, 0x0a, 0x56, 0xfa, 0xa9, 0x3c, 0x75, 0x70, 0xe0, 0xc9, 0xa4, 0x2e,
-  0x60, 0x5e, 0x61, 0x38, 0xad, 0x26, 0x19, 0xad, 0xa6, 0x09, 0x3b, 0x25,
-  0x79, 0x9e, 0xfc, 0xa3, 0xda, 0x24, 0x57, 0xe5, 0x62, 0x91, 0xac, 0x8a,
-  0x02, 0x3d, 0xa8, 0x25, 0xf4, 0xb8, 0x62, 0x56, 0x9e, 0x6d, 0x60, 0x22,
-  0x5c, 0x96, 0xa3, 0x04, 0x76, 0x2f, 0x20, 0x0f, 0xdb, 0xcd, 0x3a, 0x79,
-  0xf1, 0xa9, 0xaf, 0x46, 0x63, 0xa1, 0xfb, 0xd8, 0x7b, 0x80, 0x91, 0xe6,
-  0x6a, 0xee, 0xd1, 0x84, 0x07, 0x4e, 0xdb, 0x93, 0x4d, 0xc6, 0x1d, 0x39,
-  0x39, 0x63, 0x7a, 0x81, 0x73, 0x30, 0x00, 0x2b, 0x18, 0x77, 0xe4, 0x5a,
-  0x0a, 0x18, 0x48, 0xae, 0xb0, 0x72, 0xe3, 0xd7, 0xea, 0x30, 0x45, 0x7b,
-  0x1e, 0x95, 0x42, 0x5e, 0xaa, 0xa0, 0x5b, 0xc9, 0x59, 0x55, 0x6e, 0xdc,
-  0x51, 0x41, 0x45, 0xe8, 0x87, 0x2a, 0xbf, 0x29, 0xa0, 0xce, 0x7f, 0xbc,
-  0x01, 0x86, 0xaf, 0x20, 0xe7, 0x87, 0x8f, 0x69, 0x4e, 0x2f, 0x31, 0xb0,
-  0x10, 0x7c, 0x90, 0x91, 0xf3, 0x98, 0xb5, 0x5e, 0x58, 0xa4, 0x39, 0x1a,
-  0x87, 0x1f, 0xa6, 0xdf, 0x93, 0xa9, 0xfa, 0x78, 0x33, 0x3b, 0x4c, 0x2d,
-  0x03, 0x54, 0x1c, 0x4b, 0x64, 0x7f, 0x88, 0x23, 0x89, 0x2d, 0x12, 0x73,
-  0x31, 0x95, 0x83, 0x91, 0x2f, 0x36, 0x73, 0x39, 0xda, 0xbf, 0x21, 0x27,
-  0xb4, 0xfd, 0x1b, 0xd6, 0xaa, 0x5a, 0xae, 0xed, 0xda, 0x98, 0x77, 0x3c,
-  0x61, 0xf5, 0xfc, 0x3d, 0x00, 0x8a, 0x65, 0xee, 0x26, 0x3d, 0x58, 0xa2,
-  0x33, 0x22, 0x0a, 0x37, 0x81, 0xc4, 0x0a, 0x3a, 0x9c, 0xcd, 0x99, 0x93,
-  0xcc, 0xc0, 0x71, 0x53, 0x5f, 0x56, 0xd0, 0x5e, 0xed, 0x13, 0x47, 0x92,
-  0x66, 0x33, 0x93, 0xf6, 0xf6, 0x2d, 0x24, 0x3a, 0x63, 0x04, 0x36, 0x55,
-  0x94, 0x84, 0x7d, 0x8e, 0x69, 0xe4, 0x90, 0x26, 0x1f, 0x2b, 0xe7, 0x32,
-  0x38, 0x21, 0xc4, 0xcd, 0x4c, 0x5e, 0x6b, 0x07, 0x7c, 0x94, 0x59, 0x7e,
-  0x27, 0x7c, 0x1d, 0xd4, 0xef, 0xf7, 0x09, 0x83, 0xf7, 0x84, 0x8c, 0x50,
-  0xd5, 0x0c, 0xe7, 0x02, 0xac, 0xc1, 0x05, 0xc9, 0x84, 0x1f, 0xec, 0x2e,
-  0x81, 0x31, 0xfe, 0xee, 0x12, 0x06, 0x3c, 0xee, 0x44, 0x40, 0xf2, 0xa9,
-  0xed, 0x1f, 0x32, 0xa2, 0xd6, 0x4d, 0x30, 0xe6, 0x40, 0x20, 0xa1, 0xe6,
-  0xd0, 0xdd, 0xee, 0xce, 0x83, 0x90, 0xc9, 0xf2, 0x09, 0xd9, 0x66, 0x9b,
-  0xa4, 0x41, 0xc1, 0x68, 0x8a, 0x01, 0xcc, 0x71, 0xcd, 0x62, 0x40, 0x52,
-  0xe2, 0x6d, 0xbf, 0x62, 0x10, 0x19, 0x5a, 0x40, 0xd1, 0xeb, 0x0d, 0x14,
-  0x6d, 0x6b, 0x28, 0xb8, 0x3e, 0xb7, 0xc8, 0xda, 0x56, 0xf7, 0xfc, 0x29,
-  0xd0, 0x59, 0x8f, 0x40, 0x16, 0xe0, 0x9f, 0xbd, 0xe3, 0xea, 0x2a, 0x91,
-  0xb1, 0x91, 0xf4, 0xf0, 0xa9, 0x00, 0xf4, 0x00, 0x94, 0x90, 0xc3, 0x46,
-  0xe4, 0x26, 0x99, 0xe3, 0xed, 0x20, 0x06, 0x9a, 0xa9, 0x36, 0x6d, 0x93,
-  0x99, 0x12, 0xc6, 0xa3, 0x05, 0xd1, 0x0f, 0x83, 0x4d, 0x7e, 0x25, 0x3d,
-  0x6c, 0x2d, 0x0e, 0x4f, 0xce, 0x7d, 0x56, 0x55, 0x53, 0x58, 0xd8, 0x65,
-  0x40, 0x59, 0x59, 0x9b, 0x96, 0x25, 0xd1, 0x67, 0xfa, 0x9b, 0x68, 0x99,
-  0x9c, 0xf4, 0x8e, 0x69, 0x14, 0x51, 0xee, 0xe2, 0x7a, 0x52, 0x2c, 0x16,
-  0x78, 0x12, 0x15, 0x2b, 0x62, 0x0e, 0xad, 0x3c, 0x4c, 0xb1, 0xad, 0x28,
-  0x4b, 0x19, 0xcc, 0xd9, 0x41, 0x58, 0x4a, 0xdb, 0xaf, 0x9d, 0x9c, 0xd0,
-  0x85, 0x68, 0xc4, 0xfb, 0xf5, 0x53, 0x18, 0xaf, 0x47, 0xb3, 0x84, 0xc5,
-  0x16, 0x11, 0xd6, 0xe4, 0x49, 0x0b, 0x6b, 0xbe, 0xcc, 0x19, 0x40, 0xc0,
-  0xeb, 0xcf, 0x39, 0xb1, 0xa1, 0xaf, 0xf3, 0xa1, 0x99, 0x34, 0x2c, 0x4a,
-  0x00, 0x01, 0x91, 0xc9, 0xed, 0x26, 0x69, 0x91, 0xab, 0x7c, 0x88, 0x90,
-  0x94, 0x4d, 0xb2, 0x69, 0x36, 0xa3, 0xc5, 0xe2, 0x26, 0x19, 0x43, 0x4b,
-  0x24, 0x3b, 0x4f, 0x4f, 0x6a, 0x2c, 0xce, 0xd1, 0x64, 0x42, 0x6a, 0x43,
-  0xb9, 0xee, 0x27, 0x4c, 0x2f, 0x25, 0x42, 0xc9, 0xe5, 0x0a, 0x44, 0xdc,
-  0xa8, 0x29, 0x12, 0x3d, 0x82, 0xfa, 0xb8, 0x1a, 0x2e, 0xd6, 0xb2, 0x4e,
-  0x49, 0xd7, 0xb0, 0x25, 0x75, 0x42, 0x8c, 0x3e, 0x2b, 0x2f, 0x8b, 0x26,
-  0x59, 0x56, 0x20, 0xe9, 0x78, 0x4d, 0x4f, 0x40, 0x17, 0x80, 0x36, 0xa8,
-  0xc4, 0x31, 0x8c, 0x65, 0xf2, 0x82, 0xa9, 0x4a, 0xe2, 0xb6, 0xbc, 0x80,
-  0x12, 0x60, 0xf6, 0x02, 0x16, 0xc9, 0x96, 0x64, 0x84, 0x63, 0x87, 0xaa,
-  0xa5, 0x31, 0x3c, 0x00, 0x29, 0x5a, 0x11, 0x0b, 0x58, 0xb0, 0x52, 0x63,
-  0xa5, 0x00, 0x92, 0x2f, 0xef, 0xb1, 0x6c, 0xb1, 0xe8, 0x4e, 0x40, 0x76,
-  0x24, 0x6b, 0x5e, 0x42, 0x97, 0xc5, 0x68, 0x25, 0x35, 0x6b, 0xde, 0xd3,
-  0x74, 0x62, 0x76, 0x26, 0x22, 0x8a, 0x54, 0x59, 0x46, 0xc4, 0xec, 0xc9,
-  0x9c, 0x6d, 0x48, 0x58, 0x73, 0xa3, 0xd6, 0xe5, 0xba, 0x40, 0x9f, 0xc3,
-  0xc9, 0xd5, 0xbc, 0x58, 0xa9, 0x1a, 0x88, 0x6a, 0x15, 0x0d, 0xa2, 0x51,
-  0x05, 0xb1, 0x16, 0xb1, 0xc7, 0x6a, 0xc4, 0x1a, 0x99, 0x3a, 0x48, 0xd0,
-  0x01, 0x3e, 0xcd, 0x6b, 0x64, 0x37, 0x2c, 0x1d, 0x1b, 0x58, 0x2d, 0x7f,
-  0x7c, 0x9b, 0xac, 0xaa, 0xb2, 0x29, 0x54, 0x3e, 0x99, 0xb1, 0xaf, 0xcb,
-  0xb3, 0xb2, 0x85, 0x65, 0x94, 0xbc, 0xc3, 0x32, 0x0b, 0x12, 0x8e, 0x76,
-  0x91, 0x20, 0xbf, 0x12, 0x8c, 0xde, 0x88, 0xa2, 0x40, 0xd5, 0x86, 0xb3,
-  0xfa, 0x7d, 0xb9, 0x2a, 0x97, 0x9b, 0xa5, 0xd3, 0x2e, 0xc9, 0x33, 0x62,
-  0x82, 0xe4, 0x92, 0xb8, 0x85, 0x52, 0xcf, 0x8a, 0x5a, 0xb7, 0x95, 0xe6,
-  0xfe, 0x3b, 0x98, 0x72, 0x15, 0x30, 0x7d, 0x85, 0xdc, 0xc3, 0x08, 0x2d,
-  0x38, 0x83, 0x70, 0xf8, 0xd0, 0x6e, 0xbd, 0x98, 0xea, 0x06, 0xf2, 0xcc,
-  0xff, 0x04, 0x94, 0x54, 0x53, 0xd0, 0xbc, 0x58, 0x86, 0x25, 0xc2, 0x2d,
-  0x52, 0xc4, 0x16, 0x15, 0x3a, 0x73, 0x07, 0x39, 0x6b, 0x58, 0xae, 0x72,
-  0x8b, 0x7c, 0x50, 0x22, 0x26, 0x91, 0x68, 0x2c, 0x49, 0xa3, 0x05, 0x89,
-  0x62, 0xbb, 0x6e, 0x1c, 0x4a, 0x0f, 0x1e, 0x95, 0xb0, 0x21, 0x48, 0x6a,
-  0x18, 0xec, 0xc0, 0xed, 0x6a, 0x01, 0xdf, 0x38, 0xb0, 0x90, 0x95, 0x7a,
-  0x94, 0x7a, 0x9d, 0xa9, 0xf4, 0x07, 0xb6, 0x4b, 0x4d, 0x50, 0xf1, 0xf8,
-  0x1d, 0xd4, 0xf8, 0x27, 0x13, 0x3c, 0x99, 0x85, 0x42, 0xea, 0x9a, 0x2f,
-  0xd5, 0xa0, 0x80, 0x84, 0xed, 0xa4, 0x40, 0x3f, 0x3a, 0x1b, 0x61, 0x60,
-  0x82, 0x64, 0x98, 0xd0, 0xc4, 0xed, 0x81, 0xde, 0xb2, 0x97, 0xe5, 0x09,
-  0x3b, 0xaf, 0xa5, 0xf4, 0x62, 0x24, 0xe9, 0xbb, 0x99, 0x66, 0xbf, 0x51,
-  0xa6, 0x60, 0x22, 0xd3, 0xc1, 0x06, 0x68, 0x0e, 0x54, 0x21, 0x4d, 0x40,
-  0xa3, 0xdf, 0xe4, 0x89, 0xc4, 0x49, 0x48, 0xb4, 0x6a, 0x85, 0xfa, 0xc1,
-  0xe8, 0xb2, 0x42, 0x5f, 0xe0, 0x14, 0xa7, 0x07, 0x78, 0xf0, 0xe1, 0xe4,
-  0x13, 0x7c, 0x40, 0x37, 0xd1, 0x78, 0x72, 0xee, 0xf4, 0x0e, 0xd3, 0xc8,
-  0xad, 0xa0, 0xc2, 0xa1, 0xe3, 0x7b, 0x90, 0x62, 0xce, 0x85, 0x92, 0x02,
-  0xfa, 0x2a, 0xb1, 0x3e, 0x33, 0x07, 0xe1, 0x6c, 0x9d, 0xb0, 0x2b, 0x00,
-  0x48, 0x2b, 0xec, 0x65, 0x39, 0x1f, 0x57, 0xa9, 0x5a, 0x96, 0xd3, 0xe9,
-  0xb6, 0xae, 0x17, 0x58, 0xa2, 0xd4, 0x42, 0xa9, 0xdb, 0xad, 0x15, 0x94,
-  0x9b, 0xd1, 0xf4, 0x86, 0x56, 0x77, 0x69, 0x72, 0x42, 0x29, 0x1e, 0x96,
-  0x8a, 0x21, 0xe1, 0x20, 0xaa, 0x44, 0x0f, 0x97, 0xce, 0x91, 0x11, 0xf5,
-  0x15, 0x0c, 0x06, 0x9c, 0x54, 0xb8, 0xb8, 0x94, 0x30, 0xab, 0x92, 0x3d,
-  0x3d, 0x18, 0xd9, 0x30, 0x79, 0xe1, 0x57, 0xd3, 0x14, 0xab, 0xa6, 0xaa,
-  0x4f, 0x69, 0x6d, 0xc5, 0x55, 0x08, 0xbf, 0xec, 0x4e, 0x82, 0x12, 0xd6,
-  0xa6, 0xfe, 0xf5, 0x08, 0x84, 0x57, 0x47, 0xed, 0x68, 0xa5, 0x8f, 0x96,
-  0x10, 0x4e, 0x83, 0x05, 0x06, 0xa5, 0xc0, 0x44, 0x04, 0xfe, 0x42, 0xdb,
-  0xcf, 0x0a, 0xd6, 0x02, 0xf7, 0xd4, 0x9d, 0xa6, 0xe1, 0xdb, 0x29, 0xee,
-  0x2c, 0x41, 0xab, 0xaa, 0x60, 0x96, 0x4b, 0xb7, 0xe1, 0x44, 0xad, 0xa7,
-  0x50, 0xc2, 0x4d, 0xd1, 0xf6, 0x1d, 0xdc, 0xd9, 0x12, 0x1b, 0xdc, 0x56,
-  0xeb, 0x35, 0x40, 0x61, 0x08, 0x3c, 0x3e, 0x79, 0xf3, 0xfe, 0xd3, 0xe3,
-  0xe4, 0x55, 0xd2, 0xa3, 0xae, 0x4f, 0x1e, 0x1f, 0x1f, 0xbd, 0x3f, 0x3a,
-  0x81, 0x84, 0x4c, 0x04, 0xe8, 0xe3, 0x93, 0xa3, 0xf7, 0x6f, 0x1e, 0x27,
-  0xbc, 0x53, 0x49, 0x7a, 0x8f, 0x5f, 0x7c, 0xff, 0xf1, 0x71, 0xe6, 0x96,
-  0xe9, 0x72, 0x43, 0xf4, 0x23, 0x9b, 0x01, 0xba, 0x57, 0x12, 0x8c, 0x2c,
-  0x85, 0xcb, 0x29, 0xaa, 0xb1, 0x4d, 0xc0, 0x36, 0xab, 0x58, 0x60, 0x00,
-  0xd0, 0xd5, 0x82, 0x60, 0x30, 0x25, 0x6a, 0xf2, 0x14, 0x7f, 0x50, 0xae,
-  0x92, 0x7a, 0xce, 0x5b, 0xa6, 0x3e, 0x6e, 0x68, 0x50, 0xc7, 0x86, 0x2d,
-  0x27, 0xac, 0x56, 0xdc, 0xfe, 0x39, 0x6c, 0x85, 0xaf, 0x46, 0x75, 0x41,
-  0x53, 0xbe, 0x49, 0x30, 0xbf, 0xae, 0x86, 0x4e, 0xf7, 0x4f, 0xc7, 0x2d,
-  0xae, 0x1e, 0x16, 0xa3, 0x59, 0x57, 0x12, 0x4e, 0x27, 0xac, 0x0f, 0x73,
-  0x06, 0xd9, 0x79, 0x20, 0x2a, 0xe4, 0x91, 0x1f, 0x09, 0xef, 0xdd, 0x2c,
-  0x8c, 0xd1, 0x59, 0x65, 0xb0, 0xd0, 0xfd, 0x74, 0x82, 0x17, 0x4b, 0x4a,
-  0xd0, 0x3a, 0x73, 0x11, 0xbb, 0xa2, 0x49, 0xf4, 0x6e, 0x8e, 0xd7, 0x05,
-  0xde, 0x9a, 0xa2, 0xb6, 0x50, 0x4c, 0x79, 0xf5, 0xe0, 0xce, 0x81, 0x11,
-  0x20, 0x19, 0x93, 0x71, 0x85, 0xae, 0x95, 0xb1, 0xa5, 0x4b, 0x10, 0xa1,
-  0x6b, 0xcc, 0xbe, 0xee, 0x3b, 0x55, 0xc8, 0x54, 0x3e, 0xb1, 0x38, 0xde,
-  0x6a, 0x1d, 0x0c, 0x85, 0xac, 0x62, 0x67, 0x3f, 0xf9, 0x76, 0x1f, 0x06,
-  0x00, 0x88, 0x99, 0x11, 0xac, 0x7f, 0xb3, 0x42, 0x29, 0x8d, 0xfd, 0xf4,
-  0xfe, 0x7e, 0xc0, 0x3b, 0xe7, 0x77, 0x6f, 0x8e, 0x3f, 0x9d, 0xbe, 0xf9,
-  0xf9, 0xe4, 0xf4, 0xcd, 0x87, 0xe1, 0xed, 0x7c, 0x3d, 0xe3, 0x75, 0x9b,
-  0xac, 0xaf, 0xa0, 0x4e, 0x7e, 0x5a, 0x06, 0x69, 0xfa, 0x9d, 0x9f, 0x92,
-  0xd5, 0x88, 0x09, 0x29, 0x0d, 0x2e, 0x5c, 0x7b, 0x33, 0xa5, 0xbc, 0x81,
-  0x08, 0x5e, 0x72, 0x6f, 0x2b, 0x2c, 0xc9, 0xaf, 0xca, 0x4c, 0xf8, 0xc5,
-  0x1c, 0x4a, 0xd5, 0x77, 0xbf, 0x5b, 0x2b, 0x94, 0xa8, 0x92, 0xa4, 0xbf,
-  0x0f, 0x13, 0xb4, 0x06, 0x43, 0x07, 0x8a, 0x86, 0xac, 0x41, 0x22, 0x82,
-  0x7a, 0x98, 0xdc, 0x80, 0x34, 0x66, 0x6b, 0x02, 0xc8, 0x4f, 0x2f, 0x74,
-  0x80, 0xd7, 0xd6, 0x13, 0x23, 0x29, 0x54, 0x20, 0x3f, 0xa0, 0x81, 0x18,
-  0x88, 0xce, 0x8b, 0x06, 0xd6, 0x13, 0x68, 0x2b, 0x69, 0x07, 0x6b, 0x5e,
-  0x1e, 0xf1, 0xe7, 0x69, 0x05, 0xeb, 0xdb, 0xc7, 0x1f, 0xe4, 0x83, 0x22,
-  0xf8, 0xb2, 0xee, 0x43, 0xf9, 0x61, 0x9e, 0xc2, 0x82, 0xd0, 0xd0, 0x0c,
-  0xf5, 0x33, 0x62, 0x78, 0xdf, 0xf4, 0xd5, 0xf1, 0xd1, 0xa7, 0x4f, 0x47,
-  0x1f, 0xbe, 0x7f, 0x04, 0x4a, 0x2e, 0xad, 0xd9, 0x4a, 0x3b, 0xaa, 0x47,
-  0xa5, 0xab, 0x1a, 0xdd, 0x0f, 0x3e, 0x8e, 0xcf, 0xa1, 0x7f, 0xfb, 0x68,
-  0x1f, 0x75, 0xb6, 0xea, 0x9d, 0xf4, 0x8b, 0x55, 0x6e, 0xb3, 0x3f, 0xc3,
-  0xd0, 0x68, 0x09, 0xfa, 0x46, 0x1e, 0xa6, 0xc5, 0x2a, 0x05, 0x95, 0x00,
-  0x97, 0x09, 0x0a, 0x6b, 0x4a, 0x3b, 0x69, 0x18, 0x4f, 0xf5, 0xe8, 0xac,
-  0xe8, 0x9f, 0x15, 0xed, 0x11, 0x4c, 0xb6, 0x1e, 0x3b, 0x29, 0x4e, 0xb3,
-  0xbb, 0x3b, 0x7e, 0x86, 0x31, 0x48, 0xb8, 0x47, 0xbf, 0x18, 0x96, 0xd3,
-  0xe1, 0xb3, 0x69, 0x35, 0xd9, 0x2c, 0x41, 0x6e, 0x23, 0xfa, 0x9b, 0x45,
-  0x81, 0x3f, 0x5f, 0xde, 0x1c, 0x4d, 0x7b, 0x25, 0xfa, 0xca, 0xdf, 0xac,
-  0x78, 0xf6, 0x62, 0xdc, 0xcd, 0x1b, 0xda, 0x00, 0xf6, 0xb2, 0x5b, 0xc9,
-  0x8e, 0x21, 0x55, 0x87, 0x3a, 0xb7, 0xfa, 0x21, 0x45, 0x0c, 0x92, 0x72,
-  0xd6, 0xe3, 0x36, 0x0d, 0x95, 0x07, 0xe3, 0xbb, 0x3b, 0x9d, 0x40, 0xae,
-  0x89, 0xa1, 0x24, 0x2c, 0xa3, 0x0f, 0xcb, 0xeb, 0x8b, 0x16, 0xd6, 0x29,
-  0x58, 0x89, 0x8b, 0x5e, 0x6a, 0x82, 0xb4, 0xa6, 0x39, 0x53, 0x95, 0x0d,
-  0x92, 0xfb, 0xa4, 0x58, 0x00, 0x97, 0x24, 0x43, 0x5d, 0x2c, 0x41, 0x07,
-  0x89, 0xe7, 0x01, 0x64, 0x89, 0xf0, 0x2a, 0xb4, 0xde, 0x4b, 0x73, 0xdb,
-  0x66, 0xf8, 0x45, 0xcf, 0xf8, 0x6b, 0xce, 0xb8, 0x85, 0x4d, 0x06, 0x00,
-  0x3e, 0xe0, 0x1b, 0x12, 0x0c, 0x32, 0x30, 0xfe, 0xe7, 0x57, 0xef, 0xde,
-  0xbc, 0x3e, 0x3d, 0xf9, 0x59, 0x4e, 0x8c, 0x3c, 0x67, 0x56, 0xea, 0xc8,
-  0x45, 0xbb, 0x23, 0xd3, 0x27, 0x06, 0xb4, 0x68, 0x18, 0x30, 0x1f, 0x9f,
-  0x58, 0x2e, 0x7b, 0x2c, 0x50, 0xb5, 0x36, 0x10, 0xe3, 0x58, 0xc7, 0x6c,
-  0x88, 0xf4, 0x79, 0x0a, 0xeb, 0x4c, 0x7e, 0x0b, 0x70, 0x0e, 0x2c, 0x41,
-  0xd1, 0x98, 0x90, 0x62, 0x0e, 0xb3, 0x1b, 0x94, 0x1a, 0x4b, 0x14, 0xc2,
-  0x0e, 0xf4, 0x09, 0x6c, 0x38, 0x93, 0xf1, 0x4d, 0x42, 0xc3, 0x42, 0x29,
-  0x59, 0x28, 0x9e, 0xfa, 0x09, 0xa8, 0x18, 0x51, 0xcd, 0x62, 0x06, 0xbf,
-  0xf6, 0xf0, 0xd4, 0x90, 0x2c, 0x26, 0x95, 0x58, 0x4a, 0x24, 0xf0, 0x52,
-  0xdf, 0x6b, 0x8b, 0xa2, 0x15, 0xd7, 0xc9, 0x6a, 0xc6, 0x4a, 0x2e, 0x63,
-  0xda, 0xf2, 0x8c, 0x3c, 0xfb, 0xe0, 0x4c, 0x8e, 0xb4, 0x83, 0xf3, 0xa2,
-  0x10, 0x43, 0xe6, 0x24, 0x4b, 0x94, 0x94, 0xd3, 0x12, 0xb7, 0x1e, 0x41,
-  0x5d, 0xc8, 0xbb, 0x37, 0x80, 0xf8, 0xd7, 0x2a, 0x7a, 0x55, 0x57, 0x4d,
-  0xb3, 0xb7, 0x2c, 0xa7, 0x2b, 0xd2, 0x86, 0x19, 0x17, 0xe4, 0x1d, 0xae,
-  0x42, 0x9b, 0x35, 0x5a, 0xfa, 0xe2, 0x56, 0x0f, 0x85, 0x62, 0x71, 0xcd,
-  0x3b, 0x91, 0x83, 0x83, 0xc3, 0xfd, 0xfd, 0xbd, 0xfd, 0x6f, 0xe0, 0xdf,
-  0x8c, 0x18, 0xc6, 0xfa, 0x00, 0x48, 0x30, 0x3c, 0xaa, 0xc1, 0xf6, 0xd0,
-  0x00, 0xd5, 0xd5, 0x36, 0x62, 0x6d, 0xca, 0xc4, 0x10, 0xdb, 0x20, 0x6d,
-  0x8c, 0x3a, 0x0e, 0x71, 0x8e, 0x7a, 0xf7, 0x94, 0xcf, 0x03, 0x54, 0x0f,
-  0x1b, 0xbd, 0x84, 0xa1, 0x57, 0xa3, 0x52, 0x9d, 0x55, 0xb9, 0xba, 0x84,
-  0xe9, 0x97, 0x9e, 0xdb, 0x25, 0x99, 0xca, 0x4a, 0xdf, 0xa8, 0x15, 0x93,
-  0x3b, 0x25, 0xc5, 0x1d, 0x6e, 0x9c, 0xc2, 0xa1, 0xc6, 0x80, 0x18, 0x13,
-  0x9f, 0x4b, 0x71, 0xa4, 0x72, 0x05, 0xf3, 0xa1, 0x9c, 0x62, 0x51, 0xf4,
-  0x43, 0x11, 0xd8, 0x63, 0xfa, 0x87, 0x44, 0x7a, 0x06, 0x6d, 0x92, 0x86,
-  0x08, 0x85, 0x69, 0xee, 0x3b, 0x0c, 0xc2, 0xc3, 0x8b, 0x4e, 0x47, 0x4f,
-  0x2e, 0x3a, 0x0f, 0xfc, 0xc0, 0x41, 0x90, 0x0c, 0x81, 0xb0, 0xe0, 0x9f,
-  0x70, 0x2b, 0x88, 0xc9, 0x09, 0x25, 0xf3, 0x6a, 0x5f, 0x49, 0x0d, 0x74,
-  0x30, 0xc6, 0x6d, 0xe3, 0xa6, 0xf7, 0x41, 0xe8, 0x92, 0x5e, 0xd7, 0x24,
-  0x4c, 0x11, 0xaa, 0xd9, 0xf3, 0xba, 0x5a, 0x95, 0xbf, 0xe3, 0xda, 0x81,
-  0xdc, 0xc6, 0x4e, 0x5b, 0x81, 0x0e, 0x4d, 0x11, 0xc5, 0x12, 0x3e, 0x6a,
-  0x7d, 0xc2, 0x85, 0xf4, 0x93, 0xbf, 0xcf, 0x61, 0x73, 0xce, 0x35, 0xc1,
-  0x38, 0xcb, 0x69, 0x96, 0xe5, 0xc9, 0xdf, 0x8b, 0x71, 0xf2, 0xd3, 0x51,
-  0x9e, 0xbc, 0xf8, 0x04, 0xff, 0x60, 0xfe, 0x8f, 0x27, 0x2f, 0x68, 0x3c,
-  0xb9, 0xea, 0xcc, 0xb4, 0x51, 0xe7, 0x7e, 0xa7, 0x72, 0x40, 0x60, 0x91,
-  0x29, 0x10, 0x8e, 0xd0, 0xf2, 0x6f, 0xab, 0x7f, 0x5b, 0xd1, 0x81, 0xd3,
-  0x5e, 0x33, 0xba, 0xc4, 0x01, 0x8d, 0x6b, 0x9d, 0x43, 0x95, 0x3b, 0xe6,
-  0x15, 0x75, 0x98, 0xef, 0x48, 0x85, 0x99, 0x81, 0xd5, 0x6b, 0x0e, 0xb9,
-  0xab, 0x1a, 0x8a, 0xdb, 0x7b, 0xb8, 0xa5, 0x50, 0xce, 0x64, 0x4e, 0x63,
-  0xec, 0xca, 0x21, 0x12, 0x33, 0xbf, 0x58, 0xdd, 0x28, 0x86, 0x70, 0x85,
-  0x4f, 0x98, 0x2f, 0x38, 0xac, 0x1b, 0xd1, 0x1f, 0x65, 0x6f, 0x48, 0xc1,
-  0x29, 0xb0, 0xc9, 0x94, 0x1f, 0x33, 0x33, 0x7d, 0xa8, 0x51, 0x48, 0x9b,
-  0xa9, 0x8b, 0xae, 0xca, 0x76, 0xde, 0xd5, 0x07, 0x98, 0xcb, 0x11, 0x4b,
-  0x7c, 0x86, 0x9b, 0xdb, 0xfd, 0x6c, 0x26, 0x14, 0xd1, 0x21, 0x33, 0x1c,
-  0x86, 0xcf, 0x0d, 0x54, 0x74, 0x35, 0xba, 0xa0, 0x42, 0x70, 0xfa, 0xd4,
-  0x09, 0x7e, 0x51, 0xa5, 0x03, 0xf8, 0x17, 0xba, 0xf4, 0x06, 0x54, 0x3d,
-  0xda, 0x8a, 0x8e, 0xa8, 0xe1, 0xb0, 0x50, 0x7f, 0xcb, 0x1b, 0x36, 0xcc,
-  0x22, 0xc7, 0xce, 0x98, 0x07, 0x0a, 0x1a, 0x03, 0xcf, 0x93, 0xaf, 0xf1,
-  0xe2, 0x1a, 0x96, 0x97, 0x46, 0xd1, 0xb8, 0x2a, 0xae, 0x5b, 0x97, 0xf3,
-  0xc8, 0xf8, 0x37, 0xac, 0x22, 0x12, 0x75, 0xe5, 0x8c, 0xb4, 0x5b, 0x58,
-  0x7e, 0x61, 0x83, 0x0c, 0x13, 0x9d, 0xb6, 0xf9, 0x6b, 0xda, 0xe4, 0xb2,
-  0xa4, 0x19, 0x4d, 0x26, 0xc5, 0xba, 0x0d, 0x07, 0xc6, 0x53, 0x94, 0x6c,
-  0x54, 0xce, 0x96, 0x19, 0x83, 0x1a, 0xe4, 0x73, 0x27, 0xdb, 0x01, 0x6e,
-  0x3c, 0xe0, 0x63, 0xea, 0x8e, 0xa3, 0x44, 0xd4, 0x56, 0x8b, 0x6f, 0xc8,
-  0x2c, 0xea, 0x88, 0xee, 0x06, 0x72, 0xd1, 0x66, 0xf7, 0xf4, 0xda, 0xe4,
-  0x36, 0x52, 0x0a, 0x30, 0xf0, 0x38, 0x5a, 0x4d, 0x43, 0x69, 0xb4, 0xb7,
-  0x16, 0x26, 0x14, 0x35, 0x92, 0x90, 0x03, 0x59, 0xa2, 0xf6, 0xe8, 0x9d,
-  0x42, 0xc5, 0x6a, 0xb4, 0x11, 0x2c, 0x52, 0xab, 0x75, 0x0b, 0x01, 0x1b,
-  0x03, 0x77, 0x04, 0x75, 0xe6, 0x2c, 0x49, 0x20, 0x6a, 0xc1, 0xe8, 0x74,
-  0x20, 0xe5, 0xf2, 0x87, 0x10, 0xe5, 0x3a, 0xab, 0x31, 0x7c, 0x0e, 0x2f,
-  0x6d, 0x9b, 0x75, 0x42, 0x9f, 0xc2, 0x29, 0xc8, 0x84, 0x62, 0x9a, 0x6e,
-  0x5b, 0x00, 0x93, 0x45, 0xb6, 0xea, 0x2b, 0x29, 0x77, 0x5a, 0xb4, 0x74,
-  0x4f, 0x69, 0x70, 0x59, 0xdf, 0x6e, 0xf5, 0x39, 0x34, 0x76, 0xa3, 0x73,
-  0xa1, 0x93, 0xc8, 0x71, 0x3d, 0x65, 0x62, 0x32, 0xd6, 0x55, 0xd3, 0xae,
-  0x61, 0xf0, 0x32, 0x21, 0xb1, 0xfb, 0x1e, 0x35, 0x3f, 0xe3, 0x39, 0xdc,
-  0x63, 0x65, 0x68, 0xfe, 0x0a, 0x43, 0xd0, 0x74, 0x15, 0x5f, 0xe1, 0xe9,
-  0xf5, 0x87, 0x60, 0x90, 0xd3, 0x6c, 0x07, 0x18, 0x64, 0x03, 0x01, 0x49,
-  0x39, 0xa5, 0x70, 0xda, 0x8d, 0x7b, 0x84, 0x3b, 0xdd, 0x30, 0xaa, 0x97,
-  0x50, 0x38, 0x6c, 0x21, 0xb4, 0x22, 0x09, 0x6d, 0x6e, 0x4e, 0xaa, 0x77,
-  0xef, 0xde, 0xbf, 0xc7, 0xeb, 0xaf, 0x06, 0x54, 0x40, 0xfc, 0x33, 0x5c,
-  0x8f, 0xea, 0xa6, 0x38, 0x5a, 0xb5, 0x94, 0x98, 0x3f, 0xdd, 0x67, 0xed,
-  0xac, 0x6c, 0x3e, 0x8c, 0x3e, 0x30, 0x5e, 0xc6, 0x78, 0xfb, 0x03, 0xfe,
-  0xdb, 0xa3, 0xd4, 0xc7, 0x4f, 0xbf, 0xfa, 0x6a, 0x3f, 0xdb, 0xa5, 0x7f,
-  0xe9, 0xb7, 0xd2, 0x6c, 0xe7, 0xc3, 0xf7, 0xa3, 0x76, 0xde, 0x9f, 0x2d,
-  0xaa, 0xaa, 0x26, 0xcc, 0x27, 0xdf, 0xec, 0x67, 0x79, 0xb2, 0x1c, 0x52,
-  0xae, 0x6f, 0x00, 0xaf, 0x2e, 0x50, 0x5f, 0xc2, 0x81, 0x0b, 0x0c, 0xe9,
-  0xcd, 0xb3, 0xfe, 0x7a, 0x34, 0xa5, 0xbe, 0xee, 0x1d, 0xe4, 0xe9, 0x7e,
-  0x9a, 0xed, 0xa6, 0x87, 0xe9, 0xae, 0x40, 0x97, 0x01, 0x14, 0x94, 0x44,
-  0x4d, 0xd1, 0x7c, 0xbe, 0x5c, 0x9e, 0x54, 0xef, 0xa1, 0xe0, 0xde, 0x25,
-  0x90, 0x03, 0xcd, 0x7e, 0x74, 0x99, 0xdc, 0xdd, 0x25, 0x97, 0x7d, 0x0a,
-  0x20, 0xf4, 0x71, 0xd6, 0x83, 0xa2, 0xb2, 0xef, 0xf6, 0x33, 0x55, 0xe7,
-  0x6a, 0xb3, 0x58, 0xa8, 0x86, 0xae, 0x87, 0x97, 0xfd, 0x66, 0x0d, 0x03,
-  0x82, 0x90, 0x88, 0xe8, 0x75, 0x9f, 0x3d, 0xaf, 0x3d, 0x1a, 0x0e, 0x0f,
-  0xa2, 0x79, 0xe6, 0x86, 0x5b, 0xeb, 0x5f, 0xf6, 0x7f, 0x45, 0x6e, 0x21,
-  0x69, 0x56, 0xe2, 0xd3, 0x5f, 0x3d, 0x16, 0xce, 0x41, 0xf7, 0x17, 0x66,
-  0xc2, 0xaf, 0xf9, 0x77, 0xfb, 0xf0, 0xcf, 0xb3, 0x83, 0x2f, 0xef, 0xee,
-  0x96, 0xf8, 0x73, 0xf9, 0xec, 0xeb, 0xbf, 0x79, 0x35, 0xc9, 0xc7, 0xfc,
-  0x5f, 0xbe, 0xd9, 0xdf, 0x5d, 0xda, 0xd4, 0xce, 0x96, 0x2d, 0x4b, 0x9c,
-  0xe6, 0x65, 0x5d, 0x16, 0xb3, 0x5e, 0x53, 0x4c, 0x80, 0x68, 0xf8, 0xd7,
-  0xd4, 0x0f, 0x1f, 0xba, 0xfa, 0x47, 0x65, 0xf3, 0xb6, 0x5c, 0x95, 0xa0,
-  0xa3, 0x23, 0xe2, 0xdd, 0x1d, 0xfc, 0x8b, 0x9c, 0x40, 0xfc, 0x78, 0x67,
-  0x01, 0xe4, 0x09, 0xbe, 0x41, 0x20, 0x92, 0xac, 0x74, 0x04, 0x3c, 0x26,
-  0x00, 0x77, 0x65, 0x33, 0xc4, 0x04, 0xec, 0x49, 0xa8, 0x65, 0xfe, 0xcc,
-  0x70, 0x77, 0xbe, 0x9b, 0xce, 0x93, 0x74, 0x77, 0xb9, 0x9b, 0x2e, 0x53,
-  0x02, 0x2e, 0x2d, 0x20, 0xa6, 0x02, 0xb0, 0xd9, 0x4d, 0x9b, 0x54, 0x13,
-  0x29, 0x5f, 0x86, 0xc6, 0xb8, 0xdf, 0xcf, 0x0b, 0xe8, 0x4e, 0xbd, 0xf7,
-  0x81, 0x8d, 0x13, 0x25, 0xe0, 0x5e, 0x46, 0x1c, 0xb7, 0x3e, 0x0f, 0x5c,
-  0xc5, 0x1e, 0xfa, 0x1e, 0x49, 0x15, 0xc5, 0x17, 0xc5, 0x4d, 0x24, 0xbb,
-  0xe3, 0x7d, 0x15, 0x06, 0x2a, 0xe4, 0xb7, 0x3d, 0x7d, 0x62, 0x8a, 0x2a,
-  0xa0, 0x58, 0xc0, 0x5e, 0x06, 0x37, 0x68, 0xc4, 0xe3, 0x62, 0xa1, 0x08,
-  0x54, 0x70, 0x9a, 0x23, 0xd6, 0xc0, 0x2c, 0x16, 0x62, 0xc3, 0xc0, 0x1c,
-  0x41, 0xe8, 0x70, 0x88, 0x3d, 0x6d, 0x32, 0x92, 0xed, 0x03, 0x34, 0x2c,
-  0x57, 0x83, 0x9e, 0x66, 0x9d, 0xc7, 0x16, 0xdf, 0x43, 0xe5, 0xad, 0xdd,
-  0x9e, 0xb8, 0x3b, 0xcd, 0xce, 0x36, 0x5e, 0x0e, 0x75, 0xb3, 0x90, 0x0d,
-  0xd5, 0x0a, 0x79, 0x50, 0x21, 0xd5, 0x78, 0x78, 0xa0, 0xb0, 0x8e, 0x87,
-  0x3d, 0xbd, 0x11, 0xfb, 0x05, 0xb7, 0xbc, 0xbf, 0xde, 0xdd, 0xe9, 0x04,
-  0xd8, 0x18, 0x73, 0xf1, 0x97, 0xaa, 0x04, 0xd5, 0x20, 0x5a, 0x62, 0x87,
-  0xc7, 0x7d, 0x5f, 0xf7, 0xba, 0xbb, 0x73, 0xd2, 0x9e, 0xc2, 0x96, 0x98,
-  0x47, 0xc9, 0x23, 0x49, 0xea, 0x11, 0x5a, 0x66, 0x1a, 0x6b, 0xc3, 0x9c,
-  0xbc, 0x07, 0x16, 0xd2, 0x3d, 0xb3, 0x2f, 0x0d, 0xa8, 0xcf, 0x2f, 0x1d,
-  0x16, 0x4e, 0x35, 0xff, 0x48, 0xbb, 0x7d, 0x77, 0xf2, 0xfe, 0xb8, 0x37,
-  0x01, 0x1d, 0x2f, 0x47, 0xd5, 0x02, 0xe6, 0x55, 0x7e, 0x0c, 0x14, 0xe0,
-  0x6e, 0x7e, 0xb2, 0xd0, 0x81, 0x88, 0x60, 0x8f, 0x71, 0xdd, 0x32, 0x29,
-  0x6a, 0x19, 0x86, 0x56, 0xc7, 0x16, 0x67, 0x6a, 0x2c, 0x16, 0x47, 0xc3,
-  0x4a, 0xc6, 0xae, 0xce, 0x44, 0xcc, 0x59, 0x70, 0x30, 0x2c, 0x40, 0xd5,
-  0x85, 0x9a, 0xe5, 0x5c, 0x6f, 0xb3, 0x63, 0xc5, 0xc8, 0x42, 0xde, 0x55,
-  0x8a, 0x80, 0x63, 0x45, 0xd0, 0x71, 0x98, 0x9f, 0x9d, 0x8c, 0x7a, 0xfd,
-  0x56, 0x20, 0x66, 0xac, 0x04, 0x5e, 0xc1, 0x4f, 0x65, 0x97, 0xa2, 0x8a,
-  0xa8, 0x2e, 0xdc, 0x06, 0x20, 0x4e, 0x2c, 0x37, 0x2d, 0xdd, 0xa7, 0x74,
-  0xaf, 0xaa, 0xb2, 0x32, 0x67, 0xad, 0xdc, 0x84, 0x13, 0xcb, 0x2c, 0xca,
-  0xf7, 0xa9, 0x2c, 0xdc, 0xbf, 0xe3, 0xa2, 0xdf, 0x59, 0x0a, 0xae, 0xf4,
-  0xb1, 0x42, 0xe4, 0x21, 0x99, 0x5e, 0xdf, 0x3b, 0xb9, 0xc0, 0x88, 0xd1,
-  0x7e, 0x50, 0x0b, 0xfe, 0x29, 0x2f, 0xf8, 0x9d, 0x45, 0x68, 0xc4, 0x58,
-  0x29, 0xac, 0x0f, 0x9c, 0x8a, 0x1e, 0xd0, 0x59, 0x06, 0xa3, 0xc5, 0x0a,
-  0xc0, 0x71, 0x2a, 0xfd, 0x40, 0xfa, 0x42, 0x37, 0x2f, 0x10, 0x1a, 0x6f,
-  0x02, 0x9e, 0xd8, 0x77, 0xd7, 0x0c, 0x50, 0xcc, 0x06, 0x39, 0x64, 0x4e,
-  0x80, 0xf8, 0xbe, 0x45, 0x84, 0x64, 0x77, 0x98, 0xa4, 0x49, 0x2f, 0xdd,
-  0xf5, 0x97, 0x20, 0xc1, 0x83, 0x25, 0x3b, 0xa3, 0xe3, 0x1e, 0x11, 0xeb,
-  0xa9, 0x63, 0xc7, 0xb4, 0x0b, 0xd5, 0xed, 0xa6, 0xcf, 0xd2, 0x5d, 0x28,
-  0x69, 0x37, 0x15, 0xe3, 0x25, 0x47, 0xea, 0xd3, 0x11, 0x97, 0x92, 0xf8,
-  0xc7, 0x20, 0x69, 0x8c, 0x78, 0xfb, 0x03, 0x42, 0x88, 0x11, 0x9b, 0x76,
-  0x08, 0x62, 0x39, 0x6f, 0xb3, 0xe1, 0xb3, 0x5b, 0x91, 0x8c, 0x96, 0xa0,
-  0x2e, 0xb2, 0xa4, 0xe8, 0xe3, 0x1b, 0xc2, 0x57, 0x1c, 0x85, 0x70, 0xd8,
-  0xde, 0xab, 0x8c, 0xed, 0xc3, 0x19, 0xdd, 0x53, 0x32, 0x8e, 0x52, 0x07,
-  0x19, 0xa0, 0x88, 0x06, 0xdd, 0x7b, 0x06, 0x0e, 0xea, 0xf3, 0xe3, 0xbe,
-  0x97, 0x94, 0xf9, 0xa8, 0x7c, 0x36, 0x65, 0xf0, 0xf0, 0x3b, 0x44, 0xc2,
-  0x53, 0x2a, 0x0b, 0x07, 0xb4, 0xf4, 0x68, 0x95, 0xec, 0xa9, 0xd7, 0xaf,
-  0x95, 0x52, 0x55, 0x86, 0x2e, 0x9f, 0xf0, 0x90, 0x29, 0x76, 0xc2, 0x15,
-  0xc9, 0x66, 0x3c, 0x93, 0xfb, 0x79, 0xec, 0xb6, 0xc7, 0x7c, 0x64, 0x07,
-  0xf8, 0x16, 0x1d, 0xa1, 0xd8, 0x86, 0xc1, 0xe8, 0xa5, 0x45, 0x91, 0x15,
-  0xc9, 0x7e, 0x9a, 0xd5, 0x90, 0xb8, 0x13, 0x65, 0xd5, 0x9a, 0x48, 0x2d,
-  0x2d, 0x64, 0x9c, 0xc7, 0x7a, 0xb3, 0x83, 0x45, 0x2e, 0xbe, 0xea, 0xd2,
-  0x18, 0x6f, 0x3c, 0x4c, 0xee, 0xd7, 0x08, 0x53, 0x18, 0x2f, 0xc6, 0x94,
-  0xae, 0x36, 0xcb, 0xe8, 0x2f, 0xda, 0x13, 0x98, 0xc8, 0x3d, 0x99, 0x23,
-  0x3b, 0x3b, 0xf2, 0x03, 0x87, 0x6e, 0xf6, 0xdc, 0xfa, 0x60, 0xa3, 0x0d,
-  0xe6, 0x51, 0x57, 0xcc, 0x83, 0x9c, 0x4b, 0xcb, 0x42, 0x2c, 0xed, 0x52,
-  0x7f, 0x0b, 0x8a, 0xf8, 0x72, 0x0f, 0x31, 0xa2, 0x5e, 0xb8, 0x0d, 0x9a,
-  0x27, 0x0e, 0x44, 0x0c, 0x28, 0x29, 0x20, 0x24, 0xfc, 0xd3, 0xb3, 0x1d,
-  0xd9, 0x08, 0x0a, 0xa0, 0xc9, 0x37, 0x1e, 0x1e, 0xff, 0x72, 0xf1, 0x2b,
-  0x2b, 0x23, 0x22, 0xbe, 0xc6, 0x7a, 0x62, 0xcb, 0x54, 0x3f, 0xee, 0xd3,
-  0x0f, 0x6b, 0xf2, 0xf1, 0x01, 0x19, 0x4e, 0x38, 0xfc, 0xa5, 0x01, 0x25,
-  0xf5, 0x6b, 0x69, 0x86, 0xb7, 0x89, 0x97, 0x07, 0xe9, 0xfa, 0xc3, 0x05,
-  0xa3, 0x35, 0xb1, 0x00, 0xdb, 0x6b, 0x0d, 0xa2, 0xb0, 0x74, 0xd4, 0xef,
-  0x23, 0x53, 0x9c, 0x84, 0x97, 0x83, 0x64, 0xfe, 0xa5, 0x01, 0x56, 0x98,
-  0x4c, 0x00, 0x9a, 0x2f, 0x8d, 0x80, 0xc6, 0x64, 0xc7, 0xfd, 0xaa, 0xd6,
-  0x09, 0x72, 0xcc, 0x0f, 0xa4, 0xc9, 0x39, 0x3f, 0x26, 0x7b, 0xc1, 0x13,
-  0x15, 0x94, 0xbe, 0x02, 0x14, 0xbe, 0x59, 0xd0, 0x38, 0xf4, 0x19, 0x20,
-  0xd1, 0x6d, 0x83, 0xc6, 0xc1, 0x2f, 0xb7, 0xcd, 0x12, 0x01, 0x4f, 0x35,
-  0x9a, 0x3f, 0x35, 0x8a, 0x44, 0xaa, 0x03, 0x28, 0xff, 0xf2, 0xc4, 0x1f,
-  0x1d, 0x03, 0x28, 0xa9, 0x07, 0x1f, 0x1a, 0xac, 0x43, 0xcc, 0x01, 0x54,
-  0xfd, 0xd6, 0x40, 0x27, 0x56, 0x1c, 0x20, 0xd8, 0xdf, 0x2e, 0x12, 0xc5,
-  0x70, 0x53, 0x18, 0xf8, 0x61, 0xb8, 0x27, 0xdd, 0xe0, 0x74, 0x82, 0x15,
-  0xe2, 0x8a, 0x21, 0xf4, 0x11, 0x82, 0x45, 0xa8, 0xd8, 0xdf, 0x6e, 0xbd,
-  0xaa, 0x0c, 0xfd, 0x61, 0xc0, 0x26, 0x14, 0x13, 0xc2, 0xf5, 0x97, 0x19,
-  0x21, 0x2a, 0x9e, 0x12, 0x8e, 0x11, 0xf9, 0x6d, 0x06, 0x81, 0x98, 0x60,
-  0xc2, 0x40, 0xa0, 0x5f, 0x1a, 0x40, 0xce, 0xb0, 0x21, 0x19, 0xff, 0xfa,
-  0x4b, 0x4c, 0x69, 0xaf, 0x41, 0x65, 0xb0, 0x02, 0xa9, 0xac, 0xd6, 0xa7,
-  0x46, 0x61, 0x7f, 0xcf, 0x00, 0xa4, 0x1f, 0xa6, 0xe3, 0xa5, 0x67, 0x9c,
-  0x5e, 0x61, 0xaf, 0xb8, 0xc7, 0x7d, 0xfc, 0xab, 0x13, 0xd1, 0x0f, 0x25,
-  0xa4, 0xc1, 0x1f, 0x8b, 0x41, 0x62, 0x71, 0x88, 0xec, 0xa1, 0x9f, 0x06,
-  0xc4, 0x37, 0x8b, 0x00, 0xc0, 0x1f, 0x66, 0x30, 0x28, 0x8b, 0x44, 0x18,
-  0x0b, 0xfc, 0xd3, 0x80, 0xd0, 0x47, 0x1f, 0xa6, 0xc3, 0x5f, 0xab, 0xd5,
-  0xad, 0x34, 0xba, 0xad, 0x9c, 0x99, 0xaa, 0xa6, 0xa9, 0x3f, 0x7d, 0x0f,
-  0xac, 0xf9, 0x7b, 0x60, 0x4f, 0x30, 0x36, 0x54, 0xa4, 0xc1, 0x8f, 0x3f,
-  0x5d, 0x90, 0x7e, 0x7a, 0xac, 0x10, 0x54, 0x82, 0x87, 0x26, 0x4f, 0x4e,
-  0x15, 0x12, 0x7d, 0x7a, 0x28, 0x46, 0x1e, 0xd9, 0xdf, 0x1e, 0x12, 0xdd,
-  0x81, 0x2b, 0x8c, 0x15, 0xc6, 0x9a, 0x76, 0xc0, 0xf8, 0x46, 0x52, 0x83,
-  0xe1, 0xc3, 0x03, 0xe3, 0x83, 0x01, 0x0d, 0x86, 0x0f, 0xbf, 0x91, 0xf8,
-  0x34, 0xd1, 0xb4, 0x11, 0xbe, 0xac, 0x21, 0x7b, 0xd6, 0xf0, 0x60, 0x3d,
-  0x53, 0x4d, 0xd2, 0x41, 0x0c, 0xb1, 0x6f, 0xc9, 0x74, 0xd3, 0x05, 0xcc,
-  0x66, 0x1a, 0x32, 0x9b, 0x69, 0x90, 0x38, 0xb2, 0x02, 0x00, 0xfd, 0xb2,
-  0xd2, 0xd9, 0x70, 0x93, 0x00, 0xf8, 0x53, 0x43, 0x74, 0x98, 0x40, 0x84,
-  0xa9, 0x0f, 0x53, 0x95, 0xf2, 0xc1, 0x8e, 0xa3, 0x57, 0x7e, 0x6b, 0xa0,
-  0xe7, 0x52, 0x5d, 0x4b, 0xef, 0xc2, 0x15, 0x14, 0xb6, 0xa7, 0x74, 0xc0,
-  0xd1, 0x1f, 0x1a, 0x2c, 0xe6, 0xf5, 0xa8, 0xa8, 0xd8, 0x26, 0xc0, 0x66,
-  0xb0, 0x05, 0x8f, 0x0c, 0x71, 0xe4, 0xf9, 0x89, 0x66, 0xd2, 0xb1, 0x11,
-  0x28, 0x34, 0x18, 0x7f, 0x58, 0x9d, 0x50, 0x33, 0xf7, 0x2d, 0xd1, 0x39,
-  0x27, 0xb9, 0x0b, 0x7f, 0x6c, 0x2c, 0x71, 0xcd, 0x47, 0xa8, 0xf4, 0xdb,
-  0x94, 0xac, 0x14, 0x0d, 0x57, 0xe5, 0x12, 0x47, 0x54, 0xb0, 0x0e, 0xe1,
-  0x0f, 0x53, 0x3a, 0x0f, 0x07, 0x1e, 0x08, 0xb2, 0xb2, 0x2e, 0x69, 0x49,
-  0xbe, 0xf8, 0xb3, 0x7a, 0x34, 0xae, 0xc8, 0xb0, 0x20, 0xa3, 0x36, 0x3d,
-  0x5f, 0xf6, 0x94, 0xfb, 0xf6, 0x3c, 0xd5, 0x56, 0x8a, 0x78, 0x8e, 0xc1,
-  0x10, 0x96, 0x11, 0xa9, 0xb6, 0x3a, 0x34, 0x10, 0x74, 0x32, 0x2d, 0x00,
-  0xfc, 0x69, 0xa7, 0x93, 0x47, 0x63, 0x03, 0xa3, 0x4f, 0x0d, 0x27, 0x01,
-  0x93, 0x2a, 0x2b, 0x44, 0x93, 0xce, 0x32, 0x20, 0xd5, 0x26, 0x85, 0x06,
-  0x82, 0xab, 0x75, 0x2a, 0x16, 0x82, 0x56, 0x2a, 0x76, 0x40, 0xaa, 0x0c,
-  0x25, 0x4c, 0x3a, 0xf5, 0x42, 0xaa, 0x8c, 0xf4, 0x4c, 0xba, 0xf4, 0x63,
-  0x6a, 0x4c, 0x06, 0x2d, 0x18, 0xf7, 0x44, 0x6a, 0xac, 0xf5, 0x2c, 0x7a,
-  0xb8, 0x3b, 0x52, 0x63, 0x8b, 0x67, 0xd5, 0x85, 0x7d, 0x92, 0x2a, 0x9b,
-  0x3b, 0xa7, 0x6d, 0xd2, 0xed, 0xa9, 0x63, 0xc9, 0x61, 0x30, 0x44, 0x70,
-  0xa6, 0xc6, 0x26, 0xc3, 0xce, 0xed, 0xc8, 0xaa, 0x34, 0xb4, 0xa2, 0xf1,
-  0x71, 0x45, 0x60, 0xa5, 0xbe, 0x31, 0x8c, 0xc1, 0x53, 0xeb, 0x50, 0x6a,
-  0x59, 0xf9, 0x59, 0xa5, 0x98, 0x65, 0x34, 0x75, 0xad, 0xf3, 0x52, 0x4b,
-  0x9b, 0xd4, 0x3e, 0xf0, 0x71, 0xc8, 0x16, 0xb6, 0x9e, 0xa9, 0x1d, 0xaf,
-  0x07, 0x10, 0xe5, 0x12, 0x38, 0x00, 0x68, 0xef, 0xa4, 0x01, 0xc4, 0x76,
-  0x75, 0x19, 0x03, 0xc6, 0x01, 0x96, 0x7e, 0xeb, 0x83, 0x8c, 0xe7, 0xb7,
-  0x30, 0x97, 0x7e, 0x1b, 0x1b, 0x80, 0xd4, 0x4b, 0xcc, 0xb0, 0x09, 0xd7,
-  0x1d, 0x19, 0xe4, 0x85, 0x55, 0x00, 0xb0, 0xfc, 0x72, 0x44, 0x40, 0x7a,
-  0xb1, 0xf1, 0x20, 0x26, 0xc2, 0x5d, 0xd8, 0x02, 0x27, 0xec, 0x67, 0x00,
-  0xd6, 0xf1, 0x57, 0x42, 0x4e, 0xac, 0xbb, 0xd2, 0x8d, 0x73, 0x6f, 0x0d,
-  0x14, 0xb5, 0x7f, 0xde, 0x3e, 0x28, 0x64, 0x6c, 0xbd, 0x5f, 0x64, 0x0b,
-  0xea, 0xf3, 0x73, 0xd9, 0x14, 0x9a, 0xd0, 0x04, 0x9e, 0x88, 0xd1, 0x18,
-  0xc6, 0x2f, 0xbe, 0x27, 0x6a, 0x34, 0x86, 0x76, 0xc9, 0xee, 0x8a, 0x1c,
-  0x07, 0xae, 0xbd, 0x7d, 0x87, 0xa2, 0x47, 0xe3, 0x69, 0x0f, 0xd0, 0xae,
-  0x08, 0xd2, 0x70, 0xe3, 0x8a, 0xd6, 0x13, 0x45, 0x1a, 0x43, 0xbb, 0x19,
-  0x75, 0x85, 0x8f, 0x03, 0x37, 0xae, 0x4f, 0x23, 0x02, 0x40, 0x63, 0xda,
-  0x3b, 0x64, 0x4f, 0xf4, 0x18, 0xba, 0x8c, 0x2b, 0x40, 0x5f, 0x04, 0x99,
-  0x72, 0xcc, 0xdb, 0x69, 0x5f, 0xbc, 0x69, 0x1c, 0xfd, 0x5e, 0xd7, 0x15,
-  0x8d, 0xa6, 0xd5, 0xd7, 0x6e, 0x7b, 0xaf, 0xdd, 0xdc, 0xea, 0x65, 0x9e,
-  0x2b, 0xec, 0x34, 0xdc, 0x72, 0x08, 0xed, 0x8b, 0x34, 0x8b, 0x2f, 0x81,
-  0x07, 0x98, 0x2e, 0xd1, 0x16, 0xcb, 0xb3, 0x4d, 0xc4, 0x69, 0x7c, 0x3b,
-  0x00, 0x63, 0x20, 0xea, 0x4c, 0xa9, 0x6e, 0xfc, 0xd9, 0x2e, 0x91, 0xc7,
-  0x51, 0x17, 0x70, 0x1d, 0x5e, 0xcf, 0xec, 0x24, 0x5e, 0xdd, 0x28, 0x19,
-  0x7f, 0x02, 0x48, 0x9b, 0x85, 0xd1, 0xfa, 0x3a, 0x94, 0xbd, 0xeb, 0xc0,
-  0x6c, 0xaf, 0x45, 0x09, 0x3e, 0x81, 0x79, 0xd2, 0x43, 0xcd, 0x3a, 0xdc,
-  0x63, 0x43, 0xaa, 0xb9, 0x53, 0x82, 0x0f, 0xbc, 0x53, 0xba, 0xbb, 0xe3,
-  0x0b, 0x1f, 0xf8, 0xfc, 0x6e, 0x78, 0xf0, 0xf5, 0x37, 0xfa, 0x62, 0x47,
-  0x6b, 0xd5, 0xfc, 0x02, 0xc4, 0x20, 0x7d, 0xfd, 0xf4, 0x20, 0x82, 0xa4,
-  0x1e, 0x79, 0x18, 0x3c, 0x7c, 0xe6, 0x10, 0x41, 0xe4, 0x27, 0x11, 0x83,
-  0x10, 0x80, 0x86, 0xff, 0x03, 0xe7, 0x5a, 0xec, 0x65, 0x55, 0x2d, 0x7a,
-  0xe3, 0x08, 0x21, 0x6a, 0x43, 0xff, 0xfc, 0x37, 0xfb, 0x44, 0xb2, 0xba,
-  0x78, 0xf6, 0xc5, 0xed, 0x71, 0xff, 0xa6, 0x68, 0x60, 0xdb, 0x8f, 0xcf,
-  0xa2, 0xee, 0xe5, 0x50, 0xf2, 0xb7, 0x43, 0x07, 0x6f, 0x3c, 0x9a, 0x12,
-  0xe2, 0xaa, 0x02, 0xbc, 0x0f, 0x1f, 0x0d, 0x9a, 0x7b, 0x27, 0x57, 0x5f,
-  0x62, 0xdd, 0xba, 0xaa, 0xd4, 0xab, 0xea, 0xcd, 0x87, 0x17, 0x2f, 0x8f,
-  0xdf, 0xbc, 0x56, 0xe7, 0x9e, 0x87, 0xa9, 0x5f, 0xc5, 0xeb, 0xa3, 0xcf,
-  0x0e, 0x86, 0x75, 0xed, 0x33, 0xaf, 0xae, 0xd0, 0x5a, 0x1c, 0x76, 0x9e,
-  0xbd, 0x65, 0x73, 0x96, 0xdd, 0x26, 0x5f, 0xc0, 0xde, 0xfa, 0x12, 0x66,
-  0x6f, 0x73, 0x96, 0x66, 0x8e, 0xa4, 0x83, 0x94, 0x81, 0x40, 0x01, 0x42,
-  0x6f, 0x5f, 0xfb, 0xf2, 0xf4, 0x75, 0x98, 0xce, 0x16, 0xc5, 0xb5, 0x73,
-  0xe0, 0xca, 0x7a, 0xf2, 0x67, 0x36, 0x08, 0xf5, 0xee, 0xd7, 0x82, 0xb3,
-  0x16, 0x28, 0xda, 0x5c, 0x99, 0xcd, 0x46, 0x93, 0xb6, 0xaa, 0x6f, 0x44,
-  0xe5, 0xcd, 0x9e, 0xc3, 0x2e, 0x4e, 0x3f, 0x7c, 0xa2, 0xdf, 0xf2, 0x34,
-  0x6a, 0x10, 0x34, 0x7e, 0x90, 0xe8, 0xea, 0xdb, 0x72, 0x72, 0x81, 0x47,
-  0xbc, 0xb3, 0x02, 0x5d, 0x7a, 0xa4, 0x4f, 0x46, 0xeb, 0xf2, 0x89, 0xda,
-  0xc3, 0xdc, 0x4e, 0x46, 0x20, 0x77, 0x0e, 0xd3, 0x55, 0xb5, 0x87, 0xaf,
-  0xa8, 0x8a, 0xf4, 0x3e, 0xc3, 0x5d, 0xc5, 0xaa, 0x57, 0x83, 0xc8, 0xc7,
-  0x31, 0x53, 0xf7, 0xab, 0x0b, 0xbc, 0xaa, 0x81, 0xbd, 0x2f, 0x16, 0x06,
-  0x75, 0xa2, 0x56, 0xdd, 0xb3, 0x2d, 0x15, 0xf1, 0x4c, 0x09, 0x26, 0x50,
-  0xb5, 0x69, 0x7b, 0x58, 0x55, 0x7e, 0xb0, 0xbf, 0xbf, 0x4f, 0x70, 0x28,
-  0x6b, 0x42, 0x6e, 0x44, 0x7a, 0xb0, 0x80, 0x44, 0xb1, 0x32, 0xb9, 0x51,
-  0x72, 0x20, 0x5f, 0x49, 0x7e, 0x73, 0x95, 0xbe, 0x69, 0xa9, 0xf2, 0xb7,
-  0x44, 0xc0, 0xa6, 0x5e, 0xe4, 0xe3, 0x6a, 0x7a, 0xa3, 0x07, 0xc1, 0x4c,
-  0x27, 0xdf, 0x2e, 0x8b, 0x76, 0x5e, 0xa1, 0x3d, 0xfc, 0xc7, 0xcf, 0x27,
-  0x69, 0xee, 0xd3, 0x86, 0x0f, 0x53, 0xa7, 0x45, 0xdd, 0x1c, 0xde, 0xa6,
-  0xd2, 0x91, 0x7b, 0x27, 0x37, 0xeb, 0x02, 0x06, 0x09, 0x9e, 0x81, 0x95,
-  0x4c, 0xe1, 0x93, 0xeb, 0xbd, 0xab, 0xab, 0xab, 0x3d, 0x7c, 0xd2, 0xb1,
-  0x07, 0x65, 0x42, 0x8f, 0x81, 0xec, 0x9e, 0x0e, 0x26, 0x73, 0x9c, 0xa1,
-  0xed, 0xf0, 0xa7, 0x93, 0xb7, 0x7b, 0xdf, 0x82, 0xdc, 0xf8, 0x79, 0x8f,
-  0xec, 0x96, 0xdf, 0x1f, 0xbd, 0xda, 0x7b, 0xf5, 0xf9, 0xc7, 0xb7, 0x50,
-  0xc6, 0xd3, 0xf4, 0x9e, 0xda, 0x75, 0x88, 0xff, 0xe0, 0x09, 0xd7, 0x7d,
-  0x66, 0x1d, 0xb2, 0x4d, 0xda, 0xde, 0x28, 0xbb, 0x75, 0x29, 0xe1, 0xae,
-  0xe0, 0x27, 0xc4, 0x4f, 0xd2, 0xdd, 0x51, 0x9e, 0xa6, 0x86, 0xfb, 0x75,
-  0xff, 0xbc, 0xa9, 0x56, 0xbd, 0x4c, 0x52, 0x90, 0xeb, 0x2f, 0x16, 0x8b,
-  0xcc, 0x1f, 0x55, 0x14, 0xa8, 0xfd, 0xd6, 0x1f, 0x62, 0x72, 0xff, 0x81,
-  0xe2, 0x4c, 0xc2, 0xc9, 0xab, 0x4f, 0xfb, 0x8a, 0xce, 0x0a, 0xf5, 0x1e,
-  0x96, 0xe0, 0x0d, 0x3d, 0x29, 0x28, 0x48, 0x15, 0x1b, 0x52, 0xb4, 0x42,
-  0x69, 0x86, 0xb7, 0xfa, 0xe0, 0xaf, 0x98, 0x96, 0x2d, 0x7d, 0xcb, 0x28,
-  0xff, 0xf8, 0xfd, 0xe9, 0xe7, 0x93, 0xa3, 0x57, 0x3f, 0xfc, 0xe3, 0xf4,
-  0xd3, 0xcf, 0xc3, 0x83, 0xaf, 0xd8, 0x92, 0x17, 0xb6, 0x66, 0x68, 0xd9,
-  0xf9, 0x79, 0x52, 0x57, 0x8b, 0xc5, 0x10, 0x5f, 0x5b, 0x1b, 0xf3, 0x89,
-  0xb2, 0x39, 0xae, 0xce, 0x3e, 0x14, 0xa3, 0xfa, 0x65, 0xd5, 0xb6, 0xd5,
-  0xb2, 0x57, 0x2c, 0xa8, 0x8d, 0xd4, 0xe1, 0x78, 0x9d, 0xda, 0x50, 0xa6,
-  0x77, 0x05, 0x99, 0x38, 0xee, 0x25, 0x3a, 0xe5, 0xa4, 0x5a, 0xf3, 0x27,
-  0x1f, 0x61, 0x31, 0x42, 0x96, 0x7c, 0x37, 0x74, 0xdb, 0x60, 0x33, 0x62,
-  0x0c, 0x93, 0x0d, 0x2a, 0xe3, 0x66, 0x98, 0xbb, 0x90, 0xc5, 0x19, 0x5e,
-  0xf5, 0xd2, 0x7e, 0x5a, 0xae, 0x76, 0x17, 0x67, 0x68, 0xee, 0xb0, 0x38,
-  0xeb, 0xa3, 0x15, 0x2e, 0xd0, 0xdf, 0x1f, 0x57, 0x1b, 0x9e, 0xa7, 0x4f,
-  0x53, 0x73, 0x45, 0x1a, 0xc0, 0x01, 0x4a, 0xa9, 0xa3, 0xe9, 0xf4, 0xcd,
-  0x25, 0xb4, 0xe9, 0xb8, 0x6c, 0x60, 0xec, 0x15, 0x35, 0xba, 0x8c, 0xc6,
-  0x2a, 0xd3, 0x1c, 0xe7, 0xc7, 0xad, 0xc7, 0x0e, 0x9f, 0x01, 0x0b, 0x9c,
-  0xd3, 0xf7, 0xfe, 0x3d, 0xf5, 0x65, 0xef, 0x22, 0xbf, 0xcc, 0x6e, 0x2f,
-  0x87, 0x72, 0x99, 0x7d, 0xf9, 0xfc, 0x39, 0x0d, 0xa2, 0xba, 0x5c, 0xf6,
-  0x32, 0x98, 0xac, 0xe4, 0xc2, 0xb1, 0x07, 0xe3, 0x35, 0x4f, 0xd2, 0x7e,
-  0x6a, 0xdd, 0x21, 0xa7, 0x99, 0x6e, 0x2f, 0x76, 0xdd, 0x2f, 0x17, 0xbf,
-  0x0e, 0x5f, 0x63, 0x14, 0xab, 0x15, 0x8e, 0x86, 0xdd, 0xaf, 0x61, 0x0a,
-  0xc2, 0xda, 0x56, 0xa0, 0xff, 0x51, 0xee, 0x4b, 0x40, 0x50, 0x7d, 0x8b,
-  0xe3, 0x7b, 0x98, 0xe2, 0xd5, 0x7e, 0xba, 0xcb, 0xd3, 0xe3, 0xa7, 0x1f,
-  0x8f, 0x5e, 0x55, 0x4b, 0x34, 0xb0, 0x81, 0x15, 0xec, 0x22, 0xdb, 0x4d,
-  0x77, 0xc4, 0xb5, 0x5d, 0x0c, 0x8e, 0x17, 0xc5, 0xb1, 0x79, 0x40, 0x0a,
-  0x28, 0x4d, 0xec, 0x3f, 0x3e, 0x07, 0x54, 0xfc, 0xbd, 0x2d, 0x4c, 0xf8,
-  0xff, 0x4d, 0x20, 0x8e, 0xcd, 0xcf, 0x23, 0x90, 0xeb, 0x30, 0xe6, 0x73,
-  0x68, 0x51, 0x76, 0x2b, 0x36, 0x06, 0xaa, 0xf7, 0x60, 0xa4, 0x87, 0xe3,
-  0x0a, 0x10, 0xf9, 0x51, 0x51, 0x01, 0xe3, 0x0a, 0x35, 0xf5, 0x3e, 0x12,
-  0x03, 0xbd, 0xfe, 0x06, 0x8d, 0x17, 0xd3, 0xec, 0x56, 0xdb, 0x40, 0x68,
-  0x7b, 0x89, 0xfb, 0x7b, 0xaf, 0x56, 0x42, 0xc5, 0x5a, 0x67, 0xab, 0xff,
-  0xa5, 0x4a, 0x67, 0x40, 0xa8, 0x53, 0x0d, 0xe8, 0x2f, 0x93, 0x8b, 0x37,
-  0xc0, 0xfc, 0x2e, 0xe2, 0xa4, 0x3b, 0x36, 0xcb, 0xf5, 0x90, 0xa6, 0x88,
-  0x74, 0x54, 0x71, 0xe3, 0xf4, 0x25, 0x45, 0x34, 0xc2, 0x17, 0x8f, 0x67,
-  0x67, 0x8b, 0xe2, 0x75, 0x59, 0xb7, 0x37, 0xaa, 0xbc, 0xfb, 0x8e, 0xa6,
-  0x92, 0x43, 0x1f, 0x7c, 0x69, 0xbd, 0xc4, 0x03, 0xd6, 0x28, 0x0a, 0xc8,
-  0xfb, 0xd5, 0x59, 0x21, 0x38, 0x56, 0x93, 0xc3, 0x4a, 0x6e, 0x93, 0x68,
-  0xab, 0xa1, 0x6d, 0x56, 0x23, 0x55, 0xea, 0x74, 0xd8, 0x33, 0x44, 0xec,
-  0xec, 0x00, 0xec, 0x3b, 0xf3, 0xcd, 0x6d, 0x21, 0x55, 0x05, 0x1b, 0xd2,
-  0xe7, 0xca, 0x7a, 0xe9, 0x14, 0xab, 0x83, 0x19, 0xfc, 0xe8, 0x91, 0x32,
-  0x84, 0x41, 0xfd, 0xc1, 0x1d, 0xbc, 0x90, 0x9d, 0x96, 0x5c, 0x7b, 0x6a,
-  0x9c, 0x50, 0x7e, 0xb4, 0xc0, 0x28, 0x7a, 0xd5, 0x4a, 0x29, 0x6c, 0xd5,
-  0x6a, 0x8c, 0x82, 0x4d, 0x9f, 0x0a, 0x66, 0x39, 0xda, 0x47, 0xda, 0x69,
-  0xb3, 0x99, 0x48, 0x0a, 0x40, 0xdd, 0xd9, 0x41, 0x60, 0x76, 0x0b, 0x3f,
-  0x23, 0x2d, 0x93, 0x2b, 0xfa, 0x9c, 0x8e, 0x14, 0x11, 0x71, 0x0b, 0xce,
-  0x23, 0x46, 0x82, 0x72, 0x94, 0xa1, 0xc6, 0x10, 0x2f, 0xce, 0x29, 0x97,
-  0x4e, 0x01, 0xa4, 0xc1, 0xbd, 0xbd, 0xc6, 0xad, 0x60, 0xc1, 0x46, 0xed,
-  0xe0, 0xc7, 0xea, 0xaa, 0xe9, 0x9d, 0x87, 0x6a, 0xd3, 0xdd, 0x1d, 0xde,
-  0x4b, 0x2b, 0xf6, 0x2e, 0x96, 0x2c, 0xb3, 0xf5, 0xb1, 0x3d, 0x10, 0xb7,
-  0xa1, 0x34, 0x7d, 0x52, 0xaf, 0xbb, 0xc2, 0x32, 0x24, 0x3b, 0xe7, 0xdb,
-  0x01, 0xd9, 0x42, 0x2c, 0xcb, 0x15, 0xa8, 0xdf, 0x5a, 0x0b, 0x97, 0xbd,
-  0xf0, 0xb0, 0xb7, 0x7c, 0x36, 0xdc, 0xcf, 0x9e, 0xa7, 0x68, 0x30, 0xb7,
-  0xa7, 0xcd, 0x76, 0x46, 0x6c, 0xbb, 0x35, 0x1a, 0x37, 0xbd, 0xa5, 0x2e,
-  0xba, 0x9a, 0x2b, 0x51, 0x64, 0x19, 0x76, 0x8d, 0xd0, 0x9e, 0x2b, 0x62,
-  0x60, 0x27, 0x59, 0x96, 0x2a, 0xcb, 0xe8, 0x31, 0xe0, 0x75, 0xa2, 0xcd,
-  0x66, 0x43, 0x74, 0x0e, 0x81, 0xa6, 0x5d, 0xd5, 0x9c, 0x6c, 0xf7, 0xaa,
-  0xa5, 0x6e, 0x23, 0x59, 0x11, 0x0f, 0x1f, 0x3d, 0x3a, 0x37, 0xb7, 0x1d,
-  0xa2, 0xfa, 0x2f, 0x96, 0x3c, 0x4e, 0x39, 0x29, 0xd9, 0xd9, 0x49, 0xce,
-  0xad, 0xfb, 0x0c, 0xff, 0xfb, 0xd1, 0x10, 0x9d, 0xca, 0x68, 0xd3, 0x6e,
-  0x34, 0x62, 0x58, 0x2c, 0xfb, 0xe5, 0x0a, 0x66, 0x06, 0x5a, 0xf2, 0x0c,
-  0x7d, 0xa5, 0x3b, 0xdd, 0xb5, 0x73, 0xef, 0x92, 0xf1, 0x02, 0xb4, 0x74,
-  0x37, 0xcd, 0x2c, 0xfb, 0x03, 0xa5, 0x2e, 0x76, 0x97, 0x84, 0x36, 0x12,
-  0x50, 0x56, 0x4f, 0x2e, 0x6b, 0xac, 0x16, 0x80, 0x3a, 0xd5, 0xe1, 0xf5,
-  0x22, 0x73, 0x6c, 0x1c, 0xd8, 0x9e, 0x62, 0x13, 0x21, 0x56, 0xf5, 0xbf,
-  0xfb, 0x15, 0x21, 0x74, 0xf3, 0x10, 0xa1, 0x2a, 0xaf, 0x5b, 0xb1, 0x10,
-  0xb7, 0xf9, 0xbf, 0x25, 0xce, 0xcc, 0x0c, 0x5c, 0x2a, 0x5c, 0xdb, 0x3d,
-  0x6b, 0x76, 0xc4, 0x65, 0xcf, 0x1f, 0x36, 0xee, 0x28, 0x56, 0xca, 0xc8,
-  0xcd, 0xbf, 0x9c, 0x97, 0x83, 0x9f, 0x95, 0xb1, 0x87, 0x9b, 0x92, 0xc9,
-  0xaf, 0x92, 0x6a, 0x4e, 0xf4, 0xec, 0xd4, 0x11, 0x70, 0x1e, 0x48, 0x04,
-  0x59, 0x8f, 0x17, 0xe7, 0x68, 0xbe, 0x28, 0x28, 0xc3, 0x0e, 0x7c, 0x24,
-  0xd5, 0x66, 0x89, 0x0a, 0x02, 0x30, 0x3c, 0x77, 0xac, 0x31, 0xd0, 0x8e,
-  0x8b, 0xcf, 0xdd, 0xa6, 0x8e, 0xa9, 0x9d, 0x23, 0xbe, 0x57, 0xb9, 0x5b,
-  0x76, 0x66, 0x9e, 0x50, 0x35, 0x2d, 0x72, 0xc0, 0x37, 0x73, 0xe4, 0x36,
-  0x37, 0xed, 0x83, 0xd4, 0x6b, 0xc3, 0xc6, 0x38, 0x07, 0x0c, 0xb8, 0x83,
-  0x0b, 0x7e, 0xfe, 0x4e, 0xb0, 0xc7, 0x0d, 0x15, 0x6c, 0x78, 0x68, 0x19,
-  0x1f, 0x87, 0x8c, 0xd1, 0xf9, 0x41, 0xbc, 0x65, 0x2e, 0x4f, 0x9a, 0x36,
-  0x0f, 0x6b, 0xb1, 0xf9, 0xb2, 0xf6, 0xf9, 0x82, 0x11, 0xe2, 0x99, 0x2d,
-  0xeb, 0x87, 0xd9, 0x22, 0xc6, 0x9d, 0x1d, 0x5c, 0x51, 0xd0, 0x2e, 0xa6,
-  0xb8, 0xb9, 0xbb, 0xa0, 0x3e, 0x4b, 0xd6, 0x7f, 0x8c, 0x25, 0x9c, 0x3d,
-  0xc2, 0x91, 0x75, 0x1e, 0xd4, 0x61, 0x31, 0x64, 0xda, 0x3c, 0x60, 0x0f,
-  0x3a, 0x6d, 0x3a, 0xd9, 0x12, 0xe4, 0x70, 0xf9, 0x12, 0x82, 0x3d, 0xc6,
-  0x74, 0xe5, 0xef, 0x04, 0x7b, 0xac, 0x99, 0x36, 0x7a, 0xee, 0x04, 0xc6,
-  0x22, 0x0f, 0x4d, 0x9e, 0x69, 0x93, 0xa7, 0x31, 0x8a, 0xcd, 0x04, 0x02,
-  0xf1, 0x43, 0xac, 0x09, 0x2d, 0xa7, 0xd4, 0x34, 0xc2, 0xfb, 0xe8, 0x5b,
-  0x83, 0x5f, 0xb7, 0xc3, 0x87, 0x06, 0x6b, 0x4e, 0x6f, 0x27, 0x86, 0x0f,
-  0x76, 0x20, 0x97, 0x79, 0x85, 0xde, 0x18, 0x71, 0x29, 0xb2, 0xba, 0x9e,
-  0x2d, 0x84, 0x76, 0x61, 0x01, 0x77, 0x53, 0xab, 0xb5, 0x58, 0xd5, 0x21,
-  0x83, 0x3b, 0x65, 0x09, 0x1a, 0x80, 0x63, 0xb3, 0xbb, 0x64, 0x3c, 0xd9,
-  0x06, 0x82, 0x90, 0x67, 0x4b, 0x15, 0x52, 0x28, 0x22, 0xab, 0x04, 0x13,
-  0x0f, 0xe4, 0x0e, 0x87, 0x54, 0xf1, 0x03, 0x85, 0xe2, 0xa1, 0x95, 0x29,
-  0x52, 0xcc, 0x4b, 0x77, 0x81, 0xb8, 0x78, 0xd1, 0x91, 0xd6, 0xd3, 0x82,
-  0x43, 0xd9, 0x1e, 0xaa, 0x4b, 0x16, 0x29, 0x55, 0x19, 0x9a, 0x79, 0x76,
-  0xd7, 0x14, 0x56, 0x44, 0xef, 0x6e, 0xe8, 0x62, 0xf7, 0x81, 0x7a, 0x68,
-  0x29, 0x55, 0xb5, 0x50, 0xae, 0x8e, 0x6a, 0xfe, 0x14, 0x6f, 0xe8, 0x2d,
-  0x4c, 0x58, 0x90, 0x99, 0xab, 0x9f, 0xd5, 0xa8, 0x0c, 0x4c, 0xdb, 0xd4,
-  0x64, 0xfd, 0xec, 0x8c, 0x4a, 0x32, 0xe5, 0x14, 0xb5, 0xec, 0xdc, 0xb7,
-  0x7d, 0xdb, 0xa0, 0x85, 0xf4, 0x14, 0x57, 0x6f, 0x63, 0x78, 0xac, 0x95,
-  0xff, 0xe2, 0xba, 0xb5, 0xd5, 0x4b, 0x2b, 0x2b, 0x19, 0x96, 0x36, 0xc5,
-  0xc4, 0x56, 0x31, 0xa5, 0x5e, 0x8b, 0xca, 0xad, 0xf6, 0xd3, 0xf9, 0x71,
-  0x16, 0xe8, 0xfa, 0x26, 0x7c, 0x8c, 0x6b, 0xaa, 0xee, 0x44, 0xab, 0x89,
-  0x98, 0xa8, 0x9b, 0x08, 0xf6, 0x1a, 0x2b, 0xb7, 0x8c, 0xe8, 0x83, 0x3a,
-  0x38, 0xbe, 0x4b, 0xbc, 0x0e, 0x0a, 0x22, 0xd3, 0x51, 0x87, 0x54, 0x40,
-  0x28, 0x5b, 0x2b, 0xe0, 0x38, 0x2c, 0xf1, 0x0a, 0x28, 0xca, 0xcb, 0x83,
-  0x44, 0x10, 0xd6, 0x76, 0x22, 0x28, 0xf6, 0x49, 0x07, 0x11, 0xf8, 0xcc,
-  0xff, 0xc1, 0x3a, 0xd8, 0x19, 0x80, 0x55, 0x87, 0xb6, 0xf0, 0x4f, 0xd3,
-  0x48, 0x85, 0x12, 0xa8, 0x24, 0x5e, 0x23, 0x87, 0x43, 0x79, 0xb0, 0x4a,
-  0x46, 0xdb, 0x4a, 0x97, 0x15, 0x44, 0x24, 0x5e, 0x95, 0x15, 0xbd, 0xe1,
-  0xa1, 0xea, 0x0c, 0xea, 0xd6, 0x2a, 0x4d, 0xbc, 0x8f, 0x78, 0x8d, 0x26,
-  0xb4, 0xc8, 0x83, 0x35, 0x1a, 0xd4, 0xad, 0x35, 0x9a, 0xb0, 0x1b, 0xf1,
-  0x1a, 0xb5, 0xa3, 0xdc, 0xed, 0x23, 0xd1, 0xf8, 0xd3, 0x8d, 0x56, 0x86,
-  0xfa, 0x35, 0xd6, 0xf6, 0xa0, 0x56, 0x6d, 0x94, 0x65, 0x15, 0x0d, 0xeb,
-  0x41, 0x25, 0xd9, 0x8e, 0x67, 0xe5, 0xae, 0xf9, 0x0e, 0xc4, 0x5b, 0xee,
-  0x23, 0xb9, 0x62, 0x90, 0x6e, 0x05, 0xd9, 0x42, 0xdb, 0xae, 0x15, 0xdb,
-  0xe5, 0x59, 0x6b, 0x3a, 0x0a, 0x87, 0x0e, 0x91, 0x82, 0x3f, 0xb7, 0x93,
-  0x4b, 0xc8, 0x11, 0x62, 0x39, 0x3d, 0x46, 0xaa, 0x9d, 0x23, 0x4c, 0xf7,
-  0xc8, 0xc4, 0x44, 0x97, 0x50, 0x4c, 0x61, 0x3b, 0x53, 0x9b, 0x3c, 0x4c,
-  0xcd, 0x53, 0xa7, 0xf9, 0x8a, 0x3c, 0x14, 0x4d, 0x1d, 0xd2, 0x0c, 0x7f,
-  0x6e, 0x27, 0x8f, 0x90, 0x23, 0xe4, 0x71, 0x7a, 0x8c, 0x3c, 0x3b, 0x47,
-  0x98, 0xee, 0x91, 0x87, 0x89, 0x2e, 0x79, 0x98, 0x72, 0x77, 0xf7, 0xf4,
-  0xdb, 0x6f, 0xbf, 0x74, 0x09, 0xc4, 0xf4, 0x3c, 0x75, 0x08, 0x50, 0x04,
-  0xa2, 0x5c, 0xec, 0x90, 0xa6, 0xf8, 0x73, 0x3b, 0x81, 0x84, 0x1c, 0x21,
-  0x90, 0xd3, 0x63, 0x04, 0xda, 0x39, 0xc2, 0x74, 0x8f, 0x40, 0x4c, 0x74,
-  0x09, 0xc4, 0x94, 0xb0, 0xff, 0x30, 0x35, 0x4f, 0x9d, 0xe6, 0x6b, 0xb7,
-  0x17, 0x28, 0x1f, 0xbb, 0xe4, 0x2a, 0xfd, 0xde, 0x4e, 0x21, 0xa3, 0x47,
-  0x48, 0x14, 0x40, 0x8c, 0x46, 0x27, 0x4f, 0x04, 0xe0, 0x51, 0x49, 0xa9,
-  0x2e, 0x99, 0x94, 0x14, 0xd2, 0x49, 0xc9, 0x79, 0xea, 0xd2, 0xa1, 0x15,
-  0x19, 0x10, 0xcd, 0xdb, 0xa4, 0x3a, 0x7e, 0x6f, 0xa7, 0xd5, 0xe4, 0x88,
-  0xd0, 0x6b, 0x01, 0x63, 0x34, 0x07, 0x79, 0x3b, 0x80, 0xfe, 0x6e, 0x03,
-  0x20, 0x2e, 0xe9, 0x1a, 0x37, 0x24, 0x1f, 0x41, 0x79, 0x1a, 0x12, 0xa7,
-  0x38, 0x30, 0x29, 0xa7, 0xdb, 0x16, 0x99, 0x49, 0x39, 0xdd, 0x4e, 0xbf,
-  0xc9, 0x10, 0xa1, 0xdf, 0x02, 0xc6, 0xe8, 0x0f, 0xf2, 0x76, 0x00, 0x3d,
-  0xfa, 0xa1, 0x4d, 0x2e, 0xf9, 0x1a, 0x35, 0x24, 0x1f, 0x70, 0xf3, 0x34,
-  0xa4, 0x4c, 0x51, 0x5f, 0x5e, 0x6e, 0x59, 0xef, 0xca, 0xcb, 0xed, 0xa4,
-  0x6b, 0xf4, 0x08, 0xe5, 0x06, 0x16, 0x23, 0xdc, 0xcf, 0x19, 0x87, 0x79,
-  0x64, 0x97, 0x97, 0x2e, 0xd5, 0x0a, 0x91, 0x55, 0xe0, 0x6f, 0xbc, 0x73,
-  0xfb, 0xf2, 0x32, 0x4f, 0x03, 0xa2, 0x74, 0xa7, 0x57, 0x2b, 0x5a, 0x6b,
-  0x4d, 0x6c, 0x2c, 0xe9, 0x6d, 0xf8, 0x29, 0xa7, 0xf0, 0xee, 0x22, 0xc7,
-  0x8c, 0x58, 0x6d, 0xdf, 0xad, 0xbd, 0x16, 0xe5, 0x3d, 0xbe, 0xc3, 0xd1,
-  0x75, 0xd1, 0x73, 0xb6, 0x07, 0x0a, 0x84, 0x5d, 0xcd, 0x2b, 0x85, 0x1a,
-  0xd9, 0xc9, 0x6c, 0xcb, 0x4a, 0x1b, 0x2f, 0x52, 0xdf, 0x22, 0xf9, 0x15,
-  0x03, 0x8a, 0xba, 0xd6, 0xf4, 0x63, 0x38, 0x2f, 0x51, 0x34, 0x6a, 0x14,
-  0xdd, 0xf0, 0xaf, 0x63, 0xa1, 0x20, 0x4d, 0x27, 0x9b, 0xf6, 0x02, 0x03,
-  0x84, 0xf1, 0x28, 0x0b, 0x8f, 0x10, 0x71, 0x7b, 0x01, 0xaa, 0xd4, 0x9f,
-  0x35, 0x0e, 0xf0, 0x6e, 0xae, 0xce, 0xf1, 0x02, 0x13, 0x07, 0xe5, 0xda,
-  0xb3, 0x94, 0x38, 0xef, 0x97, 0x6b, 0x32, 0x95, 0xa0, 0x67, 0x19, 0x3e,
-  0x4c, 0xbf, 0xd1, 0xd8, 0x4d, 0x93, 0xe9, 0x4b, 0x7c, 0xc7, 0x0c, 0x98,
-  0x57, 0x68, 0x81, 0x14, 0x43, 0x6c, 0xaf, 0x4f, 0xa7, 0xe3, 0x65, 0xbf,
-  0xad, 0xde, 0x96, 0xd7, 0xc5, 0xb4, 0xf7, 0x34, 0xb3, 0x73, 0xd1, 0x0b,
-  0x0e, 0x3f, 0xdb, 0xac, 0x2e, 0x0a, 0x7a, 0xdb, 0x71, 0x7a, 0x31, 0x06,
-  0xe4, 0x1f, 0x5e, 0xe2, 0x71, 0x00, 0xb0, 0x06, 0xe6, 0x4e, 0x00, 0xca,
-  0xb8, 0x1c, 0x79, 0xf4, 0xe1, 0x97, 0xc4, 0xc9, 0x84, 0xd1, 0xd4, 0x97,
-  0x00, 0x36, 0x1d, 0x29, 0x56, 0x29, 0xe7, 0xf6, 0x9b, 0x0a, 0x3d, 0x04,
-  0x07, 0xfe, 0x45, 0x4c, 0x17, 0x1a, 0x14, 0x2c, 0xef, 0x2f, 0xfc, 0xaa,
-  0xc5, 0x15, 0xc9, 0xdd, 0x5d, 0x92, 0xfe, 0x9d, 0x3d, 0x2c, 0xa0, 0x4b,
-  0x5b, 0x6e, 0x0a, 0x6d, 0xc0, 0xfd, 0xd6, 0x90, 0x81, 0xce, 0xb9, 0xf3,
-  0x50, 0x03, 0x3b, 0x80, 0xf6, 0xb9, 0x7e, 0xd9, 0xec, 0xca, 0x90, 0xed,
-  0xf4, 0xf0, 0xed, 0x46, 0x03, 0xbc, 0xa0, 0x58, 0xd2, 0x5c, 0xc1, 0x62,
-  0x82, 0x37, 0x44, 0x5e, 0x26, 0x1a, 0x54, 0x44, 0x85, 0x0c, 0x57, 0x46,
-  0xa5, 0xf7, 0x1b, 0x51, 0x5c, 0xfb, 0x48, 0x91, 0x70, 0x2d, 0x83, 0xab,
-  0x68, 0xd3, 0xad, 0xeb, 0x0b, 0x6e, 0xbc, 0x79, 0xa8, 0x11, 0xad, 0x40,
-  0xe3, 0x0f, 0xc2, 0x2b, 0xa3, 0xed, 0x17, 0x72, 0x4d, 0x7b, 0xad, 0xf4,
-  0x77, 0x36, 0x7c, 0xa3, 0xd3, 0x99, 0xeb, 0x4e, 0x19, 0xaa, 0xde, 0x10,
-  0xb9, 0xd2, 0x53, 0xa7, 0x7a, 0x72, 0xd3, 0xc3, 0xf6, 0x53, 0x83, 0xe3,
-  0xdb, 0x6b, 0x2d, 0x2c, 0xe3, 0x03, 0xde, 0x3f, 0xad, 0xbd, 0xce, 0x75,
-  0x61, 0x96, 0xa0, 0x5c, 0x4e, 0xf5, 0x96, 0x04, 0x9f, 0x8b, 0xc8, 0x5b,
-  0xf8, 0x2d, 0x4b, 0x22, 0x1a, 0x8d, 0xc6, 0xf7, 0x23, 0x36, 0xc4, 0x5f,
-  0x13, 0xc2, 0x5c, 0x31, 0x88, 0x47, 0xe3, 0xd2, 0x5a, 0x05, 0x0d, 0x5a,
-  0xf7, 0x7e, 0x64, 0x89, 0x2b, 0xa1, 0x55, 0x9e, 0x4d, 0xe6, 0x5c, 0x2d,
-  0x83, 0x08, 0xb7, 0x76, 0x23, 0xcb, 0xf9, 0x76, 0x52, 0x11, 0x95, 0x82,
-  0xc1, 0x46, 0x88, 0x35, 0xb0, 0x18, 0xb9, 0x7e, 0xce, 0x38, 0xcc, 0x27,
-  0x79, 0xee, 0x92, 0xac, 0x10, 0xc3, 0x75, 0x7f, 0x39, 0xcf, 0xbd, 0xb2,
-  0x6c, 0xfd, 0xb6, 0x29, 0xf4, 0x48, 0xb5, 0xed, 0x15, 0xc9, 0xb9, 0x5b,
-  0xd1, 0x49, 0xb1, 0xc1, 0x75, 0xa9, 0xb5, 0xd2, 0x3d, 0x4a, 0x83, 0x1c,
-  0x61, 0xba, 0xaf, 0xd7, 0x36, 0x85, 0x26, 0xd1, 0x7e, 0x67, 0xb5, 0xbd,
-  0x6b, 0x21, 0x57, 0x9e, 0x3a, 0xa4, 0xdc, 0x9b, 0x5b, 0xce, 0xcf, 0xc6,
-  0xd3, 0x82, 0x31, 0xe3, 0xc4, 0x2b, 0x69, 0x02, 0x6d, 0xa7, 0x56, 0x32,
-  0x44, 0xe8, 0x55, 0x10, 0xf3, 0x8c, 0x02, 0x2d, 0x6a, 0xf9, 0x0a, 0xb7,
-  0x46, 0x63, 0x9d, 0x5e, 0xf4, 0x2e, 0x98, 0x5c, 0x71, 0x44, 0x98, 0xe4,
-  0x56, 0x14, 0x83, 0x78, 0x8c, 0xe2, 0xd6, 0x0b, 0xaf, 0x94, 0x4b, 0x16,
-  0x79, 0xea, 0x61, 0xb3, 0x86, 0xf1, 0x72, 0xa7, 0x2c, 0x8b, 0x3f, 0x33,
-  0x52, 0x00, 0x67, 0x57, 0x97, 0xc2, 0x94, 0xd9, 0x25, 0x5f, 0x6b, 0xce,
-  0xae, 0x4e, 0x2f, 0xd1, 0xc3, 0x2a, 0x5e, 0xf6, 0x03, 0x92, 0x23, 0x29,
-  0xd3, 0x4b, 0x5c, 0xf9, 0x0c, 0x86, 0xb5, 0x2f, 0x2c, 0xe9, 0x82, 0xbc,
-  0x5e, 0xe0, 0xe3, 0x33, 0xd9, 0x0f, 0x96, 0x78, 0x13, 0x5a, 0x7a, 0xa2,
-  0x56, 0xc4, 0x38, 0x63, 0x0e, 0x10, 0x3e, 0xaf, 0x8b, 0x59, 0x08, 0xd0,
-  0x05, 0x2f, 0x55, 0xc1, 0x4a, 0x0e, 0xa9, 0xf4, 0x2b, 0x1b, 0x70, 0x7a,
-  0x55, 0x8f, 0x74, 0xc5, 0x72, 0x75, 0xeb, 0x4a, 0x07, 0xbe, 0x96, 0xed,
-  0x6c, 0x0c, 0xa2, 0x0e, 0x10, 0x23, 0x6c, 0x8e, 0x06, 0xb1, 0x8d, 0x66,
-  0xb5, 0x1e, 0x4d, 0xca, 0xf6, 0x86, 0x4d, 0xb2, 0xa8, 0xba, 0xab, 0x0c,
-  0x9b, 0xe3, 0x9b, 0x70, 0x7a, 0x57, 0xba, 0x0e, 0x1f, 0xff, 0xfb, 0xdf,
-  0xff, 0x23, 0xa5, 0x22, 0x03, 0xe7, 0x8c, 0x58, 0x3d, 0xd2, 0x11, 0x56,
-  0xb7, 0xdf, 0xff, 0x66, 0x7b, 0x85, 0x14, 0x2f, 0xc5, 0xd6, 0xf5, 0x60,
-  0xd3, 0x77, 0x44, 0x97, 0x6d, 0xb4, 0xce, 0xea, 0x8e, 0xa1, 0x64, 0x74,
-  0x13, 0x80, 0x7f, 0xb7, 0x77, 0x0f, 0xa3, 0x6c, 0xef, 0x21, 0xc0, 0x79,
-  0x0f, 0x1c, 0xd2, 0xf5, 0xb8, 0xfd, 0x84, 0xfd, 0xe2, 0x80, 0xec, 0x9e,
-  0x92, 0xac, 0x1d, 0xdd, 0x25, 0xd0, 0x87, 0xfa, 0x4c, 0xa1, 0x75, 0x75,
-  0x1c, 0x14, 0x8d, 0x55, 0x66, 0xd4, 0x14, 0x9f, 0x67, 0xe5, 0x0a, 0x9d,
-  0x7a, 0xd9, 0x5d, 0x15, 0xab, 0x95, 0x65, 0x2c, 0xa7, 0x77, 0xf6, 0xd8,
-  0xd6, 0x7a, 0xac, 0xbe, 0x89, 0xde, 0xba, 0x0f, 0xec, 0xc3, 0x42, 0xb4,
-  0xd1, 0x73, 0x55, 0x6c, 0x8a, 0xfa, 0xe0, 0x69, 0xd8, 0xf4, 0x42, 0xf3,
-  0xf4, 0xaf, 0xea, 0xd9, 0xe2, 0x95, 0x54, 0x56, 0x3f, 0xf5, 0xa2, 0x82,
-  0x53, 0xcf, 0x24, 0x55, 0xbd, 0xa2, 0x10, 0x2d, 0x67, 0xac, 0x84, 0xa9,
-  0x3c, 0x7a, 0x50, 0x46, 0x2d, 0x72, 0x9b, 0xab, 0xde, 0x0c, 0x88, 0x50,
-  0x5c, 0x2b, 0xec, 0xf9, 0xda, 0x4e, 0x55, 0x87, 0x0e, 0xf3, 0xf5, 0x29,
-  0xfb, 0xac, 0x4d, 0x3b, 0x95, 0x2b, 0xb4, 0x1c, 0xee, 0x14, 0xd2, 0xd4,
-  0x62, 0x57, 0x3a, 0x73, 0x92, 0x27, 0x63, 0x6d, 0x3c, 0x27, 0xc9, 0x93,
-  0xaa, 0xe6, 0xe4, 0x88, 0x3d, 0xda, 0x13, 0x4b, 0x5c, 0x81, 0x5a, 0xe7,
-  0xa9, 0xe2, 0x13, 0x99, 0x88, 0x9c, 0x75, 0x36, 0x8e, 0x18, 0xe7, 0x36,
-  0x8e, 0x93, 0xbc, 0xc6, 0xd9, 0x78, 0x4e, 0x92, 0xd7, 0xb8, 0x33, 0xdd,
-  0x38, 0x04, 0x6b, 0x5d, 0xee, 0xc0, 0x93, 0xf8, 0x67, 0x79, 0xaa, 0xba,
-  0x8c, 0x1a, 0xd8, 0x8c, 0x3b, 0x5b, 0x38, 0xa6, 0x78, 0x05, 0x5e, 0x1b,
-  0x55, 0xa2, 0xd7, 0x4a, 0x17, 0xd7, 0x4b, 0xf4, 0xd5, 0xcf, 0xb1, 0x6e,
-  0x2a, 0x63, 0x9c, 0x36, 0xe5, 0xef, 0x1e, 0x1f, 0x9b, 0x71, 0xae, 0xb2,
-  0xeb, 0x96, 0x76, 0xdf, 0xfb, 0xd3, 0xb0, 0xf2, 0x6e, 0xfb, 0x39, 0xcd,
-  0xbf, 0xe3, 0xb7, 0x31, 0xdd, 0x34, 0xbf, 0x91, 0xba, 0x8d, 0xe5, 0x41,
-  0x73, 0xaa, 0x83, 0x1d, 0x58, 0x2d, 0xcc, 0x53, 0x3d, 0x9c, 0xa9, 0x7d,
-  0xf3, 0x6e, 0xc3, 0x04, 0x18, 0xc8, 0x51, 0xb5, 0xd7, 0x4a, 0xf7, 0x1a,
-  0x1a, 0xe4, 0x08, 0xd3, 0xfd, 0x93, 0xe9, 0xb5, 0x6e, 0xb1, 0x46, 0xea,
-  0x54, 0x89, 0xe6, 0xeb, 0xdc, 0x2a, 0xca, 0x50, 0x30, 0xd9, 0x46, 0x82,
-  0xcc, 0xc5, 0x80, 0x04, 0x95, 0x1e, 0x92, 0xe0, 0xe6, 0x08, 0xd3, 0x03,
-  0x12, 0x26, 0x36, 0x0d, 0x8c, 0x75, 0x3a, 0xff, 0xdd, 0x6f, 0xfb, 0x24,
-  0x4f, 0x1d, 0xd1, 0x70, 0xcf, 0x3b, 0xb7, 0x36, 0xb2, 0x67, 0xa3, 0xa7,
-  0xe4, 0xa7, 0xcb, 0xc6, 0xdd, 0xcc, 0x2f, 0x65, 0xd7, 0xa9, 0xde, 0x90,
-  0xbb, 0xf9, 0xec, 0x97, 0x34, 0xce, 0x10, 0xb5, 0x2c, 0x9c, 0xbc, 0xc7,
-  0x14, 0x8b, 0x4b, 0xd2, 0x22, 0xf5, 0x8b, 0x24, 0xb4, 0x84, 0xbb, 0x34,
-  0xda, 0xe3, 0x7a, 0x82, 0xad, 0x41, 0x57, 0xd8, 0xa7, 0xf0, 0x13, 0x6f,
-  0x64, 0x93, 0xe9, 0x58, 0xa5, 0x4c, 0xc7, 0xb3, 0xe6, 0xee, 0x6e, 0xef,
-  0x6f, 0x90, 0x88, 0xce, 0xad, 0x79, 0x23, 0xbe, 0x86, 0x8f, 0x89, 0xfc,
-  0x84, 0xdd, 0xef, 0x66, 0xd5, 0xaa, 0x97, 0x3a, 0x98, 0x82, 0x76, 0x72,
-  0x97, 0x0b, 0xb3, 0xa3, 0x4d, 0x86, 0x89, 0xf3, 0xc4, 0x85, 0x7c, 0x49,
-  0xd1, 0x23, 0x17, 0xe5, 0x2e, 0x5b, 0x3d, 0x72, 0x49, 0x28, 0x74, 0xc0,
-  0x17, 0xb7, 0xd0, 0x0c, 0xcd, 0x92, 0xfd, 0xec, 0xfe, 0x71, 0xd2, 0xfb,
-  0xe2, 0x76, 0x3a, 0xb6, 0xb8, 0x74, 0x9f, 0x4c, 0x5f, 0xbe, 0xfd, 0x9c,
-  0x71, 0x9b, 0x9a, 0x43, 0xc8, 0x32, 0x99, 0xdc, 0xff, 0x66, 0x1f, 0x5a,
-  0x41, 0x11, 0xcf, 0x86, 0x7f, 0xdb, 0x7f, 0xb0, 0x2d, 0xe4, 0x91, 0xc8,
-  0x34, 0x06, 0x3f, 0xff, 0x6a, 0x6b, 0x7e, 0xb3, 0xcd, 0xfb, 0xa0, 0x52,
-  0xab, 0xd7, 0xb0, 0xda, 0x3f, 0x59, 0x5a, 0x02, 0x1a, 0x56, 0xa2, 0xdb,
-  0x55, 0x5d, 0x30, 0x79, 0xf7, 0xc9, 0x66, 0x3d, 0x85, 0x71, 0xf3, 0x62,
-  0x8a, 0x5e, 0x2c, 0x83, 0x95, 0xd6, 0x01, 0x8e, 0x22, 0x8f, 0x93, 0xc8,
-  0x75, 0x38, 0xb0, 0x6c, 0xf8, 0xcb, 0xaf, 0xd4, 0x5f, 0x23, 0x7b, 0x04,
-  0x7d, 0x47, 0xaf, 0xa7, 0x10, 0xdc, 0x5f, 0x6f, 0x9a, 0x79, 0x8f, 0x1e,
-  0x85, 0x4b, 0xb4, 0x99, 0x2c, 0x82, 0xce, 0x8f, 0xa8, 0x22, 0xf8, 0x04,
-  0x90, 0x0c, 0x28, 0xcf, 0x9f, 0x1d, 0xec, 0x87, 0x78, 0xe2, 0x74, 0x01,
-  0x06, 0x26, 0x7c, 0x79, 0x83, 0x9c, 0x70, 0xcf, 0xab, 0x72, 0xd5, 0x4b,
-  0x13, 0x18, 0xb1, 0xae, 0x2a, 0xf1, 0xa9, 0xa8, 0x67, 0x9e, 0x26, 0x81,
-  0xbe, 0x14, 0xfe, 0x49, 0x45, 0x42, 0x5f, 0x9f, 0xaa, 0xf7, 0x8e, 0x78,
-  0xa8, 0xb8, 0xc8, 0xcc, 0x95, 0xf6, 0x39, 0x39, 0x67, 0x38, 0x55, 0x01,
-  0x51, 0x22, 0xce, 0xeb, 0xda, 0xb9, 0xd2, 0x46, 0xe4, 0x49, 0xa4, 0x9c,
-  0xd8, 0xce, 0x2f, 0x24, 0x59, 0xde, 0x1c, 0xca, 0xc6, 0x1d, 0xcd, 0x2a,
-  0x34, 0xba, 0x7e, 0x1c, 0x29, 0x3a, 0xc9, 0x44, 0x6d, 0xeb, 0xb5, 0x51,
-  0x91, 0xe8, 0x1f, 0xb5, 0x52, 0x57, 0xf4, 0x33, 0xc8, 0x4e, 0xdd, 0x83,
-  0xde, 0xda, 0x77, 0xee, 0x11, 0x55, 0x9d, 0xde, 0x06, 0x51, 0x27, 0xfb,
-  0x5b, 0x3d, 0x0f, 0x3f, 0x48, 0xf6, 0xf7, 0xfb, 0x90, 0xe8, 0x72, 0x4e,
-  0xfb, 0xec, 0x7f, 0xce, 0xbe, 0xda, 0x0f, 0x53, 0x0e, 0xb5, 0xe1, 0x6f,
-  0xff, 0xd1, 0xc0, 0x23, 0xb5, 0x59, 0x72, 0xcf, 0xce, 0xe5, 0xb7, 0xdc,
-  0xcd, 0x29, 0x05, 0xd0, 0x3b, 0xca, 0xd0, 0xc9, 0xfe, 0x29, 0x86, 0x87,
-  0x1f, 0x24, 0xfb, 0x3b, 0xfb, 0xb9, 0x51, 0xae, 0xe4, 0xb9, 0x99, 0xa1,
-  0x86, 0x0f, 0x0c, 0xbd, 0x4d, 0xfd, 0x1c, 0xef, 0xe7, 0x2c, 0xb5, 0x94,
-  0x48, 0x40, 0xbf, 0x08, 0x5d, 0x24, 0x78, 0xe1, 0x6d, 0x5d, 0x42, 0x7c,
-  0xa0, 0x47, 0x4e, 0x3c, 0x6f, 0x07, 0xd0, 0xbf, 0x90, 0x51, 0x31, 0x74,
-  0x51, 0x9c, 0x3b, 0xa8, 0xb8, 0xeb, 0xf7, 0x2e, 0x64, 0xe6, 0x17, 0xb9,
-  0x5f, 0x9e, 0xd6, 0x7f, 0x26, 0xdd, 0xc7, 0x4d, 0x6c, 0xf6, 0xc6, 0x8f,
-  0xa5, 0x3c, 0x3d, 0xc8, 0x86, 0xf8, 0xda, 0x50, 0x98, 0x2b, 0x06, 0xf1,
-  0x35, 0xa3, 0x89, 0x39, 0x67, 0xd2, 0xf1, 0x81, 0x18, 0xb7, 0x53, 0xdf,
-  0x00, 0xbc, 0xdc, 0x29, 0x54, 0xab, 0x1c, 0x75, 0xb7, 0x5a, 0xc7, 0x11,
-  0xfe, 0x78, 0x12, 0x7a, 0x5a, 0xbc, 0x0d, 0xf1, 0x95, 0xf9, 0x30, 0x57,
-  0x0c, 0xe2, 0xab, 0x1e, 0x75, 0x63, 0x8f, 0x3f, 0x85, 0xe7, 0x69, 0x1e,
-  0x35, 0x28, 0x7d, 0x76, 0x29, 0x4a, 0xf7, 0xc0, 0x10, 0xa5, 0x66, 0x2c,
-  0x7a, 0xfb, 0xba, 0x70, 0x6e, 0xd2, 0x46, 0xef, 0x90, 0x36, 0xff, 0xde,
-  0x1e, 0x8e, 0x82, 0xb2, 0x78, 0x92, 0x57, 0x7b, 0x9c, 0xf9, 0x6b, 0x52,
-  0xb7, 0xcb, 0x46, 0xdb, 0xd3, 0x60, 0x8c, 0x79, 0x89, 0x71, 0x25, 0xf0,
-  0xa0, 0x81, 0x89, 0x41, 0x75, 0xfb, 0xc7, 0x4a, 0xf7, 0x7a, 0x27, 0xc8,
-  0x11, 0xa6, 0x77, 0x1b, 0x96, 0x98, 0xe0, 0x37, 0x7f, 0xc8, 0xbc, 0xc4,
-  0x21, 0x44, 0x9d, 0x44, 0x2c, 0xca, 0xa5, 0x45, 0xa8, 0x7e, 0xde, 0x8d,
-  0x0a, 0x5b, 0xb9, 0xdc, 0x46, 0x28, 0xa3, 0x06, 0x74, 0x4a, 0x72, 0x48,
-  0xa6, 0x83, 0x1f, 0x24, 0x7b, 0x44, 0x42, 0xaa, 0x50, 0xd9, 0xfb, 0x40,
-  0xc1, 0xbe, 0xf1, 0x5a, 0x45, 0x22, 0xc9, 0x9c, 0xa2, 0x9b, 0xdf, 0x6f,
-  0xf7, 0x33, 0x4b, 0xa7, 0x71, 0x69, 0x85, 0xcc, 0x79, 0x6a, 0x13, 0xa3,
-  0x8d, 0x63, 0x27, 0x8a, 0x54, 0x79, 0x4c, 0x4f, 0x52, 0x84, 0x6a, 0xd6,
-  0x82, 0x4d, 0x85, 0xe6, 0xf5, 0x44, 0x9a, 0x4e, 0xce, 0xd0, 0xc4, 0xd2,
-  0xa8, 0xe5, 0x08, 0x58, 0xa2, 0x46, 0xae, 0x2f, 0x4b, 0xf9, 0x62, 0xe7,
-  0x5f, 0xd1, 0xea, 0x13, 0x0d, 0x66, 0xd5, 0x45, 0x0f, 0x99, 0x81, 0xee,
-  0xec, 0x60, 0x00, 0xf3, 0x6a, 0x96, 0x98, 0xf4, 0x09, 0x39, 0xbd, 0xe4,
-  0x80, 0xe6, 0x3b, 0x3b, 0xda, 0x99, 0xb1, 0x85, 0x90, 0x99, 0x65, 0x7d,
-  0x53, 0x4b, 0x84, 0x11, 0x71, 0x74, 0x24, 0xf7, 0xb0, 0x9b, 0x3a, 0x43,
-  0x98, 0xa3, 0xcf, 0xd8, 0xed, 0x78, 0x6e, 0x95, 0xe6, 0x2a, 0xfe, 0xff,
-  0xf5, 0x9f, 0xaf, 0x60, 0xb8, 0x7c, 0x78, 0xf2, 0x42, 0x6b, 0x14, 0x18,
-  0x42, 0x5d, 0xd7, 0x81, 0xde, 0x92, 0x64, 0x61, 0x1f, 0x99, 0xab, 0x19,
-  0xf8, 0x2d, 0xe4, 0x69, 0x6a, 0x20, 0xa9, 0x9b, 0x12, 0x02, 0x22, 0x15,
-  0xf0, 0xc3, 0x7d, 0xcd, 0x2d, 0x05, 0x3d, 0x17, 0x9c, 0xee, 0xb6, 0x69,
-  0xee, 0xae, 0x37, 0xa6, 0x75, 0xa6, 0x13, 0xd1, 0x41, 0x0f, 0xc2, 0xfc,
-  0x4b, 0x36, 0xee, 0x1c, 0x28, 0xeb, 0xfd, 0xbb, 0xdf, 0xd3, 0x81, 0x65,
-  0x22, 0xbd, 0x69, 0x4c, 0x31, 0xa2, 0xc4, 0x19, 0xeb, 0xe8, 0x8d, 0x3e,
-  0x5c, 0xb3, 0x63, 0x4e, 0x89, 0x69, 0xed, 0xa6, 0x79, 0xd0, 0x86, 0xb7,
-  0x33, 0x88, 0x57, 0x97, 0x39, 0xaf, 0x17, 0xa5, 0xeb, 0x2f, 0xd6, 0xe4,
-  0x95, 0xd2, 0x69, 0xa5, 0x1c, 0x4a, 0x8d, 0x07, 0x2b, 0x54, 0xe6, 0xbe,
-  0xd1, 0x28, 0x68, 0x5d, 0x54, 0xb1, 0xaa, 0x75, 0xaa, 0x82, 0x9c, 0xdd,
-  0xdd, 0x25, 0x9a, 0xd2, 0x7f, 0x8e, 0xc2, 0x4e, 0x73, 0xe5, 0xee, 0xf2,
-  0xc4, 0xee, 0x39, 0x8c, 0xf5, 0x16, 0xb7, 0x58, 0xa6, 0x8a, 0x7e, 0xac,
-  0xe8, 0xb4, 0x1c, 0xd7, 0x32, 0x2b, 0x5e, 0x98, 0x51, 0x7f, 0xe9, 0xf3,
-  0x7d, 0x43, 0x07, 0x7f, 0xc6, 0x71, 0x46, 0x0c, 0xe9, 0x65, 0x4b, 0x8b,
-  0x09, 0xfb, 0xd2, 0xd1, 0x21, 0xc1, 0x94, 0x98, 0x95, 0xba, 0xd4, 0x98,
-  0x0b, 0x07, 0x83, 0xc2, 0x88, 0x1c, 0x96, 0xab, 0xfc, 0xd0, 0x8c, 0x4c,
-  0x37, 0xc8, 0x99, 0x05, 0xc6, 0x59, 0x99, 0x09, 0x76, 0x66, 0xf2, 0x41,
-  0xcb, 0x54, 0x05, 0xf0, 0x33, 0x9a, 0x51, 0x87, 0x2f, 0x1b, 0x18, 0x3c,
-  0xfd, 0x6c, 0x70, 0x36, 0x02, 0xee, 0x33, 0xe7, 0xd4, 0x36, 0xb4, 0xa3,
-  0xb1, 0x72, 0x98, 0xdb, 0x51, 0xb1, 0x2e, 0x90, 0x1e, 0xa3, 0xf3, 0x93,
-  0x2b, 0xcd, 0x41, 0xb6, 0x7e, 0xb4, 0x3c, 0xb0, 0x29, 0xc6, 0x11, 0x77,
-  0x62, 0x13, 0x15, 0x41, 0x1d, 0x5c, 0xf0, 0x22, 0xc9, 0xf9, 0x13, 0x11,
-  0xef, 0xb4, 0x6b, 0xd8, 0xfd, 0xb6, 0x8d, 0xbc, 0xcd, 0xb3, 0x52, 0xc4,
-  0x6d, 0xbe, 0x38, 0xd0, 0x46, 0x7f, 0x11, 0x4e, 0xb1, 0xb3, 0x65, 0xab,
-  0xb7, 0x65, 0x05, 0xbe, 0x9c, 0xd5, 0xd2, 0xd1, 0x14, 0xd2, 0x29, 0x23,
-  0x2d, 0x94, 0x6c, 0x67, 0xc7, 0xf9, 0x7e, 0xb6, 0x9f, 0x3d, 0x77, 0x12,
-  0x2c, 0x31, 0x79, 0x98, 0xee, 0x6b, 0xb9, 0x46, 0xcb, 0x5d, 0xd7, 0x7a,
-  0xe9, 0x2d, 0x97, 0x3a, 0x60, 0x95, 0x4b, 0x21, 0x3a, 0x2f, 0x0f, 0x63,
-  0xd0, 0xe9, 0x27, 0x97, 0x67, 0x95, 0x83, 0xdf, 0x94, 0xab, 0x49, 0xe1,
-  0x65, 0xb1, 0x82, 0xd2, 0x0d, 0x88, 0x45, 0xf0, 0xbf, 0x79, 0x0e, 0xcf,
-  0x71, 0x00, 0xd3, 0x1c, 0xf9, 0x63, 0xbd, 0x92, 0x97, 0x70, 0x80, 0x69,
-  0xce, 0x5e, 0xff, 0x6c, 0x7c, 0x0c, 0x0b, 0x08, 0xf8, 0x8d, 0x9d, 0x88,
-  0xc1, 0x01, 0xd3, 0x1c, 0x6a, 0xc2, 0x1b, 0x00, 0xbf, 0xa7, 0xc9, 0x43,
-  0x48, 0xe7, 0x44, 0x72, 0x91, 0x77, 0x87, 0x29, 0x9d, 0x79, 0x3c, 0x24,
-  0x4a, 0xb7, 0xc9, 0xb5, 0xbf, 0x50, 0xac, 0x35, 0x5f, 0xcc, 0xa8, 0xc3,
-  0xc8, 0xa0, 0xa0, 0xf4, 0x9a, 0x41, 0xc7, 0x09, 0xd6, 0x98, 0xf3, 0x29,
-  0x75, 0xf0, 0xec, 0x83, 0xa0, 0xad, 0x83, 0x1f, 0xe7, 0xa1, 0x4c, 0x30,
-  0x4f, 0xd7, 0xc6, 0x18, 0xd3, 0xdb, 0xbd, 0x30, 0x18, 0x7b, 0x6e, 0xcf,
-  0x75, 0xc3, 0xc0, 0xf1, 0x71, 0xc2, 0xae, 0x10, 0xb7, 0x6b, 0xe7, 0xd8,
-  0x3e, 0xad, 0x9d, 0xb7, 0x46, 0x3b, 0x5f, 0x97, 0x2b, 0xf6, 0xbb, 0x90,
-  0x0c, 0x5d, 0xbf, 0x0c, 0xb8, 0x7e, 0x44, 0x5d, 0x33, 0x28, 0xd7, 0x01,
-  0x98, 0xc2, 0xc1, 0xd7, 0x31, 0xeb, 0x99, 0xef, 0xa8, 0x42, 0xa7, 0x9c,
-  0x54, 0x6b, 0xf2, 0x0a, 0xe1, 0x1c, 0xfe, 0xb0, 0xb5, 0xb1, 0xaa, 0x1b,
-  0xb9, 0x6d, 0xa1, 0x0f, 0xbd, 0xd2, 0x6c, 0x5e, 0xdb, 0x68, 0x74, 0x9b,
-  0x0d, 0x8a, 0x4c, 0x6f, 0x3f, 0xf7, 0x1b, 0xb0, 0x67, 0xb7, 0x4f, 0x7c,
-  0xb4, 0x58, 0x1e, 0x41, 0xc4, 0x67, 0xa2, 0xea, 0x01, 0x9f, 0x99, 0xcf,
-  0x15, 0xc2, 0xf0, 0xe9, 0x43, 0x7c, 0x1d, 0x2f, 0xaa, 0xb1, 0xe6, 0xeb,
-  0xd8, 0xf0, 0x75, 0x53, 0x2f, 0x86, 0x3f, 0xfd, 0x78, 0xdc, 0xc7, 0x08,
-  0xb4, 0x6d, 0xc1, 0xe1, 0xff, 0xe0, 0xbb, 0x37, 0xce, 0xcc, 0x83, 0x6a,
-  0xed, 0x52, 0x89, 0x91, 0x24, 0xce, 0x5e, 0x2f, 0x1d, 0x91, 0x17, 0x12,
-  0xbe, 0x2b, 0x84, 0x72, 0xf0, 0xb7, 0x6e, 0x50, 0x5a, 0x34, 0xeb, 0x2f,
-  0x0f, 0x96, 0xe5, 0x64, 0x0f, 0x1a, 0xda, 0x87, 0x65, 0x30, 0x45, 0xf0,
-  0x64, 0x41, 0xae, 0x6f, 0x06, 0xb6, 0x8b, 0x19, 0x74, 0x24, 0x80, 0x2d,
-  0xa8, 0x8b, 0xcb, 0xea, 0xc2, 0x6a, 0x01, 0x94, 0x98, 0x69, 0xd7, 0x35,
-  0xfe, 0xbb, 0x03, 0x66, 0x98, 0x19, 0x95, 0x4d, 0x87, 0x75, 0xc2, 0xa3,
-  0x26, 0x0c, 0xff, 0x30, 0xb7, 0x03, 0x86, 0xc8, 0x91, 0x5a, 0x10, 0xb5,
-  0xc4, 0x7f, 0xa2, 0x60, 0x5f, 0xfc, 0xe7, 0x14, 0x9d, 0xc4, 0x69, 0x92,
-  0x84, 0x66, 0xf8, 0x50, 0xb4, 0x14, 0x3a, 0xbc, 0x17, 0x73, 0x27, 0xc4,
-  0x96, 0x91, 0x12, 0xce, 0x41, 0xbb, 0xca, 0x54, 0x51, 0x1d, 0xee, 0xee,
-  0x24, 0xea, 0x38, 0x47, 0x5d, 0x56, 0xae, 0x2f, 0xad, 0xd0, 0xe9, 0xcf,
-  0x53, 0xdc, 0x63, 0x90, 0xd7, 0x17, 0xc8, 0x7d, 0x55, 0xd5, 0x17, 0xf6,
-  0x19, 0x81, 0x77, 0xc7, 0x49, 0x8e, 0x53, 0x6c, 0x83, 0xc2, 0x81, 0x75,
-  0xf5, 0x39, 0x30, 0x67, 0x97, 0x03, 0x6b, 0x37, 0x3d, 0x30, 0x63, 0xcd,
-  0xa2, 0x0c, 0x97, 0x79, 0x89, 0x81, 0x7a, 0x4c, 0xce, 0x83, 0x34, 0x6d,
-  0xe3, 0x6d, 0xea, 0x0b, 0xa4, 0x66, 0x88, 0xe1, 0x2f, 0xe1, 0x31, 0x47,
-  0x1c, 0xb2, 0x73, 0x7f, 0xc2, 0xf9, 0xb7, 0x79, 0xdd, 0x39, 0x17, 0x2f,
-  0x48, 0xa0, 0xae, 0x56, 0xea, 0x04, 0xab, 0x02, 0x75, 0x02, 0xf5, 0xc2,
-  0x9e, 0x0e, 0xd5, 0x4a, 0xf2, 0x94, 0x5b, 0x0e, 0xbc, 0x3b, 0x97, 0xc8,
-  0x07, 0x03, 0xb9, 0x2f, 0x7e, 0xc1, 0x92, 0xc9, 0x71, 0x86, 0xa4, 0xd3,
-  0xb3, 0xc1, 0x3d, 0xb0, 0x54, 0x3f, 0x69, 0x91, 0xf4, 0xfc, 0x4b, 0x1a,
-  0x87, 0xda, 0xee, 0x67, 0x11, 0x0d, 0xe8, 0x48, 0x66, 0x30, 0xad, 0x1e,
-  0x53, 0x2a, 0xaa, 0x23, 0xa5, 0x54, 0x2b, 0x76, 0x60, 0xc1, 0x7e, 0x33,
-  0x38, 0x4e, 0xa4, 0x41, 0x1d, 0x24, 0x4e, 0xf8, 0xcc, 0xc6, 0x0d, 0x9f,
-  0x99, 0x2b, 0x1f, 0xd5, 0x76, 0x2c, 0xcc, 0xc1, 0x3d, 0xd2, 0xe3, 0xa4,
-  0x58, 0x8e, 0xc3, 0x07, 0xb1, 0xa0, 0x02, 0x03, 0xe3, 0xbc, 0xc4, 0xbe,
-  0xa9, 0x36, 0x37, 0xb1, 0x3e, 0x9c, 0x2f, 0x40, 0xcd, 0x45, 0xa8, 0x0f,
-  0x97, 0x7b, 0x3d, 0xeb, 0x82, 0xcf, 0xc7, 0xa0, 0xd3, 0x67, 0xf7, 0xfc,
-  0xd1, 0x47, 0xa1, 0x93, 0xe8, 0xd8, 0x61, 0x9e, 0x8f, 0x28, 0x47, 0x49,
-  0xc1, 0xc9, 0x52, 0x80, 0x67, 0xae, 0xbc, 0xbc, 0xfb, 0x2f, 0xe3, 0x46,
-  0x25, 0xb0, 0x53, 0xcb, 0xc5, 0x25, 0x96, 0x3c, 0x7f, 0x72, 0x6c, 0xbe,
-  0xf2, 0x00, 0x5b, 0xde, 0x27, 0x31, 0x47, 0x9d, 0x12, 0xcd, 0x43, 0x96,
-  0xdc, 0x7a, 0x04, 0x18, 0xab, 0xdb, 0xbc, 0x08, 0xc9, 0xad, 0xa7, 0x7c,
-  0x5d, 0x98, 0xfc, 0xb8, 0x22, 0xb7, 0xde, 0xe4, 0x75, 0x96, 0x49, 0xef,
-  0xe5, 0x72, 0xeb, 0x65, 0x5d, 0x17, 0xa6, 0xbc, 0x63, 0xc8, 0xed, 0x37,
-  0x71, 0x5d, 0xb8, 0x96, 0xd5, 0x7f, 0xee, 0x3f, 0x6e, 0xeb, 0xca, 0x63,
-  0xd9, 0xca, 0xe7, 0xde, 0xeb, 0xb4, 0xae, 0x2c, 0xa6, 0xff, 0x73, 0xef,
-  0x75, 0x59, 0x36, 0x30, 0xde, 0x69, 0xe2, 0xa3, 0xd7, 0x87, 0xfb, 0xa3,
-  0xd7, 0x87, 0x87, 0xa3, 0xd7, 0xc7, 0x88, 0x8c, 0x5e, 0x1f, 0xa5, 0x73,
-  0xf4, 0xfa, 0x88, 0x5d, 0xa3, 0x37, 0xc0, 0xeb, 0x1a, 0xbd, 0x3e, 0x22,
-  0x5f, 0x0e, 0xe5, 0xa9, 0x73, 0x15, 0xd4, 0x41, 0x85, 0xdc, 0x5f, 0xb8,
-  0x77, 0x19, 0x01, 0x3f, 0xf8, 0x7a, 0x27, 0x38, 0x7f, 0x76, 0xf0, 0xb4,
-  0xc9, 0x8a, 0x6d, 0x76, 0x10, 0x60, 0xa0, 0xf9, 0xab, 0x63, 0x09, 0x1b,
-  0x60, 0xa0, 0x21, 0x8b, 0x77, 0xb5, 0x1e, 0xe0, 0xd0, 0x39, 0x4e, 0x6e,
-  0xce, 0xd8, 0x62, 0x38, 0xd6, 0xd9, 0xa5, 0x77, 0x90, 0x19, 0x43, 0x95,
-  0x93, 0x3f, 0xe7, 0x14, 0x30, 0xc0, 0x63, 0x9b, 0xab, 0xc0, 0xca, 0xd5,
-  0x67, 0x97, 0x2d, 0x3c, 0x42, 0x23, 0xd1, 0xb0, 0x76, 0x51, 0x4b, 0x02,
-  0x1b, 0xc2, 0x90, 0x79, 0xc6, 0x02, 0xd3, 0x33, 0xc7, 0x0c, 0x50, 0x03,
-  0x77, 0x20, 0xa1, 0x07, 0x8d, 0xa0, 0x97, 0x1d, 0x07, 0x1a, 0x71, 0xef,
-  0x12, 0x9d, 0x79, 0xaa, 0xb5, 0x93, 0xc5, 0xb8, 0x5f, 0x08, 0x5a, 0x16,
-  0xfa, 0x22, 0x88, 0xfb, 0x27, 0x08, 0xb9, 0xaf, 0x1e, 0x6d, 0x06, 0xcf,
-  0x1e, 0x83, 0x0e, 0xb0, 0x64, 0xad, 0xfb, 0x82, 0x30, 0x8a, 0x29, 0xb2,
-  0xd6, 0x7d, 0x8a, 0x17, 0xc5, 0x14, 0x59, 0xeb, 0xbe, 0x6a, 0x8b, 0x97,
-  0xc9, 0xb2, 0x36, 0x75, 0x1e, 0x2a, 0x47, 0x31, 0x95, 0xac, 0xf5, 0x5e,
-  0x90, 0x45, 0x71, 0x6d, 0x59, 0x1b, 0x79, 0x73, 0x15, 0xcd, 0x63, 0xcb,
-  0xda, 0xc8, 0x4b, 0xa5, 0x68, 0x1e, 0x4b, 0xd8, 0x06, 0x8f, 0x7c, 0x24,
-  0xf2, 0xfa, 0xb0, 0x37, 0x2f, 0xa7, 0x79, 0x5d, 0x4e, 0x8d, 0xc7, 0x61,
-  0xbc, 0x0d, 0x86, 0xc4, 0x2c, 0x27, 0x83, 0xb7, 0x5a, 0x39, 0x1f, 0x9e,
-  0xef, 0xec, 0xe0, 0xad, 0xe8, 0x1c, 0x35, 0x1d, 0xd4, 0xf2, 0x59, 0xd1,
-  0x49, 0x6a, 0xf7, 0xbc, 0x07, 0xb6, 0x60, 0x3d, 0x2f, 0x89, 0x4e, 0x3e,
-  0xf0, 0x10, 0x28, 0x7b, 0x9e, 0xa6, 0x87, 0xda, 0xb8, 0x0f, 0xfe, 0xbb,
-  0x1f, 0xbc, 0xb3, 0x1c, 0xa2, 0xe3, 0x79, 0x9b, 0xf1, 0x5e, 0x0c, 0x95,
-  0xbe, 0xb3, 0x7c, 0xa2, 0x23, 0xd0, 0x38, 0x2e, 0x56, 0x40, 0x76, 0x8b,
-  0x8e, 0x30, 0xed, 0xb2, 0xd8, 0x02, 0x89, 0x67, 0x74, 0x05, 0xd6, 0x1e,
-  0x8b, 0x15, 0x0a, 0x3b, 0x47, 0x47, 0xb0, 0x76, 0x54, 0xac, 0x40, 0xe2,
-  0x1f, 0x1d, 0x61, 0xc6, 0x49, 0xb1, 0x02, 0xb2, 0x33, 0x74, 0x3e, 0x1e,
-  0xac, 0x03, 0x90, 0xf2, 0x45, 0x2e, 0x70, 0xe3, 0x9d, 0x58, 0xe1, 0xb0,
-  0xcf, 0x74, 0x04, 0x6b, 0x3f, 0xc1, 0x0a, 0xa4, 0x5c, 0xa3, 0x23, 0xd0,
-  0x72, 0x58, 0xac, 0x69, 0x12, 0xef, 0xe8, 0x44, 0x91, 0xf1, 0x55, 0xac,
-  0x2b, 0xbf, 0x56, 0xd5, 0x5e, 0x7b, 0xc5, 0x8a, 0x37, 0x76, 0x2a, 0xd6,
-  0xf8, 0x2f, 0xd6, 0x0d, 0x22, 0xc7, 0xea, 0xd4, 0x20, 0xe5, 0x7a, 0x58,
-  0x81, 0x94, 0xe7, 0x74, 0x04, 0x5a, 0x7e, 0x87, 0x0d, 0xb9, 0xae, 0xf3,
-  0x74, 0x73, 0x64, 0xea, 0xb8, 0x1e, 0x76, 0xd1, 0x95, 0x73, 0x61, 0x0f,
-  0x59, 0x5f, 0xda, 0xbc, 0x73, 0x5c, 0xa8, 0x23, 0x96, 0xed, 0x69, 0x58,
-  0x97, 0x65, 0x79, 0x51, 0xa7, 0x92, 0x5c, 0x3f, 0xc3, 0x9a, 0x74, 0x3f,
-  0xd8, 0x11, 0x33, 0x21, 0x16, 0x2a, 0xca, 0xcf, 0xc2, 0xf1, 0x8e, 0x1c,
-  0x7c, 0x13, 0x23, 0x2a, 0x40, 0xc6, 0x90, 0x47, 0x2e, 0xae, 0x0a, 0x0f,
-  0xa5, 0x50, 0xc3, 0xa8, 0x47, 0x84, 0x1f, 0x8f, 0xe2, 0x24, 0xdb, 0x39,
-  0xda, 0xc9, 0x7c, 0xf7, 0xa4, 0x99, 0xd4, 0xe5, 0xba, 0x7d, 0xf6, 0xdd,
-  0x13, 0x74, 0x66, 0x08, 0x7f, 0xe6, 0xed, 0x72, 0xf1, 0xec, 0x7f, 0x00,
-  0x78, 0x36, 0xc5, 0x36, 0x8c, 0xf9, 0x00, 0x00
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x5c,
+  0xfd, 0x72, 0xdb, 0xb8, 0x11, 0x7f, 0x15, 0xf4, 0x66, 0x7a, 0x74, 0x66,
+  0x24, 0xcb, 0x92, 0x23, 0x7f, 0xa4, 0xb6, 0x6e, 0x12, 0x3b, 0xbe, 0x78,
+  0xc6, 0x49, 0xdc, 0xc8, 0x99, 0xeb, 0x7f, 0x1a, 0x88, 0x84, 0x44, 0xd6,
+  0x14, 0xc9, 0x03, 0x41, 0xc9, 0xbe, 0xbf, 0xfa, 0x16, 0x7d, 0x83, 0xbe,
+  0x48, 0xdf, 0xa4, 0x4f, 0xd2, 0x5d, 0x80, 0xdf, 0x04, 0x45, 0x52, 0x52,
+  0x2e, 0x33, 0xb1, 0x48, 0x10, 0xf8, 0xed, 0x02, 0xbb, 0x58, 0x2c, 0x76,
+  0x41, 0x5e, 0xfd, 0xc5, 0xf2, 0x4d, 0xf1, 0x1a, 0x30, 0x62, 0x8b, 0x95,
+  0x3b, 0xb9, 0x8a, 0xff, 0x32, 0x6a, 0x4d, 0xae, 0x56, 0x4c, 0x50, 0x62,
+  0xda, 0x94, 0x87, 0x4c, 0x5c, 0x1b, 0x91, 0x58, 0xf4, 0x2f, 0x8c, 0xb8,
+  0xd4, 0xa3, 0x2b, 0x76, 0x6d, 0xac, 0x1d, 0xb6, 0x09, 0x7c, 0x2e, 0x0c,
+  0x62, 0xfa, 0x9e, 0x60, 0x1e, 0xd4, 0xda, 0x38, 0x96, 0xb0, 0xaf, 0x2d,
+  0xb6, 0x76, 0x4c, 0xd6, 0x97, 0x37, 0x3d, 0xc7, 0x73, 0x84, 0x43, 0xdd,
+  0x7e, 0x68, 0x52, 0x97, 0x5d, 0x0f, 0x8b, 0x10, 0xa6, 0xef, 0xfa, 0x1c,
+  0x1e, 0xd9, 0x6c, 0xc5, 0x72, 0x30, 0xae, 0xb3, 0xb4, 0x05, 0xb1, 0x28,
+  0x7f, 0x86, 0xea, 0xc2, 0x11, 0x2e, 0x9b, 0x7c, 0x9c, 0x3e, 0x9e, 0x8e,
+  0xc8, 0xb7, 0xa7, 0xe9, 0x23, 0xf9, 0xec, 0x98, 0x64, 0xe1, 0x73, 0xf2,
+  0xc1, 0xe1, 0xd6, 0x97, 0x8f, 0x4f, 0xfd, 0x5f, 0xfd, 0xab, 0x81, 0xaa,
+  0x74, 0xe5, 0x3a, 0xde, 0x33, 0xe1, 0xcc, 0xbd, 0x36, 0x42, 0xf1, 0xea,
+  0xb2, 0xd0, 0x66, 0x0c, 0xd8, 0xb3, 0x39, 0x5b, 0x5c, 0x1b, 0x03, 0x1a,
+  0x04, 0xc7, 0x66, 0x18, 0xfe, 0xb2, 0xbe, 0x3e, 0x1b, 0xd3, 0xc5, 0xf8,
+  0xf4, 0xdc, 0x34, 0x87, 0x27, 0x27, 0xc3, 0xd1, 0xd9, 0x19, 0x50, 0x19,
+  0xa8, 0x4e, 0xcf, 0x7d, 0xeb, 0x75, 0x72, 0x65, 0x39, 0x6b, 0xe2, 0x58,
+  0xd7, 0x86, 0xbf, 0xe6, 0xc0, 0x95, 0x4b, 0xc3, 0x10, 0xaf, 0x19, 0x77,
+  0xe9, 0xab, 0xa1, 0x9e, 0xc6, 0x85, 0x73, 0xff, 0xc5, 0x48, 0x6a, 0xce,
+  0x56, 0xe1, 0xd2, 0x98, 0x7c, 0x63, 0xa1, 0xa0, 0x5c, 0x38, 0xde, 0xf2,
+  0x7f, 0xff, 0xfa, 0xcf, 0xd5, 0x00, 0xea, 0x4e, 0xe2, 0xbf, 0xb9, 0x66,
+  0x01, 0x5d, 0xb2, 0x22, 0x90, 0x49, 0xb9, 0x45, 0x84, 0x1f, 0x14, 0x4b,
+  0x6d, 0xc6, 0x7d, 0x55, 0x52, 0xa4, 0xca, 0xa9, 0x67, 0x15, 0x6b, 0xca,
+  0xfe, 0x2b, 0x56, 0xc4, 0x4c, 0xdd, 0x34, 0x0d, 0x99, 0x44, 0x0d, 0x03,
+  0xea, 0xa5, 0xb0, 0xd4, 0x5a, 0xc6, 0x18, 0x8b, 0xcd, 0x1a, 0xc7, 0x04,
+  0x9f, 0x6a, 0xd8, 0x0f, 0xa3, 0x79, 0x4c, 0x42, 0xb5, 0x57, 0x54, 0xb9,
+  0x08, 0x83, 0x99, 0x4b, 0xe7, 0xcc, 0x85, 0x51, 0x00, 0xa2, 0xef, 0xe2,
+  0xf6, 0xe4, 0x8a, 0xca, 0x1a, 0xf2, 0xb9, 0x13, 0xa4, 0x03, 0xba, 0xf2,
+  0x3d, 0x3f, 0x91, 0x0d, 0x3e, 0x7b, 0x37, 0x18, 0xb0, 0x30, 0x38, 0x1d,
+  0xad, 0x1c, 0xf3, 0xd8, 0xf5, 0x41, 0x5b, 0xde, 0x5d, 0x8c, 0xc7, 0x6f,
+  0x07, 0x34, 0xb2, 0x1c, 0xa8, 0x07, 0x83, 0xba, 0x44, 0x3d, 0x9c, 0xcd,
+  0x5d, 0xea, 0x81, 0x5a, 0x34, 0xb5, 0xb8, 0x1a, 0xd0, 0x1c, 0x77, 0x92,
+  0xf6, 0xca, 0xf2, 0xc2, 0xd9, 0x86, 0x53, 0x60, 0x41, 0x6a, 0x07, 0xb0,
+  0x00, 0xa0, 0x8e, 0xd7, 0x77, 0xd9, 0x42, 0xbc, 0xbb, 0x08, 0x5e, 0x0c,
+  0xe0, 0x35, 0xd7, 0x21, 0x9f, 0x1b, 0x13, 0x9f, 0xeb, 0x7a, 0x81, 0x48,
+  0x7f, 0x66, 0x3f, 0x0a, 0x82, 0xa8, 0x88, 0x03, 0x80, 0x40, 0xf1, 0x80,
+  0x3f, 0xc5, 0x83, 0x2d, 0x44, 0x10, 0x02, 0xe4, 0xd2, 0x11, 0x76, 0x34,
+  0x3f, 0x36, 0xfd, 0xd5, 0x60, 0x1a, 0x3d, 0x33, 0xf3, 0x8f, 0xc1, 0x1c,
+  0xa4, 0xef, 0x31, 0xb1, 0xf4, 0xfb, 0x92, 0x5c, 0x1f, 0x69, 0xf7, 0x81,
+  0x68, 0x85, 0xab, 0x04, 0x79, 0x69, 0x1b, 0x93, 0x5f, 0x1d, 0xf1, 0x29,
+  0x9a, 0x67, 0xc3, 0x99, 0xf4, 0x3a, 0x12, 0xcc, 0x4a, 0x15, 0x4e, 0xce,
+  0xdf, 0xc9, 0x13, 0xfe, 0x24, 0x62, 0xbf, 0x0a, 0x99, 0xcb, 0x4c, 0xa1,
+  0x6a, 0xe0, 0x83, 0x29, 0x2a, 0xc6, 0x95, 0x1f, 0x08, 0xc7, 0x57, 0x23,
+  0x0c, 0x97, 0xaa, 0xe5, 0x8c, 0x46, 0x02, 0x86, 0x66, 0x4d, 0xdd, 0x08,
+  0x84, 0x22, 0x6f, 0x26, 0xef, 0xe1, 0xef, 0xd5, 0x40, 0xd5, 0xae, 0x69,
+  0x25, 0xad, 0x44, 0xda, 0x4c, 0xdd, 0x4d, 0x1e, 0xf0, 0xa7, 0xa1, 0xa1,
+  0x34, 0x2c, 0x49, 0x3b, 0x65, 0x65, 0x6e, 0xe1, 0x6f, 0xd6, 0x6a, 0xa0,
+  0x78, 0x2f, 0x8e, 0x78, 0x65, 0xdc, 0xb9, 0xbf, 0xa9, 0x4e, 0x62, 0x28,
+  0xb1, 0x47, 0xf1, 0xb0, 0x80, 0x25, 0x10, 0x51, 0x68, 0x4c, 0xa6, 0xf2,
+  0x17, 0x4c, 0xcc, 0x08, 0xac, 0x19, 0x9d, 0xa3, 0xa1, 0x12, 0x1c, 0xfe,
+  0x5b, 0x49, 0xc3, 0xe7, 0x64, 0x20, 0x61, 0x7a, 0x4c, 0xee, 0x1f, 0xc9,
+  0x7b, 0xcb, 0xe2, 0x2c, 0x84, 0x16, 0xc2, 0xca, 0x57, 0x5b, 0xab, 0x6a,
+  0x58, 0x49, 0x3d, 0x1a, 0x48, 0x18, 0x3d, 0xd4, 0xc6, 0x59, 0x38, 0x33,
+  0x1e, 0x86, 0x8e, 0x31, 0xf9, 0xcd, 0xb9, 0x73, 0xc8, 0xb7, 0xe9, 0xf4,
+  0xbe, 0x06, 0x50, 0xd5, 0x6a, 0x09, 0x29, 0x5e, 0x62, 0xc0, 0xa7, 0x7f,
+  0x90, 0x47, 0x7f, 0xc3, 0x78, 0x0d, 0xe8, 0x06, 0x2b, 0x36, 0x63, 0x82,
+  0xd9, 0x85, 0xee, 0xdc, 0x71, 0xc6, 0xc8, 0x27, 0xb8, 0x24, 0x47, 0x2b,
+  0xc7, 0x7b, 0x53, 0x03, 0xa9, 0xea, 0x36, 0x63, 0x46, 0x20, 0x46, 0xd4,
+  0xc7, 0xef, 0xf2, 0xb7, 0x06, 0x2c, 0xa9, 0xd4, 0x0c, 0x27, 0xa7, 0x7c,
+  0xc8, 0x38, 0x2c, 0x00, 0xca, 0xb2, 0x91, 0xa9, 0xbc, 0xa9, 0x01, 0x0e,
+  0xf9, 0xba, 0x0d, 0xaa, 0xe9, 0x3a, 0xb0, 0xd6, 0x19, 0x93, 0x1b, 0xf9,
+  0x5b, 0x83, 0x95, 0x54, 0x6a, 0x86, 0x0b, 0x05, 0x67, 0x14, 0xc6, 0x6e,
+  0x89, 0xea, 0x16, 0x5f, 0xd6, 0x31, 0x28, 0x9f, 0xb7, 0x01, 0x0d, 0x9e,
+  0xa1, 0xf7, 0x54, 0xc0, 0x28, 0x3d, 0x52, 0xf3, 0x99, 0x09, 0xf2, 0x0d,
+  0x6e, 0xea, 0x94, 0x48, 0xd6, 0x6b, 0xc6, 0x84, 0x5b, 0xe8, 0xbc, 0xef,
+  0x79, 0x30, 0xc1, 0x60, 0xba, 0xc2, 0x9d, 0x5a, 0xa2, 0x6e, 0x54, 0x51,
+  0x0d, 0xba, 0x0b, 0x2d, 0x5a, 0xa3, 0x07, 0x72, 0x9d, 0x96, 0xd0, 0x6a,
+  0x2c, 0xe0, 0x07, 0xd6, 0xe4, 0x3a, 0x68, 0x55, 0x3d, 0x87, 0x3d, 0x88,
+  0x27, 0x69, 0x6e, 0x6a, 0x53, 0x13, 0x2d, 0x03, 0xcc, 0xe5, 0xab, 0x79,
+  0x24, 0x04, 0x58, 0x14, 0xdf, 0x03, 0xd9, 0x98, 0xcf, 0xd7, 0x3f, 0xc1,
+  0x93, 0x23, 0x43, 0x69, 0xc7, 0x4c, 0x2e, 0xfd, 0xc6, 0x9b, 0x9f, 0x24,
+  0xee, 0x7c, 0x06, 0x9a, 0x30, 0x43, 0xb6, 0x95, 0xba, 0x90, 0xaf, 0x5f,
+  0xae, 0x06, 0xaa, 0x75, 0x13, 0x0a, 0xf8, 0x01, 0x45, 0x90, 0xc5, 0x22,
+  0x43, 0xb9, 0xbb, 0x6b, 0x80, 0x01, 0xd3, 0xc1, 0xc0, 0x94, 0x8c, 0xc2,
+  0x0c, 0x44, 0x16, 0x49, 0xe7, 0x04, 0x84, 0x78, 0x3f, 0x9a, 0xd6, 0x23,
+  0x70, 0x36, 0xf7, 0x7d, 0xf1, 0xc5, 0xdf, 0x1c, 0xe5, 0x1a, 0x63, 0x11,
+  0xb6, 0xc6, 0xdf, 0xfa, 0xa6, 0x16, 0x5b, 0xd0, 0xc8, 0x15, 0x61, 0xa1,
+  0x71, 0x52, 0x98, 0xae, 0x29, 0x16, 0xac, 0x56, 0x38, 0x91, 0x6e, 0xe3,
+  0x07, 0x19, 0x5e, 0xe2, 0x75, 0x51, 0x6b, 0x9d, 0xd6, 0x5e, 0x00, 0x45,
+  0xe8, 0xb4, 0x5a, 0x6d, 0x6a, 0x2d, 0x71, 0xd9, 0xf0, 0xaa, 0x99, 0xfd,
+  0x04, 0x7f, 0xc9, 0xcf, 0xe4, 0x0b, 0x13, 0x1b, 0x1f, 0xad, 0xfb, 0x16,
+  0xf3, 0x5b, 0x70, 0x64, 0xb0, 0xf5, 0x2c, 0x7c, 0xf5, 0xcc, 0x19, 0xf3,
+  0x62, 0x94, 0x29, 0xdc, 0xa5, 0xeb, 0x5a, 0x6e, 0x15, 0xb4, 0x99, 0x1b,
+  0xc4, 0xb6, 0x29, 0x6b, 0x66, 0x4c, 0x7e, 0x49, 0x57, 0xec, 0xb2, 0xc6,
+  0x15, 0xd8, 0x5e, 0x38, 0xcc, 0x45, 0xbe, 0x73, 0x2b, 0x25, 0x5c, 0xe6,
+  0x81, 0x92, 0xf5, 0x2b, 0x5e, 0xab, 0x50, 0x99, 0x50, 0x8b, 0x4a, 0xab,
+  0x5b, 0xf2, 0x14, 0xb5, 0x44, 0xaa, 0x47, 0x65, 0x1d, 0x8b, 0x45, 0x25,
+  0x45, 0x22, 0xbc, 0x5c, 0x0f, 0x51, 0x2d, 0x32, 0x09, 0xc2, 0xdd, 0xfa,
+  0xc8, 0xc8, 0xe8, 0xf7, 0x0a, 0xec, 0x1c, 0x4b, 0x3a, 0x6f, 0x7e, 0x02,
+  0x4d, 0xcc, 0x69, 0x41, 0x2c, 0x92, 0xdc, 0xc4, 0x54, 0xe6, 0xc0, 0xdf,
+  0xe4, 0xc8, 0xd8, 0x0e, 0x58, 0xb1, 0xc4, 0xeb, 0xb2, 0x9c, 0x10, 0xa7,
+  0xdc, 0x3b, 0xcf, 0xf7, 0xd0, 0x62, 0xe0, 0xf0, 0xf8, 0x2e, 0x8e, 0xd7,
+  0xb5, 0x31, 0x2a, 0xf9, 0xbf, 0xb2, 0x99, 0x94, 0xca, 0x8b, 0x28, 0xc3,
+  0xe9, 0x48, 0x6b, 0x6d, 0x42, 0x6e, 0x3c, 0x51, 0x8e, 0x24, 0x59, 0x8e,
+  0xb5, 0xd6, 0x20, 0x3f, 0xf8, 0xed, 0xac, 0x8d, 0xaa, 0xac, 0xac, 0x8d,
+  0x54, 0x13, 0xbd, 0x95, 0xc9, 0xaa, 0xb6, 0xc0, 0x45, 0x27, 0x30, 0xd6,
+  0xe2, 0x5b, 0xb9, 0x99, 0x22, 0x0f, 0x58, 0x44, 0x9e, 0x74, 0xeb, 0x19,
+  0x51, 0x1e, 0xa8, 0xa4, 0x92, 0x6b, 0xd8, 0x62, 0x9d, 0x14, 0x66, 0x5c,
+  0xf7, 0xfb, 0xd3, 0x4d, 0x23, 0x76, 0x56, 0x7b, 0x0b, 0x72, 0x61, 0x22,
+  0x81, 0x42, 0x4a, 0xb3, 0x23, 0xa7, 0xd0, 0x57, 0x79, 0xd3, 0x34, 0x89,
+  0x92, 0x26, 0xfb, 0xcd, 0xa0, 0x04, 0x25, 0x9e, 0x20, 0x93, 0xfe, 0x70,
+  0x54, 0x9e, 0x34, 0x50, 0x36, 0xd4, 0x94, 0x9d, 0x54, 0xcb, 0x2e, 0xab,
+  0x45, 0x17, 0xd5, 0xa2, 0xf3, 0x6a, 0xd1, 0x59, 0xb5, 0x68, 0x5c, 0x2d,
+  0x7a, 0x5b, 0x2d, 0x3a, 0xad, 0x16, 0xe9, 0xf8, 0xaf, 0xd8, 0x01, 0x35,
+  0x0a, 0xcc, 0x9a, 0x54, 0x7b, 0x51, 0xed, 0x6b, 0x15, 0xb1, 0x4a, 0xb6,
+  0xca, 0x5b, 0xb5, 0x03, 0xd5, 0x5e, 0x56, 0x87, 0xa2, 0x3a, 0x5e, 0xd5,
+  0x41, 0xd5, 0x0c, 0xbd, 0x46, 0x42, 0x79, 0x41, 0xa6, 0xd6, 0x2d, 0xaf,
+  0x4c, 0x91, 0xe7, 0x80, 0xe0, 0xed, 0x44, 0x7d, 0x4a, 0x86, 0x4f, 0x29,
+  0x46, 0xd5, 0xea, 0x29, 0xe5, 0x3c, 0xea, 0x60, 0xdb, 0x62, 0xa4, 0x83,
+  0x18, 0xb6, 0x3c, 0x56, 0xb3, 0x55, 0x2b, 0x4c, 0x31, 0xe5, 0xcb, 0xcd,
+  0x30, 0x82, 0x62, 0xc9, 0xe5, 0x2a, 0x71, 0x78, 0xb0, 0x20, 0x72, 0x59,
+  0xd3, 0x7c, 0xab, 0xb4, 0xdf, 0x6f, 0xe2, 0x55, 0xe0, 0x7e, 0xd0, 0x02,
+  0x56, 0xa2, 0xa3, 0x5d, 0xc6, 0xf2, 0x75, 0xd4, 0x4a, 0x56, 0x6a, 0xd5,
+  0x79, 0x3d, 0x2b, 0x53, 0x3d, 0x88, 0xf0, 0xb5, 0xa0, 0x3b, 0x6a, 0x81,
+  0x74, 0x3f, 0x27, 0x45, 0x9f, 0xb7, 0x9d, 0xfc, 0x55, 0xcb, 0x8e, 0xc2,
+  0x77, 0xbc, 0x20, 0x52, 0xb2, 0x77, 0xbc, 0x22, 0x12, 0xc1, 0x98, 0xa2,
+  0x5a, 0x4c, 0x71, 0x80, 0x58, 0x70, 0x6d, 0x9c, 0x9d, 0x18, 0xb5, 0x62,
+  0xc4, 0x36, 0x55, 0x19, 0xaa, 0x7e, 0x24, 0x9a, 0x8c, 0x8b, 0x08, 0x0a,
+  0x55, 0x79, 0xd8, 0x9d, 0x65, 0x26, 0x49, 0x1c, 0x54, 0x60, 0x19, 0xe2,
+  0xae, 0xd2, 0xc2, 0x70, 0x5f, 0x2a, 0x2c, 0x3f, 0x68, 0x2d, 0x2b, 0x6c,
+  0x77, 0x10, 0x51, 0x01, 0x50, 0x57, 0x49, 0xf9, 0x41, 0x5b, 0x41, 0xc9,
+  0x4d, 0x4c, 0x77, 0x39, 0x01, 0x81, 0xc3, 0x8a, 0x29, 0x01, 0x6c, 0xed,
+  0x2f, 0x16, 0x66, 0x24, 0xc6, 0x70, 0x80, 0x6e, 0xd2, 0xb9, 0xed, 0xce,
+  0xa3, 0xae, 0x65, 0x5b, 0xad, 0xb0, 0x18, 0x83, 0xa1, 0x75, 0xe5, 0x5f,
+  0x69, 0xb2, 0xc0, 0xf3, 0x63, 0x01, 0x99, 0x62, 0x09, 0x39, 0xfa, 0x1a,
+  0x89, 0xd0, 0xb1, 0x18, 0xf9, 0xcd, 0xf1, 0x2c, 0x7f, 0xf3, 0xa6, 0x49,
+  0x55, 0xaa, 0x60, 0xfb, 0xd9, 0xf5, 0x2a, 0xde, 0x0f, 0x32, 0xec, 0x65,
+  0x42, 0x55, 0x65, 0xc3, 0x51, 0x91, 0x83, 0x22, 0x45, 0xd2, 0x65, 0xc9,
+  0xae, 0x60, 0x1f, 0x44, 0xcf, 0xf4, 0xa8, 0xad, 0x95, 0x2d, 0xdf, 0x5c,
+  0x29, 0x4c, 0x4e, 0xec, 0x5b, 0x95, 0xad, 0xda, 0xb2, 0x99, 0x9a, 0x0c,
+  0x5c, 0x4f, 0x56, 0xb7, 0x5f, 0xa6, 0xbb, 0xe9, 0x81, 0x6a, 0xff, 0x83,
+  0x64, 0x2f, 0xe3, 0xf3, 0xba, 0x95, 0x5c, 0x3e, 0x60, 0x1e, 0x6e, 0xdd,
+  0xd5, 0x42, 0x8e, 0x05, 0x6d, 0x57, 0xef, 0xd2, 0x94, 0xc3, 0xbe, 0x93,
+  0x4f, 0x7e, 0x28, 0x30, 0x01, 0xb5, 0x8b, 0xf1, 0x94, 0xcc, 0xd8, 0x00,
+  0x60, 0x90, 0x15, 0x7d, 0x71, 0x99, 0xb7, 0x14, 0xf6, 0xb5, 0x71, 0x3a,
+  0x32, 0x08, 0xa8, 0x8f, 0xc9, 0x6c, 0xdf, 0xb5, 0x18, 0xbf, 0x36, 0x92,
+  0x80, 0x7e, 0x9f, 0x0e, 0xe7, 0x23, 0xf3, 0x54, 0x13, 0x38, 0xc2, 0xbe,
+  0x7d, 0xa3, 0x9b, 0xb8, 0x7b, 0x76, 0xcc, 0x92, 0xd1, 0xcb, 0xd3, 0xd8,
+  0xad, 0x93, 0x45, 0x3b, 0x86, 0xe1, 0x62, 0x19, 0x61, 0x3b, 0xba, 0x7f,
+  0x7c, 0xa3, 0xeb, 0xb1, 0x4a, 0x6c, 0x44, 0xdc, 0xad, 0x66, 0x67, 0xca,
+  0xd9, 0x0a, 0x95, 0x8d, 0x68, 0x49, 0x58, 0x29, 0x8b, 0x22, 0x8d, 0xc3,
+  0xae, 0x25, 0x9e, 0x5a, 0x40, 0xa4, 0x9f, 0x65, 0x68, 0xf2, 0x5c, 0x69,
+  0xb2, 0x2d, 0x7a, 0xbe, 0x72, 0x06, 0x6e, 0xc7, 0x38, 0x5e, 0xb6, 0xfb,
+  0xcf, 0xe2, 0x6f, 0x18, 0x70, 0xf0, 0x30, 0xd4, 0x2f, 0x83, 0x07, 0x72,
+  0x2f, 0xfb, 0xc5, 0xdf, 0x34, 0xc4, 0xe0, 0x54, 0xf4, 0x9d, 0x25, 0x71,
+  0xce, 0x14, 0xad, 0x54, 0x3e, 0xf9, 0x96, 0x5c, 0x82, 0x65, 0xef, 0xdf,
+  0x39, 0xf5, 0xa8, 0x50, 0x6d, 0xe1, 0xf0, 0xd5, 0x17, 0x26, 0x64, 0x10,
+  0x2f, 0x0b, 0xb0, 0x79, 0xb0, 0x73, 0x50, 0xe1, 0xbd, 0x72, 0x84, 0x4d,
+  0x45, 0xfb, 0x4a, 0xb8, 0x2d, 0x23, 0x68, 0x2a, 0x5b, 0x35, 0x79, 0xaf,
+  0x52, 0x50, 0x6d, 0x23, 0x67, 0x2a, 0x06, 0x3c, 0xa5, 0xab, 0x00, 0x56,
+  0x4a, 0x15, 0x2b, 0xde, 0xbe, 0x4e, 0xa9, 0x06, 0xe9, 0xda, 0xa4, 0x35,
+  0xb2, 0x58, 0x67, 0xab, 0xa9, 0xce, 0x4d, 0x87, 0x6e, 0x53, 0x59, 0x52,
+  0x8f, 0x1d, 0x20, 0x2f, 0x5a, 0xcd, 0x61, 0xd0, 0x62, 0x17, 0x68, 0x78,
+  0x72, 0x72, 0x02, 0xf3, 0xdb, 0x01, 0xe3, 0x7f, 0xa1, 0x2e, 0xe9, 0xcb,
+  0xb5, 0x71, 0x79, 0x86, 0xd7, 0xba, 0xfd, 0xe6, 0xa7, 0x3f, 0x6a, 0x36,
+  0x9c, 0x92, 0x79, 0x9d, 0x4d, 0x93, 0xb4, 0x7b, 0x31, 0x13, 0x9d, 0x77,
+  0x22, 0x8d, 0x63, 0xd2, 0x7a, 0xf9, 0xca, 0x90, 0x3a, 0x7a, 0xb1, 0x4b,
+  0xea, 0x80, 0xdd, 0xff, 0x15, 0xfe, 0x36, 0x09, 0x59, 0xd5, 0xdc, 0xc7,
+  0x61, 0x95, 0x08, 0x5a, 0x41, 0x9d, 0x1c, 0x0f, 0x63, 0x39, 0xa9, 0x2b,
+  0x14, 0xd3, 0xb0, 0x46, 0x48, 0xff, 0xfd, 0x77, 0x8d, 0x90, 0x10, 0x5e,
+  0x2b, 0x24, 0x49, 0xb7, 0x17, 0x33, 0xd0, 0x59, 0x48, 0x12, 0xf6, 0x20,
+  0x42, 0xca, 0x90, 0x3a, 0x0a, 0xc9, 0x0e, 0x60, 0xf1, 0xfd, 0xe4, 0x2c,
+  0xed, 0x7e, 0x40, 0x31, 0x9f, 0xb8, 0x5d, 0x50, 0xb2, 0xf6, 0x7e, 0x8e,
+  0xa2, 0x1d, 0x18, 0xcd, 0x0e, 0xc0, 0x76, 0xf7, 0xa1, 0xce, 0x3d, 0xb0,
+  0x03, 0xad, 0x8c, 0xa0, 0x38, 0xef, 0x1a, 0xd8, 0x41, 0x67, 0x39, 0x41,
+  0xb7, 0x0f, 0x23, 0xa6, 0x14, 0xa8, 0xbb, 0x94, 0x66, 0x66, 0x84, 0x66,
+  0xe4, 0xf1, 0x8e, 0xdc, 0x44, 0x02, 0x46, 0xac, 0x85, 0xa8, 0x54, 0x93,
+  0x7d, 0xa6, 0x15, 0x0c, 0x9d, 0x29, 0xa9, 0xd5, 0x19, 0xc1, 0x78, 0x6a,
+  0x0d, 0x4f, 0xb2, 0x99, 0xd5, 0xd5, 0x00, 0xc6, 0x8c, 0xd6, 0x89, 0x2e,
+  0xa6, 0xdf, 0xcb, 0x73, 0xb3, 0x93, 0x00, 0x91, 0xc6, 0xc1, 0x84, 0x98,
+  0x82, 0x75, 0x14, 0xe4, 0x3c, 0x02, 0x55, 0xff, 0x10, 0x2d, 0x16, 0x8c,
+  0x93, 0xa9, 0xf3, 0x47, 0xe3, 0xf2, 0x27, 0xeb, 0xef, 0x37, 0xe1, 0x24,
+  0x44, 0x1a, 0xd3, 0x1d, 0x57, 0xa3, 0xb1, 0xe3, 0x6a, 0xec, 0x3b, 0x0b,
+  0x14, 0x0f, 0x4f, 0x46, 0xd5, 0x18, 0xef, 0xe8, 0xe4, 0x6d, 0x35, 0x60,
+  0xfb, 0xf6, 0xe4, 0xb2, 0x8a, 0x7d, 0x31, 0xbc, 0x6c, 0x17, 0x8f, 0x0d,
+  0xa5, 0x4b, 0x10, 0xd6, 0xe8, 0x08, 0xf4, 0x41, 0xab, 0x1f, 0x73, 0x39,
+  0x92, 0x6a, 0x5e, 0xc3, 0x75, 0x67, 0xbd, 0x40, 0xdc, 0x83, 0xe8, 0x44,
+  0x0a, 0xd4, 0xda, 0xf7, 0x76, 0x61, 0x59, 0xf5, 0x4c, 0x99, 0x85, 0x96,
+  0x17, 0xb5, 0x59, 0x21, 0xd1, 0x3e, 0x42, 0xe0, 0xb2, 0x35, 0x1e, 0xa1,
+  0x99, 0x3a, 0x4b, 0x8f, 0xba, 0xe4, 0x01, 0xef, 0x9a, 0x14, 0x2c, 0x6e,
+  0x52, 0xaf, 0x62, 0x8a, 0x0b, 0x55, 0x4b, 0x3f, 0x88, 0xf2, 0xe1, 0x61,
+  0x86, 0x31, 0x07, 0xd5, 0x7a, 0x20, 0x03, 0xee, 0x2f, 0x1c, 0x3c, 0x6a,
+  0xf6, 0xa8, 0x2e, 0x6a, 0xba, 0x90, 0x56, 0xd3, 0xb8, 0xff, 0x8d, 0xce,
+  0x6e, 0xc0, 0xf8, 0x02, 0xdd, 0x65, 0xd7, 0xa1, 0x73, 0xc7, 0x75, 0xc4,
+  0x6b, 0x7b, 0x8f, 0x37, 0x3b, 0xac, 0x44, 0xd0, 0x95, 0x5f, 0x33, 0xfe,
+  0xda, 0x24, 0x13, 0xd5, 0x64, 0xf7, 0x59, 0x0f, 0xa6, 0x52, 0x41, 0xfc,
+  0xa0, 0x6d, 0x38, 0x82, 0x6b, 0xa7, 0xa3, 0x7c, 0xc0, 0xe3, 0x5e, 0x4a,
+  0x93, 0x8d, 0x25, 0x9d, 0x67, 0xa5, 0x84, 0x39, 0x88, 0x3e, 0x65, 0x48,
+  0x1d, 0xed, 0xb4, 0xb0, 0xf9, 0x6c, 0xe5, 0x5b, 0xf2, 0xc8, 0x1a, 0xec,
+  0x9d, 0x70, 0xcf, 0x4e, 0x3e, 0xc3, 0x7d, 0x63, 0x8a, 0x3f, 0x6d, 0xb7,
+  0x97, 0xf8, 0x32, 0x98, 0x92, 0x90, 0xb6, 0x1c, 0x7d, 0x8b, 0x6b, 0xac,
+  0xa8, 0x17, 0x51, 0x98, 0xab, 0x9f, 0xe5, 0x6f, 0x8b, 0x4c, 0xbf, 0xcd,
+  0x91, 0x92, 0x3e, 0xcf, 0x9f, 0xb0, 0xd1, 0xcb, 0xf1, 0xd4, 0x3d, 0xc9,
+  0x1f, 0x53, 0x38, 0x4c, 0x8a, 0x3f, 0xe6, 0xa2, 0x5e, 0xaa, 0x79, 0xba,
+  0x87, 0xa3, 0xd9, 0x4c, 0x6e, 0x95, 0xec, 0x17, 0xb7, 0xab, 0x55, 0x7a,
+  0x00, 0x98, 0xa4, 0x9a, 0xd5, 0x42, 0xa9, 0xf6, 0x73, 0xe3, 0x10, 0x40,
+  0xef, 0xc0, 0xc5, 0xfe, 0xdb, 0x38, 0x76, 0xdf, 0x46, 0x35, 0xce, 0x5b,
+  0xf0, 0x2c, 0x06, 0x75, 0x6b, 0x33, 0x8e, 0x8e, 0x36, 0x26, 0x97, 0x8c,
+  0x47, 0xac, 0x3c, 0x7b, 0x45, 0xaa, 0x36, 0x56, 0x9a, 0x08, 0xf9, 0x8d,
+  0x0a, 0xd3, 0xb6, 0xfc, 0xba, 0xb3, 0x6b, 0x1b, 0x2b, 0x3d, 0x55, 0xd9,
+  0x3a, 0xdd, 0xa2, 0x02, 0xd6, 0x49, 0x04, 0xdf, 0x22, 0x32, 0x2e, 0xd2,
+  0x98, 0x6c, 0xd9, 0x37, 0x6c, 0x8e, 0x5b, 0xca, 0x1d, 0x43, 0xe5, 0x99,
+  0x7f, 0xd6, 0x2e, 0x19, 0xaa, 0x0f, 0x94, 0x63, 0x0a, 0x54, 0x3e, 0x51,
+  0xd1, 0xa1, 0x5e, 0xc2, 0x50, 0xf7, 0xb4, 0xe7, 0xe1, 0x82, 0xe5, 0x9d,
+  0x22, 0xe4, 0xc5, 0x3d, 0x92, 0x1f, 0xf1, 0x30, 0x89, 0x69, 0xbd, 0x5f,
+  0x08, 0xc6, 0x1b, 0xb7, 0x48, 0xaa, 0xc5, 0x5e, 0x1b, 0x24, 0x09, 0xb1,
+  0x75, 0x6e, 0xa5, 0x41, 0x87, 0xb3, 0x0b, 0xa3, 0xcb, 0x49, 0x04, 0x09,
+  0xad, 0x8f, 0x0c, 0xc9, 0xe3, 0x7b, 0x8a, 0x74, 0x2f, 0x61, 0xa2, 0xfb,
+  0x9e, 0x48, 0xe2, 0x1f, 0x66, 0x47, 0x94, 0x41, 0x75, 0x14, 0xda, 0x82,
+  0xd3, 0x25, 0x1e, 0xee, 0xa5, 0xcb, 0x15, 0xf3, 0x60, 0xda, 0xa2, 0x9e,
+  0xbf, 0x77, 0x59, 0x73, 0x5a, 0x5a, 0x35, 0xdc, 0x47, 0x74, 0x12, 0x61,
+  0xab, 0xe4, 0xd2, 0xa8, 0xde, 0xa5, 0x56, 0x70, 0x7f, 0xad, 0x11, 0x1c,
+  0x02, 0xeb, 0x77, 0xb3, 0x8c, 0x06, 0xea, 0x29, 0xc5, 0x2e, 0x4a, 0xd9,
+  0xe1, 0x6d, 0x67, 0xd1, 0x49, 0x8c, 0x83, 0x48, 0x2e, 0x43, 0x6a, 0x6d,
+  0x8a, 0x65, 0x2f, 0xe0, 0x8f, 0x2b, 0x6c, 0xd8, 0xd5, 0xe3, 0x89, 0xec,
+  0x4f, 0xf2, 0x66, 0xcb, 0x91, 0xec, 0xb4, 0x7a, 0x8b, 0xa3, 0x78, 0x34,
+  0x7c, 0x9e, 0x99, 0x41, 0x64, 0x4c, 0x6e, 0x1e, 0xbf, 0x93, 0x01, 0x79,
+  0x82, 0xfb, 0xb0, 0x4e, 0xbc, 0xb2, 0x49, 0xda, 0xa0, 0xea, 0xc6, 0xe7,
+  0xfa, 0x8a, 0xb5, 0xd4, 0xdb, 0x33, 0x2d, 0xbb, 0xe9, 0xad, 0xf1, 0x5c,
+  0x3e, 0x13, 0xf8, 0xa2, 0x4e, 0x48, 0xee, 0xe0, 0x69, 0x5d, 0x0f, 0xa1,
+  0xa6, 0x5c, 0x72, 0xc2, 0x8e, 0x7b, 0x8b, 0xc9, 0xe7, 0xbf, 0x3f, 0x3d,
+  0x91, 0x9f, 0xc9, 0x27, 0x7f, 0xc5, 0xc8, 0xfb, 0x30, 0x74, 0x00, 0x04,
+  0xcf, 0x79, 0x6f, 0xdb, 0x59, 0x60, 0x93, 0x1d, 0x13, 0x73, 0xbf, 0x0b,
+  0xf1, 0x23, 0x0e, 0xdc, 0x94, 0x57, 0x7d, 0x45, 0x26, 0x97, 0x89, 0x53,
+  0x05, 0x3b, 0x26, 0xe3, 0x3e, 0x70, 0xff, 0x99, 0x71, 0x99, 0x8e, 0x1b,
+  0xdc, 0x3f, 0xee, 0x94, 0x8d, 0x43, 0xfa, 0x2a, 0x1b, 0x17, 0x1f, 0x64,
+  0x60, 0x2f, 0xa2, 0x94, 0x8a, 0x1b, 0x5e, 0x8e, 0x8e, 0xc1, 0x3c, 0x1f,
+  0x0f, 0x8f, 0x87, 0x27, 0xc4, 0xe7, 0x04, 0xdb, 0xa8, 0xf7, 0x6c, 0xf4,
+  0x59, 0xb9, 0xcf, 0xf0, 0x1c, 0x59, 0x3a, 0xda, 0xb5, 0x3f, 0x8f, 0xbe,
+  0xee, 0xb0, 0x79, 0xcb, 0xce, 0xa8, 0x37, 0xea, 0x8a, 0x86, 0xab, 0xb0,
+  0xd2, 0x9c, 0x8d, 0xc7, 0xa7, 0xe3, 0xcc, 0x98, 0xd5, 0x76, 0x01, 0xb9,
+  0xe8, 0xde, 0x85, 0xef, 0x21, 0xe3, 0x3b, 0xa7, 0x46, 0x91, 0xff, 0x28,
+  0x64, 0xbc, 0x28, 0x0c, 0xdc, 0xd5, 0x98, 0x3e, 0x06, 0x80, 0x04, 0x94,
+  0x45, 0x31, 0x81, 0x7a, 0xc6, 0x91, 0x85, 0xee, 0x8c, 0x3f, 0xc2, 0xc5,
+  0xc6, 0xe7, 0xd6, 0xee, 0x03, 0x0f, 0xcf, 0x13, 0xc6, 0x83, 0x18, 0xac,
+  0xcc, 0xbc, 0x19, 0x71, 0x0e, 0x2b, 0x59, 0x3f, 0x7b, 0x5e, 0xd0, 0xb4,
+  0x07, 0x46, 0xd7, 0x8c, 0xb0, 0x55, 0x20, 0x5e, 0x89, 0xf0, 0xc9, 0x33,
+  0xe6, 0xf0, 0x41, 0xe1, 0x4c, 0x97, 0x51, 0xbe, 0x45, 0x50, 0x00, 0xd6,
+  0xbd, 0xbf, 0x4f, 0x7e, 0xe0, 0x98, 0xe4, 0x91, 0xb3, 0x85, 0xf3, 0xb2,
+  0x73, 0x9f, 0x05, 0x82, 0x6c, 0x99, 0x3a, 0x49, 0x16, 0x7b, 0xa0, 0x5e,
+  0xe9, 0xac, 0xef, 0x83, 0xe4, 0xa6, 0x7b, 0x27, 0x6e, 0x9d, 0x50, 0x85,
+  0x13, 0xf6, 0xed, 0x88, 0x95, 0x00, 0x6d, 0xe9, 0x8c, 0x0d, 0x96, 0x98,
+  0x26, 0x86, 0xb8, 0xbe, 0x2b, 0x29, 0x4f, 0xdd, 0xbb, 0xa3, 0xde, 0xe5,
+  0x21, 0xf7, 0xb7, 0x3b, 0xf7, 0x43, 0xbd, 0xf0, 0x33, 0x73, 0xac, 0x16,
+  0x42, 0xe9, 0xbf, 0xc0, 0xbf, 0xfa, 0x7e, 0x28, 0x66, 0xee, 0xad, 0x1d,
+  0xa6, 0x52, 0x34, 0x77, 0x9d, 0xd0, 0x26, 0xf7, 0x1e, 0xb8, 0xd9, 0x6b,
+  0x0c, 0x33, 0xec, 0xd8, 0x1b, 0x27, 0x06, 0xd0, 0xdb, 0xb3, 0xc4, 0x01,
+  0x3b, 0x3d, 0xc3, 0x0c, 0x6b, 0x66, 0xcf, 0x34, 0xe1, 0xe3, 0x92, 0x2f,
+  0x56, 0xee, 0x6a, 0xc2, 0xe8, 0x0e, 0x0a, 0xc8, 0x5c, 0x41, 0x49, 0xdc,
+  0xe1, 0x3d, 0x96, 0x5e, 0x0b, 0x71, 0xfe, 0x94, 0xd5, 0x57, 0x51, 0xea,
+  0x15, 0x29, 0xef, 0xb8, 0xfe, 0xde, 0x45, 0xae, 0x2b, 0x0f, 0x19, 0x31,
+  0xf2, 0x51, 0x85, 0x2e, 0x77, 0x14, 0xf4, 0x02, 0x80, 0x66, 0x2c, 0x3f,
+  0xff, 0xb4, 0x4b, 0xd7, 0xb0, 0x49, 0xd0, 0x81, 0x12, 0x04, 0x6b, 0x12,
+  0x38, 0x32, 0xfe, 0x71, 0xb7, 0x39, 0xfa, 0x99, 0x85, 0x21, 0x5d, 0x32,
+  0x7c, 0xa1, 0x8d, 0x48, 0xab, 0xb5, 0x87, 0xd4, 0x57, 0xe1, 0x32, 0x00,
+  0x9c, 0x3f, 0x45, 0xee, 0x09, 0xad, 0x5e, 0x99, 0xfa, 0x8e, 0xb2, 0x7f,
+  0xa4, 0xaf, 0xae, 0x4f, 0xad, 0x38, 0x4f, 0x55, 0xff, 0xda, 0x87, 0x24,
+  0x35, 0x7f, 0x15, 0xac, 0x21, 0xe4, 0x22, 0xdd, 0xdd, 0xad, 0x07, 0xd6,
+  0x94, 0x81, 0xf3, 0xbd, 0xed, 0x2f, 0xf2, 0xa9, 0x37, 0x69, 0x3e, 0x72,
+  0xee, 0xf3, 0x46, 0xb6, 0x18, 0xe7, 0x7b, 0xbe, 0xb8, 0x57, 0x5a, 0x3c,
+  0x60, 0x14, 0xbf, 0xb1, 0x7e, 0xac, 0x85, 0x24, 0x5d, 0x09, 0x3a, 0x1f,
+  0x9f, 0x11, 0x36, 0xe3, 0x2b, 0xf4, 0x2f, 0x9f, 0xd4, 0x45, 0x87, 0x97,
+  0xcf, 0xb0, 0x01, 0x66, 0x3d, 0x84, 0x3c, 0x1f, 0xf4, 0x15, 0xc8, 0xc3,
+  0xf6, 0x4a, 0xc0, 0xfa, 0x28, 0x4b, 0xa0, 0x2f, 0xcd, 0xf1, 0xc4, 0x02,
+  0xc2, 0x9e, 0x6f, 0xd2, 0xd8, 0x89, 0xbb, 0xff, 0xa3, 0xd2, 0x0d, 0x19,
+  0x85, 0xb2, 0xda, 0x67, 0x4f, 0x7a, 0x05, 0x56, 0x76, 0x08, 0x51, 0xe3,
+  0x88, 0xe0, 0x76, 0x31, 0x1d, 0x96, 0xfd, 0x83, 0xc6, 0x15, 0xc8, 0xce,
+  0x39, 0x08, 0x44, 0x70, 0x9d, 0x15, 0xda, 0xbd, 0xa9, 0x1d, 0x09, 0xcb,
+  0xdf, 0x78, 0xe4, 0x01, 0xef, 0xdb, 0x49, 0x38, 0x6e, 0xba, 0xb7, 0x7c,
+  0x63, 0x9c, 0xf4, 0x2d, 0xa0, 0xea, 0x7b, 0x38, 0xa7, 0x63, 0x4d, 0x3a,
+  0xb8, 0x5a, 0x54, 0xad, 0x35, 0xae, 0xd6, 0x1a, 0x6b, 0xde, 0x20, 0xaa,
+  0xd6, 0x3a, 0xab, 0xd6, 0x3a, 0xaf, 0xd6, 0x3a, 0x1f, 0xd7, 0x67, 0xb6,
+  0x2f, 0xaa, 0xd5, 0x2f, 0xaa, 0xa0, 0x97, 0xd5, 0x5a, 0x97, 0xe3, 0x56,
+  0x19, 0xed, 0x9f, 0x2d, 0xb6, 0xfc, 0xdb, 0x4d, 0xdd, 0x6b, 0x46, 0xc9,
+  0xa8, 0x6a, 0x54, 0x5a, 0x3d, 0xe8, 0xe5, 0x07, 0x7f, 0x1f, 0x85, 0x8e,
+  0xe9, 0x1c, 0x4e, 0x9d, 0x13, 0x75, 0x68, 0xfb, 0x72, 0xa5, 0x6c, 0x59,
+  0xfe, 0xd2, 0x81, 0xfe, 0xd5, 0xca, 0x42, 0xd5, 0xb6, 0xd0, 0xf2, 0xe8,
+  0xe5, 0x8d, 0xda, 0x77, 0x91, 0x27, 0xd8, 0x5b, 0x6d, 0x45, 0x97, 0xb5,
+  0xdb, 0x42, 0x83, 0x4f, 0x02, 0xeb, 0x20, 0xa3, 0xcf, 0xcd, 0xb8, 0xb2,
+  0x6a, 0x5b, 0xdc, 0x34, 0xc0, 0x75, 0xe3, 0xfa, 0xe6, 0xf3, 0x56, 0xdc,
+  0x38, 0xb4, 0xd5, 0x0e, 0x37, 0xc0, 0xcf, 0x2d, 0x28, 0xe4, 0x07, 0x5c,
+  0xba, 0x07, 0x5b, 0x3f, 0xc0, 0x50, 0x68, 0xd3, 0xd1, 0x2a, 0xc1, 0x12,
+  0x9c, 0xbc, 0xd2, 0x1a, 0x5b, 0xa6, 0x06, 0x2b, 0x93, 0x11, 0x94, 0x6d,
+  0x0b, 0x5a, 0xd6, 0x42, 0x95, 0x5d, 0xcc, 0xfa, 0xec, 0xa8, 0xc5, 0x64,
+  0x43, 0xb9, 0x57, 0x56, 0x65, 0x05, 0xa8, 0x59, 0xa9, 0x95, 0x1d, 0x2c,
+  0x7d, 0x00, 0x06, 0xb6, 0xc1, 0xea, 0xfb, 0x2f, 0xd5, 0xec, 0x97, 0x14,
+  0x92, 0xdc, 0xbf, 0x97, 0x8e, 0xd7, 0xe6, 0x8e, 0xe6, 0xe2, 0xe3, 0x78,
+  0xa1, 0x7f, 0x40, 0xba, 0xe8, 0x94, 0xd6, 0xcf, 0xe3, 0x52, 0xe8, 0x90,
+  0x09, 0xea, 0xb8, 0x61, 0xf2, 0xe2, 0x7b, 0xc8, 0x4c, 0xa3, 0xe4, 0x54,
+  0x84, 0xd1, 0x0a, 0xd8, 0x7c, 0xcd, 0x3e, 0xbe, 0xb3, 0x2a, 0x1c, 0xd4,
+  0xb5, 0xd6, 0xd4, 0x33, 0x55, 0xfe, 0x47, 0x06, 0x33, 0x8d, 0xc9, 0xfb,
+  0xb8, 0x88, 0x24, 0xf1, 0x4d, 0xe5, 0x7d, 0xe4, 0x6d, 0x98, 0x69, 0x33,
+  0xd0, 0x12, 0xca, 0x1d, 0xda, 0xb7, 0x1d, 0xcb, 0x62, 0x30, 0xb2, 0x82,
+  0x47, 0x2c, 0xf7, 0xcd, 0x9f, 0x98, 0x6a, 0x3b, 0xa7, 0x25, 0xb4, 0x9d,
+  0x05, 0xc8, 0xf9, 0x7e, 0x34, 0x05, 0x7d, 0x81, 0xcb, 0xc6, 0xe4, 0x9a,
+  0xaa, 0xbf, 0xd7, 0x3b, 0x4c, 0x12, 0xa2, 0x55, 0x80, 0x7f, 0xf4, 0x56,
+  0xbb, 0xd7, 0x98, 0x3b, 0xa2, 0x2e, 0xe9, 0x29, 0xc1, 0xf5, 0x19, 0x35,
+  0x49, 0xb6, 0x97, 0x30, 0xd0, 0x3d, 0x97, 0x26, 0x91, 0x0f, 0x93, 0x4b,
+  0xcb, 0xa0, 0x3a, 0xba, 0x1e, 0xa6, 0x8d, 0xb1, 0x0a, 0x9b, 0xc1, 0x0e,
+  0x28, 0xdb, 0xe2, 0x6f, 0x97, 0x98, 0x6c, 0xb2, 0x8f, 0xbc, 0x10, 0xa0,
+  0x55, 0x22, 0xed, 0x4c, 0x9f, 0xa3, 0x5e, 0x65, 0xe7, 0x8c, 0x4b, 0xc2,
+  0x02, 0x64, 0xad, 0xa8, 0x4c, 0xec, 0x60, 0x16, 0x82, 0xe8, 0x29, 0x26,
+  0x3a, 0x4b, 0x0c, 0xe1, 0x0f, 0x22, 0xaf, 0x14, 0x68, 0xbb, 0x3d, 0x7c,
+  0x39, 0xd0, 0xa9, 0x86, 0x97, 0x9d, 0x54, 0x23, 0xfe, 0xc4, 0x0f, 0x40,
+  0x67, 0x9f, 0xf7, 0x69, 0x70, 0x46, 0x5f, 0xf6, 0xfe, 0xde, 0xc5, 0x4b,
+  0xfe, 0x4d, 0xfd, 0xe3, 0xaa, 0x4b, 0x36, 0xd2, 0x94, 0x8d, 0x35, 0x65,
+  0xe7, 0x9a, 0xb2, 0x8b, 0xe3, 0xb1, 0xe6, 0xbd, 0x72, 0x4d, 0xc5, 0xe1,
+  0x69, 0xb5, 0x30, 0x77, 0x50, 0x52, 0x47, 0x6f, 0xa8, 0x23, 0x38, 0xd4,
+  0x52, 0xbc, 0xd4, 0xd5, 0xbc, 0x3c, 0x6e, 0xe7, 0x6b, 0x5a, 0x1f, 0x56,
+  0x75, 0xa7, 0x33, 0x5e, 0xb4, 0xaa, 0x9f, 0x7c, 0xa8, 0x49, 0x7d, 0xbf,
+  0xe3, 0x65, 0xc7, 0x08, 0x41, 0xc1, 0x64, 0x24, 0x2e, 0xcd, 0x1d, 0x67,
+  0xbf, 0x47, 0xea, 0x44, 0x63, 0x83, 0xc5, 0xc0, 0x16, 0xfb, 0x29, 0x86,
+  0x72, 0x8e, 0x12, 0x41, 0x6a, 0x06, 0x70, 0xb4, 0x4d, 0x62, 0xf9, 0x6d,
+  0xc5, 0x96, 0xc1, 0xfd, 0x5c, 0x7b, 0x74, 0x19, 0xc8, 0xeb, 0x0d, 0x0b,
+  0x94, 0x2f, 0x60, 0x18, 0xd4, 0xf0, 0xc2, 0x5d, 0x77, 0x9b, 0x02, 0x08,
+  0x87, 0xb1, 0x29, 0x09, 0x50, 0x47, 0x71, 0x06, 0x1b, 0xf0, 0x09, 0xe5,
+  0xf4, 0x26, 0xe9, 0xb9, 0xca, 0xed, 0xe2, 0x94, 0x2d, 0xf6, 0x13, 0xa7,
+  0x84, 0x28, 0xc5, 0x09, 0xf0, 0xe8, 0xa5, 0x0f, 0x8e, 0x93, 0x87, 0xc9,
+  0x85, 0xc7, 0xec, 0xa6, 0x2e, 0xae, 0x30, 0xa7, 0xae, 0xf4, 0x6d, 0x8c,
+  0xc9, 0x87, 0xf8, 0xaa, 0xae, 0x66, 0x48, 0xe5, 0xf7, 0xba, 0xa6, 0x54,
+  0x7e, 0xa9, 0xab, 0x29, 0x0a, 0x01, 0xbc, 0x69, 0x65, 0x2d, 0xdd, 0xe7,
+  0xf4, 0x10, 0x6a, 0x2f, 0xee, 0x46, 0x67, 0x81, 0x23, 0xfc, 0x41, 0x04,
+  0x9e, 0x02, 0x6d, 0xf3, 0x2b, 0x95, 0x4b, 0x99, 0xf9, 0x96, 0x79, 0x7f,
+  0x92, 0xf8, 0x01, 0xf3, 0x9a, 0x9c, 0x4a, 0xd7, 0x47, 0x3f, 0xf2, 0xc1,
+  0xdf, 0xd3, 0x75, 0x6c, 0x15, 0x86, 0xc3, 0xcd, 0x05, 0x06, 0x22, 0x91,
+  0x5a, 0xf6, 0x56, 0x1b, 0x70, 0x30, 0xb3, 0x5c, 0x63, 0x72, 0x1b, 0x3f,
+  0x25, 0x8a, 0x99, 0xda, 0x4f, 0x4f, 0xe5, 0x41, 0x86, 0x25, 0x94, 0x59,
+  0x90, 0xc3, 0x91, 0xa9, 0x7e, 0x44, 0x2b, 0xcb, 0x2d, 0xe0, 0x2c, 0xfe,
+  0x84, 0xce, 0xb2, 0xf4, 0xb6, 0x21, 0xd4, 0x80, 0x87, 0xf9, 0x81, 0xcd,
+  0x47, 0x01, 0x43, 0x93, 0x3b, 0x81, 0x20, 0x21, 0x37, 0xe3, 0x4f, 0x8c,
+  0xfe, 0x13, 0xbf, 0x30, 0x6a, 0x9e, 0x9d, 0xd3, 0x8b, 0x13, 0x7a, 0x39,
+  0xb7, 0xc6, 0xf4, 0xfc, 0xfc, 0xec, 0xad, 0x1c, 0x1e, 0x59, 0x13, 0x77,
+  0x06, 0xf2, 0x23, 0xa3, 0x03, 0xf9, 0xb1, 0xd5, 0xff, 0x03, 0x02, 0x72,
+  0x3a, 0xff, 0x82, 0x55, 0x00, 0x00
+};
+
+static const size_t WEBUI_INDEX_GZ_LEN = 4074;
+static const char WEBUI_INDEX_HASH[] = "2216558c2117a736";
+
+static const uint8_t WEBUI_APP_JS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa4, 0x5b,
+  0xe9, 0x72, 0xe3, 0x46, 0x92, 0x7e, 0x95, 0x72, 0xc4, 0xc8, 0x20, 0x57,
+  0x14, 0x5b, 0x2d, 0xdb, 0x1d, 0xb3, 0x92, 0xd9, 0x0e, 0xb5, 0xa4, 0x6e,
+  0x29, 0x4c, 0x1d, 0xd1, 0x64, 0xaf, 0x3d, 0xe1, 0x71, 0x60, 0x40, 0xa2,
+  0x40, 0xc0, 0xc2, 0xb5, 0x38, 0x48, 0xa9, 0x5b, 0xbd, 0xaf, 0xb5, 0xff,
+  0xf7, 0xc9, 0xf6, 0xcb, 0xac, 0x03, 0x07, 0xc9, 0xf1, 0x1e, 0x3f, 0x44,
+  0xa0, 0x2a, 0x33, 0xab, 0xb2, 0xb2, 0xf2, 0x2c, 0x94, 0x96, 0x59, 0x5a,
+  0x56, 0x62, 0x3e, 0xf9, 0x22, 0xd3, 0xd3, 0x2f, 0x55, 0x54, 0xc5, 0xf2,
+  0xd4, 0xb9, 0x9a, 0x3d, 0x7c, 0x77, 0x22, 0x3e, 0xce, 0x67, 0x0f, 0xe2,
+  0x36, 0x5a, 0x8a, 0x20, 0x2b, 0xc4, 0xbb, 0xa8, 0xf0, 0xef, 0xae, 0xe6,
+  0x47, 0x1f, 0x32, 0x67, 0x54, 0x56, 0x5e, 0x55, 0x97, 0xa7, 0xce, 0x8c,
+  0x9f, 0xce, 0x28, 0xca, 0x4f, 0x9d, 0x9b, 0x07, 0x71, 0xee, 0xfb, 0x85,
+  0x2c, 0xd1, 0xde, 0x44, 0x41, 0xe4, 0x16, 0x65, 0x19, 0x9d, 0x3a, 0xbf,
+  0x44, 0xef, 0x23, 0xf1, 0x71, 0x36, 0xbb, 0xd1, 0xbd, 0xd5, 0x93, 0xee,
+  0x9b, 0xff, 0x2a, 0x1e, 0xb2, 0x8d, 0x2c, 0x9c, 0x51, 0x28, 0x3d, 0xd0,
+  0xbf, 0x2f, 0xa4, 0x14, 0xd7, 0x78, 0x15, 0x83, 0x24, 0x4a, 0x87, 0xce,
+  0xa8, 0xce, 0xab, 0x28, 0x01, 0x2f, 0x9f, 0xf8, 0xe9, 0x8c, 0x8a, 0xaa,
+  0xcc, 0xdd, 0x52, 0x16, 0x6b, 0x59, 0x9c, 0x3a, 0xcc, 0xda, 0x8c, 0x1b,
+  0xce, 0x68, 0x19, 0x47, 0x32, 0xad, 0x4e, 0x9d, 0x0b, 0x7e, 0x12, 0x7b,
+  0x85, 0xf4, 0x30, 0xc8, 0x8a, 0x38, 0xd4, 0xaf, 0xce, 0x28, 0x7f, 0xac,
+  0xdc, 0xc2, 0xab, 0x30, 0xe2, 0x83, 0xb7, 0x7c, 0x94, 0x95, 0xf8, 0x88,
+  0x86, 0x33, 0x8a, 0xbd, 0xb2, 0x72, 0x97, 0x59, 0x9a, 0xca, 0x25, 0x86,
+  0x98, 0xa2, 0xa5, 0xd6, 0x7d, 0xa1, 0xba, 0x34, 0x42, 0x1e, 0x7b, 0xcf,
+  0x1a, 0xaa, 0x86, 0xc4, 0xc3, 0x2b, 0x00, 0x55, 0x3c, 0xce, 0xf1, 0x2b,
+  0xbe, 0x15, 0x77, 0xb2, 0xda, 0x64, 0xc5, 0xa3, 0xea, 0x75, 0xcb, 0xe7,
+  0x74, 0x09, 0x0e, 0xf0, 0x2b, 0x8c, 0xa0, 0x6c, 0xbf, 0x0b, 0x61, 0x2b,
+  0x2a, 0x82, 0xeb, 0x49, 0x14, 0x81, 0x9a, 0x44, 0xf5, 0x66, 0x4b, 0x2f,
+  0x76, 0xd5, 0x14, 0x97, 0x72, 0x1d, 0x2d, 0xa5, 0x98, 0x52, 0x97, 0x98,
+  0xb3, 0x44, 0xea, 0x6a, 0xa9, 0x81, 0x9f, 0xe6, 0x17, 0xba, 0x8f, 0x67,
+  0xa8, 0x53, 0x6f, 0xed, 0x45, 0xb1, 0xb7, 0xa0, 0xbd, 0xfc, 0xd4, 0x34,
+  0xc4, 0xa0, 0x4e, 0x69, 0x12, 0xe9, 0x43, 0xbe, 0x59, 0x10, 0x94, 0xb2,
+  0xd2, 0x5c, 0xdc, 0x73, 0xc3, 0x19, 0x25, 0x7e, 0x8a, 0x7d, 0x4d, 0x2e,
+  0xef, 0x66, 0x46, 0x8c, 0x2e, 0x6d, 0x2e, 0x4b, 0x64, 0x70, 0xf3, 0x30,
+  0xb4, 0xbd, 0x0a, 0x51, 0xf5, 0x13, 0x3a, 0x41, 0x68, 0x5d, 0x69, 0xb6,
+  0xd1, 0x6b, 0xe6, 0x71, 0xef, 0xb2, 0x8d, 0x33, 0x4a, 0x25, 0x24, 0x2f,
+  0x79, 0xb2, 0x8f, 0xf4, 0x10, 0xbf, 0x44, 0x47, 0xef, 0xa3, 0x56, 0x3f,
+  0xc9, 0x3f, 0x88, 0x8a, 0xa4, 0x03, 0x17, 0xcb, 0x42, 0xfa, 0xd8, 0xcf,
+  0xc8, 0x8b, 0x4b, 0xe1, 0xa5, 0xbe, 0x28, 0xe4, 0x22, 0xcb, 0xaa, 0x9f,
+  0xc4, 0xdf, 0xb2, 0x5a, 0x6c, 0xa2, 0x38, 0x16, 0xa9, 0x94, 0xbe, 0xa8,
+  0x32, 0x00, 0x98, 0x7e, 0x55, 0x17, 0x52, 0xac, 0x23, 0x4f, 0x54, 0xa1,
+  0x14, 0x18, 0xa6, 0xce, 0xc5, 0xf9, 0xc3, 0xd8, 0x68, 0xa3, 0xb4, 0x7b,
+  0xfc, 0xd1, 0xbc, 0x1a, 0x3e, 0xfc, 0x6c, 0x93, 0xc6, 0x99, 0xe7, 0xbb,
+  0x71, 0xb6, 0xc2, 0xa2, 0x2e, 0x75, 0x13, 0xb2, 0x5e, 0x95, 0x3d, 0xa8,
+  0x9b, 0xcb, 0xa2, 0x8c, 0xca, 0xaa, 0x85, 0xf5, 0x1e, 0x7b, 0x17, 0x12,
+  0xae, 0x56, 0x51, 0x48, 0x5a, 0xc6, 0x4a, 0x34, 0x10, 0x32, 0x74, 0x35,
+  0x83, 0x8a, 0x82, 0x25, 0xd6, 0x13, 0x7a, 0xe8, 0x96, 0xeb, 0xd5, 0x55,
+  0x76, 0xea, 0x9c, 0xe3, 0xd7, 0xf4, 0xc4, 0xd1, 0x2a, 0x24, 0x25, 0xa4,
+  0x87, 0xe9, 0xf3, 0xbd, 0xe2, 0x11, 0xb3, 0x79, 0xa4, 0x56, 0xcf, 0x12,
+  0xec, 0xfd, 0xed, 0x0a, 0x7b, 0x93, 0x82, 0xf2, 0xee, 0xde, 0x19, 0x79,
+  0xb5, 0x1f, 0xf1, 0x20, 0x78, 0x60, 0x7e, 0x56, 0xef, 0x99, 0x97, 0xe4,
+  0xd8, 0x6b, 0xa5, 0xde, 0x2b, 0x2f, 0x82, 0xa6, 0x7d, 0xc0, 0xaf, 0x33,
+  0x5a, 0xd4, 0xc1, 0xa9, 0xf3, 0xae, 0x0e, 0x02, 0x59, 0x88, 0x59, 0xf4,
+  0x99, 0x95, 0xbf, 0x92, 0xe9, 0x92, 0x35, 0x9b, 0x5f, 0x60, 0x25, 0x45,
+  0x16, 0x44, 0xa4, 0x36, 0x0f, 0xea, 0x05, 0x3d, 0xb2, 0x08, 0x48, 0x68,
+  0x71, 0xe4, 0x2d, 0xa2, 0x38, 0xaa, 0x9e, 0x69, 0x56, 0xc3, 0xb9, 0x20,
+  0x61, 0xc2, 0x08, 0x9f, 0x95, 0x98, 0x95, 0x6d, 0x5b, 0x53, 0x3f, 0xc1,
+  0x8a, 0xb5, 0x99, 0x8b, 0x81, 0xff, 0x2e, 0x19, 0xf2, 0xa2, 0x8a, 0xc4,
+  0x8b, 0x59, 0x14, 0xf4, 0x42, 0x4a, 0x4e, 0x42, 0x57, 0xb2, 0x5e, 0x94,
+  0xc5, 0x3a, 0x03, 0xbf, 0xca, 0xb2, 0xc5, 0xfd, 0x9d, 0xee, 0x0a, 0x82,
+  0xa6, 0xef, 0xfd, 0x7b, 0x74, 0x76, 0xd4, 0xe9, 0xe6, 0x64, 0xc6, 0x5d,
+  0xa4, 0x1e, 0xd4, 0x47, 0x4f, 0x74, 0xf8, 0x32, 0xf0, 0xea, 0xb8, 0xa2,
+  0x1d, 0xd5, 0x6f, 0x90, 0x90, 0x2c, 0xc9, 0x6e, 0xd9, 0x37, 0x7c, 0xb4,
+  0xef, 0xc2, 0x67, 0xe3, 0x1a, 0x8f, 0xc7, 0x8c, 0x21, 0xab, 0x06, 0x21,
+  0x2b, 0x14, 0x5c, 0x0d, 0xd0, 0xd2, 0x43, 0x74, 0x33, 0xbe, 0xe7, 0xaf,
+  0x3d, 0xb2, 0x28, 0x57, 0x93, 0x61, 0xba, 0x73, 0xdd, 0x05, 0x07, 0xa5,
+  0xba, 0x60, 0x1b, 0x61, 0x14, 0x80, 0x37, 0x70, 0x2a, 0x66, 0xf4, 0x4a,
+  0x82, 0x28, 0x2c, 0x0b, 0x62, 0x1e, 0x62, 0xda, 0x30, 0x8b, 0x7d, 0x38,
+  0xb3, 0x10, 0xdb, 0x7d, 0x11, 0xca, 0xe5, 0xa3, 0xb8, 0x49, 0x2b, 0xac,
+  0x99, 0x64, 0x04, 0x64, 0x37, 0xc9, 0x7c, 0xd6, 0x20, 0x8d, 0x29, 0x6e,
+  0xd1, 0xc6, 0xc0, 0xcb, 0x50, 0xfa, 0x10, 0x0e, 0x3d, 0xea, 0x18, 0x73,
+  0xb2, 0x48, 0xe0, 0x54, 0xb3, 0xba, 0x28, 0x8d, 0x80, 0xce, 0x83, 0x8a,
+  0xfc, 0x64, 0x50, 0x78, 0x2b, 0x72, 0xb4, 0xde, 0x2a, 0x81, 0x5d, 0x79,
+  0x55, 0x94, 0xa5, 0xe2, 0x3c, 0x96, 0xe4, 0xc6, 0xc8, 0x07, 0xbb, 0xf8,
+  0x89, 0xab, 0xf0, 0xd4, 0x61, 0x2f, 0x7c, 0xcd, 0x0d, 0x4c, 0xed, 0x95,
+  0x8f, 0xee, 0x32, 0xaf, 0xc1, 0xd4, 0xc3, 0x27, 0xf1, 0x4a, 0xcc, 0xd1,
+  0x2e, 0x75, 0x77, 0xea, 0x41, 0x0b, 0x5f, 0x9d, 0x8b, 0x01, 0x39, 0xef,
+  0x8f, 0xf3, 0xfb, 0x99, 0x28, 0xea, 0xf4, 0x88, 0x5c, 0x90, 0xa0, 0x10,
+  0x51, 0x8a, 0x34, 0xab, 0x84, 0x4c, 0xc9, 0xf5, 0xf8, 0x22, 0x4a, 0x61,
+  0x98, 0x51, 0x29, 0x16, 0x75, 0x14, 0x93, 0xff, 0x49, 0xd7, 0x14, 0x41,
+  0xb4, 0x84, 0x94, 0x15, 0x71, 0x27, 0x4c, 0x2c, 0xf5, 0x59, 0xfe, 0xa5,
+  0xb7, 0x96, 0x42, 0xb7, 0xa0, 0x53, 0xbe, 0x71, 0xe7, 0xe2, 0x17, 0xaf,
+  0x5a, 0x86, 0x7e, 0xc6, 0x9d, 0x6e, 0x06, 0x79, 0xdd, 0xff, 0xcc, 0xaf,
+  0x98, 0x34, 0x86, 0x6a, 0xcd, 0xe6, 0xe7, 0xd3, 0x29, 0x77, 0xf8, 0x72,
+  0x55, 0x78, 0x3e, 0x09, 0xe8, 0xf2, 0xea, 0xc3, 0xc7, 0xf3, 0xcb, 0xab,
+  0x4b, 0x25, 0x05, 0xd7, 0xa3, 0x65, 0x63, 0xa7, 0xa6, 0x57, 0x1f, 0xe7,
+  0x90, 0xb9, 0x59, 0x1e, 0xd6, 0xf1, 0xef, 0xb5, 0x36, 0x84, 0x0d, 0xf6,
+  0x47, 0xa9, 0xae, 0x35, 0x05, 0xd6, 0xb9, 0x19, 0x89, 0x57, 0x9b, 0x89,
+  0x0b, 0xa5, 0x28, 0x20, 0x84, 0x4f, 0xf4, 0x38, 0x9a, 0x66, 0x1b, 0xa1,
+  0x0d, 0x49, 0x0c, 0xae, 0x61, 0xc4, 0xa0, 0xc5, 0xa8, 0x23, 0x91, 0x78,
+  0xcf, 0x22, 0xa4, 0xc5, 0xf8, 0x45, 0x96, 0x67, 0x75, 0x55, 0x0e, 0x9b,
+  0x11, 0x16, 0x5e, 0xcc, 0xca, 0x02, 0xcb, 0xd4, 0x6f, 0x62, 0x40, 0x5b,
+  0x4b, 0xb6, 0xac, 0xa8, 0x57, 0x59, 0xe6, 0x93, 0x3c, 0x95, 0xf5, 0xb5,
+  0x48, 0xa9, 0x8f, 0x4c, 0x75, 0xc6, 0x4f, 0x61, 0x63, 0x9d, 0x18, 0x4c,
+  0x99, 0x6f, 0xa6, 0x96, 0x4f, 0x4b, 0x19, 0xc7, 0xd8, 0xef, 0x9d, 0x43,
+  0x84, 0xe0, 0x12, 0x1b, 0x8e, 0x5f, 0x8a, 0x51, 0x0a, 0xac, 0xc8, 0x11,
+  0x84, 0x34, 0xef, 0x4f, 0x1d, 0x4a, 0xe8, 0xbb, 0x0b, 0x47, 0xf2, 0xc3,
+  0x6b, 0x18, 0xf7, 0x4d, 0x20, 0x54, 0x38, 0xe0, 0x85, 0x95, 0x23, 0x51,
+  0x15, 0xcf, 0x42, 0x3b, 0x18, 0x20, 0x08, 0xa4, 0x0d, 0x21, 0x8b, 0x61,
+  0x6c, 0xe9, 0x5e, 0x1f, 0x9f, 0x7c, 0x0f, 0x1d, 0x04, 0x04, 0xa1, 0x48,
+  0xf1, 0xcd, 0x5e, 0x78, 0x64, 0xe8, 0x08, 0x41, 0x40, 0x4d, 0xea, 0xb2,
+  0xc6, 0x66, 0x3e, 0x8b, 0x05, 0x38, 0xd1, 0xe4, 0xca, 0x97, 0x31, 0xb3,
+  0xe4, 0xd0, 0xc4, 0xd2, 0xc3, 0x5f, 0x1c, 0xe5, 0x63, 0xa1, 0xd6, 0xcb,
+  0x9d, 0x18, 0x39, 0x4a, 0x11, 0x3a, 0xbc, 0x52, 0x0a, 0x6b, 0x6e, 0x63,
+  0xd2, 0xf0, 0x38, 0xd7, 0xf1, 0x5f, 0x6f, 0x4d, 0xa9, 0xfc, 0x24, 0x0b,
+  0x7a, 0x15, 0xad, 0x65, 0x29, 0x92, 0x0c, 0x11, 0xc4, 0x97, 0x15, 0xc2,
+  0x25, 0xd4, 0xb4, 0x02, 0x0f, 0xa6, 0x73, 0x01, 0xc3, 0xdf, 0x44, 0x7e,
+  0x15, 0x9a, 0x91, 0x14, 0x2f, 0xe7, 0x18, 0x01, 0xae, 0x0e, 0x58, 0xec,
+  0x88, 0x85, 0x47, 0x86, 0xc6, 0xd3, 0xb2, 0xc1, 0x9f, 0x21, 0x3a, 0x65,
+  0x2c, 0x02, 0x15, 0xb0, 0x98, 0x59, 0x3d, 0x00, 0x3b, 0xe3, 0x5b, 0x1a,
+  0x5b, 0xf1, 0x51, 0x42, 0xd3, 0x0b, 0x91, 0xab, 0xd4, 0x24, 0x91, 0x5e,
+  0xaa, 0x67, 0xb6, 0xb2, 0x67, 0xdf, 0xa3, 0xc4, 0x29, 0xb4, 0xdf, 0x36,
+  0x63, 0x29, 0x7f, 0xac, 0x8d, 0x63, 0xa3, 0x8d, 0xe3, 0x54, 0xc0, 0xbc,
+  0x3d, 0xc1, 0x36, 0x41, 0x52, 0xf1, 0xcc, 0xe0, 0xbc, 0x60, 0xc4, 0x28,
+  0x68, 0x2b, 0x45, 0xca, 0xca, 0x7a, 0x94, 0x08, 0xc6, 0x5a, 0x22, 0xbd,
+  0x00, 0xbc, 0x14, 0x92, 0xbc, 0xba, 0x08, 0xe4, 0x06, 0xa1, 0x14, 0xf1,
+  0xd2, 0x2f, 0xc5, 0x80, 0x5d, 0xa3, 0xb8, 0x9c, 0x3d, 0x8c, 0x84, 0xf6,
+  0xa3, 0xb4, 0xd4, 0x91, 0x28, 0xba, 0x01, 0x75, 0x38, 0x26, 0x27, 0x8d,
+  0xd9, 0xb1, 0x7b, 0xe4, 0xdc, 0x0d, 0x97, 0x2a, 0xf5, 0x3b, 0x52, 0xb9,
+  0x5f, 0x4e, 0x3b, 0x76, 0x06, 0x38, 0x1e, 0xa4, 0xb2, 0xb4, 0x97, 0x88,
+  0xf7, 0x35, 0x52, 0x9c, 0x8f, 0xef, 0xe1, 0x37, 0xa2, 0x52, 0x1a, 0x3a,
+  0xed, 0x3b, 0x2f, 0xa3, 0x55, 0x84, 0xb5, 0x88, 0x82, 0xa2, 0xa3, 0x92,
+  0x2f, 0x56, 0x11, 0x90, 0x8c, 0x68, 0x33, 0x04, 0x71, 0x4e, 0x4e, 0xd9,
+  0xcc, 0x46, 0xfe, 0xf5, 0x36, 0x4a, 0xa3, 0xa4, 0x4e, 0x7a, 0x2b, 0x67,
+  0x1a, 0x92, 0xd9, 0x51, 0xa1, 0xa3, 0x17, 0x14, 0x37, 0x5a, 0xad, 0x10,
+  0xda, 0x0d, 0x35, 0x7b, 0xe1, 0x6b, 0x48, 0x28, 0xc3, 0x8e, 0xa6, 0x2c,
+  0xa7, 0x38, 0x4b, 0x57, 0x47, 0xd8, 0xde, 0xee, 0x68, 0xe4, 0xe7, 0x90,
+  0x0f, 0x44, 0x4b, 0xa8, 0x00, 0x46, 0xad, 0x73, 0x1f, 0xbd, 0xfe, 0x98,
+  0xac, 0x29, 0x8e, 0x55, 0x1f, 0x14, 0x0a, 0xb2, 0x81, 0x5d, 0x6f, 0x22,
+  0x38, 0xc0, 0xd4, 0xca, 0xb3, 0x90, 0x2b, 0xaf, 0xf0, 0xb1, 0xf3, 0x76,
+  0x56, 0xed, 0xcc, 0x1f, 0x20, 0x92, 0xcc, 0x47, 0xde, 0xad, 0xc2, 0x92,
+  0x15, 0x36, 0xa5, 0xe1, 0x0d, 0x17, 0x56, 0x31, 0x0c, 0xb5, 0x76, 0xf9,
+  0x26, 0x6a, 0x60, 0xa1, 0xd5, 0x46, 0x4a, 0x12, 0x8c, 0x89, 0x0d, 0x7a,
+  0x20, 0x3b, 0x9f, 0x0a, 0x08, 0x14, 0x7a, 0xa1, 0x1d, 0x1b, 0xaf, 0x48,
+  0x69, 0x27, 0x36, 0xa1, 0x5e, 0x70, 0x19, 0x12, 0xf7, 0x59, 0x20, 0x02,
+  0x4a, 0xcd, 0x29, 0x42, 0xb0, 0x3f, 0xaf, 0x4b, 0xb6, 0x5a, 0xaf, 0xc4,
+  0x0e, 0x43, 0x9a, 0xc8, 0x51, 0x1f, 0x31, 0xb0, 0x87, 0x49, 0x4a, 0xe5,
+  0xe0, 0x31, 0x77, 0x8d, 0x54, 0xf3, 0x58, 0x4c, 0x40, 0x1c, 0x40, 0x1b,
+  0x2e, 0xb2, 0x24, 0xa7, 0xa1, 0x68, 0xfd, 0x3c, 0xb2, 0xc2, 0x80, 0xd2,
+  0x6d, 0x52, 0x6d, 0x32, 0x14, 0x51, 0xad, 0xec, 0xc9, 0x1b, 0x2b, 0x8b,
+  0xbe, 0xbd, 0xfe, 0x4c, 0x21, 0xa5, 0x14, 0xcb, 0x2c, 0x8b, 0x09, 0x0d,
+  0x46, 0x49, 0x9a, 0x62, 0x2d, 0xbc, 0x67, 0x08, 0xca, 0x69, 0x23, 0x61,
+  0xc9, 0x90, 0x5b, 0xc0, 0x97, 0x9e, 0x8a, 0x20, 0x7a, 0xc2, 0xc2, 0x97,
+  0xc4, 0xe5, 0x48, 0xe7, 0x95, 0xac, 0x7a, 0x82, 0x83, 0x0b, 0xf8, 0x1b,
+  0x0b, 0xe3, 0x77, 0x4f, 0x15, 0x1a, 0x2b, 0x12, 0xd6, 0x62, 0xc4, 0xf7,
+  0xd7, 0x63, 0x66, 0x83, 0xac, 0xaf, 0x13, 0x22, 0x9a, 0xe5, 0x50, 0x1a,
+  0x88, 0x1d, 0xf7, 0xa8, 0x32, 0x11, 0xc6, 0x9f, 0x8b, 0x3c, 0xae, 0x4b,
+  0x3d, 0x23, 0x85, 0x6e, 0x6c, 0x58, 0x2c, 0x65, 0xce, 0xe3, 0xc4, 0x4a,
+  0x85, 0xb9, 0xcd, 0xe2, 0x4e, 0x33, 0xe3, 0x48, 0x69, 0xb5, 0x67, 0x70,
+  0xda, 0x39, 0x99, 0x13, 0x3b, 0x00, 0xbd, 0x44, 0xf1, 0x47, 0x54, 0x41,
+  0x52, 0x63, 0xe4, 0x0a, 0x52, 0x2f, 0x41, 0xa7, 0xbc, 0x11, 0xa5, 0x25,
+  0xb0, 0x5c, 0xc4, 0x5d, 0xd2, 0x48, 0xd2, 0x92, 0x25, 0x4b, 0x9c, 0x76,
+  0x53, 0x3b, 0x7a, 0xbb, 0xe5, 0x26, 0xeb, 0xbf, 0xf5, 0x52, 0xf8, 0x57,
+  0x41, 0xb1, 0xfa, 0x33, 0xf6, 0xf1, 0x95, 0x5a, 0xfa, 0x32, 0x2b, 0x60,
+  0x12, 0x9c, 0x18, 0x40, 0x51, 0x59, 0xa1, 0xc6, 0xa8, 0x6a, 0x56, 0xd0,
+  0x71, 0x48, 0x6b, 0x22, 0x38, 0x2c, 0x0c, 0x50, 0x6d, 0x1c, 0x0d, 0x47,
+  0x60, 0xa2, 0x8c, 0x74, 0xbf, 0xf4, 0x74, 0xff, 0xe1, 0xd0, 0xda, 0x5f,
+  0x53, 0x02, 0x21, 0x4c, 0x44, 0xa4, 0x94, 0xc8, 0xf7, 0x79, 0x42, 0x76,
+  0xef, 0x4d, 0x55, 0x32, 0x12, 0x7e, 0xa4, 0x74, 0xca, 0x16, 0x44, 0x94,
+  0xd5, 0x7b, 0xeb, 0x2c, 0x22, 0x95, 0xcd, 0x25, 0x59, 0x94, 0xb8, 0x9b,
+  0x3f, 0xa0, 0x01, 0x3b, 0xe5, 0xb5, 0x70, 0x1a, 0xe9, 0x62, 0x71, 0x15,
+  0xa7, 0xf4, 0xf7, 0x10, 0x3d, 0x14, 0xb4, 0xa2, 0x50, 0x5d, 0xa9, 0x05,
+  0x18, 0x9c, 0x38, 0x4a, 0x22, 0x8a, 0xda, 0x61, 0x5d, 0x51, 0x26, 0x2f,
+  0xa6, 0xd4, 0x36, 0xc0, 0x7e, 0x21, 0xab, 0x7a, 0xb9, 0x86, 0xb9, 0xa8,
+  0x21, 0x0a, 0x44, 0xcd, 0xb9, 0x4c, 0x72, 0x03, 0x40, 0x2c, 0x24, 0xf5,
+  0xf2, 0x1e, 0x3b, 0xbd, 0x36, 0x7b, 0xb8, 0x20, 0x19, 0x5a, 0xde, 0x68,
+  0x8b, 0x54, 0xff, 0x94, 0xca, 0x84, 0x57, 0xa6, 0xdc, 0x6d, 0x81, 0xdd,
+  0x20, 0x01, 0x6b, 0x07, 0xd3, 0xfb, 0xf3, 0xcb, 0x83, 0x03, 0x31, 0xf0,
+  0xd6, 0x2b, 0x71, 0x70, 0xfe, 0x6f, 0x1f, 0x0e, 0x0e, 0x20, 0x5c, 0x9a,
+  0xe5, 0xe0, 0xe1, 0xea, 0xfc, 0xe7, 0x83, 0x83, 0xa1, 0xf8, 0xaf, 0xff,
+  0x14, 0xff, 0x71, 0x70, 0x7b, 0x7e, 0x20, 0x92, 0x73, 0xa1, 0xe2, 0xa1,
+  0x5e, 0x9c, 0x57, 0x9a, 0xa2, 0xd5, 0x2c, 0xb0, 0xbb, 0x34, 0xd4, 0x3d,
+  0x9e, 0xff, 0xcc, 0xd9, 0xbc, 0x96, 0x8b, 0xe0, 0x9e, 0x1e, 0x96, 0xde,
+  0x00, 0xbf, 0x83, 0x68, 0x3a, 0x7b, 0xb8, 0x31, 0xc5, 0x17, 0x42, 0xbd,
+  0x80, 0x4d, 0x92, 0x8a, 0x91, 0x41, 0x44, 0xf0, 0xdd, 0xe2, 0xc8, 0x7a,
+  0xaa, 0x84, 0xb5, 0x2b, 0xee, 0x4f, 0x53, 0xca, 0xb4, 0xcc, 0xb0, 0x6a,
+  0xca, 0xa5, 0x29, 0x91, 0xa2, 0x56, 0x5b, 0x13, 0x30, 0x42, 0xde, 0xcc,
+  0x9f, 0x7b, 0x88, 0xbf, 0x7b, 0x66, 0x6f, 0xea, 0xb0, 0x16, 0xc3, 0x1a,
+  0x86, 0x51, 0xe0, 0xa0, 0xb1, 0x89, 0xe0, 0x7d, 0x25, 0x55, 0x81, 0x78,
+  0xa4, 0xb2, 0xd0, 0xb6, 0xdc, 0xb0, 0xcd, 0x29, 0x92, 0x81, 0x3b, 0x98,
+  0x9e, 0xd1, 0x0d, 0x0a, 0x07, 0x05, 0xd2, 0x45, 0xf1, 0x2c, 0xbb, 0x32,
+  0x56, 0x1b, 0x35, 0xab, 0xb2, 0x3c, 0x07, 0x14, 0x7a, 0x76, 0x30, 0xbf,
+  0xba, 0x7d, 0x38, 0x10, 0x17, 0x62, 0xc0, 0xfa, 0x25, 0x0e, 0xa6, 0x37,
+  0xb7, 0x37, 0x73, 0x74, 0x0c, 0xb5, 0x43, 0x3b, 0x98, 0xdf, 0xdc, 0x5e,
+  0x1d, 0x08, 0x75, 0x88, 0x21, 0x06, 0x07, 0xe7, 0x1f, 0xee, 0x0f, 0x86,
+  0xdd, 0x31, 0xbb, 0xd2, 0xd0, 0xf5, 0x50, 0x5b, 0x00, 0x76, 0x57, 0x44,
+  0x05, 0x75, 0xa3, 0x8c, 0x90, 0xcc, 0xbd, 0xdc, 0x12, 0x5b, 0x6b, 0x58,
+  0x08, 0x00, 0xeb, 0x42, 0x38, 0x92, 0xcd, 0x88, 0x76, 0x79, 0x46, 0x3e,
+  0xe4, 0xb3, 0xb8, 0x72, 0x57, 0xa7, 0x29, 0xe4, 0xa0, 0xb9, 0xfc, 0x56,
+  0x21, 0x5b, 0xf1, 0x0f, 0xdf, 0xef, 0x6f, 0xc8, 0x69, 0x93, 0xe7, 0x2d,
+  0x05, 0xd1, 0xdb, 0x69, 0x96, 0xb1, 0xf4, 0x0a, 0x77, 0x51, 0x51, 0x02,
+  0xd4, 0x12, 0xb4, 0xaa, 0x8d, 0xb4, 0xa4, 0x85, 0xaa, 0x7f, 0x15, 0x81,
+  0x3e, 0x94, 0x20, 0x54, 0xd0, 0xe8, 0x17, 0xa1, 0x8e, 0x75, 0x5a, 0x18,
+  0xde, 0x2a, 0x6b, 0xb0, 0xfe, 0xa8, 0xa1, 0xd4, 0x29, 0x1d, 0x1f, 0xe8,
+  0x70, 0xde, 0x31, 0x78, 0xda, 0x8a, 0x52, 0xd8, 0x83, 0x1e, 0xe5, 0x45,
+  0xd5, 0xa9, 0x15, 0x25, 0xbc, 0xd2, 0x2f, 0x95, 0x67, 0xe6, 0xcd, 0x81,
+  0x06, 0x68, 0x42, 0xc4, 0x19, 0xac, 0x8b, 0x39, 0x4d, 0x10, 0x5f, 0x73,
+  0x22, 0xcf, 0xc7, 0x9d, 0x29, 0xb4, 0xbf, 0x98, 0xb7, 0x24, 0xde, 0x64,
+  0x48, 0xe4, 0x5b, 0x8d, 0x38, 0xc7, 0x14, 0x19, 0x2e, 0xd8, 0xfb, 0x22,
+  0x98, 0x04, 0xd2, 0x14, 0x89, 0x63, 0xe7, 0xeb, 0xd7, 0xb3, 0x25, 0x1f,
+  0xaa, 0x5d, 0x5f, 0x4d, 0x1f, 0xdc, 0xab, 0x5f, 0xe7, 0xee, 0xd5, 0xdd,
+  0xe4, 0x4b, 0x98, 0x07, 0x2a, 0xf5, 0x3c, 0xca, 0x3d, 0x3a, 0x24, 0x43,
+  0xdb, 0x5d, 0xd6, 0x98, 0xea, 0xfa, 0xe1, 0xbd, 0xb8, 0x40, 0x36, 0x12,
+  0x04, 0x26, 0x90, 0x13, 0x26, 0x7a, 0x4a, 0x4a, 0x8f, 0x8e, 0x02, 0x1b,
+  0x70, 0x8a, 0x3a, 0x51, 0xbb, 0x6d, 0xb0, 0x34, 0xbd, 0x19, 0x53, 0x2c,
+  0x79, 0x14, 0x72, 0xdd, 0xd7, 0x9f, 0x5b, 0x79, 0x90, 0x2e, 0x1d, 0xb9,
+  0x5e, 0x9f, 0x70, 0x6c, 0xa8, 0x2b, 0x56, 0x03, 0xbd, 0xac, 0x33, 0xa1,
+  0xa3, 0xc1, 0x44, 0x3c, 0xc3, 0xe5, 0xab, 0xf0, 0x0c, 0xfa, 0x18, 0x39,
+  0x20, 0x95, 0x53, 0xd1, 0x2a, 0x05, 0x70, 0x4a, 0x2d, 0x3d, 0xa8, 0x86,
+  0xfc, 0x4c, 0x01, 0x8c, 0x3c, 0x55, 0xa9, 0xf3, 0x49, 0x4a, 0x70, 0x73,
+  0x95, 0x84, 0xd1, 0xab, 0xad, 0xcd, 0xb8, 0x41, 0x09, 0x86, 0x4e, 0xdf,
+  0x99, 0x1e, 0x76, 0x8a, 0xa8, 0x53, 0xb2, 0x85, 0xf6, 0x09, 0x17, 0x1e,
+  0x39, 0x98, 0xe9, 0xcd, 0xc3, 0xc3, 0xcd, 0xdd, 0x87, 0x6f, 0x50, 0xd4,
+  0x72, 0x66, 0x68, 0x12, 0xfc, 0xc2, 0x8b, 0xba, 0xd9, 0xfd, 0xd7, 0xb3,
+  0xfb, 0xc5, 0x1f, 0xd8, 0xdf, 0x31, 0xa4, 0x00, 0x6e, 0x07, 0xf3, 0xb1,
+  0x4c, 0x47, 0x6d, 0xf1, 0x0f, 0xcf, 0x62, 0x04, 0x1f, 0x44, 0xe6, 0xd5,
+  0xc4, 0x91, 0xa9, 0x83, 0xc4, 0x93, 0x62, 0x11, 0x1d, 0xb0, 0x4c, 0xf8,
+  0x90, 0x0d, 0xfa, 0x84, 0x5c, 0x48, 0x8e, 0x57, 0xb2, 0xba, 0x81, 0xb1,
+  0x0d, 0x1c, 0x86, 0x39, 0xc3, 0x97, 0x17, 0x87, 0x12, 0x45, 0x10, 0xa8,
+  0x1d, 0xfd, 0xcb, 0x24, 0xf2, 0x27, 0x6f, 0xfd, 0x6c, 0x59, 0x53, 0x09,
+  0x4d, 0xe8, 0x57, 0xb1, 0xa4, 0xd7, 0x77, 0xcf, 0x37, 0xfe, 0x20, 0xf2,
+  0x87, 0x67, 0x41, 0x9d, 0x2a, 0xeb, 0xf5, 0xf2, 0x3c, 0x7e, 0xe6, 0x03,
+  0x9f, 0xc1, 0xf0, 0x8b, 0x26, 0x2f, 0x90, 0xe6, 0x4c, 0x2c, 0xb5, 0x79,
+  0xd1, 0x43, 0x9c, 0x89, 0x28, 0x18, 0x28, 0x9e, 0x26, 0x13, 0x87, 0x73,
+  0x04, 0xe7, 0xe5, 0xc5, 0x76, 0xd0, 0x41, 0x90, 0x83, 0x91, 0x68, 0x8c,
+  0x31, 0x62, 0xf8, 0x79, 0x85, 0x60, 0x88, 0x84, 0x48, 0x0e, 0x00, 0xaa,
+  0xbc, 0x23, 0xc5, 0xf1, 0x48, 0xad, 0x6a, 0x78, 0x26, 0xbe, 0x0a, 0x19,
+  0x43, 0x4a, 0x9a, 0xa0, 0x90, 0x09, 0x32, 0xdd, 0xdd, 0x34, 0x40, 0x56,
+  0xb3, 0x98, 0xb5, 0x7e, 0xd5, 0xec, 0x56, 0xe5, 0xe4, 0x2f, 0x5a, 0x14,
+  0x33, 0xec, 0xfd, 0x50, 0x71, 0x58, 0x0e, 0x01, 0x18, 0xb3, 0x92, 0x4c,
+  0x18, 0x06, 0x02, 0x85, 0x3f, 0xbb, 0xb8, 0xbe, 0xba, 0x74, 0xe7, 0xbf,
+  0xea, 0xc3, 0x64, 0x7d, 0x54, 0xc8, 0xf9, 0x27, 0x1f, 0x78, 0x9a, 0xa3,
+  0x53, 0x9d, 0x90, 0xda, 0xc3, 0x44, 0x0e, 0x1a, 0x0d, 0x58, 0x9d, 0xac,
+  0x5a, 0x58, 0x96, 0xb7, 0x40, 0x59, 0xde, 0x40, 0x78, 0x5c, 0x8a, 0x0b,
+  0xb2, 0x39, 0x00, 0xb1, 0x47, 0xad, 0x2a, 0xa1, 0xee, 0x73, 0x40, 0x36,
+  0x80, 0x2c, 0x29, 0x5a, 0x72, 0x6d, 0x09, 0xeb, 0x46, 0x6e, 0xd9, 0x72,
+  0x85, 0xe2, 0xfe, 0xee, 0x15, 0xd5, 0x2e, 0x0b, 0xaa, 0x5c, 0xe8, 0xa0,
+  0x55, 0x67, 0xe0, 0xe4, 0x9e, 0xc6, 0x02, 0x79, 0xcc, 0xce, 0xf4, 0x25,
+  0xc0, 0xdb, 0x51, 0x96, 0xc3, 0x03, 0x3d, 0xc2, 0x20, 0x8c, 0x5b, 0x12,
+  0x98, 0x02, 0x41, 0xde, 0x1f, 0xf7, 0x78, 0x31, 0x6b, 0xa5, 0x38, 0x89,
+  0xe4, 0x9a, 0xdc, 0x94, 0xc6, 0x6c, 0xfb, 0xb3, 0x28, 0x85, 0x8f, 0x21,
+  0x4b, 0xde, 0xc1, 0x87, 0xa2, 0x25, 0x27, 0x46, 0xc2, 0x11, 0x09, 0x79,
+  0x4a, 0x3f, 0xa2, 0xea, 0x79, 0x6b, 0x2e, 0x92, 0xdd, 0x15, 0x10, 0xff,
+  0x6f, 0x13, 0x5d, 0x14, 0x59, 0x59, 0x1e, 0x25, 0x91, 0x9f, 0x72, 0xc2,
+  0xaa, 0x70, 0x55, 0x51, 0x53, 0xd6, 0x79, 0x9e, 0x15, 0xe4, 0x46, 0x06,
+  0xe4, 0x14, 0xe5, 0x93, 0x2a, 0xa6, 0x4f, 0x4e, 0x4e, 0x8f, 0x8f, 0x8f,
+  0x8e, 0xdf, 0xe0, 0x77, 0xc8, 0x02, 0x53, 0xf9, 0x00, 0x3c, 0x18, 0x9d,
+  0xe2, 0x12, 0x3f, 0xac, 0xa0, 0x76, 0x5a, 0xd4, 0x99, 0x49, 0xae, 0x6b,
+  0x5b, 0x2d, 0x36, 0x3a, 0x22, 0xa2, 0x44, 0x8a, 0x25, 0xc7, 0xbb, 0xeb,
+  0xaa, 0xf3, 0x3f, 0xb3, 0xc3, 0x4d, 0x5e, 0xa2, 0xa0, 0x1b, 0x2f, 0x32,
+  0xc7, 0xd8, 0xdd, 0x5c, 0xa2, 0xd9, 0x97, 0x41, 0x77, 0x4b, 0x86, 0x86,
+  0x94, 0xdb, 0x54, 0x32, 0x95, 0x91, 0xdf, 0x48, 0x47, 0x31, 0x67, 0x70,
+  0x98, 0x19, 0xb8, 0x31, 0xf8, 0xe3, 0xfd, 0x48, 0x51, 0x0a, 0x7b, 0x88,
+  0x7c, 0x1a, 0x8a, 0x5f, 0xcc, 0x02, 0x07, 0x6a, 0xfd, 0x13, 0x5e, 0xfa,
+  0x10, 0x3c, 0x69, 0x46, 0xf4, 0x0a, 0x9d, 0x91, 0x0f, 0x8d, 0x71, 0xb9,
+  0x12, 0x30, 0xd5, 0xdf, 0x25, 0x39, 0xd5, 0x19, 0xd7, 0x06, 0x03, 0x33,
+  0xe9, 0x2f, 0x3c, 0xda, 0xb0, 0x8b, 0xae, 0x14, 0xbf, 0x85, 0xde, 0x51,
+  0xfd, 0xed, 0x81, 0x3f, 0xd1, 0x69, 0x06, 0x75, 0xeb, 0xca, 0x83, 0xa3,
+  0x7d, 0xa6, 0x67, 0xe0, 0x82, 0x4f, 0x1f, 0x20, 0xf0, 0x64, 0x63, 0x38,
+  0x5d, 0xce, 0xeb, 0xb8, 0xa0, 0xc3, 0x8a, 0x28, 0x97, 0x0f, 0x8b, 0x2c,
+  0x8d, 0x3e, 0x53, 0xec, 0x20, 0x69, 0xd3, 0xa6, 0xa1, 0x72, 0xf1, 0x96,
+  0x5c, 0x05, 0xa8, 0xaf, 0x30, 0xaf, 0xd4, 0x20, 0x63, 0xf1, 0x4b, 0x88,
+  0xb2, 0x43, 0xcd, 0x04, 0x3d, 0x1b, 0xb1, 0x95, 0xa1, 0x02, 0x93, 0x0b,
+  0xf1, 0xe9, 0x66, 0x24, 0xce, 0x1f, 0xf0, 0x43, 0xf4, 0xf7, 0xf3, 0x73,
+  0x55, 0x38, 0x77, 0xd2, 0x19, 0xbf, 0x34, 0x9f, 0x04, 0x5c, 0x7d, 0xc6,
+  0xd5, 0x5a, 0xa6, 0x86, 0xf0, 0xf9, 0xe5, 0xe9, 0xdf, 0xd3, 0xbf, 0xa7,
+  0x9c, 0x58, 0x1f, 0xa1, 0xa0, 0x23, 0x85, 0xa6, 0x58, 0xd7, 0x59, 0x55,
+  0x57, 0xe7, 0xcd, 0xea, 0x88, 0xee, 0x26, 0x21, 0x15, 0xf6, 0x52, 0x3a,
+  0x47, 0x08, 0x41, 0x9d, 0x15, 0x18, 0xee, 0xe8, 0xcf, 0x39, 0xe5, 0x6a,
+  0x97, 0x75, 0x6c, 0xd3, 0x59, 0x24, 0x11, 0x9f, 0xa7, 0xcf, 0x46, 0x20,
+  0x6a, 0xc2, 0x57, 0x4a, 0x2e, 0xa4, 0xd6, 0xa5, 0xce, 0x1f, 0xf5, 0x09,
+  0x84, 0xa4, 0x9a, 0x88, 0x58, 0x66, 0x7a, 0x22, 0x56, 0xeb, 0xa3, 0x8c,
+  0x42, 0xf3, 0xcc, 0x5b, 0xc4, 0x75, 0xe6, 0x9e, 0x3d, 0x20, 0xaa, 0x8e,
+  0x5b, 0x52, 0x9f, 0x77, 0x46, 0xed, 0x7d, 0x6e, 0x0c, 0x8a, 0xd7, 0xa1,
+  0x2d, 0x1c, 0xea, 0xf3, 0x8c, 0x89, 0x36, 0xde, 0x23, 0x0f, 0x42, 0xe6,
+  0x53, 0x08, 0x6a, 0xf1, 0xa4, 0x67, 0x5c, 0xdc, 0x2f, 0x9f, 0x91, 0xea,
+  0x11, 0xfd, 0xd2, 0x63, 0xc6, 0x11, 0xa8, 0xff, 0xaa, 0xaa, 0x42, 0x22,
+  0xd1, 0x5f, 0xa4, 0x88, 0x06, 0x03, 0x2d, 0x20, 0x73, 0xf1, 0x03, 0xd2,
+  0xaa, 0xb4, 0xae, 0xb8, 0x7a, 0xe6, 0x35, 0xa6, 0xf2, 0xa9, 0xea, 0x4a,
+  0x9e, 0x04, 0x7f, 0xa5, 0x52, 0x44, 0x5e, 0x5d, 0x14, 0x70, 0x76, 0x8b,
+  0xf0, 0x5b, 0x3c, 0x53, 0x3d, 0x8e, 0x92, 0x82, 0x0e, 0x7d, 0xe9, 0x04,
+  0x44, 0x79, 0x1a, 0x6f, 0xb9, 0x94, 0x79, 0xb5, 0xad, 0x18, 0xaf, 0xc9,
+  0xb3, 0xf1, 0x38, 0xff, 0xc4, 0x62, 0x28, 0x83, 0xfc, 0xa9, 0x43, 0x76,
+  0x42, 0x85, 0x07, 0x1d, 0xc0, 0x74, 0xf5, 0x48, 0x1f, 0x53, 0xb7, 0xe5,
+  0x46, 0xc2, 0xe2, 0x8d, 0xd8, 0xcf, 0xa0, 0x1a, 0xba, 0xa9, 0x9e, 0x2e,
+  0x1b, 0xea, 0xc6, 0x4b, 0x01, 0x83, 0xbe, 0x54, 0x19, 0x33, 0xd4, 0x4c,
+  0xf7, 0x62, 0x21, 0x8a, 0xf9, 0xa2, 0xac, 0x18, 0x79, 0xcb, 0x97, 0x98,
+  0x03, 0x9c, 0xbd, 0x4e, 0xa5, 0xc5, 0x74, 0xe3, 0x58, 0xf4, 0xac, 0xad,
+  0x0f, 0x94, 0x74, 0x7a, 0xd3, 0xd1, 0xa0, 0xbd, 0x94, 0x11, 0x3b, 0x44,
+  0xeb, 0x18, 0x3b, 0x1b, 0xc8, 0x54, 0x7d, 0x15, 0x62, 0xaa, 0x55, 0xe1,
+  0x2d, 0xa5, 0x0e, 0x6d, 0x75, 0x2e, 0xb8, 0xa9, 0x25, 0x05, 0x22, 0x72,
+  0xd3, 0x7c, 0x90, 0x0f, 0x4c, 0xe5, 0xb2, 0xcd, 0x5e, 0xe9, 0x71, 0xed,
+  0x39, 0x99, 0xc5, 0x55, 0xf9, 0x76, 0x65, 0xbf, 0x3b, 0xd1, 0x36, 0x76,
+  0xbe, 0xf5, 0x0a, 0x7d, 0xf0, 0xc8, 0x44, 0x6a, 0x19, 0x79, 0x56, 0x56,
+  0x39, 0x94, 0x57, 0x2d, 0x64, 0xd7, 0xa7, 0x60, 0x63, 0x9f, 0xbb, 0x29,
+  0xba, 0x9f, 0x91, 0xcc, 0xe7, 0x87, 0x7d, 0xc3, 0x67, 0xf4, 0xb5, 0xea,
+  0x6e, 0x4b, 0xc9, 0xd9, 0xda, 0x01, 0x03, 0x19, 0x1d, 0xed, 0x10, 0xa5,
+  0x1e, 0x9c, 0xab, 0xf1, 0xde, 0xc2, 0x3b, 0xdb, 0xe0, 0x15, 0x09, 0x06,
+  0x47, 0x09, 0x61, 0x13, 0x49, 0xf0, 0x5c, 0xce, 0xb3, 0xeb, 0xeb, 0xdb,
+  0x5b, 0xfa, 0x32, 0x5e, 0x22, 0x05, 0xa4, 0xc7, 0x24, 0xf7, 0x8a, 0x52,
+  0xde, 0xa4, 0x15, 0x77, 0x8e, 0x5e, 0x1f, 0xab, 0xec, 0x2c, 0x2a, 0xef,
+  0xbc, 0x3b, 0x85, 0x37, 0x54, 0x78, 0xc7, 0x67, 0xea, 0x39, 0xe0, 0xde,
+  0x83, 0xd7, 0xdf, 0x7f, 0x7f, 0x3c, 0x3c, 0xe4, 0x5f, 0x7e, 0x37, 0x99,
+  0x6d, 0x38, 0xb9, 0xf5, 0xaa, 0x70, 0x1c, 0xc4, 0x59, 0x56, 0x30, 0xe6,
+  0xab, 0x37, 0xc7, 0xc3, 0x91, 0x48, 0x26, 0x4c, 0xf5, 0x06, 0x78, 0x85,
+  0xa4, 0x7c, 0x89, 0x14, 0x17, 0x02, 0x19, 0x84, 0xc3, 0x71, 0xee, 0xf9,
+  0xbc, 0xd7, 0x83, 0x93, 0x91, 0x73, 0xec, 0x0c, 0x0f, 0x9d, 0x53, 0xe7,
+  0x50, 0x43, 0x93, 0x2d, 0x28, 0x92, 0x44, 0xbb, 0xa2, 0x30, 0x4c, 0x92,
+  0x79, 0x76, 0x8b, 0x81, 0x07, 0x6b, 0x2c, 0x07, 0x6c, 0x7f, 0xb3, 0x16,
+  0x2f, 0x2f, 0x62, 0x3d, 0x86, 0x40, 0xe4, 0xd3, 0x7d, 0x30, 0xc0, 0x50,
+  0xc3, 0x1f, 0x8f, 0x87, 0x66, 0xce, 0xb4, 0x8e, 0x63, 0xc3, 0x68, 0x3e,
+  0x59, 0x8f, 0xcb, 0x1c, 0x0a, 0xc1, 0x48, 0xbc, 0xe8, 0x7c, 0x1c, 0xcb,
+  0x74, 0x55, 0x85, 0xdf, 0x4c, 0x26, 0x27, 0x3b, 0x69, 0xc2, 0x46, 0x5a,
+  0xf9, 0x6f, 0xc7, 0xbf, 0x93, 0xb4, 0x68, 0x69, 0xad, 0xce, 0xd7, 0xbf,
+  0xf7, 0x44, 0x18, 0x22, 0xf7, 0xd7, 0xc2, 0xc4, 0x5b, 0xf8, 0xe3, 0x31,
+  0x7e, 0xde, 0x9e, 0x7c, 0xf7, 0xf2, 0x92, 0xd0, 0x6b, 0xf2, 0xf6, 0x87,
+  0x7f, 0xed, 0xcd, 0xa4, 0x1b, 0xe1, 0xbf, 0xbc, 0x39, 0x3e, 0x4c, 0xda,
+  0xab, 0x0d, 0x92, 0x4a, 0x79, 0x9c, 0xf2, 0x5d, 0x11, 0xc9, 0x60, 0x50,
+  0xca, 0x25, 0x16, 0x8d, 0xdf, 0x66, 0x7e, 0x34, 0xec, 0xf4, 0xdf, 0x44,
+  0xe5, 0xfb, 0x28, 0x8d, 0x90, 0xa3, 0x13, 0xe2, 0xcb, 0x0b, 0x7e, 0x49,
+  0x12, 0x84, 0xbf, 0x7b, 0xb3, 0x00, 0x79, 0xf5, 0xdd, 0x9b, 0x63, 0xb5,
+  0xa4, 0x56, 0x3f, 0x01, 0x0e, 0x18, 0xa0, 0xb6, 0xb2, 0x9c, 0x50, 0x07,
+  0xed, 0x24, 0x66, 0x09, 0xdf, 0x36, 0xd2, 0x0d, 0x0f, 0x9d, 0x50, 0x38,
+  0x87, 0xc9, 0xa1, 0x93, 0x38, 0x0c, 0x4c, 0x5a, 0x40, 0xea, 0x05, 0xb0,
+  0x3c, 0x74, 0x4a, 0xc7, 0x2e, 0x52, 0xb7, 0x9a, 0x35, 0xa2, 0x1e, 0x51,
+  0xf6, 0x65, 0xfc, 0x19, 0x39, 0x9c, 0xc1, 0x23, 0xb6, 0xd3, 0xd6, 0x3e,
+  0x28, 0x9c, 0xb8, 0x83, 0x6a, 0x19, 0x76, 0x60, 0xce, 0xf0, 0x27, 0x27,
+  0x4a, 0x3b, 0x79, 0x31, 0x76, 0xb4, 0xdd, 0x83, 0x64, 0xdf, 0xac, 0xf8,
+  0x51, 0x3e, 0xef, 0x20, 0x6f, 0xd3, 0xba, 0x50, 0x54, 0xd0, 0xb7, 0x88,
+  0xb9, 0xc7, 0x0c, 0x20, 0x63, 0xd4, 0x32, 0x54, 0xa0, 0xb1, 0x8c, 0x65,
+  0x6c, 0x16, 0x68, 0xe0, 0x6c, 0x23, 0x2d, 0xc5, 0x94, 0xb1, 0x2a, 0x71,
+  0x14, 0x01, 0x43, 0x27, 0x13, 0xda, 0xe9, 0x86, 0x10, 0x8b, 0x5e, 0x0f,
+  0xc0, 0xd8, 0xc8, 0x28, 0x3d, 0x5b, 0x5d, 0x4f, 0x2c, 0x14, 0x12, 0x38,
+  0x36, 0xb1, 0x64, 0x9a, 0x52, 0x90, 0xf9, 0x71, 0x4a, 0x19, 0x6f, 0x65,
+  0x6a, 0xce, 0x5e, 0x1e, 0xd7, 0x13, 0xcb, 0x16, 0x89, 0x21, 0x4b, 0x49,
+  0x06, 0x19, 0xad, 0x9a, 0x0e, 0x0f, 0x0c, 0xd6, 0x74, 0x32, 0xb0, 0x85,
+  0xd8, 0x6f, 0x54, 0xf2, 0xfe, 0xfe, 0xf2, 0x62, 0x3b, 0x50, 0x18, 0xab,
+  0xe1, 0xd7, 0x66, 0x04, 0xc3, 0x10, 0x87, 0xd8, 0xc9, 0x74, 0xdc, 0xcf,
+  0xbd, 0x5e, 0x5e, 0x3a, 0x7d, 0xaf, 0x51, 0x12, 0x2b, 0x2d, 0xf9, 0x46,
+  0x77, 0x0d, 0x18, 0x6d, 0xd8, 0x30, 0xdb, 0x86, 0x75, 0x68, 0x4f, 0x5a,
+  0x48, 0x5f, 0x95, 0xf8, 0x9c, 0xad, 0xd5, 0x8f, 0xd6, 0x1d, 0x11, 0xfa,
+  0x56, 0x7e, 0x9c, 0xdd, 0x5e, 0xcf, 0x6f, 0xa7, 0x83, 0x25, 0x72, 0xbc,
+  0x11, 0xa5, 0x16, 0xb0, 0xab, 0xd1, 0x14, 0x2b, 0xa0, 0x6a, 0x7e, 0x19,
+  0x97, 0x13, 0x27, 0xa1, 0x93, 0x0d, 0x2a, 0x82, 0x9f, 0x2a, 0xb5, 0x14,
+  0x13, 0x86, 0xc1, 0xf5, 0xae, 0xe0, 0xcc, 0xcc, 0xd2, 0x70, 0xac, 0x56,
+  0x5a, 0x77, 0x2d, 0x11, 0x0b, 0x87, 0x86, 0x5d, 0x78, 0x84, 0x6a, 0x07,
+  0x6d, 0xc2, 0xb9, 0x2d, 0xb3, 0x77, 0x0d, 0xa3, 0x03, 0xf9, 0xbe, 0x51,
+  0x34, 0x78, 0xd7, 0x10, 0x7c, 0x1c, 0xd6, 0x27, 0xa7, 0xf3, 0x93, 0x2d,
+  0x2e, 0x08, 0x73, 0xd7, 0x08, 0x2a, 0x82, 0xbb, 0xba, 0x4a, 0x31, 0x43,
+  0x64, 0x8f, 0x5d, 0x06, 0x08, 0x67, 0x17, 0x35, 0x87, 0x6e, 0x97, 0xef,
+  0x51, 0x18, 0x52, 0x25, 0xd9, 0x16, 0x35, 0xe3, 0xec, 0x22, 0xd6, 0xc9,
+  0xb7, 0xab, 0x03, 0xf7, 0x67, 0x0a, 0xfa, 0x7b, 0x47, 0xa1, 0x48, 0xbf,
+  0x6b, 0x10, 0x15, 0xe7, 0x5d, 0x1b, 0xdf, 0xf7, 0x4a, 0x41, 0x21, 0xee,
+  0xdc, 0x07, 0x13, 0xf0, 0x5d, 0x15, 0xf0, 0xf7, 0x0e, 0x61, 0x11, 0x77,
+  0x8d, 0xa2, 0xf2, 0x01, 0x73, 0x29, 0x61, 0xef, 0x18, 0x0a, 0x6d, 0xd7,
+  0x00, 0xa4, 0xa7, 0x7a, 0x1f, 0x38, 0x5f, 0xd8, 0x2f, 0x0b, 0x82, 0xee,
+  0x66, 0x81, 0x4e, 0xec, 0xf7, 0xcf, 0x0c, 0x28, 0x91, 0x81, 0x42, 0xdb,
+  0x04, 0xdc, 0xf7, 0x17, 0x42, 0x10, 0x87, 0x13, 0xe1, 0x88, 0x81, 0x73,
+  0xd8, 0x0f, 0x41, 0x1a, 0x0f, 0x21, 0x7b, 0xc8, 0xc7, 0x3d, 0xda, 0xad,
+  0x3b, 0x3f, 0x96, 0x39, 0x7f, 0x53, 0xf7, 0x4a, 0x4c, 0x74, 0x88, 0xe9,
+  0x0e, 0x9d, 0xb7, 0xce, 0x21, 0x46, 0x3a, 0x74, 0x7e, 0x7c, 0x45, 0xb0,
+  0xb7, 0x1d, 0xaf, 0xcf, 0x47, 0x5c, 0xc6, 0xe3, 0x4f, 0xe1, 0x69, 0x1a,
+  0xf7, 0xf6, 0x3f, 0x70, 0x42, 0x0a, 0xb1, 0xac, 0x26, 0x70, 0xcb, 0xa3,
+  0x6a, 0x38, 0x79, 0xfb, 0x45, 0x7b, 0xc6, 0x96, 0xa3, 0x96, 0x43, 0x21,
+  0xc7, 0x15, 0xb8, 0xbd, 0xc8, 0x50, 0x2d, 0xa5, 0xd5, 0xa4, 0xfa, 0x6a,
+  0x08, 0xab, 0x3f, 0x27, 0xec, 0x9e, 0x92, 0xf1, 0xdd, 0x46, 0x07, 0x04,
+  0x18, 0xa2, 0x44, 0xf6, 0x50, 0xf5, 0x8f, 0x87, 0x9c, 0xd1, 0x74, 0xdc,
+  0xeb, 0x1a, 0xf6, 0x51, 0xd5, 0xd9, 0x54, 0x83, 0x47, 0xed, 0x6d, 0x24,
+  0x3a, 0xa5, 0x6a, 0xe1, 0x20, 0x4b, 0xdf, 0x39, 0x25, 0x97, 0xf0, 0x5b,
+  0xb3, 0x72, 0xaf, 0x21, 0x78, 0xda, 0xe2, 0xd2, 0x0d, 0xa3, 0x94, 0x59,
+  0xd8, 0x75, 0xc2, 0xb5, 0x83, 0x8c, 0x63, 0xe3, 0x4e, 0x9a, 0x36, 0xef,
+  0x4f, 0x1d, 0xee, 0xf7, 0xe0, 0xb7, 0xd6, 0xb1, 0xed, 0xb6, 0xa1, 0x8c,
+  0xbd, 0xbe, 0x9d, 0xc8, 0x66, 0xc9, 0xfd, 0xbe, 0x16, 0x23, 0xfd, 0x71,
+  0xba, 0xdc, 0xec, 0x98, 0xa5, 0x02, 0x61, 0xb8, 0x6b, 0x37, 0xf7, 0x88,
+  0xa8, 0x8b, 0x6f, 0xb6, 0x74, 0x97, 0x6c, 0x7a, 0x98, 0x6a, 0x5f, 0x77,
+  0x08, 0x45, 0xe1, 0xed, 0x12, 0xca, 0x3e, 0x9e, 0xb5, 0xf6, 0xcb, 0x6a,
+  0x0e, 0x43, 0x1e, 0x68, 0x1b, 0xf9, 0xf6, 0x5b, 0xfd, 0x42, 0xaa, 0x3b,
+  0xfc, 0xa9, 0xd5, 0x50, 0xf7, 0x8e, 0x94, 0x8c, 0x16, 0x55, 0xba, 0xa5,
+  0x14, 0x7c, 0xe9, 0x4b, 0x8d, 0x36, 0xdc, 0xc6, 0x62, 0x1d, 0xf8, 0x13,
+  0x94, 0x2c, 0xdf, 0x83, 0xb1, 0xb5, 0x1d, 0x5d, 0xb4, 0x9e, 0x3b, 0xd0,
+  0x6e, 0xc0, 0x78, 0x01, 0xbd, 0x84, 0xff, 0xb7, 0xb5, 0x93, 0x18, 0x91,
+  0x00, 0x36, 0x74, 0x8b, 0xc9, 0xf4, 0xb7, 0xc7, 0xdf, 0x55, 0x32, 0xa2,
+  0xdd, 0xd7, 0xc2, 0x1a, 0xb6, 0x36, 0xf5, 0xe9, 0x98, 0x5f, 0x5a, 0xc6,
+  0xa7, 0x0e, 0xc8, 0xc8, 0xe0, 0xe8, 0xcd, 0x02, 0x22, 0xde, 0xd7, 0xa8,
+  0x51, 0x6f, 0x7b, 0x83, 0x99, 0xfa, 0x6d, 0xa3, 0x0b, 0xae, 0x9e, 0x2c,
+  0xb0, 0x7a, 0xb2, 0x20, 0xba, 0x27, 0xa1, 0xf6, 0xdd, 0x6b, 0x86, 0xab,
+  0xf5, 0x1d, 0xe6, 0xe9, 0x58, 0xbd, 0x59, 0x40, 0x73, 0x63, 0x94, 0x80,
+  0x4d, 0xcb, 0x22, 0xd0, 0xe5, 0xd1, 0xe9, 0x38, 0x2b, 0x6c, 0x87, 0x3e,
+  0xe6, 0xc7, 0xd2, 0xf4, 0x39, 0x3f, 0x75, 0x67, 0xb9, 0x06, 0xf0, 0x55,
+  0x20, 0x0b, 0xe5, 0xd6, 0x16, 0x8a, 0xfa, 0xb2, 0x60, 0x71, 0xb8, 0xb9,
+  0x85, 0xc4, 0x5f, 0x1b, 0x2c, 0x0e, 0xb5, 0xba, 0x3c, 0x97, 0xfa, 0xee,
+  0xb5, 0x66, 0x5a, 0x35, 0x2d, 0xca, 0x52, 0xdf, 0xc4, 0x9e, 0x8e, 0xd5,
+  0x5b, 0xcf, 0xfd, 0xf1, 0x31, 0x80, 0xf1, 0x7a, 0x68, 0x58, 0xb0, 0xb9,
+  0xa3, 0x4d, 0x50, 0xf3, 0x6e, 0x81, 0xed, 0x9b, 0xda, 0x84, 0xd0, 0x6e,
+  0x77, 0x91, 0xe8, 0xb6, 0xb6, 0xc5, 0xa0, 0x46, 0x23, 0x3d, 0xbd, 0x0d,
+  0x9d, 0x4d, 0xb0, 0x57, 0x15, 0x0c, 0x84, 0x1b, 0xdb, 0x60, 0xed, 0x54,
+  0xda, 0xed, 0xee, 0xbc, 0x66, 0x0c, 0xdb, 0x68, 0xc0, 0xf6, 0x26, 0x37,
+  0xc3, 0x6d, 0xab, 0xd1, 0x10, 0x7d, 0x97, 0x9b, 0x75, 0x44, 0xbf, 0x37,
+  0x4a, 0xa0, 0x6f, 0x67, 0x43, 0x11, 0xf8, 0xcd, 0x02, 0xe8, 0x16, 0x36,
+  0x75, 0xd3, 0xb3, 0x1f, 0x62, 0xa2, 0x76, 0x0c, 0x8a, 0xb6, 0x22, 0x90,
+  0x21, 0x6d, 0x35, 0x2d, 0x8a, 0xa7, 0xae, 0x13, 0x4f, 0xc7, 0xfc, 0xd2,
+  0x6c, 0xbc, 0xde, 0x99, 0xce, 0xae, 0xac, 0xf8, 0x6a, 0xf1, 0x74, 0x4c,
+  0x4f, 0xdb, 0xb9, 0xa8, 0x03, 0xea, 0xc3, 0xa3, 0x25, 0x20, 0x7d, 0xc3,
+  0x98, 0xc4, 0xc3, 0xaf, 0x0d, 0x48, 0x7d, 0x59, 0x04, 0x80, 0x5e, 0x1a,
+  0x65, 0x30, 0xd7, 0x2e, 0xa1, 0x0b, 0xea, 0xb5, 0x01, 0xc9, 0x82, 0x27,
+  0xa0, 0x67, 0x8b, 0xeb, 0x4a, 0x33, 0x5d, 0x65, 0x1d, 0x4b, 0x35, 0x66,
+  0xda, 0x37, 0xdf, 0x93, 0x96, 0xfd, 0x9e, 0xb4, 0x0d, 0x4c, 0x5d, 0x4c,
+  0x66, 0xe5, 0xa7, 0xd7, 0x2e, 0xc8, 0x7c, 0x84, 0xb6, 0x08, 0xa6, 0xa3,
+  0x87, 0x16, 0xab, 0x8b, 0x26, 0x06, 0x89, 0x9b, 0x3d, 0x94, 0xc6, 0x1f,
+  0xb5, 0xdb, 0x3d, 0x24, 0xfe, 0x06, 0x6e, 0x30, 0xd0, 0xe8, 0x81, 0x13,
+  0xef, 0xa9, 0x01, 0xa3, 0xd1, 0x03, 0x2f, 0xf3, 0xba, 0x01, 0xa3, 0xd1,
+  0x67, 0xd2, 0x2b, 0xdb, 0x3c, 0xa2, 0xd5, 0x52, 0xd9, 0x55, 0xa9, 0x94,
+  0x75, 0x65, 0x58, 0x5a, 0xb8, 0x65, 0xb1, 0x76, 0x33, 0xde, 0x6f, 0x75,
+  0x55, 0xbb, 0x0b, 0x08, 0x02, 0x0b, 0x09, 0x02, 0x0b, 0x2a, 0xa4, 0x56,
+  0x5e, 0x75, 0x6b, 0xbb, 0xd5, 0xaf, 0x2e, 0x6a, 0x33, 0x80, 0x5e, 0x2d,
+  0xc4, 0xb7, 0xf7, 0xb5, 0x01, 0x33, 0x8d, 0x66, 0x2a, 0xfd, 0x7f, 0x06,
+  0xac, 0xbd, 0xfa, 0xdd, 0x02, 0xbb, 0x97, 0xfd, 0x1b, 0xef, 0x2d, 0xbb,
+  0x8e, 0x62, 0xe1, 0xda, 0x7f, 0x3e, 0x20, 0x1c, 0xdb, 0xb0, 0x60, 0xac,
+  0xda, 0xf5, 0x59, 0x09, 0x3a, 0xf7, 0xff, 0x7b, 0x70, 0x37, 0xdf, 0xc2,
+  0x30, 0x37, 0x53, 0x1a, 0xb5, 0xec, 0x5f, 0x10, 0x67, 0x1d, 0xed, 0x77,
+  0x36, 0xe6, 0xa9, 0xae, 0x87, 0x63, 0x69, 0xf4, 0xd2, 0xda, 0xae, 0x42,
+  0xed, 0x53, 0xcb, 0xc9, 0x86, 0xec, 0xa1, 0xf1, 0x68, 0x63, 0xf1, 0xc7,
+  0x7e, 0x8d, 0xca, 0xef, 0xcd, 0xc8, 0x26, 0x25, 0xe9, 0x26, 0x67, 0x7c,
+  0x9e, 0xcf, 0x11, 0x8b, 0x5e, 0x6c, 0x37, 0xdd, 0x0d, 0xa4, 0x5e, 0x7a,
+  0x76, 0x82, 0x9b, 0xbe, 0x26, 0x6e, 0x62, 0x9c, 0x6e, 0x36, 0x2c, 0xe8,
+  0xfb, 0xe2, 0xcc, 0x82, 0x7e, 0xb7, 0xc0, 0x74, 0xcd, 0x33, 0xe1, 0xd1,
+  0xd8, 0x22, 0xb3, 0xb4, 0x69, 0xf8, 0xd1, 0xb4, 0x6d, 0xb2, 0x7c, 0xc3,
+  0x8b, 0xc7, 0xa3, 0x6f, 0x8a, 0xea, 0x4a, 0x95, 0x35, 0x44, 0x6a, 0xda,
+  0xdc, 0x2a, 0x4c, 0x38, 0xd7, 0x78, 0xfc, 0xdf, 0x16, 0x08, 0x94, 0x6a,
+  0x20, 0xd3, 0xa0, 0x32, 0x21, 0x4c, 0x28, 0xad, 0x53, 0x7e, 0xcf, 0xb1,
+  0x37, 0x88, 0xe9, 0x80, 0x46, 0x41, 0x94, 0xf3, 0x73, 0xec, 0x8d, 0xe0,
+  0x06, 0x12, 0xe6, 0x81, 0x01, 0xd0, 0x6b, 0xbb, 0x9f, 0x6e, 0x6d, 0xb4,
+  0x60, 0xdc, 0xb4, 0x70, 0xf6, 0x9c, 0x8e, 0xb9, 0x21, 0xdc, 0xf4, 0x2b,
+  0xe7, 0xe6, 0xd8, 0xeb, 0xbe, 0x0d, 0x84, 0xd2, 0x10, 0x47, 0x5f, 0xb0,
+  0x6d, 0xf5, 0x92, 0xbe, 0x38, 0xe6, 0x06, 0x48, 0xd3, 0xcf, 0x4a, 0xe3,
+  0x98, 0x3b, 0xae, 0x4d, 0xbf, 0x56, 0x3b, 0xa7, 0xb9, 0x71, 0xdb, 0x82,
+  0x29, 0xc5, 0x71, 0x9a, 0x3b, 0xaa, 0xad, 0xf5, 0x28, 0xed, 0x71, 0x9a,
+  0x1b, 0xa8, 0x0d, 0x4c, 0xa9, 0x90, 0x63, 0xaf, 0x9a, 0xb6, 0xb8, 0xa0,
+  0x3d, 0x76, 0xcc, 0x6d, 0xcf, 0xa6, 0x9f, 0x37, 0xda, 0x31, 0x57, 0x39,
+  0x3b, 0xab, 0xd1, 0x7a, 0xed, 0x74, 0x2e, 0xb5, 0x34, 0x18, 0x3a, 0x86,
+  0x38, 0xcd, 0xf5, 0x94, 0x36, 0x75, 0xc7, 0x6d, 0x3b, 0xdb, 0x17, 0x8a,
+  0xfa, 0xb8, 0xda, 0x77, 0x3b, 0xfd, 0x7b, 0x41, 0x0d, 0x9e, 0x09, 0xc9,
+  0x4e, 0xeb, 0x56, 0x65, 0x6b, 0x94, 0x26, 0xa3, 0x70, 0xba, 0xb7, 0x21,
+  0x9d, 0x56, 0x62, 0x4d, 0xba, 0xe4, 0x6a, 0x0f, 0xd4, 0xf2, 0x3d, 0x80,
+  0x90, 0x2e, 0xed, 0x86, 0x40, 0x29, 0x76, 0x03, 0x48, 0x29, 0x76, 0x43,
+  0x20, 0x2c, 0x92, 0xd5, 0x5e, 0xe0, 0x6e, 0x40, 0x2b, 0xd5, 0xef, 0x83,
+  0x78, 0x9b, 0xf7, 0x50, 0x91, 0xe6, 0xec, 0x06, 0x41, 0xdd, 0xf6, 0xb0,
+  0xf0, 0xb4, 0x87, 0x20, 0xaf, 0x77, 0x03, 0xb2, 0xd0, 0x35, 0xd7, 0xf9,
+  0x76, 0x80, 0x6c, 0xdc, 0xed, 0x41, 0x78, 0x8b, 0xf6, 0x70, 0x60, 0x33,
+  0xba, 0x9d, 0x60, 0xca, 0x8d, 0xf6, 0x48, 0x22, 0xdf, 0xd7, 0xcf, 0x66,
+  0xdd, 0x05, 0xea, 0x0a, 0x28, 0xac, 0xfe, 0xd4, 0x2d, 0xb5, 0x4b, 0x20,
+  0xed, 0x8d, 0xa8, 0xb4, 0x09, 0x75, 0x7d, 0xcc, 0x7a, 0xa3, 0x6a, 0xe2,
+  0xae, 0x53, 0xb2, 0x18, 0xac, 0x3f, 0x6d, 0x0c, 0xe3, 0x9c, 0x2c, 0x06,
+  0x71, 0xd8, 0x46, 0xd0, 0x4e, 0xaa, 0x03, 0xa7, 0x15, 0xf4, 0x70, 0x8c,
+  0xb3, 0xb2, 0x78, 0xa4, 0x8f, 0x6d, 0x1c, 0xed, 0xb4, 0x2c, 0x9c, 0xd5,
+  0xb2, 0x8d, 0x60, 0x9c, 0x97, 0xc5, 0x20, 0x0d, 0x6c, 0x23, 0x68, 0x77,
+  0xd5, 0x81, 0xb3, 0xfe, 0xf6, 0x90, 0xac, 0x03, 0xb0, 0x98, 0xed, 0xc3,
+  0x82, 0x9e, 0xb3, 0x6a, 0xd6, 0xc5, 0xba, 0xdb, 0x59, 0x95, 0x71, 0x5a,
+  0x16, 0x87, 0xff, 0x43, 0xa8, 0x8d, 0x62, 0x9c, 0x57, 0x33, 0x13, 0xab,
+  0x79, 0x67, 0x26, 0xe3, 0x32, 0x2d, 0x0e, 0xe9, 0x7b, 0x1b, 0x43, 0xbb,
+  0xdb, 0x66, 0x5d, 0x4f, 0xdd, 0x15, 0x3d, 0x75, 0xa9, 0xa1, 0xfc, 0x1d,
+  0x6a, 0xe5, 0x26, 0x2d, 0x1c, 0xee, 0xb1, 0x03, 0xd7, 0xee, 0xd2, 0xc2,
+  0xd9, 0x05, 0x76, 0x30, 0xac, 0x53, 0x6c, 0x49, 0x96, 0x1c, 0x1b, 0xe1,
+  0xfc, 0xa9, 0x73, 0xdc, 0x45, 0xf3, 0xcf, 0x9c, 0xa4, 0xc5, 0xd7, 0x66,
+  0xd7, 0x66, 0xa4, 0x71, 0x96, 0xcd, 0xa8, 0xd6, 0x00, 0x3b, 0x22, 0xe9,
+  0x3b, 0xcd, 0x4a, 0x85, 0x55, 0x24, 0x1e, 0x79, 0xd0, 0xee, 0x52, 0x11,
+  0x95, 0xbb, 0xe9, 0x15, 0x20, 0x7b, 0xc7, 0x8e, 0x63, 0xfa, 0x44, 0x1f,
+  0x04, 0x9c, 0x35, 0x67, 0x15, 0xba, 0xa2, 0x98, 0xc3, 0xd2, 0x06, 0x54,
+  0xa6, 0x6c, 0x1f, 0x58, 0xa0, 0xb7, 0xf9, 0x40, 0x87, 0x06, 0x7d, 0xa0,
+  0x7b, 0x79, 0x51, 0x5f, 0xcf, 0xd0, 0xfc, 0x71, 0x72, 0xf2, 0xc3, 0x1b,
+  0xfb, 0x95, 0xcc, 0x96, 0x28, 0xea, 0x3f, 0xc2, 0x1a, 0xa4, 0x1f, 0x5e,
+  0x9f, 0xec, 0x40, 0x32, 0xff, 0x24, 0xd0, 0xe0, 0xd1, 0xbf, 0x3d, 0xed,
+  0x40, 0x54, 0xff, 0x22, 0x75, 0xb6, 0x0d, 0xa0, 0x7f, 0x04, 0x3a, 0xeb,
+  0x7c, 0x63, 0x7c, 0x97, 0x65, 0xf1, 0x60, 0xb1, 0x63, 0x21, 0xe6, 0x74,
+  0xe4, 0xa7, 0x7f, 0xb4, 0x8f, 0x77, 0xb3, 0xc7, 0xb7, 0x7f, 0xf9, 0x32,
+  0x1d, 0x3f, 0xcb, 0xf2, 0xe5, 0x85, 0xff, 0xa7, 0xf4, 0xab, 0x3e, 0xe1,
+  0xfd, 0xc7, 0x69, 0x07, 0x6f, 0xe1, 0xf9, 0x8c, 0x98, 0x66, 0xc0, 0xbb,
+  0xbb, 0x6f, 0xd0, 0xba, 0x1f, 0x38, 0x8b, 0x35, 0xcd, 0x6d, 0xa7, 0x72,
+  0x7a, 0x53, 0x5d, 0xdd, 0x9d, 0xbf, 0x9b, 0x5e, 0x5d, 0x9a, 0x43, 0xe4,
+  0x53, 0xa7, 0x3f, 0xc5, 0xe5, 0xcd, 0xac, 0x83, 0xd1, 0xfa, 0x86, 0x16,
+  0x66, 0x1b, 0xba, 0xdf, 0x8f, 0x32, 0x7e, 0x90, 0x94, 0xab, 0xe1, 0x7f,
+  0x57, 0xf7, 0x64, 0xcb, 0x6d, 0x1c, 0x49, 0xfe, 0x0a, 0x14, 0x61, 0xb3,
+  0xd1, 0xc1, 0xe6, 0x21, 0x79, 0xe4, 0xb0, 0x05, 0x43, 0x0c, 0x49, 0x96,
+  0x46, 0xda, 0xd1, 0xe1, 0x10, 0xe5, 0xb1, 0x37, 0xbc, 0x5e, 0x08, 0x47,
+  0x93, 0x00, 0x09, 0xa0, 0xb1, 0xe8, 0x06, 0x29, 0x9a, 0x44, 0xc4, 0xfc,
+  0xc3, 0xcc, 0x37, 0xec, 0xf3, 0xbe, 0xed, 0xfb, 0x7c, 0xca, 0x7c, 0xc9,
+  0x66, 0x66, 0x5d, 0x59, 0x59, 0x55, 0x0d, 0xdb, 0xb3, 0xfb, 0xb0, 0x11,
+  0xb6, 0x88, 0xae, 0xcc, 0x3a, 0x32, 0xeb, 0xca, 0xaa, 0xca, 0xe3, 0xb6,
+  0xf3, 0x59, 0x37, 0xab, 0xae, 0x60, 0xfe, 0xd7, 0x30, 0x29, 0xbd, 0xb5,
+  0x12, 0x52, 0x7a, 0x1a, 0x0a, 0x90, 0xba, 0xb9, 0x99, 0x97, 0x87, 0x93,
+  0x59, 0x8d, 0x37, 0x00, 0xfd, 0xec, 0x6c, 0x5e, 0x7e, 0xf2, 0x6e, 0xaf,
+  0xd5, 0xa1, 0xe3, 0x54, 0x69, 0xd7, 0x8a, 0xc7, 0xca, 0xe0, 0xe2, 0x0a,
+  0x8a, 0x76, 0xef, 0x8f, 0x67, 0xc3, 0x71, 0x53, 0xad, 0x6f, 0xf4, 0xf9,
+  0x21, 0x3f, 0x81, 0x23, 0xb1, 0xb5, 0x1a, 0xa5, 0xdf, 0xda, 0xae, 0xb4,
+  0x17, 0x34, 0xbe, 0xd7, 0xb1, 0xd5, 0x37, 0xb3, 0xf1, 0x25, 0xde, 0x97,
+  0x9f, 0x95, 0xcd, 0x78, 0xda, 0xcd, 0x8e, 0x86, 0xab, 0xd9, 0x91, 0x39,
+  0x10, 0xde, 0x8e, 0xd1, 0x9e, 0xe6, 0x51, 0xb6, 0xac, 0x0e, 0xd0, 0x04,
+  0xb5, 0xcc, 0xb6, 0x39, 0x8a, 0xb8, 0xcb, 0xee, 0x1a, 0x36, 0x0d, 0x1c,
+  0x33, 0xeb, 0xc3, 0xea, 0x12, 0xdf, 0xbd, 0xaa, 0x31, 0xa9, 0xaf, 0x40,
+  0x9d, 0x78, 0x00, 0xe9, 0x72, 0xb5, 0x4f, 0xbc, 0xa0, 0x83, 0x09, 0x54,
+  0x6d, 0x9a, 0x2e, 0x56, 0x55, 0x3c, 0x38, 0x3e, 0x3e, 0x26, 0x38, 0x94,
+  0x35, 0x46, 0x4d, 0xf0, 0x6e, 0x17, 0xb6, 0xa0, 0x28, 0x56, 0xae, 0x9f,
+  0xe7, 0x3c, 0xc8, 0x1f, 0x74, 0x7e, 0xa7, 0x97, 0xb0, 0x51, 0x36, 0xa4,
+  0x2f, 0x88, 0x80, 0xcd, 0x7a, 0x5e, 0x8c, 0xaa, 0xc9, 0x8d, 0x1d, 0x04,
+  0x67, 0x36, 0xf9, 0x76, 0x51, 0x36, 0xd3, 0x0a, 0x8d, 0x0b, 0xde, 0x9d,
+  0xa2, 0xb5, 0xa5, 0xa0, 0x0d, 0x8d, 0x4f, 0x27, 0x70, 0x68, 0x7a, 0x74,
+  0x9b, 0xe9, 0x8e, 0x3c, 0xf8, 0x70, 0xb3, 0x2a, 0x61, 0x90, 0xe0, 0x85,
+  0xe2, 0x4c, 0x51, 0x78, 0xf4, 0xe9, 0xe0, 0xfa, 0xfa, 0xfa, 0x00, 0x0d,
+  0x7b, 0x0e, 0xa0, 0x4c, 0xe8, 0x31, 0x58, 0xfd, 0x27, 0xbd, 0xf1, 0x14,
+  0x67, 0x68, 0xd3, 0xff, 0xfe, 0xc3, 0x8b, 0x83, 0xaf, 0x60, 0xdd, 0xf8,
+  0xf1, 0x80, 0x94, 0xc0, 0xdf, 0xbc, 0x7a, 0x76, 0xf0, 0xec, 0xf4, 0xfd,
+  0x0b, 0x28, 0xe3, 0x7e, 0xb6, 0xa5, 0x76, 0x3d, 0xc2, 0x7f, 0xf0, 0xba,
+  0x70, 0x9b, 0xb3, 0x1b, 0xcb, 0x71, 0xd3, 0x1d, 0xe6, 0xb7, 0x3e, 0x25,
+  0xaa, 0x2b, 0x86, 0x84, 0x71, 0x94, 0xed, 0x0f, 0x8b, 0x2c, 0x73, 0xdc,
+  0x5f, 0x1f, 0x5e, 0xd4, 0xd5, 0xb2, 0x9b, 0xeb, 0x14, 0xe4, 0xfa, 0x93,
+  0xf9, 0x3c, 0x97, 0xa3, 0xea, 0x6d, 0x75, 0x8d, 0x7d, 0x2b, 0x86, 0x98,
+  0x7e, 0x4c, 0xc2, 0xe5, 0x0c, 0x6b, 0x66, 0x9f, 0xfc, 0xbd, 0x53, 0x1d,
+  0x77, 0x13, 0x25, 0x88, 0xa1, 0xa7, 0x0b, 0x0a, 0x52, 0xb5, 0x42, 0x2e,
+  0xaa, 0xf4, 0xd4, 0xfd, 0x5b, 0x7b, 0x8b, 0x5a, 0x4e, 0x66, 0x0d, 0x7d,
+  0xeb, 0x51, 0xfe, 0xee, 0x8f, 0x83, 0xd3, 0x0f, 0xaf, 0x9e, 0xfd, 0xe9,
+  0x5f, 0x07, 0xdf, 0xfd, 0xd8, 0x7f, 0xf0, 0x07, 0xa5, 0x16, 0x0d, 0xa7,
+  0x58, 0x54, 0x93, 0x3d, 0x1d, 0xaf, 0xab, 0xf9, 0xbc, 0xdf, 0xac, 0x37,
+  0xa5, 0x4d, 0x7f, 0x06, 0x5b, 0x65, 0xb5, 0x76, 0x7a, 0x08, 0x58, 0xc0,
+  0x9f, 0x5f, 0x3d, 0xff, 0x61, 0xf0, 0xe6, 0xc9, 0x8f, 0xfd, 0x2f, 0x1f,
+  0x3e, 0xfc, 0xe2, 0x4b, 0xa7, 0xb6, 0x32, 0xab, 0x5f, 0x57, 0xe7, 0x6f,
+  0xcb, 0xe1, 0xfa, 0x69, 0xd5, 0x34, 0xd5, 0xa2, 0x5b, 0xce, 0x89, 0x1c,
+  0x1a, 0x1b, 0xf8, 0x8c, 0x5d, 0x53, 0xf9, 0x2f, 0x4b, 0x52, 0x2d, 0x3d,
+  0xe8, 0xd8, 0x94, 0x0f, 0xd5, 0x4a, 0x7d, 0xaa, 0xab, 0x43, 0x85, 0x90,
+  0x77, 0xbe, 0xe9, 0xfb, 0xcd, 0xe5, 0x3c, 0x1b, 0xc1, 0xbc, 0x84, 0xca,
+  0x54, 0x8b, 0xdd, 0x1b, 0xd4, 0xfc, 0x1c, 0x9f, 0xd8, 0xe9, 0x1e, 0x43,
+  0x3f, 0xa9, 0xcf, 0xcf, 0x51, 0xcd, 0x64, 0x7e, 0x7e, 0x88, 0xda, 0xcf,
+  0xc0, 0xaa, 0xc3, 0x51, 0xb5, 0x51, 0x53, 0xfa, 0x7e, 0xe6, 0x9e, 0xa6,
+  0x03, 0x38, 0x40, 0x29, 0x75, 0x38, 0x99, 0x3c, 0xbf, 0x82, 0x36, 0xbd,
+  0x86, 0xf3, 0x7d, 0xb9, 0x2c, 0xd7, 0xdd, 0x4c, 0x35, 0x39, 0x2b, 0x70,
+  0x2a, 0xdd, 0x0a, 0xce, 0x49, 0x06, 0xcc, 0x71, 0xfa, 0x6f, 0xa5, 0x7e,
+  0xc0, 0x55, 0xf7, 0xb2, 0xb8, 0xca, 0x6f, 0xaf, 0xfa, 0x5a, 0x89, 0xe0,
+  0xea, 0xe4, 0x84, 0xc6, 0xdb, 0x7a, 0xb6, 0xe8, 0xe6, 0x30, 0xaf, 0x61,
+  0xf1, 0xc2, 0x7e, 0x2f, 0xb2, 0xa2, 0x93, 0x1d, 0x66, 0xec, 0xed, 0x3e,
+  0xcb, 0x6d, 0x7b, 0xb1, 0x97, 0x7f, 0xba, 0xfc, 0xb9, 0xff, 0x2d, 0xc8,
+  0x81, 0xb0, 0x50, 0xc3, 0xc0, 0xd9, 0x7f, 0x08, 0xb3, 0x15, 0xb6, 0xc1,
+  0x12, 0x3a, 0xae, 0x54, 0xdd, 0x0e, 0x08, 0xa6, 0xdb, 0x70, 0x2a, 0xf4,
+  0x33, 0x54, 0xa9, 0xc8, 0xf6, 0xd5, 0x4c, 0xfa, 0xfe, 0xfd, 0x2b, 0xb4,
+  0xd2, 0xab, 0x96, 0x40, 0x1d, 0x48, 0x9b, 0xfb, 0xd9, 0x9e, 0xd2, 0x32,
+  0x88, 0xc2, 0xf1, 0x81, 0x3e, 0x36, 0x65, 0x48, 0xda, 0xa5, 0x35, 0xe0,
+  0xd7, 0x4f, 0x17, 0xe4, 0xc0, 0xfb, 0xe1, 0x75, 0x1b, 0x13, 0xfe, 0x7f,
+  0x13, 0x88, 0x63, 0x93, 0x4c, 0x03, 0x61, 0xcc, 0x17, 0xd0, 0xa2, 0xfc,
+  0x56, 0xeb, 0x76, 0x98, 0xde, 0x83, 0x91, 0x1e, 0x8e, 0x2b, 0x40, 0x54,
+  0xc6, 0x5c, 0x25, 0x8c, 0x2b, 0x3c, 0x16, 0x1c, 0x22, 0x31, 0xd0, 0xeb,
+  0xcf, 0x51, 0x69, 0x34, 0xcb, 0x6f, 0xad, 0xee, 0x89, 0xd5, 0x53, 0xd9,
+  0x6e, 0x45, 0xad, 0x84, 0x8a, 0xb5, 0x9e, 0x2d, 0xff, 0x97, 0x2a, 0x3d,
+  0x03, 0x42, 0xbd, 0x6a, 0x40, 0xd4, 0x19, 0x5f, 0x3e, 0x07, 0xe6, 0xa7,
+  0x88, 0xd3, 0xdd, 0xb1, 0x59, 0xac, 0xfa, 0x34, 0x45, 0x74, 0x47, 0x95,
+  0x37, 0x5e, 0x5f, 0xde, 0x3f, 0xa6, 0xce, 0x6c, 0xaa, 0xf3, 0xf3, 0x79,
+  0xf9, 0xed, 0x6c, 0xdd, 0xdc, 0x98, 0xf2, 0xb6, 0x89, 0xa6, 0xce, 0x96,
+  0x2b, 0x14, 0xf9, 0xb0, 0xe0, 0x3c, 0x81, 0x02, 0x5b, 0xc3, 0xf2, 0xbc,
+  0xd4, 0x38, 0xac, 0xc9, 0x61, 0x25, 0xb7, 0x9d, 0x68, 0xab, 0xa1, 0x6d,
+  0xac, 0x91, 0x26, 0x75, 0xd2, 0xef, 0x3a, 0x22, 0xf6, 0xf6, 0x00, 0xf6,
+  0x8d, 0xfb, 0x56, 0x6d, 0x21, 0xa9, 0x06, 0x1b, 0x72, 0xa8, 0x2a, 0xeb,
+  0x66, 0x13, 0xac, 0x0e, 0x66, 0xf0, 0xbd, 0x7b, 0x46, 0x01, 0x09, 0x45,
+  0x0d, 0x7f, 0xf0, 0x42, 0x76, 0xda, 0x9d, 0xf9, 0xd4, 0xf8, 0x40, 0xf9,
+  0x51, 0xf3, 0xa5, 0xec, 0x56, 0x4b, 0x23, 0xdb, 0x55, 0xcb, 0x11, 0x2e,
+  0x6c, 0xf6, 0x36, 0x36, 0x2f, 0x50, 0x2f, 0x95, 0xa7, 0x9d, 0x9d, 0xe9,
+  0x95, 0x02, 0x50, 0xf7, 0xf6, 0x10, 0x98, 0xdf, 0xc2, 0xcf, 0x48, 0xcb,
+  0xb4, 0x6a, 0x44, 0x41, 0x57, 0xb9, 0x88, 0xd8, 0x82, 0x73, 0x4f, 0x21,
+  0x41, 0x39, 0x46, 0x41, 0xa6, 0x8f, 0x0a, 0x0b, 0x94, 0xcb, 0xa6, 0x00,
+  0x52, 0x6f, 0xcb, 0xb7, 0xc3, 0x25, 0xec, 0xed, 0x28, 0x48, 0xbc, 0xaf,
+  0xae, 0xeb, 0xee, 0x45, 0x28, 0x61, 0xdd, 0xdd, 0xa1, 0x3e, 0x80, 0x61,
+  0xef, 0x7c, 0xa1, 0xd6, 0x6c, 0xfb, 0x5c, 0x02, 0xc4, 0x6d, 0x28, 0xcd,
+  0xbe, 0x90, 0xd8, 0xae, 0x60, 0x0a, 0x7c, 0x17, 0xea, 0x55, 0x46, 0x9f,
+  0x36, 0x16, 0xb3, 0x25, 0x48, 0xea, 0x56, 0x60, 0xd7, 0x07, 0xef, 0x7e,
+  0x77, 0xf1, 0xb8, 0x7f, 0x9c, 0x9f, 0x64, 0xa8, 0xa8, 0x78, 0x60, 0xd5,
+  0xa5, 0x86, 0x4a, 0x67, 0x6e, 0x38, 0xaa, 0xbb, 0x0b, 0x5b, 0x74, 0x35,
+  0x35, 0x4b, 0x11, 0x53, 0xa8, 0x1b, 0xa2, 0x1e, 0x5d, 0x44, 0xb1, 0x51,
+  0x67, 0x59, 0x98, 0x2c, 0xc3, 0xcf, 0x01, 0x2f, 0x89, 0x76, 0x76, 0xd6,
+  0x47, 0x7f, 0x3d, 0xa8, 0x52, 0x57, 0x4d, 0x49, 0x67, 0xb2, 0x5a, 0xd8,
+  0x36, 0x92, 0xf6, 0x76, 0xff, 0xde, 0xbd, 0x0b, 0xf7, 0xca, 0xa4, 0x4f,
+  0x09, 0xf3, 0x85, 0x1a, 0xa7, 0x2a, 0xa9, 0xb3, 0xb7, 0xd7, 0xb9, 0x60,
+  0xef, 0x48, 0xf2, 0xfb, 0x1e, 0xcc, 0x5a, 0xa6, 0x52, 0x8f, 0xca, 0x23,
+  0xf3, 0xc5, 0xe1, 0x6c, 0x09, 0x33, 0x03, 0x35, 0xa8, 0xfa, 0x52, 0x3e,
+  0xcf, 0xf6, 0x79, 0xee, 0x7d, 0x52, 0x1a, 0x81, 0x96, 0xee, 0x67, 0x39,
+  0xd3, 0xfb, 0x30, 0x92, 0x65, 0xba, 0x24, 0xd4, 0x4d, 0x81, 0xb2, 0xba,
+  0xfa, 0x91, 0x8c, 0xb5, 0x00, 0x24, 0xaf, 0x84, 0x23, 0xa2, 0xdc, 0xd3,
+  0x2d, 0x51, 0x7a, 0x2c, 0x9b, 0x08, 0xb1, 0xa6, 0xff, 0xfd, 0xaf, 0x08,
+  0xa1, 0x9b, 0x5d, 0x84, 0x9a, 0xbc, 0x7e, 0xc5, 0x9a, 0xb8, 0xcd, 0xff,
+  0x2d, 0x71, 0x6e, 0x66, 0xe0, 0x56, 0xe1, 0xeb, 0x4c, 0xb2, 0xd9, 0x11,
+  0x5f, 0x7b, 0x7e, 0xb5, 0x52, 0x4d, 0xb9, 0x34, 0xca, 0x85, 0x52, 0x29,
+  0x42, 0xdf, 0x32, 0x2d, 0x9d, 0x1e, 0xe2, 0x84, 0x54, 0xad, 0xcd, 0xaa,
+  0x96, 0xf1, 0x0c, 0x99, 0xb7, 0xc0, 0x09, 0x90, 0x5e, 0xc8, 0xba, 0x6a,
+  0x73, 0x8e, 0xe6, 0x8b, 0x82, 0x72, 0xec, 0xc0, 0x7b, 0xba, 0xda, 0x1c,
+  0x9a, 0xaa, 0x15, 0x1a, 0x2f, 0x3c, 0x2d, 0x18, 0xd4, 0x9f, 0xd3, 0x9e,
+  0x63, 0x3c, 0x15, 0x47, 0x6f, 0xf9, 0x5e, 0x16, 0x7e, 0xd9, 0xb9, 0x33,
+  0x5d, 0xab, 0x1b, 0xe4, 0x80, 0x54, 0x2f, 0x55, 0x6d, 0xae, 0x9b, 0x9d,
+  0xd4, 0x5b, 0x85, 0xd2, 0x38, 0x07, 0x1c, 0x38, 0xc1, 0x05, 0x99, 0x3f,
+  0x09, 0x16, 0xdc, 0x80, 0x55, 0x57, 0x71, 0x83, 0x29, 0x7d, 0x87, 0x8c,
+  0xb1, 0xf9, 0x61, 0x79, 0xcb, 0x7d, 0x9e, 0xd4, 0x4d, 0x11, 0xd6, 0xc2,
+  0xf9, 0xb2, 0x92, 0x7c, 0xa9, 0x56, 0x86, 0x2d, 0xab, 0xdd, 0x6c, 0xd1,
+  0x4a, 0xb5, 0x09, 0xae, 0x18, 0x68, 0x8a, 0x29, 0x7e, 0xee, 0x14, 0x54,
+  0xb2, 0x64, 0xf5, 0xeb, 0x58, 0xa2, 0xb2, 0x47, 0x38, 0xb2, 0x2a, 0x82,
+  0x3a, 0x18, 0x43, 0x26, 0xf5, 0x0e, 0x3d, 0xdc, 0x49, 0x9d, 0x64, 0x4b,
+  0x90, 0xc3, 0xe7, 0x4b, 0x08, 0x16, 0x8c, 0x49, 0xe5, 0x4f, 0x82, 0x05,
+  0x6b, 0x26, 0xb5, 0x9d, 0x3b, 0x81, 0x92, 0xce, 0xae, 0xc9, 0x33, 0xa9,
+  0x8b, 0x2c, 0x46, 0xb1, 0x9b, 0x40, 0xb0, 0xfc, 0x10, 0x6b, 0x42, 0x8d,
+  0x35, 0x33, 0x8d, 0x50, 0x0f, 0xe0, 0xd6, 0xe1, 0xaf, 0x9b, 0xfe, 0xae,
+  0xc1, 0x5a, 0x90, 0xcd, 0x4a, 0x7f, 0x67, 0x07, 0xaa, 0x32, 0xaf, 0x67,
+  0xcb, 0x3e, 0x6d, 0x45, 0xac, 0xeb, 0x95, 0x66, 0xd6, 0x3e, 0x6c, 0xe0,
+  0x7e, 0x6a, 0xb5, 0xd2, 0xda, 0x8c, 0xc8, 0xe0, 0xe4, 0x5a, 0x82, 0x8a,
+  0xf7, 0xd8, 0xec, 0xd4, 0x1a, 0x4f, 0x3a, 0x99, 0xb0, 0xc8, 0x2b, 0x0d,
+  0x21, 0x12, 0x28, 0x22, 0xbb, 0x84, 0x22, 0x1e, 0xc8, 0xed, 0xf7, 0xa9,
+  0xe2, 0x1d, 0x85, 0xe2, 0xfd, 0x96, 0x2b, 0x52, 0xab, 0xf5, 0xee, 0x03,
+  0x71, 0xf1, 0xa2, 0x23, 0xad, 0xa7, 0x0d, 0x87, 0xb2, 0xed, 0xaa, 0x4b,
+  0x6f, 0x52, 0xa6, 0x32, 0x54, 0xaf, 0x4d, 0xd7, 0x14, 0x56, 0x44, 0xf6,
+  0x4e, 0xf4, 0xa0, 0xbe, 0xa3, 0x1e, 0xda, 0x4a, 0x4d, 0x2d, 0x94, 0x2b,
+  0x51, 0xcd, 0x6f, 0xe2, 0x0d, 0xd9, 0x20, 0x85, 0x05, 0xb9, 0xb9, 0x7a,
+  0x6a, 0x46, 0x65, 0xa0, 0x52, 0x68, 0x26, 0xeb, 0xa9, 0x37, 0x2a, 0x49,
+  0x85, 0x56, 0x8b, 0x65, 0x17, 0x52, 0xe7, 0x70, 0x83, 0x9a, 0xe9, 0x13,
+  0xdc, 0xbd, 0x9d, 0xc2, 0xb7, 0x15, 0xfe, 0xcb, 0x4f, 0x0d, 0x17, 0x2f,
+  0x59, 0x56, 0x52, 0xe8, 0xad, 0xcb, 0x31, 0x17, 0x31, 0x75, 0xbd, 0x8c,
+  0xca, 0x56, 0xbd, 0xf5, 0xe2, 0x75, 0x1e, 0xc8, 0xfa, 0x6f, 0xfe, 0xa3,
+  0x69, 0x5e, 0x56, 0x75, 0x23, 0x4d, 0x04, 0x60, 0xad, 0x5e, 0x00, 0x68,
+  0x30, 0x05, 0x58, 0xcc, 0x34, 0xc0, 0x9c, 0xa0, 0x33, 0x87, 0x55, 0x30,
+  0xe3, 0x85, 0xa0, 0x8e, 0xef, 0xaa, 0x75, 0xb2, 0x0e, 0xb4, 0x87, 0x4c,
+  0xd5, 0xa1, 0x2b, 0x20, 0x94, 0xd6, 0x0a, 0xbe, 0xaf, 0xe1, 0xf8, 0x95,
+  0xa8, 0x60, 0x53, 0x97, 0xeb, 0xdd, 0x44, 0x10, 0x56, 0x3b, 0x11, 0x30,
+  0x76, 0x92, 0x44, 0xa0, 0x7b, 0x85, 0x9d, 0x75, 0x28, 0x27, 0x0c, 0xac,
+  0x0e, 0x6b, 0x59, 0x91, 0x65, 0x91, 0x0a, 0x3f, 0x54, 0xab, 0xd9, 0x38,
+  0x55, 0x63, 0x83, 0xc0, 0xdd, 0x55, 0x2a, 0xb4, 0x56, 0xba, 0xbe, 0x9d,
+  0xd5, 0xca, 0x23, 0x55, 0xaa, 0xaa, 0x89, 0x41, 0xd8, 0x5d, 0x9d, 0x43,
+  0x6d, 0xad, 0x52, 0x59, 0xd2, 0xbd, 0x9a, 0xa4, 0x6a, 0xd4, 0x9a, 0xf8,
+  0xb3, 0xc9, 0xee, 0x1a, 0x1d, 0x6a, 0x6b, 0x8d, 0xc6, 0x43, 0x55, 0xaa,
+  0xc6, 0x99, 0xf1, 0x7b, 0xd8, 0x3e, 0x12, 0x2d, 0x5a, 0x6b, 0x65, 0x2f,
+  0x36, 0xf3, 0xf9, 0xf3, 0x36, 0x8e, 0x9e, 0x01, 0xc2, 0xa0, 0x6c, 0x63,
+  0xa9, 0xae, 0x8f, 0x21, 0xc6, 0x6b, 0x44, 0x89, 0x1e, 0xab, 0xdc, 0x29,
+  0xc7, 0x3b, 0xf1, 0x9c, 0x0a, 0xfe, 0x35, 0x62, 0xb9, 0x46, 0xa4, 0x33,
+  0x8e, 0x2f, 0x65, 0x78, 0x10, 0x21, 0x60, 0x44, 0x72, 0xc5, 0x20, 0x69,
+  0x91, 0x9c, 0xa1, 0xb5, 0xcb, 0xe1, 0xbc, 0x3c, 0x26, 0x45, 0xe0, 0x72,
+  0x94, 0x58, 0xc4, 0xf0, 0x67, 0x3b, 0xb9, 0x84, 0x1c, 0x21, 0x56, 0xa5,
+  0xc7, 0x48, 0xe5, 0x39, 0xc2, 0x74, 0x41, 0x26, 0x26, 0xfa, 0x84, 0x62,
+  0x8a, 0xd2, 0x28, 0xe6, 0xe4, 0x61, 0x6a, 0x91, 0x79, 0xcd, 0x37, 0xe4,
+  0xe1, 0x62, 0x98, 0x58, 0x3f, 0xf1, 0x67, 0x3b, 0x79, 0x84, 0x1c, 0x21,
+  0x4f, 0xa5, 0xc7, 0xc8, 0xe3, 0x39, 0xc2, 0x74, 0x41, 0x1e, 0x26, 0xfa,
+  0xe4, 0x61, 0xca, 0xdd, 0xdd, 0xfd, 0xaf, 0xbe, 0xfa, 0xc2, 0x27, 0x10,
+  0xd3, 0x8b, 0xcc, 0x23, 0xc0, 0x10, 0x88, 0x2b, 0x71, 0x62, 0xfd, 0xc6,
+  0x9f, 0xed, 0x04, 0x12, 0x72, 0x84, 0x40, 0x95, 0x1e, 0x23, 0x90, 0xe7,
+  0x08, 0xd3, 0x05, 0x81, 0x98, 0xe8, 0x13, 0x88, 0x29, 0x61, 0xff, 0x61,
+  0x6a, 0x91, 0x79, 0xcd, 0xb7, 0x0e, 0x4e, 0x70, 0x45, 0x4e, 0xad, 0xe4,
+  0xf4, 0xbb, 0x9d, 0x42, 0x85, 0x1e, 0x21, 0x51, 0x03, 0x62, 0x34, 0x7a,
+  0x79, 0x22, 0x00, 0x41, 0x25, 0xa5, 0xfa, 0x64, 0x52, 0x52, 0x48, 0x27,
+  0x25, 0x17, 0x99, 0x4f, 0x87, 0x15, 0x9d, 0x60, 0x33, 0x68, 0xdb, 0x47,
+  0xf0, 0xbb, 0x9d, 0x56, 0x97, 0x23, 0x42, 0x2f, 0x03, 0xc6, 0x68, 0x0e,
+  0xf2, 0x26, 0x80, 0xf2, 0x7c, 0x03, 0x10, 0x9f, 0x74, 0x8b, 0x1b, 0x92,
+  0x8f, 0xa0, 0x22, 0x0b, 0x89, 0x33, 0x1c, 0x18, 0xcf, 0x26, 0x6d, 0xdb,
+  0xda, 0x78, 0x36, 0x69, 0xa7, 0xdf, 0x65, 0x88, 0xd0, 0xcf, 0x80, 0x31,
+  0xfa, 0x83, 0xbc, 0x09, 0xa0, 0xa0, 0x1f, 0xda, 0xe4, 0x93, 0x6f, 0x51,
+  0x43, 0xf2, 0x01, 0xb7, 0xc8, 0x42, 0xca, 0x0c, 0xf5, 0xb3, 0xab, 0x96,
+  0x1d, 0x76, 0x76, 0xd5, 0x4e, 0xba, 0x45, 0x8f, 0x50, 0xee, 0x60, 0x31,
+  0xc2, 0x65, 0xce, 0x38, 0x4c, 0x90, 0x3d, 0xbb, 0xf2, 0xa9, 0x36, 0x88,
+  0x4a, 0xe8, 0xfe, 0x52, 0xbc, 0x14, 0xcc, 0xae, 0x8a, 0x2c, 0x20, 0xca,
+  0x0e, 0xfb, 0xb9, 0xb7, 0xd3, 0x4e, 0xca, 0x79, 0x33, 0x34, 0x23, 0x7e,
+  0xbe, 0x63, 0xbc, 0x13, 0x6e, 0x6c, 0xac, 0x2b, 0x40, 0x74, 0x9c, 0xf3,
+  0x3c, 0x11, 0x80, 0x1c, 0xdf, 0x73, 0x31, 0xba, 0x11, 0x2b, 0x7d, 0x62,
+  0x9f, 0x17, 0x99, 0x4f, 0x85, 0xa1, 0xf2, 0xac, 0x6c, 0x15, 0x68, 0xce,
+  0xca, 0x76, 0x4a, 0x59, 0x86, 0x08, 0xb9, 0x1c, 0x1a, 0xa3, 0x39, 0xcc,
+  0x9d, 0x82, 0x0a, 0xea, 0xcf, 0x4a, 0x9f, 0x7a, 0x87, 0x0a, 0x9b, 0x94,
+  0xe8, 0xe4, 0xb3, 0xb2, 0xc8, 0x22, 0xc4, 0x19, 0x06, 0x2c, 0x56, 0x5e,
+  0x37, 0x2f, 0xea, 0x73, 0xf4, 0xd1, 0xaa, 0xc9, 0x5f, 0xac, 0xda, 0xc9,
+  0x37, 0xd8, 0x11, 0xda, 0x2d, 0x28, 0x46, 0xb8, 0xc8, 0x17, 0x05, 0x09,
+  0x92, 0x17, 0x2b, 0x9f, 0x64, 0x8d, 0x97, 0xec, 0xf2, 0xc5, 0xaa, 0xc8,
+  0x24, 0x45, 0x86, 0xe6, 0xd1, 0x0d, 0xd2, 0x4c, 0xd0, 0xd1, 0x4d, 0x53,
+  0x9a, 0x23, 0xcf, 0xc8, 0xbc, 0x67, 0xe9, 0x2a, 0xd4, 0xc1, 0x7a, 0xb5,
+  0x19, 0xcd, 0x67, 0xf5, 0xb4, 0xc4, 0xbb, 0xac, 0xd1, 0x8d, 0xa7, 0x34,
+  0x43, 0x4f, 0x21, 0xee, 0x6e, 0x1f, 0xfd, 0xa2, 0xf5, 0x33, 0x74, 0x45,
+  0x89, 0x57, 0xe5, 0xac, 0x08, 0xaa, 0x64, 0x00, 0x80, 0xfd, 0xac, 0xf3,
+  0xb4, 0xf3, 0x2f, 0xa7, 0xef, 0xde, 0x76, 0xba, 0xd8, 0x1b, 0x12, 0x8f,
+  0x7a, 0xc8, 0x43, 0xce, 0x8b, 0x0e, 0x5a, 0x16, 0xc4, 0x0b, 0x44, 0x08,
+  0x22, 0xa9, 0x9b, 0x1b, 0x9f, 0x2f, 0xb0, 0xfb, 0xed, 0xf7, 0xb3, 0xa2,
+  0xf3, 0xa6, 0xac, 0xeb, 0xe1, 0x79, 0x89, 0x71, 0x1b, 0x3a, 0x5e, 0xcb,
+  0x34, 0x9e, 0x5f, 0x1d, 0x94, 0x24, 0x48, 0x6c, 0xf8, 0x25, 0x02, 0x1a,
+  0x02, 0x58, 0xce, 0xe1, 0x87, 0xd9, 0x00, 0xe0, 0xa7, 0xcf, 0x3a, 0x77,
+  0x67, 0x84, 0xb0, 0xf6, 0x2b, 0xa3, 0x6f, 0xf5, 0x0d, 0x42, 0xfc, 0x9a,
+  0xc5, 0xd6, 0x45, 0xb6, 0xcc, 0x3b, 0x0a, 0xac, 0x2e, 0x1f, 0x3f, 0x33,
+  0xa8, 0x91, 0xeb, 0x94, 0xb6, 0xac, 0x74, 0xfb, 0x43, 0x67, 0xc8, 0x48,
+  0x7e, 0xc3, 0x80, 0x72, 0xbd, 0xb6, 0xf4, 0xc3, 0x6f, 0x73, 0xf6, 0x58,
+  0xa3, 0x34, 0x07, 0xff, 0x7a, 0x9c, 0xd3, 0x4d, 0x27, 0x83, 0x26, 0x80,
+  0x55, 0x5a, 0xbc, 0x0a, 0xdf, 0x31, 0xf0, 0x8e, 0x03, 0x4e, 0x58, 0xbf,
+  0x55, 0x99, 0x49, 0x3c, 0x9f, 0x5f, 0xa0, 0x16, 0x05, 0x2e, 0x65, 0x2b,
+  0xa1, 0xd9, 0x75, 0x71, 0x38, 0x5b, 0x91, 0x6a, 0x17, 0xd9, 0xe4, 0x49,
+  0x98, 0x35, 0xd0, 0x83, 0xee, 0x9f, 0x3c, 0x45, 0x27, 0x16, 0x80, 0x79,
+  0x8d, 0x1a, 0x95, 0x31, 0xc4, 0xe6, 0xd3, 0x60, 0x32, 0x5a, 0x1c, 0x36,
+  0xd5, 0x0b, 0xf4, 0x0d, 0xdc, 0xbd, 0x9f, 0xf3, 0x5c, 0x64, 0xbe, 0x27,
+  0xb3, 0xa1, 0x03, 0x64, 0x65, 0xfb, 0x70, 0x39, 0x02, 0xe4, 0x3f, 0x3d,
+  0xc5, 0x3b, 0x49, 0x60, 0x0d, 0xac, 0xb8, 0x01, 0x28, 0x57, 0xe5, 0x68,
+  0x8b, 0x3f, 0x59, 0x92, 0x4a, 0x26, 0x8c, 0x7a, 0x7d, 0x05, 0x60, 0xd7,
+  0x91, 0x5a, 0x8b, 0xee, 0x82, 0x1b, 0xd4, 0xd9, 0x21, 0xd8, 0x93, 0xaf,
+  0xc1, 0x29, 0x34, 0x28, 0x58, 0x1b, 0xdf, 0xc9, 0xaa, 0xb5, 0x1f, 0xaa,
+  0xbb, 0xbb, 0x4e, 0xf6, 0x83, 0x72, 0xaf, 0x83, 0xf1, 0x0b, 0x54, 0x53,
+  0xe8, 0x16, 0x50, 0xb6, 0x86, 0x14, 0x0a, 0x2f, 0x3c, 0x2b, 0x3d, 0xec,
+  0x00, 0xba, 0x6c, 0x93, 0x65, 0x2b, 0x67, 0xb9, 0x4a, 0x33, 0x19, 0x0d,
+  0xf7, 0x6a, 0xe0, 0x05, 0xfc, 0x3d, 0xaa, 0x55, 0x05, 0xf3, 0x31, 0x3e,
+  0x53, 0x8b, 0x4c, 0x34, 0xa8, 0x88, 0x0a, 0x3d, 0x5c, 0x15, 0x2a, 0x19,
+  0xef, 0x45, 0x71, 0xf9, 0xbb, 0x06, 0xe1, 0x32, 0x05, 0xd1, 0x68, 0xd3,
+  0xd9, 0x1b, 0xaa, 0x6a, 0xbc, 0xb3, 0xd2, 0x8b, 0x56, 0x60, 0xf1, 0x7b,
+  0xe1, 0xbb, 0x75, 0xbb, 0x56, 0x40, 0xdd, 0x7c, 0x32, 0x3b, 0x90, 0x52,
+  0xe4, 0xa5, 0x2b, 0xe2, 0x4f, 0xc9, 0x8d, 0xc7, 0x18, 0x90, 0xfa, 0x7b,
+  0x8e, 0x4d, 0x15, 0xdb, 0x8d, 0xc0, 0x96, 0xa9, 0xc1, 0x1b, 0xd2, 0x27,
+  0xbb, 0xcb, 0xc4, 0x07, 0xbc, 0x7c, 0x32, 0xfa, 0x54, 0xd8, 0xc2, 0xf8,
+  0xa6, 0x3a, 0xb1, 0x9b, 0x2a, 0xda, 0x0a, 0xea, 0xcd, 0xb4, 0x45, 0x4a,
+  0x46, 0x35, 0xf9, 0xf8, 0x15, 0x05, 0x87, 0xc8, 0xad, 0x34, 0xcc, 0x15,
+  0x83, 0xc8, 0x8d, 0x94, 0x09, 0xc6, 0x0e, 0x2d, 0x7d, 0x45, 0xb1, 0x40,
+  0xe1, 0x98, 0x95, 0xc7, 0xc9, 0x9c, 0x1a, 0xe1, 0x09, 0xe1, 0xec, 0x82,
+  0x62, 0x31, 0x6d, 0x27, 0x15, 0x51, 0x97, 0xc3, 0x45, 0x94, 0x58, 0x07,
+  0x8b, 0x91, 0x2b, 0x73, 0xc6, 0x61, 0x92, 0xe4, 0xa9, 0x4f, 0xb2, 0x41,
+  0x0c, 0x8f, 0x02, 0x8b, 0x69, 0x21, 0xca, 0xe2, 0x47, 0xde, 0xba, 0xb4,
+  0x23, 0x95, 0xeb, 0x57, 0x93, 0x67, 0xcf, 0xb4, 0xa0, 0xe8, 0x70, 0x7d,
+  0x6a, 0x59, 0xba, 0xa0, 0x34, 0xc8, 0x11, 0xa6, 0xcb, 0xa3, 0x6e, 0xed,
+  0x24, 0x42, 0x6e, 0x64, 0xdb, 0xde, 0xb5, 0x90, 0xab, 0xc8, 0x3c, 0x52,
+  0xb6, 0x4e, 0xd5, 0xe2, 0xd4, 0xb9, 0xd9, 0x71, 0x6a, 0xe7, 0xa8, 0x17,
+  0x43, 0xa0, 0x76, 0x6a, 0x75, 0x86, 0x08, 0xbd, 0x06, 0xe2, 0x4c, 0xcd,
+  0xd0, 0x86, 0x40, 0xe9, 0x91, 0xac, 0x51, 0x63, 0xb0, 0x1b, 0x55, 0x48,
+  0x21, 0x3f, 0x4c, 0x11, 0x26, 0xf9, 0x15, 0xc5, 0x20, 0x82, 0x51, 0xaa,
+  0xf5, 0x9a, 0x57, 0xc6, 0x1f, 0x97, 0xb6, 0xde, 0xe3, 0xac, 0x51, 0x78,
+  0x85, 0x57, 0x16, 0x3f, 0x36, 0xd0, 0x99, 0xf0, 0xec, 0xfa, 0xca, 0x9c,
+  0x13, 0xae, 0x94, 0x6e, 0xc5, 0xd9, 0xf5, 0xe0, 0x0a, 0x8d, 0x18, 0x51,
+  0xe3, 0x08, 0x90, 0x7c, 0x69, 0xf1, 0x0a, 0x77, 0x3e, 0x87, 0xc1, 0xae,
+  0x8a, 0x66, 0xa4, 0xa5, 0xb3, 0x9e, 0xa3, 0xe5, 0xb1, 0xbe, 0x22, 0x9a,
+  0xa1, 0x3a, 0xc6, 0x4c, 0x2c, 0xb5, 0x7a, 0x19, 0x57, 0x98, 0x3d, 0x84,
+  0x4f, 0xd7, 0xe5, 0x59, 0x08, 0xb0, 0x05, 0x2f, 0x4c, 0xc1, 0x66, 0x1d,
+  0x32, 0xe9, 0xd7, 0x1c, 0x30, 0xb8, 0x5e, 0x0f, 0x6d, 0xc5, 0x5a, 0x7f,
+  0xc4, 0x5f, 0x1d, 0x94, 0x6e, 0x48, 0xb2, 0x31, 0x88, 0xda, 0x43, 0x8c,
+  0xb0, 0x39, 0x16, 0xa4, 0x74, 0xca, 0x2b, 0x10, 0x3a, 0x67, 0xcd, 0x8d,
+  0xd2, 0x0b, 0xa5, 0xea, 0xae, 0x73, 0x6c, 0x8e, 0x54, 0x39, 0x17, 0x7a,
+  0x25, 0x1e, 0x1f, 0xff, 0xf1, 0x97, 0xbf, 0x65, 0x54, 0x64, 0xe0, 0x99,
+  0x17, 0xab, 0x47, 0x3a, 0xc2, 0xea, 0x8e, 0x0f, 0xbf, 0x6c, 0xaf, 0x10,
+  0x5d, 0x9a, 0x7b, 0xb2, 0x5e, 0x53, 0xad, 0x5e, 0xd1, 0xd9, 0x88, 0xf6,
+  0x59, 0xdb, 0x31, 0x94, 0x8c, 0x3e, 0x62, 0xf0, 0x6f, 0x7b, 0xf7, 0x28,
+  0x94, 0xf6, 0x1e, 0x02, 0x9c, 0x37, 0xc0, 0x21, 0x5b, 0x8f, 0xdf, 0x4f,
+  0xd8, 0x2f, 0x1e, 0x88, 0xf7, 0x94, 0xce, 0x9a, 0xe8, 0x2e, 0x0d, 0xdd,
+  0xd5, 0x67, 0x06, 0x2d, 0xd5, 0x71, 0x50, 0x34, 0x56, 0x99, 0x53, 0x53,
+  0x24, 0xcf, 0x66, 0x4b, 0xf4, 0xe8, 0xc8, 0xbb, 0x2a, 0x56, 0xab, 0x5a,
+  0x63, 0x55, 0x7a, 0xb2, 0xc7, 0x5a, 0xeb, 0x61, 0x7d, 0x13, 0x55, 0xfd,
+  0xe9, 0xf1, 0xf7, 0x03, 0x54, 0x14, 0xf6, 0x45, 0x6c, 0x0a, 0xf1, 0x25,
+  0x24, 0x6c, 0x32, 0xcf, 0x1f, 0xfc, 0x5e, 0x39, 0x5b, 0xbb, 0xa4, 0xd6,
+  0xbb, 0x9f, 0xb1, 0x21, 0x53, 0xa9, 0xe7, 0x3a, 0xd5, 0xd8, 0x8d, 0x69,
+  0x29, 0x67, 0x64, 0x16, 0x53, 0x6d, 0xe6, 0x65, 0x34, 0xeb, 0xb4, 0x4a,
+  0x89, 0xb1, 0x81, 0xd2, 0x8b, 0xa2, 0x3d, 0x94, 0x4f, 0x57, 0x3c, 0xd5,
+  0xdc, 0x43, 0x4e, 0x57, 0x03, 0xe5, 0xb0, 0x3c, 0x4b, 0x0a, 0x57, 0x68,
+  0xe9, 0x90, 0x5c, 0xa4, 0xa9, 0xc5, 0xfe, 0xea, 0xac, 0x92, 0xc4, 0x1a,
+  0xcb, 0xf1, 0xbc, 0x24, 0xb1, 0xaa, 0xba, 0xcb, 0x64, 0x15, 0x91, 0x87,
+  0x58, 0xe2, 0x2f, 0xa8, 0xeb, 0x22, 0x33, 0x7c, 0x22, 0x3d, 0xb5, 0xf3,
+  0x64, 0xe3, 0x88, 0x71, 0x7e, 0xe3, 0x54, 0x92, 0x68, 0x1c, 0xc7, 0xf3,
+  0x92, 0x44, 0xe3, 0xce, 0x6d, 0xe3, 0x10, 0x6c, 0x65, 0xb9, 0x07, 0x62,
+  0xc5, 0x3f, 0x2f, 0x32, 0xd3, 0x65, 0xd4, 0xc0, 0x7a, 0x94, 0x6c, 0xe1,
+  0x88, 0xe2, 0x2d, 0x89, 0x36, 0x9a, 0x44, 0xd1, 0x4a, 0x1f, 0x57, 0x24,
+  0x4a, 0xf1, 0x73, 0x64, 0x9b, 0xaa, 0x30, 0x06, 0xf5, 0xec, 0x17, 0xc1,
+  0xc7, 0x7a, 0x54, 0x98, 0xec, 0xb6, 0xa5, 0x69, 0xe5, 0x23, 0x1a, 0x56,
+  0x42, 0xe5, 0x48, 0xa5, 0x49, 0x45, 0x23, 0x8e, 0xe9, 0xa7, 0xc9, 0x46,
+  0xda, 0x36, 0xce, 0x1e, 0xd4, 0x03, 0x1b, 0xac, 0x89, 0xb5, 0xb0, 0xc8,
+  0xec, 0x70, 0xa6, 0xf6, 0x4d, 0xd3, 0xb7, 0x48, 0x30, 0x90, 0xa3, 0x62,
+  0x2f, 0x4b, 0x17, 0x0d, 0x0d, 0x72, 0x84, 0xe9, 0xf2, 0xb1, 0xca, 0xdd,
+  0x1c, 0x59, 0xa4, 0xa4, 0x48, 0x34, 0x5d, 0x15, 0xac, 0x28, 0x47, 0xc1,
+  0xb8, 0x8d, 0x04, 0x3d, 0x17, 0x03, 0x12, 0x4c, 0x7a, 0x48, 0x82, 0x9f,
+  0x23, 0x4c, 0x0f, 0x48, 0x18, 0x73, 0x1a, 0x14, 0xd6, 0x60, 0xfa, 0x8b,
+  0x6c, 0xfb, 0xb8, 0xc8, 0xbc, 0xa5, 0x61, 0x6b, 0xaf, 0xa5, 0x2e, 0x8c,
+  0xeb, 0x90, 0xc1, 0xa2, 0xf6, 0xcf, 0xef, 0x8b, 0xda, 0xdc, 0x1f, 0x01,
+  0x86, 0x52, 0x23, 0xa9, 0xd5, 0xed, 0x51, 0xa7, 0xbb, 0x28, 0x87, 0xf5,
+  0x06, 0xe3, 0x93, 0xac, 0x1e, 0x1e, 0x77, 0xb2, 0x7d, 0x8d, 0xd3, 0x54,
+  0xcd, 0x70, 0x3e, 0x80, 0xa4, 0xc1, 0xa6, 0x3e, 0x42, 0x05, 0xf4, 0xdc,
+  0x2f, 0xf1, 0xa8, 0xb3, 0xfa, 0xfa, 0x61, 0x80, 0xfe, 0xf5, 0xc3, 0x24,
+  0x3a, 0x06, 0x4a, 0x13, 0xe8, 0x90, 0x94, 0x40, 0x5f, 0xd4, 0xfa, 0x9e,
+  0x00, 0x90, 0xc5, 0x59, 0x94, 0x2e, 0xab, 0x00, 0x62, 0xdc, 0x9f, 0xf8,
+  0x50, 0x6e, 0xb7, 0xe8, 0x4d, 0x30, 0xa6, 0x24, 0x2a, 0x4c, 0xd7, 0xe6,
+  0x57, 0x24, 0x03, 0x5b, 0xfb, 0x4f, 0x54, 0x26, 0xbe, 0x72, 0xb2, 0xef,
+  0x6a, 0x8c, 0x8c, 0xc5, 0x28, 0x0e, 0x03, 0xf8, 0x89, 0x4a, 0x2d, 0x9d,
+  0xc9, 0xc8, 0xa4, 0x4c, 0x46, 0x67, 0xf5, 0xdd, 0xdd, 0xc1, 0xd7, 0x90,
+  0x88, 0x71, 0x19, 0xd4, 0x35, 0xc2, 0x0a, 0x3e, 0xc6, 0xfa, 0x27, 0x9c,
+  0xdd, 0x37, 0xcb, 0xc6, 0xd8, 0x45, 0x62, 0x0a, 0xaa, 0x1a, 0x5f, 0xcd,
+  0xdd, 0x79, 0xbc, 0xd3, 0xef, 0x78, 0x06, 0x85, 0xe4, 0x06, 0x91, 0x4c,
+  0x0a, 0x4d, 0xa4, 0x07, 0x63, 0x52, 0xd8, 0xa1, 0xd0, 0x3a, 0x9f, 0xdd,
+  0x42, 0x33, 0x2c, 0xb7, 0x8e, 0xf3, 0xed, 0xe7, 0x9d, 0xee, 0x67, 0xb7,
+  0x93, 0x11, 0x63, 0xe0, 0xb6, 0x33, 0x79, 0xfa, 0xe2, 0x34, 0x57, 0x6d,
+  0xaa, 0x1f, 0x41, 0x96, 0xf1, 0x78, 0xfb, 0x91, 0x5f, 0xb9, 0x41, 0x11,
+  0x8f, 0xfb, 0x5f, 0x1f, 0xef, 0x6c, 0x0b, 0x39, 0xd3, 0x73, 0x8d, 0xc1,
+  0xcf, 0xdf, 0xdb, 0x9a, 0x8f, 0xfc, 0x16, 0x15, 0x2a, 0x65, 0xbd, 0x86,
+  0xd5, 0xfe, 0xc6, 0xd2, 0x3a, 0x20, 0x1f, 0x76, 0x6c, 0xbb, 0xaa, 0x4b,
+  0x45, 0xde, 0x56, 0x07, 0x18, 0x7b, 0x32, 0x41, 0x07, 0xcc, 0x81, 0x9c,
+  0xe0, 0x01, 0x87, 0x11, 0x53, 0x50, 0x9a, 0x46, 0xc0, 0xb2, 0xfe, 0x4f,
+  0x3f, 0x53, 0x7f, 0x0d, 0xf9, 0x08, 0xfa, 0x86, 0x6c, 0x55, 0x11, 0x7c,
+  0xb8, 0xda, 0xd4, 0xd3, 0x2e, 0x79, 0x29, 0xd1, 0xb1, 0xfe, 0xf2, 0x08,
+  0xba, 0x32, 0x59, 0x8d, 0xe0, 0x13, 0x40, 0x67, 0xc0, 0xdd, 0xe8, 0xf1,
+  0x83, 0xe3, 0x10, 0x4f, 0xfb, 0x0b, 0x82, 0x81, 0x09, 0x5f, 0x72, 0x0a,
+  0x20, 0xee, 0x45, 0x35, 0x5b, 0x76, 0xb3, 0x0e, 0x8c, 0x58, 0x5f, 0x10,
+  0xc2, 0xf0, 0x5e, 0x42, 0x0e, 0x42, 0x37, 0x40, 0xff, 0xa4, 0x18, 0x64,
+  0x75, 0x42, 0x8c, 0x7d, 0x3a, 0x5e, 0x89, 0xce, 0x73, 0xa7, 0x15, 0x74,
+  0x41, 0x7e, 0x85, 0x06, 0x26, 0x62, 0x5c, 0xc4, 0xef, 0x6a, 0x33, 0x35,
+  0xb2, 0x94, 0x36, 0x61, 0xd7, 0xf7, 0xcd, 0xd3, 0x4b, 0x9d, 0xac, 0x2d,
+  0xc0, 0xf5, 0xb5, 0x03, 0x6a, 0xa6, 0x59, 0x74, 0x6b, 0xcc, 0xae, 0x25,
+  0xaa, 0xb1, 0xb9, 0x94, 0xb0, 0x7a, 0x99, 0x5a, 0x7a, 0x5a, 0x1b, 0x61,
+  0xcb, 0x9a, 0xad, 0x27, 0x25, 0x27, 0x72, 0xfe, 0x92, 0x3c, 0xe1, 0x9a,
+  0x3a, 0xc5, 0xf1, 0xd6, 0x26, 0xcb, 0x83, 0xaa, 0xc0, 0x0f, 0x92, 0xe5,
+  0x6d, 0x05, 0x24, 0xfa, 0x9c, 0xb3, 0xe1, 0x66, 0x4e, 0x54, 0x98, 0x91,
+  0x47, 0x99, 0x8a, 0x12, 0x25, 0x2f, 0x2f, 0x50, 0x47, 0x2e, 0xe3, 0x2c,
+  0xd9, 0xaa, 0xb8, 0x28, 0x2d, 0xca, 0x06, 0x46, 0x7c, 0x15, 0x17, 0x31,
+  0x36, 0x59, 0xde, 0xc1, 0x08, 0xfc, 0x20, 0x59, 0xde, 0x4b, 0x4c, 0x9d,
+  0x68, 0xa8, 0x8d, 0x7b, 0x1d, 0x35, 0xea, 0xba, 0x53, 0x5c, 0x49, 0x4c,
+  0x51, 0xe1, 0x80, 0x09, 0xd5, 0x44, 0x02, 0x3a, 0xea, 0x49, 0x91, 0x30,
+  0xc6, 0x80, 0xaf, 0xa9, 0x77, 0x56, 0x09, 0x14, 0xe4, 0xc4, 0xf3, 0x26,
+  0x80, 0xf2, 0x85, 0x79, 0x7a, 0x69, 0x49, 0xf3, 0x51, 0xf1, 0xce, 0x42,
+  0xbc, 0x30, 0x4f, 0x2f, 0x0b, 0x59, 0x9e, 0x95, 0xde, 0xc6, 0xe9, 0xcb,
+  0x32, 0xa5, 0x39, 0xac, 0x4c, 0x53, 0x85, 0x14, 0xc7, 0x21, 0x52, 0x96,
+  0x0b, 0x73, 0xc5, 0x20, 0x52, 0xae, 0x1b, 0xbb, 0x5b, 0x32, 0x1b, 0xf7,
+  0x50, 0xe1, 0x26, 0xa5, 0x25, 0xc0, 0x2b, 0xbc, 0x42, 0xad, 0xc0, 0xb4,
+  0x4e, 0x0b, 0xa5, 0x2a, 0x6e, 0xb5, 0x9a, 0x84, 0xe2, 0x0c, 0xc2, 0x21,
+  0xf2, 0x28, 0x12, 0xe6, 0x8a, 0x41, 0xa4, 0xe0, 0xb4, 0xae, 0xf9, 0xf8,
+  0x33, 0x78, 0x42, 0x6e, 0x5a, 0x83, 0xc8, 0xca, 0x4b, 0xe1, 0x17, 0x3d,
+  0xeb, 0xa1, 0x39, 0xd0, 0x19, 0x57, 0x16, 0x78, 0xdd, 0x83, 0x9e, 0x9d,
+  0x92, 0x02, 0x21, 0x3e, 0x69, 0xb8, 0x50, 0xb9, 0x52, 0x2c, 0x94, 0x50,
+  0x29, 0x1c, 0xc6, 0x73, 0xa7, 0xa0, 0xf2, 0x61, 0x18, 0x40, 0x4e, 0x52,
+  0xf4, 0x91, 0x51, 0x46, 0x11, 0x4f, 0xc3, 0x00, 0x2b, 0x82, 0x32, 0x19,
+  0xf5, 0xd7, 0x93, 0xe7, 0xb4, 0xb8, 0xab, 0x00, 0xc1, 0xb8, 0x47, 0xe8,
+  0xa3, 0x3a, 0xa4, 0xa7, 0x0d, 0xfe, 0xeb, 0xa6, 0x7f, 0x5b, 0x5d, 0x3e,
+  0x42, 0xd7, 0x54, 0xb0, 0xfd, 0x16, 0x2a, 0xb4, 0x30, 0x7d, 0xd1, 0xcf,
+  0xc2, 0x86, 0x16, 0xa6, 0x34, 0xf3, 0xb5, 0xfd, 0xe9, 0x42, 0xa3, 0x34,
+  0xe5, 0xcf, 0x77, 0x77, 0xee, 0xa3, 0x47, 0xcd, 0xf0, 0x76, 0xb9, 0x8f,
+  0x9f, 0xdd, 0xd6, 0xcd, 0x56, 0x6f, 0xf4, 0x84, 0x69, 0x5c, 0x1e, 0x6e,
+  0xd5, 0xdb, 0x49, 0xa7, 0x7b, 0xff, 0xb8, 0x53, 0xd3, 0x8b, 0xa7, 0x46,
+  0xd0, 0x6e, 0x84, 0x2d, 0x5e, 0x81, 0x6e, 0xcb, 0x05, 0x10, 0xd7, 0x1d,
+  0x40, 0xd8, 0x92, 0xae, 0x3d, 0x05, 0x21, 0xd5, 0x70, 0xf5, 0xb5, 0xfd,
+  0x88, 0x32, 0x2a, 0x7c, 0xd2, 0x8b, 0x87, 0xb2, 0x72, 0x47, 0x23, 0x2a,
+  0xba, 0x9e, 0x38, 0xf9, 0xa8, 0x9f, 0x6a, 0x55, 0xba, 0xc9, 0xc9, 0x50,
+  0xb7, 0x91, 0x34, 0x0a, 0xdc, 0x56, 0x6f, 0xb1, 0xa9, 0xe7, 0xd5, 0xc7,
+  0x47, 0x99, 0xa7, 0x00, 0x48, 0x1b, 0x19, 0xf7, 0x1b, 0xa6, 0xb5, 0xff,
+  0x70, 0xbd, 0x98, 0x4e, 0x25, 0x43, 0x78, 0x7f, 0x43, 0x4f, 0x83, 0x7c,
+  0x84, 0x3f, 0x41, 0x86, 0x07, 0xe1, 0xda, 0x87, 0xa2, 0x6c, 0x4d, 0x18,
+  0xf4, 0xba, 0xbc, 0x3e, 0xc7, 0xc8, 0x94, 0x2a, 0x18, 0xe9, 0x67, 0xb7,
+  0xec, 0x22, 0x56, 0x67, 0xd1, 0x18, 0xea, 0x64, 0x70, 0x44, 0x02, 0xca,
+  0x96, 0xde, 0xf1, 0x14, 0xff, 0xc2, 0x0c, 0xc8, 0xc5, 0x44, 0xa6, 0x9c,
+  0x38, 0x28, 0x06, 0xdc, 0x49, 0x46, 0x1d, 0x99, 0xed, 0x1b, 0x9f, 0xad,
+  0x3c, 0xcc, 0xb4, 0x77, 0xff, 0x4e, 0xd7, 0x1f, 0xd6, 0x4b, 0x9a, 0xbe,
+  0x05, 0x1b, 0x9b, 0x0b, 0x30, 0x02, 0x50, 0xf0, 0xec, 0x81, 0x35, 0x28,
+  0xdb, 0xdb, 0x6b, 0x6e, 0x56, 0x65, 0x75, 0xd6, 0xb9, 0x40, 0xaf, 0x68,
+  0x83, 0xd9, 0x64, 0x5e, 0x22, 0xe9, 0xe4, 0x5c, 0x7a, 0xb3, 0x18, 0x91,
+  0x69, 0x2e, 0x94, 0xeb, 0xf3, 0x12, 0xb1, 0x88, 0x65, 0x3c, 0x0b, 0x97,
+  0x33, 0x3f, 0x07, 0xbe, 0x55, 0xd5, 0xca, 0xe2, 0xe0, 0x47, 0x04, 0x07,
+  0x19, 0x04, 0xed, 0x21, 0xbe, 0xe2, 0xd5, 0x1a, 0x3e, 0xb7, 0x9b, 0x87,
+  0xcf, 0x6d, 0xe7, 0x29, 0xca, 0xaf, 0x3c, 0x19, 0xdb, 0xbf, 0x65, 0xb2,
+  0xb0, 0x68, 0x96, 0xe1, 0x8e, 0x0e, 0x1f, 0xce, 0xd8, 0xd2, 0x58, 0xb6,
+  0x38, 0x8b, 0xa4, 0xa6, 0xd9, 0xdb, 0x7b, 0xb2, 0x5e, 0x0f, 0x6f, 0x0e,
+  0x67, 0x35, 0xfd, 0xd5, 0x0c, 0xaa, 0x73, 0x24, 0xb8, 0x11, 0xd7, 0x82,
+  0x04, 0x39, 0x84, 0xd3, 0x11, 0x9a, 0x3d, 0x37, 0xfd, 0xc7, 0xf7, 0x8e,
+  0xfe, 0xfd, 0xd5, 0xb7, 0xaf, 0x9f, 0x1f, 0x01, 0x5a, 0xdd, 0x74, 0x9b,
+  0x43, 0x7c, 0x09, 0x01, 0xc9, 0xaf, 0x9e, 0xa3, 0x74, 0x7c, 0x5c, 0x3c,
+  0xcc, 0x0f, 0x17, 0xc3, 0x15, 0x22, 0xc2, 0xb8, 0x53, 0x50, 0x1c, 0xdc,
+  0x0d, 0x31, 0x43, 0xf2, 0x01, 0xce, 0x77, 0x08, 0x52, 0x74, 0x6a, 0xd2,
+  0x3f, 0xe6, 0x46, 0x46, 0xfd, 0xfb, 0x7f, 0x77, 0x78, 0x17, 0x2f, 0xe9,
+  0x5e, 0x1d, 0x43, 0x99, 0x53, 0x47, 0x6a, 0x62, 0x96, 0x57, 0xac, 0x1f,
+  0x11, 0x78, 0x36, 0xdf, 0xa0, 0x46, 0x86, 0xdf, 0x8d, 0xcb, 0xab, 0x70,
+  0x4a, 0x20, 0xf2, 0x65, 0x79, 0x83, 0xf7, 0xa6, 0x18, 0x03, 0x16, 0xe6,
+  0x20, 0x7e, 0x75, 0xf4, 0x57, 0x47, 0xaf, 0x00, 0xac, 0xc8, 0x2d, 0x45,
+  0xb7, 0xad, 0x55, 0xdf, 0xd8, 0xdc, 0xf5, 0xe5, 0x0c, 0xa3, 0xf8, 0xc0,
+  0x19, 0x62, 0xa9, 0x6c, 0xa3, 0x27, 0x1d, 0x9d, 0x04, 0x53, 0xc8, 0x96,
+  0x80, 0xef, 0xd9, 0x50, 0x33, 0xc6, 0x59, 0xdd, 0x76, 0xf4, 0x0f, 0x8a,
+  0x00, 0x4c, 0xa3, 0x9e, 0xc5, 0x67, 0x0f, 0x46, 0xbc, 0x17, 0xbb, 0x5d,
+  0xf1, 0x03, 0x6f, 0x7d, 0xf5, 0x92, 0xa4, 0xdf, 0x8d, 0xfd, 0x4b, 0xd1,
+  0x50, 0x34, 0xa4, 0x65, 0xe8, 0x11, 0xdd, 0x9c, 0x8b, 0x0b, 0x50, 0x0a,
+  0x67, 0x29, 0x04, 0x7f, 0xeb, 0xab, 0xf3, 0xf7, 0x09, 0xfd, 0x29, 0x2b,
+  0x4b, 0xb1, 0x15, 0x38, 0x75, 0x6d, 0xe7, 0x79, 0x6c, 0xa7, 0xc2, 0xb6,
+  0x43, 0xf5, 0xb7, 0x4e, 0x96, 0x2e, 0x36, 0xcd, 0x20, 0x47, 0x98, 0x9e,
+  0x56, 0xd4, 0x76, 0x61, 0x43, 0x7f, 0x95, 0xba, 0xb6, 0x47, 0x88, 0x19,
+  0xb7, 0xf3, 0xd9, 0x82, 0x11, 0x6a, 0x7d, 0x39, 0xe1, 0x7d, 0xc1, 0x6c,
+  0xd1, 0x46, 0xa8, 0x42, 0x0d, 0xe8, 0xd4, 0xc9, 0x21, 0x99, 0x1e, 0x7e,
+  0x90, 0x2c, 0x88, 0x84, 0x54, 0x4d, 0x65, 0xf7, 0x2d, 0x4d, 0x13, 0xd4,
+  0x49, 0xd0, 0x31, 0x38, 0x07, 0x18, 0x20, 0xe5, 0x2b, 0x76, 0xb9, 0x22,
+  0x8d, 0xff, 0x20, 0x73, 0x91, 0x71, 0x62, 0xac, 0x79, 0xdb, 0xd8, 0x90,
+  0xea, 0x56, 0xe1, 0x7a, 0x4c, 0x35, 0x5b, 0xb9, 0x1a, 0xd6, 0x01, 0x0c,
+  0xbe, 0x29, 0x25, 0x6a, 0x9b, 0x8c, 0xab, 0x90, 0x55, 0x50, 0xed, 0xaa,
+  0x55, 0x14, 0xb7, 0xa5, 0xc5, 0xf4, 0x17, 0xdc, 0xfa, 0xe9, 0x73, 0xfa,
+  0x4b, 0x60, 0x7c, 0x89, 0x95, 0x6a, 0x77, 0x5d, 0x64, 0x75, 0xa9, 0x1e,
+  0xdd, 0x54, 0x40, 0x60, 0xe3, 0xe8, 0x36, 0xc5, 0x6c, 0x0f, 0x4b, 0x70,
+  0x5c, 0xc0, 0x04, 0xdb, 0xa3, 0x39, 0xe3, 0xb0, 0x94, 0x01, 0xa6, 0x68,
+  0x64, 0x68, 0x66, 0xe9, 0x97, 0xc3, 0x75, 0x6f, 0x95, 0x7e, 0xc8, 0x9f,
+  0xd1, 0x82, 0x8d, 0x38, 0xa5, 0xf5, 0x45, 0xc8, 0xa4, 0x8d, 0x6f, 0x6f,
+  0x3a, 0x7d, 0xcc, 0x16, 0xc5, 0xbd, 0x3d, 0x1b, 0x10, 0x87, 0x21, 0xe4,
+  0xee, 0x7c, 0xbd, 0x59, 0xeb, 0x28, 0x95, 0xda, 0x59, 0xae, 0x56, 0xe7,
+  0xda, 0xac, 0x73, 0x84, 0x79, 0xcb, 0x29, 0x6f, 0xc7, 0x09, 0x2b, 0xcd,
+  0xbf, 0x9c, 0xfb, 0xfb, 0x7f, 0x3d, 0x83, 0x89, 0xf3, 0xf6, 0xe8, 0x89,
+  0x3d, 0xda, 0x43, 0xaf, 0xba, 0x3a, 0xd0, 0xe3, 0xae, 0x3e, 0x61, 0x0f,
+  0x9d, 0x86, 0x07, 0xfc, 0xd6, 0xe4, 0x59, 0x6a, 0x70, 0x2c, 0x24, 0x29,
+  0x21, 0x20, 0x52, 0x01, 0x3f, 0x7c, 0x27, 0x56, 0xba, 0xa0, 0x13, 0x8d,
+  0x93, 0x6e, 0x9b, 0xe5, 0xee, 0x6a, 0xe3, 0x5a, 0xe7, 0x86, 0x33, 0x7a,
+  0x50, 0x45, 0x98, 0xd4, 0xd5, 0x51, 0xc3, 0x12, 0xca, 0x7a, 0xf3, 0xf2,
+  0x97, 0x6c, 0x1f, 0x9f, 0xaa, 0x55, 0xbf, 0xe1, 0x2a, 0x0d, 0x80, 0xbd,
+  0x3d, 0x91, 0x00, 0xd2, 0xa1, 0x4d, 0x51, 0xa3, 0x3b, 0x3f, 0xc9, 0x94,
+  0x06, 0x94, 0x87, 0xb7, 0x9f, 0xfd, 0xe3, 0x2f, 0x7f, 0x65, 0xa9, 0x0a,
+  0x17, 0x8d, 0x32, 0xd5, 0x76, 0xa0, 0xaf, 0x1b, 0xaf, 0x5d, 0x5b, 0x95,
+  0xfb, 0x56, 0x6d, 0x2f, 0x71, 0xad, 0x44, 0x20, 0x4f, 0xd4, 0x21, 0xaf,
+  0xba, 0x81, 0xa8, 0xb3, 0xba, 0xf6, 0x48, 0xf2, 0xbc, 0xbf, 0x62, 0xa4,
+  0x66, 0xe7, 0x35, 0x47, 0x85, 0xd6, 0xce, 0x0a, 0xbf, 0x34, 0xe6, 0x56,
+  0x87, 0xc2, 0x6d, 0x7b, 0x70, 0x90, 0xb6, 0x25, 0x0e, 0x45, 0xe1, 0xf6,
+  0x0b, 0xd1, 0xb7, 0xa5, 0x1c, 0xeb, 0xcd, 0x13, 0xc0, 0xb1, 0x2b, 0x94,
+  0x6a, 0x0c, 0x4a, 0x8f, 0x8b, 0x21, 0x3e, 0xfd, 0xb3, 0x15, 0xca, 0x39,
+  0xe9, 0x12, 0x84, 0x88, 0x6e, 0x55, 0x87, 0x15, 0xc7, 0x2d, 0xef, 0xf0,
+  0xa2, 0x5d, 0x45, 0x6b, 0xa9, 0x91, 0x87, 0x92, 0xd6, 0x96, 0x9b, 0x9b,
+  0x7a, 0xa7, 0x89, 0x68, 0x32, 0x36, 0x77, 0xca, 0x5a, 0x54, 0x04, 0xdf,
+  0xfe, 0x9d, 0x35, 0x89, 0x52, 0x92, 0x46, 0xb0, 0xe1, 0x96, 0xb6, 0xb3,
+  0x42, 0x63, 0x4d, 0x1a, 0x0d, 0x6e, 0x9e, 0xa2, 0x4a, 0x5d, 0x43, 0x0d,
+  0x4c, 0xec, 0xf2, 0xbb, 0xbb, 0x8e, 0xa5, 0xf4, 0x9f, 0xa3, 0x30, 0x69,
+  0x0d, 0x9b, 0x2e, 0x4f, 0x9b, 0xd5, 0x86, 0x21, 0xdc, 0xe3, 0x06, 0xb1,
+  0x54, 0xd1, 0xfb, 0x8a, 0xa6, 0x14, 0x0a, 0x5a, 0x2c, 0x0c, 0xb8, 0x9b,
+  0x71, 0xf4, 0xf9, 0xa6, 0xa6, 0x1b, 0x00, 0xe7, 0xc2, 0x31, 0x86, 0xf4,
+  0xb4, 0x21, 0x49, 0x47, 0xf9, 0x85, 0xb5, 0x91, 0xbe, 0x8d, 0x0c, 0xa0,
+  0xeb, 0x32, 0x63, 0x2e, 0x1c, 0x0c, 0x06, 0x23, 0xa2, 0x06, 0x61, 0xf2,
+  0x43, 0x33, 0x72, 0xdb, 0xa0, 0xe8, 0x2c, 0xe6, 0x31, 0xcc, 0x5d, 0x3e,
+  0x68, 0x99, 0xa9, 0x00, 0x7e, 0x46, 0x33, 0xda, 0xa8, 0xe4, 0x3d, 0x87,
+  0x67, 0xbd, 0xd2, 0x9c, 0x0d, 0x81, 0xfb, 0x8a, 0x73, 0xe6, 0x8a, 0x3e,
+  0xd1, 0x58, 0xfd, 0x4c, 0x9f, 0xa8, 0xd8, 0x16, 0xa8, 0xdc, 0xa2, 0x6d,
+  0xbd, 0xbe, 0x50, 0xa6, 0x6e, 0xcc, 0xb1, 0xba, 0x61, 0x1c, 0x71, 0x27,
+  0x36, 0x51, 0x11, 0x94, 0xe0, 0x82, 0x08, 0x10, 0x2f, 0x27, 0x22, 0x6a,
+  0x2b, 0xae, 0x67, 0xab, 0x41, 0x53, 0x6b, 0xd7, 0x2f, 0x2c, 0x45, 0x47,
+  0xc3, 0xd3, 0x71, 0xb1, 0xd0, 0x73, 0xa1, 0x57, 0x2c, 0xac, 0x90, 0xf6,
+  0xca, 0xba, 0x44, 0xc7, 0x4c, 0x76, 0xc9, 0x75, 0x85, 0x24, 0xb7, 0x2d,
+  0x86, 0x92, 0xe3, 0x4e, 0xc1, 0xbe, 0x1f, 0x1f, 0xe7, 0x27, 0x5e, 0x02,
+  0xdb, 0xb9, 0x1e, 0x65, 0xc7, 0x76, 0x33, 0x25, 0x59, 0x2c, 0x25, 0xcc,
+  0x09, 0x59, 0xce, 0xc6, 0xa1, 0xf6, 0x29, 0xc4, 0x98, 0x64, 0x61, 0x68,
+  0x79, 0xeb, 0xd1, 0xe7, 0xbc, 0xf2, 0xf0, 0xeb, 0xd9, 0x72, 0x5c, 0x8a,
+  0x2c, 0x2c, 0xd6, 0x7c, 0x8f, 0x58, 0x04, 0xff, 0xb3, 0xc5, 0xfc, 0xc3,
+  0xf3, 0x37, 0xdf, 0xc1, 0x72, 0x8e, 0xfc, 0xe1, 0x6b, 0xfc, 0xeb, 0x57,
+  0x6f, 0x5e, 0x7d, 0x80, 0x74, 0xe5, 0xcc, 0x9f, 0xe3, 0xbf, 0x7a, 0xf3,
+  0x1c, 0xf1, 0x6b, 0x6f, 0x6f, 0xf9, 0xe3, 0x3b, 0x48, 0x83, 0x9a, 0x50,
+  0xb7, 0x43, 0xf6, 0x34, 0xf9, 0xaa, 0x4c, 0x4e, 0x24, 0x1f, 0x19, 0x9f,
+  0x31, 0xd5, 0x59, 0xab, 0x7d, 0x29, 0x6d, 0x5b, 0xd7, 0x7e, 0x47, 0xb1,
+  0x6c, 0xbe, 0xb8, 0x51, 0x07, 0xab, 0x11, 0x9c, 0xa6, 0xd8, 0xa0, 0x53,
+  0x09, 0x6c, 0xcc, 0x49, 0x4a, 0x3d, 0x3c, 0xfe, 0x48, 0xd6, 0x3a, 0xf8,
+  0x71, 0x1e, 0xea, 0x09, 0x26, 0x0e, 0x82, 0xaf, 0xab, 0xf3, 0xba, 0xdd,
+  0xc9, 0x9f, 0x33, 0xdf, 0x15, 0x9e, 0x01, 0x7b, 0x9e, 0xb7, 0x4d, 0xcc,
+  0x74, 0x42, 0x83, 0xa3, 0x9f, 0xed, 0x5b, 0xef, 0x86, 0x3b, 0xce, 0x92,
+  0xd8, 0xe0, 0xae, 0x4e, 0x68, 0xfa, 0x8f, 0x7f, 0x5a, 0x17, 0xcd, 0xcf,
+  0xe6, 0x68, 0xd9, 0x55, 0x5f, 0xec, 0x80, 0xe9, 0x79, 0x11, 0x58, 0x1f,
+  0x6a, 0x4f, 0x97, 0x18, 0x37, 0xbe, 0x9b, 0xfd, 0x78, 0x00, 0x2d, 0x3b,
+  0xc0, 0xe0, 0xa1, 0x59, 0xae, 0xa2, 0x3f, 0xea, 0xdb, 0x5a, 0x8c, 0x04,
+  0xbb, 0x23, 0xd7, 0x0b, 0x8a, 0x16, 0x9b, 0xf3, 0xa0, 0x91, 0x18, 0xaa,
+  0x12, 0xeb, 0x83, 0x69, 0x89, 0x7f, 0xbe, 0xe9, 0x5b, 0x8a, 0xc8, 0x51,
+  0x28, 0xf3, 0xdd, 0x38, 0x3f, 0x0f, 0x54, 0x9b, 0x5c, 0x54, 0x3e, 0x2d,
+  0xa5, 0xcd, 0x96, 0xca, 0x6b, 0x61, 0xa7, 0xef, 0x7b, 0x35, 0xc4, 0xed,
+  0x31, 0xea, 0xd8, 0xd0, 0x38, 0xde, 0xc3, 0x94, 0x77, 0xa4, 0x6a, 0x88,
+  0x59, 0xcf, 0xa5, 0x9b, 0x47, 0x9b, 0xf2, 0xa1, 0x5a, 0xa9, 0xf7, 0xc8,
+  0xe1, 0x64, 0x82, 0x6f, 0xde, 0xb8, 0x50, 0x9a, 0x46, 0x3e, 0x3e, 0xde,
+  0xdb, 0xd3, 0x14, 0x11, 0x33, 0x80, 0x24, 0xfa, 0xfb, 0xd8, 0x62, 0xec,
+  0xdf, 0x07, 0xa2, 0x30, 0x27, 0xc8, 0x9c, 0xff, 0x89, 0xcf, 0xee, 0x04,
+  0x3f, 0xb0, 0xf0, 0x03, 0x12, 0x96, 0x51, 0xb1, 0xab, 0xee, 0x4c, 0xd6,
+  0x2a, 0xec, 0x32, 0x60, 0xfe, 0xdb, 0x32, 0xdb, 0x87, 0x5c, 0xfa, 0x7e,
+  0x9f, 0x33, 0x2d, 0x67, 0x2c, 0xc2, 0x84, 0x83, 0xfb, 0xea, 0x01, 0x73,
+  0x32, 0xf1, 0x57, 0x53, 0x0c, 0xbb, 0xe6, 0xf3, 0x4f, 0x15, 0x88, 0x92,
+  0xeb, 0xa7, 0x46, 0xe3, 0x3e, 0xe6, 0x7e, 0x31, 0x55, 0x28, 0xb6, 0x3e,
+  0x42, 0xd5, 0xd5, 0x13, 0xfe, 0xb2, 0x71, 0x4e, 0xa1, 0x45, 0x85, 0xcb,
+  0x78, 0xe0, 0x65, 0xdc, 0xbf, 0x4f, 0xa2, 0xa2, 0xe8, 0x2e, 0xc0, 0xd6,
+  0xed, 0xb7, 0x9d, 0x84, 0x6d, 0x63, 0x7c, 0xed, 0x0b, 0xb6, 0xf3, 0x39,
+  0xc7, 0xd1, 0xe8, 0xd6, 0x13, 0xc4, 0xf4, 0xee, 0x71, 0x21, 0x7b, 0xea,
+  0x80, 0x77, 0xa4, 0xf6, 0x1a, 0xcb, 0x7c, 0x94, 0xea, 0x80, 0x17, 0x34,
+  0x13, 0xdd, 0xb2, 0xa5, 0xe6, 0x96, 0xfe, 0x3e, 0x61, 0x73, 0x4c, 0x27,
+  0xf5, 0xef, 0xef, 0x99, 0x9c, 0xfd, 0xfb, 0x70, 0x28, 0x70, 0x08, 0x2c,
+  0x79, 0xc7, 0xf4, 0x1b, 0xcd, 0xab, 0x91, 0xbd, 0xca, 0x19, 0xb9, 0x99,
+  0xb6, 0x59, 0xcf, 0xfb, 0xdf, 0xbf, 0x7f, 0x7d, 0x38, 0x86, 0x65, 0xa6,
+  0x29, 0xdf, 0x8d, 0x2e, 0x40, 0x72, 0x84, 0xef, 0xee, 0x28, 0x77, 0x7e,
+  0xde, 0xac, 0x53, 0x68, 0x85, 0xf4, 0x7c, 0x5e, 0xe2, 0x57, 0x37, 0x23,
+  0x5b, 0xba, 0xa1, 0xd2, 0x1e, 0x84, 0x72, 0xf0, 0xb7, 0x6d, 0x90, 0xa5,
+  0xa6, 0xac, 0x57, 0x5f, 0x3c, 0x58, 0xcc, 0xc6, 0x38, 0xc6, 0x0e, 0x74,
+  0xea, 0x21, 0xf4, 0x05, 0xd0, 0xc1, 0x41, 0x94, 0x84, 0x25, 0x8c, 0xe7,
+  0xe4, 0xdf, 0xb7, 0xc7, 0xfd, 0xe8, 0xa2, 0x0b, 0x44, 0x6c, 0xe4, 0xba,
+  0xbc, 0xaa, 0x2e, 0x59, 0x23, 0xa1, 0xd2, 0xdc, 0xfa, 0xe7, 0x95, 0x4e,
+  0x0c, 0x54, 0x1f, 0xb8, 0x05, 0xaf, 0x4e, 0xa8, 0x34, 0xdf, 0xab, 0xc3,
+  0x80, 0xa1, 0x53, 0x1e, 0x62, 0x56, 0xbf, 0x64, 0x07, 0x71, 0x6e, 0xa5,
+  0xb3, 0x03, 0xae, 0x2d, 0x5c, 0x50, 0x3c, 0x5b, 0xaf, 0x49, 0x3a, 0x98,
+  0xe7, 0xdb, 0xb2, 0x79, 0x5f, 0x7a, 0x0d, 0x63, 0xf7, 0x66, 0xca, 0x9c,
+  0x4a, 0x07, 0x00, 0xb5, 0xc1, 0x55, 0x4c, 0x1c, 0xd0, 0xbb, 0xbb, 0x8c,
+  0xb2, 0x76, 0x7e, 0x98, 0xc1, 0x42, 0xd6, 0x31, 0x21, 0x50, 0x28, 0xe0,
+  0xb6, 0xf2, 0x77, 0x7b, 0x92, 0xe1, 0xdd, 0x0a, 0xb9, 0xb6, 0x85, 0xdc,
+  0xd7, 0xd5, 0xfa, 0x92, 0x3f, 0xcd, 0x09, 0xc5, 0x48, 0x72, 0xf9, 0xca,
+  0xad, 0x90, 0x7a, 0x4c, 0x5f, 0xb2, 0xe7, 0x54, 0x06, 0x7a, 0xec, 0x16,
+  0xb1, 0xe7, 0x36, 0x12, 0x46, 0x19, 0x4a, 0x90, 0x1f, 0xd4, 0x95, 0xe2,
+  0x6b, 0xf2, 0x90, 0x6c, 0x69, 0x1b, 0xb5, 0x49, 0xc6, 0x90, 0x9a, 0x23,
+  0x86, 0x94, 0x0e, 0x63, 0x2e, 0x44, 0xf5, 0x8d, 0xe5, 0x91, 0xca, 0xdf,
+  0xe6, 0x5a, 0xf8, 0x42, 0xbb, 0x7a, 0x86, 0x93, 0x50, 0x65, 0x1e, 0x8e,
+  0x2b, 0x90, 0x54, 0xf1, 0xc8, 0xd1, 0xcd, 0x74, 0x33, 0x95, 0x64, 0xaa,
+  0x5a, 0x0e, 0xbc, 0xbb, 0xd0, 0xb1, 0x32, 0x7b, 0x5a, 0xc9, 0xf4, 0x89,
+  0xda, 0xf4, 0x3c, 0x8f, 0xcf, 0x36, 0x3d, 0xef, 0x6d, 0x81, 0xa5, 0xd6,
+  0x19, 0x87, 0x4e, 0x2f, 0xbe, 0xa0, 0x71, 0x68, 0x8d, 0x05, 0xe6, 0x5a,
+  0xa6, 0x5d, 0x94, 0xa7, 0x56, 0x7d, 0x08, 0x93, 0x71, 0x59, 0xb3, 0x63,
+  0xaa, 0x4f, 0x08, 0x3d, 0x95, 0x52, 0xe9, 0xeb, 0x65, 0xe5, 0xf1, 0x93,
+  0x20, 0x7d, 0x87, 0x4a, 0xde, 0x5c, 0x87, 0xf3, 0x53, 0x98, 0xda, 0xc3,
+  0x73, 0x8a, 0xc0, 0xf2, 0x0a, 0xa4, 0x2c, 0x5d, 0x05, 0xac, 0x85, 0x3a,
+  0xaa, 0x19, 0xc5, 0x92, 0xfb, 0x80, 0x1f, 0x40, 0xc0, 0x16, 0xe9, 0xf1,
+  0x52, 0x58, 0xa8, 0xb9, 0x5e, 0x2c, 0x0c, 0x65, 0xcf, 0xb9, 0x5d, 0xe5,
+  0xea, 0xad, 0x4e, 0x7d, 0x53, 0xc2, 0x95, 0xd6, 0xa4, 0xd3, 0x9e, 0x94,
+  0x70, 0xad, 0x0c, 0xc8, 0xb4, 0x02, 0x25, 0x06, 0x29, 0x7d, 0xf8, 0xcf,
+  0xfe, 0x12, 0x85, 0x14, 0x40, 0x62, 0x6f, 0xe8, 0x12, 0x51, 0xbf, 0xe0,
+  0x06, 0x0f, 0xba, 0x12, 0x4f, 0xbd, 0xe6, 0x46, 0x5f, 0x3f, 0x83, 0x22,
+  0x9d, 0x4a, 0x9d, 0xd0, 0xaf, 0x73, 0xbe, 0x62, 0x03, 0x3b, 0x98, 0x42,
+  0xbb, 0x08, 0xd7, 0x3e, 0x5e, 0x3c, 0x9b, 0x92, 0x22, 0xc0, 0xd6, 0x2e,
+  0x51, 0x14, 0xf3, 0xbd, 0x12, 0x9d, 0xef, 0x8c, 0x82, 0x79, 0x3a, 0x8a,
+  0xd5, 0xed, 0x9c, 0x50, 0x14, 0xcc, 0x5f, 0x51, 0x0a, 0x53, 0xf9, 0x73,
+  0x28, 0x98, 0xe3, 0xa1, 0x64, 0x99, 0xe4, 0x14, 0xa8, 0x60, 0xee, 0x83,
+  0x52, 0x98, 0xda, 0x75, 0x42, 0xc1, 0x1d, 0xff, 0xa4, 0x70, 0x99, 0xa3,
+  0x81, 0x42, 0x7a, 0xf0, 0x49, 0xe5, 0x61, 0xe6, 0xf9, 0x85, 0x70, 0xc1,
+  0x93, 0xca, 0xe2, 0x86, 0x4a, 0x21, 0x5c, 0xe8, 0xa4, 0x72, 0x70, 0x33,
+  0xe9, 0x42, 0x7a, 0xc2, 0xc9, 0x7b, 0xce, 0x6f, 0x6f, 0x7c, 0x76, 0x48,
+  0xb8, 0x9c, 0x1d, 0x12, 0x1e, 0xce, 0x0e, 0x89, 0x11, 0x99, 0x1d, 0x12,
+  0x25, 0x39, 0x3b, 0x24, 0x62, 0x6a, 0x76, 0x48, 0xbc, 0x96, 0xd9, 0x11,
+  0x14, 0x99, 0x9a, 0x1d, 0x12, 0x51, 0xa9, 0x87, 0x15, 0x99, 0xa7, 0x0c,
+  0x96, 0x20, 0x58, 0x6b, 0x30, 0xf9, 0xda, 0x4c, 0x01, 0xeb, 0x94, 0x82,
+  0x57, 0xa0, 0x81, 0xe2, 0xe1, 0x59, 0x95, 0x7b, 0xae, 0x36, 0x1d, 0x60,
+  0xa0, 0xf9, 0x9e, 0x67, 0xc9, 0x17, 0x60, 0xa0, 0x22, 0xbe, 0x50, 0x0d,
+  0x0e, 0x70, 0xe8, 0x02, 0xb9, 0x70, 0xcf, 0x1c, 0x31, 0x1c, 0x7a, 0xbe,
+  0x88, 0xdc, 0xf7, 0x07, 0x88, 0xec, 0x9d, 0x49, 0x3c, 0x3a, 0xc5, 0x50,
+  0xf5, 0x2b, 0x8d, 0xf7, 0x62, 0x13, 0xe0, 0x29, 0xe3, 0x92, 0xc0, 0x9c,
+  0x4f, 0xf2, 0x95, 0xaf, 0x62, 0xa1, 0x35, 0x5c, 0x58, 0xbb, 0x16, 0xa5,
+  0x02, 0x63, 0xa9, 0x90, 0xcb, 0xce, 0xd4, 0x4c, 0xd8, 0x9d, 0x05, 0xa8,
+  0x81, 0xf3, 0xd5, 0xd0, 0x5f, 0x69, 0x30, 0x1c, 0x3c, 0x77, 0xa5, 0x71,
+  0x5f, 0x9e, 0xc9, 0x3c, 0xd5, 0xca, 0xcb, 0xe2, 0x9c, 0x5d, 0x06, 0x2d,
+  0x0b, 0x3d, 0x3f, 0xc6, 0xbd, 0x41, 0x86, 0xdc, 0x37, 0x0e, 0xab, 0x02,
+  0x97, 0x4f, 0x41, 0x07, 0xb0, 0x45, 0xdf, 0xf7, 0x9e, 0x14, 0xc5, 0xd4,
+  0x8b, 0xbe, 0xef, 0x86, 0x28, 0x8a, 0xa9, 0x17, 0x7d, 0xdf, 0xa3, 0x4f,
+  0xbc, 0x4c, 0xb5, 0xe8, 0x67, 0x9e, 0x5b, 0xb8, 0x28, 0xa6, 0x59, 0xf4,
+  0x85, 0xf7, 0x9c, 0x28, 0x2e, 0x5f, 0xf4, 0x23, 0xfe, 0x66, 0xa2, 0x79,
+  0xf8, 0xa2, 0x1f, 0xf1, 0xd2, 0x12, 0xcd, 0xc3, 0x56, 0xfd, 0xd0, 0xc1,
+  0x49, 0xbc, 0x63, 0xb4, 0x67, 0x10, 0xe9, 0x27, 0x24, 0x5a, 0xbc, 0xb7,
+  0x45, 0xc4, 0x9c, 0x6b, 0xc4, 0xab, 0xb0, 0x9e, 0x28, 0x02, 0xcf, 0x14,
+  0x4a, 0x64, 0x7c, 0xd9, 0xef, 0x4e, 0x67, 0x93, 0x62, 0x3d, 0x9b, 0xb8,
+  0x00, 0x57, 0xa8, 0x03, 0x04, 0x89, 0x79, 0x41, 0xd6, 0x46, 0x6b, 0x13,
+  0xeb, 0x6a, 0xba, 0xb7, 0x87, 0x77, 0x13, 0x53, 0x94, 0x18, 0xf1, 0xb4,
+  0xa4, 0x04, 0xc6, 0xce, 0xda, 0xbf, 0x92, 0xed, 0xf4, 0x3b, 0x5d, 0x91,
+  0xd4, 0x37, 0xfa, 0x4a, 0xf9, 0x49, 0x96, 0x3d, 0xb2, 0x96, 0x55, 0xf0,
+  0xdf, 0xb6, 0xf7, 0x92, 0x45, 0xec, 0xc3, 0x2b, 0x71, 0x17, 0x2c, 0x0b,
+  0x2a, 0x7d, 0xc9, 0x82, 0xf6, 0x21, 0xd0, 0xc5, 0xc9, 0x32, 0x40, 0x15,
+  0xb7, 0x0f, 0x61, 0x36, 0x42, 0x16, 0x03, 0xe9, 0xd0, 0x7d, 0x06, 0x6c,
+  0x03, 0x64, 0x19, 0x14, 0x15, 0xbd, 0x0f, 0xc1, 0x36, 0x2e, 0x96, 0x01,
+  0xe9, 0x00, 0x7e, 0x08, 0x73, 0x31, 0xb1, 0x0c, 0x50, 0x45, 0xeb, 0x53,
+  0x37, 0xf8, 0xeb, 0x00, 0x64, 0x42, 0xdf, 0x69, 0xb8, 0x0b, 0x86, 0x65,
+  0x70, 0x54, 0x50, 0x3f, 0x04, 0xdb, 0xa0, 0x53, 0x06, 0x64, 0x62, 0xf7,
+  0x21, 0x90, 0xc5, 0xc7, 0xb2, 0x34, 0xe9, 0xf0, 0x7d, 0x44, 0x91, 0x0b,
+  0x8d, 0x65, 0xc0, 0x3a, 0x82, 0x1f, 0x42, 0x5d, 0x50, 0x2c, 0xdb, 0xb2,
+  0x4f, 0xa6, 0x4d, 0x9f, 0x44, 0x9d, 0x3a, 0x96, 0x20, 0xd5, 0xe9, 0x22,
+  0x65, 0xd9, 0xd6, 0x52, 0xf0, 0x3f, 0x6a, 0xad, 0x09, 0x72, 0x65, 0x40,
+  0x2a, 0xfe, 0x1f, 0x82, 0x6c, 0x7c, 0x2b, 0x03, 0x32, 0x01, 0xfe, 0x10,
+  0xc8, 0x82, 0x5b, 0x39, 0x36, 0xf9, 0x31, 0xfe, 0xdc, 0x6b, 0x88, 0x17,
+  0xdf, 0xca, 0x47, 0x37, 0x11, 0xac, 0x04, 0xb2, 0x55, 0x16, 0x78, 0xe9,
+  0x45, 0xfa, 0x43, 0x2c, 0x1e, 0xce, 0xca, 0x96, 0xc5, 0x82, 0xfd, 0x51,
+  0x49, 0x7e, 0x30, 0x2b, 0xcb, 0x15, 0x19, 0x9e, 0x5c, 0xf1, 0x27, 0x16,
+  0xdc, 0x5d, 0x66, 0x51, 0x11, 0xca, 0x3d, 0x7c, 0x17, 0xd5, 0x3d, 0x40,
+  0xc6, 0x20, 0xe5, 0x3e, 0xae, 0x09, 0xe8, 0x6e, 0x50, 0xc3, 0x38, 0xe5,
+  0x84, 0x1f, 0x8f, 0xbb, 0xae, 0x8f, 0xd3, 0x74, 0x92, 0xfc, 0x1f, 0x8d,
+  0x3f, 0xbf, 0x8e, 0x2c, 0xa8, 0x00, 0x00
+};
+
+static const size_t WEBUI_APP_JS_GZ_LEN = 12583;
+static const char WEBUI_APP_JS_HASH[] = "c67a80a9bd5a7764";
+
+static const uint8_t WEBUI_APP_CSS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x59,
+  0x5b, 0x6f, 0xe3, 0xb8, 0x15, 0xfe, 0x2b, 0x6a, 0x82, 0x20, 0x51, 0x21,
+  0x09, 0x92, 0x7c, 0xa7, 0xb0, 0x83, 0x02, 0x0b, 0x2c, 0x50, 0xa0, 0xbb,
+  0x28, 0x76, 0xd1, 0xbe, 0x0c, 0xa6, 0x00, 0x25, 0x51, 0x36, 0x1b, 0x59,
+  0x14, 0x28, 0xca, 0x8e, 0x57, 0xd0, 0x7f, 0xef, 0x21, 0x29, 0xc9, 0xba,
+  0x39, 0x4e, 0x66, 0x5f, 0xf6, 0xa1, 0x93, 0x19, 0xc7, 0xbc, 0x9d, 0xeb,
+  0x77, 0x2e, 0xe4, 0x20, 0xce, 0x98, 0xa8, 0x22, 0x96, 0x32, 0x6e, 0x17,
+  0xd1, 0x81, 0x1c, 0x09, 0x4a, 0xe9, 0xfe, 0x20, 0x8c, 0x18, 0xf3, 0xd7,
+  0xc0, 0xb6, 0xc3, 0x3d, 0x7a, 0x4c, 0xd6, 0xc9, 0x26, 0x09, 0xd5, 0xc0,
+  0x47, 0x8f, 0x84, 0x24, 0x7e, 0xb2, 0x85, 0x51, 0x02, 0x4b, 0x6e, 0xe2,
+  0x6d, 0x7c, 0x0c, 0x83, 0x63, 0x29, 0x48, 0x8c, 0x1e, 0x57, 0xfe, 0xda,
+  0xdd, 0xec, 0x60, 0x1c, 0x61, 0x1e, 0x23, 0xbe, 0x0f, 0xf1, 0x8b, 0xbf,
+  0x5a, 0x59, 0xed, 0x3f, 0x67, 0xbb, 0x35, 0x9b, 0x45, 0x7f, 0x66, 0x75,
+  0xe3, 0xcb, 0xd5, 0x90, 0xf1, 0x98, 0x70, 0xbd, 0xec, 0xc1, 0xca, 0xc2,
+  0x5a, 0xfa, 0x96, 0xe3, 0xa9, 0x35, 0x1c, 0x45, 0xc0, 0x94, 0xe0, 0x15,
+  0xd9, 0xe9, 0x11, 0x08, 0xe4, 0xb9, 0xe1, 0x6e, 0xeb, 0xc1, 0xf0, 0x8c,
+  0x79, 0x06, 0xd2, 0xae, 0x76, 0xc4, 0x55, 0xd2, 0x62, 0x10, 0x88, 0x24,
+  0x4b, 0xf8, 0x03, 0xa3, 0xe2, 0x80, 0x63, 0x76, 0x46, 0xae, 0xe1, 0x2d,
+  0xf3, 0x37, 0x63, 0x21, 0x3f, 0xc6, 0x1c, 0x5c, 0xb3, 0xdb, 0xe7, 0xc3,
+  0xc6, 0x2d, 0x6c, 0xf1, 0xb6, 0xd3, 0x7d, 0xae, 0xd2, 0x81, 0x03, 0xb1,
+  0xf1, 0xc2, 0xa2, 0x59, 0xf0, 0x27, 0x2b, 0x2b, 0xb9, 0x92, 0x50, 0x92,
+  0xce, 0x19, 0x65, 0xe3, 0x9a, 0xf5, 0xdf, 0x8e, 0x24, 0xa6, 0xd8, 0x78,
+  0xc9, 0x39, 0x49, 0x08, 0x2f, 0xec, 0x81, 0x47, 0xa4, 0x2f, 0xcc, 0x0a,
+  0x29, 0x57, 0x69, 0x97, 0xb8, 0x1b, 0x17, 0x7b, 0xcb, 0xd6, 0x25, 0x6e,
+  0xe8, 0xad, 0x17, 0x7e, 0xe3, 0x12, 0xb2, 0x05, 0x0f, 0x45, 0x57, 0x97,
+  0xe0, 0x4d, 0xb8, 0x88, 0xc2, 0x81, 0x4b, 0xae, 0x82, 0x6d, 0xdc, 0x91,
+  0x3f, 0xae, 0x4b, 0xab, 0xd5, 0xd8, 0x19, 0xbe, 0xbf, 0x86, 0x45, 0xdf,
+  0xf2, 0x97, 0x2e, 0x58, 0x6b, 0x69, 0x0e, 0xac, 0x2a, 0x0d, 0xb5, 0xec,
+  0xac, 0xea, 0x5a, 0xf2, 0xa7, 0xa1, 0x71, 0x35, 0xa9, 0xe7, 0xc2, 0x06,
+  0xdf, 0x1f, 0xed, 0x5a, 0xba, 0x03, 0x83, 0x0e, 0x6c, 0xe3, 0x2e, 0x87,
+  0x36, 0x1d, 0x2e, 0xae, 0xdf, 0x33, 0x2b, 0x1c, 0xad, 0x6b, 0x65, 0xb4,
+  0xaf, 0x31, 0x16, 0xd8, 0x16, 0xd2, 0x96, 0x3f, 0x3c, 0x2b, 0x78, 0x3f,
+  0x7f, 0x9b, 0xc1, 0xfc, 0x9f, 0x0f, 0xee, 0x7f, 0x72, 0xd0, 0x4e, 0x8d,
+  0x2b, 0x91, 0x3a, 0xb6, 0x6d, 0x2f, 0x93, 0xfc, 0x1f, 0xb6, 0x1f, 0x83,
+  0xed, 0x5f, 0xab, 0x90, 0xbd, 0xd9, 0x05, 0xfd, 0x9d, 0x66, 0x7b, 0xa4,
+  0x75, 0x01, 0x95, 0xde, 0xea, 0x90, 0xc5, 0x97, 0x2a, 0x61, 0x99, 0xb0,
+  0x13, 0x7c, 0xa4, 0xe9, 0x05, 0x95, 0x14, 0x98, 0x94, 0x59, 0x4c, 0x62,
+  0xeb, 0xe1, 0xb7, 0x9f, 0x8c, 0x7f, 0x72, 0x66, 0xfc, 0xaa, 0xc7, 0x0f,
+  0x30, 0x41, 0xf6, 0x8c, 0x18, 0xff, 0xfa, 0xbb, 0xf1, 0x6f, 0xcc, 0x29,
+  0x0e, 0x53, 0xd2, 0x9b, 0x7b, 0xb0, 0x8a, 0x4b, 0x21, 0xc8, 0xd1, 0x2e,
+  0xa9, 0x65, 0xe3, 0x3c, 0x4f, 0x89, 0xad, 0x27, 0xac, 0x02, 0x67, 0x85,
+  0x5d, 0x10, 0x4e, 0x93, 0xe0, 0x88, 0xf9, 0x9e, 0x66, 0xc8, 0x0d, 0x94,
+  0x3f, 0xd1, 0x09, 0xf3, 0x17, 0xe9, 0x2c, 0x33, 0x08, 0x71, 0xf4, 0xba,
+  0x57, 0x8c, 0x11, 0xc7, 0x90, 0xb7, 0x52, 0x7b, 0x2f, 0x7f, 0x93, 0x4c,
+  0xbc, 0x78, 0x9e, 0x2b, 0xad, 0xb5, 0x51, 0x9f, 0x58, 0x18, 0x9e, 0xff,
+  0x64, 0xd8, 0x9e, 0xfb, 0x64, 0x69, 0x3f, 0x2d, 0x2d, 0x6f, 0x2d, 0x7d,
+  0xb5, 0x00, 0x57, 0x6c, 0x4d, 0x4b, 0x70, 0xe0, 0x96, 0x63, 0x0e, 0x27,
+  0x8d, 0xb5, 0xfb, 0x64, 0x5a, 0x63, 0x72, 0xbb, 0x21, 0xb5, 0x9d, 0x0b,
+  0xd4, 0xfc, 0x8e, 0xda, 0xda, 0xf2, 0xb6, 0x2b, 0xcb, 0xf3, 0x77, 0x40,
+  0x6d, 0x3d, 0xa4, 0xb6, 0x5a, 0x01, 0xb5, 0x94, 0x66, 0x04, 0xf3, 0x9e,
+  0x70, 0x5b, 0x37, 0x26, 0x7b, 0x4b, 0x2b, 0x12, 0xee, 0xcd, 0xee, 0x9b,
+  0x6f, 0x9a, 0xc1, 0x91, 0x66, 0xf6, 0x81, 0xc8, 0x44, 0x80, 0x40, 0x87,
+  0xd3, 0xa1, 0xc6, 0x1a, 0xc7, 0x88, 0x66, 0x07, 0x30, 0x87, 0xa8, 0x9d,
+  0x1c, 0xef, 0x49, 0x75, 0xc4, 0x6f, 0xf6, 0x99, 0xc6, 0xe2, 0x80, 0xb4,
+  0xaa, 0x9d, 0x95, 0x0c, 0x5c, 0x0a, 0x16, 0xe4, 0x38, 0x8e, 0xa5, 0xd7,
+  0x14, 0xb2, 0xbc, 0xb5, 0x04, 0x0e, 0xc0, 0xab, 0x76, 0x24, 0x58, 0xab,
+  0x9e, 0xdd, 0x34, 0x67, 0x39, 0x0b, 0xe6, 0xd4, 0x68, 0xf5, 0x60, 0x73,
+  0xc1, 0x52, 0x1a, 0x1b, 0x8d, 0x58, 0x6a, 0xba, 0x5d, 0xb6, 0xa5, 0x12,
+  0x65, 0x81, 0x24, 0xcd, 0x2b, 0x97, 0x65, 0x4f, 0x80, 0x40, 0x81, 0x46,
+  0x43, 0x5b, 0x53, 0x68, 0x20, 0xac, 0x1d, 0x16, 0x73, 0x96, 0x03, 0xea,
+  0x52, 0x01, 0xac, 0xc2, 0xb4, 0xe4, 0x2f, 0x12, 0xd6, 0xa6, 0xd6, 0xea,
+  0x8b, 0x96, 0x4f, 0x53, 0x02, 0xc6, 0x42, 0xb0, 0xa3, 0x22, 0x5e, 0x3b,
+  0x82, 0xe5, 0x55, 0xce, 0x0a, 0x2a, 0x28, 0xcb, 0x50, 0x21, 0x68, 0xf4,
+  0x7a, 0x09, 0x60, 0x0e, 0xd8, 0xfd, 0x6e, 0x53, 0x40, 0xda, 0x1b, 0x5a,
+  0xb9, 0xb5, 0x03, 0x16, 0x62, 0x55, 0x4c, 0x8b, 0x3c, 0xc5, 0x17, 0x94,
+  0xa4, 0xe4, 0x2d, 0xf8, 0x6f, 0x09, 0x9b, 0x93, 0x0b, 0x54, 0xb2, 0x4c,
+  0x80, 0xed, 0x11, 0x38, 0x26, 0x22, 0x76, 0x48, 0xc4, 0x99, 0x90, 0x2c,
+  0xc0, 0x90, 0x71, 0x33, 0x9b, 0x02, 0xe0, 0x0a, 0xb5, 0xdd, 0x2e, 0x04,
+  0xe6, 0x22, 0xd8, 0xe3, 0x1c, 0x79, 0x7e, 0x5f, 0x27, 0xb5, 0x78, 0xe6,
+  0x30, 0x2f, 0x3f, 0x34, 0xa3, 0x2f, 0x31, 0x3d, 0xa1, 0x84, 0xf2, 0x42,
+  0xd8, 0xd1, 0x81, 0xa6, 0x20, 0x37, 0x08, 0xad, 0x7d, 0xa2, 0x0f, 0x20,
+  0xcf, 0xf0, 0x8c, 0xc5, 0xda, 0x95, 0xf2, 0x87, 0x00, 0x8a, 0x78, 0x28,
+  0xda, 0x3d, 0xe6, 0x63, 0x9e, 0x82, 0x8a, 0x94, 0xe8, 0xb8, 0x3b, 0x6b,
+  0x80, 0x6c, 0x57, 0xc0, 0x48, 0x8e, 0x21, 0x46, 0x09, 0xf2, 0x76, 0x70,
+  0x28, 0x25, 0x02, 0x2c, 0x6b, 0x4b, 0x35, 0xa5, 0x67, 0x1c, 0x49, 0x48,
+  0xe2, 0xaf, 0xc3, 0x94, 0xe3, 0xd5, 0x4e, 0x51, 0x86, 0x9a, 0x58, 0x3f,
+  0xa2, 0x54, 0xc6, 0x33, 0xfb, 0xf4, 0x7c, 0x67, 0x35, 0x39, 0xbd, 0x6c,
+  0x6c, 0x62, 0x4b, 0xe3, 0x4b, 0x0c, 0xb0, 0x13, 0xe1, 0x49, 0xca, 0xce,
+  0x5a, 0x52, 0x9c, 0x5d, 0xce, 0x60, 0x1b, 0x12, 0x9c, 0x01, 0x2d, 0x76,
+  0xc8, 0x09, 0x7e, 0x45, 0xea, 0xd3, 0x96, 0x13, 0x57, 0xce, 0x06, 0x1e,
+  0xf0, 0x86, 0x16, 0xca, 0x0c, 0x04, 0x79, 0x13, 0x76, 0x4c, 0x22, 0xc6,
+  0xb1, 0xf2, 0x72, 0xc6, 0x32, 0x12, 0x74, 0x69, 0x47, 0x63, 0xa1, 0xc3,
+  0x66, 0x2f, 0xc8, 0xbe, 0x5b, 0x04, 0x74, 0x90, 0x27, 0xab, 0x01, 0x0b,
+  0xdd, 0xf2, 0xa0, 0x49, 0x9a, 0x80, 0x64, 0x0c, 0x4e, 0xc4, 0x31, 0x84,
+  0x5e, 0xeb, 0x44, 0x9a, 0x29, 0xd3, 0x4c, 0x7c, 0x19, 0x81, 0x4c, 0x84,
+  0x2b, 0x3f, 0x4a, 0x03, 0xdd, 0x0b, 0xab, 0x71, 0x30, 0x42, 0xba, 0x36,
+  0x83, 0x19, 0xc7, 0xb4, 0xc1, 0x26, 0xcb, 0x84, 0x8c, 0x99, 0x51, 0x40,
+  0xee, 0x76, 0xd2, 0xfd, 0x7d, 0xef, 0x49, 0xd8, 0x01, 0xb1, 0x4e, 0xde,
+  0x3d, 0xa7, 0x71, 0x20, 0x3f, 0x6c, 0x10, 0x13, 0x66, 0x04, 0x91, 0xca,
+  0x96, 0xc7, 0xac, 0x40, 0x9c, 0xe4, 0x04, 0x8b, 0x17, 0x99, 0x3a, 0x20,
+  0x36, 0x85, 0x05, 0x48, 0x86, 0x04, 0xf3, 0xe2, 0x6f, 0x81, 0x8f, 0xe5,
+  0x25, 0x1c, 0xf2, 0x92, 0x82, 0xa5, 0x0c, 0xc5, 0x83, 0x5f, 0x0d, 0xb9,
+  0x5c, 0x53, 0x8f, 0xae, 0x51, 0xc1, 0x2d, 0x54, 0xb5, 0xa8, 0x75, 0xdd,
+  0x09, 0x4c, 0xbd, 0x25, 0x39, 0x6a, 0x00, 0x28, 0xc7, 0x26, 0x8c, 0x1f,
+  0x51, 0x99, 0xe7, 0x84, 0x47, 0xb8, 0x20, 0x75, 0x4c, 0x04, 0xa6, 0x69,
+  0xa1, 0xb2, 0xc3, 0x97, 0xa2, 0x3c, 0x02, 0xc3, 0x0b, 0xf8, 0xf1, 0x58,
+  0xa5, 0x14, 0x82, 0xaf, 0x10, 0x97, 0x94, 0x68, 0xb4, 0x44, 0x25, 0x2f,
+  0x80, 0x75, 0xce, 0xa8, 0x72, 0xc1, 0xcd, 0x70, 0x6b, 0x5c, 0xf4, 0x7e,
+  0x72, 0x50, 0x1a, 0xbb, 0xbd, 0x34, 0xe7, 0x1a, 0x7e, 0x6b, 0xfb, 0xbe,
+  0xca, 0xfe, 0xd5, 0x17, 0x13, 0x98, 0x0e, 0x7c, 0x7d, 0x53, 0x0f, 0x84,
+  0xc0, 0x36, 0xe1, 0x2b, 0x95, 0xf0, 0x57, 0x3b, 0x6c, 0x58, 0x79, 0x05,
+  0x68, 0xb6, 0x0a, 0x48, 0xe5, 0x6e, 0x9e, 0x36, 0xc0, 0x23, 0xad, 0x3c,
+  0x90, 0xe1, 0x0f, 0xe4, 0x54, 0xe9, 0x2c, 0xe4, 0x4b, 0xf8, 0x35, 0x91,
+  0xeb, 0xaf, 0x6f, 0x20, 0xe6, 0x0e, 0x3c, 0x3f, 0x08, 0xf6, 0xb1, 0x25,
+  0x9b, 0xe9, 0x19, 0x24, 0xcc, 0xe3, 0xbd, 0x8f, 0x8f, 0x9d, 0xc4, 0x47,
+  0x3f, 0xe9, 0x68, 0xa5, 0x50, 0x48, 0x00, 0x16, 0x32, 0x67, 0x69, 0x16,
+  0xcf, 0xa7, 0xe7, 0xda, 0x68, 0x6c, 0xf2, 0x95, 0xe5, 0x24, 0xfb, 0x36,
+  0x30, 0xca, 0xfc, 0x99, 0xff, 0x3c, 0xd7, 0x7d, 0xbb, 0xab, 0x04, 0xa0,
+  0xb7, 0xb6, 0x69, 0xe0, 0x76, 0xfc, 0xcf, 0x8a, 0xee, 0x9b, 0xb5, 0x90,
+  0x4d, 0x4d, 0x63, 0x72, 0xa8, 0xc5, 0x4f, 0xc1, 0x95, 0x52, 0x8a, 0xf3,
+  0x82, 0xa0, 0x82, 0x40, 0xa2, 0x82, 0x70, 0x6b, 0x17, 0x5a, 0xd4, 0xab,
+  0x3e, 0xb9, 0x16, 0x71, 0xd5, 0xd5, 0x51, 0xb7, 0x8b, 0xed, 0x59, 0x2b,
+  0x35, 0xe7, 0x65, 0xea, 0xbd, 0x53, 0xa5, 0xef, 0x00, 0x51, 0x70, 0x43,
+  0xc4, 0x83, 0xda, 0xd5, 0x9c, 0x4b, 0x49, 0x22, 0xee, 0xd1, 0x06, 0xf6,
+  0x6a, 0x5f, 0xd7, 0x0a, 0x4c, 0x02, 0x60, 0xb2, 0xdc, 0x30, 0x4c, 0xf1,
+  0x98, 0x1f, 0xd7, 0x1e, 0xbe, 0xcf, 0x50, 0x6d, 0x7c, 0x87, 0xe3, 0x64,
+  0x1d, 0xec, 0xea, 0xbc, 0xce, 0x15, 0x38, 0xed, 0xa8, 0xe5, 0xf2, 0x69,
+  0x52, 0xea, 0xe4, 0x91, 0xd3, 0xa0, 0xc0, 0x6e, 0x86, 0x05, 0x76, 0x01,
+  0x7b, 0xc2, 0x12, 0xf8, 0x65, 0x56, 0x41, 0x52, 0x12, 0x09, 0x8b, 0x66,
+  0x79, 0x29, 0xd4, 0x91, 0xb6, 0x3f, 0xeb, 0xb2, 0xc5, 0x4e, 0xfa, 0xd2,
+  0x9b, 0x44, 0x5d, 0x4f, 0xf6, 0x8f, 0xd7, 0x04, 0xd5, 0xa5, 0x9b, 0xe3,
+  0x06, 0xb8, 0x66, 0xb9, 0x2c, 0x94, 0xfd, 0x7e, 0xee, 0x31, 0x49, 0x92,
+  0x66, 0x5b, 0x73, 0x4d, 0x6c, 0x04, 0xae, 0x6e, 0xd4, 0x99, 0x61, 0xc2,
+  0x1c, 0xa5, 0xe9, 0xe6, 0xec, 0xb0, 0x4e, 0x7e, 0x3e, 0x40, 0x1a, 0x2a,
+  0x90, 0x4a, 0x64, 0xa4, 0xc4, 0x15, 0x93, 0xf8, 0x17, 0x17, 0x04, 0x67,
+  0x5a, 0x01, 0x32, 0x26, 0x6c, 0x9c, 0x42, 0x0d, 0x27, 0x71, 0xb3, 0xdd,
+  0xc1, 0x91, 0xa0, 0x27, 0xd2, 0x97, 0x7b, 0xae, 0x77, 0x0f, 0xee, 0x4b,
+  0x35, 0xb6, 0x5a, 0x43, 0x3f, 0xc6, 0xd9, 0x5e, 0x6a, 0x35, 0xa2, 0xef,
+  0x2f, 0x76, 0xd6, 0x7a, 0x2b, 0xff, 0xaa, 0xdb, 0xef, 0x94, 0x7c, 0x6f,
+  0xc3, 0x62, 0x35, 0xa2, 0x76, 0xd3, 0x52, 0xbd, 0x43, 0x23, 0x43, 0x4d,
+  0x98, 0xae, 0x3b, 0x83, 0x25, 0x2c, 0x2a, 0x0b, 0xfb, 0x44, 0x0b, 0x0a,
+  0x66, 0x6b, 0x10, 0x37, 0x9a, 0x54, 0xf8, 0x1b, 0xcd, 0xe1, 0xe1, 0xb8,
+  0x62, 0xa5, 0x90, 0xe9, 0x14, 0x2d, 0x3a, 0xb4, 0x4d, 0xcc, 0x04, 0x8a,
+  0x04, 0xcd, 0x36, 0x9b, 0x25, 0x49, 0x41, 0xa0, 0x60, 0xc8, 0xf6, 0x41,
+  0xfa, 0x80, 0x65, 0xc5, 0xb0, 0x6f, 0x1d, 0xf6, 0xa5, 0xaa, 0x4c, 0x6e,
+  0xbb, 0x92, 0xa8, 0x93, 0x93, 0x4c, 0x61, 0xd3, 0x2a, 0x51, 0x3f, 0xe2,
+  0x18, 0xe2, 0x4b, 0x1e, 0x0f, 0x71, 0x41, 0x0b, 0x9d, 0x2d, 0x27, 0x0d,
+  0xe7, 0xed, 0xde, 0x47, 0x11, 0x5f, 0x4e, 0x7a, 0xd2, 0xc5, 0xaa, 0x76,
+  0xd8, 0xeb, 0xb8, 0xa1, 0x04, 0xe0, 0x19, 0x8e, 0x7c, 0x8c, 0x1b, 0x2c,
+  0xc8, 0x09, 0xb9, 0x00, 0xad, 0xdc, 0x60, 0x1e, 0xc6, 0x66, 0x0d, 0x89,
+  0x39, 0x03, 0x4a, 0x96, 0xfa, 0x2d, 0x77, 0xea, 0x6f, 0x72, 0xef, 0x07,
+  0xeb, 0x60, 0x1b, 0xfc, 0xfe, 0x7b, 0x4d, 0xda, 0x77, 0x75, 0x84, 0xa3,
+  0x9e, 0x6b, 0x1c, 0xa9, 0xce, 0x91, 0x65, 0x6c, 0x7c, 0x29, 0x97, 0x73,
+  0xaa, 0xa7, 0xb1, 0x7e, 0xfb, 0xe9, 0x67, 0xf8, 0x6e, 0xff, 0x4a, 0xf6,
+  0x65, 0x8a, 0xb9, 0xf5, 0x33, 0xc9, 0x52, 0x66, 0xc1, 0x14, 0x8e, 0x98,
+  0xf5, 0x23, 0x78, 0x98, 0x41, 0x6a, 0xb6, 0x1e, 0xfe, 0x41, 0x43, 0xa2,
+  0x9b, 0x6f, 0x43, 0x6e, 0x87, 0x8b, 0xfa, 0x8f, 0xac, 0xe4, 0x14, 0x4a,
+  0xe4, 0x2f, 0xe4, 0xfc, 0x60, 0x75, 0xe4, 0x7a, 0x4d, 0xb4, 0xe2, 0x6b,
+  0xc9, 0xc4, 0xa9, 0xbf, 0x56, 0x9f, 0x6a, 0xc6, 0x15, 0x7c, 0xbf, 0x8a,
+  0x4b, 0x4e, 0x7e, 0xc8, 0xca, 0x23, 0x30, 0xff, 0xd6, 0xd6, 0xd1, 0x85,
+  0xbc, 0x35, 0x19, 0x1a, 0xf3, 0xbd, 0x8b, 0x95, 0xe7, 0xa9, 0x79, 0x47,
+  0xe1, 0x62, 0x26, 0xbb, 0xd7, 0x8e, 0x4a, 0x95, 0xd5, 0xbd, 0xce, 0xaf,
+  0x05, 0xed, 0xf8, 0x8e, 0x55, 0x66, 0x54, 0xdc, 0xbb, 0x15, 0xc9, 0xc0,
+  0x38, 0x90, 0x34, 0xaf, 0xfe, 0x58, 0x6f, 0xd4, 0xf4, 0x68, 0x6e, 0xaf,
+  0x47, 0x73, 0xe7, 0xc0, 0x31, 0x9f, 0x69, 0xef, 0xf6, 0xfe, 0x93, 0xd7,
+  0x92, 0x26, 0x3e, 0x55, 0x85, 0xdf, 0x0e, 0x5b, 0x8c, 0x09, 0x0b, 0xf9,
+  0x4e, 0x37, 0x2c, 0x0d, 0x5a, 0xe5, 0x26, 0xbf, 0xb5, 0xd7, 0x77, 0x55,
+  0x74, 0x33, 0x52, 0x14, 0x2f, 0x9e, 0x7c, 0xa7, 0x83, 0x3d, 0xb0, 0xb7,
+  0xea, 0x25, 0x82, 0x6d, 0xff, 0x91, 0x40, 0x35, 0x37, 0x1f, 0xa9, 0x7e,
+  0xc3, 0x7a, 0xb9, 0x9c, 0x6b, 0x87, 0xd4, 0xa3, 0xdb, 0x24, 0xb5, 0xdf,
+  0xbf, 0xbc, 0xf6, 0xde, 0x26, 0x6e, 0x3d, 0xa8, 0x81, 0xee, 0xb5, 0x13,
+  0x53, 0x2e, 0x2e, 0xef, 0xe7, 0xf1, 0xf5, 0xca, 0xfc, 0x0b, 0x3d, 0xe6,
+  0x8c, 0x0b, 0x0c, 0x77, 0xd0, 0x01, 0x61, 0xf9, 0xb3, 0x68, 0xc9, 0x0e,
+  0x73, 0xfb, 0xbb, 0xa9, 0xdf, 0x05, 0xce, 0xfb, 0x43, 0x6b, 0xc0, 0xa6,
+  0x37, 0x1a, 0xdf, 0xa8, 0xee, 0xdd, 0x95, 0x3f, 0x99, 0x57, 0x5a, 0xf7,
+  0xac, 0x3f, 0x7a, 0xad, 0x54, 0x9d, 0x12, 0x88, 0xf9, 0x47, 0xbb, 0x02,
+  0x27, 0x85, 0x92, 0xf9, 0xe1, 0x40, 0x3d, 0x1f, 0x60, 0x5a, 0x75, 0xce,
+  0xf2, 0xaa, 0xa7, 0x0a, 0xcf, 0x47, 0x1e, 0x2f, 0x46, 0xb5, 0x6a, 0x1c,
+  0x8a, 0x6a, 0x99, 0x64, 0x71, 0xf7, 0x1f, 0x1f, 0xd7, 0x67, 0xb5, 0x8d,
+  0x7c, 0xb7, 0x31, 0x2b, 0xfd, 0xda, 0xd6, 0x61, 0xb8, 0xcd, 0xeb, 0xea,
+  0xc9, 0xb6, 0x51, 0xa1, 0xd7, 0xf9, 0xcf, 0xd2, 0xd7, 0xcf, 0x3a, 0x43,
+  0x05, 0xf8, 0x11, 0xa7, 0xfa, 0xf8, 0x34, 0xc7, 0xed, 0x7c, 0x6d, 0xe0,
+  0x21, 0x0e, 0xdc, 0xba, 0xce, 0xe1, 0x26, 0xd3, 0x27, 0x03, 0x63, 0xa5,
+  0xdb, 0x7c, 0x72, 0x7d, 0xf7, 0x0e, 0xf1, 0x99, 0xe0, 0xeb, 0x2b, 0xdf,
+  0xbd, 0xb5, 0x20, 0xf5, 0xcc, 0xd8, 0x43, 0x3d, 0xcd, 0xa0, 0x6b, 0x90,
+  0xd7, 0x61, 0x20, 0xec, 0x1a, 0x33, 0x0f, 0xca, 0x90, 0x1f, 0x0c, 0x90,
+  0xf8, 0x31, 0x65, 0xfb, 0xa2, 0x6a, 0x42, 0x72, 0xb9, 0x3a, 0x1d, 0xa0,
+  0x76, 0x03, 0x4d, 0xc0, 0xc0, 0xf5, 0x7d, 0x2f, 0xa1, 0x6f, 0x24, 0x0e,
+  0x14, 0x45, 0xe4, 0x06, 0xfd, 0x4b, 0xf0, 0x27, 0xf2, 0xeb, 0x38, 0xd0,
+  0x7a, 0xaf, 0xea, 0xed, 0x93, 0x21, 0x80, 0x7b, 0xd7, 0xb1, 0x87, 0x9e,
+  0x80, 0xbd, 0x7d, 0xe7, 0xdb, 0x68, 0x67, 0x22, 0xf5, 0xd2, 0x3a, 0x8d,
+  0x22, 0xf5, 0x5a, 0x3a, 0x4e, 0x56, 0x2a, 0x86, 0x95, 0x3e, 0xad, 0xc8,
+  0x57, 0x0c, 0xf8, 0x6b, 0x4d, 0x64, 0xf6, 0x25, 0xd5, 0xac, 0xff, 0x07,
+  0x39, 0x9d, 0xf4, 0x7a, 0x30, 0x1d, 0x00, 0x00
 };
 
-static const size_t WEBUI_INDEX_GZ_LEN = 15968;
+static const size_t WEBUI_APP_CSS_GZ_LEN = 2204;
+static const char WEBUI_APP_CSS_HASH[] = "65af537cc1001266";
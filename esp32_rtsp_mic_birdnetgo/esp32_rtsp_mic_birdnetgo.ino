@@ -14,6 +14,24 @@
 #include <esp_sleep.h>
 #include <esp_system.h>
 #include "WebUI.h"
+#include "LogJournal.h"
+#include "MqttTelemetry.h"
+#include "LoopProfiler.h"
+#include "LatencyStats.h"
+#include "JobScheduler.h"
+#include "HeapMonitor.h"
+#include "AudioArena.h"
+#include "StreamWatchdog.h"
+#include "PowerManager.h"
+#include "TaskStats.h"
+#include "PrefStore.h"
+#include "AudioBench.h"
+#include "FilterChain.h"
+#include "AutoGain.h"
+#include "MicCalibration.h"
+#include "MicHealth.h"
+#include "Recorder.h"
+#include "HttpAudio.h"
 
 // ================== SETTINGS (ESP32 RTSP Mic for BirdNET-Go) ==================
 #define FW_VERSION "1.7.0"
@@ -51,9 +69,17 @@ bool mdnsRunning = false;
 #define DEFAULT_WIFI_TX_DBM 19.5f  // Default WiFi TX power in dBm
 #define DEFAULT_MQTT_PORT 1883
 #define DEFAULT_MQTT_PUBLISH_INTERVAL_SEC 60
+#define DEFAULT_MQTT_FULL_EVERY 10          // delta mode: full state every N publishes
 // High-pass filter defaults (to remove low-frequency rumble)
 #define DEFAULT_HPF_ENABLED true
 #define DEFAULT_HPF_CUTOFF_HZ 500
+#define DEFAULT_AGC_ENABLED false
+#define DEFAULT_AGC_TARGET_DBFS -12.0f
+#define DEFAULT_AGC_MAX_GAIN 8.0f       // +18 dB: keeps night-time levels comparable for BirdNET
+#define DEFAULT_CAL_BOOT_MODE MICCAL_BOOT_PROPOSE
+#define DEFAULT_REC_ENABLED false
+#define DEFAULT_REC_DECIMATE 1
+#define DEFAULT_I2S_RIGHT_SLOT false     // L/R pin low: the mic answers on the left slot
 
 // Thermal protection defaults
 #define DEFAULT_OVERHEAT_PROTECTION true
@@ -82,12 +108,13 @@ unsigned long lastRTSPActivity = 0;
 // -- Buffers
 uint8_t rtspParseBuffer[1024];
 int rtspParseBufferPos = 0;
-//
+// I2S read / RTP payload views of the static audio arena (AudioArena.h), bound in setup()
 int32_t* i2s_32bit_buffer = nullptr;
 int16_t* i2s_16bit_buffer = nullptr;
 
 // -- Global state
 unsigned long audioPacketsSent = 0;
+uint32_t audioSamplesSent = 0;   // reset together with audioPacketsSent
 unsigned long lastStatsReset = 0;
 bool rtspServerEnabled = true;
 
@@ -96,6 +123,7 @@ uint32_t currentSampleRate = DEFAULT_SAMPLE_RATE;
 float currentGainFactor = DEFAULT_GAIN_FACTOR;
 uint16_t currentBufferSize = DEFAULT_BUFFER_SIZE;
 uint8_t i2sShiftBits = 12;  // (1) compile-time default respected on first boot
+bool i2sRightSlot = DEFAULT_I2S_RIGHT_SLOT;  // I2S slot the mic answers on (L/R pin)
 
 // -- Audio metering / clipping diagnostics
 uint16_t lastPeakAbs16 = 0;       // last block peak absolute value (0..32767)
@@ -104,31 +132,64 @@ bool audioClippedLastBlock = false; // clipping occurred in last processed block
 uint16_t peakHoldAbs16 = 0;       // peak hold (recent window)
 unsigned long peakHoldUntilMs = 0; // when to clear hold
 
-// -- High-pass filter (biquad) to cut low-frequency rumble
-struct Biquad {
-    float b0{1.0f}, b1{0.0f}, b2{0.0f}, a1{0.0f}, a2{0.0f};
-    float x1{0.0f}, x2{0.0f}, y1{0.0f}, y2{0.0f};
-    inline float process(float x) {
-        float y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
-        x2 = x1; x1 = x; y2 = y1; y1 = y;
-        return y;
-    }
-    inline void reset() { x1 = x2 = y1 = y2 = 0.0f; }
+// -- Measured pipeline latency per audio block (see audioLatencyRecordBlock)
+enum AudioLatencyStage : uint8_t {
+    LAT_QUEUE,   // block complete in the I2S DMA ring -> i2s_read() returned it
+    LAT_DSP,     // shift/HPF/gain/clip + byte swap
+    LAT_NET,     // RTP write until the socket accepted the last byte
+    LAT_TOTAL,   // block complete -> last byte accepted
+    LAT_STAGE_COUNT
 };
+LatencyHistogram audioLatency[LAT_STAGE_COUNT];
+uint32_t audioLatencyBlocks = 0;
+static const unsigned long AUDIO_LATENCY_WINDOW_MS = 30000UL;
+static const uint32_t AUDIO_READ_BLOCKED_US = 500;  // i2s_read() waited for DMA -> fresh block
+static uint64_t latSamplesCaptured = 0;
+static uint32_t latAnchorUs = 0;       // micros() at which sample #0 would have completed
+static bool latAnchorValid = false;
+static unsigned long latWindowStartMs = 0;
+static uint32_t rtpWriteStartUs = 0;   // set by sendRTPPacket()
+uint32_t audioLastQueueUs = 0;         // queue wait of the last recorded block
+
+// -- loop() housekeeping jobs (JobScheduler.h)
+static uint32_t loopJobClockUs() { return micros(); }
+JobScheduler loopJobs(loopJobClockUs);
+static const uint32_t LOOP_JOB_BUDGET_US = 2000;   // per loop() iteration, at least one job runs
+static int jobPerformanceId = -1;
+static uint32_t jobPerformanceIntervalMin = 0;
+
+// -- Capture filter chain (FilterChain.h): high-pass to cut low-frequency rumble + user sections
 bool highpassEnabled = DEFAULT_HPF_ENABLED;
 uint16_t highpassCutoffHz = DEFAULT_HPF_CUTOFF_HZ;
-Biquad hpf;
+FilterSpec filterSpecs[FILTER_CHAIN_MAX_SECTIONS];
+uint8_t filterSpecCount = 0;
+static bool filterOverBudgetLogged = false;
 uint32_t hpfConfigSampleRate = 0;
 uint16_t hpfConfigCutoff = 0;
 
+// -- Automatic gain control (AutoGain.h): replaces the fixed gain when enabled
+bool agcEnabled = DEFAULT_AGC_ENABLED;
+float agcTargetDbfs = DEFAULT_AGC_TARGET_DBFS;
+float agcMaxGain = DEFAULT_AGC_MAX_GAIN;
+
+// -- Level calibration (MicCalibration.h)
+uint8_t calBootMode = DEFAULT_CAL_BOOT_MODE;
+uint8_t calMarginDb = CAL_DEFAULT_MARGIN_DB;
+
+// -- Store-and-forward recorder (Recorder.h): records while no RTSP client streams
+bool recEnabled = DEFAULT_REC_ENABLED;
+uint16_t recSegmentSec = REC_DEFAULT_SEGMENT_S;
+uint32_t recQuotaKB = REC_DEFAULT_QUOTA_KB;
+uint16_t recKeepHours = 0;
+uint8_t recDecimate = DEFAULT_REC_DECIMATE;
+
+// -- HTTP live audio (HttpAudio.h): /audio.wav and /audio.pcm on the web UI port
+uint8_t httpAudioMaxClients = HTTP_AUDIO_DEFAULT_CLIENTS;
+
 // -- Preferences for persistent settings
 Preferences audioPrefs;
 
 // -- Diagnostics, auto-recovery and temperature monitoring
-unsigned long lastMemoryCheck = 0;
-unsigned long lastPerformanceCheck = 0;
-unsigned long lastWiFiCheck = 0;
-unsigned long lastTempCheck = 0;
 uint32_t minFreeHeap = 0xFFFFFFFF;
 uint32_t maxPacketRate = 0;
 uint32_t minPacketRate = 0xFFFFFFFF;
@@ -144,6 +205,7 @@ bool wifiReconnectHasBssid = false;
 uint8_t wifiReconnectBssid[6] = {0};
 unsigned long bootTime = 0;
 unsigned long lastI2SReset = 0;
+StreamWatchdog streamWatchdog;
 float maxTemperature = 0.0f;
 float lastTemperatureC = 0.0f;
 bool lastTemperatureValid = false;
@@ -161,11 +223,16 @@ bool overheatLatched = false;
 bool scheduledResetEnabled = false;
 uint32_t resetIntervalHours = 24; // Default 24 hours
 
+// -- Heap fragmentation alert (HeapMonitor.h)
+uint8_t heapFragAlertPct = 75;     // 0 = off
+bool heapFragAlertActive = false;
+uint32_t heapFragAlerts = 0;
+static const uint8_t HEAP_FRAG_ALERT_HYSTERESIS = 10;
+
 // -- Stream schedule (local clock, minutes from midnight)
 bool streamScheduleEnabled = false;
 uint16_t streamScheduleStartMin = 0; // 00:00
 uint16_t streamScheduleStopMin = 0;  // 00:00 (same as start = empty/blocked window)
-unsigned long lastStreamScheduleCheck = 0;
 bool lastScheduleAllow = true;
 bool lastScheduleTimeValid = false;
 unsigned long lastScheduleUnsyncedLog = 0;
@@ -192,17 +259,50 @@ RTC_DATA_ATTR uint16_t rtcSleepEnteredMin = 0;
 RTC_DATA_ATTR int32_t rtcSleepOffsetMin = 0;
 RTC_DATA_ATTR uint32_t rtcSleepCycleCount = 0;
 
+// Wi-Fi link cached across deep sleep for a direct reconnect on timer wake (no scan, and
+// no DHCP while the lease is young enough).
+static const uint32_t WIFI_RTC_CACHE_MAGIC = 0x57464331UL; // "WFC1"
+static const uint32_t WIFI_RTC_LEASE_MAX_AGE_SEC = 3600UL;            // reuse IP only within 1 h of DHCP
+static const unsigned long WIFI_FAST_RESUME_TIMEOUT_MS = 4000UL;       // then fall back to WiFiManager
+RTC_DATA_ATTR uint32_t rtcWifiMagic = 0;
+RTC_DATA_ATTR uint8_t rtcWifiBssid[6] = {0};
+RTC_DATA_ATTR uint8_t rtcWifiChannel = 0;
+RTC_DATA_ATTR uint32_t rtcWifiIp = 0;
+RTC_DATA_ATTR uint32_t rtcWifiGateway = 0;
+RTC_DATA_ATTR uint32_t rtcWifiSubnet = 0;
+RTC_DATA_ATTR uint32_t rtcWifiDns = 0;
+RTC_DATA_ATTR uint32_t rtcWifiLeaseAgeSec = 0;   // at deep sleep entry + planned sleep
+static uint32_t wifiLeaseBaseAgeSec = 0;        // lease age when this boot started using it
+static unsigned long wifiLeaseSinceMs = 0;
+
+// -- Boot timing (ms since reset) and deferred start of non-critical services
+bool bootFastResume = false;
+bool bootCachedLease = false;
+uint32_t bootWifiMs = 0;
+uint32_t bootI2sReadyMs = 0;
+uint32_t bootFirstPacketMs = 0;   // time to first RTP packet, 0 until then
+static const unsigned long DEFERRED_INIT_TIMEOUT_MS = 5000UL;   // after setup() if no client plays
+static bool deferredInitDone = false;
+static unsigned long setupDoneMs = 0;
+static bool otaStarted = false;
+
 // -- Configurable thresholds
 uint32_t minAcceptableRate = 50;        // Minimum acceptable packet rate (restart below this)
 uint32_t performanceCheckInterval = 15; // Check interval in minutes
 uint8_t cpuFrequencyMhz = 160;          // CPU frequency (default 160 MHz)
+uint8_t powerProfile = POWER_PERFORMANCE; // PowerManager profile (performance/balanced/saver)
 
 // Forward declaration (used by early wake-snapshot logger).
-void simplePrintln(String message);
+void simplePrintln(const String &message);
+void simplePrintf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
 void scheduleReboot(bool factoryReset, uint32_t delayMs);
 void scheduleWifiReconnect(const uint8_t *bssid, uint32_t delayMs);
 void mqttRequestReconnect(bool forceDiscovery);
 void mqttPublishDiscoverySoon();
+void flushSettingsNow();
+void prepareForReset();
+static void writeAudioSettings();
+static void calComplete();
 
 // -- WiFi TX power (configurable)
 float wifiTxPowerDbm = DEFAULT_WIFI_TX_DBM;
@@ -227,20 +327,142 @@ String mqttTopicPrefix = "";
 String mqttDiscoveryPrefix = "homeassistant";
 String mqttClientId = "";
 uint16_t mqttPublishIntervalSec = DEFAULT_MQTT_PUBLISH_INTERVAL_SEC;
-bool mqttConnected = false;
-String mqttLastError = "disabled";
+bool mqttDeltaEnabled = false;           // publish only changed state fields
+uint16_t mqttFullEvery = DEFAULT_MQTT_FULL_EVERY;
+bool mqttMsgpackEnabled = false;         // extra MessagePack copy on <topic>/state/msgpack
+bool mqttProfileEnabled = false;         // loop profiler window max as MQTT sensors
+bool mqttConnected = false;              // mirror of the MQTT task state (loop side)
+String mqttLastError = "disabled";       // mirror of the MQTT task state (loop side)
 String mqttDeviceId = "";
-WiFiClient mqttNetClient;
-PubSubClient mqttClient(mqttNetClient);
-unsigned long lastMqttReconnectAttempt = 0;
 unsigned long lastMqttPublishMs = 0;
-unsigned long lastMqttLogMs = 0;
-bool mqttDiscoveryPublished = false;
-bool mqttForceDiscovery = false;
 static const unsigned long MQTT_RECONNECT_INTERVAL_MS = 10000UL;
 static const uint16_t MQTT_SOCKET_TIMEOUT_SEC = 2;
 static const uint16_t MQTT_PUBLISH_INTERVAL_MIN_SEC = 10;
 static const uint16_t MQTT_PUBLISH_INTERVAL_MAX_SEC = 3600;
+static const uint16_t MQTT_FULL_EVERY_MIN = 1;
+static const uint16_t MQTT_FULL_EVERY_MAX = 100;
+
+// State payload fields (order = MQTT_STATE_FIELDS). loop() fills a fixed snapshot and
+// encodes it with MqttTelemetry.h; in delta mode only fields that changed since the last
+// queued payload are sent.
+enum MqttStateField : uint8_t {
+    MSF_FW_VERSION, MSF_FW_BUILD, MSF_REBOOT_REASON, MSF_RESTART_COUNTER, MSF_IP, MSF_WIFI_SSID,
+    MSF_WIFI_RSSI, MSF_WIFI_RECONNECT_COUNT, MSF_WIFI_TX_DBM, MSF_FREE_HEAP_KB, MSF_MIN_FREE_HEAP_KB,
+    MSF_UPTIME_S, MSF_RTSP_SERVER_ENABLED, MSF_STREAMING, MSF_STREAM_UPTIME_S, MSF_CLIENT_COUNT,
+    MSF_CURRENT_RATE, MSF_SAMPLE_RATE, MSF_AUDIO_FORMAT, MSF_BUFFER_SIZE, MSF_GAIN, MSF_CLIENT,
+    MSF_TEMPERATURE_C, MSF_TEMPERATURE_VALID, MSF_MAX_TEMPERATURE_C, MSF_OVERHEAT_LATCHED,
+    MSF_MDNS_ENABLED, MSF_TIME_SYNCED, MSF_MIC_HEALTH, MSF_MIC_FAULT,
+    MSF_LOOP_MAX_US, MSF_LOOP_WORST_SECTION, MSF_LOOP_WORST_US,   // only with mqttProfileEnabled
+    MSF_CPU_IDLE_PCT, MSF_CPU_LOOP_PCT, MSF_STACK_MIN_FREE,         // only with TASK_STATS_AVAILABLE
+    MQTT_STATE_FIELD_COUNT
+};
+static const TelemetryField MQTT_STATE_FIELDS[MQTT_STATE_FIELD_COUNT] = {
+    {"fw_version", TELEMETRY_STR},
+    {"fw_build", TELEMETRY_STR},
+    {"reboot_reason", TELEMETRY_STR},
+    {"restart_counter", TELEMETRY_UINT},
+    {"ip", TELEMETRY_STR},
+    {"wifi_ssid", TELEMETRY_STR},
+    {"wifi_rssi", TELEMETRY_INT},
+    {"wifi_reconnect_count", TELEMETRY_UINT},
+    {"wifi_tx_dbm", TELEMETRY_FIXED1},
+    {"free_heap_kb", TELEMETRY_UINT},
+    {"min_free_heap_kb", TELEMETRY_UINT},
+    {"uptime_s", TELEMETRY_UINT},
+    {"rtsp_server_enabled", TELEMETRY_BOOL},
+    {"streaming", TELEMETRY_BOOL},
+    {"stream_uptime_s", TELEMETRY_UINT},
+    {"client_count", TELEMETRY_UINT},
+    {"current_rate_pkt_s", TELEMETRY_UINT},
+    {"sample_rate", TELEMETRY_UINT},
+    {"audio_format", TELEMETRY_STR},
+    {"buffer_size", TELEMETRY_UINT},
+    {"gain", TELEMETRY_FIXED2},
+    {"client", TELEMETRY_STR},
+    {"temperature_c", TELEMETRY_FIXED1},
+    {"temperature_valid", TELEMETRY_BOOL},
+    {"max_temperature_c", TELEMETRY_FIXED1},
+    {"overheat_latched", TELEMETRY_BOOL},
+    {"mdns_enabled", TELEMETRY_BOOL},
+    {"time_synced", TELEMETRY_BOOL},
+    {"mic_health", TELEMETRY_STR},
+    {"mic_fault", TELEMETRY_BOOL},
+    {"loop_max_us", TELEMETRY_UINT},
+    {"loop_worst_section", TELEMETRY_STR},
+    {"loop_worst_us", TELEMETRY_UINT},
+    {"cpu_idle_pct", TELEMETRY_FIXED1},
+    {"cpu_loop_pct", TELEMETRY_FIXED1},
+    {"stack_min_free_b", TELEMETRY_UINT},
+};
+static_assert(MQTT_STATE_FIELD_COUNT <= TELEMETRY_MAX_FIELDS, "state fields must fit the delta mask");
+static const size_t MQTT_STATE_JSON_MAX = 1200;
+static const size_t MQTT_STATE_MSGPACK_MAX = 1024;
+static TelemetryValue mqttStateSnap[MQTT_STATE_FIELD_COUNT];      // loop-owned
+static TelemetryValue mqttStateLastSnap[MQTT_STATE_FIELD_COUNT];  // last queued values
+static bool mqttStateNeedFull = true;
+static uint16_t mqttPublishesSinceFull = 0;
+// Payload size accounting (per queued state payload)
+uint32_t mqttStatePublishCount = 0;
+uint32_t mqttStateFullCount = 0;
+uint32_t mqttStateJsonBytesLast = 0;
+uint64_t mqttStateJsonBytesTotal = 0;
+uint64_t mqttStateFullJsonBytesTotal = 0;   // what full JSON snapshots would have cost
+uint32_t mqttStateMsgpackBytesLast = 0;
+uint64_t mqttStateMsgpackBytesTotal = 0;
+
+// MQTT runs in its own task so a slow or unreachable broker (blocking connect, retained
+// discovery burst) never stalls loop()/streamAudio(). The task owns mqttClient; loop()
+// talks to it only through the mailbox below (guarded by mqttMailboxLock).
+struct MqttTaskConfig {
+    bool enabled = false;
+    String host;
+    uint16_t port = DEFAULT_MQTT_PORT;
+    String user;
+    String pass;
+    String clientId;
+    String topicPrefix;
+    String discoveryPrefix;
+    String deviceId;
+    bool profileSensors = false;
+};
+static const uint32_t MQTT_TASK_STACK = 6144;
+static const UBaseType_t MQTT_TASK_PRIO = 1;               // same as loopTask
+static const unsigned long MQTT_TASK_IDLE_MS = 50;
+static const unsigned long MQTT_DISCOVERY_PACE_MS = 40;    // gap between retained configs
+static const unsigned long MQTT_STALL_REPORT_US = 5000;
+WiFiClient mqttNetClient;
+PubSubClient mqttClient(mqttNetClient);
+static TaskHandle_t mqttTaskHandle = nullptr;
+static SemaphoreHandle_t mqttMailboxLock = nullptr;
+static MqttTaskConfig mqttCfgPending;      // loop -> task
+static bool mqttCfgDirty = false;
+static bool mqttReconnectReq = false;
+static bool mqttDiscoveryReq = false;
+static bool mqttOfflineReq = false;
+static char mqttStatePending[MQTT_STATE_JSON_MAX];          // latest state payload built by loop()
+static size_t mqttStatePendingLen = 0;
+static uint8_t mqttMsgpackPending[MQTT_STATE_MSGPACK_MAX];  // 0 length = none
+static size_t mqttMsgpackPendingLen = 0;
+static TelemetryMask mqttStatePendingMask = 0;  // fields in the not yet consumed payload
+static TelemetryMask mqttStateUnsentMask = 0;   // fields of a payload whose publish failed
+static bool mqttStateDirty = false;
+static char mqttTaskError[48] = "disabled"; // task -> loop
+static uint32_t mqttTaskErrorSeq = 0;
+static uint32_t mqttTaskErrorSeenSeq = 0;
+static volatile bool mqttTaskConnected = false;
+static volatile bool mqttTaskWantsState = false;   // fresh connection: publish state now
+static volatile bool mqttOfflineDone = false;
+static volatile uint8_t mqttCmdRtspPending = 0;    // 1 = ON, 2 = OFF (from broker)
+static volatile bool mqttCmdRebootPending = false;
+uint32_t mqttConnectAttempts = 0;
+uint32_t mqttLastConnectMs = 0;            // duration of the last connect() (in the task)
+// Time loop() spends in MQTT code (should stay in the tens of microseconds)
+uint32_t mqttLoopStallMaxUs = 0;
+uint64_t mqttLoopStallTotalUs = 0;
+uint32_t mqttLoopStallOverCount = 0;       // calls above MQTT_STALL_REPORT_US
+
+// Persistent log journal: max wait for buffered lines to reach flash before a reset/sleep
+static const uint32_t LOG_JOURNAL_RESET_FLUSH_MS = 500;
 
 // WiFi reconnect timing
 static const unsigned long WIFI_RECONNECT_SETTLE_MS = 100UL;
@@ -374,6 +596,23 @@ void applyWifiTxPower(bool log = true) {
     }
 }
 
+// Apply power profile and CPU clock (PowerManager)
+void applyPowerProfile() {
+    power_apply((PowerProfile)powerProfile, cpuFrequencyMhz);
+    const PowerStatus &p = powerStatus;
+    String msg = "Power profile: " + String(power_profileName(p.profile));
+    if (p.minMhz == p.maxMhz) {
+        msg += ", CPU " + String(p.maxMhz) + " MHz";
+    } else {
+        msg += ", CPU " + String(p.minMhz) + "-" + String(p.maxMhz) + " MHz (" +
+               (p.pmFramework ? "PM locks" : "software DFS") + ")";
+    }
+    if (p.modemSleep) msg += ", Wi-Fi modem sleep";
+    if (p.lightSleep) msg += ", light sleep";
+    else if (p.profile == POWER_SAVER) msg += ", light sleep unavailable";
+    simplePrintln(msg);
+}
+
 static String mqttJsonEscape(const String &s) {
     String o;
     o.reserve(s.length() + 8);
@@ -481,20 +720,24 @@ static String mqttDefaultClientId() {
     return String("esp32mic-") + mqttDeviceId;
 }
 
-static String mqttStateTopic() {
-    return mqttTopicPrefix + "/state";
+static String mqttStateTopic(const MqttTaskConfig &cfg) {
+    return cfg.topicPrefix + "/state";
+}
+
+static String mqttStateMsgpackTopic(const MqttTaskConfig &cfg) {
+    return cfg.topicPrefix + "/state/msgpack";
 }
 
-static String mqttAvailabilityTopic() {
-    return mqttTopicPrefix + "/availability";
+static String mqttAvailabilityTopic(const MqttTaskConfig &cfg) {
+    return cfg.topicPrefix + "/availability";
 }
 
-static String mqttCmdRtspTopic() {
-    return mqttTopicPrefix + "/cmd/rtsp_server";
+static String mqttCmdRtspTopic(const MqttTaskConfig &cfg) {
+    return cfg.topicPrefix + "/cmd/rtsp_server";
 }
 
-static String mqttCmdRebootTopic() {
-    return mqttTopicPrefix + "/cmd/reboot";
+static String mqttCmdRebootTopic(const MqttTaskConfig &cfg) {
+    return cfg.topicPrefix + "/cmd/reboot";
 }
 
 static void mqttNormalizeSettings() {
@@ -512,11 +755,13 @@ static void mqttNormalizeSettings() {
     mqttClientId = sanitizeMqttClientId(mqttClientId, mqttDefaultClientId());
     if (mqttPublishIntervalSec < MQTT_PUBLISH_INTERVAL_MIN_SEC) mqttPublishIntervalSec = MQTT_PUBLISH_INTERVAL_MIN_SEC;
     if (mqttPublishIntervalSec > MQTT_PUBLISH_INTERVAL_MAX_SEC) mqttPublishIntervalSec = MQTT_PUBLISH_INTERVAL_MAX_SEC;
+    if (mqttFullEvery < MQTT_FULL_EVERY_MIN) mqttFullEvery = MQTT_FULL_EVERY_MIN;
+    if (mqttFullEvery > MQTT_FULL_EVERY_MAX) mqttFullEvery = MQTT_FULL_EVERY_MAX;
 }
 
-static String mqttBuildDeviceJson() {
+static String mqttBuildDeviceJson(const MqttTaskConfig &cfg) {
     String json = "{";
-    json += "\"ids\":[\"" + mqttJsonEscape(mqttDeviceId) + "\"],";
+    json += "\"ids\":[\"" + mqttJsonEscape(cfg.deviceId) + "\"],";
     json += "\"name\":\"ESP32 RTSP Mic\",";
     json += "\"mdl\":\"XIAO ESP32-C6\",";
     json += "\"mf\":\"Sukecz\",";
@@ -526,7 +771,15 @@ static String mqttBuildDeviceJson() {
     return json;
 }
 
-static String mqttBuildStateJson() {
+static void mqttFormatIp(TelemetryValue &v, const IPAddress &ip) {
+    char tmp[16];
+    snprintf(tmp, sizeof(tmp), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+    telemetry_setStr(v, tmp);
+}
+
+// Reads the loop-owned globals into mqttStateSnap (no heap except the WiFi SSID getter).
+static void mqttFillStateSnapshot() {
+    TelemetryValue *v = mqttStateSnap;
     unsigned long nowMs = millis();
     unsigned long uptimeSeconds = (nowMs - bootTime) / 1000;
     unsigned long runtime = nowMs - lastStatsReset;
@@ -534,142 +787,235 @@ static String mqttBuildStateJson() {
     uint32_t streamUptimeSeconds = (isStreaming && streamStartedAtMs > 0 && nowMs >= streamStartedAtMs)
                                        ? (uint32_t)((nowMs - streamStartedAtMs) / 1000UL)
                                        : 0;
-    uint8_t clientCount = (rtspClient && rtspClient.connected()) ? 1 : 0;
-
-    String json = "{";
-    json += "\"fw_version\":\"" + mqttJsonEscape(String(FW_VERSION_STR)) + "\",";
-    json += "\"fw_build\":\"" + mqttJsonEscape(String(FW_BUILD_DATE_STR)) + "\",";
-    json += "\"reboot_reason\":\"" + mqttJsonEscape(rebootReason) + "\",";
-    json += "\"restart_counter\":" + String(restartCounter) + ",";
-    json += "\"ip\":\"" + mqttJsonEscape(WiFi.localIP().toString()) + "\",";
-    json += "\"wifi_ssid\":\"" + mqttJsonEscape(WiFi.SSID()) + "\",";
-    json += "\"wifi_rssi\":" + String(WiFi.RSSI()) + ",";
-    json += "\"wifi_reconnect_count\":" + String(wifiReconnectCount) + ",";
-    json += "\"wifi_tx_dbm\":" + String(wifiPowerLevelToDbm(currentWifiPowerLevel), 1) + ",";
-    json += "\"free_heap_kb\":" + String(ESP.getFreeHeap() / 1024) + ",";
-    json += "\"min_free_heap_kb\":" + String(minFreeHeap / 1024) + ",";
-    json += "\"uptime_s\":" + String(uptimeSeconds) + ",";
-    json += "\"rtsp_server_enabled\":" + String(rtspServerEnabled ? "true" : "false") + ",";
-    json += "\"streaming\":" + String(isStreaming ? "true" : "false") + ",";
-    json += "\"stream_uptime_s\":" + String(streamUptimeSeconds) + ",";
-    json += "\"client_count\":" + String((uint32_t)clientCount) + ",";
-    json += "\"current_rate_pkt_s\":" + String(currentRate) + ",";
-    json += "\"sample_rate\":" + String(currentSampleRate) + ",";
-    json += "\"audio_format\":\"L16/mono\",";
-    json += "\"buffer_size\":" + String(currentBufferSize) + ",";
-    json += "\"gain\":" + String(currentGainFactor, 2) + ",";
-    if (rtspClient && rtspClient.connected()) {
-        json += "\"client\":\"" + mqttJsonEscape(rtspClient.remoteIP().toString()) + "\",";
+    bool clientConnected = rtspClient && rtspClient.connected();
+
+    telemetry_setStr(v[MSF_FW_VERSION], FW_VERSION_STR);
+    telemetry_setStr(v[MSF_FW_BUILD], FW_BUILD_DATE_STR);
+    telemetry_setStr(v[MSF_REBOOT_REASON], rebootReason.c_str());
+    telemetry_setNum(v[MSF_RESTART_COUNTER], restartCounter);
+    mqttFormatIp(v[MSF_IP], WiFi.localIP());
+    telemetry_setStr(v[MSF_WIFI_SSID], WiFi.SSID().c_str());
+    telemetry_setNum(v[MSF_WIFI_RSSI], WiFi.RSSI());
+    telemetry_setNum(v[MSF_WIFI_RECONNECT_COUNT], wifiReconnectCount);
+    telemetry_setNum(v[MSF_WIFI_TX_DBM], telemetry_fixed(wifiPowerLevelToDbm(currentWifiPowerLevel), 10));
+    telemetry_setNum(v[MSF_FREE_HEAP_KB], ESP.getFreeHeap() / 1024);
+    telemetry_setNum(v[MSF_MIN_FREE_HEAP_KB], minFreeHeap / 1024);
+    telemetry_setNum(v[MSF_UPTIME_S], uptimeSeconds);
+    telemetry_setNum(v[MSF_RTSP_SERVER_ENABLED], rtspServerEnabled ? 1 : 0);
+    telemetry_setNum(v[MSF_STREAMING], isStreaming ? 1 : 0);
+    telemetry_setNum(v[MSF_STREAM_UPTIME_S], streamUptimeSeconds);
+    telemetry_setNum(v[MSF_CLIENT_COUNT], clientConnected ? 1 : 0);
+    telemetry_setNum(v[MSF_CURRENT_RATE], currentRate);
+    telemetry_setNum(v[MSF_SAMPLE_RATE], currentSampleRate);
+    telemetry_setStr(v[MSF_AUDIO_FORMAT], "L16/mono");
+    telemetry_setNum(v[MSF_BUFFER_SIZE], currentBufferSize);
+    telemetry_setNum(v[MSF_GAIN], telemetry_fixed(currentGainFactor, 100));
+    if (clientConnected) mqttFormatIp(v[MSF_CLIENT], rtspClient.remoteIP());
+    else telemetry_setStr(v[MSF_CLIENT], "");
+    if (lastTemperatureValid) telemetry_setNum(v[MSF_TEMPERATURE_C], telemetry_fixed(lastTemperatureC, 10));
+    else telemetry_setNull(v[MSF_TEMPERATURE_C]);
+    telemetry_setNum(v[MSF_TEMPERATURE_VALID], lastTemperatureValid ? 1 : 0);
+    telemetry_setNum(v[MSF_MAX_TEMPERATURE_C], telemetry_fixed(maxTemperature, 10));
+    telemetry_setNum(v[MSF_OVERHEAT_LATCHED], overheatLatched ? 1 : 0);
+    telemetry_setNum(v[MSF_MDNS_ENABLED], mdnsEnabled ? 1 : 0);
+    telemetry_setNum(v[MSF_TIME_SYNCED], timeSynced ? 1 : 0);
+    telemetry_setStr(v[MSF_MIC_HEALTH], michealth_summary(micHealth.flags));
+    telemetry_setNum(v[MSF_MIC_FAULT], (micHealth.flags & MH_DEAD_MASK) ? 1 : 0);
+    if (mqttProfileEnabled) {
+        // Worst loop()/subsystem time since the previous state payload
+        uint32_t loopMaxUs = 0, worstUs = 0;
+        uint8_t worst = PROF_SECTION_COUNT;
+        profiler_takeWindow(loopMaxUs, worst, worstUs);
+        telemetry_setNum(v[MSF_LOOP_MAX_US], loopMaxUs);
+        telemetry_setStr(v[MSF_LOOP_WORST_SECTION], profiler_sectionName(worst));
+        telemetry_setNum(v[MSF_LOOP_WORST_US], worstUs);
     } else {
-        json += "\"client\":\"\",";
-    }
-    if (lastTemperatureValid) json += "\"temperature_c\":" + String(lastTemperatureC, 1) + ",";
-    else json += "\"temperature_c\":null,";
-    json += "\"temperature_valid\":" + String(lastTemperatureValid ? "true" : "false") + ",";
-    json += "\"max_temperature_c\":" + String(maxTemperature, 1) + ",";
-    json += "\"overheat_latched\":" + String(overheatLatched ? "true" : "false") + ",";
-    json += "\"mdns_enabled\":" + String(mdnsEnabled ? "true" : "false") + ",";
-    json += "\"time_synced\":" + String(timeSynced ? "true" : "false");
-    json += "}";
-    return json;
-}
-
-static bool mqttPublishDiscoveryConfig(const String &component, const String &objectId, const String &payload) {
-    String topic = mqttDiscoveryPrefix + "/" + component + "/" + mqttDeviceId + "/" + objectId + "/config";
-    return mqttClient.publish(topic.c_str(), payload.c_str(), true);
-}
-
-static bool mqttPublishState(bool force) {
-    if (!mqttClient.connected()) return false;
-    unsigned long now = millis();
-    unsigned long intervalMs = (unsigned long)mqttPublishIntervalSec * 1000UL;
-    if (!force && (now - lastMqttPublishMs) < intervalMs) return true;
-    String topic = mqttStateTopic();
-    String payload = mqttBuildStateJson();
-    bool ok = mqttClient.publish(topic.c_str(), payload.c_str(), false);
-    if (ok) lastMqttPublishMs = now;
-    return ok;
+        telemetry_setNull(v[MSF_LOOP_MAX_US]);
+        telemetry_setNull(v[MSF_LOOP_WORST_SECTION]);
+        telemetry_setNull(v[MSF_LOOP_WORST_US]);
+    }
+    if (TASK_STATS_AVAILABLE && taskStats.count > 0) {
+        telemetry_setNum(v[MSF_CPU_IDLE_PCT], taskStats.idlePermille);
+        telemetry_setNum(v[MSF_CPU_LOOP_PCT], taskStats.loopPermille);
+        telemetry_setNum(v[MSF_STACK_MIN_FREE], taskStats.minStackFree);
+    } else {
+        telemetry_setNull(v[MSF_CPU_IDLE_PCT]);
+        telemetry_setNull(v[MSF_CPU_LOOP_PCT]);
+        telemetry_setNull(v[MSF_STACK_MIN_FREE]);
+    }
+}
+
+// Fields that belong in the state payload with the current settings.
+static TelemetryMask mqttStateFieldMask() {
+    TelemetryMask mask = telemetry_fullMask(MQTT_STATE_FIELD_COUNT);
+    if (!mqttProfileEnabled) {
+        mask &= ~(((TelemetryMask)1 << MSF_LOOP_MAX_US) | ((TelemetryMask)1 << MSF_LOOP_WORST_SECTION) |
+                  ((TelemetryMask)1 << MSF_LOOP_WORST_US));
+    }
+    if (!TASK_STATS_AVAILABLE) {
+        mask &= ~(((TelemetryMask)1 << MSF_CPU_IDLE_PCT) | ((TelemetryMask)1 << MSF_CPU_LOOP_PCT) |
+                  ((TelemetryMask)1 << MSF_STACK_MIN_FREE));
+    }
+    return mask;
+}
+
+// Discovery value templates tolerate delta payloads: a field missing from a message keeps
+// the entity's current state.
+static String mqttValueTpl(const char *key) {
+    String k = String("value_json.") + key;
+    return "{{ " + k + " if " + k + " is defined else this.state }}";
+}
+
+static String mqttOnOffTpl(const char *key) {
+    String k = String("value_json.") + key;
+    return "{{ ('ON' if " + k + " else 'OFF') if " + k + " is defined else (this.state | upper) }}";
+}
+
+static const uint8_t MQTT_DISCOVERY_COUNT = 27;
+
+// Builds Home Assistant discovery config #idx (0..MQTT_DISCOVERY_COUNT-1). The MQTT task
+// publishes one entity per iteration so the retained burst is spread out over time.
+static bool mqttBuildDiscoveryConfig(const MqttTaskConfig &cfg, uint8_t idx, String &component,
+                                     String &objectId, String &payload) {
+    const String dev = mqttBuildDeviceJson(cfg);
+    const String st = mqttStateTopic(cfg);
+    const String av = mqttAvailabilityTopic(cfg);
+    const String cmdRtsp = mqttCmdRtspTopic(cfg);
+    const String cmdReboot = mqttCmdRebootTopic(cfg);
+    switch (idx) {
+        case 0:
+            component = "sensor"; objectId = "wifi_rssi";
+            payload = "{\"name\":\"WiFi RSSI\",\"uniq_id\":\"" + cfg.deviceId + "_wifi_rssi\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("wifi_rssi") + "\",\"unit_of_meas\":\"dBm\",\"dev_cla\":\"signal_strength\",\"stat_cla\":\"measurement\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 1:
+            component = "sensor"; objectId = "heap_kb";
+            payload = "{\"name\":\"Free Heap\",\"uniq_id\":\"" + cfg.deviceId + "_heap_kb\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("free_heap_kb") + "\",\"unit_of_meas\":\"KB\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 2:
+            component = "sensor"; objectId = "packet_rate";
+            payload = "{\"name\":\"Packet Rate\",\"uniq_id\":\"" + cfg.deviceId + "_pkt_rate\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("current_rate_pkt_s") + "\",\"unit_of_meas\":\"pkt/s\",\"stat_cla\":\"measurement\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 3:
+            component = "sensor"; objectId = "temperature_c";
+            payload = "{\"name\":\"Temperature\",\"uniq_id\":\"" + cfg.deviceId + "_temp_c\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("temperature_c") + "\",\"unit_of_meas\":\"\u00B0C\",\"dev_cla\":\"temperature\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 4:
+            component = "sensor"; objectId = "max_temperature_c";
+            payload = "{\"name\":\"Peak Temperature\",\"uniq_id\":\"" + cfg.deviceId + "_max_temp_c\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("max_temperature_c") + "\",\"unit_of_meas\":\"\u00B0C\",\"dev_cla\":\"temperature\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:thermometer-high\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 5:
+            component = "sensor"; objectId = "uptime_s";
+            payload = "{\"name\":\"Uptime\",\"uniq_id\":\"" + cfg.deviceId + "_uptime_s\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("uptime_s") + "\",\"unit_of_meas\":\"s\",\"dev_cla\":\"duration\",\"stat_cla\":\"total_increasing\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 6:
+            component = "binary_sensor"; objectId = "streaming";
+            payload = "{\"name\":\"Streaming\",\"uniq_id\":\"" + cfg.deviceId + "_streaming\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttOnOffTpl("streaming") + "\",\"pl_on\":\"ON\",\"pl_off\":\"OFF\",\"dev_cla\":\"running\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 7:
+            component = "switch"; objectId = "rtsp_server";
+            payload = "{\"name\":\"RTSP Server\",\"uniq_id\":\"" + cfg.deviceId + "_rtsp_server\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttOnOffTpl("rtsp_server_enabled") + "\",\"pl_on\":\"ON\",\"pl_off\":\"OFF\",\"cmd_t\":\"" + cmdRtsp + "\",\"ic\":\"mdi:radio-tower\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 8:
+            component = "sensor"; objectId = "rtsp_client";
+            payload = "{\"name\":\"RTSP Client\",\"uniq_id\":\"" + cfg.deviceId + "_rtsp_client\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("client") + "\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 9:
+            component = "sensor"; objectId = "fw_version";
+            payload = "{\"name\":\"Firmware\",\"uniq_id\":\"" + cfg.deviceId + "_fw_version\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("fw_version") + "\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 10:
+            component = "sensor"; objectId = "fw_build";
+            payload = "{\"name\":\"Build Date\",\"uniq_id\":\"" + cfg.deviceId + "_fw_build\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("fw_build") + "\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 11:
+            component = "sensor"; objectId = "reboot_reason";
+            payload = "{\"name\":\"Reboot Reason\",\"uniq_id\":\"" + cfg.deviceId + "_reboot_reason\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("reboot_reason") + "\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 12:
+            component = "sensor"; objectId = "restart_counter";
+            payload = "{\"name\":\"Restart Counter\",\"uniq_id\":\"" + cfg.deviceId + "_restart_counter\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("restart_counter") + "\",\"stat_cla\":\"total_increasing\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 13:
+            component = "sensor"; objectId = "wifi_ssid";
+            payload = "{\"name\":\"WiFi SSID\",\"uniq_id\":\"" + cfg.deviceId + "_wifi_ssid\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("wifi_ssid") + "\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:wifi\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 14:
+            component = "sensor"; objectId = "wifi_reconnect_count";
+            payload = "{\"name\":\"WiFi Reconnects\",\"uniq_id\":\"" + cfg.deviceId + "_wifi_reconnect_count\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("wifi_reconnect_count") + "\",\"stat_cla\":\"total_increasing\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:wifi-refresh\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 15:
+            component = "sensor"; objectId = "stream_uptime_s";
+            payload = "{\"name\":\"Stream Uptime\",\"uniq_id\":\"" + cfg.deviceId + "_stream_uptime_s\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("stream_uptime_s") + "\",\"unit_of_meas\":\"s\",\"dev_cla\":\"duration\",\"stat_cla\":\"measurement\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 16:
+            component = "sensor"; objectId = "client_count";
+            payload = "{\"name\":\"RTSP Client Count\",\"uniq_id\":\"" + cfg.deviceId + "_client_count\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("client_count") + "\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:account-multiple\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 17:
+            component = "sensor"; objectId = "sample_rate_hz";
+            payload = "{\"name\":\"Sample Rate\",\"uniq_id\":\"" + cfg.deviceId + "_sample_rate_hz\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("sample_rate") + "\",\"unit_of_meas\":\"Hz\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 18:
+            component = "sensor"; objectId = "audio_format";
+            payload = "{\"name\":\"Audio Format\",\"uniq_id\":\"" + cfg.deviceId + "_audio_format\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("audio_format") + "\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 19:
+            component = "button"; objectId = "reboot";
+            payload = "{\"name\":\"Reboot Device\",\"uniq_id\":\"" + cfg.deviceId + "_reboot\",\"cmd_t\":\"" + cmdReboot + "\",\"pl_prs\":\"PRESS\",\"ent_cat\":\"config\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 20:
+            // Loop profiler sensors; an empty retained config removes them when disabled.
+            component = "sensor"; objectId = "loop_max_us";
+            payload = cfg.profileSensors ? "{\"name\":\"Loop Max Latency\",\"uniq_id\":\"" + cfg.deviceId + "_loop_max_us\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("loop_max_us") + "\",\"unit_of_meas\":\"\u00B5s\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:timer-alert-outline\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}" : String("");
+            return true;
+        case 21:
+            component = "sensor"; objectId = "loop_worst_section";
+            payload = cfg.profileSensors ? "{\"name\":\"Loop Worst Section\",\"uniq_id\":\"" + cfg.deviceId + "_loop_worst_section\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("loop_worst_section") + "\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:timer-sand\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}" : String("");
+            return true;
+        case 22:
+            // FreeRTOS run-time stats; empty (removed) when the core is built without them.
+            component = "sensor"; objectId = "cpu_idle_pct";
+            payload = TASK_STATS_AVAILABLE ? "{\"name\":\"CPU Idle\",\"uniq_id\":\"" + cfg.deviceId + "_cpu_idle_pct\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("cpu_idle_pct") + "\",\"unit_of_meas\":\"%\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:speedometer-slow\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}" : String("");
+            return true;
+        case 23:
+            component = "sensor"; objectId = "cpu_loop_pct";
+            payload = TASK_STATS_AVAILABLE ? "{\"name\":\"Loop Task CPU\",\"uniq_id\":\"" + cfg.deviceId + "_cpu_loop_pct\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("cpu_loop_pct") + "\",\"unit_of_meas\":\"%\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:cpu-32-bit\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}" : String("");
+            return true;
+        case 24:
+            component = "sensor"; objectId = "stack_min_free_b";
+            payload = TASK_STATS_AVAILABLE ? "{\"name\":\"Min Task Stack Free\",\"uniq_id\":\"" + cfg.deviceId + "_stack_min_free_b\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("stack_min_free_b") + "\",\"unit_of_meas\":\"B\",\"dev_cla\":\"data_size\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}" : String("");
+            return true;
+        case 25:
+            component = "binary_sensor"; objectId = "mic_fault";
+            payload = "{\"name\":\"Microphone Fault\",\"uniq_id\":\"" + cfg.deviceId + "_mic_fault\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttOnOffTpl("mic_fault") + "\",\"pl_on\":\"ON\",\"pl_off\":\"OFF\",\"dev_cla\":\"problem\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        case 26:
+            component = "sensor"; objectId = "mic_health";
+            payload = "{\"name\":\"Microphone Health\",\"uniq_id\":\"" + cfg.deviceId + "_mic_health\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"" + mqttValueTpl("mic_health") + "\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:microphone-message\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
+            return true;
+        default:
+            return false;
+    }
 }
 
-static bool mqttPublishDiscovery() {
-    if (!mqttClient.connected()) return false;
-
-    String dev = mqttBuildDeviceJson();
-    String st = mqttStateTopic();
-    String av = mqttAvailabilityTopic();
-    String cmdRtsp = mqttCmdRtspTopic();
-    String cmdReboot = mqttCmdRebootTopic();
-    bool ok = true;
-
-    String p;
-
-    p = "{\"name\":\"WiFi RSSI\",\"uniq_id\":\"" + mqttDeviceId + "_wifi_rssi\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.wifi_rssi }}\",\"unit_of_meas\":\"dBm\",\"dev_cla\":\"signal_strength\",\"stat_cla\":\"measurement\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "wifi_rssi", p);
-
-    p = "{\"name\":\"Free Heap\",\"uniq_id\":\"" + mqttDeviceId + "_heap_kb\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.free_heap_kb }}\",\"unit_of_meas\":\"KB\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "heap_kb", p);
-
-    p = "{\"name\":\"Packet Rate\",\"uniq_id\":\"" + mqttDeviceId + "_pkt_rate\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.current_rate_pkt_s }}\",\"unit_of_meas\":\"pkt/s\",\"stat_cla\":\"measurement\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "packet_rate", p);
-
-    p = "{\"name\":\"Temperature\",\"uniq_id\":\"" + mqttDeviceId + "_temp_c\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.temperature_c }}\",\"unit_of_meas\":\"\u00B0C\",\"dev_cla\":\"temperature\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "temperature_c", p);
-
-    p = "{\"name\":\"Peak Temperature\",\"uniq_id\":\"" + mqttDeviceId + "_max_temp_c\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.max_temperature_c }}\",\"unit_of_meas\":\"\u00B0C\",\"dev_cla\":\"temperature\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:thermometer-high\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "max_temperature_c", p);
-
-    p = "{\"name\":\"Uptime\",\"uniq_id\":\"" + mqttDeviceId + "_uptime_s\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.uptime_s }}\",\"unit_of_meas\":\"s\",\"dev_cla\":\"duration\",\"stat_cla\":\"total_increasing\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "uptime_s", p);
-
-    p = "{\"name\":\"Streaming\",\"uniq_id\":\"" + mqttDeviceId + "_streaming\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ 'ON' if value_json.streaming else 'OFF' }}\",\"pl_on\":\"ON\",\"pl_off\":\"OFF\",\"dev_cla\":\"running\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("binary_sensor", "streaming", p);
-
-    p = "{\"name\":\"RTSP Server\",\"uniq_id\":\"" + mqttDeviceId + "_rtsp_server\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ 'ON' if value_json.rtsp_server_enabled else 'OFF' }}\",\"pl_on\":\"ON\",\"pl_off\":\"OFF\",\"cmd_t\":\"" + cmdRtsp + "\",\"ic\":\"mdi:radio-tower\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("switch", "rtsp_server", p);
-
-    p = "{\"name\":\"RTSP Client\",\"uniq_id\":\"" + mqttDeviceId + "_rtsp_client\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.client }}\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "rtsp_client", p);
-
-    p = "{\"name\":\"Firmware\",\"uniq_id\":\"" + mqttDeviceId + "_fw_version\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.fw_version }}\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "fw_version", p);
-
-    p = "{\"name\":\"Build Date\",\"uniq_id\":\"" + mqttDeviceId + "_fw_build\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.fw_build }}\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "fw_build", p);
-
-    p = "{\"name\":\"Reboot Reason\",\"uniq_id\":\"" + mqttDeviceId + "_reboot_reason\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.reboot_reason }}\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "reboot_reason", p);
-
-    p = "{\"name\":\"Restart Counter\",\"uniq_id\":\"" + mqttDeviceId + "_restart_counter\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.restart_counter }}\",\"stat_cla\":\"total_increasing\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "restart_counter", p);
-
-    p = "{\"name\":\"WiFi SSID\",\"uniq_id\":\"" + mqttDeviceId + "_wifi_ssid\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.wifi_ssid }}\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:wifi\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "wifi_ssid", p);
-
-    p = "{\"name\":\"WiFi Reconnects\",\"uniq_id\":\"" + mqttDeviceId + "_wifi_reconnect_count\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.wifi_reconnect_count }}\",\"stat_cla\":\"total_increasing\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:wifi-refresh\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "wifi_reconnect_count", p);
-
-    p = "{\"name\":\"Stream Uptime\",\"uniq_id\":\"" + mqttDeviceId + "_stream_uptime_s\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.stream_uptime_s }}\",\"unit_of_meas\":\"s\",\"dev_cla\":\"duration\",\"stat_cla\":\"measurement\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "stream_uptime_s", p);
-
-    p = "{\"name\":\"RTSP Client Count\",\"uniq_id\":\"" + mqttDeviceId + "_client_count\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.client_count }}\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"ic\":\"mdi:account-multiple\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "client_count", p);
-
-    p = "{\"name\":\"Sample Rate\",\"uniq_id\":\"" + mqttDeviceId + "_sample_rate_hz\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.sample_rate }}\",\"unit_of_meas\":\"Hz\",\"stat_cla\":\"measurement\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "sample_rate_hz", p);
+// ---- MQTT task side (owns mqttClient) ----
 
-    p = "{\"name\":\"Audio Format\",\"uniq_id\":\"" + mqttDeviceId + "_audio_format\",\"stat_t\":\"" + st + "\",\"val_tpl\":\"{{ value_json.audio_format }}\",\"ent_cat\":\"diagnostic\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("sensor", "audio_format", p);
+static MqttTaskConfig mqttCfg;   // task-owned copy of the settings
+static char mqttTaskState[MQTT_STATE_JSON_MAX];
+static size_t mqttTaskStateLen = 0;
+static uint8_t mqttTaskMsgpack[MQTT_STATE_MSGPACK_MAX];
+static size_t mqttTaskMsgpackLen = 0;
 
-    p = "{\"name\":\"Reboot Device\",\"uniq_id\":\"" + mqttDeviceId + "_reboot\",\"cmd_t\":\"" + cmdReboot + "\",\"pl_prs\":\"PRESS\",\"ent_cat\":\"config\",\"avty_t\":\"" + av + "\",\"pl_avail\":\"online\",\"pl_not_avail\":\"offline\",\"dev\":" + dev + "}";
-    ok &= mqttPublishDiscoveryConfig("button", "reboot", p);
-
-    if (ok) {
-        mqttDiscoveryPublished = true;
-        mqttForceDiscovery = false;
+static void mqttTaskSetError(const char *err) {
+    xSemaphoreTake(mqttMailboxLock, portMAX_DELAY);
+    if (strcmp(mqttTaskError, err) != 0) {
+        strlcpy(mqttTaskError, err, sizeof(mqttTaskError));
+        mqttTaskErrorSeq++;
     }
-    return ok;
+    xSemaphoreGive(mqttMailboxLock);
 }
 
+// Runs in the MQTT task: commands are only recorded here and executed by loop().
 static void mqttMessageCallback(char* topic, byte* payload, unsigned int length) {
     String t = topic ? String(topic) : String("");
     String msg;
@@ -679,43 +1025,221 @@ static void mqttMessageCallback(char* topic, byte* payload, unsigned int length)
     String up = msg;
     up.toUpperCase();
 
-    if (t == mqttCmdRtspTopic()) {
-        if (up == "ON") {
-            if (overheatLatched) {
-                simplePrintln("MQTT command ignored: RTSP ON blocked by thermal latch.");
-            } else if (!rtspServerEnabled) {
-                rtspServer.begin();
-                rtspServer.setNoDelay(true);
-                rtspServerEnabled = true;
-                simplePrintln("MQTT command: RTSP server enabled.");
-            }
-        } else if (up == "OFF") {
-            rtspServerEnabled = false;
-            if (rtspClient && rtspClient.connected()) rtspClient.stop();
-            isStreaming = false;
-            rtspServer.stop();
-            simplePrintln("MQTT command: RTSP server disabled.");
-        }
-        mqttPublishState(true);
+    if (t == mqttCmdRtspTopic(mqttCfg)) {
+        if (up == "ON") mqttCmdRtspPending = 1;
+        else if (up == "OFF") mqttCmdRtspPending = 2;
         return;
     }
 
-    if (t == mqttCmdRebootTopic()) {
-        if (up == "PRESS" || up == "REBOOT") {
-            simplePrintln("MQTT command: reboot requested.");
-            scheduleReboot(false, 600);
-        }
+    if (t == mqttCmdRebootTopic(mqttCfg)) {
+        if (up == "PRESS" || up == "REBOOT") mqttCmdRebootPending = true;
         return;
     }
 }
 
-static void mqttApplyClientSettings(bool logResult) {
-    mqttNormalizeSettings();
-    mqttClient.setServer(mqttHost.c_str(), mqttPort);
+static bool mqttTaskPublishState() {
+    bool ok = mqttClient.publish(mqttStateTopic(mqttCfg).c_str(), (const uint8_t*)mqttTaskState,
+                                 (unsigned int)mqttTaskStateLen, false);
+    if (mqttTaskMsgpackLen > 0) {
+        ok = mqttClient.publish(mqttStateMsgpackTopic(mqttCfg).c_str(), mqttTaskMsgpack,
+                                (unsigned int)mqttTaskMsgpackLen, false) && ok;
+    }
+    return ok;
+}
+
+static void mqttTaskDisconnect(bool announceOffline) {
+    if (mqttClient.connected()) {
+        if (announceOffline) {
+            mqttClient.publish(mqttAvailabilityTopic(mqttCfg).c_str(), "offline", true);
+        }
+        mqttClient.disconnect();
+    }
+    mqttTaskConnected = false;
+}
+
+static bool mqttTaskConnect() {
+    mqttClient.setServer(mqttCfg.host.c_str(), mqttCfg.port);
     mqttClient.setCallback(mqttMessageCallback);
     mqttClient.setKeepAlive(30);
     mqttClient.setSocketTimeout(MQTT_SOCKET_TIMEOUT_SEC);
     mqttClient.setBufferSize(1536);
+
+    String availTopic = mqttAvailabilityTopic(mqttCfg);
+    unsigned long t0 = millis();
+    bool ok = false;
+    mqttConnectAttempts++;
+    if (mqttCfg.user.length()) {
+        ok = mqttClient.connect(mqttCfg.clientId.c_str(), mqttCfg.user.c_str(), mqttCfg.pass.c_str(),
+                                availTopic.c_str(), 0, true, "offline");
+    } else {
+        ok = mqttClient.connect(mqttCfg.clientId.c_str(), availTopic.c_str(), 0, true, "offline");
+    }
+    mqttLastConnectMs = millis() - t0;
+    if (!ok) {
+        char err[32];
+        snprintf(err, sizeof(err), "connect_failed_%d", mqttClient.state());
+        mqttTaskSetError(err);
+        return false;
+    }
+    mqttClient.publish(availTopic.c_str(), "online", true);
+    mqttClient.subscribe(mqttCmdRtspTopic(mqttCfg).c_str());
+    mqttClient.subscribe(mqttCmdRebootTopic(mqttCfg).c_str());
+    mqttTaskSetError("ok");
+    mqttTaskConnected = true;
+    simplePrintln("MQTT connected to " + mqttCfg.host + ":" + String(mqttCfg.port));
+    return true;
+}
+
+static void mqttTask(void *) {
+    heapmon_tagCurrentTask(HEAP_SYS_MQTT);
+    unsigned long lastAttemptMs = 0;
+    bool attemptNow = true;
+    bool suspended = false;           // after the offline hand-off before deep sleep
+    unsigned long lastFailLogMs = 0;
+    bool failLogged = false;
+    uint8_t discoveryIdx = MQTT_DISCOVERY_COUNT;  // == COUNT: nothing pending
+
+    for (;;) {
+        bool reconnect = false, discovery = false, offline = false, haveState = false;
+        TelemetryMask stateMask = 0;
+        xSemaphoreTake(mqttMailboxLock, portMAX_DELAY);
+        if (mqttCfgDirty) {
+            mqttCfg = mqttCfgPending;
+            mqttCfgDirty = false;
+        }
+        reconnect = mqttReconnectReq;
+        discovery = mqttDiscoveryReq;
+        offline = mqttOfflineReq;
+        mqttReconnectReq = mqttDiscoveryReq = mqttOfflineReq = false;
+        if (mqttStateDirty) {
+            memcpy(mqttTaskState, mqttStatePending, mqttStatePendingLen);
+            mqttTaskStateLen = mqttStatePendingLen;
+            memcpy(mqttTaskMsgpack, mqttMsgpackPending, mqttMsgpackPendingLen);
+            mqttTaskMsgpackLen = mqttMsgpackPendingLen;
+            stateMask = mqttStatePendingMask;
+            mqttStateDirty = false;
+            mqttStatePendingMask = 0;
+            haveState = true;
+        }
+        xSemaphoreGive(mqttMailboxLock);
+
+        if (reconnect) {
+            mqttTaskDisconnect(true);
+            attemptNow = true;
+            suspended = false;
+        }
+        if (offline) {
+            if (mqttClient.connected()) {
+                if (haveState) mqttTaskPublishState();
+                mqttClient.publish(mqttAvailabilityTopic(mqttCfg).c_str(), "offline", true);
+                mqttClient.loop();
+                mqttClient.disconnect();
+            }
+            mqttTaskConnected = false;
+            suspended = true;
+            haveState = false;
+            mqttOfflineDone = true;
+        }
+
+        if (suspended) {
+            // Deep sleep is imminent; stay quiet until a reconnect is requested.
+        } else if (!mqttCfg.enabled) {
+            mqttTaskDisconnect(true);
+            mqttTaskSetError("disabled");
+        } else if (mqttCfg.host.length() == 0) {
+            mqttTaskDisconnect(false);
+            mqttTaskSetError("missing_host");
+        } else if (WiFi.status() != WL_CONNECTED) {
+            mqttTaskDisconnect(false);
+            mqttTaskSetError("wifi_disconnected");
+        } else if (!mqttClient.connected()) {
+            mqttTaskConnected = false;
+            unsigned long now = millis();
+            if (attemptNow || (now - lastAttemptMs) >= MQTT_RECONNECT_INTERVAL_MS) {
+                attemptNow = false;
+                lastAttemptMs = now;
+                if (mqttTaskConnect()) {
+                    discoveryIdx = 0;
+                    mqttTaskWantsState = true;
+                    failLogged = false;
+                } else if (!failLogged || (now - lastFailLogMs) > 60000UL) {
+                    simplePrintln("MQTT connect failed: " + String(mqttTaskError));
+                    lastFailLogMs = now;
+                    failLogged = true;
+                }
+            }
+        } else {
+            mqttTaskConnected = true;
+            mqttClient.loop();
+            if (discovery) discoveryIdx = 0;
+            if (discoveryIdx < MQTT_DISCOVERY_COUNT) {
+                String component, objectId, payload;
+                if (mqttBuildDiscoveryConfig(mqttCfg, discoveryIdx, component, objectId, payload)) {
+                    String topic = mqttCfg.discoveryPrefix + "/" + component + "/" + mqttCfg.deviceId + "/" +
+                                   objectId + "/config";
+                    if (!mqttClient.publish(topic.c_str(), payload.c_str(), true)) {
+                        mqttTaskSetError("discovery_publish_failed");
+                    }
+                }
+                discoveryIdx++;
+            }
+            if (haveState) {
+                if (mqttTaskPublishState()) {
+                    mqttTaskSetError("ok");
+                } else {
+                    // loop() has already moved its delta baseline past these values; hand the
+                    // fields back so its next payload carries them again.
+                    xSemaphoreTake(mqttMailboxLock, portMAX_DELAY);
+                    mqttStateUnsentMask |= stateMask;
+                    xSemaphoreGive(mqttMailboxLock);
+                    mqttTaskSetError("state_publish_failed");
+                }
+            }
+        }
+
+        unsigned long waitMs = (discoveryIdx < MQTT_DISCOVERY_COUNT) ? MQTT_DISCOVERY_PACE_MS : MQTT_TASK_IDLE_MS;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+    }
+}
+
+// ---- loop() side ----
+
+static void mqttAccountStall(unsigned long startUs) {
+    uint32_t us = (uint32_t)(micros() - startUs);
+    mqttLoopStallTotalUs += us;
+    if (us > mqttLoopStallMaxUs) mqttLoopStallMaxUs = us;
+    if (us > MQTT_STALL_REPORT_US) mqttLoopStallOverCount++;
+}
+
+static void mqttNotifyTask() {
+    if (mqttTaskHandle) xTaskNotifyGive(mqttTaskHandle);
+}
+
+// Hands the current (normalized) settings to the MQTT task.
+static void mqttPushConfig(bool reconnect) {
+    if (!mqttMailboxLock) {
+        mqttMailboxLock = xSemaphoreCreateMutex();
+    }
+    xSemaphoreTake(mqttMailboxLock, portMAX_DELAY);
+    mqttCfgPending.enabled = mqttEnabled;
+    mqttCfgPending.host = mqttHost;
+    mqttCfgPending.port = mqttPort;
+    mqttCfgPending.user = mqttUser;
+    mqttCfgPending.pass = mqttPassword;
+    mqttCfgPending.clientId = mqttClientId;
+    mqttCfgPending.topicPrefix = mqttTopicPrefix;
+    mqttCfgPending.discoveryPrefix = mqttDiscoveryPrefix;
+    mqttCfgPending.deviceId = mqttDeviceId;
+    mqttCfgPending.profileSensors = mqttProfileEnabled;
+    mqttCfgDirty = true;
+    if (reconnect) mqttReconnectReq = true;
+    xSemaphoreGive(mqttMailboxLock);
+    mqttNotifyTask();
+}
+
+static void mqttApplyClientSettings(bool logResult) {
+    mqttNormalizeSettings();
+    mqttPushConfig(false);
     if (logResult) {
         simplePrintln("MQTT config: " + String(mqttEnabled ? "enabled" : "disabled") +
                       ", host=" + (mqttHost.length() ? mqttHost : String("(empty)")) +
@@ -726,167 +1250,221 @@ static void mqttApplyClientSettings(bool logResult) {
     }
 }
 
-static bool mqttConnectNow() {
-    mqttApplyClientSettings(false);
-    if (!mqttEnabled) {
-        mqttConnected = false;
-        mqttLastError = "disabled";
-        return false;
-    }
-    if (mqttHost.length() == 0) {
-        mqttConnected = false;
-        mqttLastError = "missing_host";
-        return false;
+static void mqttStartTask() {
+    if (mqttTaskHandle) return;
+    mqttPushConfig(false);
+    if (xTaskCreate(mqttTask, "mqtt", MQTT_TASK_STACK, nullptr, MQTT_TASK_PRIO, &mqttTaskHandle) != pdPASS) {
+        mqttTaskHandle = nullptr;
+        simplePrintln("MQTT: failed to start task");
     }
+}
 
-    String availTopic = mqttAvailabilityTopic();
-    bool ok = false;
-    if (mqttUser.length()) {
-        ok = mqttClient.connect(mqttClientId.c_str(), mqttUser.c_str(), mqttPassword.c_str(), availTopic.c_str(), 0, true, "offline");
-    } else {
-        ok = mqttClient.connect(mqttClientId.c_str(), availTopic.c_str(), 0, true, "offline");
+// Builds the state payload in loop() (it reads loop-owned globals) and queues it for the task.
+// Delta mode sends only fields that changed since the last queued payload, plus a full
+// snapshot after every reconnect and every mqttFullEvery publishes.
+static bool mqttQueueState(bool force) {
+    if (!mqttTaskConnected || !mqttMailboxLock) return false;
+    unsigned long now = millis();
+    unsigned long intervalMs = (unsigned long)mqttPublishIntervalSec * 1000UL;
+    if (!force && (now - lastMqttPublishMs) < intervalMs) return true;
+
+    mqttFillStateSnapshot();
+    const TelemetryMask all = mqttStateFieldMask();
+    bool full = !mqttDeltaEnabled || mqttStateNeedFull || mqttPublishesSinceFull + 1 >= mqttFullEvery;
+    TelemetryMask mask = full ? all : (telemetry_diff(mqttStateLastSnap, mqttStateSnap, MQTT_STATE_FIELD_COUNT) & all);
+
+    xSemaphoreTake(mqttMailboxLock, portMAX_DELAY);
+    // A payload the task has not picked up yet is replaced, so carry its fields over.
+    if (mqttStateDirty) mask |= mqttStatePendingMask & all;
+    // Fields of a payload the task failed to publish.
+    mask |= mqttStateUnsentMask & all;
+    TelemetryWriter jw = {(uint8_t*)mqttStatePending, sizeof(mqttStatePending), 0};
+    telemetry_encodeJson(MQTT_STATE_FIELDS, mqttStateSnap, MQTT_STATE_FIELD_COUNT, mask, jw);
+    TelemetryWriter mw = {mqttMsgpackPending, sizeof(mqttMsgpackPending), 0};
+    if (mqttMsgpackEnabled) telemetry_encodeMsgpack(MQTT_STATE_FIELDS, mqttStateSnap, MQTT_STATE_FIELD_COUNT, mask, mw);
+    bool ok = jw.ok() && mw.ok();
+    if (ok) {
+        mqttStatePendingLen = jw.len;
+        mqttMsgpackPendingLen = mw.len;
+        mqttStatePendingMask = mask;
+        mqttStateUnsentMask = 0;
+        mqttStateDirty = true;
     }
+    xSemaphoreGive(mqttMailboxLock);
     if (!ok) {
-        mqttConnected = false;
-        mqttLastError = String("connect_failed_") + String(mqttClient.state());
+        mqttLastError = "state_too_large";
         return false;
     }
+    mqttNotifyTask();
 
-    mqttConnected = true;
-    mqttLastError = "ok";
-    mqttClient.publish(availTopic.c_str(), "online", true);
-    mqttClient.subscribe(mqttCmdRtspTopic().c_str());
-    mqttClient.subscribe(mqttCmdRebootTopic().c_str());
-    mqttDiscoveryPublished = false;
-    if (!mqttPublishDiscovery()) {
-        mqttLastError = "discovery_publish_failed";
-    }
-    mqttPublishState(true);
-    simplePrintln("MQTT connected to " + mqttHost + ":" + String(mqttPort));
+    memcpy(mqttStateLastSnap, mqttStateSnap, sizeof(mqttStateLastSnap));
+    if (mask == all) {
+        mqttStateNeedFull = false;
+        mqttPublishesSinceFull = 0;
+        mqttStateFullCount++;
+    } else {
+        mqttPublishesSinceFull++;
+    }
+    TelemetryWriter fullSize = {nullptr, 0, 0};
+    telemetry_encodeJson(MQTT_STATE_FIELDS, mqttStateSnap, MQTT_STATE_FIELD_COUNT, all, fullSize);
+    mqttStatePublishCount++;
+    mqttStateJsonBytesLast = (uint32_t)jw.len;
+    mqttStateJsonBytesTotal += jw.len;
+    mqttStateFullJsonBytesTotal += fullSize.len;
+    mqttStateMsgpackBytesLast = (uint32_t)mw.len;
+    mqttStateMsgpackBytesTotal += mw.len;
+    lastMqttPublishMs = now;
     return true;
 }
 
+static bool mqttPublishState(bool force) {
+    unsigned long t0 = micros();
+    bool ok = mqttQueueState(force);
+    mqttAccountStall(t0);
+    return ok;
+}
+
 void mqttRequestReconnect(bool forceDiscovery) {
-    if (forceDiscovery) mqttForceDiscovery = true;
-    mqttDiscoveryPublished = false;
-    lastMqttReconnectAttempt = 0;
+    (void)forceDiscovery;  // discovery is always republished after a (re)connect
     lastMqttPublishMs = 0;
-    if (mqttClient.connected()) {
-        String availTopic = mqttAvailabilityTopic();
-        mqttClient.publish(availTopic.c_str(), "offline", true);
-        mqttClient.disconnect();
-    }
+    mqttStateNeedFull = true;
     mqttConnected = false;
+    mqttPushConfig(true);
 }
 
-void mqttPublishDiscoverySoon() {
-    mqttForceDiscovery = true;
-    if (mqttClient.connected()) {
-        if (!mqttPublishDiscovery()) mqttLastError = "discovery_publish_failed";
-    } else {
-        mqttRequestReconnect(true);
-    }
+// Next state payload is a full snapshot, published on the next checkMqtt().
+void mqttRequestFullState() {
+    mqttStateNeedFull = true;
+    lastMqttPublishMs = 0;
 }
 
-void checkMqtt() {
-    if (!mqttEnabled) {
-        if (mqttClient.connected()) {
-            String availTopic = mqttAvailabilityTopic();
-            mqttClient.publish(availTopic.c_str(), "offline", true);
-            mqttClient.disconnect();
+void mqttPublishDiscoverySoon() {
+    if (!mqttMailboxLock) return;
+    xSemaphoreTake(mqttMailboxLock, portMAX_DELAY);
+    if (mqttTaskConnected) mqttDiscoveryReq = true;
+    else mqttReconnectReq = true;
+    xSemaphoreGive(mqttMailboxLock);
+    mqttNotifyTask();
+}
+
+// Entity set changed (profiler sensors): hand over the config, then re-announce and send a
+// full state so the new fields appear without a reconnect.
+void mqttRefreshDiscovery() {
+    mqttPushConfig(false);
+    mqttRequestFullState();
+    mqttPublishDiscoverySoon();
+}
+
+// Final state + "offline" before deep sleep; waits for the task to hand it to the broker.
+static void mqttGoOffline(uint32_t timeoutMs) {
+    if (!mqttTaskConnected || !mqttMailboxLock) return;
+    mqttQueueState(true);
+    mqttOfflineDone = false;
+    xSemaphoreTake(mqttMailboxLock, portMAX_DELAY);
+    mqttOfflineReq = true;
+    xSemaphoreGive(mqttMailboxLock);
+    mqttNotifyTask();
+    unsigned long start = millis();
+    while (!mqttOfflineDone && (millis() - start) < timeoutMs) {
+        delay(10);
+    }
+}
+
+static void mqttApplyRemoteCommands() {
+    uint8_t rtspCmd = mqttCmdRtspPending;
+    if (rtspCmd) {
+        mqttCmdRtspPending = 0;
+        if (rtspCmd == 1) {
+            if (overheatLatched) {
+                simplePrintln("MQTT command ignored: RTSP ON blocked by thermal latch.");
+            } else if (!rtspServerEnabled) {
+                rtspServer.begin();
+                rtspServer.setNoDelay(true);
+                rtspServerEnabled = true;
+                simplePrintln("MQTT command: RTSP server enabled.");
+            }
+        } else {
+            rtspServerEnabled = false;
+            if (rtspClient && rtspClient.connected()) rtspClient.stop();
+            isStreaming = false;
+            rtspServer.stop();
+            simplePrintln("MQTT command: RTSP server disabled.");
         }
-        mqttConnected = false;
-        mqttLastError = "disabled";
-        return;
+        mqttQueueState(true);
     }
-
-    if (WiFi.status() != WL_CONNECTED) {
-        if (mqttClient.connected()) mqttClient.disconnect();
-        mqttConnected = false;
-        mqttLastError = "wifi_disconnected";
-        return;
+    if (mqttCmdRebootPending) {
+        mqttCmdRebootPending = false;
+        simplePrintln("MQTT command: reboot requested.");
+        scheduleReboot(false, 600);
     }
+}
 
-    if (!mqttClient.connected()) {
-        if (isStreaming) {
-            mqttConnected = false;
-            mqttLastError = "reconnect_deferred_streaming";
-            return;
-        }
-        unsigned long now = millis();
-        if ((now - lastMqttReconnectAttempt) < MQTT_RECONNECT_INTERVAL_MS) return;
-        lastMqttReconnectAttempt = now;
-        bool ok = mqttConnectNow();
-        if (!ok && (now - lastMqttLogMs) > 60000UL) {
-            simplePrintln("MQTT connect failed: " + mqttLastError);
-            lastMqttLogMs = now;
+void checkMqtt() {
+    if (!mqttMailboxLock) return;
+    unsigned long t0 = micros();
+    mqttConnected = mqttTaskConnected;
+    xSemaphoreTake(mqttMailboxLock, portMAX_DELAY);
+    if (mqttTaskErrorSeq != mqttTaskErrorSeenSeq) {
+        mqttLastError = mqttTaskError;
+        mqttTaskErrorSeenSeq = mqttTaskErrorSeq;
+    }
+    xSemaphoreGive(mqttMailboxLock);
+    mqttApplyRemoteCommands();
+    if (mqttConnected) {
+        if (mqttTaskWantsState) {
+            mqttTaskWantsState = false;
+            mqttStateNeedFull = true;
+            mqttQueueState(true);
+        } else {
+            mqttQueueState(false);
         }
-        return;
-    }
-
-    mqttConnected = true;
-    mqttClient.loop();
-    if (mqttForceDiscovery || !mqttDiscoveryPublished) {
-        if (!mqttPublishDiscovery()) mqttLastError = "discovery_publish_failed";
-    }
-    if (!mqttPublishState(false)) {
-        mqttLastError = "state_publish_failed";
     }
+    mqttAccountStall(t0);
 }
 
-// Recompute HPF coefficients (2nd-order Butterworth high-pass)
+// Rebuild the capture filter chain: the HPF (2nd-order Butterworth high-pass) if enabled, then
+// the user sections. Coefficients are only computed here, on a settings or sample-rate change.
 void updateHighpassCoeffs() {
-    if (!highpassEnabled) {
-        hpf.reset();
-        hpfConfigSampleRate = currentSampleRate;
-        hpfConfigCutoff = highpassCutoffHz;
-        return;
-    }
-    float fs = (float)currentSampleRate;
-    float fc = (float)highpassCutoffHz;
-    if (fc < 10.0f) fc = 10.0f;
-    if (fc > fs * 0.45f) fc = fs * 0.45f; // keep reasonable
-
-    const float pi = 3.14159265358979323846f;
-    float w0 = 2.0f * pi * (fc / fs);
-    float cosw0 = cosf(w0);
-    float sinw0 = sinf(w0);
-    float Q = 0.70710678f; // Butterworth-like
-    float alpha = sinw0 / (2.0f * Q);
-
-    float b0 =  (1.0f + cosw0) * 0.5f;
-    float b1 = -(1.0f + cosw0);
-    float b2 =  (1.0f + cosw0) * 0.5f;
-    float a0 =  1.0f + alpha;
-    float a1 = -2.0f * cosw0;
-    float a2 =  1.0f - alpha;
-
-    hpf.b0 = b0 / a0;
-    hpf.b1 = b1 / a0;
-    hpf.b2 = b2 / a0;
-    hpf.a1 = a1 / a0;
-    hpf.a2 = a2 / a0;
-    hpf.reset();
-
+    filterchain_configure(highpassEnabled ? highpassCutoffHz : 0, filterSpecs, filterSpecCount,
+                          (float)currentSampleRate);
     hpfConfigSampleRate = currentSampleRate;
-    hpfConfigCutoff = (uint16_t)fc;
+    hpfConfigCutoff = highpassCutoffHz;
+    filterOverBudgetLogged = false;
 }
 
-// Uptime -> "Xd Yh Zm Ts"
-String formatUptime(unsigned long seconds) {
-    unsigned long days = seconds / 86400;
-    seconds %= 86400;
-    unsigned long hours = seconds / 3600;
-    seconds %= 3600;
-    unsigned long minutes = seconds / 60;
-    seconds %= 60;
+// Restarts the AGC loop from the manual gain with the current target and cap
+void updateAgcConfig() {
+    agc_configure(agcTargetDbfs, agcMaxGain, currentGainFactor);
+}
+
+void updateRecorderConfig() {
+    RecorderConfig c;
+    c.enabled = recEnabled;
+    c.segmentSec = recSegmentSec;
+    c.quotaKB = recQuotaKB;
+    c.keepHours = recKeepHours;
+    c.decimate = recDecimate;
+    recorder_configure(c);
+}
 
-    String result = "";
-    if (days > 0) result += String(days) + "d ";
-    if (hours > 0 || days > 0) result += String(hours) + "h ";
-    if (minutes > 0 || hours > 0 || days > 0) result += String(minutes) + "m ";
-    result += String(seconds) + "s";
-    return result;
+// Uptime -> "Xd Yh Zm Ts" into buf (leading zero units omitted); returns the length written.
+size_t formatUptime(unsigned long seconds, char *buf, size_t cap) {
+    if (cap == 0) return 0;
+    unsigned long d = seconds / 86400, h = (seconds % 86400) / 3600, m = (seconds % 3600) / 60;
+    unsigned long s = seconds % 60;
+    int n;
+    if (d > 0) n = snprintf(buf, cap, "%lud %luh %lum %lus", d, h, m, s);
+    else if (h > 0) n = snprintf(buf, cap, "%luh %lum %lus", h, m, s);
+    else if (m > 0) n = snprintf(buf, cap, "%lum %lus", m, s);
+    else n = snprintf(buf, cap, "%lus", s);
+    if (n < 0) return 0;
+    return ((size_t)n < cap) ? (size_t)n : cap - 1;
+}
+
+String formatUptime(unsigned long seconds) {
+    char buf[32];
+    formatUptime(seconds, buf, sizeof(buf));
+    return String(buf);
 }
 
 // Format "X ago" for events based on millis()
@@ -1003,6 +1581,64 @@ static uint32_t secondsUntilScheduleStart(const struct tm& tmNow, uint16_t start
     return sec;
 }
 
+// Remember the current association and lease for the next timer wake.
+static void cacheWifiForResume() {
+    if (WiFi.status() != WL_CONNECTED) return;
+    const uint8_t *bssid = WiFi.BSSID();
+    if (!bssid) return;
+    memcpy(rtcWifiBssid, bssid, 6);
+    rtcWifiChannel = (uint8_t)WiFi.channel();
+    rtcWifiIp = (uint32_t)WiFi.localIP();
+    rtcWifiGateway = (uint32_t)WiFi.gatewayIP();
+    rtcWifiSubnet = (uint32_t)WiFi.subnetMask();
+    rtcWifiDns = (uint32_t)WiFi.dnsIP();
+    if (!bootCachedLease) {
+        // Obtained by DHCP on this boot (or renewed by a reconnect): lease age starts now.
+        wifiLeaseBaseAgeSec = 0;
+        wifiLeaseSinceMs = millis();
+    }
+    rtcWifiMagic = WIFI_RTC_CACHE_MAGIC;
+}
+
+// Direct connect on timer wake: known BSSID/channel skip the scan, a young lease skips DHCP.
+// I2S is started while the association runs. Returns false to fall back to WiFiManager.
+static bool fastWifiResume() {
+    if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_TIMER) return false;
+    if (rtcWifiMagic != WIFI_RTC_CACHE_MAGIC || rtcWifiChannel == 0) return false;
+    WiFi.mode(WIFI_STA);
+    String ssid = WiFi.SSID();
+    String pass = WiFi.psk();
+    if (ssid.length() == 0) return false;
+
+    bootCachedLease = (rtcWifiIp != 0 && rtcWifiLeaseAgeSec < WIFI_RTC_LEASE_MAX_AGE_SEC);
+    if (bootCachedLease) {
+        WiFi.config(IPAddress(rtcWifiIp), IPAddress(rtcWifiGateway), IPAddress(rtcWifiSubnet), IPAddress(rtcWifiDns));
+        wifiLeaseBaseAgeSec = rtcWifiLeaseAgeSec;
+        wifiLeaseSinceMs = millis();
+    }
+    WiFi.persistent(false);
+    WiFi.begin(ssid.c_str(), pass.length() ? pass.c_str() : nullptr, rtcWifiChannel, rtcWifiBssid, true);
+    WiFi.persistent(true);
+
+    if (setup_i2s_driver()) bootI2sReadyMs = millis();
+
+    unsigned long t0 = millis();
+    while (WiFi.status() != WL_CONNECTED && (millis() - t0) < WIFI_FAST_RESUME_TIMEOUT_MS) {
+        delay(10);
+    }
+    if (WiFi.status() == WL_CONNECTED) return true;
+
+    simplePrintln("WiFi fast resume: no association after " + String(WIFI_FAST_RESUME_TIMEOUT_MS) +
+                  " ms (channel " + String(rtcWifiChannel) + "), falling back to full connect");
+    WiFi.disconnect(false);
+    if (bootCachedLease) {
+        WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);   // back to DHCP
+        bootCachedLease = false;
+    }
+    rtcWifiMagic = 0;
+    return false;
+}
+
 static void recordDeepSleepSnapshot(uint32_t sleepSec, uint32_t untilStartSec, const struct tm& tmNow) {
     rtcSleepPlannedSec = sleepSec;
     rtcSleepUntilStartSec = untilStartSec;
@@ -1012,6 +1648,9 @@ static void recordDeepSleepSnapshot(uint32_t sleepSec, uint32_t untilStartSec, c
     rtcSleepOffsetMin = timeOffsetMinutes;
     rtcSleepCycleCount++;
     rtcSleepSnapshotMagic = DEEP_SLEEP_SNAPSHOT_MAGIC;
+    if (rtcWifiMagic == WIFI_RTC_CACHE_MAGIC) {
+        rtcWifiLeaseAgeSec = wifiLeaseBaseAgeSec + (uint32_t)((millis() - wifiLeaseSinceMs) / 1000UL) + sleepSec;
+    }
 }
 
 static void logDeepSleepWakeSnapshotIfAny() {
@@ -1196,11 +1835,8 @@ void checkDeepSleepSchedule() {
     }
     lastStreamStopReason = "Deep sleep outside stream schedule";
     lastStreamStopMs = millis();
-    if (mqttClient.connected()) {
-        mqttPublishState(true);
-        mqttClient.publish(mqttAvailabilityTopic().c_str(), "offline", true);
-        mqttClient.loop();
-        mqttClient.disconnect();
+    if (mqttConnected) {
+        mqttGoOffline(1000);
         delay(200);
     }
     WiFi.disconnect(true);
@@ -1210,35 +1846,30 @@ void checkDeepSleepSchedule() {
     esp_sleep_enable_timer_wakeup((uint64_t)sleepSec * 1000000ULL);
     Serial.flush();
     delay(30);
+    prepareForReset();
     esp_deep_sleep_start();
 }
 
-// Format current local date/time (uses NTP + offset), fallback to uptime
-String formatDateTime() {
+// Writes the log timestamp ("YYYY-mm-dd HH:MM:SS" or "uptime 1h 2m 3s") into buf.
+size_t formatLogTimestamp(char *buf, size_t cap) {
     time_t now = time(nullptr);
     if (hasValidTime()) {
         struct tm tmNow;
         localtime_r(&now, &tmNow);
-        char buf[24];
-        strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tmNow);
-        return String(buf);
+        return strftime(buf, cap, "%Y-%m-%d %H:%M:%S", &tmNow);
     }
-    unsigned long uptimeSeconds = (millis() - bootTime) / 1000;
-    return String("uptime ") + formatUptime(uptimeSeconds);
+    static const char PREFIX[] = "uptime ";
+    const size_t p = sizeof(PREFIX) - 1;
+    if (cap <= p) return 0;
+    memcpy(buf, PREFIX, p);
+    return p + formatUptime((millis() - bootTime) / 1000, buf + p, cap - p);
 }
 
-// Timestamp for log lines (short)
-String formatLogTimestamp() {
-    time_t now = time(nullptr);
-    if (hasValidTime()) {
-        struct tm tmNow;
-        localtime_r(&now, &tmNow);
-        char buf[24];
-        strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tmNow);
-        return String(buf);
-    }
-    unsigned long uptimeSeconds = (millis() - bootTime) / 1000;
-    return String("uptime ") + formatUptime(uptimeSeconds);
+// Format current local date/time (uses NTP + offset), fallback to uptime
+String formatDateTime() {
+    char buf[40];
+    formatLogTimestamp(buf, sizeof(buf));
+    return String(buf);
 }
 
 // Attempt NTP sync if Wi-Fi is up; returns success
@@ -1294,12 +1925,8 @@ static bool isTemperatureValid(float temp) {
 
 // Format current local time, fallback to uptime when no RTC/NTP time available
 static void persistOverheatNote() {
-    audioPrefs.begin("audio", false);
-    audioPrefs.putString("ohReason", overheatLastReason);
-    audioPrefs.putString("ohStamp", overheatLastTimestamp);
-    audioPrefs.putFloat("ohTripC", overheatTripTemp);
-    audioPrefs.putBool("ohLatched", overheatLatched);
-    audioPrefs.end();
+    prefstore_markDirty(millis());
+    flushSettingsNow();
 }
 
 void recordOverheatTrip(float temp) {
@@ -1393,20 +2020,169 @@ void checkPerformance() {
 
         if (currentRate > maxPacketRate) maxPacketRate = currentRate;
         if (currentRate < minPacketRate) minPacketRate = currentRate;
+        // Stalls and rate drops are handled within seconds by checkStreamWatchdog().
+    }
+}
 
-        if (currentRate < minAcceptableRate) {
-            simplePrintln("PERFORMANCE DEGRADATION DETECTED!");
-            simplePrintln("Rate " + String(currentRate) + " < minimum " + String(minAcceptableRate) + " pkt/s");
+// Stream watchdog: runs every second, performs the action StreamWatchdog decided on.
+void checkStreamWatchdog() {
+    WatchdogConfig cfg;
+    cfg.minRate = minAcceptableRate;
+    cfg.autoRecovery = autoRecoveryEnabled;
+    bool streaming = isStreaming && rtspClient && rtspClient.connected();
+    uint32_t expected = currentBufferSize ? (currentSampleRate + currentBufferSize / 2) / currentBufferSize : 0;
+    WatchdogAction a = streamWatchdog.tick(cfg, millis(), streaming, (uint32_t)audioPacketsSent,
+                                           audioSamplesSent, expected);
+    if (a == WD_NONE) return;
 
-            if (autoRecoveryEnabled) {
-                simplePrintln("AUTO-RECOVERY: Restarting I2S...");
-                restartI2S();
-                audioPacketsSent = 0;
-                lastStatsReset = millis();
-                lastI2SReset = millis();
-            }
-        }
+    const StreamWatchdog &wd = streamWatchdog;
+    if (wd.fault() == WD_FAULT_STALL) {
+        simplePrintf("STREAM WATCHDOG: stall, no packets for %lu s -> %s", (unsigned long)wd.stallSeconds(),
+                     StreamWatchdog::actionName(a));
+    } else {
+        simplePrintf("STREAM WATCHDOG: rate %.1f < %lu pkt/s -> %s", wd.packetRateX16() / 16.0f,
+                     (unsigned long)minAcceptableRate, StreamWatchdog::actionName(a));
+    }
+
+    switch (a) {
+    case WD_RESET_DSP:
+        updateHighpassCoeffs();
+        agc_reset();
+        audioLatencyRestart();
+        break;
+    case WD_RESTART_I2S: {
+        // Same parameters, so the client's session stays valid: keep streaming.
+        bool wasStreaming = isStreaming;
+        restartI2S();
+        isStreaming = wasStreaming;
+        lastI2SReset = millis();
+        break;
+    }
+    case WD_RECONNECT_WIFI:
+        scheduleWifiReconnect(nullptr, 0);
+        break;
+    default:
+        break;
+    }
+}
+
+// Dead-mic probe: reinstall the driver on the other L/R slot and keep it if a live signal
+// shows up there (the mic's L/R pin and the configured slot disagree), else switch back. The
+// capture path checks its blocks while the probe runs (micProbeBlock()), so loop() does not wait
+// for it. checkMicHealth() decides once MIC_PROBE_CHECK_BLOCKS blocks past the start-up ones were
+// checked, or at a deadline from the block length (blocks of 8192 samples at 8 kHz last 1 s, and
+// none arrive while nothing captures): without enough blocks the probe switches back.
+#ifndef MIC_PROBE_SKIP_BLOCKS
+#define MIC_PROBE_SKIP_BLOCKS 2      // the mic's start-up on the new slot
+#endif
+#ifndef MIC_PROBE_CHECK_BLOCKS
+#define MIC_PROBE_CHECK_BLOCKS 3
+#endif
+struct MicProbe {
+    bool active;
+    bool alive;
+    bool rightSlot;     // slot being probed
+    uint8_t blocks;     // seen since the switch, start-up included
+    unsigned long startMs;
+    unsigned long deadlineMs;
+};
+static MicProbe micProbe = {false, false, false, 0, 0, 0};
+
+static void micProbeBlock(const int32_t *raw, int samples) {
+    if (!micProbe.active || micProbe.alive) return;
+    if (micProbe.blocks < 255) micProbe.blocks++;
+    if (micProbe.blocks > MIC_PROBE_SKIP_BLOCKS) micProbe.alive = michealth_blockAlive(raw, samples);
+}
+
+static uint8_t micProbeChecked() {
+    return micProbe.blocks > MIC_PROBE_SKIP_BLOCKS ? micProbe.blocks - MIC_PROBE_SKIP_BLOCKS : 0;
+}
+
+static bool micProbeDone(unsigned long now) {
+    return micProbe.alive || micProbeChecked() >= MIC_PROBE_CHECK_BLOCKS ||
+           now - micProbe.startMs >= micProbe.deadlineMs;
+}
+
+static void micProbeSwitchBack() {
+    i2sRightSlot = !micProbe.rightSlot;
+    if (!setup_i2s_driver()) {
+        simplePrintf("MIC HEALTH: switching back to the %s slot failed, restarting I2S",
+                     i2sRightSlot ? "right" : "left");
+        bool wasStreaming = isStreaming;
+        restartI2S();
+        isStreaming = wasStreaming;
+    }
+    michealth_discard();
+}
+
+static void micProbeStart() {
+    // Twice the time the blocks need, plus a second of slack for loop() and the driver start
+    unsigned long blockMs = (unsigned long)currentBufferSize * 1000UL / currentSampleRate + 1;
+    micProbe = {true, false, !i2sRightSlot, 0, millis(),
+                2UL * (MIC_PROBE_SKIP_BLOCKS + MIC_PROBE_CHECK_BLOCKS) * blockMs + 1000UL};
+    i2sRightSlot = micProbe.rightSlot;
+    if (!setup_i2s_driver()) {
+        micProbe.active = false;
+        simplePrintf("MIC HEALTH: could not open the %s slot", i2sRightSlot ? "right" : "left");
+        micProbeSwitchBack();
+        return;
+    }
+    michealth_discard();
+}
+
+static void micProbeFinish() {
+    micProbe.active = false;
+    if (micProbe.alive) {
+        micHealth.lrSwitched = true;
+        saveAudioSettings();
+        michealth_discard();
+        simplePrintf("MIC HEALTH: signal on the %s slot, switched", i2sRightSlot ? "right" : "left");
+    } else if (micProbeChecked() < MIC_PROBE_CHECK_BLOCKS) {
+        simplePrintf("MIC HEALTH: probe of the other slot got %u block(s) before its deadline, switching back",
+                     (unsigned)micProbeChecked());
+        micProbeSwitchBack();
+    } else {
+        simplePrintf("MIC HEALTH: no signal on the other slot either");
+        micProbeSwitchBack();
+    }
+    mqttPublishState(true);
+}
+
+// An I2S restart for another reason ends a running probe on the configured slot.
+static void micProbeCancel() {
+    if (!micProbe.active) return;
+    micProbe.active = false;
+    if (i2sRightSlot == micProbe.rightSlot) i2sRightSlot = !micProbe.rightSlot;
+}
+
+// Mic health: runs every second, performs the action MicHealth decided on.
+void checkMicHealth() {
+    if (micProbe.active) {
+        if (micProbeDone(millis())) micProbeFinish();
+        return;
     }
+    MicHealthAction a = michealth_tick(i2sShiftBits, autoRecoveryEnabled, millis());
+    if (a == MH_NONE) return;
+
+    const MicHealthStatus &h = micHealth;
+    simplePrintf("MIC HEALTH: %s, rms %.1f dBFS, dc %.1f dBFS -> %s", michealth_summary(h.flags), h.rmsDbfs,
+                 h.dcDbfs, michealth_actionName(a));
+
+    switch (a) {
+    case MH_PROBE_CHANNEL:
+        micProbeStart();
+        break;
+    case MH_RESTART_I2S: {
+        bool wasStreaming = isStreaming;
+        restartI2S();
+        isStreaming = wasStreaming;
+        lastI2SReset = millis();
+        break;
+    }
+    default:
+        break;
+    }
+    mqttPublishState(true);
 }
 
 // WiFi health check
@@ -1425,6 +2201,7 @@ void checkWiFiHealth() {
         wifiReconnectCount++;
         simplePrintln("WiFi reconnected: " + WiFi.localIP().toString() +
                       " (count " + String(wifiReconnectCount) + ")");
+        cacheWifiForResume();
         applyMdnsSetting();
         if (timeSyncEnabled) {
             attemptTimeSync(false);
@@ -1443,6 +2220,25 @@ void checkWiFiHealth() {
     }
 }
 
+// Heap fragmentation alert: logged once when the ratio crosses the threshold, re-armed
+// after it falls HEAP_FRAG_ALERT_HYSTERESIS points below.
+void checkHeapFragmentation() {
+    if (heapFragAlertPct == 0) {
+        heapFragAlertActive = false;
+        return;
+    }
+    const HeapStatus &h = heapStatus;
+    if (!heapFragAlertActive && h.fragPct >= heapFragAlertPct) {
+        heapFragAlertActive = true;
+        heapFragAlerts++;
+        simplePrintln("WARNING: Heap fragmentation " + String(h.fragPct) + "% (largest block " +
+                      String(h.largestBlock / 1024) + " KB of " + String(h.freeBytes / 1024) + " KB free)");
+    } else if (heapFragAlertActive && h.fragPct + HEAP_FRAG_ALERT_HYSTERESIS < heapFragAlertPct) {
+        heapFragAlertActive = false;
+        simplePrintln("Heap fragmentation back to " + String(h.fragPct) + "%");
+    }
+}
+
 // Scheduled reset
 void checkScheduledReset() {
     if (!scheduledResetEnabled) return;
@@ -1451,6 +2247,7 @@ void checkScheduledReset() {
     if (uptimeHours >= resetIntervalHours) {
         simplePrintln("SCHEDULED RESET: " + String(resetIntervalHours) + " hours reached");
         delay(1000);
+        prepareForReset();
         ESP.restart();
     }
 }
@@ -1472,18 +2269,44 @@ void loadAudioSettings() {
     currentSampleRate = audioPrefs.getUInt("sampleRate", DEFAULT_SAMPLE_RATE);
     currentGainFactor = audioPrefs.getFloat("gainFactor", DEFAULT_GAIN_FACTOR);
     currentBufferSize = audioPrefs.getUShort("bufferSize", DEFAULT_BUFFER_SIZE);
+    if (currentBufferSize > AUDIO_MAX_BUFFER_SAMPLES) currentBufferSize = AUDIO_MAX_BUFFER_SAMPLES;
     // (1) respect compile-time default 12 on first boot
     i2sShiftBits = audioPrefs.getUChar("shiftBits", i2sShiftBits);
+    i2sRightSlot = audioPrefs.getBool("i2sRight", DEFAULT_I2S_RIGHT_SLOT);
     autoRecoveryEnabled = audioPrefs.getBool("autoRecovery", true);
     scheduledResetEnabled = audioPrefs.getBool("schedReset", false);
     resetIntervalHours = audioPrefs.getUInt("resetHours", 24);
+    heapFragAlertPct = audioPrefs.getUChar("fragAlert", 75);
     minAcceptableRate = audioPrefs.getUInt("minRate", 50);
     performanceCheckInterval = audioPrefs.getUInt("checkInterval", 15);
     autoThresholdEnabled = audioPrefs.getBool("thrAuto", true);
     cpuFrequencyMhz = audioPrefs.getUChar("cpuFreq", 160);
+    powerProfile = audioPrefs.getUChar("pwrProfile", POWER_PERFORMANCE);
+    if (powerProfile >= POWER_PROFILE_COUNT) powerProfile = POWER_PERFORMANCE;
     wifiTxPowerDbm = audioPrefs.getFloat("wifiTxDbm", DEFAULT_WIFI_TX_DBM);
     highpassEnabled = audioPrefs.getBool("hpEnable", DEFAULT_HPF_ENABLED);
     highpassCutoffHz = (uint16_t)audioPrefs.getUInt("hpCutoff", DEFAULT_HPF_CUTOFF_HZ);
+    {
+        const char *filterErr = nullptr;
+        if (!filterchain_parse(audioPrefs.getString("filters", "[]"), filterSpecs, filterSpecCount, filterErr)) {
+            filterSpecCount = 0;
+        }
+    }
+    agcEnabled = audioPrefs.getBool("agcEnable", DEFAULT_AGC_ENABLED);
+    agcTargetDbfs = audioPrefs.getFloat("agcTarget", DEFAULT_AGC_TARGET_DBFS);
+    agcMaxGain = audioPrefs.getFloat("agcMaxGain", DEFAULT_AGC_MAX_GAIN);
+    calBootMode = audioPrefs.getUChar("calBoot", DEFAULT_CAL_BOOT_MODE);
+    if (calBootMode >= MICCAL_BOOT_MODE_COUNT) calBootMode = DEFAULT_CAL_BOOT_MODE;
+    calMarginDb = audioPrefs.getUChar("calMargin", CAL_DEFAULT_MARGIN_DB);
+    if (calMarginDb > CAL_MAX_MARGIN_DB) calMarginDb = CAL_DEFAULT_MARGIN_DB;
+    recEnabled = audioPrefs.getBool("recEnable", DEFAULT_REC_ENABLED);
+    recSegmentSec = audioPrefs.getUShort("recSegS", REC_DEFAULT_SEGMENT_S);
+    recQuotaKB = audioPrefs.getUInt("recQuotaKB", REC_DEFAULT_QUOTA_KB);
+    recKeepHours = audioPrefs.getUShort("recKeepH", 0);
+    recDecimate = audioPrefs.getUChar("recDecim", DEFAULT_REC_DECIMATE);
+    if (recDecimate < 1 || recDecimate > 4) recDecimate = DEFAULT_REC_DECIMATE;
+    httpAudioMaxClients = audioPrefs.getUChar("httpAudioMax", HTTP_AUDIO_DEFAULT_CLIENTS);
+    if (httpAudioMaxClients > HTTP_AUDIO_MAX_SLOTS) httpAudioMaxClients = HTTP_AUDIO_DEFAULT_CLIENTS;
     overheatProtectionEnabled = audioPrefs.getBool("ohEnable", DEFAULT_OVERHEAT_PROTECTION);
     timeOffsetMinutes = audioPrefs.getInt("timeOffset", 0);
     timeSyncEnabled = audioPrefs.getBool("timeSyncEn", true);
@@ -1502,6 +2325,10 @@ void loadAudioSettings() {
     mqttDiscoveryPrefix = audioPrefs.getString("mqttDisc", "homeassistant");
     mqttClientId = audioPrefs.getString("mqttCid", "");
     mqttPublishIntervalSec = (uint16_t)audioPrefs.getUInt("mqttIntSec", DEFAULT_MQTT_PUBLISH_INTERVAL_SEC);
+    mqttDeltaEnabled = audioPrefs.getBool("mqttDelta", false);
+    mqttFullEvery = (uint16_t)audioPrefs.getUInt("mqttFullN", DEFAULT_MQTT_FULL_EVERY);
+    mqttMsgpackEnabled = audioPrefs.getBool("mqttMpk", false);
+    mqttProfileEnabled = audioPrefs.getBool("mqttProf", false);
     if (streamScheduleStartMin > 1439) streamScheduleStartMin = 0;
     if (streamScheduleStopMin > 1439) streamScheduleStopMin = 0;
     uint32_t ohLimit = audioPrefs.getUInt("ohThresh", DEFAULT_OVERHEAT_LIMIT_C);
@@ -1514,6 +2341,10 @@ void loadAudioSettings() {
     overheatTripTemp = audioPrefs.getFloat("ohTripC", 0.0f);
     overheatLatched = audioPrefs.getBool("ohLatched", false);
     audioPrefs.end();
+    // What was just read is what flash holds: later flushes only write keys that differ.
+    prefstore_primeBegin();
+    writeAudioSettings();
+    prefstore_primeEnd();
     mqttApplyClientSettings(false);
 
     // Apply timezone/offset immediately after loading persisted settings so that
@@ -1535,56 +2366,99 @@ void loadAudioSettings() {
                   ", WiFiTX=" + String(txShown, 1) + "dBm" +
                   ", shiftBits=" + String(i2sShiftBits) +
                   ", HPF=" + String(highpassEnabled?"on":"off") +
-                  ", HPFcut=" + String(highpassCutoffHz) + "Hz");
-}
-
-// Save settings to flash
-void saveAudioSettings() {
-    mqttApplyClientSettings(false);
-    audioPrefs.begin("audio", false);
-    audioPrefs.putUInt("sampleRate", currentSampleRate);
-    audioPrefs.putFloat("gainFactor", currentGainFactor);
-    audioPrefs.putUShort("bufferSize", currentBufferSize);
-    audioPrefs.putUChar("shiftBits", i2sShiftBits);
-    audioPrefs.putBool("autoRecovery", autoRecoveryEnabled);
-    audioPrefs.putBool("schedReset", scheduledResetEnabled);
-    audioPrefs.putUInt("resetHours", resetIntervalHours);
-    audioPrefs.putUInt("minRate", minAcceptableRate);
-    audioPrefs.putUInt("checkInterval", performanceCheckInterval);
-    audioPrefs.putBool("thrAuto", autoThresholdEnabled);
-    audioPrefs.putUChar("cpuFreq", cpuFrequencyMhz);
-    audioPrefs.putFloat("wifiTxDbm", wifiTxPowerDbm);
-    audioPrefs.putBool("hpEnable", highpassEnabled);
-    audioPrefs.putUInt("hpCutoff", (uint32_t)highpassCutoffHz);
-    audioPrefs.putBool("ohEnable", overheatProtectionEnabled);
+                  ", HPFcut=" + String(highpassCutoffHz) + "Hz" +
+                  ", filters=" + String(filterSpecCount) +
+                  ", AGC=" + String(agcEnabled?"on":"off"));
+}
+
+// Every persisted setting, one prefstore_put*() each (only keys that changed reach NVS)
+static void writeAudioSettings() {
+    prefstore_putUInt("sampleRate", currentSampleRate);
+    prefstore_putFloat("gainFactor", currentGainFactor);
+    prefstore_putUShort("bufferSize", currentBufferSize);
+    prefstore_putUChar("shiftBits", i2sShiftBits);
+    prefstore_putBool("i2sRight", i2sRightSlot);
+    prefstore_putBool("autoRecovery", autoRecoveryEnabled);
+    prefstore_putBool("schedReset", scheduledResetEnabled);
+    prefstore_putUInt("resetHours", resetIntervalHours);
+    prefstore_putUChar("fragAlert", heapFragAlertPct);
+    prefstore_putUInt("minRate", minAcceptableRate);
+    prefstore_putUInt("checkInterval", performanceCheckInterval);
+    prefstore_putBool("thrAuto", autoThresholdEnabled);
+    prefstore_putUChar("cpuFreq", cpuFrequencyMhz);
+    prefstore_putUChar("pwrProfile", powerProfile);
+    prefstore_putFloat("wifiTxDbm", wifiTxPowerDbm);
+    prefstore_putBool("hpEnable", highpassEnabled);
+    prefstore_putUInt("hpCutoff", (uint32_t)highpassCutoffHz);
+    prefstore_putString("filters", filterchain_toJson(filterSpecs, filterSpecCount));
+    prefstore_putBool("agcEnable", agcEnabled);
+    prefstore_putFloat("agcTarget", agcTargetDbfs);
+    prefstore_putFloat("agcMaxGain", agcMaxGain);
+    prefstore_putUChar("calBoot", calBootMode);
+    prefstore_putUChar("calMargin", calMarginDb);
+    prefstore_putBool("recEnable", recEnabled);
+    prefstore_putUShort("recSegS", recSegmentSec);
+    prefstore_putUInt("recQuotaKB", recQuotaKB);
+    prefstore_putUShort("recKeepH", recKeepHours);
+    prefstore_putUChar("recDecim", recDecimate);
+    prefstore_putUChar("httpAudioMax", httpAudioMaxClients);
+    prefstore_putBool("ohEnable", overheatProtectionEnabled);
     uint32_t ohLimit = (uint32_t)(overheatShutdownC + 0.5f);
     if (ohLimit < OVERHEAT_MIN_LIMIT_C) ohLimit = OVERHEAT_MIN_LIMIT_C;
     if (ohLimit > OVERHEAT_MAX_LIMIT_C) ohLimit = OVERHEAT_MAX_LIMIT_C;
-    audioPrefs.putUInt("ohThresh", ohLimit);
-    audioPrefs.putString("ohReason", overheatLastReason);
-    audioPrefs.putString("ohStamp", overheatLastTimestamp);
-    audioPrefs.putFloat("ohTripC", overheatTripTemp);
-    audioPrefs.putBool("ohLatched", overheatLatched);
-    audioPrefs.putInt("timeOffset", timeOffsetMinutes);
-    audioPrefs.putBool("timeSyncEn", timeSyncEnabled);
-    audioPrefs.putBool("mdnsEn", mdnsEnabled);
-    audioPrefs.putString("mdnsHost", mdnsHostname);
-    audioPrefs.putBool("strSchedEn", streamScheduleEnabled);
-    audioPrefs.putUInt("strSchStart", streamScheduleStartMin);
-    audioPrefs.putUInt("strSchStop", streamScheduleStopMin);
-    audioPrefs.putBool("deepSchSlp", deepSleepScheduleEnabled);
-    audioPrefs.putBool("mqttEn", mqttEnabled);
-    audioPrefs.putString("mqttHost", mqttHost);
-    audioPrefs.putUInt("mqttPort", (uint32_t)mqttPort);
-    audioPrefs.putString("mqttUser", mqttUser);
-    audioPrefs.putString("mqttPass", mqttPassword);
-    audioPrefs.putString("mqttTop", mqttTopicPrefix);
-    audioPrefs.putString("mqttDisc", mqttDiscoveryPrefix);
-    audioPrefs.putString("mqttCid", mqttClientId);
-    audioPrefs.putUInt("mqttIntSec", (uint32_t)mqttPublishIntervalSec);
+    prefstore_putUInt("ohThresh", ohLimit);
+    prefstore_putString("ohReason", overheatLastReason);
+    prefstore_putString("ohStamp", overheatLastTimestamp);
+    prefstore_putFloat("ohTripC", overheatTripTemp);
+    prefstore_putBool("ohLatched", overheatLatched);
+    prefstore_putInt("timeOffset", timeOffsetMinutes);
+    prefstore_putBool("timeSyncEn", timeSyncEnabled);
+    prefstore_putBool("mdnsEn", mdnsEnabled);
+    prefstore_putString("mdnsHost", mdnsHostname);
+    prefstore_putBool("strSchedEn", streamScheduleEnabled);
+    prefstore_putUInt("strSchStart", streamScheduleStartMin);
+    prefstore_putUInt("strSchStop", streamScheduleStopMin);
+    prefstore_putBool("deepSchSlp", deepSleepScheduleEnabled);
+    prefstore_putBool("mqttEn", mqttEnabled);
+    prefstore_putString("mqttHost", mqttHost);
+    prefstore_putUInt("mqttPort", (uint32_t)mqttPort);
+    prefstore_putString("mqttUser", mqttUser);
+    prefstore_putString("mqttPass", mqttPassword);
+    prefstore_putString("mqttTop", mqttTopicPrefix);
+    prefstore_putString("mqttDisc", mqttDiscoveryPrefix);
+    prefstore_putString("mqttCid", mqttClientId);
+    prefstore_putUInt("mqttIntSec", (uint32_t)mqttPublishIntervalSec);
+    prefstore_putBool("mqttDelta", mqttDeltaEnabled);
+    prefstore_putUInt("mqttFullN", (uint32_t)mqttFullEvery);
+    prefstore_putBool("mqttMpk", mqttMsgpackEnabled);
+    prefstore_putBool("mqttProf", mqttProfileEnabled);
+}
+
+// Flush pending settings changes to flash now (before a reboot or deep sleep)
+void flushSettingsNow() {
+    if (!prefstore_dirty()) return;
+    audioPrefs.begin("audio", false);
+    prefstore_flushBegin(audioPrefs);
+    writeAudioSettings();
+    prefstore_flushEnd(millis());
     audioPrefs.end();
+    simplePrintln("Settings saved to flash (" + String(prefStoreStats.lastKeys) + " keys changed)");
+}
 
-    simplePrintln("Settings saved to flash");
+// Everything that must reach flash or the network before ESP.restart() or deep sleep: pending
+// settings, the end of every HTTP audio stream, the open recording segment, the log journal.
+// Safe from setup() too, before those modules have anything to write.
+void prepareForReset() {
+    flushSettingsNow();
+    httpaudio_closeAll("closed_by_device");
+    recorder_pause(LOG_JOURNAL_RESET_FLUSH_MS);
+    logjournal_flush(LOG_JOURNAL_RESET_FLUSH_MS);
+}
+
+// Mark settings as changed; the nvs_save job writes them once changes stop coming in
+void saveAudioSettings() {
+    mqttApplyClientSettings(false);
+    prefstore_markDirty(millis());
 }
 
 // mDNS management
@@ -1643,23 +2517,39 @@ void resetToDefaultSettings() {
     audioPrefs.begin("audio", false);
     audioPrefs.clear();
     audioPrefs.end();
+    prefstore_invalidate();
 
     // Reset runtime variables to defaults
     currentSampleRate = DEFAULT_SAMPLE_RATE;
     currentGainFactor = DEFAULT_GAIN_FACTOR;
     currentBufferSize = DEFAULT_BUFFER_SIZE;
     i2sShiftBits = 12;  // compile-time default respected
+    i2sRightSlot = DEFAULT_I2S_RIGHT_SLOT;
 
     autoRecoveryEnabled = true;
     autoThresholdEnabled = true;
     scheduledResetEnabled = false;
     resetIntervalHours = 24;
+    heapFragAlertPct = 75;
     minAcceptableRate = computeRecommendedMinRate();
     performanceCheckInterval = 15;
     cpuFrequencyMhz = 160;
+    powerProfile = POWER_PERFORMANCE;
     wifiTxPowerDbm = DEFAULT_WIFI_TX_DBM;
     highpassEnabled = DEFAULT_HPF_ENABLED;
     highpassCutoffHz = DEFAULT_HPF_CUTOFF_HZ;
+    filterSpecCount = 0;
+    agcEnabled = DEFAULT_AGC_ENABLED;
+    agcTargetDbfs = DEFAULT_AGC_TARGET_DBFS;
+    agcMaxGain = DEFAULT_AGC_MAX_GAIN;
+    calBootMode = DEFAULT_CAL_BOOT_MODE;
+    calMarginDb = CAL_DEFAULT_MARGIN_DB;
+    recEnabled = DEFAULT_REC_ENABLED;
+    recSegmentSec = REC_DEFAULT_SEGMENT_S;
+    recQuotaKB = REC_DEFAULT_QUOTA_KB;
+    recKeepHours = 0;
+    recDecimate = DEFAULT_REC_DECIMATE;
+    httpAudioMaxClients = HTTP_AUDIO_DEFAULT_CLIENTS;
     overheatProtectionEnabled = DEFAULT_OVERHEAT_PROTECTION;
     overheatShutdownC = (float)DEFAULT_OVERHEAT_LIMIT_C;
     overheatLockoutActive = false;
@@ -1693,14 +2583,18 @@ void resetToDefaultSettings() {
     mqttDiscoveryPrefix = "homeassistant";
     mqttClientId = mqttDefaultClientId();
     mqttPublishIntervalSec = DEFAULT_MQTT_PUBLISH_INTERVAL_SEC;
+    mqttDeltaEnabled = false;
+    mqttFullEvery = DEFAULT_MQTT_FULL_EVERY;
+    mqttMsgpackEnabled = false;
+    mqttProfileEnabled = false;
+    mqttStateNeedFull = true;
     mqttConnected = false;
     mqttLastError = "disabled";
-    mqttDiscoveryPublished = false;
-    mqttForceDiscovery = false;
 
     isStreaming = false;
 
     saveAudioSettings();
+    flushSettingsNow();
 
     simplePrintln("Defaults applied. Device will reboot.");
 }
@@ -1709,23 +2603,19 @@ void resetToDefaultSettings() {
 void restartI2S() {
     simplePrintln("Restarting I2S with new parameters...");
     isStreaming = false;
+    miccal_abort("i2s_restarted", millis());
+    micProbeCancel();
 
-    if (i2s_32bit_buffer) { free(i2s_32bit_buffer); i2s_32bit_buffer = nullptr; }
-    if (i2s_16bit_buffer) { free(i2s_16bit_buffer); i2s_16bit_buffer = nullptr; }
-
-    i2s_32bit_buffer = (int32_t*)malloc(currentBufferSize * sizeof(int32_t));
-    i2s_16bit_buffer = (int16_t*)malloc(currentBufferSize * sizeof(int16_t));
-    if (!i2s_32bit_buffer || !i2s_16bit_buffer) {
-        simplePrintln("FATAL: Memory allocation failed after parameter change!");
-        ESP.restart();
-    }
-
+    // Buffers are arena views sized for AUDIO_MAX_BUFFER_SAMPLES: nothing to reallocate.
     if (!setup_i2s_driver()) {
         simplePrintln("FATAL: I2S restart failed!");
+        prepareForReset();
         ESP.restart();
     }
-    // Refresh HPF with current parameters
+    // Refresh HPF with current parameters; the gain may have changed too
     updateHighpassCoeffs();
+    updateAgcConfig();
+    audioLatencyRestart();
     maxPacketRate = 0;
     minPacketRate = 0xFFFFFFFF;
     simplePrintln("I2S restarted successfully");
@@ -1736,10 +2626,44 @@ void simplePrint(String message) {
     Serial.print(message);
 }
 
-void simplePrintln(String message) {
-    String line = "[" + formatLogTimestamp() + "] " + message;
-    Serial.println(line);
-    webui_pushLog(line);
+static const size_t LOG_PREFIX_MAX = 48;
+
+// Writes "[<timestamp>] " into buf (at least LOG_PREFIX_MAX bytes), returns its length.
+static size_t formatLogPrefix(char *buf) {
+    buf[0] = '[';
+    size_t n = 1 + formatLogTimestamp(buf + 1, LOG_PREFIX_MAX - 3);
+    buf[n++] = ']';
+    buf[n++] = ' ';
+    buf[n] = '\0';
+    return n;
+}
+
+static void logLine(const char *prefix, size_t prefixLen, const char *text, size_t textLen) {
+    Serial.write(prefix, prefixLen);
+    Serial.write(text, textLen);
+    Serial.println();
+    webui_pushLog(prefix, prefixLen, text, textLen);
+    logjournal_append(prefix, prefixLen, text, textLen);
+}
+
+void simplePrintln(const String &message) {
+    char prefix[LOG_PREFIX_MAX];
+    size_t n = formatLogPrefix(prefix);
+    logLine(prefix, n, message.c_str(), message.length());
+}
+
+// printf-style simplePrintln() for the audio and streaming paths: prefix and message are
+// formatted into one stack line of the Web UI log's maximum length, so no String is built.
+void simplePrintf(const char *fmt, ...) {
+    char line[WEBUI_LOG_LINE_MAX + 1];
+    size_t n = formatLogPrefix(line);
+    va_list ap;
+    va_start(ap, fmt);
+    int len = vsnprintf(line + n, sizeof(line) - n, fmt, ap);
+    va_end(ap);
+    if (len < 0) len = 0;
+    if ((size_t)len > sizeof(line) - 1 - n) len = (int)(sizeof(line) - 1 - n);
+    logLine(line, n, line + n, (size_t)len);
 }
 
 // OTA setup
@@ -1752,6 +2676,19 @@ void setupOTA() {
     ArduinoOTA.begin();
 }
 
+// Non-critical services, started after the first RTP packet (or DEFERRED_INIT_TIMEOUT_MS
+// after setup() when no client plays) so they do not delay the stream after boot.
+static void runDeferredInit(const char *trigger) {
+    if (deferredInitDone) return;
+    deferredInitDone = true;
+    applyMdnsSetting();
+    setupOTA();
+    otaStarted = true;
+    mqttStartTask();
+    mqttRequestReconnect(true);
+    simplePrintln(String("Deferred init (mDNS, OTA, MQTT) after ") + trigger + " at " + String(millis()) + " ms");
+}
+
 // I2S setup
 bool setup_i2s_driver() {
     i2s_driver_uninstall(I2S_NUM_0);
@@ -1762,7 +2699,7 @@ bool setup_i2s_driver() {
     i2s_config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX);
     i2s_config.sample_rate = currentSampleRate;
     i2s_config.bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT;
-    i2s_config.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+    i2s_config.channel_format = i2sRightSlot ? I2S_CHANNEL_FMT_ONLY_RIGHT : I2S_CHANNEL_FMT_ONLY_LEFT;
     i2s_config.communication_format = I2S_COMM_FORMAT_STAND_I2S;
     i2s_config.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
     i2s_config.dma_desc_num = 8;
@@ -1776,21 +2713,22 @@ bool setup_i2s_driver() {
 
     esp_err_t err = i2s_driver_install(I2S_NUM_0, &i2s_config, 0, NULL);
     if (err != ESP_OK) {
-        simplePrintln("I2S driver install failed: " + String(esp_err_to_name(err)));
+        simplePrintf("I2S driver install failed: %s", esp_err_to_name(err));
         return false;
     }
 
     err = i2s_set_pin(I2S_NUM_0, &pin_config);
     if (err != ESP_OK) {
-        simplePrintln("I2S pin setup failed: " + String(esp_err_to_name(err)));
+        simplePrintf("I2S pin setup failed: %s", esp_err_to_name(err));
         i2s_driver_uninstall(I2S_NUM_0);
         return false;
     }
 
     // (5) log i2sShiftBits for easier debugging
-    simplePrintln("I2S ready: " + String(currentSampleRate) + "Hz, gain " +
-                  String(currentGainFactor, 1) + ", buffer " + String(currentBufferSize) +
-                  ", shiftBits " + String(i2sShiftBits));
+    simplePrintf("I2S ready: %luHz, gain %.1f, buffer %u, shiftBits %u, slot %s", (unsigned long)currentSampleRate,
+                 currentGainFactor, (unsigned)currentBufferSize, (unsigned)i2sShiftBits,
+                 i2sRightSlot ? "right" : "left");
+    michealth_discard();
     return true;
 }
 
@@ -1838,34 +2776,34 @@ static void stopStreamOnWriteFailure(WiFiClient &client, const char* reason) {
     rtspParseBuffer[0] = '\0';
     client.stop();
 
-    simplePrintln("STREAMING STOPPED: " + lastStreamStopReason + " | " + buildRtspDiag(client));
+    simplePrintf("STREAMING STOPPED: %s | %s", lastStreamStopReason.c_str(), buildRtspDiag(client).c_str());
     mqttPublishState(true);
 }
 
-void sendRTPPacket(WiFiClient &client, int16_t* audioData, int numSamples) {
-    if (!client.connected()) return;
-
+// Fills hdr[0..3] with the RTSP interleaved header and hdr[4..15] with the RTP header, and
+// converts the payload to network byte order in place.
+static void rtpBuildPacket(uint8_t *hdr, int16_t* audioData, int numSamples, uint16_t seq, uint32_t ts) {
     const uint16_t payloadSize = (uint16_t)(numSamples * (int)sizeof(int16_t));
     const uint16_t packetSize = (uint16_t)(12 + payloadSize);
 
     // RTSP interleaved header: '$' 0x24, channel 0, length
-    uint8_t inter[4];
+    uint8_t *inter = hdr;
     inter[0] = 0x24;
     inter[1] = 0x00;
     inter[2] = (uint8_t)((packetSize >> 8) & 0xFF);
     inter[3] = (uint8_t)(packetSize & 0xFF);
 
     // RTP header (12 bytes)
-    uint8_t header[12];
+    uint8_t *header = hdr + 4;
     header[0] = 0x80;      // V=2, P=0, X=0, CC=0
     header[1] = 96;        // M=0, PT=96 (dynamic)
     // (3) safe byte-wise filling (no unaligned writes)
-    header[2] = (uint8_t)((rtpSequence >> 8) & 0xFF);
-    header[3] = (uint8_t)(rtpSequence & 0xFF);
-    header[4] = (uint8_t)((rtpTimestamp >> 24) & 0xFF);
-    header[5] = (uint8_t)((rtpTimestamp >> 16) & 0xFF);
-    header[6] = (uint8_t)((rtpTimestamp >> 8) & 0xFF);
-    header[7] = (uint8_t)(rtpTimestamp & 0xFF);
+    header[2] = (uint8_t)((seq >> 8) & 0xFF);
+    header[3] = (uint8_t)(seq & 0xFF);
+    header[4] = (uint8_t)((ts >> 24) & 0xFF);
+    header[5] = (uint8_t)((ts >> 16) & 0xFF);
+    header[6] = (uint8_t)((ts >> 8) & 0xFF);
+    header[7] = (uint8_t)(ts & 0xFF);
     header[8]  = (uint8_t)((rtpSSRC >> 24) & 0xFF);
     header[9]  = (uint8_t)((rtpSSRC >> 16) & 0xFF);
     header[10] = (uint8_t)((rtpSSRC >> 8) & 0xFF);
@@ -1877,24 +2815,127 @@ void sendRTPPacket(WiFiClient &client, int16_t* audioData, int numSamples) {
         s = (uint16_t)((s << 8) | (s >> 8)); // htons without dependency
         audioData[i] = (int16_t)s;
     }
+}
 
-    if (!writeAll(client, inter, sizeof(inter))) {
+bool sendRTPPacket(WiFiClient &client, int16_t* audioData, int numSamples) {
+    if (!client.connected()) return false;
+
+    const uint16_t payloadSize = (uint16_t)(numSamples * (int)sizeof(int16_t));
+    uint8_t hdr[16];
+    rtpBuildPacket(hdr, audioData, numSamples, rtpSequence, rtpTimestamp);
+
+    rtpWriteStartUs = micros();
+    if (!writeAll(client, hdr, 4)) {
         stopStreamOnWriteFailure(client, "RTP write failed (interleaved header)");
-        return;
+        return false;
     }
-    if (!writeAll(client, header, sizeof(header))) {
+    if (!writeAll(client, hdr + 4, 12)) {
         stopStreamOnWriteFailure(client, "RTP write failed (RTP header)");
-        return;
+        return false;
     }
     if (!writeAll(client, (uint8_t*)audioData, payloadSize)) {
         stopStreamOnWriteFailure(client, "RTP write failed (audio payload)");
-        return;
+        return false;
     }
 
     rtpSequence++;
     rtpTimestamp += (uint32_t)numSamples;
     audioPacketsSent++;
+    audioSamplesSent += (uint32_t)numSamples;
     lastRtpPacketMs = millis();
+    return true;
+}
+
+// Restart the capture clock model (new stream, I2S restart, sample-rate change).
+void audioLatencyRestart() {
+    latSamplesCaptured = 0;
+    latAnchorValid = false;
+}
+
+// The legacy I2S driver has no per-buffer timestamps, so block completion is derived from the
+// audio clock: when i2s_read() had to wait, the block completed just now and anchors the
+// model; otherwise the block has been sitting in the DMA ring since anchor + samples/rate.
+// Blocks before the first anchor (stale DMA data after PLAY) are not recorded.
+static void audioLatencyRecordBlock(uint32_t readStartUs, uint32_t readDoneUs, int samples) {
+    uint32_t doneUs = micros();
+    latSamplesCaptured += (uint32_t)samples;
+    uint32_t spanUs = (uint32_t)((latSamplesCaptured * 1000000ULL) / currentSampleRate);
+    if ((uint32_t)(readDoneUs - readStartUs) >= AUDIO_READ_BLOCKED_US) {
+        latAnchorUs = readDoneUs - spanUs;
+        latAnchorValid = true;
+    }
+    if (!latAnchorValid) return;
+
+    unsigned long nowMs = millis();
+    if (latWindowStartMs == 0 || (nowMs - latWindowStartMs) >= AUDIO_LATENCY_WINDOW_MS) {
+        if (latWindowStartMs != 0) {
+            for (uint8_t i = 0; i < LAT_STAGE_COUNT; i++) audioLatency[i].rotate();
+        }
+        latWindowStartMs = nowMs;
+    }
+    uint32_t completeUs = latAnchorUs + spanUs;
+    int32_t queueUs = (int32_t)(readDoneUs - completeUs);
+    if (queueUs < 0) queueUs = 0;
+    audioLastQueueUs = (uint32_t)queueUs;
+    audioLatency[LAT_QUEUE].record((uint32_t)queueUs);
+    audioLatency[LAT_DSP].record(rtpWriteStartUs - readDoneUs);
+    audioLatency[LAT_NET].record(doneUs - rtpWriteStartUs);
+    audioLatency[LAT_TOTAL].record((uint32_t)queueUs + (doneUs - readDoneUs));
+    audioLatencyBlocks++;
+}
+
+// Shift, filter, gain and clip one block of I2S words into 16-bit samples. Works in place
+// (the capture arena region): sample i is read before out[i] is written. With a filter chain
+// the block is first converted to float in place and filtered section by section; with AGC
+// the gain and limiter come from AutoGain.h instead of the fixed gain. Returns the block peak
+// before clipping.
+static float processAudioBlock(int32_t *in, int16_t *out, int samples) {
+    // If HPF params or the sample rate changed dynamically, recompute
+    if (hpfConfigSampleRate != currentSampleRate || (highpassEnabled && hpfConfigCutoff != highpassCutoffHz)) {
+        updateHighpassCoeffs();
+    }
+
+    const bool filtered = filterchain_active();
+    float *fbuf = (float *)in;
+    if (filtered || agcEnabled) {
+        for (int i = 0; i < samples; i++) fbuf[i] = (float)(in[i] >> i2sShiftBits);
+    }
+    if (filtered) {
+        uint32_t c0 = ESP.getCycleCount();
+        filterchain_process(fbuf, samples);
+        uint32_t cycles = ESP.getCycleCount() - c0;
+        uint32_t periodCycles = (uint32_t)((uint64_t)samples * getCpuFrequencyMhz() * 1000000ULL / currentSampleRate);
+        filterchain_account(cycles, samples, periodCycles);
+        if (filterChainStats.overBudget && !filterOverBudgetLogged) {
+            filterOverBudgetLogged = true;
+            simplePrintf("Filter chain over budget: %u sections use %.1f%% of the block period (budget %u%%)",
+                         (unsigned)filterChainStats.sections, filterChainStats.loadPeakPctX10 / 10.0f,
+                         (unsigned)FILTER_CHAIN_BUDGET_PCT);
+        }
+    }
+
+    if (agcEnabled) return agc_process(fbuf, out, samples, currentSampleRate);
+
+    float peakAbs = 0.0f;
+    for (int i = 0; i < samples; i++) {
+        float sample = filtered ? fbuf[i] : (float)(in[i] >> i2sShiftBits);
+        float amplified = sample * currentGainFactor;
+        float aabs = fabsf(amplified);
+        if (aabs > peakAbs) peakAbs = aabs;
+        if (amplified > 32767.0f) amplified = 32767.0f;
+        if (amplified < -32768.0f) amplified = -32768.0f;
+        out[i] = (int16_t)amplified;
+    }
+    return peakAbs;
+}
+
+// Listeners of /audio.wav and /audio.pcm get the block before sendRTPPacket() byte-swaps it.
+static void feedHttpAudio(const int16_t *pcm, int samples) {
+    uint8_t closed = httpaudio_block(pcm, samples, currentSampleRate, millis());
+    if (closed) {
+        simplePrintf("HTTP audio: %u listener(s) closed (%s), %u left", (unsigned)closed,
+                     httpAudioStats.lastCloseReason, (unsigned)httpaudio_clients());
+    }
 }
 
 // Audio streaming
@@ -1902,31 +2943,22 @@ void streamAudio(WiFiClient &client) {
     if (!isStreaming || !client.connected()) return;
 
     size_t bytesRead = 0;
+    uint32_t readStartUs = micros();
+    power_idle();   // waiting for DMA: clock may drop
     esp_err_t result = i2s_read(I2S_NUM_0, i2s_32bit_buffer,
                                 currentBufferSize * sizeof(int32_t),
                                 &bytesRead, 50 / portTICK_PERIOD_MS);
+    power_busy();
+    uint32_t readDoneUs = micros();
 
     if (result == ESP_OK && bytesRead > 0) {
         int samplesRead = bytesRead / sizeof(int32_t);
+        michealth_block(i2s_32bit_buffer, samplesRead);
+        micProbeBlock(i2s_32bit_buffer, samplesRead);
+        if (micCalStatus.state == MICCAL_RUNNING && miccal_feed(i2s_32bit_buffer, samplesRead)) calComplete();
 
-        // If HPF params changed dynamically, recompute
-        if (highpassEnabled && (hpfConfigSampleRate != currentSampleRate || hpfConfigCutoff != highpassCutoffHz)) {
-            updateHighpassCoeffs();
-        }
-
-        bool clipped = false;
-        float peakAbs = 0.0f;
-        for (int i = 0; i < samplesRead; i++) {
-            float sample = (float)(i2s_32bit_buffer[i] >> i2sShiftBits);
-            if (highpassEnabled) sample = hpf.process(sample);
-            float amplified = sample * currentGainFactor;
-            float aabs = fabsf(amplified);
-            if (aabs > peakAbs) peakAbs = aabs;
-            if (aabs > 32767.0f) clipped = true;
-            if (amplified > 32767.0f) amplified = 32767.0f;
-            if (amplified < -32768.0f) amplified = -32768.0f;
-            i2s_16bit_buffer[i] = (int16_t)amplified;
-        }
+        float peakAbs = processAudioBlock(i2s_32bit_buffer, i2s_16bit_buffer, samplesRead);
+        bool clipped = peakAbs > 32767.0f;
         // Update metering after processing the block
         if (peakAbs > 32767.0f) peakAbs = 32767.0f;
         lastPeakAbs16 = (uint16_t)peakAbs;
@@ -1941,8 +2973,251 @@ void streamAudio(WiFiClient &client) {
             peakHoldAbs16 = 0;
         }
 
-        sendRTPPacket(client, i2s_16bit_buffer, samplesRead);
+        feedHttpAudio(i2s_16bit_buffer, samplesRead);
+        if (sendRTPPacket(client, i2s_16bit_buffer, samplesRead)) {
+            audioLatencyRecordBlock(readStartUs, readDoneUs, samplesRead);
+            if (bootFirstPacketMs == 0) {
+                bootFirstPacketMs = millis();
+                simplePrintf("Time to first packet: %lu ms (Wi-Fi %lu ms, I2S %lu ms%s)",
+                             (unsigned long)bootFirstPacketMs, (unsigned long)bootWifiMs,
+                             (unsigned long)bootI2sReadyMs, bootFastResume ? ", fast resume" : "");
+                runDeferredInit("first RTP packet");
+            }
+        }
+    }
+}
+
+// Self-benchmark (AudioBench.h): the generator stands in for i2s_read(), the rest is the
+// streaming path. Runs from loop() in slices of BENCH_SLICE_MS while no stream is active.
+static const uint32_t BENCH_SINK_TIMEOUT_MS = 1000UL;   // unpaced writes may wait on the link
+static WiFiServer benchLoopbackServer(BENCH_LOOPBACK_PORT);
+static WiFiClient benchSinkClient;
+static WiFiClient benchPeer;
+static bool benchCaseStarted = false;
+static uint32_t benchCaseStartMs = 0;
+static uint16_t benchRtpSeq = 0;
+static uint32_t benchRtpTs = 0;
+
+static void benchCloseSink() {
+    if (benchSinkClient) benchSinkClient.stop();
+    if (benchPeer) benchPeer.stop();
+    benchLoopbackServer.stop();
+}
+
+// Reads back what the loopback sink sent; returns the cycles spent.
+static uint32_t benchDrainPeer() {
+    if (!benchPeer) return 0;
+    uint32_t t0 = ESP.getCycleCount();
+    uint8_t scratch[512];
+    while (benchPeer.available() > 0) {
+        if (benchPeer.read(scratch, sizeof(scratch)) <= 0) break;
+    }
+    return ESP.getCycleCount() - t0;
+}
+
+// writeAll() with a longer timeout, draining the loopback peer whenever the socket is full.
+static bool benchSinkWrite(const uint8_t *data, size_t len, uint32_t &peerCycles) {
+    size_t off = 0;
+    unsigned long startMs = millis();
+    while (off < len) {
+        if (!benchSinkClient.connected()) return false;
+        size_t chunk = len - off;
+        int avail = benchSinkClient.availableForWrite();
+        if (avail > 0 && (size_t)avail < chunk) chunk = (size_t)avail;
+        int w = benchSinkClient.write(data + off, chunk);
+        if (w > 0) {
+            off += (size_t)w;
+            continue;
+        }
+        if (millis() - startMs > BENCH_SINK_TIMEOUT_MS) return false;
+        uint32_t drained = benchDrainPeer();
+        peerCycles += drained;
+        if (!benchPeer) delay(1);
+    }
+    return true;
+}
+
+static bool benchOpenSink(BenchSink sink, const String &host, uint16_t port) {
+    if (sink == BENCH_SINK_LOOPBACK) {
+        benchLoopbackServer.begin();
+        if (!benchSinkClient.connect(IPAddress(127, 0, 0, 1), BENCH_LOOPBACK_PORT, 1000)) return false;
+        unsigned long t0 = millis();
+        while (!benchPeer && millis() - t0 < 500) {
+            benchPeer = benchLoopbackServer.accept();
+            if (!benchPeer) delay(1);
+        }
+        return (bool)benchPeer;
+    }
+    if (sink == BENCH_SINK_TCP) {
+        return benchSinkClient.connect(host.c_str(), port, 3000) != 0;
+    }
+    return true;
+}
+
+void benchStop(BenchState state, const char *error) {
+    if (benchStatus.state != BENCH_RUNNING) return;
+    benchCloseSink();
+    filterchain_reset();
+    updateAgcConfig();      // drop what the loop learned from the synthetic signal
+    benchCaseStarted = false;
+    power_holdMax(false);
+    bench_finish(state, error, millis());
+    simplePrintf("Benchmark %s%s%s", state == BENCH_DONE ? "finished" : "stopped", error ? ": " : "",
+                 error ? error : "");
+}
+
+bool benchStart(BenchSignal signal, BenchSink sink, const String &host, uint16_t port, uint16_t caseMs,
+                const char *&error) {
+    if (benchStatus.state == BENCH_RUNNING) { error = "busy"; return false; }
+    if (micCalStatus.state == MICCAL_RUNNING) { error = "calibrating"; return false; }
+    if (isStreaming) { error = "streaming"; return false; }
+    benchCloseSink();
+    if (!benchOpenSink(sink, host, port)) {
+        benchCloseSink();
+        error = "sink_connect_failed";
+        return false;
+    }
+    if (sink == BENCH_SINK_TCP) benchSinkClient.setNoDelay(true);
+    power_holdMax(true);     // before bench_plan() records the clock
+    bench_plan(signal, sink, caseMs, AUDIO_MAX_BUFFER_SAMPLES, millis());
+    benchCaseStarted = false;
+    // No I2S capture while the bench runs: end the HTTP audio streams instead of starving them.
+    uint8_t listeners = httpaudio_clients();
+    if (listeners) {
+        httpaudio_closeAll("bench_running");
+        simplePrintf("HTTP audio: %u listener(s) closed (bench_running)", (unsigned)listeners);
+    }
+    simplePrintf("Benchmark started: %s -> %s, %u cases x %u ms", bench_signalName(signal), bench_sinkName(sink),
+                 (unsigned)benchStatus.caseCount, (unsigned)caseMs);
+    return true;
+}
+
+static void benchStep() {
+    BenchStatus &b = benchStatus;
+    if (isStreaming) {
+        benchStop(BENCH_FAILED, "stream_started");
+        return;
+    }
+    BenchCase &c = b.cases[b.current];
+    if (!benchCaseStarted) {
+        benchCaseStarted = true;
+        benchCaseStartMs = millis();
+        bench_genBegin((BenchSignal)b.signal, currentSampleRate);
+        filterchain_reset();
+        agc_reset();
+        benchRtpSeq = 0;
+        benchRtpTs = 0;
+    }
+
+    unsigned long sliceStartMs = millis();
+    do {
+        uint32_t cyc[BENCH_STAGE_COUNT] = {0};
+        uint8_t hdr[16];
+        uint32_t t0 = ESP.getCycleCount();
+        bench_genFill(i2s_32bit_buffer, c.buffer);
+        uint32_t t1 = ESP.getCycleCount();
+        processAudioBlock(i2s_32bit_buffer, i2s_16bit_buffer, c.buffer);
+        uint32_t t2 = ESP.getCycleCount();
+        rtpBuildPacket(hdr, i2s_16bit_buffer, c.buffer, benchRtpSeq++, benchRtpTs);
+        benchRtpTs += c.buffer;
+        uint32_t t3 = ESP.getCycleCount();
+        bool ok = true;
+        if (c.sink != BENCH_SINK_NULL) {
+            ok = benchSinkWrite(hdr, 4, cyc[BENCH_STAGE_PEER]) &&
+                 benchSinkWrite(hdr + 4, 12, cyc[BENCH_STAGE_PEER]) &&
+                 benchSinkWrite((const uint8_t *)i2s_16bit_buffer, c.buffer * sizeof(int16_t), cyc[BENCH_STAGE_PEER]);
+        }
+        uint32_t t4 = ESP.getCycleCount();
+        cyc[BENCH_STAGE_GEN] = t1 - t0;
+        cyc[BENCH_STAGE_DSP] = t2 - t1;
+        cyc[BENCH_STAGE_PACK] = t3 - t2;
+        cyc[BENCH_STAGE_SINK] = (t4 - t3) - cyc[BENCH_STAGE_PEER];
+        if (c.sink == BENCH_SINK_LOOPBACK) cyc[BENCH_STAGE_PEER] += benchDrainPeer();
+        if (!ok) {
+            c.sinkErrors++;
+            c.runMs = millis() - benchCaseStartMs;
+            benchStop(BENCH_FAILED, "sink_write_failed");
+            return;
+        }
+        bench_record(c, c.buffer, cyc);
+    } while (millis() - sliceStartMs < BENCH_SLICE_MS);
+
+    c.runMs = millis() - benchCaseStartMs;
+    if (c.runMs < b.caseMs) return;
+    benchCaseStarted = false;
+    if (++b.current >= b.caseCount) benchStop(BENCH_DONE, nullptr);
+}
+
+// Level calibration (MicCalibration.h): fed from streamAudio() while streaming, otherwise
+// from calStep() in loop(), one I2S block per iteration.
+bool calStart(bool apply, uint8_t marginDb, uint16_t seconds, bool boot, const char *&error) {
+    if (micCalStatus.state == MICCAL_RUNNING) { error = "busy"; return false; }
+    if (benchStatus.state == BENCH_RUNNING) { error = "bench_running"; return false; }
+    miccal_begin(currentSampleRate, seconds, marginDb, highpassEnabled, apply, boot, i2sShiftBits,
+                 currentGainFactor, millis());
+    simplePrintf("Calibration started%s: %u s, margin %u dB%s", boot ? " (boot)" : "", (unsigned)seconds,
+                 (unsigned)marginDb, apply ? ", apply" : "");
+    return true;
+}
+
+static void calComplete() {
+    MicCalStatus &c = micCalStatus;
+    miccal_finish(millis());
+    if (c.state != MICCAL_DONE) {
+        simplePrintf("Calibration failed: %s", c.error ? c.error : "unknown");
+        return;
     }
+    if (c.apply && (c.shift != i2sShiftBits || fabsf(c.gain - currentGainFactor) >= 0.01f)) {
+        i2sShiftBits = c.shift;
+        currentGainFactor = c.gain;
+        c.applied = true;
+        updateAgcConfig();
+        saveAudioSettings();
+    }
+    simplePrintf("Calibration: peak %.1f dBFS, noise %.1f dBFS, DC %ld -> shift %u, gain %.2f (now %u, %.2f)%s%s",
+                 c.acPeak ? c.acPeakDbfs : c.peakDbfs, c.noiseDbfs, (long)c.dcOffset, (unsigned)c.shift, c.gain,
+                 (unsigned)c.prevShift, c.prevGain, c.noiseBelowLsb ? ", noise floor under 1 LSB" : "",
+                 c.applied ? ", applied" : "");
+}
+
+static void calStep() {
+    size_t bytesRead = 0;
+    esp_err_t result = i2s_read(I2S_NUM_0, i2s_32bit_buffer, currentBufferSize * sizeof(int32_t),
+                                &bytesRead, 50 / portTICK_PERIOD_MS);
+    if (result != ESP_OK) {
+        miccal_abort("i2s_read_failed", millis());
+        simplePrintf("Calibration failed: i2s_read_failed");
+        return;
+    }
+    if (!bytesRead) return;
+    int samples = bytesRead / sizeof(int32_t);
+    michealth_block(i2s_32bit_buffer, samples);
+    micProbeBlock(i2s_32bit_buffer, samples);
+    bool done = miccal_feed(i2s_32bit_buffer, samples);
+    // HTTP listeners keep their audio; processing overwrites the raw block, so it comes after.
+    if (httpaudio_clients() > 0) {
+        processAudioBlock(i2s_32bit_buffer, i2s_16bit_buffer, samples);
+        feedHttpAudio(i2s_16bit_buffer, samples);
+    }
+    if (done) calComplete();
+}
+
+// One I2S block per loop iteration while no RTSP client streams, for the store-and-forward
+// recorder and/or HTTP audio listeners. Processed like the stream (filters, gain/AGC) so both
+// get what BirdNET-Go would get.
+static void idleCaptureStep(bool record) {
+    size_t bytesRead = 0;
+    esp_err_t result = i2s_read(I2S_NUM_0, i2s_32bit_buffer, currentBufferSize * sizeof(int32_t),
+                                &bytesRead, 50 / portTICK_PERIOD_MS);
+    if (result != ESP_OK || bytesRead == 0) return;
+    int samples = bytesRead / sizeof(int32_t);
+    michealth_block(i2s_32bit_buffer, samples);
+    micProbeBlock(i2s_32bit_buffer, samples);
+    processAudioBlock(i2s_32bit_buffer, i2s_16bit_buffer, samples);
+    feedHttpAudio(i2s_16bit_buffer, samples);
+    if (!record) return;
+    uint32_t epoch = hasValidTime() ? (uint32_t)time(nullptr) : 0;
+    recorder_feed(i2s_16bit_buffer, samples, currentSampleRate, epoch, millis());
 }
 
 // RTSP handling
@@ -1998,9 +3273,12 @@ void handleRTSPCommand(WiFiClient &client, String request) {
         client.print("Range: npt=0.000-\r\n\r\n");
 
         isStreaming = true;
+        audioLatencyRestart();
+        agc_reset();
         rtpSequence = 0;
         rtpTimestamp = 0;
         audioPacketsSent = 0;
+        audioSamplesSent = 0;
         lastStatsReset = millis();
         lastRtspPlayMs = millis();
         rtspPlayCount++;
@@ -2018,7 +3296,7 @@ void handleRTSPCommand(WiFiClient &client, String request) {
         isStreaming = false;
         lastStreamStopReason = "RTSP TEARDOWN";
         lastStreamStopMs = millis();
-        simplePrintln("STREAMING STOPPED (" + lastStreamStopReason + ")");
+        simplePrintf("STREAMING STOPPED (%s)", lastStreamStopReason.c_str());
         mqttPublishState(true);
     } else if (request.startsWith("GET_PARAMETER")) {
         // Many RTSP clients send GET_PARAMETER as keep-alive.
@@ -2027,7 +3305,7 @@ void handleRTSPCommand(WiFiClient &client, String request) {
     } else {
         client.print("RTSP/1.0 501 Not Implemented\r\n");
         client.print("CSeq: " + cseq + "\r\n\r\n");
-        simplePrintln("RTSP unsupported command: " + lastRtspCommand);
+        simplePrintf("RTSP unsupported command: %s", lastRtspCommand.c_str());
     }
 }
 
@@ -2081,9 +3359,116 @@ void processRTSP(WiFiClient &client) {
 
 // Web UI is a separate module (WebUI.*)
 
+// ---- loop() housekeeping jobs ----
+
+static void jobTemperature() {
+    PROFILE_SECTION(PROF_TEMPERATURE);
+    checkTemperature();
+}
+
+static void jobHeap() {
+    PROFILE_SECTION(PROF_HEAP);
+    uint32_t currentHeap = ESP.getFreeHeap();
+    if (currentHeap < minFreeHeap) minFreeHeap = currentHeap;
+    heapmon_sample(millis());
+    checkHeapFragmentation();
+}
+
+static void jobPerformance() {
+    PROFILE_SECTION(PROF_PERFORMANCE);
+    checkPerformance();
+}
+
+static void jobWiFiHealth() {
+    PROFILE_SECTION(PROF_WIFI_HEALTH);
+    checkWiFiHealth(); // without TX power log spam
+}
+
+static void jobTimeSync() {
+    PROFILE_SECTION(PROF_TIME_SYNC);
+    checkTimeSync();
+}
+
+static void jobSchedule() {
+    PROFILE_SECTION(PROF_SCHEDULE);
+    checkStreamSchedule();
+    checkDeepSleepSchedule();
+}
+
+static void jobScheduledReset() {
+    PROFILE_SECTION(PROF_SCHEDULED_RESET);
+    checkScheduledReset();
+}
+
+static void jobMqtt() {
+    PROFILE_SECTION(PROF_MQTT);
+    HEAP_SCOPE(HEAP_SYS_MQTT);
+    checkMqtt();
+}
+
+static void jobStreamWatchdog() {
+    PROFILE_SECTION(PROF_STREAM_WATCHDOG);
+    checkStreamWatchdog();
+    checkMicHealth();
+}
+
+static void jobPower() {
+    PROFILE_SECTION(PROF_POWER);
+    power_sample(millis(), isStreaming);
+}
+
+static void jobTaskStats() {
+    PROFILE_SECTION(PROF_TASK_STATS);
+    taskstats_sample(millis());
+}
+
+static void jobNvsSave() {
+    PROFILE_SECTION(PROF_NVS_SAVE);
+    if (prefstore_due(millis())) flushSettingsNow();
+}
+
+static void jobLogJournal() {
+    PROFILE_SECTION(PROF_LOG_JOURNAL);
+    HEAP_SCOPE(HEAP_SYS_LOG);
+    logjournal_tick();
+}
+
+// More than half a block was already waiting in the DMA ring when it was read: the loop is
+// behind the audio clock, so non-urgent housekeeping waits.
+static bool audioBacklogHigh() {
+    if (!isStreaming) return false;
+    uint32_t halfBlockUs = (uint32_t)(((uint64_t)currentBufferSize * 500000ULL) / currentSampleRate);
+    return audioLastQueueUs > halfBlockUs;
+}
+
+// Periods match the old polling chain; first runs are staggered so jobs with equal periods
+// do not fall due in the same iteration.
+static void setupLoopJobs() {
+    uint32_t now = millis();
+    loopJobs.setIterationBudgetUs(LOOP_JOB_BUDGET_US);
+    //                name               fn                  period    priority         budget us  max defer  first run
+    loopJobs.add("schedule",        jobSchedule,        1000,     JOB_NORMAL,      500,  2000,  now, 1000);
+    loopJobs.add("mqtt",            jobMqtt,            100,      JOB_NORMAL,      300,  1000,  now, 100);
+    loopJobs.add("time_sync",       jobTimeSync,        1000,     JOB_BACKGROUND,  200,  10000, now, 1050);
+    loopJobs.add("scheduled_reset", jobScheduledReset,  1000,     JOB_BACKGROUND,  50,   10000, now, 1100);
+    loopJobs.add("log_journal",     jobLogJournal,      1000,     JOB_BACKGROUND,  50,   5000,  now, 1150);
+    loopJobs.add("stream_watchdog", jobStreamWatchdog,  1000,     JOB_URGENT,      100,  0,     now, 1200);
+    loopJobs.add("power",           jobPower,           1000,     JOB_BACKGROUND,  50,   1000,  now, 1250);
+    loopJobs.add("nvs_save",        jobNvsSave,         500,      JOB_BACKGROUND,  20000, 5000, now, 1300);
+    loopJobs.add("temperature",     jobTemperature,     60000,    JOB_URGENT,      500,  0,     now, 60000);
+    loopJobs.add("heap",            jobHeap,            30000,    JOB_BACKGROUND,  50,   30000, now, 30000);
+    loopJobs.add("task_stats",      jobTaskStats,       TASK_STATS_INTERVAL_MS, JOB_BACKGROUND, 1000, 10000, now, TASK_STATS_INTERVAL_MS + 500);
+    loopJobs.add("wifi_health",     jobWiFiHealth,      30000,    JOB_NORMAL,      1000, 10000, now, 30250);
+    jobPerformanceIntervalMin = performanceCheckInterval;
+    jobPerformanceId = loopJobs.add("performance", jobPerformance, performanceCheckInterval * 60000UL,
+                                    JOB_NORMAL, 2000, 60000, now, performanceCheckInterval * 60000UL);
+}
+
 void setup() {
     Serial.begin(115200);
     delay(100);
+    heapmon_begin();
+    taskstats_begin();
 
     // (4) seed for random(): combination of time and unique MAC
     randomSeed((uint32_t)micros() ^ (uint32_t)(ESP.getEfuseMac() & 0xFFFFFFFF));
@@ -2094,6 +3479,23 @@ void setup() {
     preloadTimeSettingsForEarlyLogs();
     loadBootMetadata();
     simplePrintln("Boot reason: " + rebootReason + ", restart #" + String(restartCounter));
+    if (logjournal_begin()) {
+        LogJournalStats js;
+        logjournal_getStats(js);
+        simplePrintln("Log journal: " + String(js.textBytes) + " bytes on flash" +
+                      (js.tornRecovered ? ", recovered torn write" : ""));
+    } else {
+        simplePrintln("Log journal: LittleFS unavailable, persistent log disabled");
+    }
+    if (recorder_begin()) {
+        RecorderStats rs;
+        recorder_getStats(rs);
+        simplePrintln("Recorder: " + String(rs.segments) + " segments, " + String((uint32_t)(rs.bytes / 1024)) +
+                      " KB on " + (rs.sdCard ? "SD" : "LittleFS") +
+                      (rs.segmentsRepaired ? ", repaired " + String(rs.segmentsRepaired) : String("")));
+    } else {
+        simplePrintln("Recorder: storage unavailable, store-and-forward disabled");
+    }
 
     // Enable external antenna (for XIAO ESP32-C6).
     // NOTE: If you are using a board without the RF switch (or no external antenna), comment out or remove this block.
@@ -2107,28 +3509,48 @@ void setup() {
     // Load settings from flash
     loadAudioSettings();
 
-    // Allocate buffers with current size
-    i2s_32bit_buffer = (int32_t*)malloc(currentBufferSize * sizeof(int32_t));
-    i2s_16bit_buffer = (int16_t*)malloc(currentBufferSize * sizeof(int16_t));
-    if (!i2s_32bit_buffer || !i2s_16bit_buffer) {
-        simplePrintln("FATAL: Memory allocation failed!");
-        ESP.restart();
+    // Audio buffers: fixed views of the static arena, valid for every buffer size
+    i2s_32bit_buffer = (int32_t*)audioarena_region(ARENA_CAPTURE);
+    i2s_16bit_buffer = (int16_t*)audioarena_region(ARENA_CAPTURE);
+    String arenaLayout;
+    for (uint8_t r = 0; r < ARENA_REGION_COUNT; r++) {
+        if (r) arenaLayout += ", ";
+        arenaLayout += String(audioarena_regionName((AudioArenaRegion)r)) + " " +
+                       String(audioarena_regionBytes((AudioArenaRegion)r));
     }
+    simplePrintln("Audio arena: " + String(audioarena_totalBytes()) + " B static (" + arenaLayout + " B, max " +
+                  String(AUDIO_MAX_BUFFER_SAMPLES) + " samples)");
 
     // WiFi optimization for stable streaming
     WiFi.setSleep(false);
 
-    WiFiManager wm;
-    wm.setConnectTimeout(60);
-    wm.setConfigPortalTimeout(180);
-    if (!wm.autoConnect("ESP32-RTSP-Mic-AP")) {
-        simplePrintln("WiFi failed, restarting...");
+    // I2S comes up while Wi-Fi associates: inside the fast resume, or before WiFiManager.
+    bootFastResume = fastWifiResume();
+    if (!bootFastResume) {
+        if (setup_i2s_driver()) bootI2sReadyMs = millis();
+        WiFiManager wm;
+        wm.setConnectTimeout(60);
+        wm.setConfigPortalTimeout(180);
+        if (!wm.autoConnect("ESP32-RTSP-Mic-AP")) {
+            simplePrintln("WiFi failed, restarting...");
+            prepareForReset();
+            ESP.restart();
+        }
+    }
+    bootWifiMs = millis();
+    if (bootI2sReadyMs == 0) {
+        simplePrintln("FATAL: I2S setup failed!");
+        prepareForReset();
         ESP.restart();
     }
 
-    simplePrintln("WiFi connected: " + WiFi.localIP().toString());
+    simplePrintln("WiFi connected: " + WiFi.localIP().toString() + " after " + String(bootWifiMs) + " ms" +
+                  (bootFastResume ? String(" (fast resume, ch ") + String(rtcWifiChannel) +
+                                        (bootCachedLease ? ", cached lease)" : ", DHCP)")
+                                  : String("")));
     logConnectedAp("initial");
     clearStoredBssidPin();
+    cacheWifiForResume();
 
     // Apply configured WiFi TX power after connect (logs once on change)
     applyWifiTxPower(true);
@@ -2137,15 +3559,15 @@ void setup() {
     if (timeSyncEnabled) {
         attemptTimeSync(false);
     }
-    applyMdnsSetting();
     logDeepSleepWakeSnapshotIfAny();
-
-    setupOTA();
-    if (!setup_i2s_driver()) {
-        simplePrintln("FATAL: I2S setup failed!");
-        ESP.restart();
-    }
+    // mDNS, OTA and MQTT start in runDeferredInit() once the first RTP packet is out.
     updateHighpassCoeffs();
+    updateAgcConfig();
+    updateRecorderConfig();
+    if (calBootMode != MICCAL_BOOT_OFF) {
+        const char *calErr = nullptr;
+        calStart(calBootMode == MICCAL_BOOT_APPLY, calMarginDb, CAL_DEFAULT_SECONDS, true, calErr);
+    }
 
     if (!overheatLatched) {
         rtspServer.begin();
@@ -2164,13 +3586,9 @@ void setup() {
     }
     // Web UI
     webui_begin();
-    mqttRequestReconnect(true);
 
     lastStatsReset = millis();
     lastRTSPActivity = millis();
-    lastMemoryCheck = millis();
-    lastPerformanceCheck = millis();
-    lastWiFiCheck = millis();
     minFreeHeap = ESP.getFreeHeap();
     float initialTemp = temperatureRead();
     if (isTemperatureValid(initialTemp)) {
@@ -2191,8 +3609,7 @@ void setup() {
         simplePrintln("WARNING: Temperature sensor unavailable at startup. Thermal protection paused.");
     }
 
-    setCpuFrequencyMhz(cpuFrequencyMhz);
-    simplePrintln("CPU frequency set to " + String(cpuFrequencyMhz) + " MHz for optimal thermal/performance balance");
+    applyPowerProfile();
 
     if (!overheatLatched && rtspServerEnabled) {
         simplePrintln("RTSP server ready on port 8554");
@@ -2215,106 +3632,103 @@ void setup() {
     } else {
         simplePrintln("MQTT: disabled");
     }
+    setupLoopJobs();
+    setupDoneMs = millis();
+    profiler_begin();   // loop() timing starts clean after the (slow) setup
 }
 
 void loop() {
-    ArduinoOTA.handle();
-
-    webui_handleClient();
-
-    if (millis() - lastTempCheck > 60000) { // 1 min
-        checkTemperature();
-        lastTempCheck = millis();
-    }
-
-    if (millis() - lastMemoryCheck > 30000) { // 30 s
-        uint32_t currentHeap = ESP.getFreeHeap();
-        if (currentHeap < minFreeHeap) minFreeHeap = currentHeap;
-        lastMemoryCheck = millis();
-    }
-
-    if (millis() - lastPerformanceCheck > (performanceCheckInterval * 60000UL)) {
-        checkPerformance();
-        lastPerformanceCheck = millis();
+    power_yield(isStreaming);   // idle between iterations, kept out of the PROF_LOOP timing
+    PROFILE_SECTION(PROF_LOOP);
+    power_busy();
+    if (otaStarted) {
+        PROFILE_SECTION(PROF_OTA);
+        ArduinoOTA.handle();
+    } else if (millis() - setupDoneMs >= DEFERRED_INIT_TIMEOUT_MS) {
+        runDeferredInit("timeout");
     }
-
-    if (millis() - lastWiFiCheck > 30000) { // 30 s
-        checkWiFiHealth(); // without TX power log spam
-        lastWiFiCheck = millis();
+    {
+        PROFILE_SECTION(PROF_WEBUI);
+        HEAP_SCOPE(HEAP_SYS_WEB);
+        webui_handleClient();
     }
 
-    checkTimeSync();
-    if (millis() - lastStreamScheduleCheck > 1000UL) {
-        checkStreamSchedule();
-        checkDeepSleepSchedule();
-        lastStreamScheduleCheck = millis();
+    // Periodic housekeeping (temperature, heap, performance, Wi-Fi, schedules, MQTT, ...)
+    if (jobPerformanceIntervalMin != performanceCheckInterval) {
+        jobPerformanceIntervalMin = performanceCheckInterval;
+        loopJobs.setPeriod(jobPerformanceId, performanceCheckInterval * 60000UL);
     }
-
-    checkScheduledReset();
-    checkMqtt();
+    loopJobs.runDue(millis(), audioBacklogHigh());
 
     // RTSP client management
     if (rtspServerEnabled) {
-        if (rtspClient && !rtspClient.connected()) {
-            String diag = buildRtspDiag(rtspClient);
-            bool wasStreaming = isStreaming;
-            bool newDisconnectEvent = false;
-            rtspClient.stop();
-            isStreaming = false;
-            if (lastStreamStopMs == 0) {
-                lastStreamStopReason = "TCP client disconnected";
-                lastStreamStopMs = millis();
-                newDisconnectEvent = true;
-            }
-            simplePrintln("RTSP client disconnected | " + diag);
-            if (newDisconnectEvent || wasStreaming) mqttPublishState(true);
-        }
-
-        // Timeout for RTSP clients (30 seconds of inactivity)
-        if (rtspClient && rtspClient.connected() && !isStreaming) {
-            if (millis() - lastRTSPActivity > 30000) {
+        {
+            PROFILE_SECTION(PROF_RTSP);
+            HEAP_SCOPE(HEAP_SYS_RTSP);
+            if (rtspClient && !rtspClient.connected()) {
                 String diag = buildRtspDiag(rtspClient);
+                bool wasStreaming = isStreaming;
+                bool newDisconnectEvent = false;
                 rtspClient.stop();
+                isStreaming = false;
                 if (lastStreamStopMs == 0) {
-                    lastStreamStopReason = "RTSP inactivity timeout";
+                    lastStreamStopReason = "TCP client disconnected";
                     lastStreamStopMs = millis();
+                    newDisconnectEvent = true;
                 }
-                simplePrintln("RTSP client timeout - disconnected | " + diag + ", writeFails=" + String(rtspWriteFailCount));
-                mqttPublishState(true);
+                simplePrintf("RTSP client disconnected | %s", diag.c_str());
+                if (newDisconnectEvent || wasStreaming) mqttPublishState(true);
             }
-        }
 
-        if (!rtspClient || !rtspClient.connected()) {
-            WiFiClient newClient = rtspServer.accept();
-            if (newClient) {
-                rtspClient = newClient;
-                rtspClient.setNoDelay(true);
-                rtspParseBufferPos = 0;
-                rtspParseBuffer[0] = '\0';
-                lastRTSPActivity = millis();
-                lastRtspClientConnectMs = millis();
-                rtspConnectCount++;
-                lastRtspCommand = "none";
-                lastRtspCommandMs = 0;
-                streamStartedAtMs = 0;
-                lastRtpPacketMs = 0;
-                lastStreamStopReason = "none";
-                lastStreamStopMs = 0;
-                lastRtspClientIp = rtspClient.remoteIP().toString();
-                simplePrintln("New RTSP client connected from: " + rtspClient.remoteIP().toString());
-                mqttPublishState(true);
+            // Timeout for RTSP clients (30 seconds of inactivity)
+            if (rtspClient && rtspClient.connected() && !isStreaming) {
+                if (millis() - lastRTSPActivity > 30000) {
+                    String diag = buildRtspDiag(rtspClient);
+                    rtspClient.stop();
+                    if (lastStreamStopMs == 0) {
+                        lastStreamStopReason = "RTSP inactivity timeout";
+                        lastStreamStopMs = millis();
+                    }
+                    simplePrintf("RTSP client timeout - disconnected | %s, writeFails=%lu", diag.c_str(),
+                                 (unsigned long)rtspWriteFailCount);
+                    mqttPublishState(true);
+                }
             }
-        }
 
-        if (rtspClient && rtspClient.connected()) {
-            if (rtspClient.available()) {
-                lastRTSPActivity = millis();
+            if (!rtspClient || !rtspClient.connected()) {
+                WiFiClient newClient = rtspServer.accept();
+                if (newClient) {
+                    rtspClient = newClient;
+                    rtspClient.setNoDelay(true);
+                    rtspParseBufferPos = 0;
+                    rtspParseBuffer[0] = '\0';
+                    lastRTSPActivity = millis();
+                    lastRtspClientConnectMs = millis();
+                    rtspConnectCount++;
+                    lastRtspCommand = "none";
+                    lastRtspCommandMs = 0;
+                    streamStartedAtMs = 0;
+                    lastRtpPacketMs = 0;
+                    lastStreamStopReason = "none";
+                    lastStreamStopMs = 0;
+                    lastRtspClientIp = rtspClient.remoteIP().toString();
+                    simplePrintf("New RTSP client connected from: %s", lastRtspClientIp.c_str());
+                    mqttPublishState(true);
+                }
             }
-            processRTSP(rtspClient);
-            if (isStreaming) {
-                streamAudio(rtspClient);
+
+            if (rtspClient && rtspClient.connected()) {
+                if (rtspClient.available()) {
+                    lastRTSPActivity = millis();
+                }
+                processRTSP(rtspClient);
             }
         }
+        if (isStreaming && rtspClient && rtspClient.connected()) {
+            PROFILE_SECTION(PROF_STREAM);
+            HEAP_SCOPE(HEAP_SYS_RTSP);
+            streamAudio(rtspClient);
+        }
     } else {
         if (rtspClient && rtspClient.connected()) {
             bool wasStreaming = isStreaming;
@@ -2323,8 +3737,22 @@ void loop() {
             if (wasStreaming) mqttPublishState(true);
         }
     }
+    if (benchStatus.state == BENCH_RUNNING) {
+        benchStep();
+    }
+    const bool idleCapture = !isStreaming && benchStatus.state != BENCH_RUNNING && micCalStatus.state != MICCAL_RUNNING;
+    const bool recordNow = recEnabled && idleCapture;
+    if (micCalStatus.state == MICCAL_RUNNING && !isStreaming) {
+        calStep();
+    } else if (recordNow || (idleCapture && httpaudio_clients() > 0)) {
+        idleCaptureStep(recordNow);
+    }
+    if (!recordNow && recorder_isRecording()) {
+        recorder_pause(0);   // a client started streaming (or a bench/calibration): close the segment
+    }
     // Handle deferred WiFi reconnect
     if (wifiReconnectAt != 0 && millis() >= wifiReconnectAt) {
+        PROFILE_SECTION(PROF_WIFI_RECONNECT);
         wifiReconnectAt = 0;
 
         bool wasStreaming = isStreaming;
@@ -2372,6 +3800,7 @@ void loop() {
                 wifiReconnectCount++;
                 clearStoredBssidPin();
                 logConnectedAp("after-reconnect");
+                cacheWifiForResume();
                 applyMdnsSetting();
                 if (timeSyncEnabled) {
                     attemptTimeSync(false);
@@ -2393,6 +3822,7 @@ void loop() {
             resetToDefaultSettings();
         }
         delay(50);
+        prepareForReset();
         ESP.restart();
     }
 }
@@ -0,0 +1,244 @@
+// Frequency-response check for the capture filter chain (FilterChain.cpp, built for the host).
+//
+//   filter_response [--rate HZ] [--hp HZ] [--tol DB] [--points N] ['<filters JSON>']
+//
+// Two checks, both by running sines through filterchain_process() block by block and measuring
+// the output level once the sections have settled:
+//   1. Design targets, per section on its own, from the spec alone (not from the coefficients):
+//      high-pass -3 dB (20*log10(q)) at the corner, 2nd-order stopband at f/10 and flat passband;
+//      notch: a null below -40 dB and -3 dB at the band edges; hum: the null at every harmonic;
+//      peak gain at f0; low-shelf gain far below f, half of it at f, flat far above.
+//      A float32 coefficient cannot place a zero exactly on f0: 2*cos(w0) is close to 2, so it
+//      moves by up to zeroResolutionHz() (0.07 Hz for 50 Hz at 48 kHz). The null is therefore
+//      searched within that distance of f0, and the level at f0 itself is held to what an ideal
+//      notch gives that far from its centre.
+//   2. The whole chain, configured exactly as the firmware does (optional high-pass plus the
+//      "filters" array), at log-spaced frequencies against the analytic response of the designed
+//      coefficients (filterchain_responseDb).
+// Without arguments it checks a default chain: --hp 100 plus a hum notch, a low shelf and a
+// peak. Exits non-zero if a target is missed, if any point of 2 is off by more than --tol dB,
+// if the chain is empty, or if the JSON is rejected (with the parser's error code).
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "FilterChain.h"
+
+static const int BLOCK = 1024;
+static const char *const DEFAULT_FILTERS =
+    "[{\"type\":\"hum\",\"f\":50,\"harmonics\":3},{\"type\":\"lowshelf\",\"f\":120,\"gain\":-6},"
+    "{\"type\":\"peak\",\"f\":2500,\"q\":2,\"gain\":-4}]";
+static const unsigned DEFAULT_HP = 100;
+
+static void usage(const char *argv0) {
+    fprintf(stderr, "usage: %s [--rate HZ] [--hp HZ] [--tol DB] [--points N] ['<filters JSON>']\n", argv0);
+}
+
+// Output level relative to the input, in dB, for a unit sine at freqHz.
+static float measureDb(float freqHz, float rate) {
+    filterchain_reset();
+    // Settle for at least 2 s and 200 periods (narrow notches ring for a while).
+    int settle = (int)fmaxf(2.0f * rate, 200.0f * rate / freqHz);
+    // ~0.5 s, rounded to whole periods so the RMS is not biased on steep slopes.
+    int measure = (int)lround(ceil(0.5 * freqHz) * rate / freqHz);
+    std::vector<float> buf(BLOCK);
+    double phase = 0.0, inc = 2.0 * M_PI * freqHz / rate;
+    double sumIn = 0.0, sumOut = 0.0;
+    int done = 0;
+    while (done < settle + measure) {
+        for (int i = 0; i < BLOCK; i++) {
+            buf[i] = (float)sin(phase);
+            phase += inc;
+            if (phase > 2.0 * M_PI) phase -= 2.0 * M_PI;
+        }
+        std::vector<float> in(buf);
+        filterchain_process(buf.data(), BLOCK);
+        for (int i = 0; i < BLOCK; i++, done++) {
+            if (done < settle || done >= settle + measure) continue;
+            sumIn += (double)in[i] * in[i];
+            sumOut += (double)buf[i] * buf[i];
+        }
+    }
+    if (sumOut < 1e-30) sumOut = 1e-30;
+    return (float)(10.0 * log10(sumOut / sumIn));
+}
+
+// ---- Design targets ----
+
+struct Target {
+    const char *what;
+    float freqHz;
+    float expectDb;
+    float tolDb;        // < 0: expectDb is an upper bound
+    float sweepHz;      // > 0: the lowest level within freqHz +- sweepHz is compared
+};
+
+// How far the zeros of a float32 notch can sit from f0: half an ulp of b1 (~2, ulp 2^-23) and
+// of b0 (~1) in cos(w0), turned into Hz.
+static float zeroResolutionHz(float f0, float rate) {
+    double w0 = 2.0 * M_PI * f0 / rate;
+    return (float)((FLT_EPSILON / 2.0) / sin(w0) * rate / (2.0 * M_PI));
+}
+
+// Analog notch prototype at w = f/f0.
+static float analogNotchDb(float w, float q) {
+    float re = 1.0f - w * w, im = w / q;
+    return 20.0f * log10f(fabsf(re) / sqrtf(re * re + im * im));
+}
+
+static void addNullTargets(float f0, float q, float rate, std::vector<Target> &t) {
+    float res = zeroResolutionHz(f0, rate);
+    t.push_back({"null within the float32 zero resolution", f0, -40.0f, -1.0f, 2.0f * res});
+    // Capped at -60 dB, where the measurement meets the float noise floor.
+    float atF0 = fmaxf(analogNotchDb(1.0f + res / f0, q) + 0.5f, -60.0f);
+    t.push_back({"level at f0 (null up to that far off)", f0, atF0, -1.0f, 0.0f});
+}
+
+// Analog 2nd-order high-pass prototype, the reference for the stopband slope.
+static float analogHighpassDb(float w, float q) {
+    float re = 1.0f - w * w, im = w / q;
+    return 20.0f * log10f(w * w / sqrtf(re * re + im * im));
+}
+
+static void addTargets(const FilterSpec &s, float rate, std::vector<Target> &t) {
+    const float nyqLimit = 0.4f * rate;
+    const float f = s.freqHz;
+    switch (s.type) {
+        case FILTER_HP:
+            t.push_back({"corner: 20*log10(q) (-3 dB at q 0.707)", f, 20.0f * log10f(s.q), 0.2f, 0.0f});
+            t.push_back({"stopband f/10: 2nd order (-40 dB at q 0.707)", f / 10.0f, analogHighpassDb(0.1f, s.q), 0.5f, 0.0f});
+            if (10.0f * f < nyqLimit) t.push_back({"passband 10 f: flat", 10.0f * f, 0.0f, 0.2f, 0.0f});
+            break;
+        case FILTER_NOTCH: {
+            // -3 dB edges of a notch of bandwidth f0/q, geometric around f0.
+            float h = 1.0f / (2.0f * s.q), k = sqrtf(1.0f + h * h);
+            addNullTargets(f, s.q, rate, t);
+            t.push_back({"upper band edge: -3 dB", f * (k + h), -3.01f, 0.3f, 0.0f});
+            t.push_back({"lower band edge: -3 dB", f * (k - h), -3.01f, 0.3f, 0.0f});
+            if (f / 4.0f >= 5.0f) t.push_back({"passband f0/4: flat", f / 4.0f, 0.0f, 0.2f, 0.0f});
+            break;
+        }
+        case FILTER_HUM:
+            for (uint8_t k = 1; k <= s.harmonics && k * f < 0.45f * rate; k++) {
+                addNullTargets(k * f, s.q, rate, t);
+                t.push_back({"between harmonics: flat", (k + 0.5f) * f, 0.0f, 0.3f, 0.0f});
+            }
+            break;
+        case FILTER_PEAK:
+            t.push_back({"gain at f0", f, s.gainDb, 0.1f, 0.0f});
+            if (f / 20.0f >= 5.0f) t.push_back({"flat at f0/20", f / 20.0f, 0.0f, 0.3f, 0.0f});
+            if (20.0f * f < nyqLimit) t.push_back({"flat at 20 f0", 20.0f * f, 0.0f, 0.3f, 0.0f});
+            break;
+        case FILTER_LOWSHELF:
+            t.push_back({"shelf gain at f/20", fmaxf(f / 20.0f, 2.0f), s.gainDb, 0.3f, 0.0f});
+            t.push_back({"half the shelf gain at f", f, s.gainDb / 2.0f, 0.2f, 0.0f});
+            t.push_back({"flat at 20 f", fminf(20.0f * f, nyqLimit), 0.0f, 0.3f, 0.0f});
+            break;
+    }
+}
+
+// Configures one section on its own and checks its targets. Returns the number missed.
+static int checkTargets(const char *name, unsigned hp, const FilterSpec *spec, float rate) {
+    std::vector<Target> targets;
+    if (spec) {
+        addTargets(*spec, rate, targets);
+        filterchain_configure(0, spec, 1, rate);
+    } else {
+        FilterSpec h = {FILTER_HP, 0, (float)hp, 0.70710678f, 0.0f};
+        addTargets(h, rate, targets);
+        filterchain_configure((uint16_t)hp, nullptr, 0, rate);
+    }
+    int bad = 0;
+    printf("%s\n", name);
+    for (const Target &t : targets) {
+        float meas = measureDb(t.freqHz, rate);
+        for (int i = -40; t.sweepHz > 0.0f && i <= 40; i++) {
+            meas = fminf(meas, measureDb(t.freqHz + t.sweepHz * (float)i / 40.0f, rate));
+        }
+        bool ok = t.tolDb < 0 ? meas <= t.expectDb : fabsf(meas - t.expectDb) <= t.tolDb;
+        if (!ok) bad++;
+        char want[32];
+        if (t.tolDb < 0) snprintf(want, sizeof(want), "<= %.1f", t.expectDb);
+        else snprintf(want, sizeof(want), "%.2f +-%.2f", t.expectDb, t.tolDb);
+        printf("  %-46s %9.1f Hz  want %-14s got %8.2f dB%s\n", t.what, t.freqHz, want, meas, ok ? "" : "  FAIL");
+    }
+    return bad;
+}
+
+int main(int argc, char **argv) {
+    float rate = 48000.0f;
+    unsigned hp = 0;
+    float tol = 0.1f;
+    int points = 40;
+    const char *json = nullptr;
+    bool hpGiven = false;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--rate") && i + 1 < argc) rate = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--hp") && i + 1 < argc) { hp = (unsigned)atoi(argv[++i]); hpGiven = true; }
+        else if (!strcmp(argv[i], "--tol") && i + 1 < argc) tol = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--points") && i + 1 < argc) points = atoi(argv[++i]);
+        else if (argv[i][0] == '-') { usage(argv[0]); return 2; }
+        else json = argv[i];
+    }
+    if (rate < 8000.0f || points < 2) { usage(argv[0]); return 2; }
+    if (!json && !hpGiven) {
+        json = DEFAULT_FILTERS;
+        hp = DEFAULT_HP;
+        printf("no chain given, checking the default: --hp %u '%s'\n", hp, json);
+    }
+    if (!json) json = "[]";
+
+    FilterSpec specs[FILTER_CHAIN_MAX_SECTIONS];
+    uint8_t count = 0;
+    const char *err = nullptr;
+    if (!filterchain_parse(String(json), specs, count, err)) {
+        fprintf(stderr, "filters rejected: %s\n", err);
+        return 1;
+    }
+    if (!hp && count == 0) {
+        fprintf(stderr, "empty chain, nothing to check\n");
+        return 2;
+    }
+
+    int missed = 0;
+    printf("design targets, %.0f Hz\n", rate);
+    if (hp) missed += checkTargets("hp (hp_cutoff)", hp, nullptr, rate);
+    for (uint8_t i = 0; i < count; i++) {
+        String name = String(filterchain_typeName(specs[i].type)) + " " + filterchain_toJson(&specs[i], 1);
+        missed += checkTargets(name.c_str(), 0, &specs[i], rate);
+    }
+    printf("design targets: %d missed\n\n", missed);
+
+    filterchain_configure((uint16_t)hp, specs, count, rate);
+    printf("rate %.0f Hz, sections %u, %s\n", rate, filterChainStats.sections,
+           filterchain_toJson(specs, count).c_str());
+
+    // Log-spaced points from 20 Hz to 0.45 fs, plus the section frequencies themselves.
+    std::vector<float> freqs;
+    float lo = 20.0f, hi = 0.45f * rate;
+    for (int i = 0; i < points; i++) freqs.push_back(lo * powf(hi / lo, (float)i / (points - 1)));
+    for (uint8_t i = 0; i < count; i++) {
+        if (specs[i].freqHz < hi) freqs.push_back(specs[i].freqHz * 1.02f);   // just off a notch's null
+    }
+    if (hp) freqs.push_back((float)hp);
+
+    float worst = 0.0f;
+    int bad = 0;
+    printf("%10s %10s %10s %8s\n", "freq_hz", "expect_db", "meas_db", "err_db");
+    for (float f : freqs) {
+        float expect = filterchain_responseDb(f, rate);
+        float meas = measureDb(f, rate);
+        float e = fabsf(meas - expect);
+        // Deep in a stopband the measurement floors out; only compare down to -60 dB.
+        if (expect < -60.0f && meas < -60.0f) e = 0.0f;
+        if (e > worst) worst = e;
+        bool fail = e > tol;
+        if (fail) bad++;
+        printf("%10.1f %10.3f %10.3f %8.3f%s\n", f, expect, meas, meas - expect, fail ? "  FAIL" : "");
+    }
+    printf("worst error %.3f dB (tolerance %.3f dB): %s\n", worst, tol, bad ? "FAIL" : "ok");
+    return (bad || missed) ? 1 : 0;
+}
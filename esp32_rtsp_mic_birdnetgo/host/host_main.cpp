@@ -0,0 +1,81 @@
+// Host build entry point: runs the sketch's setup()/loop() as a Linux process.
+//
+//   esp32mic_host [--wav FILE | --noise | --silence] [--level DBFS]
+//                 [--speed FACTOR] [--prefs FILE] [--fs DIR] [--duration SEC]
+//
+// RTSP listens on 8554, the Web UI/API on 8080 (port 80 + 8000).
+#include <Arduino.h>
+#include <Preferences.h>
+#include <driver/i2s.h>
+#include <FS.h>
+
+#include <signal.h>
+
+void setup();
+void loop();
+
+static volatile sig_atomic_t g_stop = 0;
+
+static void onSignal(int) { g_stop = 1; }
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--wav FILE | --noise | --silence] [--level DBFS]\n"
+            "          [--speed FACTOR] [--prefs FILE] [--fs DIR] [--duration SEC]\n",
+            argv0);
+}
+
+int main(int argc, char **argv) {
+    double durationSec = 0.0;
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        auto next = [&](void) -> const char * {
+            if (i + 1 >= argc) {
+                usage(argv[0]);
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (a == "--wav") {
+            const char *path = next();
+            if (!host_i2s_load_wav(path)) {
+                fprintf(stderr, "cannot load WAV file %s\n", path);
+                return 2;
+            }
+        } else if (a == "--noise") {
+            host_i2s_set_source(HOST_I2S_NOISE);
+        } else if (a == "--silence") {
+            host_i2s_set_source(HOST_I2S_SILENCE);
+        } else if (a == "--level") {
+            host_i2s_set_level_dbfs((float)atof(next()));
+        } else if (a == "--speed") {
+            host_set_speed(atof(next()));
+        } else if (a == "--prefs") {
+            host_prefs_set_file(next());
+        } else if (a == "--fs") {
+            host_fs_set_root(next());
+        } else if (a == "--duration") {
+            durationSec = atof(next());
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+
+    setup();
+    unsigned long startMs = millis();
+    while (!g_stop) {
+        loop();
+        if (durationSec > 0.0 && (millis() - startMs) >= (unsigned long)(durationSec * 1000.0)) break;
+        // loopTask on the device yields to the idle task between iterations.
+        delayMicroseconds(50);
+    }
+    fprintf(stderr, "[host] stopped after %lu ms, i2s overrun samples: %llu\n",
+            millis() - startMs, (unsigned long long)host_i2s_overrun_samples());
+    return 0;
+}
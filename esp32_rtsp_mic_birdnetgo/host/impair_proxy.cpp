@@ -0,0 +1,575 @@
+// Network impairment proxy for the RTSP stream (device or host build).
+//
+//   impair_proxy [--listen PORT] [--target HOST:PORT] [--profile NAME|FILE] [--loop]
+//                [--duration SEC] [--json FILE]
+//
+// Sits between an RTSP client (ffplay, rtsp_soak) and the server and replays a scripted
+// impairment profile on the TCP connection. The upstream socket has a small receive buffer,
+// so throttling or stalling the proxy's reads pushes back on the sender the way a weak Wi-Fi
+// link does, and the firmware's writeAll() retry/timeout path is exercised for real.
+//
+// Profile steps, one per line (`#` comments), `<seconds> <action> [arg]`:
+//   pass            forward unchanged
+//   rate <kbps>     cap server->client throughput (RSSI dip)
+//   delay <ms>      add latency to server->client data
+//   stall           forward nothing in either direction (air-time loss, roaming)
+//   reset           close every connection once (link lost); the step's time is then idle
+// Built-in profiles: rssi-dips, stalls, mixed.
+//
+// The server->client stream is parsed for the SDP rate and the interleaved RTP packets,
+// which gives: sessions the server dropped (it closed while the client was still there),
+// audio lost (wall time from the first to the last packet minus RTP time delivered) and the
+// recovery time from a drop to the first packet of the next session. Results per action and
+// in total go to --json (or stdout) at exit; Ctrl+C ends the run.
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+volatile sig_atomic_t g_stop = 0;
+
+void onSignal(int) { g_stop = 1; }
+
+double nowSec() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Upstream receive buffer: about what a Wi-Fi link plus the AP hold in flight.
+const int UPSTREAM_RCVBUF = 16 * 1024;
+// Data held back by `delay`; reads stop beyond this.
+const size_t MAX_QUEUED = 64 * 1024;
+const double BLAME_PREVIOUS_SEC = 1.0;      // see the server-drop attribution below
+
+enum Action { ACT_PASS, ACT_RATE, ACT_DELAY, ACT_STALL, ACT_RESET, ACT_COUNT };
+const char *const ACTION_NAMES[ACT_COUNT] = {"pass", "rate", "delay", "stall", "reset"};
+
+struct Step {
+    double seconds;
+    Action action;
+    double arg;
+};
+
+const char *const BUILTIN_RSSI_DIPS =
+    "20 pass\n"
+    "10 rate 800\n"
+    "10 rate 500\n"
+    "5 rate 250\n"
+    "20 pass\n"
+    "3 rate 100\n"
+    "20 pass\n";
+
+const char *const BUILTIN_STALLS =
+    "10 pass\n"
+    "0.2 stall\n"
+    "10 pass\n"
+    "0.5 stall\n"
+    "10 pass\n"
+    "1 stall\n"
+    "10 pass\n"
+    "3 stall\n"
+    "15 pass\n";
+
+const char *const BUILTIN_MIXED =
+    "15 pass\n"
+    "10 delay 150\n"
+    "0.2 stall\n"
+    "10 rate 600\n"
+    "0.2 stall\n"
+    "10 pass\n"
+    "1 reset\n"
+    "15 pass\n";
+
+struct ActionStats {
+    double seconds = 0.0;
+    uint64_t bytes = 0;          // server -> client
+    uint64_t packets = 0;
+    uint32_t serverDrops = 0;
+};
+
+struct Totals {
+    uint32_t connections = 0;
+    uint32_t serverDrops = 0;    // server closed while the client was connected
+    uint32_t clientCloses = 0;
+    uint32_t resets = 0;         // closed by a `reset` step
+    uint64_t packets = 0;
+    uint64_t bytes = 0;
+    double firstRtp = -1.0;      // first RTP packet of the run
+    double lastRtp = 0.0;
+    double mediaSec = 0.0;       // RTP time delivered, all sessions
+    double outageSec = 0.0;      // drop -> first packet of the next session
+    std::vector<double> recoveryMs;
+    ActionStats perAction[ACT_COUNT];
+};
+
+struct Chunk {
+    double release;
+    std::string data;
+};
+
+struct Pair {
+    int cfd = -1;
+    int sfd = -1;
+    std::deque<Chunk> down;      // server -> client, waiting for release / writability
+    size_t downQueued = 0;
+    std::string up;              // client -> server
+    double tokens = 0.0;         // rate limiter, bytes
+    double tokensAt = 0.0;
+    bool wantServer = false;
+    // Stream parser (server -> client)
+    std::string parse;
+    uint32_t clockRate = 0;
+    bool haveRtp = false;
+    uint32_t prevTs = 0;
+    uint64_t tsSpan = 0;
+};
+
+struct Options {
+    int listenPort = 18554;
+    std::string targetHost = "127.0.0.1";
+    int targetPort = 8554;
+    std::string profile = "mixed";
+    bool loop = false;
+    double durationSec = 0.0;
+    std::string jsonPath;
+};
+
+void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--listen PORT] [--target HOST:PORT] [--profile rssi-dips|stalls|mixed|FILE]\n"
+            "          [--loop] [--duration SEC] [--json FILE]\n",
+            argv0);
+}
+
+bool parseProfile(const std::string &text, std::vector<Step> &out) {
+    std::istringstream in(text);
+    std::string line;
+    int n = 0;
+    while (std::getline(in, line)) {
+        n++;
+        line = line.substr(0, line.find('#'));
+        std::istringstream ls(line);
+        Step st = {};
+        std::string name;
+        if (!(ls >> st.seconds)) continue;   // blank line
+        if (!(ls >> name)) return false;
+        int a = 0;
+        while (a < ACT_COUNT && name != ACTION_NAMES[a]) a++;
+        if (a == ACT_COUNT || st.seconds <= 0) {
+            fprintf(stderr, "profile line %d: bad step\n", n);
+            return false;
+        }
+        st.action = (Action)a;
+        if ((st.action == ACT_RATE || st.action == ACT_DELAY) && !(ls >> st.arg)) {
+            fprintf(stderr, "profile line %d: %s needs a value\n", n, name.c_str());
+            return false;
+        }
+        out.push_back(st);
+    }
+    return !out.empty();
+}
+
+void setNonBlocking(int fd) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+int listenOn(int port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in sa = {};
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons((uint16_t)port);
+    sa.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(fd, (sockaddr *)&sa, sizeof(sa)) != 0 || listen(fd, 4) != 0) {
+        close(fd);
+        return -1;
+    }
+    setNonBlocking(fd);
+    return fd;
+}
+
+int connectUpstream(const Options &o) {
+    addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo *res = nullptr;
+    if (getaddrinfo(o.targetHost.c_str(), std::to_string(o.targetPort).c_str(), &hints, &res) != 0) return -1;
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    int rcv = UPSTREAM_RCVBUF;
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcv, sizeof(rcv));   // before connect: sets the window
+    int rc = connect(fd, res->ai_addr, res->ai_addrlen);
+    freeaddrinfo(res);
+    if (rc != 0) {
+        close(fd);
+        return -1;
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    setNonBlocking(fd);
+    return fd;
+}
+
+// Follows the server -> client byte stream: RTSP responses (for the SDP rate) and `$` frames.
+void parseDown(Pair &p, Totals &t, ActionStats &as, const char *data, size_t len, double now) {
+    p.parse.append(data, len);
+    size_t off = 0;
+    for (;;) {
+        size_t left = p.parse.size() - off;
+        if (left == 0) break;
+        if (p.parse[off] == '$') {
+            if (left < 4) break;
+            size_t flen = ((size_t)(uint8_t)p.parse[off + 2] << 8) | (uint8_t)p.parse[off + 3];
+            if (left < 4 + flen) break;
+            const uint8_t *r = (const uint8_t *)p.parse.data() + off + 4;
+            if (p.parse[off + 1] == 0 && flen >= 12) {
+                uint32_t ts = ((uint32_t)r[4] << 24) | ((uint32_t)r[5] << 16) | ((uint32_t)r[6] << 8) | r[7];
+                if (p.haveRtp) {
+                    int32_t d = (int32_t)(ts - p.prevTs);
+                    if (d > 0) p.tsSpan += (uint32_t)d;   // ignore reordering / restarts
+                } else {
+                    p.haveRtp = true;
+                    if (t.firstRtp < 0) t.firstRtp = now;
+                }
+                p.prevTs = ts;
+                t.lastRtp = now;
+                t.packets++;
+                as.packets++;
+            }
+            off += 4 + flen;
+        } else {
+            size_t hdrEnd = p.parse.find("\r\n\r\n", off);
+            if (hdrEnd == std::string::npos) break;
+            size_t total = hdrEnd + 4 - off;
+            std::string head = p.parse.substr(off, hdrEnd + 2 - off);
+            size_t cl = head.find("Content-Length:");
+            if (cl != std::string::npos) total += (size_t)atoi(head.c_str() + cl + 15);
+            if (left < total) break;
+            std::string msg = p.parse.substr(off, total);
+            size_t rm = msg.find("a=rtpmap:");
+            if (rm != std::string::npos) {
+                size_t slash = msg.find('/', rm);
+                if (slash != std::string::npos) p.clockRate = (uint32_t)strtoul(msg.c_str() + slash + 1, nullptr, 10);
+            }
+            off += total;
+        }
+    }
+    p.parse.erase(0, off);
+}
+
+void closePair(Pair &p, Totals &t, bool serverDropped, double now, double &dropAt) {
+    if (p.cfd >= 0) close(p.cfd);
+    if (p.sfd >= 0) close(p.sfd);
+    p.cfd = p.sfd = -1;
+    if (p.haveRtp && p.clockRate) t.mediaSec += (double)p.tsSpan / p.clockRate;
+    if (serverDropped) dropAt = now;
+}
+
+std::string summaryJson(const Options &o, const Totals &t, double elapsed) {
+    char b[256];
+    std::string j = "{";
+    j += "\"profile\":\"" + o.profile + "\",";
+    snprintf(b, sizeof(b), "\"elapsed_s\":%.1f,", elapsed);
+    j += b;
+    j += "\"connections\":" + std::to_string(t.connections) + ",";
+    j += "\"server_drops\":" + std::to_string(t.serverDrops) + ",";
+    j += "\"client_closes\":" + std::to_string(t.clientCloses) + ",";
+    j += "\"resets\":" + std::to_string(t.resets) + ",";
+    j += "\"packets\":" + std::to_string(t.packets) + ",";
+    j += "\"bytes\":" + std::to_string(t.bytes) + ",";
+    // Wall time from the first to the last packet minus the audio delivered: outages between
+    // sessions plus whatever the sender skipped inside them.
+    double wall = t.firstRtp < 0 ? 0.0 : t.lastRtp - t.firstRtp;
+    snprintf(b, sizeof(b), "\"stream_s\":%.2f,\"media_s\":%.2f,\"audio_lost_s\":%.3f,\"outage_s\":%.3f,",
+             wall, t.mediaSec, std::max(0.0, wall - t.mediaSec), t.outageSec);
+    j += b;
+    if (t.recoveryMs.empty()) {
+        j += "\"recovery_ms\":null,";
+    } else {
+        std::vector<double> r = t.recoveryMs;
+        std::sort(r.begin(), r.end());
+        double sum = 0;
+        for (double v : r) sum += v;
+        snprintf(b, sizeof(b), "\"recovery_ms\":{\"count\":%zu,\"min\":%.1f,\"avg\":%.1f,\"max\":%.1f},",
+                 r.size(), r.front(), sum / (double)r.size(), r.back());
+        j += b;
+    }
+    j += "\"actions\":{";
+    bool first = true;
+    for (int a = 0; a < ACT_COUNT; a++) {
+        const ActionStats &s = t.perAction[a];
+        if (s.seconds <= 0) continue;
+        if (!first) j += ",";
+        first = false;
+        snprintf(b, sizeof(b), "\"%s\":{\"seconds\":%.1f,\"kbps\":%.1f,\"packets\":%llu,\"server_drops\":%u}",
+                 ACTION_NAMES[a], s.seconds, (double)s.bytes * 8.0 / s.seconds / 1000.0,
+                 (unsigned long long)s.packets, s.serverDrops);
+        j += b;
+    }
+    return j + "}}\n";
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    Options o;
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        auto next = [&](void) -> const char * {
+            if (i + 1 >= argc) {
+                usage(argv[0]);
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (a == "--listen") {
+            o.listenPort = atoi(next());
+        } else if (a == "--target") {
+            std::string t = next();
+            size_t c = t.rfind(':');
+            o.targetHost = t.substr(0, c);
+            if (c != std::string::npos) o.targetPort = atoi(t.c_str() + c + 1);
+        } else if (a == "--profile") {
+            o.profile = next();
+        } else if (a == "--loop") {
+            o.loop = true;
+        } else if (a == "--duration") {
+            o.durationSec = atof(next());
+        } else if (a == "--json") {
+            o.jsonPath = next();
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    std::string text;
+    if (o.profile == "rssi-dips") text = BUILTIN_RSSI_DIPS;
+    else if (o.profile == "stalls") text = BUILTIN_STALLS;
+    else if (o.profile == "mixed") text = BUILTIN_MIXED;
+    else {
+        std::ifstream f(o.profile);
+        if (!f) {
+            fprintf(stderr, "cannot read profile %s\n", o.profile.c_str());
+            return 2;
+        }
+        std::stringstream ss;
+        ss << f.rdbuf();
+        text = ss.str();
+    }
+    std::vector<Step> steps;
+    if (!parseProfile(text, steps)) {
+        fprintf(stderr, "empty or invalid profile\n");
+        return 2;
+    }
+
+    int lfd = listenOn(o.listenPort);
+    if (lfd < 0) {
+        fprintf(stderr, "cannot listen on port %d\n", o.listenPort);
+        return 2;
+    }
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+    fprintf(stderr, "[proxy] :%d -> %s:%d, profile %s (%zu steps%s)\n", o.listenPort, o.targetHost.c_str(),
+            o.targetPort, o.profile.c_str(), steps.size(), o.loop ? ", looping" : "");
+
+    Totals t;
+    std::vector<std::unique_ptr<Pair>> pairs;
+    const double start = nowSec();
+    double last = start;
+    size_t stepIdx = 0;
+    double stepEnd = start + steps[0].seconds;
+    double stepStart = start;
+    int prevAction = -1;
+    bool stepEntered = false;
+    double dropAt = -1.0;          // waiting for the first packet after a server drop
+    bool done = false;
+
+    while (!g_stop && !done) {
+        double now = nowSec();
+        if (o.durationSec > 0 && now - start >= o.durationSec) break;
+        while (now >= stepEnd) {
+            stepIdx++;
+            if (stepIdx >= steps.size()) {
+                if (!o.loop) {
+                    done = true;
+                    break;
+                }
+                stepIdx = 0;
+            }
+            prevAction = (int)steps[stepIdx == 0 ? steps.size() - 1 : stepIdx - 1].action;
+            stepStart = stepEnd;
+            stepEnd += steps[stepIdx].seconds;
+            stepEntered = false;
+        }
+        if (done) break;
+        const Step &step = steps[stepIdx];
+        ActionStats &as = t.perAction[step.action];
+        as.seconds += now - last;
+        last = now;
+        if (!stepEntered) {
+            stepEntered = true;
+            fprintf(stderr, "[proxy] %7.1f s  %s", now - start, ACTION_NAMES[step.action]);
+            if (step.action == ACT_RATE) fprintf(stderr, " %.0f kbps", step.arg);
+            if (step.action == ACT_DELAY) fprintf(stderr, " %.0f ms", step.arg);
+            fprintf(stderr, " for %.1f s\n", step.seconds);
+            if (step.action == ACT_RESET) {
+                for (auto &p : pairs) {
+                    if (p->cfd < 0) continue;
+                    t.resets++;
+                    closePair(*p, t, false, now, dropAt);
+                    dropAt = now;   // counts as an outage: recovery is up to the client
+                }
+            }
+        }
+        const bool stalled = step.action == ACT_STALL;
+
+        // Accept new clients (the firmware serves one; keep the proxy transparent anyway).
+        int cfd = accept(lfd, nullptr, nullptr);
+        if (cfd >= 0) {
+            int sfd = connectUpstream(o);
+            if (sfd < 0) {
+                close(cfd);
+            } else {
+                setNonBlocking(cfd);
+                int one = 1;
+                setsockopt(cfd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                auto p = std::make_unique<Pair>();
+                p->cfd = cfd;
+                p->sfd = sfd;
+                p->tokensAt = now;
+                pairs.push_back(std::move(p));
+                t.connections++;
+            }
+        }
+
+        std::vector<pollfd> pfds;
+        for (auto &p : pairs) {
+            if (p->cfd < 0) continue;
+            bool wantServer = !stalled && p->downQueued < MAX_QUEUED;
+            if (step.action == ACT_RATE) {
+                p->tokens = std::min(p->tokens + (now - p->tokensAt) * step.arg * 125.0, step.arg * 125.0 * 0.05 + 1500);
+                wantServer = wantServer && p->tokens >= 1.0;
+            }
+            p->tokensAt = now;
+            p->wantServer = wantServer;
+            pfds.push_back({p->sfd, (short)((wantServer ? POLLIN : 0) | (!stalled && !p->up.empty() ? POLLOUT : 0)), 0});
+            pfds.push_back({p->cfd, (short)((stalled ? 0 : POLLIN) | (!stalled && !p->down.empty() ? POLLOUT : 0)), 0});
+        }
+        pfds.push_back({lfd, POLLIN, 0});
+        poll(pfds.data(), pfds.size(), 5);
+        now = nowSec();
+
+        size_t k = 0;
+        for (auto &pp : pairs) {
+            Pair &p = *pp;
+            if (p.cfd < 0) continue;
+            short sre = pfds[k++].revents;
+            short cre = pfds[k++].revents;
+            char buf[16384];
+            bool serverGone = false;
+            bool clientGone = false;
+
+            if (p.wantServer && (sre & (POLLIN | POLLHUP | POLLERR))) {
+                size_t want = sizeof(buf);
+                if (step.action == ACT_RATE) want = std::min(want, (size_t)std::max(1.0, p.tokens));
+                ssize_t n = recv(p.sfd, buf, want, 0);
+                if (n > 0) {
+                    if (step.action == ACT_RATE) p.tokens -= (double)n;
+                    t.bytes += (uint64_t)n;
+                    as.bytes += (uint64_t)n;
+                    bool hadRtp = p.haveRtp;
+                    parseDown(p, t, as, buf, (size_t)n, now);
+                    if (!hadRtp && p.haveRtp && dropAt >= 0) {
+                        t.recoveryMs.push_back((now - dropAt) * 1000.0);
+                        t.outageSec += now - dropAt;
+                        dropAt = -1.0;
+                    }
+                    double release = now + (step.action == ACT_DELAY ? step.arg / 1000.0 : 0.0);
+                    p.down.push_back({release, std::string(buf, (size_t)n)});
+                    p.downQueued += (size_t)n;
+                } else if (n == 0 || (errno != EAGAIN && errno != EINTR)) {
+                    serverGone = true;
+                }
+            }
+            if (!stalled && (cre & POLLIN)) {
+                ssize_t n = recv(p.cfd, buf, sizeof(buf), 0);
+                if (n > 0) p.up.append(buf, (size_t)n);
+                else if (n == 0 || (errno != EAGAIN && errno != EINTR)) clientGone = true;
+            }
+            if (cre & (POLLHUP | POLLERR)) clientGone = true;
+            if (!stalled) {
+                while (!p.down.empty() && p.down.front().release <= now) {
+                    Chunk &c = p.down.front();
+                    ssize_t n = send(p.cfd, c.data.data(), c.data.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+                    if (n <= 0) {
+                        if (n < 0 && errno != EAGAIN && errno != EINTR) clientGone = true;
+                        break;
+                    }
+                    p.downQueued -= (size_t)n;
+                    if ((size_t)n < c.data.size()) {
+                        c.data.erase(0, (size_t)n);
+                        break;
+                    }
+                    p.down.pop_front();
+                }
+                if (!p.up.empty()) {
+                    ssize_t n = send(p.sfd, p.up.data(), p.up.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+                    if (n > 0) p.up.erase(0, (size_t)n);
+                    else if (n < 0 && errno != EAGAIN && errno != EINTR) serverGone = true;
+                }
+            }
+            if (serverGone && !clientGone) {
+                // The server's FIN queues behind the data a stall or rate cap held back, so a drop
+                // seen just after a step change belongs to the step before it.
+                int act = (now - stepStart < BLAME_PREVIOUS_SEC && prevAction >= 0) ? prevAction : (int)step.action;
+                t.serverDrops++;
+                t.perAction[act].serverDrops++;
+                fprintf(stderr, "[proxy] %7.1f s  server dropped the session (%s)\n", now - start, ACTION_NAMES[act]);
+                closePair(p, t, true, now, dropAt);
+            } else if (clientGone || serverGone) {
+                t.clientCloses++;
+                closePair(p, t, false, now, dropAt);
+            }
+        }
+        pairs.erase(std::remove_if(pairs.begin(), pairs.end(), [](const std::unique_ptr<Pair> &p) { return p->cfd < 0; }),
+                    pairs.end());
+    }
+
+    double end = nowSec();
+    for (auto &p : pairs) closePair(*p, t, false, end, dropAt);
+    close(lfd);
+    std::string json = summaryJson(o, t, end - start);
+    if (o.jsonPath.empty()) {
+        fputs(json.c_str(), stdout);
+    } else {
+        FILE *f = fopen(o.jsonPath.c_str(), "w");
+        if (f) {
+            fputs(json.c_str(), f);
+            fclose(f);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+// Convert an Arduino sketch (.ino) into a C++ translation unit the way the Arduino
+// builder does: prepend `#include <Arduino.h>` and insert prototypes for every
+// top-level function right before the first function definition. Functions with
+// default arguments are skipped, matching the builder's ctags-based generator.
+//
+// Usage: ino2cpp <sketch.ino> <out.cpp>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        std::cerr << "usage: ino2cpp <sketch.ino> <out.cpp>\n";
+        return 2;
+    }
+    std::ifstream in(argv[1]);
+    if (!in) {
+        std::cerr << "ino2cpp: cannot read " << argv[1] << "\n";
+        return 1;
+    }
+    std::vector<std::string> lines;
+    for (std::string l; std::getline(in, l);) lines.push_back(l);
+
+    static const std::regex fnDef(
+        R"(^([A-Za-z_][A-Za-z0-9_:<>,\*& ]*[ \*&])([A-Za-z_][A-Za-z0-9_]*)\((.*)\)\s*(const)?\s*\{\s*$)");
+    static const std::regex notFn(R"(^(if|for|while|switch|return|else|do|struct|class|enum|union|namespace|typedef)\b)");
+    static const std::regex typeDef(R"(^(static\s+)?(const\s+)?(struct|class|enum|union)\s)");
+
+    std::vector<std::string> protos;
+    long firstFn = -1;
+    int depth = 0;
+    for (size_t i = 0; i < lines.size(); ++i) {
+        const std::string &l = lines[i];
+        std::smatch m;
+        if (depth == 0 && std::regex_match(l, m, fnDef) && !std::regex_search(l, notFn) &&
+            !std::regex_search(l, typeDef)) {
+            if (firstFn < 0) firstFn = (long)i;
+            if (m[3].str().find('=') == std::string::npos) {
+                std::string p = l.substr(0, l.rfind('{'));
+                while (!p.empty() && (p.back() == ' ' || p.back() == '\t')) p.pop_back();
+                protos.push_back(p + ";");
+            }
+        }
+        // Track brace depth (ignoring braces in string/char literals and comments).
+        bool inStr = false, inChr = false;
+        for (size_t k = 0; k < l.size(); ++k) {
+            char c = l[k];
+            if (!inStr && !inChr && c == '/' && k + 1 < l.size() && l[k + 1] == '/') break;
+            if ((inStr || inChr) && c == '\\') { ++k; continue; }
+            if (!inChr && c == '"') inStr = !inStr;
+            else if (!inStr && c == '\'') inChr = !inChr;
+            else if (!inStr && !inChr) {
+                if (c == '{') ++depth;
+                else if (c == '}') --depth;
+            }
+        }
+    }
+
+    std::ostringstream out;
+    out << "#include <Arduino.h>\n#line 1 \"" << argv[1] << "\"\n";
+    for (size_t i = 0; i < lines.size(); ++i) {
+        if ((long)i == firstFn) {
+            for (const auto &p : protos) out << p << "\n";
+            out << "#line " << (i + 1) << " \"" << argv[1] << "\"\n";
+        }
+        out << lines[i] << "\n";
+    }
+
+    std::string text = out.str();
+    std::ifstream old(argv[2]);
+    std::stringstream oldText;
+    oldText << old.rdbuf();
+    if (old && oldText.str() == text) return 0;  // keep timestamps stable
+    std::ofstream o(argv[2], std::ios::trunc);
+    o << text;
+    return o ? 0 : 1;
+}
@@ -0,0 +1,141 @@
+// Decision check for the loop() job scheduler (JobScheduler.cpp) on a virtual clock.
+//
+//   job_scheduler
+//
+// Jobs are stubs that only advance the fake microsecond clock by a set cost, so every case is
+// exact: jobs due together are spread over iterations by the iteration budget (priority, then
+// oldest due time first; one job always runs), audio backlog holds back all but urgent jobs
+// until their maxDeferMs is up (counted once per episode), late runs skip the missed periods
+// instead of catching up, on-time runs keep their phase, and trigger()/setPeriod() move the
+// due time. Exits non-zero on the first failed check.
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "JobScheduler.h"
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+    printf("  %-58s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok) failures++;
+}
+
+static uint32_t g_us = 0;
+static uint32_t g_cost[8];
+static std::string g_order;    // job letters in run order
+
+static uint32_t fakeClockUs() { return g_us; }
+
+template <int N>
+static void stubJob() {
+    g_order += (char)('A' + N);
+    g_us += g_cost[N];
+}
+
+static const JobFn STUBS[] = {stubJob<0>, stubJob<1>, stubJob<2>, stubJob<3>};
+
+static void reset() {
+    g_us = 0;
+    g_order.clear();
+    for (uint32_t &c : g_cost) c = 100;
+}
+
+static void budgetSpreading() {
+    printf("iteration budget\n");
+    reset();
+    JobScheduler s(fakeClockUs);
+    s.setIterationBudgetUs(2000);
+    // Added out of priority order; all due at 1000 ms
+    s.add("bg", STUBS[0], 1000, JOB_BACKGROUND, 1500, 0, 0, 1000);
+    s.add("n1", STUBS[1], 1000, JOB_NORMAL, 1500, 0, 0, 1000);
+    s.add("urgent", STUBS[2], 1000, JOB_URGENT, 1500, 0, 0, 1000);
+    s.add("n2", STUBS[3], 1000, JOB_NORMAL, 1500, 0, 0, 999);
+    for (int i = 0; i < 4; i++) g_cost[i] = 1500;
+
+    check(s.runDue(999, false) == 1 && g_order == "D", "only the job due at 999 ms runs");
+    check(s.runDue(1000, false) == 1 && g_order == "DC", "one 1.5 ms job per 2 ms iteration, urgent first");
+    check(s.job(1).stats.deferredBusy == 1 && s.job(0).stats.deferredBusy == 1, "the others count a busy deferral");
+    check(s.runDue(1001, false) == 1 && g_order == "DCB", "then normal");
+    check(s.runDue(1002, false) == 1 && g_order == "DCBA", "then background");
+    check(s.job(0).stats.deferredBusy == 1, "a deferral episode is counted once");
+    check(s.job(0).stats.lateMaxMs == 2, "late start recorded");
+
+    reset();
+    JobScheduler t(fakeClockUs);
+    t.setIterationBudgetUs(2000);
+    for (int i = 0; i < 3; i++) t.add("small", STUBS[i], 1000, JOB_NORMAL, 500, 0, 0, 0);
+    for (int i = 0; i < 3; i++) g_cost[i] = 500;
+    check(t.runDue(0, false) == 3 && g_order == "ABC", "jobs that fit run together, oldest added first");
+
+    reset();
+    JobScheduler u(fakeClockUs);
+    u.setIterationBudgetUs(2000);
+    u.add("slow", STUBS[0], 1000, JOB_NORMAL, 1000, 0, 0, 0);
+    g_cost[0] = 5000;
+    check(u.runDue(0, false) == 1 && u.iterationsOverBudget() == 1, "a single long job still runs, iteration over budget");
+    check(u.job(0).stats.overBudget == 1 && u.job(0).stats.maxUs == 5000, "job over its own budget");
+    check(u.job(0).stats.avgUs == 5000, "first run sets the average");
+    g_cost[0] = 1000;
+    u.runDue(1000, false);
+    check(u.job(0).stats.avgUs == 5000 - 5000 / 8 + 1000 / 8, "average is an EWMA of 1/8");
+}
+
+static void audioBacklog() {
+    printf("audio backlog\n");
+    reset();
+    JobScheduler s(fakeClockUs);
+    s.add("urgent", STUBS[0], 1000, JOB_URGENT, 500, 0, 0, 0);
+    s.add("normal", STUBS[1], 1000, JOB_NORMAL, 500, 300, 0, 0);
+    s.add("bg", STUBS[2], 1000, JOB_BACKGROUND, 500, 5000, 0, 0);
+
+    check(s.runDue(0, true) == 1 && g_order == "A", "backlog: only the urgent job runs");
+    s.runDue(100, true);
+    s.runDue(299, true);
+    check(g_order == "A", "others held back within maxDefer");
+    check(s.job(1).stats.deferredAudio == 1 && s.job(2).stats.deferredAudio == 1,
+          "audio deferral counted once per episode");
+    check(s.runDue(300, true) == 1 && g_order == "AB", "normal runs once its 300 ms are up");
+    check(s.job(1).stats.lateMaxMs == 300, "late by its deferral");
+    check(s.runDue(301, false) == 1 && g_order == "ABC", "backlog over: background runs");
+    check(s.job(1).dueMs == 1000 && s.job(2).dueMs == 1000, "deferred runs keep the phase");
+
+    s.runDue(1000, true);
+    check(s.runDue(6000, true) >= 1 && g_order.back() == 'C' && s.job(2).stats.deferredAudio == 2,
+          "background held up to its 5 s maxDefer, new episode counted");
+}
+
+static void missedPeriods() {
+    printf("missed periods\n");
+    reset();
+    JobScheduler s(fakeClockUs);
+    int id = s.add("p100", STUBS[0], 100, JOB_NORMAL, 500, 0, 0, 0);
+    s.runDue(0, false);
+    check(s.job(id).dueMs == 100, "on time: next due one period later");
+    s.runDue(105, false);
+    check(s.job(id).dueMs == 200, "slightly late: phase kept");
+    check(s.runDue(450, false) == 1 && g_order == "AAA", "long stall: one run, no burst");
+    check(s.job(id).dueMs == 550, "missed periods skipped (due = now + period)");
+    check(s.runDue(549, false) == 0, "not due before then");
+    check(s.runDue(550, false) == 1, "due again one period after the late run");
+
+    s.trigger(id, 560);
+    check(s.runDue(560, false) == 1 && s.job(id).dueMs == 660, "trigger makes the job due now");
+    s.setPeriod(id, 1000);
+    check(s.job(id).dueMs == 1560, "setPeriod keeps the last run as phase reference");
+
+    reset();
+    JobScheduler w(fakeClockUs);
+    w.add("wrap", STUBS[0], 100, JOB_NORMAL, 500, 0, 0xFFFFFFF0u, 0);
+    check(w.runDue(0xFFFFFFF0u, false) == 1 && w.job(0).dueMs == 0xFFFFFFF0u + 100, "due time wraps past 2^32 ms");
+    check(w.runDue(0xFFFFFFFFu, false) == 0 && w.runDue(0x54, false) == 1, "wrapped due time compared correctly");
+}
+
+int main() {
+    budgetSpreading();
+    audioBacklog();
+    missedPeriods();
+    printf("%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
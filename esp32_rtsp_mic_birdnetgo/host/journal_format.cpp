@@ -0,0 +1,367 @@
+// Block format and torn-write recovery check for the log journal (LogJournal.cpp, built for the host).
+//
+//   journal_format [--keep DIR]
+//
+// Part 1 feeds logjournal_validPrefix() in-memory segment images: valid blocks, a bad CRC,
+// a torn payload, a truncated header, a sequence that goes backwards, garbage after the
+// last block. Part 2 writes such images as segment files into a scratch LittleFS root and
+// boots the journal on them (one forked process per case, since the journal mounts once):
+// it checks what the boot scan kept (tornRecovered, text size, file size after the cut,
+// which segment is the newest) and that lines appended afterwards land right after the
+// repaired tail with the next sequence number and read back in order. Part 3 makes one block
+// write come up short at run time (host_fs_fail_write_after()) and checks that the partial
+// block is cut off, so the blocks written after it still validate and read back. Part 4
+// checks that a read through a snapshot delivers exactly the size the snapshot announced,
+// and comes up short once the writer recycled its segments.
+// Exits non-zero on the first failed case.
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "LogJournal.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+    printf("  %-58s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok) failures++;
+}
+
+static void addBlock(Bytes &seg, uint32_t seq, const std::string &text) {
+    LogJournalBlockHeader h;
+    logjournal_makeHeader(h, seq, text.data(), (uint16_t)text.size());
+    const uint8_t *hp = reinterpret_cast<const uint8_t *>(&h);
+    seg.insert(seg.end(), hp, hp + sizeof(h));
+    seg.insert(seg.end(), text.begin(), text.end());
+}
+
+static std::string line(uint32_t seq) {
+    return "line " + std::to_string(seq) + " of the journal format check\n";
+}
+
+static std::string lines(uint32_t first, uint32_t last) {
+    std::string s;
+    for (uint32_t i = first; i <= last; i++) s += line(i);
+    return s;
+}
+
+// Segment with blocks first..last, one line each; returns the end offset of every block.
+static Bytes segment(uint32_t first, uint32_t last, std::vector<size_t> *ends = nullptr) {
+    Bytes seg;
+    for (uint32_t s = first; s <= last; s++) {
+        addBlock(seg, s, line(s));
+        if (ends) ends->push_back(seg.size());
+    }
+    return seg;
+}
+
+static size_t prefix(const Bytes &b, uint32_t &lastSeq) {
+    return logjournal_validPrefix(b.data(), b.size(), &lastSeq);
+}
+
+static void formatCases() {
+    printf("logjournal_validPrefix\n");
+    uint32_t last = 99;
+    check(logjournal_validPrefix(nullptr, 0, &last) == 0 && last == 0, "empty segment");
+
+    std::vector<size_t> ends;
+    Bytes ok = segment(1, 5, &ends);
+    check(prefix(ok, last) == ok.size() && last == 5, "five valid blocks");
+
+    Bytes crc = ok;
+    crc[ends[2] - 3] ^= 0x40;   // payload byte of block 3
+    check(prefix(crc, last) == ends[1] && last == 2, "bad CRC in block 3 ends the prefix");
+
+    Bytes torn(ok.begin(), ok.begin() + (long)(ends[3] - 10));
+    check(prefix(torn, last) == ends[2] && last == 3, "torn payload of block 4");
+
+    Bytes shortHdr(ok.begin(), ok.begin() + (long)(ends[1] + sizeof(LogJournalBlockHeader) - 5));
+    check(prefix(shortHdr, last) == ends[1] && last == 2, "truncated header after block 2");
+
+    Bytes back = segment(7, 8);
+    addBlock(back, 8, line(8));
+    check(prefix(back, last) == back.size() / 3 * 2 && last == 8, "repeated sequence number stops the scan");
+
+    Bytes junk = ok;
+    junk.insert(junk.end(), 100, 0xFF);   // erased flash after the last block
+    check(prefix(junk, last) == ok.size() && last == 5, "erased flash after the last block");
+
+    Bytes big = segment(1, 1);
+    LogJournalBlockHeader h;
+    logjournal_makeHeader(h, 2, "x", 1);
+    h.len = (uint16_t)(LOGJOURNAL_PAYLOAD_MAX + 1);
+    const uint8_t *hp = reinterpret_cast<const uint8_t *>(&h);
+    big.insert(big.end(), hp, hp + sizeof(h));
+    check(prefix(big, last) == ok.size() / 5 && last == 1, "oversized length rejected before the CRC");
+}
+
+// ---- Boot recovery on real segment files ----
+
+static std::string g_root;
+
+static std::string segFile(int idx) {
+    return g_root + "/log/j" + std::to_string(idx) + ".bin";
+}
+
+static void writeFile(const std::string &path, const Bytes &b) {
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f) { perror(path.c_str()); exit(2); }
+    if (!b.empty()) fwrite(b.data(), 1, b.size(), f);
+    fclose(f);
+}
+
+static Bytes readFile(const std::string &path) {
+    Bytes b;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) return b;
+    uint8_t buf[1024];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) b.insert(b.end(), buf, buf + n);
+    fclose(f);
+    return b;
+}
+
+static bool collect(const uint8_t *data, size_t len, void *ctx) {
+    static_cast<std::string *>(ctx)->append(reinterpret_cast<const char *>(data), len);
+    return true;
+}
+
+struct BootCase {
+    const char *name;
+    std::vector<Bytes> segs;    // j0.bin, j1.bin, ... (empty: file absent)
+    int newest;                 // segment the appends must go to
+    uint32_t keptBytes;         // valid prefix of the newest segment
+    uint32_t lastSeq;           // highest valid sequence number on flash
+    uint32_t tornExpected;
+    std::string keptText;       // all valid text, oldest first
+};
+
+// Child process: boot the journal on the prepared files and check it.
+static int runBoot(const BootCase &c) {
+    host_fs_set_root(g_root.c_str());
+    if (!logjournal_begin()) {
+        printf("  logjournal_begin failed\n");
+        return 1;
+    }
+    LogJournalStats st;
+    logjournal_getStats(st);
+    check(st.tornRecovered == c.tornExpected, "torn tails cut off at boot");
+    check(st.textBytes == c.keptText.size(), "readable text = valid blocks only");
+    const Bytes repaired = readFile(segFile(c.newest));
+    check(repaired.size() == c.keptBytes, "newest segment truncated to its valid prefix");
+    std::string text;
+    logjournal_read(0, c.keptText.size(), collect, &text);
+    check(text == c.keptText, "text read back after recovery");
+
+    const char *appended[] = {"appended after recovery A", "appended after recovery B"};
+    for (const char *a : appended) logjournal_append(nullptr, 0, a, strlen(a));
+    check(logjournal_flush(1000), "flush");
+    Bytes seg = readFile(segFile(c.newest));
+    uint32_t last = 0;
+    size_t valid = logjournal_validPrefix(seg.data(), seg.size(), &last);
+    check(valid == seg.size(), "whole newest segment validates after the append");
+    check(last == c.lastSeq + 1, "append resumes with the next sequence number");
+    LogJournalBlockHeader h = {};
+    if (seg.size() >= c.keptBytes + sizeof(h)) memcpy(&h, seg.data() + c.keptBytes, sizeof(h));
+    check(seg.size() > c.keptBytes && !memcmp(seg.data(), repaired.data(), c.keptBytes) &&
+              h.magic == LOGJOURNAL_MAGIC && h.seq == c.lastSeq + 1,
+          "new block starts right after the repaired tail");
+    std::string expect = c.keptText + appended[0] + "\n" + appended[1] + "\n";
+    text.clear();
+    logjournal_read(0, logjournal_textSize(), collect, &text);
+    check(text == expect, "old and new lines read back in order");
+    return failures ? 1 : 0;
+}
+
+static bool bootCase(const BootCase &c) {
+    printf("boot: %s\n", c.name);
+    std::string cmd = "rm -rf '" + g_root + "'";
+    if (system(cmd.c_str()) != 0) return false;
+    mkdir(g_root.c_str(), 0755);
+    mkdir((g_root + "/log").c_str(), 0755);
+    for (size_t i = 0; i < c.segs.size(); i++) {
+        if (!c.segs[i].empty()) writeFile(segFile((int)i), c.segs[i]);
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        int rc = runBoot(c);
+        fflush(stdout);
+        _exit(rc);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    bool ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    if (!ok) failures++;
+    return ok;
+}
+
+// ---- Write error at run time ----
+
+static int runWriteError(const Bytes &seg, uint32_t lastSeq, const std::string &keptText) {
+    host_fs_set_root(g_root.c_str());
+    if (!logjournal_begin()) {
+        printf("  logjournal_begin failed\n");
+        return 1;
+    }
+    const char *lost = "written while the flash fails";
+    const char *after[] = {"written after the error A", "written after the error B"};
+    host_fs_fail_write_after(10);   // header goes out partly, then the write fails
+    logjournal_append(nullptr, 0, lost, strlen(lost));
+    logjournal_flush(1000);
+    LogJournalStats st;
+    logjournal_getStats(st);
+    check(st.writeErrors == 1, "short write counted");
+    check(readFile(segFile(0)) == seg, "partial block cut off the segment");
+    for (const char *a : after) {
+        logjournal_append(nullptr, 0, a, strlen(a));
+        check(logjournal_flush(1000), "flush after the error");
+    }
+    Bytes now = readFile(segFile(0));
+    uint32_t last = 0;
+    check(logjournal_validPrefix(now.data(), now.size(), &last) == now.size(), "whole segment validates");
+    check(last == lastSeq + 2, "failed block's sequence number reused");
+    std::string text;
+    logjournal_read(0, logjournal_textSize(), collect, &text);
+    check(text == keptText + after[0] + "\n" + after[1] + "\n", "lines after the error read back");
+    return failures ? 1 : 0;
+}
+
+static void writeErrorCase() {
+    printf("write error: short write of one block\n");
+    std::string cmd = "rm -rf '" + g_root + "'";
+    if (system(cmd.c_str()) != 0) return;
+    mkdir(g_root.c_str(), 0755);
+    mkdir((g_root + "/log").c_str(), 0755);
+    Bytes seg = segment(1, 3);
+    writeFile(segFile(0), seg);
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        int rc = runWriteError(seg, 3, line(1) + line(2) + line(3));
+        fflush(stdout);
+        _exit(rc);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failures++;
+}
+
+// ---- Reads through a snapshot ----
+
+static void appendFlushed(uint32_t first, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        std::string l = line(first + i);
+        l.pop_back();   // the journal adds the newline
+        logjournal_append(nullptr, 0, l.data(), l.size());
+        if (i % 16 == 15) logjournal_flush(1000);
+    }
+    logjournal_flush(1000);
+}
+
+static int runSnapshot() {
+    host_fs_set_root(g_root.c_str());
+    if (!logjournal_begin()) {
+        printf("  logjournal_begin failed\n");
+        return 1;
+    }
+    appendFlushed(1, 100);
+    LogJournalSnapshot snap;
+    check(logjournal_snapshot(snap) && snap.textBytes == lines(1, 100).size(), "snapshot size = text on flash");
+    appendFlushed(101, 10);
+    std::string text;
+    size_t got = logjournal_readSnapshot(snap, 0, snap.textBytes + 1000, collect, &text);
+    check(got == snap.textBytes && text == lines(1, 100), "later appends stay out of the snapshot");
+    const uint32_t fill = LOGJOURNAL_SEGMENTS * LOGJOURNAL_SEGMENT_BYTES / line(1).size() + 100;
+    appendFlushed(111, fill);
+    text.clear();
+    got = logjournal_readSnapshot(snap, 0, snap.textBytes, collect, &text);
+    check(got < snap.textBytes && text == lines(1, 100).substr(0, got), "recycled segments end the read short");
+    return failures ? 1 : 0;
+}
+
+static void snapshotCase() {
+    printf("snapshot reads\n");
+    std::string cmd = "rm -rf '" + g_root + "'";
+    if (system(cmd.c_str()) != 0) return;
+    mkdir(g_root.c_str(), 0755);
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        int rc = runSnapshot();
+        fflush(stdout);
+        _exit(rc);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) failures++;
+}
+
+static void bootCases() {
+    std::vector<size_t> ends;
+    Bytes full = segment(1, 4, &ends);
+
+    {   // reset in the middle of the payload of block 4
+        BootCase c = {"torn payload", {Bytes(full.begin(), full.begin() + (long)(ends[3] - 7))}, 0,
+                      (uint32_t)ends[2], 3, 1, lines(1, 3)};
+        bootCase(c);
+    }
+    {   // reset right after a few header bytes of block 5
+        Bytes seg = full;
+        seg.insert(seg.end(), 6, 0x45);
+        BootCase c = {"truncated header", {seg}, 0, (uint32_t)ends[3], 4, 1, lines(1, 4)};
+        bootCase(c);
+    }
+    {   // block 3 complete but its CRC does not match: 3 and 4 are cut
+        Bytes seg = full;
+        seg[ends[2] - 2] ^= 0x01;
+        BootCase c = {"bad CRC", {seg}, 0, (uint32_t)ends[1], 2, 1, lines(1, 2)};
+        bootCase(c);
+    }
+    {   // newest segment is j1 (higher sequence), torn; j0 intact
+        std::vector<size_t> e1;
+        Bytes j1 = segment(5, 7, &e1);
+        Bytes torn(j1.begin(), j1.begin() + (long)(e1[2] - 3));
+        BootCase c = {"newest segment picked by sequence", {full, torn}, 1, (uint32_t)e1[1], 6, 1, lines(1, 6)};
+        bootCase(c);
+    }
+    {   // clean shutdown: nothing to cut
+        BootCase c = {"clean segment", {full}, 0, (uint32_t)full.size(), 4, 0, lines(1, 4)};
+        bootCase(c);
+    }
+}
+
+int main(int argc, char **argv) {
+    bool keep = false;
+    char tmpl[] = "/tmp/journal_format.XXXXXX";
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--keep") && i + 1 < argc) { g_root = argv[++i]; keep = true; }
+        else { fprintf(stderr, "usage: %s [--keep DIR]\n", argv[0]); return 2; }
+    }
+    if (g_root.empty()) {
+        if (!mkdtemp(tmpl)) { perror("mkdtemp"); return 2; }
+        g_root = tmpl;
+    }
+
+    formatCases();
+    bootCases();
+    writeErrorCase();
+    snapshotCase();
+
+    if (!keep) {
+        std::string cmd = "rm -rf '" + g_root + "'";
+        if (system(cmd.c_str()) != 0) fprintf(stderr, "could not remove %s\n", g_root.c_str());
+    }
+    printf("%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
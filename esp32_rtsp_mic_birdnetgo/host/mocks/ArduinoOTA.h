@@ -0,0 +1,12 @@
+#pragma once
+#include <Arduino.h>
+
+class ArduinoOTAClass {
+public:
+    ArduinoOTAClass &setHostname(const char *) { return *this; }
+    ArduinoOTAClass &setPassword(const char *) { return *this; }
+    void begin() {}
+    void end() {}
+    void handle() {}
+};
+extern ArduinoOTAClass ArduinoOTA;
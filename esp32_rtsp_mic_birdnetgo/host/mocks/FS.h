@@ -0,0 +1,76 @@
+#pragma once
+// Host build: Arduino FS/File API backed by a directory on the host file system.
+#include <Arduino.h>
+
+#include <dirent.h>
+
+#include <memory>
+#include <string>
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File : public Stream {
+public:
+    File() {}
+    File(std::shared_ptr<FILE> fp, const std::string &path) : fp_(fp), path_(path) {}
+    File(std::shared_ptr<DIR> dir, const std::string &path, const std::string &hostPath)
+        : dir_(dir), path_(path), hostPath_(hostPath) {}
+    explicit operator bool() const { return (bool)fp_ || (bool)dir_; }
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buf, size_t len) override;
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override;
+    size_t read(uint8_t *buf, size_t len);
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    size_t position() const;
+    size_t size() const;
+    void close() { fp_.reset(); dir_.reset(); }
+    const char *path() const { return path_.c_str(); }
+    const char *name() const;
+    bool isDirectory() const { return (bool)dir_; }
+    File openNextFile(const char *mode = "r");
+    void rewindDirectory();
+
+private:
+    std::shared_ptr<FILE> fp_;
+    std::shared_ptr<DIR> dir_;
+    std::string path_;
+    std::string hostPath_;
+};
+
+class FS {
+public:
+    File open(const char *path, const char *mode = "r", bool create = false);
+    File open(const String &path, const char *mode = "r", bool create = false) { return open(path.c_str(), mode, create); }
+    bool exists(const char *path);
+    bool exists(const String &path) { return exists(path.c_str()); }
+    bool remove(const char *path);
+    bool remove(const String &path) { return remove(path.c_str()); }
+    bool rename(const char *from, const char *to);
+    bool mkdir(const char *path);
+    bool rmdir(const char *path);
+
+protected:
+    std::string hostPath(const char *path) const;
+    std::string root_;
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+// Root directory for LittleFS/SD on the host (default ./esp32mic_fs).
+void host_fs_set_root(const char *dir);
+const char *host_fs_root();
+
+// Fault injection: the writes that follow take `bytes` more bytes, then one write comes up
+// short and the budget is off again (a full or failing flash). -1 turns it off.
+void host_fs_fail_write_after(long bytes);
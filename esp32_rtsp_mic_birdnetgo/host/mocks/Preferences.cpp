@@ -0,0 +1,160 @@
+#include "Preferences.h"
+
+#include <stdio.h>
+
+#include <fstream>
+#include <sstream>
+
+namespace {
+std::map<std::string, std::string> g_store;  // "<namespace>/<key>" -> value
+std::string g_file;
+bool g_loaded = false;
+uint32_t g_writes = 0;
+
+void loadOnce() {
+    if (g_loaded) return;
+    g_loaded = true;
+    if (g_file.empty()) return;
+    std::ifstream in(g_file);
+    std::string line;
+    while (std::getline(in, line)) {
+        size_t eq = line.find('=');
+        if (eq == std::string::npos) continue;
+        g_store[line.substr(0, eq)] = line.substr(eq + 1);
+    }
+}
+
+void saveAll() {
+    if (g_file.empty()) return;
+    std::ofstream out(g_file, std::ios::trunc);
+    for (const auto &kv : g_store) out << kv.first << '=' << kv.second << '\n';
+}
+}  // namespace
+
+void host_prefs_set_file(const char *path) {
+    g_file = path ? path : "";
+    g_loaded = false;
+    loadOnce();
+}
+
+uint32_t host_prefs_write_count() { return g_writes; }
+
+bool Preferences::begin(const char *name, bool readOnly, const char *) {
+    loadOnce();
+    ns_ = name ? name : "";
+    readOnly_ = readOnly;
+    open_ = true;
+    return true;
+}
+
+void Preferences::end() {
+    if (open_ && !readOnly_) saveAll();
+    open_ = false;
+}
+
+bool Preferences::clear() {
+    if (!open_ || readOnly_) return false;
+    std::string prefix = ns_ + "/";
+    for (auto it = g_store.begin(); it != g_store.end();) {
+        if (it->first.compare(0, prefix.size(), prefix) == 0) it = g_store.erase(it);
+        else ++it;
+    }
+    return true;
+}
+
+bool Preferences::remove(const char *key) {
+    if (!open_ || readOnly_) return false;
+    return g_store.erase(ns_ + "/" + key) > 0;
+}
+
+bool Preferences::isKey(const char *key) { return find(key) != nullptr; }
+
+// Default 20 KB NVS partition: 4 usable pages of 126 entries (one page stays free for GC).
+size_t Preferences::freeEntries() {
+    const size_t total = 4 * 126;
+    return g_store.size() < total ? total - g_store.size() : 0;
+}
+
+size_t Preferences::put(const char *key, const std::string &v, size_t len) {
+    if (!open_ || readOnly_ || !key) return 0;
+    g_store[ns_ + "/" + key] = v;
+    g_writes++;
+    return len;
+}
+
+const std::string *Preferences::find(const char *key) {
+    if (!open_ || !key) return nullptr;
+    auto it = g_store.find(ns_ + "/" + key);
+    return it == g_store.end() ? nullptr : &it->second;
+}
+
+size_t Preferences::putFloat(const char *key, float v) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.9g", (double)v);
+    return put(key, buf, 4);
+}
+
+size_t Preferences::putBytes(const char *key, const void *v, size_t len) {
+    std::string hex;
+    const uint8_t *p = (const uint8_t *)v;
+    char b[3];
+    for (size_t i = 0; i < len; ++i) {
+        snprintf(b, sizeof(b), "%02x", p[i]);
+        hex += b;
+    }
+    return put(key, hex, len);
+}
+
+bool Preferences::getBool(const char *key, bool def) {
+    const std::string *v = find(key);
+    return v ? (*v == "1") : def;
+}
+
+uint8_t Preferences::getUChar(const char *key, uint8_t def) {
+    const std::string *v = find(key);
+    return v ? (uint8_t)strtoul(v->c_str(), nullptr, 10) : def;
+}
+
+uint16_t Preferences::getUShort(const char *key, uint16_t def) {
+    const std::string *v = find(key);
+    return v ? (uint16_t)strtoul(v->c_str(), nullptr, 10) : def;
+}
+
+int32_t Preferences::getInt(const char *key, int32_t def) {
+    const std::string *v = find(key);
+    return v ? (int32_t)strtol(v->c_str(), nullptr, 10) : def;
+}
+
+uint32_t Preferences::getUInt(const char *key, uint32_t def) {
+    const std::string *v = find(key);
+    return v ? (uint32_t)strtoul(v->c_str(), nullptr, 10) : def;
+}
+
+uint64_t Preferences::getULong64(const char *key, uint64_t def) {
+    const std::string *v = find(key);
+    return v ? (uint64_t)strtoull(v->c_str(), nullptr, 10) : def;
+}
+
+float Preferences::getFloat(const char *key, float def) {
+    const std::string *v = find(key);
+    return v ? strtof(v->c_str(), nullptr) : def;
+}
+
+String Preferences::getString(const char *key, const String &def) {
+    const std::string *v = find(key);
+    return v ? String(*v) : def;
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+    const std::string *v = find(key);
+    return v ? v->size() / 2 : 0;
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) {
+    const std::string *v = find(key);
+    if (!v) return 0;
+    size_t n = std::min(maxLen, v->size() / 2);
+    uint8_t *p = (uint8_t *)buf;
+    for (size_t i = 0; i < n; ++i) p[i] = (uint8_t)strtoul(v->substr(i * 2, 2).c_str(), nullptr, 16);
+    return n;
+}
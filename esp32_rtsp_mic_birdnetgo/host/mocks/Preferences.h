@@ -0,0 +1,50 @@
+#pragma once
+// Host build: NVS Preferences kept in memory, optionally loaded from / saved to a
+// flat file (see host_prefs_set_file()). Write counters let benchmarks assert
+// how many keys a code path actually persisted.
+#include <Arduino.h>
+
+#include <map>
+#include <string>
+
+void host_prefs_set_file(const char *path);
+uint32_t host_prefs_write_count();
+
+class Preferences {
+public:
+    bool begin(const char *name, bool readOnly = false, const char *partition = nullptr);
+    void end();
+    bool clear();
+    bool remove(const char *key);
+    bool isKey(const char *key);
+    size_t freeEntries();
+
+    size_t putBool(const char *key, bool v) { return put(key, v ? "1" : "0", 1); }
+    size_t putUChar(const char *key, uint8_t v) { return put(key, std::to_string(v), 1); }
+    size_t putUShort(const char *key, uint16_t v) { return put(key, std::to_string(v), 2); }
+    size_t putInt(const char *key, int32_t v) { return put(key, std::to_string(v), 4); }
+    size_t putUInt(const char *key, uint32_t v) { return put(key, std::to_string(v), 4); }
+    size_t putULong64(const char *key, uint64_t v) { return put(key, std::to_string(v), 8); }
+    size_t putFloat(const char *key, float v);
+    size_t putString(const char *key, const String &v) { return put(key, v.str(), v.length() + 1); }
+    size_t putString(const char *key, const char *v) { return put(key, v ? v : "", v ? strlen(v) + 1 : 1); }
+    size_t putBytes(const char *key, const void *v, size_t len);
+
+    bool getBool(const char *key, bool def = false);
+    uint8_t getUChar(const char *key, uint8_t def = 0);
+    uint16_t getUShort(const char *key, uint16_t def = 0);
+    int32_t getInt(const char *key, int32_t def = 0);
+    uint32_t getUInt(const char *key, uint32_t def = 0);
+    uint64_t getULong64(const char *key, uint64_t def = 0);
+    float getFloat(const char *key, float def = NAN);
+    String getString(const char *key, const String &def = String());
+    size_t getBytesLength(const char *key);
+    size_t getBytes(const char *key, void *buf, size_t maxLen);
+
+private:
+    size_t put(const char *key, const std::string &v, size_t len);
+    const std::string *find(const char *key);
+    std::string ns_;
+    bool open_ = false;
+    bool readOnly_ = false;
+};
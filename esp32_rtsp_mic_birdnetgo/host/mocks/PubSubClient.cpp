@@ -0,0 +1,235 @@
+#include "PubSubClient.h"
+
+#include <poll.h>
+
+static void putString(std::vector<uint8_t> &b, const char *s) {
+    size_t n = s ? strlen(s) : 0;
+    b.push_back((uint8_t)(n >> 8));
+    b.push_back((uint8_t)(n & 0xFF));
+    if (n) b.insert(b.end(), s, s + n);
+}
+
+static void putRemainingLength(std::vector<uint8_t> &out, size_t len) {
+    do {
+        uint8_t d = len % 128;
+        len /= 128;
+        if (len) d |= 0x80;
+        out.push_back(d);
+    } while (len);
+}
+
+PubSubClient &PubSubClient::setServer(const char *domain, uint16_t port) {
+    host_ = domain ? domain : "";
+    port_ = port;
+    return *this;
+}
+
+PubSubClient &PubSubClient::setCallback(MQTT_CALLBACK_SIGNATURE) {
+    callback_ = callback;
+    return *this;
+}
+
+bool PubSubClient::writeAll(const uint8_t *d, size_t n) {
+    size_t off = 0;
+    unsigned long start = millis();
+    WiFiClient *wc = static_cast<WiFiClient *>(client_);
+    while (off < n) {
+        if (!client_->connected()) return false;
+        size_t w = client_->write(d + off, n - off);
+        if (w > 0) { off += w; continue; }
+        if (millis() - start > (unsigned long)socketTimeoutSec_ * 1000UL) return false;
+        struct pollfd p = {wc->fd(), POLLOUT, 0};
+        ::poll(&p, 1, 10);
+    }
+    lastOutMs_ = millis();
+    return true;
+}
+
+bool PubSubClient::sendPacket(uint8_t header, const std::vector<uint8_t> &body) {
+    std::vector<uint8_t> pkt;
+    pkt.push_back(header);
+    putRemainingLength(pkt, body.size());
+    pkt.insert(pkt.end(), body.begin(), body.end());
+    return writeAll(pkt.data(), pkt.size());
+}
+
+bool PubSubClient::readPacket(uint8_t &header, std::vector<uint8_t> &body, uint32_t timeoutMs) {
+    unsigned long start = millis();
+    WiFiClient *wc = static_cast<WiFiClient *>(client_);
+    auto readByte = [&](uint8_t &out) -> bool {
+        while (true) {
+            int c = client_->read();
+            if (c >= 0) { out = (uint8_t)c; return true; }
+            if (!client_->connected() || millis() - start > timeoutMs) return false;
+            struct pollfd p = {wc->fd(), POLLIN, 0};
+            ::poll(&p, 1, 10);
+        }
+    };
+    if (!readByte(header)) return false;
+    size_t len = 0, mult = 1;
+    for (int i = 0; i < 4; ++i) {
+        uint8_t d;
+        if (!readByte(d)) return false;
+        len += (d & 0x7F) * mult;
+        mult *= 128;
+        if (!(d & 0x80)) break;
+    }
+    body.resize(len);
+    for (size_t i = 0; i < len; ++i) {
+        if (!readByte(body[i])) return false;
+    }
+    lastInMs_ = millis();
+    return true;
+}
+
+bool PubSubClient::connect(const char *id, const char *willTopic, uint8_t willQos, bool willRetain,
+                           const char *willMessage) {
+    return connect(id, nullptr, nullptr, willTopic, willQos, willRetain, willMessage);
+}
+
+bool PubSubClient::connect(const char *id, const char *user, const char *pass, const char *willTopic,
+                           uint8_t willQos, bool willRetain, const char *willMessage) {
+    if (connected()) return true;
+    WiFiClient *wc = static_cast<WiFiClient *>(client_);
+    if (!wc->connect(host_.c_str(), port_, (int32_t)socketTimeoutSec_ * 1000)) {
+        state_ = MQTT_CONNECT_FAILED;
+        return false;
+    }
+    std::vector<uint8_t> b;
+    putString(b, "MQTT");
+    b.push_back(4);
+    uint8_t flags = 0x02;  // clean session
+    if (willTopic) flags |= 0x04 | (uint8_t)((willQos & 3) << 3) | (willRetain ? 0x20 : 0);
+    if (user) flags |= 0x80;
+    if (pass) flags |= 0x40;
+    b.push_back(flags);
+    b.push_back((uint8_t)(keepAliveSec_ >> 8));
+    b.push_back((uint8_t)(keepAliveSec_ & 0xFF));
+    putString(b, id);
+    if (willTopic) {
+        putString(b, willTopic);
+        putString(b, willMessage);
+    }
+    if (user) putString(b, user);
+    if (pass) putString(b, pass);
+    if (!sendPacket(0x10, b)) {
+        state_ = MQTT_CONNECTION_LOST;
+        wc->stop();
+        return false;
+    }
+    uint8_t hdr = 0;
+    std::vector<uint8_t> ack;
+    if (!readPacket(hdr, ack, (uint32_t)socketTimeoutSec_ * 1000U) || (hdr & 0xF0) != 0x20 || ack.size() < 2) {
+        state_ = MQTT_CONNECTION_TIMEOUT;
+        wc->stop();
+        return false;
+    }
+    if (ack[1] != 0) {
+        state_ = ack[1];
+        wc->stop();
+        return false;
+    }
+    state_ = MQTT_CONNECTED;
+    pingOutstanding_ = false;
+    lastInMs_ = lastOutMs_ = millis();
+    return true;
+}
+
+void PubSubClient::disconnect() {
+    if (client_->connected()) {
+        std::vector<uint8_t> none;
+        sendPacket(0xE0, none);
+    }
+    client_->stop();
+    state_ = MQTT_DISCONNECTED;
+}
+
+bool PubSubClient::publish(const char *topic, const char *payload, bool retained) {
+    return publish(topic, (const uint8_t *)payload, payload ? (unsigned int)strlen(payload) : 0, retained);
+}
+
+bool PubSubClient::publish(const char *topic, const uint8_t *payload, unsigned int length, bool retained) {
+    if (!connected()) return false;
+    size_t topicLen = topic ? strlen(topic) : 0;
+    if (topicLen + length + 7 > bufferSize_) return false;  // mirrors the fixed client buffer
+    std::vector<uint8_t> b;
+    putString(b, topic);
+    if (length) b.insert(b.end(), payload, payload + length);
+    return sendPacket((uint8_t)(0x30 | (retained ? 1 : 0)), b);
+}
+
+bool PubSubClient::beginPublish(const char *topic, unsigned int length, bool retained) {
+    if (!connected()) return false;
+    std::vector<uint8_t> hdr;
+    hdr.push_back((uint8_t)(0x30 | (retained ? 1 : 0)));
+    size_t topicLen = topic ? strlen(topic) : 0;
+    putRemainingLength(hdr, topicLen + 2 + length);
+    putString(hdr, topic);
+    streamRemaining_ = length;
+    return writeAll(hdr.data(), hdr.size());
+}
+
+size_t PubSubClient::write(const uint8_t *buf, size_t size) {
+    if (size > streamRemaining_) size = streamRemaining_;
+    if (!writeAll(buf, size)) return 0;
+    streamRemaining_ -= size;
+    return size;
+}
+
+int PubSubClient::endPublish() { return streamRemaining_ == 0 ? 1 : 0; }
+
+bool PubSubClient::subscribe(const char *topic, uint8_t qos) {
+    if (!connected()) return false;
+    std::vector<uint8_t> b;
+    uint16_t id = nextMsgId_++;
+    b.push_back((uint8_t)(id >> 8));
+    b.push_back((uint8_t)(id & 0xFF));
+    putString(b, topic);
+    b.push_back(qos > 1 ? 1 : qos);
+    return sendPacket(0x82, b);
+}
+
+bool PubSubClient::loop() {
+    if (!connected()) return false;
+    unsigned long now = millis();
+    unsigned long ka = (unsigned long)keepAliveSec_ * 1000UL;
+    if (ka && (now - lastInMs_ > ka || now - lastOutMs_ > ka)) {
+        if (pingOutstanding_) {
+            state_ = MQTT_CONNECTION_TIMEOUT;
+            client_->stop();
+            return false;
+        }
+        std::vector<uint8_t> none;
+        sendPacket(0xC0, none);
+        lastOutMs_ = lastInMs_ = now;
+        pingOutstanding_ = true;
+    }
+    while (client_->available()) {
+        uint8_t hdr;
+        std::vector<uint8_t> body;
+        if (!readPacket(hdr, body, (uint32_t)socketTimeoutSec_ * 1000U)) break;
+        uint8_t type = hdr & 0xF0;
+        if (type == 0xD0) {
+            pingOutstanding_ = false;
+        } else if (type == 0x30 && body.size() >= 2) {
+            size_t tl = ((size_t)body[0] << 8) | body[1];
+            if (2 + tl > body.size()) continue;
+            std::string topic((const char *)body.data() + 2, tl);
+            size_t off = 2 + tl + (((hdr >> 1) & 3) ? 2 : 0);
+            if (off > body.size()) continue;
+            if (callback_) {
+                callback_(&topic[0], body.data() + off, (unsigned int)(body.size() - off));
+            }
+        } else if (type == 0xC0) {
+            std::vector<uint8_t> none;
+            sendPacket(0xD0, none);
+        }
+    }
+    return connected();
+}
+
+bool PubSubClient::connected() {
+    bool c = client_->connected();
+    if (!c && state_ == MQTT_CONNECTED) state_ = MQTT_CONNECTION_LOST;
+    return c && state_ == MQTT_CONNECTED;
+}
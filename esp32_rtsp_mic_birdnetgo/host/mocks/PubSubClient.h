@@ -0,0 +1,61 @@
+#pragma once
+// Host build: MQTT 3.1.1 client with the PubSubClient API (QoS 0 only). Talks to a
+// real broker over the WiFiClient socket, so broker outages stall exactly like on
+// the device (connect() blocks for the socket timeout).
+#include <WiFi.h>
+
+#include <functional>
+#include <vector>
+
+#define MQTT_CONNECTION_TIMEOUT -4
+#define MQTT_CONNECTION_LOST -3
+#define MQTT_CONNECT_FAILED -2
+#define MQTT_DISCONNECTED -1
+#define MQTT_CONNECTED 0
+
+#define MQTT_CALLBACK_SIGNATURE std::function<void(char *, uint8_t *, unsigned int)> callback
+
+class PubSubClient {
+public:
+    explicit PubSubClient(Client &client) : client_(&client) {}
+
+    PubSubClient &setServer(const char *domain, uint16_t port);
+    PubSubClient &setCallback(MQTT_CALLBACK_SIGNATURE);
+    PubSubClient &setKeepAlive(uint16_t sec) { keepAliveSec_ = sec; return *this; }
+    PubSubClient &setSocketTimeout(uint16_t sec) { socketTimeoutSec_ = sec; return *this; }
+    bool setBufferSize(uint16_t size) { bufferSize_ = size; return true; }
+    uint16_t getBufferSize() const { return bufferSize_; }
+
+    bool connect(const char *id, const char *willTopic, uint8_t willQos, bool willRetain, const char *willMessage);
+    bool connect(const char *id, const char *user, const char *pass, const char *willTopic,
+                 uint8_t willQos, bool willRetain, const char *willMessage);
+    void disconnect();
+    bool publish(const char *topic, const char *payload, bool retained = false);
+    bool publish(const char *topic, const uint8_t *payload, unsigned int length, bool retained = false);
+    bool beginPublish(const char *topic, unsigned int length, bool retained);
+    size_t write(const uint8_t *buf, size_t size);
+    int endPublish();
+    bool subscribe(const char *topic, uint8_t qos = 0);
+    bool loop();
+    bool connected();
+    int state() const { return state_; }
+
+private:
+    bool sendPacket(uint8_t header, const std::vector<uint8_t> &body);
+    bool readPacket(uint8_t &header, std::vector<uint8_t> &body, uint32_t timeoutMs);
+    bool writeAll(const uint8_t *d, size_t n);
+
+    Client *client_;
+    std::string host_;
+    uint16_t port_ = 1883;
+    std::function<void(char *, uint8_t *, unsigned int)> callback_;
+    uint16_t keepAliveSec_ = 15;
+    uint16_t socketTimeoutSec_ = 15;
+    uint16_t bufferSize_ = 256;
+    int state_ = MQTT_DISCONNECTED;
+    unsigned long lastOutMs_ = 0;
+    unsigned long lastInMs_ = 0;
+    bool pingOutstanding_ = false;
+    uint16_t nextMsgId_ = 1;
+    size_t streamRemaining_ = 0;
+};
@@ -0,0 +1,118 @@
+#include "WString.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
+
+static std::string fmtInteger(unsigned long long v, bool neg, unsigned char base) {
+    if (base < 2 || base > 36) base = 10;
+    char buf[72];
+    int pos = (int)sizeof(buf) - 1;
+    buf[pos] = '\0';
+    do {
+        unsigned d = (unsigned)(v % base);
+        buf[--pos] = (char)(d < 10 ? '0' + d : 'a' + d - 10);
+        v /= base;
+    } while (v && pos > 1);
+    if (neg) buf[--pos] = '-';
+    return std::string(buf + pos);
+}
+
+static std::string fmtSigned(long long v, unsigned char base) {
+    if (v < 0 && base == 10) return fmtInteger((unsigned long long)(-(v + 1)) + 1ULL, true, base);
+    return fmtInteger((unsigned long long)v, false, base);
+}
+
+String::String(unsigned char v, unsigned char base) : s_(fmtInteger(v, false, base)) {}
+String::String(int v, unsigned char base) : s_(fmtSigned(v, base)) {}
+String::String(unsigned int v, unsigned char base) : s_(fmtInteger(v, false, base)) {}
+String::String(long v, unsigned char base) : s_(fmtSigned(v, base)) {}
+String::String(unsigned long v, unsigned char base) : s_(fmtInteger(v, false, base)) {}
+String::String(long long v, unsigned char base) : s_(fmtSigned(v, base)) {}
+String::String(unsigned long long v, unsigned char base) : s_(fmtInteger(v, false, base)) {}
+
+String::String(float v, unsigned int decimals) : String((double)v, decimals) {}
+String::String(double v, unsigned int decimals) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+    s_ = buf;
+}
+
+bool String::equalsIgnoreCase(const String &o) const {
+    return strcasecmp(s_.c_str(), o.s_.c_str()) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t p = s_.find(c, from);
+    return p == std::string::npos ? -1 : (int)p;
+}
+
+int String::indexOf(const String &s, unsigned int from) const {
+    size_t p = s_.find(s.s_, from);
+    return p == std::string::npos ? -1 : (int)p;
+}
+
+int String::lastIndexOf(char c) const {
+    size_t p = s_.rfind(c);
+    return p == std::string::npos ? -1 : (int)p;
+}
+
+bool String::endsWith(const String &p) const {
+    if (p.s_.size() > s_.size()) return false;
+    return s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+}
+
+String String::substring(unsigned int from) const {
+    if (from >= s_.size()) return String();
+    return String(s_.substr(from));
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) { unsigned int t = from; from = to; to = t; }
+    if (from >= s_.size()) return String();
+    if (to > s_.size()) to = (unsigned int)s_.size();
+    return String(s_.substr(from, to - from));
+}
+
+void String::trim() {
+    size_t b = 0;
+    while (b < s_.size() && isspace((unsigned char)s_[b])) ++b;
+    size_t e = s_.size();
+    while (e > b && isspace((unsigned char)s_[e - 1])) --e;
+    s_ = s_.substr(b, e - b);
+}
+
+void String::toLowerCase() {
+    for (auto &c : s_) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+    for (auto &c : s_) c = (char)toupper((unsigned char)c);
+}
+
+void String::remove(unsigned int index) {
+    if (index < s_.size()) s_.erase(index);
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+    if (index < s_.size()) s_.erase(index, count);
+}
+
+void String::replace(const String &from, const String &to) {
+    if (from.s_.empty()) return;
+    size_t p = 0;
+    while ((p = s_.find(from.s_, p)) != std::string::npos) {
+        s_.replace(p, from.s_.size(), to.s_);
+        p += to.s_.size();
+    }
+}
+
+long String::toInt() const { return strtol(s_.c_str(), nullptr, 10); }
+float String::toFloat() const { return strtof(s_.c_str(), nullptr); }
+
+String operator+(const String &a, const String &b) { String r(a); r += b; return r; }
+String operator+(const String &a, const char *b) { String r(a); r += b; return r; }
+String operator+(const char *a, const String &b) { String r(a); r += b; return r; }
+String operator+(const String &a, char b) { String r(a); r += b; return r; }
+String operator+(const String &a, const __FlashStringHelper *b) { String r(a); r += b; return r; }
@@ -0,0 +1,96 @@
+#pragma once
+// Host build: Arduino String backed by std::string (subset used by the firmware).
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+
+class String {
+public:
+    String() {}
+    String(const char *s) : s_(s ? s : "") {}
+    String(const char *s, size_t n) : s_(s ? std::string(s, n) : std::string()) {}
+    String(const String &o) = default;
+    String(String &&o) = default;
+    String(const std::string &s) : s_(s) {}
+    String(const __FlashStringHelper *s) : s_(s ? reinterpret_cast<const char *>(s) : "") {}
+    explicit String(char c) : s_(1, c) {}
+    explicit String(unsigned char v, unsigned char base = 10);
+    explicit String(int v, unsigned char base = 10);
+    explicit String(unsigned int v, unsigned char base = 10);
+    explicit String(long v, unsigned char base = 10);
+    explicit String(unsigned long v, unsigned char base = 10);
+    explicit String(long long v, unsigned char base = 10);
+    explicit String(unsigned long long v, unsigned char base = 10);
+    explicit String(float v, unsigned int decimals = 2);
+    explicit String(double v, unsigned int decimals = 2);
+
+    String &operator=(const String &o) = default;
+    String &operator=(String &&o) = default;
+    String &operator=(const char *s) { s_ = s ? s : ""; return *this; }
+    String &operator=(const __FlashStringHelper *s) { s_ = s ? reinterpret_cast<const char *>(s) : ""; return *this; }
+
+    unsigned int length() const { return (unsigned int)s_.size(); }
+    bool isEmpty() const { return s_.empty(); }
+    const char *c_str() const { return s_.c_str(); }
+    bool reserve(unsigned int n) { s_.reserve(n); return true; }
+
+    char operator[](unsigned int i) const { return i < s_.size() ? s_[i] : 0; }
+    char &operator[](unsigned int i) { return s_[i]; }
+    char charAt(unsigned int i) const { return (*this)[i]; }
+
+    bool concat(const String &o) { s_ += o.s_; return true; }
+    bool concat(const char *s) { if (s) s_ += s; return true; }
+    bool concat(const char *s, unsigned int n) { if (s) s_.append(s, n); return true; }
+    bool concat(char c) { s_ += c; return true; }
+    template <typename T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, char>::value, int>::type = 0>
+    bool concat(T v) { s_ += String(v).s_; return true; }
+
+    String &operator+=(const String &o) { concat(o); return *this; }
+    String &operator+=(const char *s) { concat(s); return *this; }
+    String &operator+=(const __FlashStringHelper *s) { concat(reinterpret_cast<const char *>(s)); return *this; }
+    String &operator+=(char c) { concat(c); return *this; }
+    template <typename T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, char>::value, int>::type = 0>
+    String &operator+=(T v) { concat(v); return *this; }
+
+    bool operator==(const String &o) const { return s_ == o.s_; }
+    bool operator==(const char *s) const { return s_ == (s ? s : ""); }
+    bool operator!=(const String &o) const { return s_ != o.s_; }
+    bool operator!=(const char *s) const { return !(*this == s); }
+    bool operator<(const String &o) const { return s_ < o.s_; }
+    bool equals(const String &o) const { return s_ == o.s_; }
+    bool equalsIgnoreCase(const String &o) const;
+
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String &s, unsigned int from = 0) const;
+    int lastIndexOf(char c) const;
+    bool startsWith(const String &p) const { return s_.compare(0, p.s_.size(), p.s_) == 0; }
+    bool endsWith(const String &p) const;
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    void remove(unsigned int index);
+    void remove(unsigned int index, unsigned int count);
+    void replace(const String &from, const String &to);
+    long toInt() const;
+    float toFloat() const;
+
+    const std::string &str() const { return s_; }
+
+private:
+    std::string s_;
+};
+
+String operator+(const String &a, const String &b);
+String operator+(const String &a, const char *b);
+String operator+(const char *a, const String &b);
+String operator+(const String &a, char b);
+String operator+(const String &a, const __FlashStringHelper *b);
+template <typename T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, char>::value, int>::type = 0>
+String operator+(const String &a, T v) { String r(a); r += v; return r; }
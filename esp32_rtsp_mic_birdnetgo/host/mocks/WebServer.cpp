@@ -0,0 +1,251 @@
+#include "WebServer.h"
+
+#include <ctype.h>
+#include <errno.h>
+#include <poll.h>
+#include <strings.h>
+#include <sys/socket.h>
+
+static const char *statusText(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 206: return "Partial Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 403: return "Forbidden";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 409: return "Conflict";
+        case 416: return "Range Not Satisfiable";
+        case 429: return "Too Many Requests";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default: return "";
+    }
+}
+
+static String urlDecode(const String &in) {
+    std::string out;
+    const char *s = in.c_str();
+    for (size_t i = 0; s[i]; ++i) {
+        if (s[i] == '+') out += ' ';
+        else if (s[i] == '%' && isxdigit((unsigned char)s[i + 1]) && isxdigit((unsigned char)s[i + 2])) {
+            char h[3] = {s[i + 1], s[i + 2], 0};
+            out += (char)strtol(h, nullptr, 16);
+            i += 2;
+        } else out += s[i];
+    }
+    return String(out);
+}
+
+WebServer::WebServer(int port) : server_((uint16_t)port) {}
+
+void WebServer::begin() { server_.begin(); }
+void WebServer::stop() { server_.stop(); }
+
+void WebServer::on(const String &uri, HTTPMethod method, THandlerFunction fn) {
+    routes_.push_back({uri, method, fn});
+}
+
+void WebServer::collectHeaders(const char *headerKeys[], size_t count) {
+    wantedHeaders_.clear();
+    for (size_t i = 0; i < count; ++i) wantedHeaders_.push_back(String(headerKeys[i]));
+}
+
+String WebServer::arg(const String &name) const {
+    for (const auto &kv : args_) if (kv.key == name) return kv.value;
+    return String();
+}
+String WebServer::arg(int i) const { return (i >= 0 && i < (int)args_.size()) ? args_[i].value : String(); }
+String WebServer::argName(int i) const { return (i >= 0 && i < (int)args_.size()) ? args_[i].key : String(); }
+bool WebServer::hasArg(const String &name) const {
+    for (const auto &kv : args_) if (kv.key == name) return true;
+    return false;
+}
+String WebServer::header(const String &name) const {
+    for (const auto &kv : headers_) if (kv.key.equalsIgnoreCase(name)) return kv.value;
+    return String();
+}
+bool WebServer::hasHeader(const String &name) const {
+    for (const auto &kv : headers_) if (kv.key.equalsIgnoreCase(name)) return true;
+    return false;
+}
+
+void WebServer::parseArgs(const String &data) {
+    int start = 0;
+    while (start < (int)data.length()) {
+        int amp = data.indexOf('&', start);
+        if (amp < 0) amp = data.length();
+        String pair = data.substring(start, amp);
+        if (pair.length()) {
+            int eq = pair.indexOf('=');
+            if (eq < 0) args_.push_back({urlDecode(pair), String()});
+            else args_.push_back({urlDecode(pair.substring(0, eq)), urlDecode(pair.substring(eq + 1))});
+        }
+        start = amp + 1;
+    }
+}
+
+bool WebServer::readRequest() {
+    std::string buf;
+    size_t headerEnd = std::string::npos;
+    unsigned long start = millis();
+    char tmp[1024];
+    while (headerEnd == std::string::npos) {
+        int n = client_.read((uint8_t *)tmp, sizeof(tmp));
+        if (n > 0) {
+            buf.append(tmp, (size_t)n);
+            headerEnd = buf.find("\r\n\r\n");
+            continue;
+        }
+        if (!client_.connected() || millis() - start > 1000 || buf.size() > 16384) return false;
+        struct pollfd p = {client_.fd(), POLLIN, 0};
+        ::poll(&p, 1, 20);
+    }
+    std::string head = buf.substr(0, headerEnd);
+    std::string body = buf.substr(headerEnd + 4);
+
+    size_t lineEnd = head.find("\r\n");
+    std::string reqLine = head.substr(0, lineEnd);
+    size_t sp1 = reqLine.find(' ');
+    size_t sp2 = reqLine.find(' ', sp1 + 1);
+    if (sp1 == std::string::npos || sp2 == std::string::npos) return false;
+    std::string m = reqLine.substr(0, sp1);
+    std::string target = reqLine.substr(sp1 + 1, sp2 - sp1 - 1);
+    method_ = (m == "POST") ? HTTP_POST : (m == "HEAD") ? HTTP_HEAD : (m == "PUT") ? HTTP_PUT
+            : (m == "DELETE") ? HTTP_DELETE : (m == "OPTIONS") ? HTTP_OPTIONS : HTTP_GET;
+
+    args_.clear();
+    headers_.clear();
+    size_t q = target.find('?');
+    uri_ = String(target.substr(0, q));
+    if (q != std::string::npos) parseArgs(String(target.substr(q + 1)));
+
+    size_t contentLen = 0;
+    bool formBody = false;
+    size_t pos = (lineEnd == std::string::npos) ? head.size() : lineEnd + 2;
+    while (pos < head.size()) {
+        size_t e = head.find("\r\n", pos);
+        if (e == std::string::npos) e = head.size();
+        std::string line = head.substr(pos, e - pos);
+        size_t c = line.find(':');
+        if (c != std::string::npos) {
+            String k(line.substr(0, c));
+            String v(line.substr(c + 1));
+            v.trim();
+            if (k.equalsIgnoreCase("Content-Length")) contentLen = (size_t)v.toInt();
+            if (k.equalsIgnoreCase("Content-Type") && v.startsWith("application/x-www-form-urlencoded")) formBody = true;
+            for (const auto &w : wantedHeaders_) {
+                if (w.equalsIgnoreCase(k)) headers_.push_back({w, v});
+            }
+        }
+        pos = e + 2;
+    }
+    while (body.size() < contentLen && client_.connected() && millis() - start < 2000) {
+        int n = client_.read((uint8_t *)tmp, sizeof(tmp));
+        if (n > 0) body.append(tmp, (size_t)n);
+        else {
+            struct pollfd p = {client_.fd(), POLLIN, 0};
+            ::poll(&p, 1, 20);
+        }
+    }
+    if (formBody && !body.empty()) parseArgs(String(body));
+    else if (!body.empty()) args_.push_back({String("plain"), String(body)});
+    return true;
+}
+
+void WebServer::handleClient() {
+    WiFiClient c = server_.accept();
+    if (!c) return;
+    client_ = c;
+    responseHeaders_.clear();
+    contentLength_ = CONTENT_LENGTH_NOT_SET;
+    chunked_ = false;
+    headSent_ = false;
+    if (readRequest()) {
+        bool handled = false;
+        for (const auto &r : routes_) {
+            if (r.uri == uri_ && (r.method == HTTP_ANY || r.method == method_ ||
+                                  (r.method == HTTP_GET && method_ == HTTP_HEAD))) {
+                r.fn();
+                handled = true;
+                break;
+            }
+        }
+        if (!handled) {
+            if (notFound_) notFound_();
+            else send(404, "text/plain", "Not found: " + uri_);
+        }
+        finishResponse();
+    }
+    // Like the ESP32 core, only drop our reference; a handler may have kept a copy.
+    client_ = WiFiClient();
+}
+
+bool WebServer::writeRaw(const char *data, size_t len) {
+    size_t off = 0;
+    unsigned long start = millis();
+    while (off < len) {
+        if (!client_.connected()) return false;
+        size_t w = client_.write((const uint8_t *)data + off, len - off);
+        if (w > 0) {
+            off += w;
+            continue;
+        }
+        if (millis() - start > 5000) return false;
+        struct pollfd p = {client_.fd(), POLLOUT, 0};
+        ::poll(&p, 1, 20);
+    }
+    return true;
+}
+
+void WebServer::sendHeader(const String &name, const String &value, bool first) {
+    if (first) responseHeaders_.insert(responseHeaders_.begin(), {name, value});
+    else responseHeaders_.push_back({name, value});
+}
+
+void WebServer::sendHead(int code, const char *contentType, size_t len) {
+    String h = "HTTP/1.1 " + String(code) + " " + statusText(code) + "\r\n";
+    if (contentType && *contentType) h += String("Content-Type: ") + contentType + "\r\n";
+    if (len == CONTENT_LENGTH_UNKNOWN) {
+        chunked_ = true;
+        h += "Transfer-Encoding: chunked\r\n";
+    } else {
+        h += "Content-Length: " + String((unsigned long)len) + "\r\n";
+    }
+    for (const auto &kv : responseHeaders_) h += kv.key + ": " + kv.value + "\r\n";
+    h += "Connection: close\r\n\r\n";
+    responseHeaders_.clear();
+    headSent_ = true;
+    writeRaw(h.c_str(), h.length());
+}
+
+void WebServer::send(int code, const char *contentType, const String &content) {
+    size_t len = (contentLength_ == CONTENT_LENGTH_NOT_SET) ? content.length() : contentLength_;
+    sendHead(code, contentType, len);
+    if (content.length()) sendContent(content.c_str(), content.length());
+}
+
+void WebServer::send_P(int code, PGM_P contentType, PGM_P content, size_t len) {
+    sendHead(code, contentType, len);
+    if (method_ != HTTP_HEAD) writeRaw(content, len);
+}
+
+void WebServer::sendContent(const char *content, size_t len) {
+    if (method_ == HTTP_HEAD) return;
+    if (chunked_) {
+        char hdr[16];
+        snprintf(hdr, sizeof(hdr), "%zx\r\n", len);
+        writeRaw(hdr, strlen(hdr));
+        if (len) writeRaw(content, len);
+        writeRaw("\r\n", 2);
+        if (len == 0) chunked_ = false;
+        return;
+    }
+    writeRaw(content, len);
+}
+
+void WebServer::finishResponse() {
+    if (chunked_) sendContent("", 0);
+}
@@ -0,0 +1,70 @@
+#pragma once
+// Host build: small synchronous HTTP/1.1 server with the WebServer API subset the
+// firmware uses (one request per connection, form/query args, chunked responses).
+#include <WiFi.h>
+
+#include <functional>
+#include <vector>
+
+enum HTTPMethod { HTTP_ANY = 0, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+class WebServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    explicit WebServer(int port = 80);
+    void begin();
+    void stop();
+    void handleClient();
+    void on(const String &uri, THandlerFunction fn) { on(uri, HTTP_ANY, fn); }
+    void on(const String &uri, HTTPMethod method, THandlerFunction fn);
+    void onNotFound(THandlerFunction fn) { notFound_ = fn; }
+    void collectHeaders(const char *headerKeys[], size_t count);
+
+    String uri() const { return uri_; }
+    HTTPMethod method() const { return method_; }
+    WiFiClient client() { return client_; }
+
+    String arg(const String &name) const;
+    String arg(int i) const;
+    String argName(int i) const;
+    int args() const { return (int)args_.size(); }
+    bool hasArg(const String &name) const;
+    String header(const String &name) const;
+    bool hasHeader(const String &name) const;
+
+    void setContentLength(size_t len) { contentLength_ = len; }
+    void sendHeader(const String &name, const String &value, bool first = false);
+    void send(int code, const char *contentType = nullptr, const String &content = String());
+    void send(int code, const String &contentType, const String &content) { send(code, contentType.c_str(), content); }
+    void send_P(int code, PGM_P contentType, PGM_P content, size_t len);
+    void sendContent(const String &content) { sendContent(content.c_str(), content.length()); }
+    void sendContent(const char *content, size_t len);
+
+private:
+    struct Route { String uri; HTTPMethod method; THandlerFunction fn; };
+    struct KV { String key; String value; };
+
+    bool readRequest();
+    void parseArgs(const String &data);
+    void sendHead(int code, const char *contentType, size_t len);
+    bool writeRaw(const char *data, size_t len);
+    void finishResponse();
+
+    WiFiServer server_;
+    std::vector<Route> routes_;
+    THandlerFunction notFound_;
+    std::vector<String> wantedHeaders_;
+    WiFiClient client_;
+    String uri_;
+    HTTPMethod method_ = HTTP_GET;
+    std::vector<KV> args_;
+    std::vector<KV> headers_;
+    std::vector<KV> responseHeaders_;
+    size_t contentLength_ = CONTENT_LENGTH_NOT_SET;
+    bool chunked_ = false;
+    bool headSent_ = false;
+};
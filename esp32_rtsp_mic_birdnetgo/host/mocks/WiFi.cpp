@@ -0,0 +1,301 @@
+#include "WiFi.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+struct HostSocket {
+    int fd = -1;
+    explicit HostSocket(int f) : fd(f) {}
+    ~HostSocket() {
+        if (fd >= 0) ::close(fd);
+    }
+};
+
+static void setNonBlocking(int fd) {
+    int fl = fcntl(fd, F_GETFL, 0);
+    if (fl >= 0) fcntl(fd, F_SETFL, fl | O_NONBLOCK);
+}
+
+uint16_t host_map_port(uint16_t port) {
+    return (port < 1024) ? (uint16_t)(port + HOST_PRIVILEGED_PORT_OFFSET) : port;
+}
+
+// ---------------- IPAddress ----------------
+
+bool IPAddress::fromString(const char *s) {
+    struct in_addr a;
+    if (!s || inet_pton(AF_INET, s, &a) != 1) return false;
+    addr_ = a.s_addr;
+    return true;
+}
+
+String IPAddress::toString() const {
+    char buf[20];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(buf);
+}
+
+// ---------------- WiFiClient ----------------
+
+WiFiClient::WiFiClient() {}
+WiFiClient::WiFiClient(int fd) : sock_(std::make_shared<HostSocket>(fd)) { setNonBlocking(fd); }
+WiFiClient::~WiFiClient() {}
+
+int WiFiClient::fd() const { return sock_ ? sock_->fd : -1; }
+
+int WiFiClient::connect(IPAddress ip, uint16_t port) { return connect(ip, port, 3000); }
+
+int WiFiClient::connect(IPAddress ip, uint16_t port, int32_t timeoutMs) {
+    stop();
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return 0;
+    setNonBlocking(fd);
+    struct sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(port);
+    sa.sin_addr.s_addr = (uint32_t)ip;
+    int r = ::connect(fd, (struct sockaddr *)&sa, sizeof(sa));
+    if (r < 0 && errno != EINPROGRESS) {
+        ::close(fd);
+        return 0;
+    }
+    if (r < 0) {
+        struct pollfd p = {fd, POLLOUT, 0};
+        // The ESP32 core blocks in select() for the whole timeout; keep that behaviour
+        // so stalls caused by unreachable peers are reproduced on the host.
+        int pr = ::poll(&p, 1, (int)(timeoutMs / host_speed()));
+        int err = 0;
+        socklen_t len = sizeof(err);
+        if (pr <= 0 || getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err != 0) {
+            ::close(fd);
+            return 0;
+        }
+    }
+    sock_ = std::make_shared<HostSocket>(fd);
+    return 1;
+}
+
+int WiFiClient::connect(const char *host, uint16_t port) { return connect(host, port, 3000); }
+
+int WiFiClient::connect(const char *host, uint16_t port, int32_t timeoutMs) {
+    IPAddress ip;
+    if (!ip.fromString(host)) {
+        struct addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        struct addrinfo *res = nullptr;
+        if (getaddrinfo(host, nullptr, &hints, &res) != 0 || !res) return 0;
+        ip = IPAddress((uint32_t)((struct sockaddr_in *)res->ai_addr)->sin_addr.s_addr);
+        freeaddrinfo(res);
+    }
+    return connect(ip, port, timeoutMs);
+}
+
+size_t WiFiClient::write(uint8_t c) { return write(&c, 1); }
+
+size_t WiFiClient::write(const uint8_t *buf, size_t size) {
+    if (!sock_ || sock_->fd < 0 || size == 0) return 0;
+    ssize_t n = ::send(sock_->fd, buf, size, MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (n < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) stop();
+        return 0;
+    }
+    return (size_t)n;
+}
+
+int WiFiClient::availableForWrite() {
+    // lwIP reports no free-space query either; callers must treat 0 as "unknown".
+    return 0;
+}
+
+int WiFiClient::available() {
+    if (!sock_ || sock_->fd < 0) return 0;
+    int n = 0;
+    if (ioctl(sock_->fd, FIONREAD, &n) < 0) return 0;
+    return n;
+}
+
+int WiFiClient::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t *buf, size_t size) {
+    if (!sock_ || sock_->fd < 0) return -1;
+    ssize_t n = ::recv(sock_->fd, buf, size, MSG_DONTWAIT);
+    if (n == 0) {
+        stop();
+        return -1;
+    }
+    if (n < 0) return -1;
+    return (int)n;
+}
+
+int WiFiClient::peek() {
+    if (!sock_ || sock_->fd < 0) return -1;
+    uint8_t c;
+    ssize_t n = ::recv(sock_->fd, &c, 1, MSG_DONTWAIT | MSG_PEEK);
+    return n == 1 ? c : -1;
+}
+
+void WiFiClient::stop() {
+    if (sock_ && sock_->fd >= 0) {
+        ::shutdown(sock_->fd, SHUT_RDWR);
+        ::close(sock_->fd);
+        sock_->fd = -1;
+    }
+    sock_.reset();
+}
+
+uint8_t WiFiClient::connected() {
+    if (!sock_ || sock_->fd < 0) return 0;
+    uint8_t c;
+    ssize_t n = ::recv(sock_->fd, &c, 1, MSG_DONTWAIT | MSG_PEEK);
+    if (n == 0) return 0;
+    if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) return 0;
+    return 1;
+}
+
+int WiFiClient::setNoDelay(bool nodelay) {
+    if (!sock_ || sock_->fd < 0) return -1;
+    int v = nodelay ? 1 : 0;
+    return setsockopt(sock_->fd, IPPROTO_TCP, TCP_NODELAY, &v, sizeof(v));
+}
+
+IPAddress WiFiClient::remoteIP() const {
+    if (!sock_ || sock_->fd < 0) return IPAddress();
+    struct sockaddr_in sa;
+    socklen_t len = sizeof(sa);
+    if (getpeername(sock_->fd, (struct sockaddr *)&sa, &len) < 0) return IPAddress();
+    return IPAddress((uint32_t)sa.sin_addr.s_addr);
+}
+
+uint16_t WiFiClient::remotePort() const {
+    if (!sock_ || sock_->fd < 0) return 0;
+    struct sockaddr_in sa;
+    socklen_t len = sizeof(sa);
+    if (getpeername(sock_->fd, (struct sockaddr *)&sa, &len) < 0) return 0;
+    return ntohs(sa.sin_port);
+}
+
+IPAddress WiFiClient::localIP() const {
+    if (!sock_ || sock_->fd < 0) return IPAddress();
+    struct sockaddr_in sa;
+    socklen_t len = sizeof(sa);
+    if (getsockname(sock_->fd, (struct sockaddr *)&sa, &len) < 0) return IPAddress();
+    return IPAddress((uint32_t)sa.sin_addr.s_addr);
+}
+
+// ---------------- WiFiServer ----------------
+
+WiFiServer::WiFiServer(uint16_t port) : port_(port) {}
+
+WiFiServer::~WiFiServer() { stop(); }
+
+void WiFiServer::begin(uint16_t port) {
+    if (port) port_ = port;
+    if (listenFd_ >= 0) return;
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) return;
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(host_map_port(port_));
+    sa.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (::bind(fd, (struct sockaddr *)&sa, sizeof(sa)) < 0 || ::listen(fd, 4) < 0) {
+        fprintf(stderr, "[host] cannot listen on port %u: %s\n", host_map_port(port_), strerror(errno));
+        ::close(fd);
+        return;
+    }
+    setNonBlocking(fd);
+    listenFd_ = fd;
+}
+
+void WiFiServer::stop() {
+    if (pendingFd_ >= 0) {
+        ::close(pendingFd_);
+        pendingFd_ = -1;
+    }
+    if (listenFd_ >= 0) {
+        ::close(listenFd_);
+        listenFd_ = -1;
+    }
+}
+
+bool WiFiServer::hasClient() {
+    if (pendingFd_ >= 0) return true;
+    if (listenFd_ < 0) return false;
+    pendingFd_ = ::accept(listenFd_, nullptr, nullptr);
+    return pendingFd_ >= 0;
+}
+
+WiFiClient WiFiServer::accept() {
+    if (!hasClient()) return WiFiClient();
+    int fd = pendingFd_;
+    pendingFd_ = -1;
+    // lwIP in the Arduino core buffers TCP_SND_BUF = 4 * MSS per connection; a Linux default
+    // send buffer would hide every backpressure stall the device sees.
+    int sndBuf = HOST_TCP_SND_BUF;
+    setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sndBuf, sizeof(sndBuf));
+    WiFiClient c(fd);
+    if (noDelay_) c.setNoDelay(true);
+    return c;
+}
+
+// ---------------- WiFiClass ----------------
+
+wl_status_t WiFiClass::begin() {
+    status_ = WL_CONNECTED;
+    return status_;
+}
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *pass, int32_t, const uint8_t *bssid, bool) {
+    if (ssid) ssid_ = ssid;
+    psk_ = pass ? pass : "";
+    if (bssid) memcpy(bssid_, bssid, 6);
+    status_ = WL_CONNECTED;
+    return status_;
+}
+
+bool WiFiClass::config(IPAddress, IPAddress, IPAddress, IPAddress, IPAddress) { return true; }
+
+bool WiFiClass::disconnect(bool wifioff, bool) {
+    status_ = WL_DISCONNECTED;
+    if (wifioff) mode_ = WIFI_OFF;
+    return true;
+}
+
+IPAddress WiFiClass::localIP() const {
+    if (status_ != WL_CONNECTED) return IPAddress();
+    return IPAddress(127, 0, 0, 1);
+}
+
+String WiFiClass::BSSIDstr() const {
+    char s[18];
+    snprintf(s, sizeof(s), "%02X:%02X:%02X:%02X:%02X:%02X",
+             bssid_[0], bssid_[1], bssid_[2], bssid_[3], bssid_[4], bssid_[5]);
+    return String(s);
+}
+
+esp_err_t esp_wifi_get_config(wifi_interface_t, wifi_config_t *conf) {
+    if (!conf) return ESP_ERR_INVALID_ARG;
+    memset(conf, 0, sizeof(*conf));
+    String ssid = WiFi.SSID();
+    memcpy(conf->sta.ssid, ssid.c_str(), std::min<size_t>(ssid.length(), sizeof(conf->sta.ssid)));
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_config(wifi_interface_t, wifi_config_t *) { return ESP_OK; }
@@ -0,0 +1,180 @@
+#pragma once
+// Host build: WiFi stack stand-in. WiFiServer/WiFiClient are backed by real
+// non-blocking loopback/LAN sockets so RTSP and HTTP clients can connect.
+#include <Arduino.h>
+#include <memory>
+
+#include "esp_wifi.h"
+
+class IPAddress {
+public:
+    IPAddress() : addr_(0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+        : addr_((uint32_t)a | ((uint32_t)b << 8) | ((uint32_t)c << 16) | ((uint32_t)d << 24)) {}
+    IPAddress(uint32_t a) : addr_(a) {}
+    operator uint32_t() const { return addr_; }
+    uint8_t operator[](int i) const { return (uint8_t)(addr_ >> (8 * i)); }
+    bool operator==(const IPAddress &o) const { return addr_ == o.addr_; }
+    bool operator!=(const IPAddress &o) const { return addr_ != o.addr_; }
+    bool fromString(const char *s);
+    bool fromString(const String &s) { return fromString(s.c_str()); }
+    String toString() const;
+
+private:
+    uint32_t addr_;  // network byte order, as in the ESP32 core
+};
+
+#define INADDR_NONE IPAddress((uint32_t)0)
+
+class Client : public Stream {
+public:
+    virtual int connect(IPAddress ip, uint16_t port) = 0;
+    virtual int connect(const char *host, uint16_t port) = 0;
+    virtual size_t write(uint8_t c) override = 0;
+    virtual size_t write(const uint8_t *buf, size_t size) override = 0;
+    using Print::write;
+    virtual int read(uint8_t *buf, size_t size) = 0;
+    using Stream::read;
+    virtual void stop() = 0;
+    virtual uint8_t connected() = 0;
+    virtual operator bool() = 0;
+};
+
+struct HostSocket;
+
+class WiFiClient : public Client {
+public:
+    WiFiClient();
+    explicit WiFiClient(int fd);
+    ~WiFiClient() override;
+    WiFiClient(const WiFiClient &) = default;
+    WiFiClient &operator=(const WiFiClient &) = default;
+
+    int connect(IPAddress ip, uint16_t port) override;
+    int connect(IPAddress ip, uint16_t port, int32_t timeoutMs);
+    int connect(const char *host, uint16_t port) override;
+    int connect(const char *host, uint16_t port, int32_t timeoutMs);
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buf, size_t size) override;
+    using Print::write;
+    int availableForWrite() override;
+    int available() override;
+    int read() override;
+    int read(uint8_t *buf, size_t size) override;
+    int peek() override;
+    void flush() override {}
+    void stop() override;
+    uint8_t connected() override;
+    operator bool() override { return connected(); }
+    bool operator==(const WiFiClient &o) const { return sock_ == o.sock_; }
+    int fd() const;
+    int setNoDelay(bool nodelay);
+    void setTimeout(uint32_t) {}
+    IPAddress remoteIP() const;
+    uint16_t remotePort() const;
+    IPAddress localIP() const;
+
+private:
+    std::shared_ptr<HostSocket> sock_;
+};
+
+class WiFiServer {
+public:
+    explicit WiFiServer(uint16_t port = 80);
+    ~WiFiServer();
+    void begin(uint16_t port = 0);
+    void stop();
+    void end() { stop(); }
+    void close() { stop(); }
+    void setNoDelay(bool nodelay) { noDelay_ = nodelay; }
+    bool hasClient();
+    WiFiClient accept();
+    WiFiClient available() { return accept(); }
+    operator bool() const { return listenFd_ >= 0; }
+    uint16_t port() const { return port_; }
+
+private:
+    uint16_t port_;
+    int listenFd_ = -1;
+    int pendingFd_ = -1;
+    bool noDelay_ = false;
+};
+
+// Ports below 1024 need root on Linux; the host build shifts them by this offset (80 -> 8080).
+static const uint16_t HOST_PRIVILEGED_PORT_OFFSET = 8000;
+uint16_t host_map_port(uint16_t port);
+
+#ifndef HOST_TCP_SND_BUF
+#define HOST_TCP_SND_BUF (4 * 1436)
+#endif
+
+typedef enum {
+    WL_NO_SHIELD = 255,
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+    WIFI_POWER_19_5dBm = 78,
+    WIFI_POWER_19dBm = 76,
+    WIFI_POWER_18_5dBm = 74,
+    WIFI_POWER_17dBm = 68,
+    WIFI_POWER_15dBm = 60,
+    WIFI_POWER_13dBm = 52,
+    WIFI_POWER_11dBm = 44,
+    WIFI_POWER_8_5dBm = 34,
+    WIFI_POWER_7dBm = 28,
+    WIFI_POWER_5dBm = 20,
+    WIFI_POWER_2dBm = 8,
+    WIFI_POWER_MINUS_1dBm = -4
+} wifi_power_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class WiFiClass {
+public:
+    wl_status_t status() { return status_; }
+    wl_status_t begin();
+    wl_status_t begin(const char *ssid, const char *pass = nullptr, int32_t channel = 0,
+                      const uint8_t *bssid = nullptr, bool connect = true);
+    bool config(IPAddress local, IPAddress gateway, IPAddress subnet,
+                IPAddress dns1 = (uint32_t)0, IPAddress dns2 = (uint32_t)0);
+    bool reconnect() { status_ = WL_CONNECTED; return true; }
+    bool disconnect(bool wifioff = false, bool eraseap = false);
+    bool mode(wifi_mode_t m) { mode_ = m; return true; }
+    wifi_mode_t getMode() const { return mode_; }
+    bool setSleep(bool enabled) { sleep_ = enabled; return true; }
+    bool getSleep() const { return sleep_; }
+    bool setTxPower(wifi_power_t p) { tx_ = p; return true; }
+    wifi_power_t getTxPower() const { return tx_; }
+    void persistent(bool) {}
+    bool setAutoReconnect(bool) { return true; }
+    bool isConnected() { return status_ == WL_CONNECTED; }
+
+    IPAddress localIP() const;
+    IPAddress gatewayIP() const { return IPAddress(127, 0, 0, 1); }
+    IPAddress subnetMask() const { return IPAddress(255, 0, 0, 0); }
+    IPAddress dnsIP(uint8_t = 0) const { return IPAddress(127, 0, 0, 1); }
+    String SSID() const { return String(ssid_.c_str()); }
+    String psk() const { return String(psk_.c_str()); }
+    int32_t RSSI() const { return -55; }
+    uint8_t *BSSID() { return bssid_; }
+    String BSSIDstr() const;
+    int32_t channel() const { return 6; }
+    String macAddress() const { return String("A1:B2:C3:D4:E5:F6"); }
+
+private:
+    wl_status_t status_ = WL_DISCONNECTED;
+    wifi_mode_t mode_ = WIFI_STA;
+    wifi_power_t tx_ = WIFI_POWER_19_5dBm;
+    bool sleep_ = true;
+    std::string ssid_ = "host-loopback";
+    std::string psk_;
+    uint8_t bssid_[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+};
+extern WiFiClass WiFi;
@@ -0,0 +1,15 @@
+#pragma once
+// Host build: the loopback "network" is always configured.
+#include <WiFi.h>
+
+class WiFiManager {
+public:
+    void setConnectTimeout(unsigned long) {}
+    void setConfigPortalTimeout(unsigned long) {}
+    bool autoConnect(const char *) {
+        WiFi.begin();
+        return true;
+    }
+    bool autoConnect(const char *, const char *) { return autoConnect(""); }
+    void resetSettings() {}
+};
@@ -0,0 +1,67 @@
+#pragma once
+// Host build: legacy I2S RX driver fed from a synthetic generator or a WAV file,
+// paced by the host clock so i2s_read() blocks like DMA does on the device.
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_system.h"
+
+#ifndef portTICK_PERIOD_MS
+#define portTICK_PERIOD_MS 1
+#endif
+#define I2S_PIN_NO_CHANGE (-1)
+#define ESP_INTR_FLAG_LEVEL1 (1 << 1)
+
+typedef enum { I2S_NUM_0 = 0, I2S_NUM_MAX } i2s_port_t;
+typedef enum {
+    I2S_MODE_MASTER = 1,
+    I2S_MODE_SLAVE = 2,
+    I2S_MODE_TX = 4,
+    I2S_MODE_RX = 8,
+} i2s_mode_t;
+typedef enum {
+    I2S_BITS_PER_SAMPLE_16BIT = 16,
+    I2S_BITS_PER_SAMPLE_24BIT = 24,
+    I2S_BITS_PER_SAMPLE_32BIT = 32,
+} i2s_bits_per_sample_t;
+typedef enum {
+    I2S_CHANNEL_FMT_RIGHT_LEFT,
+    I2S_CHANNEL_FMT_ALL_RIGHT,
+    I2S_CHANNEL_FMT_ALL_LEFT,
+    I2S_CHANNEL_FMT_ONLY_RIGHT,
+    I2S_CHANNEL_FMT_ONLY_LEFT,
+} i2s_channel_fmt_t;
+typedef enum { I2S_COMM_FORMAT_STAND_I2S = 1 } i2s_comm_format_t;
+
+typedef struct {
+    i2s_mode_t mode;
+    uint32_t sample_rate;
+    i2s_bits_per_sample_t bits_per_sample;
+    i2s_channel_fmt_t channel_format;
+    i2s_comm_format_t communication_format;
+    int intr_alloc_flags;
+    int dma_desc_num;
+    int dma_frame_num;
+    bool use_apll;
+} i2s_config_t;
+
+typedef struct {
+    int mck_io_num;
+    int bck_io_num;
+    int ws_io_num;
+    int data_out_num;
+    int data_in_num;
+} i2s_pin_config_t;
+
+esp_err_t i2s_driver_install(i2s_port_t port, const i2s_config_t *cfg, int queue_size, void *queue);
+esp_err_t i2s_driver_uninstall(i2s_port_t port);
+esp_err_t i2s_set_pin(i2s_port_t port, const i2s_pin_config_t *pins);
+esp_err_t i2s_read(i2s_port_t port, void *dest, size_t size, size_t *bytes_read, uint32_t ticks_to_wait);
+esp_err_t i2s_zero_dma_buffer(i2s_port_t port);
+
+// Host-only controls for the simulated microphone.
+enum HostI2SSource { HOST_I2S_SINE = 0, HOST_I2S_NOISE, HOST_I2S_SILENCE, HOST_I2S_WAV };
+void host_i2s_set_source(HostI2SSource src);
+bool host_i2s_load_wav(const char *path);
+void host_i2s_set_level_dbfs(float dbfs);
+uint64_t host_i2s_overrun_samples();
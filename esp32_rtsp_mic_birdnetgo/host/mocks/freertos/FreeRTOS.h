@@ -0,0 +1,39 @@
+#pragma once
+// Host build: the subset of FreeRTOS used by the firmware, on top of std::thread.
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define configTICK_RATE_HZ 1000
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskIDLE_PRIORITY 0
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define portNUM_PROCESSORS 1
+// Run-time stats: per-thread CPU time, see uxTaskGetSystemState() in freertos_host.cpp.
+#define configUSE_TRACE_FACILITY 1
+#define configGENERATE_RUN_TIME_STATS 1
+
+// Spinlocks / critical sections map to one process-wide recursive mutex.
+typedef struct {
+    int unused;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED {0}
+void host_enter_critical(portMUX_TYPE *mux);
+void host_exit_critical(portMUX_TYPE *mux);
+#define portENTER_CRITICAL(m) host_enter_critical(m)
+#define portEXIT_CRITICAL(m) host_exit_critical(m)
+#define portENTER_CRITICAL_ISR(m) host_enter_critical(m)
+#define portEXIT_CRITICAL_ISR(m) host_exit_critical(m)
+#define taskENTER_CRITICAL(m) host_enter_critical(m)
+#define taskEXIT_CRITICAL(m) host_exit_critical(m)
+#define portYIELD() host_task_yield()
+void host_task_yield(void);
@@ -0,0 +1,217 @@
+// Host build: FreeRTOS tasks, notifications, semaphores and critical sections on std::thread.
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include <time.h>
+
+struct HostTask {
+    std::string name;
+    UBaseType_t prio = 1;
+    std::mutex m;
+    std::condition_variable cv;
+    uint32_t notify = 0;
+    clockid_t cpuClock = 0;
+    bool hasClock = false;
+};
+
+struct HostSemaphore {
+    enum Kind { MUTEX, RECURSIVE, BINARY } kind;
+    std::mutex m;
+    std::condition_variable cv;
+    int count = 0;              // binary: 0/1, mutex: 1 = free
+    std::thread::id owner;
+    int depth = 0;
+};
+
+static std::recursive_mutex g_critical;
+static HostTask g_loopTask;  // the thread running setup()/loop()
+static thread_local HostTask *t_current = nullptr;
+static std::mutex g_taskListLock;
+static std::vector<HostTask *> g_tasks;
+static HostTask g_idleTask;
+
+static void registerCurrentThread(HostTask *t) {
+    t->hasClock = (pthread_getcpuclockid(pthread_self(), &t->cpuClock) == 0);
+    std::lock_guard<std::mutex> g(g_taskListLock);
+    g_tasks.push_back(t);
+}
+
+void host_enter_critical(portMUX_TYPE *) { g_critical.lock(); }
+void host_exit_critical(portMUX_TYPE *) { g_critical.unlock(); }
+void host_task_yield(void) { std::this_thread::yield(); }
+
+// Converts FreeRTOS ticks (1 ms) into a real-time deadline honoring the host clock speed.
+static std::chrono::steady_clock::time_point deadlineFor(TickType_t ticks) {
+    double us = (double)ticks * 1000.0 / host_speed();
+    return std::chrono::steady_clock::now() + std::chrono::microseconds((int64_t)us);
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t, void *arg, UBaseType_t prio,
+                       TaskHandle_t *out) {
+    HostTask *t = new HostTask();
+    t->name = name ? name : "task";
+    t->prio = prio;
+    if (out) *out = t;
+    std::thread([fn, arg, t] {
+        t_current = t;
+        registerCurrentThread(t);
+        fn(arg);
+    }).detach();
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stackDepth, void *arg,
+                                   UBaseType_t prio, TaskHandle_t *out, BaseType_t) {
+    return xTaskCreate(fn, name, stackDepth, arg, prio, out);
+}
+
+void vTaskDelete(TaskHandle_t) {
+    // Tasks on the host end by returning from their function after this call.
+}
+
+void vTaskDelay(TickType_t ticks) { delay(ticks); }
+
+TickType_t xTaskGetTickCount(void) { return (TickType_t)millis(); }
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    if (!t_current) {
+        g_loopTask.name = "loopTask";
+        t_current = &g_loopTask;
+        registerCurrentThread(&g_loopTask);
+    }
+    return t_current;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (!task) return pdFAIL;
+    {
+        std::lock_guard<std::mutex> lk(task->m);
+        task->notify++;
+    }
+    task->cv.notify_all();
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+    HostTask *t = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lk(t->m);
+    if (ticks == portMAX_DELAY) {
+        t->cv.wait(lk, [t] { return t->notify > 0; });
+    } else {
+        t->cv.wait_until(lk, deadlineFor(ticks), [t] { return t->notify > 0; });
+    }
+    uint32_t v = t->notify;
+    if (v) t->notify = clearOnExit ? 0 : v - 1;
+    return v;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 1024; }
+const char *pcTaskGetName(TaskHandle_t task) {
+    if (!task) task = xTaskGetCurrentTaskHandle();
+    return task->name.c_str();
+}
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task) {
+    if (!task) task = xTaskGetCurrentTaskHandle();
+    return task->prio;
+}
+void vTaskPrioritySet(TaskHandle_t task, UBaseType_t prio) {
+    if (!task) task = xTaskGetCurrentTaskHandle();
+    task->prio = prio;
+}
+
+static SemaphoreHandle_t makeSem(HostSemaphore::Kind kind, int count) {
+    HostSemaphore *s = new HostSemaphore();
+    s->kind = kind;
+    s->count = count;
+    return s;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) { return makeSem(HostSemaphore::MUTEX, 1); }
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void) { return makeSem(HostSemaphore::RECURSIVE, 1); }
+SemaphoreHandle_t xSemaphoreCreateBinary(void) { return makeSem(HostSemaphore::BINARY, 0); }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+    if (!s) return pdFALSE;
+    std::unique_lock<std::mutex> lk(s->m);
+    if (s->kind == HostSemaphore::RECURSIVE && s->depth > 0 && s->owner == std::this_thread::get_id()) {
+        s->depth++;
+        return pdTRUE;
+    }
+    auto ready = [s] { return s->count > 0; };
+    if (ticks == portMAX_DELAY) {
+        s->cv.wait(lk, ready);
+    } else if (!s->cv.wait_until(lk, deadlineFor(ticks), ready)) {
+        return pdFALSE;
+    }
+    s->count--;
+    s->owner = std::this_thread::get_id();
+    s->depth = 1;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+    if (!s) return pdFALSE;
+    {
+        std::lock_guard<std::mutex> lk(s->m);
+        if (s->kind == HostSemaphore::RECURSIVE && --s->depth > 0) return pdTRUE;
+        if (s->count > 0) return pdFALSE;
+        s->count = 1;
+        s->depth = 0;
+    }
+    s->cv.notify_one();
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t ticks) { return xSemaphoreTake(s, ticks); }
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s) { return xSemaphoreGive(s); }
+void vSemaphoreDelete(SemaphoreHandle_t s) { delete s; }
+
+// Run-time stats from per-thread CPU time (us); whatever is left of the wall clock is "IDLE".
+UBaseType_t uxTaskGetNumberOfTasks(void) {
+    std::lock_guard<std::mutex> g(g_taskListLock);
+    return (UBaseType_t)g_tasks.size() + 1;
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *out, UBaseType_t size, uint32_t *totalRunTime) {
+    static const auto t0 = std::chrono::steady_clock::now();
+    uint64_t total = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - t0).count();
+    std::lock_guard<std::mutex> g(g_taskListLock);
+    if (size < g_tasks.size() + 1) return 0;
+    uint64_t used = 0;
+    UBaseType_t n = 0;
+    for (HostTask *t : g_tasks) {
+        uint64_t us = 0;
+        struct timespec ts;
+        if (t->hasClock && clock_gettime(t->cpuClock, &ts) == 0) us = (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+        used += us;
+        TaskStatus_t &o = out[n];
+        o.xHandle = t;
+        o.pcTaskName = t->name.c_str();
+        o.xTaskNumber = n + 1;
+        o.uxCurrentPriority = o.uxBasePriority = t->prio;
+        o.ulRunTimeCounter = (uint32_t)us;
+        o.usStackHighWaterMark = 1024;
+        n++;
+    }
+    g_idleTask.name = "IDLE";
+    TaskStatus_t &o = out[n];
+    o.xHandle = &g_idleTask;
+    o.pcTaskName = g_idleTask.name.c_str();
+    o.xTaskNumber = n + 1;
+    o.uxCurrentPriority = o.uxBasePriority = 0;
+    o.ulRunTimeCounter = (uint32_t)(total > used ? total - used : 0);
+    o.usStackHighWaterMark = 512;
+    n++;
+    if (totalRunTime) *totalRunTime = (uint32_t)total;
+    return n;
+}
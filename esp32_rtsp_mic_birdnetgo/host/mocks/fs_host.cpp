@@ -0,0 +1,179 @@
+// Host build: FS/LittleFS on a host directory.
+#include <FS.h>
+#include <LittleFS.h>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+static std::string g_fsRoot = "esp32mic_fs";
+static long g_writeBudget = -1;
+
+void host_fs_set_root(const char *dir) { g_fsRoot = dir ? dir : "esp32mic_fs"; }
+const char *host_fs_root() { return g_fsRoot.c_str(); }
+void host_fs_fail_write_after(long bytes) { g_writeBudget = bytes; }
+
+namespace fs {
+
+size_t File::write(const uint8_t *buf, size_t len) {
+    if (!fp_ || !len) return 0;
+    if (g_writeBudget >= 0) {
+        if ((long)len > g_writeBudget) {
+            size_t n = fwrite(buf, 1, (size_t)g_writeBudget, fp_.get());
+            g_writeBudget = -1;
+            return n;
+        }
+        g_writeBudget -= (long)len;
+    }
+    return fwrite(buf, 1, len, fp_.get());
+}
+
+int File::available() {
+    if (!fp_) return 0;
+    long pos = ftell(fp_.get());
+    return (int)(size() - (size_t)(pos < 0 ? 0 : pos));
+}
+
+int File::read() {
+    if (!fp_) return -1;
+    int c = fgetc(fp_.get());
+    return c == EOF ? -1 : c;
+}
+
+int File::peek() {
+    if (!fp_) return -1;
+    int c = fgetc(fp_.get());
+    if (c != EOF) ungetc(c, fp_.get());
+    return c == EOF ? -1 : c;
+}
+
+void File::flush() {
+    if (fp_) fflush(fp_.get());
+}
+
+size_t File::read(uint8_t *buf, size_t len) {
+    if (!fp_) return 0;
+    return fread(buf, 1, len, fp_.get());
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+    if (!fp_) return false;
+    int whence = mode == SeekSet ? SEEK_SET : (mode == SeekCur ? SEEK_CUR : SEEK_END);
+    return fseek(fp_.get(), (long)pos, whence) == 0;
+}
+
+size_t File::position() const {
+    if (!fp_) return 0;
+    long p = ftell(fp_.get());
+    return p < 0 ? 0 : (size_t)p;
+}
+
+size_t File::size() const {
+    if (!fp_) return 0;
+    fflush(fp_.get());
+    struct stat st;
+    if (fstat(fileno(fp_.get()), &st) != 0) return 0;
+    return (size_t)st.st_size;
+}
+
+const char *File::name() const {
+    size_t slash = path_.rfind('/');
+    return slash == std::string::npos ? path_.c_str() : path_.c_str() + slash + 1;
+}
+
+File File::openNextFile(const char *) {
+    if (!dir_) return File();
+    while (struct dirent *e = readdir(dir_.get())) {
+        std::string n = e->d_name;
+        if (n == "." || n == "..") continue;
+        std::string child = path_ + (path_.empty() || path_.back() != '/' ? "/" : "") + n;
+        std::string hp = hostPath_ + "/" + n;
+        struct stat st;
+        if (stat(hp.c_str(), &st) != 0) continue;
+        if (S_ISDIR(st.st_mode)) {
+            DIR *d = opendir(hp.c_str());
+            if (!d) continue;
+            return File(std::shared_ptr<DIR>(d, [](DIR *x) { closedir(x); }), child, hp);
+        }
+        FILE *f = fopen(hp.c_str(), "rb");
+        if (!f) continue;
+        return File(std::shared_ptr<FILE>(f, [](FILE *x) { fclose(x); }), child);
+    }
+    return File();
+}
+
+void File::rewindDirectory() {
+    if (dir_) rewinddir(dir_.get());
+}
+
+std::string FS::hostPath(const char *path) const {
+    std::string p = root_.empty() ? g_fsRoot : root_;
+    if (path && path[0] != '/') p += '/';
+    return p + (path ? path : "");
+}
+
+File FS::open(const char *path, const char *mode, bool) {
+    std::string hp = hostPath(path);
+    struct stat st;
+    if ((!mode || mode[0] == 'r') && stat(hp.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+        DIR *d = opendir(hp.c_str());
+        if (!d) return File();
+        return File(std::shared_ptr<DIR>(d, [](DIR *x) { closedir(x); }), path ? path : "", hp);
+    }
+    const char *m = "rb";
+    if (mode && mode[0] == 'w') m = (mode[1] == '+') ? "w+b" : "wb";
+    else if (mode && mode[0] == 'a') m = (mode[1] == '+') ? "a+b" : "ab";
+    else if (mode && mode[0] == 'r' && mode[1] == '+') m = "r+b";
+    FILE *f = fopen(hp.c_str(), m);
+    if (!f) return File();
+    return File(std::shared_ptr<FILE>(f, [](FILE *x) { fclose(x); }), path ? path : "");
+}
+
+bool FS::exists(const char *path) {
+    struct stat st;
+    return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char *path) { return ::unlink(hostPath(path).c_str()) == 0; }
+
+bool FS::rename(const char *from, const char *to) {
+    return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+bool FS::mkdir(const char *path) { return ::mkdir(hostPath(path).c_str(), 0755) == 0; }
+
+bool FS::rmdir(const char *path) { return ::rmdir(hostPath(path).c_str()) == 0; }
+
+}  // namespace fs
+
+LittleFSFS LittleFS;
+
+bool LittleFSFS::begin(bool, const char *, uint8_t, const char *) {
+    root_ = g_fsRoot;
+    ::mkdir(root_.c_str(), 0755);
+    struct stat st;
+    return stat(root_.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+bool LittleFSFS::format() { return true; }
+
+static size_t dirUsage(const std::string &dir) {
+    size_t total = 0;
+    DIR *d = opendir(dir.c_str());
+    if (!d) return 0;
+    while (struct dirent *e = readdir(d)) {
+        std::string n = e->d_name;
+        if (n == "." || n == "..") continue;
+        std::string p = dir + "/" + n;
+        struct stat st;
+        if (stat(p.c_str(), &st) != 0) continue;
+        total += S_ISDIR(st.st_mode) ? dirUsage(p) : (size_t)st.st_size;
+    }
+    closedir(d);
+    return total;
+}
+
+size_t LittleFSFS::totalBytes() { return 1536 * 1024; }
+size_t LittleFSFS::usedBytes() { return dirUsage(root_); }
@@ -0,0 +1,141 @@
+// Host build: Arduino core runtime (clock, serial, ESP class, time helpers).
+#include <Arduino.h>
+
+#include <stdarg.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <random>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static const auto g_hostEpoch = std::chrono::steady_clock::now();
+static double g_speed = 1.0;
+static uint32_t g_cpuMhz = 160;
+static std::mt19937 g_rng(12345);
+
+void host_set_speed(double factor) { g_speed = (factor > 0.0) ? factor : 1.0; }
+double host_speed() { return g_speed; }
+
+uint64_t host_now_us() {
+    auto real = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - g_hostEpoch).count();
+    return (uint64_t)((double)real * g_speed);
+}
+
+unsigned long millis() { return (unsigned long)(host_now_us() / 1000ULL); }
+unsigned long micros() { return (unsigned long)host_now_us(); }
+
+void delay(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::microseconds((int64_t)((double)ms * 1000.0 / g_speed)));
+}
+
+void delayMicroseconds(uint32_t us) {
+    std::this_thread::sleep_for(std::chrono::microseconds((int64_t)((double)us / g_speed)));
+}
+
+void yield() { std::this_thread::yield(); }
+
+long random(long howbig) {
+    if (howbig <= 0) return 0;
+    return (long)(g_rng() % (unsigned long)howbig);
+}
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) return howsmall;
+    return howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed) {
+    if (seed) g_rng.seed((uint32_t)seed);
+}
+
+float temperatureRead() { return 42.0f; }
+
+bool setCpuFrequencyMhz(uint32_t mhz) {
+    g_cpuMhz = mhz;
+    return true;
+}
+
+uint32_t getCpuFrequencyMhz() { return g_cpuMhz; }
+
+void configTime(long gmtOffsetSec, int, const char *, const char *, const char *) {
+    // Mirror the ESP32 core: offset is applied through TZ (POSIX sign is inverted).
+    char tz[32];
+    long h = -gmtOffsetSec / 3600;
+    long m = labs(gmtOffsetSec % 3600) / 60;
+    snprintf(tz, sizeof(tz), "UTC%+ld:%02ld", h, m);
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+bool getLocalTime(struct tm *info, uint32_t) {
+    time_t now = time(nullptr);
+    return localtime_r(&now, info) != nullptr;
+}
+
+size_t Print::write(const uint8_t *buf, size_t len) {
+    size_t n = 0;
+    while (len--) n += write(*buf++);
+    return n;
+}
+
+size_t Print::printf(const char *fmt, ...) {
+    char small[256];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(small, sizeof(small), fmt, ap);
+    va_end(ap);
+    if (n < 0) return 0;
+    if ((size_t)n < sizeof(small)) return write((const uint8_t *)small, (size_t)n);
+    std::string big((size_t)n + 1, '\0');
+    va_start(ap, fmt);
+    vsnprintf(&big[0], big.size(), fmt, ap);
+    va_end(ap);
+    return write((const uint8_t *)big.data(), (size_t)n);
+}
+
+size_t HardwareSerial::write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+size_t HardwareSerial::write(const uint8_t *buf, size_t len) { return fwrite(buf, 1, len, stdout); }
+void HardwareSerial::flush() { fflush(stdout); }
+
+uint32_t EspClass::getFreeHeap() { return 256u * 1024u; }
+uint32_t EspClass::getMinFreeHeap() { return 200u * 1024u; }
+uint32_t EspClass::getMaxAllocHeap() { return 192u * 1024u; }
+uint32_t EspClass::getHeapSize() { return 320u * 1024u; }
+uint32_t EspClass::getCycleCount() { return (uint32_t)(host_now_us() * g_cpuMhz); }
+uint32_t EspClass::getCpuFreqMHz() { return (uint32_t)g_cpuMhz; }
+
+void EspClass::restart() {
+    fflush(stdout);
+    fprintf(stderr, "[host] ESP.restart() requested, exiting\n");
+    exit(3);
+}
+
+esp_reset_reason_t esp_reset_reason(void) { return ESP_RST_POWERON; }
+
+const char *esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK: return "ESP_OK";
+        case ESP_FAIL: return "ESP_FAIL";
+        case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+        case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+        default: return "ESP_ERR_UNKNOWN";
+    }
+}
+
+// Heap figures: a slowly fragmenting heap so the monitor has something to show.
+#include "esp_heap_caps.h"
+size_t heap_caps_get_free_size(uint32_t) { return 256u * 1024u; }
+size_t heap_caps_get_largest_free_block(uint32_t) {
+    uint32_t minutes = millis() / 60000u;
+    uint32_t lb = 192u * 1024u - minutes * 4096u;
+    return lb < 32u * 1024u ? 32u * 1024u : lb;
+}
+size_t heap_caps_get_minimum_free_size(uint32_t) { return 240u * 1024u; }
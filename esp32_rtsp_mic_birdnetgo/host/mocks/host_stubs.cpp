@@ -0,0 +1,17 @@
+// Host build: services that have no meaning on a Linux host.
+#include <ArduinoOTA.h>
+#include <ESPmDNS.h>
+#include <esp_sleep.h>
+
+ArduinoOTAClass ArduinoOTA;
+MDNSResponder MDNS;
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause(void) { return ESP_SLEEP_WAKEUP_UNDEFINED; }
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t) { return ESP_OK; }
+
+void esp_deep_sleep_start(void) {
+    fflush(stdout);
+    fprintf(stderr, "[host] deep sleep requested, exiting\n");
+    exit(4);
+}
@@ -0,0 +1,157 @@
+// Host build: simulated I2S microphone (32-bit left-justified words, 24 valid bits).
+#include "driver/i2s.h"
+
+#include <Arduino.h>
+
+#include <fstream>
+#include <random>
+#include <vector>
+
+namespace {
+bool g_installed = false;
+uint32_t g_rate = 48000;
+size_t g_dmaFrames = 8 * 512;
+uint64_t g_startUs = 0;
+uint64_t g_consumed = 0;   // samples handed out since install
+uint64_t g_overrun = 0;    // samples the simulated DMA ring dropped
+HostI2SSource g_source = HOST_I2S_SINE;
+float g_level = 0.05f;     // linear full-scale fraction
+double g_phase = 0.0;
+std::vector<int32_t> g_wav;
+size_t g_wavPos = 0;
+std::mt19937 g_noise(7);
+
+// ESP32MIC_HOST_I2S_STALL=<start_s>,<dur_s>: the simulated clock delivers nothing in that window.
+bool inStall() {
+    static int start = -2, dur = 0;
+    if (start == -2) {
+        start = -1;
+        const char *e = getenv("ESP32MIC_HOST_I2S_STALL");
+        if (e) sscanf(e, "%d,%d", &start, &dur);
+    }
+    if (start < 0) return false;
+    uint64_t s = host_now_us() / 1000000ULL;
+    return s >= (uint64_t)start && s < (uint64_t)(start + dur);
+}
+
+int32_t nextSample() {
+    double v = 0.0;
+    switch (g_source) {
+        case HOST_I2S_SINE:
+            v = sin(g_phase) * g_level;
+            g_phase += 2.0 * M_PI * 1000.0 / (double)g_rate;
+            if (g_phase > 2.0 * M_PI) g_phase -= 2.0 * M_PI;
+            break;
+        case HOST_I2S_NOISE: {
+            std::uniform_real_distribution<double> d(-1.0, 1.0);
+            v = d(g_noise) * g_level;
+            break;
+        }
+        case HOST_I2S_SILENCE:
+            return 0;
+        case HOST_I2S_WAV:
+            if (g_wav.empty()) return 0;
+            if (g_wavPos >= g_wav.size()) g_wavPos = 0;
+            return g_wav[g_wavPos++];
+    }
+    // 24-bit sample left-justified in a 32-bit slot, like the ICS-43434.
+    int32_t s24 = (int32_t)(v * 8388607.0);
+    return (int32_t)((uint32_t)s24 << 8);
+}
+}  // namespace
+
+esp_err_t i2s_driver_install(i2s_port_t, const i2s_config_t *cfg, int, void *) {
+    if (!cfg || cfg->sample_rate == 0) return ESP_ERR_INVALID_ARG;
+    g_rate = cfg->sample_rate;
+    g_dmaFrames = (size_t)cfg->dma_desc_num * (size_t)cfg->dma_frame_num;
+    g_startUs = host_now_us();
+    g_consumed = 0;
+    g_installed = true;
+    return ESP_OK;
+}
+
+esp_err_t i2s_driver_uninstall(i2s_port_t) {
+    if (!g_installed) return ESP_ERR_INVALID_STATE;
+    g_installed = false;
+    return ESP_OK;
+}
+
+esp_err_t i2s_set_pin(i2s_port_t, const i2s_pin_config_t *) { return ESP_OK; }
+
+esp_err_t i2s_zero_dma_buffer(i2s_port_t) { return ESP_OK; }
+
+esp_err_t i2s_read(i2s_port_t, void *dest, size_t size, size_t *bytes_read, uint32_t ticks_to_wait) {
+    if (bytes_read) *bytes_read = 0;
+    if (!g_installed || !dest) return ESP_ERR_INVALID_STATE;
+    size_t want = size / sizeof(int32_t);
+    if (inStall()) {
+        delay(ticks_to_wait * portTICK_PERIOD_MS);
+        g_consumed = (host_now_us() - g_startUs) * g_rate / 1000000ULL;
+        return ESP_ERR_TIMEOUT;
+    }
+    uint64_t deadline = host_now_us() + (uint64_t)ticks_to_wait * portTICK_PERIOD_MS * 1000ULL;
+    int32_t *out = (int32_t *)dest;
+    size_t got = 0;
+    while (got < want) {
+        uint64_t now = host_now_us();
+        uint64_t produced = (now - g_startUs) * g_rate / 1000000ULL;
+        // Model the DMA ring: anything older than the ring length has been overwritten.
+        if (produced > g_consumed + g_dmaFrames) {
+            g_overrun += produced - g_consumed - g_dmaFrames;
+            g_consumed = produced - g_dmaFrames;
+        }
+        uint64_t ready = produced - g_consumed;
+        if (ready == 0) {
+            if (now >= deadline) break;
+            delayMicroseconds(200);
+            continue;
+        }
+        size_t n = (size_t)std::min<uint64_t>(ready, want - got);
+        for (size_t i = 0; i < n; ++i) out[got + i] = nextSample();
+        got += n;
+        g_consumed += n;
+    }
+    if (bytes_read) *bytes_read = got * sizeof(int32_t);
+    return got ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+void host_i2s_set_source(HostI2SSource src) { g_source = src; }
+
+void host_i2s_set_level_dbfs(float dbfs) { g_level = powf(10.0f, dbfs / 20.0f); }
+
+uint64_t host_i2s_overrun_samples() { return g_overrun; }
+
+bool host_i2s_load_wav(const char *path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::vector<uint8_t> d((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (d.size() < 44 || memcmp(d.data(), "RIFF", 4) != 0 || memcmp(d.data() + 8, "WAVE", 4) != 0) return false;
+    uint16_t channels = 1, bits = 16;
+    size_t pos = 12;
+    while (pos + 8 <= d.size()) {
+        uint32_t len = d[pos + 4] | (d[pos + 5] << 8) | (d[pos + 6] << 16) | ((uint32_t)d[pos + 7] << 24);
+        const uint8_t *body = d.data() + pos + 8;
+        if (memcmp(d.data() + pos, "fmt ", 4) == 0 && len >= 16) {
+            channels = (uint16_t)(body[2] | (body[3] << 8));
+            bits = (uint16_t)(body[14] | (body[15] << 8));
+        } else if (memcmp(d.data() + pos, "data", 4) == 0) {
+            size_t bytesPerFrame = (size_t)channels * (bits / 8);
+            if (bytesPerFrame == 0 || (bits != 16 && bits != 24 && bits != 32)) return false;
+            size_t frames = std::min<size_t>(len, d.size() - pos - 8) / bytesPerFrame;
+            g_wav.resize(frames);
+            for (size_t f = 0; f < frames; ++f) {
+                const uint8_t *s = body + f * bytesPerFrame;  // first channel only
+                int32_t v = 0;
+                if (bits == 16) v = (int32_t)((uint32_t)(s[0] | (s[1] << 8)) << 16);
+                else if (bits == 24) v = (int32_t)(((uint32_t)s[0] << 8) | ((uint32_t)s[1] << 16) | ((uint32_t)s[2] << 24));
+                else v = (int32_t)(s[0] | (s[1] << 8) | (s[2] << 16) | ((uint32_t)s[3] << 24));
+                g_wav[f] = v;
+            }
+            g_wavPos = 0;
+            g_source = HOST_I2S_WAV;
+            return true;
+        }
+        pos += 8 + len + (len & 1);
+    }
+    return false;
+}
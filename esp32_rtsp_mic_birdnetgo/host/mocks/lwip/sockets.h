@@ -0,0 +1,5 @@
+#pragma once
+// Host build: lwIP's BSD socket layer is the host's own.
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
@@ -0,0 +1,8 @@
+#pragma once
+// Host build: flash-resident data is ordinary memory.
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
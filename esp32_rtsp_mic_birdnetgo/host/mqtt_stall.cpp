@@ -0,0 +1,231 @@
+// Misbehaving MQTT broker for checking that a bad broker never reaches the audio path.
+//
+//   mqtt_stall [--listen PORT] [--mode blackhole|stall|drop] [--after SEC] [--duration SEC]
+//
+// The firmware's MQTT task owns the client; loop() only hands it payloads through a mailbox.
+// Point the device (or esp32mic_host) at this broker and run rtsp_soak --fail-on-gap next to it:
+//   blackhole  accept, then never read or answer: CONNECT waits for a CONNACK until the socket
+//              timeout, on every reconnect attempt
+//   stall      behave (CONNACK, SUBACK, PINGRESP) for --after seconds, then stop reading, so the
+//              client's publishes back up into a full socket and its writes time out
+//   drop       accept and close at once
+// An unreachable broker needs no tool: use a port nothing listens on.
+// The accepted sockets get a small receive buffer so a stall fills quickly. A line per
+// connection and per state change goes to stderr; Ctrl+C ends the run.
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+volatile sig_atomic_t g_stop = 0;
+
+void onSignal(int) { g_stop = 1; }
+
+double nowSec() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+const int CLIENT_RCVBUF = 4 * 1024;
+
+enum Mode { MODE_BLACKHOLE, MODE_STALL, MODE_DROP };
+
+struct Options {
+    int listenPort = 11883;
+    Mode mode = MODE_BLACKHOLE;
+    double afterSec = 10.0;
+    double durationSec = 0.0;
+};
+
+struct Conn {
+    int fd = -1;
+    double since = 0.0;
+    bool stalled = false;
+    std::string in;
+    uint32_t publishes = 0;
+};
+
+void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--listen PORT] [--mode blackhole|stall|drop] [--after SEC] [--duration SEC]\n",
+            argv0);
+}
+
+void sendAll(int fd, const uint8_t *d, size_t n) {
+    while (n > 0) {
+        ssize_t w = send(fd, d, n, MSG_NOSIGNAL);
+        if (w <= 0) return;
+        d += w;
+        n -= (size_t)w;
+    }
+}
+
+// Answers the packets a well-behaved broker would; returns false on a malformed stream.
+bool serve(Conn &c) {
+    for (;;) {
+        if (c.in.size() < 2) return true;
+        size_t len = 0, pos = 1;
+        int shift = 0;
+        uint8_t d;
+        do {
+            if (pos >= c.in.size()) return true;
+            d = (uint8_t)c.in[pos++];
+            len |= (size_t)(d & 0x7F) << shift;
+            shift += 7;
+            if (shift > 21) return false;
+        } while (d & 0x80);
+        if (c.in.size() < pos + len) return true;
+        const uint8_t type = (uint8_t)c.in[0] >> 4;
+        const uint8_t *body = reinterpret_cast<const uint8_t *>(c.in.data()) + pos;
+        if (type == 1) {            // CONNECT
+            const uint8_t ack[] = {0x20, 0x02, 0x00, 0x00};
+            sendAll(c.fd, ack, sizeof(ack));
+        } else if (type == 8 && len >= 2) {   // SUBSCRIBE: grant QoS 0 to every filter
+            std::vector<uint8_t> ack = {0x90, 0, body[0], body[1]};
+            for (size_t i = 2; i + 2 <= len;) {
+                size_t n = ((size_t)body[i] << 8) | body[i + 1];
+                i += 2 + n + 1;
+                ack.push_back(0x00);
+            }
+            ack[1] = (uint8_t)(ack.size() - 2);
+            sendAll(c.fd, ack.data(), ack.size());
+        } else if (type == 12) {    // PINGREQ
+            const uint8_t resp[] = {0xD0, 0x00};
+            sendAll(c.fd, resp, sizeof(resp));
+        } else if (type == 3) {
+            c.publishes++;
+        }
+        c.in.erase(0, pos + len);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    Options o;
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        auto next = [&](void) -> const char * {
+            if (i + 1 >= argc) {
+                usage(argv[0]);
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (a == "--listen") {
+            o.listenPort = atoi(next());
+        } else if (a == "--mode") {
+            std::string m = next();
+            if (m == "blackhole") o.mode = MODE_BLACKHOLE;
+            else if (m == "stall") o.mode = MODE_STALL;
+            else if (m == "drop") o.mode = MODE_DROP;
+            else {
+                usage(argv[0]);
+                return 2;
+            }
+        } else if (a == "--after") {
+            o.afterSec = atof(next());
+        } else if (a == "--duration") {
+            o.durationSec = atof(next());
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+
+    int lfd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(lfd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    // Set before listen() so accepted sockets advertise the small window from the start.
+    int rcv = CLIENT_RCVBUF;
+    setsockopt(lfd, SOL_SOCKET, SO_RCVBUF, &rcv, sizeof(rcv));
+    sockaddr_in sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa.sin_port = htons((uint16_t)o.listenPort);
+    if (bind(lfd, (sockaddr *)&sa, sizeof(sa)) < 0 || listen(lfd, 4) < 0) {
+        fprintf(stderr, "cannot listen on %d: %s\n", o.listenPort, strerror(errno));
+        return 2;
+    }
+
+    const double start = nowSec();
+    std::vector<Conn> conns;
+    uint32_t accepted = 0;
+    while (!g_stop && (o.durationSec <= 0 || nowSec() - start < o.durationSec)) {
+        std::vector<pollfd> pfds;
+        pfds.push_back({lfd, POLLIN, 0});
+        for (const Conn &c : conns) {
+            // A blackholed or stalled connection is not read: its data stays in the kernel.
+            bool read = o.mode == MODE_STALL && !c.stalled;
+            pfds.push_back({c.fd, (short)(read ? POLLIN : 0), 0});
+        }
+        poll(pfds.data(), pfds.size(), 100);
+
+        if (pfds[0].revents & POLLIN) {
+            int fd = accept(lfd, nullptr, nullptr);
+            if (fd >= 0) {
+                accepted++;
+                fprintf(stderr, "[broker] %6.1f s  connection %u accepted (%s)\n", nowSec() - start, accepted,
+                        o.mode == MODE_DROP ? "dropped" : o.mode == MODE_STALL ? "serving" : "blackholed");
+                if (o.mode == MODE_DROP) {
+                    close(fd);
+                } else {
+                    Conn c;
+                    c.fd = fd;
+                    c.since = nowSec();
+                    conns.push_back(c);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < conns.size();) {
+            Conn &c = conns[i];
+            short rev = pfds.size() > i + 1 ? pfds[i + 1].revents : 0;
+            bool gone = (rev & (POLLHUP | POLLERR)) != 0;
+            if (!gone && (rev & POLLIN)) {
+                char buf[2048];
+                ssize_t n = recv(c.fd, buf, sizeof(buf), 0);
+                if (n <= 0) gone = true;
+                else {
+                    c.in.append(buf, (size_t)n);
+                    if (!serve(c)) gone = true;
+                }
+            }
+            if (!gone && o.mode == MODE_STALL && !c.stalled && nowSec() - c.since >= o.afterSec) {
+                c.stalled = true;
+                fprintf(stderr, "[broker] %6.1f s  connection stalled after %u publishes\n", nowSec() - start,
+                        c.publishes);
+            }
+            if (gone) {
+                fprintf(stderr, "[broker] %6.1f s  connection closed by the client\n", nowSec() - start);
+                close(c.fd);
+                conns.erase(conns.begin() + (long)i);
+                // pfds no longer lines up with conns; the next poll() picks the rest up.
+                break;
+            }
+            ++i;
+        }
+    }
+    for (const Conn &c : conns) close(c.fd);
+    close(lfd);
+    fprintf(stderr, "[broker] %u connections\n", accepted);
+    return 0;
+}
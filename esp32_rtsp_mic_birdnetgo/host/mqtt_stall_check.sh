@@ -0,0 +1,79 @@
+#!/usr/bin/env bash
+# Audio must not notice a bad MQTT broker. Runs esp32mic_host against an unreachable broker and
+# against mqtt_stall in each mode, with rtsp_soak --fail-on-gap on the stream, one case after
+# the other (the host build always uses ports 8080/8554).
+#
+#   host/mqtt_stall_check.sh [BUILD_DIR] [SECONDS_PER_CASE]
+#
+# Exit code 1 if any case lost a packet or saw an RTP gap over GAP_MS.
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="${1:-${ROOT_DIR}/host/build}"
+SECONDS_PER_CASE="${2:-75}"
+GAP_MS="${GAP_MS:-100}"
+BROKER_PORT=11883
+UNUSED_PORT=11884
+
+for b in esp32mic_host rtsp_soak mqtt_stall; do
+  if [[ ! -x "${BUILD_DIR}/${b}" ]]; then
+    echo "Missing ${BUILD_DIR}/${b}; build the host target first" >&2
+    exit 2
+  fi
+done
+
+TMP_DIR="$(mktemp -d)"
+PIDS=()
+cleanup() {
+  for p in "${PIDS[@]}"; do kill "${p}" 2>/dev/null || true; done
+  wait 2>/dev/null || true
+  rm -rf "${TMP_DIR}"
+}
+trap cleanup EXIT
+
+run_case() {
+  local name="$1" mode="$2" port="${BROKER_PORT}"
+  PIDS=()
+  if [[ "${mode}" == "unreachable" ]]; then
+    port="${UNUSED_PORT}"
+  else
+    "${BUILD_DIR}/mqtt_stall" --listen "${port}" --mode "${mode}" --after 5 \
+      2>"${TMP_DIR}/${name}.broker.log" &
+    PIDS+=($!)
+  fi
+  mkdir -p "${TMP_DIR}/${name}.fs"
+  cat >"${TMP_DIR}/${name}.prefs" <<EOF
+audio/mqttEn=1
+audio/mqttHost=127.0.0.1
+audio/mqttPort=${port}
+audio/mqttIntSec=10
+audio/mqttDelta=1
+EOF
+  "${BUILD_DIR}/esp32mic_host" --noise --prefs "${TMP_DIR}/${name}.prefs" --fs "${TMP_DIR}/${name}.fs" \
+    --duration 0 >"${TMP_DIR}/${name}.host.log" 2>&1 &
+  PIDS+=($!)
+  sleep 2
+  local rc=0
+  "${BUILD_DIR}/rtsp_soak" --url rtsp://127.0.0.1:8554/audio --duration "${SECONDS_PER_CASE}" \
+    --fail-on-gap "${GAP_MS}" --json "${TMP_DIR}/${name}.json" 2>"${TMP_DIR}/${name}.soak.log" || rc=$?
+  for p in "${PIDS[@]}"; do kill "${p}" 2>/dev/null || true; done
+  wait 2>/dev/null || true
+  if [[ ${rc} -eq 0 ]]; then
+    echo "${name}: ok  $(grep -o '"lost":[0-9]*,\|"gap_max_ms":[0-9.]*' "${TMP_DIR}/${name}.json" | tr -d '\n')"
+  else
+    echo "${name}: FAIL"
+    tail -n 3 "${TMP_DIR}/${name}.soak.log"
+    cat "${TMP_DIR}/${name}.json" 2>/dev/null || true
+    FAILED=1
+  fi
+  if [[ -f "${TMP_DIR}/${name}.broker.log" ]]; then
+    echo "  broker: $(grep -c accepted "${TMP_DIR}/${name}.broker.log" || true) connections"
+  fi
+}
+
+FAILED=0
+run_case unreachable unreachable
+run_case refused drop
+run_case blackhole blackhole
+run_case stalled stall
+exit "${FAILED}"
@@ -0,0 +1,258 @@
+// Segment format check for the store-and-forward recorder (Recorder.h, built for the host).
+//
+//   rec_segment [--rate HZ] [--seconds S] [--min-snr DB] [--out FILE.wav]
+//   rec_segment --check FILE.wav
+//
+// Self-test: encodes a test signal (chirp plus noise) with RecAdpcmEncoder exactly as the
+// writer does, builds the header with rec_buildHeader, then reads it back with an independent
+// RIFF walker and an independent IMA ADPCM decoder and checks the fmt/fact/data fields, the
+// round-trip SNR, the header round trip through rec_parseHeader and the repair of a torn
+// segment (unclosed header, partial last block). --out also writes the segment so a desktop
+// player or sox can open it.
+// --check: validates a segment downloaded from /api/recording and prints its length and level.
+// Exits non-zero on the first failed check.
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "Recorder.h"
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--rate HZ] [--seconds S] [--min-snr DB] [--out FILE.wav]\n"
+            "       %s --check FILE.wav\n",
+            argv0, argv0);
+}
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+    printf("%-44s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok) failures++;
+}
+
+// Generic RIFF walk (does not rely on the recorder's fixed offsets).
+struct WavInfo {
+    uint16_t format, channels, bits, blockAlign, samplesPerBlock;
+    uint32_t rate, byteRate, factSamples, dataOffset, dataBytes;
+    bool hasFact, hasInfo;
+    uint32_t seq, startEpoch, sourceRate;
+};
+
+static bool walkRiff(const std::vector<uint8_t> &f, WavInfo &w) {
+    memset(&w, 0, sizeof(w));
+    if (f.size() < 12 || memcmp(&f[0], "RIFF", 4) || memcmp(&f[8], "WAVE", 4)) return false;
+    size_t p = 12;
+    bool fmt = false;
+    while (p + 8 <= f.size()) {
+        const uint8_t *c = &f[p];
+        uint32_t len = rec_get32(c + 4);
+        if (!memcmp(c, "fmt ", 4) && len >= 20) {
+            w.format = rec_get16(c + 8);
+            w.channels = rec_get16(c + 10);
+            w.rate = rec_get32(c + 12);
+            w.byteRate = rec_get32(c + 16);
+            w.blockAlign = rec_get16(c + 20);
+            w.bits = rec_get16(c + 22);
+            w.samplesPerBlock = rec_get16(c + 26);
+            fmt = true;
+        } else if (!memcmp(c, "fact", 4) && len >= 4) {
+            w.factSamples = rec_get32(c + 8);
+            w.hasFact = true;
+        } else if (!memcmp(c, "emrc", 4) && len >= 16) {
+            w.seq = rec_get32(c + 8);
+            w.startEpoch = rec_get32(c + 12);
+            w.sourceRate = rec_get32(c + 20);
+            w.hasInfo = true;
+        } else if (!memcmp(c, "data", 4)) {
+            w.dataOffset = (uint32_t)(p + 8);
+            w.dataBytes = len;
+            return fmt;
+        }
+        p += 8 + len + (len & 1);
+    }
+    return false;
+}
+
+// Reference IMA ADPCM block decoder (mono, as in the Microsoft/IMA spec).
+static void decodeBlock(const uint8_t *b, uint32_t samplesPerBlock, std::vector<int16_t> &out) {
+    static const int indexAdj[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+    const int16_t *steps = rec_imaStepTable();
+    int pred = (int16_t)rec_get16(b);
+    int index = b[2] > 88 ? 88 : b[2];
+    out.push_back((int16_t)pred);
+    for (uint32_t i = 1; i < samplesPerBlock; i++) {
+        uint8_t byte = b[4 + (i - 1) / 2];
+        int n = ((i - 1) & 1) ? byte >> 4 : byte & 0x0F;
+        int step = steps[index];
+        int diff = step >> 3;
+        if (n & 4) diff += step;
+        if (n & 2) diff += step >> 1;
+        if (n & 1) diff += step >> 2;
+        pred += (n & 8) ? -diff : diff;
+        pred = pred > 32767 ? 32767 : (pred < -32768 ? -32768 : pred);
+        index += indexAdj[n & 7];
+        index = index < 0 ? 0 : (index > 88 ? 88 : index);
+        out.push_back((int16_t)pred);
+    }
+}
+
+static bool decodeAll(const std::vector<uint8_t> &f, const WavInfo &w, std::vector<int16_t> &pcm) {
+    if (w.dataOffset + (uint64_t)w.dataBytes > f.size() || w.blockAlign == 0) return false;
+    for (uint32_t off = 0; off + w.blockAlign <= w.dataBytes; off += w.blockAlign) {
+        decodeBlock(&f[w.dataOffset + off], w.samplesPerBlock, pcm);
+    }
+    if (w.hasFact && w.factSamples <= pcm.size()) pcm.resize(w.factSamples);
+    return true;
+}
+
+static std::vector<uint8_t> encodeSegment(const std::vector<int16_t> &pcm, uint32_t rate, const RecSegmentInfo &info,
+                                          bool close) {
+    std::vector<uint8_t> file(REC_HEADER_BYTES);
+    uint8_t block[REC_ADPCM_BLOCK_BYTES];
+    RecAdpcmEncoder enc;
+    enc.reset();
+    for (int16_t s : pcm) {
+        if (enc.put(s, block)) file.insert(file.end(), block, block + REC_ADPCM_BLOCK_BYTES);
+    }
+    if (enc.pos) {   // pad the last block like Recorder.cpp does when a segment ends
+        while (!enc.put(0, block)) {}
+        file.insert(file.end(), block, block + REC_ADPCM_BLOCK_BYTES);
+    }
+    uint32_t dataBytes = (uint32_t)(file.size() - REC_HEADER_BYTES);
+    rec_buildHeader(file.data(), rate, info, close ? dataBytes : 0, close ? (uint32_t)pcm.size() : 0);
+    return file;
+}
+
+static double levelDbfs(const std::vector<int16_t> &pcm) {
+    double sq = 0.0;
+    for (int16_t s : pcm) sq += (double)s * s;
+    return pcm.empty() || sq <= 0.0 ? -144.0 : 10.0 * log10(sq / pcm.size() / (32768.0 * 32768.0));
+}
+
+static bool readFile(const char *path, std::vector<uint8_t> &out) {
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return false;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) out.insert(out.end(), buf, buf + n);
+    fclose(fp);
+    return true;
+}
+
+static int checkFile(const char *path) {
+    std::vector<uint8_t> f;
+    if (!readFile(path, f)) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+    WavInfo w;
+    RecSegmentHeader h;
+    check(f.size() >= REC_HEADER_BYTES && rec_parseHeader(f.data(), h), "recorder header");
+    check(walkRiff(f, w), "RIFF walk");
+    if (failures) return 1;
+    check(w.dataOffset == REC_HEADER_BYTES, "data at the header boundary");
+    check(w.dataBytes % REC_ADPCM_BLOCK_BYTES == 0 && w.dataOffset + w.dataBytes == f.size(), "whole blocks, no tail");
+    check(h.samples <= (uint64_t)w.dataBytes / REC_ADPCM_BLOCK_BYTES * REC_SAMPLES_PER_BLOCK, "fact within the data");
+    std::vector<int16_t> pcm;
+    check(decodeAll(f, w, pcm), "decode");
+    printf("seq %u, %u Hz (source %u Hz), %zu samples, %.1f s, start epoch %u, level %.1f dBFS\n", w.seq, w.rate,
+           w.sourceRate, pcm.size(), w.rate ? (double)pcm.size() / w.rate : 0.0, w.startEpoch, levelDbfs(pcm));
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+    uint32_t rate = 16000;
+    double seconds = 3.3;
+    double minSnr = 20.0;
+    const char *out = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--rate") && i + 1 < argc) rate = (uint32_t)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--seconds") && i + 1 < argc) seconds = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--min-snr") && i + 1 < argc) minSnr = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--out") && i + 1 < argc) out = argv[++i];
+        else if (!strcmp(argv[i], "--check") && i + 1 < argc) return checkFile(argv[++i]);
+        else { usage(argv[0]); return 2; }
+    }
+    if (rate < 8000 || seconds <= 0.0) { usage(argv[0]); return 2; }
+
+    // Log chirp 100 Hz .. 0.4 fs at -12 dBFS plus a little noise, so every step size is used.
+    const size_t n = (size_t)(seconds * rate);
+    std::vector<int16_t> pcm(n);
+    srand(1);
+    double phase = 0.0, f0 = 100.0, f1 = 0.4 * rate;
+    for (size_t i = 0; i < n; i++) {
+        double f = f0 * pow(f1 / f0, (double)i / n);
+        phase += 2.0 * M_PI * f / rate;
+        double noise = ((rand() & 0xFFFF) / 65535.0 - 0.5) * 200.0;
+        pcm[i] = (int16_t)lrint(8192.0 * sin(phase) + noise);
+    }
+    RecSegmentInfo info = {42, 1760000000UL, 1234, rate * 2};
+
+    std::vector<uint8_t> file = encodeSegment(pcm, rate, info, true);
+    const uint32_t blocks = (uint32_t)((n + REC_SAMPLES_PER_BLOCK - 1) / REC_SAMPLES_PER_BLOCK);
+    printf("rate %u Hz, %zu samples, %u blocks of %u samples, %zu bytes\n", rate, n, blocks, REC_SAMPLES_PER_BLOCK,
+           file.size());
+
+    WavInfo w;
+    check(walkRiff(file, w), "RIFF walk");
+    check(w.format == REC_WAVE_FORMAT_IMA_ADPCM && w.channels == 1 && w.bits == 4, "fmt: IMA ADPCM, mono, 4 bits");
+    check(w.rate == rate && w.blockAlign == REC_ADPCM_BLOCK_BYTES && w.samplesPerBlock == REC_SAMPLES_PER_BLOCK,
+          "fmt: rate, block align, samples per block");
+    check(w.byteRate > 0 && fabs((double)w.byteRate - rate / 2.0) / (rate / 2.0) < 0.01, "fmt: byte rate ~ rate/2");
+    check(w.hasFact && w.factSamples == n, "fact: sample count");
+    check(w.hasInfo && w.seq == info.seq && w.startEpoch == info.startEpoch && w.sourceRate == info.sourceRate,
+          "emrc: segment info");
+    check(w.dataOffset == REC_HEADER_BYTES && w.dataBytes == blocks * REC_ADPCM_BLOCK_BYTES,
+          "data: sector-aligned, whole blocks");
+    check(rec_get32(&file[4]) + 8 == file.size(), "RIFF size");
+
+    RecSegmentHeader h;
+    check(rec_parseHeader(file.data(), h) && h.sampleRate == rate && h.samples == n &&
+              h.dataBytes == w.dataBytes && h.info.seq == info.seq && h.info.startUptimeS == info.startUptimeS,
+          "rec_parseHeader round trip");
+
+    std::vector<int16_t> dec;
+    check(decodeAll(file, w, dec) && dec.size() == n, "reference decode length");
+    double sig = 0.0, err = 0.0;
+    for (size_t i = 0; i < n && i < dec.size(); i++) {
+        double d = (double)pcm[i] - dec[i];
+        sig += (double)pcm[i] * pcm[i];
+        err += d * d;
+    }
+    double snr = err > 0.0 ? 10.0 * log10(sig / err) : 144.0;
+    printf("round-trip SNR %.1f dB (min %.1f)\n", snr, minSnr);
+    check(snr >= minSnr, "round-trip SNR");
+
+    // Torn segment: header never closed, power lost in the middle of a block.
+    std::vector<uint8_t> torn = encodeSegment(pcm, rate, info, false);
+    torn.resize(torn.size() - REC_ADPCM_BLOCK_BYTES / 2);
+    RecSegmentHeader th;
+    check(rec_parseHeader(torn.data(), th) && th.dataBytes == 0 && th.samples == 0, "unclosed header parses empty");
+    uint32_t keep = rec_wholeBlockBytes((uint32_t)torn.size());
+    check(keep == (blocks - 1) * REC_ADPCM_BLOCK_BYTES, "repair keeps whole blocks only");
+    torn.resize(REC_HEADER_BYTES + keep);
+    rec_buildHeader(torn.data(), th.sampleRate, th.info, keep, keep / REC_ADPCM_BLOCK_BYTES * REC_SAMPLES_PER_BLOCK);
+    WavInfo tw;
+    std::vector<int16_t> tdec;
+    check(walkRiff(torn, tw) && decodeAll(torn, tw, tdec) && tdec.size() == (blocks - 1) * REC_SAMPLES_PER_BLOCK &&
+              !memcmp(tdec.data(), dec.data(), tdec.size() * sizeof(int16_t)),
+          "repaired segment decodes to the same prefix");
+    check(rec_wholeBlockBytes(REC_HEADER_BYTES) == 0 && rec_wholeBlockBytes(100) == 0, "repair of a header-only file");
+
+    uint8_t bad[REC_HEADER_BYTES];
+    memcpy(bad, file.data(), REC_HEADER_BYTES);
+    rec_put16(bad + REC_OFF_FMT + 8, 1);   // PCM
+    check(!rec_parseHeader(bad, h), "foreign WAV rejected");
+
+    if (out) {
+        FILE *fp = fopen(out, "wb");
+        bool ok = fp && fwrite(file.data(), 1, file.size(), fp) == file.size();
+        if (fp) fclose(fp);
+        check(ok, "write --out");
+    }
+    printf("%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
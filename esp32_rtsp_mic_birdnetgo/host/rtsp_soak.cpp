@@ -0,0 +1,633 @@
+// RTSP soak/load test client for the ESP32 RTSP Mic (or the host build).
+//
+//   rtsp_soak [--url rtsp://HOST[:PORT]/PATH] [--duration SEC] [--report SEC]
+//             [--disconnect-every SEC] [--json FILE] [--label TEXT] [--fail-on-gap MS]
+//
+// Runs OPTIONS/DESCRIBE/SETUP/PLAY over RTP/AVP/TCP (interleaved), parses the `$` frames and
+// reports sequence gaps, RTP timestamp continuity against the rtpmap rate, RFC 3550
+// inter-arrival jitter, an arrival-gap histogram, throughput and - when the stream drops or
+// --disconnect-every forces it - the time from reconnect to the first packet.
+//
+// A progress line goes to stderr every --report seconds. The JSON summary is written to
+// --json (rewritten at every report, so an interrupted soak still leaves one) or stdout.
+// Ctrl+C ends the run cleanly; --duration 0 runs until then. With --fail-on-gap the exit code
+// is also 1 when a packet was lost or two packets arrived more than MS apart.
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+volatile sig_atomic_t g_stop = 0;
+
+void onSignal(int) { g_stop = 1; }
+
+double nowSec() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Arrival-gap histogram: bucket b holds gaps in [2^(b-1), 2^b) ms, bucket 0 is < 1 ms,
+// the last one is open-ended (>= 2048 ms).
+const int GAP_BUCKETS = 13;
+
+struct Stats {
+    // Whole run
+    uint64_t packets = 0;
+    uint64_t payloadBytes = 0;
+    uint64_t lost = 0;             // missing sequence numbers
+    uint64_t duplicates = 0;       // repeated or late (reordered) sequence numbers
+    uint64_t tsJumps = 0;          // timestamp != previous + previous packet's samples
+    uint64_t ssrcChanges = 0;
+    uint64_t badFrames = 0;        // non-RTP data on channel 0, unknown channels
+    uint64_t gapHist[GAP_BUCKETS] = {};
+    double maxGapMs = 0.0;
+    uint64_t gapsOver100ms = 0;
+    uint64_t gapsOver1s = 0;
+    double jitterMs = 0.0;         // RFC 3550 estimator, current
+    double jitterMaxMs = 0.0;
+    // Steady state of every session (from 1 s after its first packet, when the burst of
+    // audio queued before PLAY has drained): throughput and the sender's clock rate.
+    double streamSec = 0.0;
+    double mediaSec = 0.0;
+    uint64_t streamBytes = 0;
+
+    // Sessions and reconnects; the format is the last one the server announced
+    std::string encoding;
+    uint32_t clockRate = 0;
+    uint32_t channels = 1;
+    uint32_t sessions = 0;
+    uint32_t forcedDisconnects = 0;
+    uint32_t drops = 0;            // server closed or stalled
+    uint32_t failedConnects = 0;
+    std::vector<double> reconnectMs;
+
+    // Per report interval
+    uint64_t intervalBytes = 0;
+    double minKbps = -1.0;
+    double maxKbps = 0.0;
+};
+
+struct Session {
+    int fd = -1;
+    int cseq = 0;
+    std::string sessionId;
+    std::string controlUrl;
+    uint32_t clockRate = 0;
+    uint32_t channels = 1;
+    std::string encoding;
+    std::vector<uint8_t> buf;
+    // RTP state
+    bool havePrev = false;
+    uint16_t prevSeq = 0;
+    uint32_t prevTs = 0;
+    uint32_t prevSamples = 0;
+    uint32_t ssrc = 0;
+    double prevArrival = 0.0;
+    double firstArrival = 0.0;
+    double lastArrival = 0.0;
+    uint64_t tsSpan = 0;           // sum of timestamp steps, unwrapped
+    uint64_t bytes = 0;
+    bool haveRef = false;          // steady-state reference point
+    double refArrival = 0.0;
+    uint64_t refTsSpan = 0;
+    uint64_t refBytes = 0;
+    double lastKeepAlive = 0.0;
+};
+
+struct Options {
+    std::string host = "127.0.0.1";
+    int port = 8554;
+    std::string path = "/audio";
+    std::string url;
+    double durationSec = 60.0;
+    double reportSec = 10.0;
+    double disconnectEverySec = 0.0;
+    std::string jsonPath;
+    std::string label;
+    double failOnGapMs = 0.0;      // 0: only "no packet at all" fails
+};
+
+void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--url rtsp://HOST[:PORT]/PATH] [--duration SEC] [--report SEC]\n"
+            "          [--disconnect-every SEC] [--json FILE] [--label TEXT] [--fail-on-gap MS]\n",
+            argv0);
+}
+
+bool parseUrl(const std::string &url, Options &o) {
+    const std::string scheme = "rtsp://";
+    if (url.compare(0, scheme.size(), scheme) != 0) return false;
+    std::string rest = url.substr(scheme.size());
+    size_t slash = rest.find('/');
+    std::string hostPort = rest.substr(0, slash);
+    o.path = slash == std::string::npos ? "/" : rest.substr(slash);
+    size_t colon = hostPort.rfind(':');
+    if (colon != std::string::npos) {
+        o.host = hostPort.substr(0, colon);
+        o.port = atoi(hostPort.c_str() + colon + 1);
+    } else {
+        o.host = hostPort;
+    }
+    o.url = url;
+    return !o.host.empty() && o.port > 0 && o.port < 65536;
+}
+
+int connectTcp(const Options &o, double timeoutSec) {
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo *res = nullptr;
+    if (getaddrinfo(o.host.c_str(), std::to_string(o.port).c_str(), &hints, &res) != 0) return -1;
+    int fd = -1;
+    for (addrinfo *ai = res; ai; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0) continue;
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        int rc = connect(fd, ai->ai_addr, ai->ai_addrlen);
+        if (rc != 0 && errno == EINPROGRESS) {
+            pollfd p = {fd, POLLOUT, 0};
+            if (poll(&p, 1, (int)(timeoutSec * 1000)) == 1) {
+                int err = 0;
+                socklen_t len = sizeof(err);
+                getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len);
+                rc = err == 0 ? 0 : -1;
+            }
+        }
+        if (rc == 0) break;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+    if (fd >= 0) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    return fd;
+}
+
+bool sendAll(int fd, const std::string &s) {
+    size_t off = 0;
+    while (off < s.size()) {
+        ssize_t n = send(fd, s.data() + off, s.size() - off, MSG_NOSIGNAL);
+        if (n < 0 && (errno == EAGAIN || errno == EINTR)) {
+            pollfd p = {fd, POLLOUT, 0};
+            poll(&p, 1, 1000);
+            continue;
+        }
+        if (n <= 0) return false;
+        off += (size_t)n;
+    }
+    return true;
+}
+
+// Reads whatever is available (waiting up to timeoutMs). Returns false on EOF/error.
+bool fill(Session &s, int timeoutMs) {
+    pollfd p = {s.fd, POLLIN, 0};
+    int rc = poll(&p, 1, timeoutMs);
+    if (rc < 0) return errno == EINTR;
+    if (rc == 0) return true;
+    uint8_t tmp[16384];
+    ssize_t n = recv(s.fd, tmp, sizeof(tmp), 0);
+    if (n < 0) return errno == EAGAIN || errno == EINTR;
+    if (n == 0) return false;
+    s.buf.insert(s.buf.end(), tmp, tmp + n);
+    return true;
+}
+
+std::string headerValue(const std::string &resp, const char *name) {
+    std::string lower = resp;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    std::string key = std::string("\r\n") + name + ":";
+    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+    size_t pos = lower.find(key);
+    if (pos == std::string::npos) return "";
+    pos += key.size();
+    size_t end = resp.find("\r\n", pos);
+    std::string v = resp.substr(pos, end - pos);
+    v.erase(0, v.find_first_not_of(" \t"));
+    v.erase(v.find_last_not_of(" \t") + 1);
+    return v;
+}
+
+// Takes one RTSP response (headers + body) off the front of the buffer, if complete.
+bool takeResponse(Session &s, std::string &out) {
+    if (s.buf.empty() || s.buf[0] != 'R') return false;
+    std::string text(s.buf.begin(), s.buf.end());
+    size_t hdrEnd = text.find("\r\n\r\n");
+    if (hdrEnd == std::string::npos) return false;
+    size_t total = hdrEnd + 4;
+    std::string clen = headerValue(text.substr(0, hdrEnd + 2), "Content-Length");
+    if (!clen.empty()) total += (size_t)atoi(clen.c_str());
+    if (text.size() < total) return false;
+    out = text.substr(0, total);
+    s.buf.erase(s.buf.begin(), s.buf.begin() + (long)total);
+    return true;
+}
+
+// Sends a request and waits for its response; interleaved frames received meanwhile are dropped.
+bool request(Session &s, const std::string &method, const std::string &url, const std::string &extra,
+             std::string &resp, double timeoutSec) {
+    std::string req = method + " " + url + " RTSP/1.0\r\nCSeq: " + std::to_string(++s.cseq) +
+                      "\r\nUser-Agent: rtsp_soak\r\n" + extra + "\r\n";
+    if (!sendAll(s.fd, req)) return false;
+    double deadline = nowSec() + timeoutSec;
+    while (nowSec() < deadline && !g_stop) {
+        while (!s.buf.empty() && s.buf[0] == '$') {
+            if (s.buf.size() < 4) break;
+            size_t len = ((size_t)s.buf[2] << 8) | s.buf[3];
+            if (s.buf.size() < 4 + len) break;
+            s.buf.erase(s.buf.begin(), s.buf.begin() + (long)(4 + len));
+        }
+        if (takeResponse(s, resp)) {
+            return resp.compare(0, 12, "RTSP/1.0 200") == 0;
+        }
+        if (!fill(s, 100)) return false;
+    }
+    return false;
+}
+
+bool parseSdp(Session &s, const std::string &resp) {
+    size_t body = resp.find("\r\n\r\n");
+    std::string sdp = body == std::string::npos ? "" : resp.substr(body + 4);
+    size_t pos = sdp.find("a=rtpmap:");
+    if (pos == std::string::npos) return false;
+    // a=rtpmap:96 L16/48000/1
+    size_t sp = sdp.find(' ', pos);
+    size_t eol = sdp.find("\r\n", pos);
+    std::string map = sdp.substr(sp + 1, eol - sp - 1);
+    size_t a = map.find('/');
+    size_t b = map.find('/', a + 1);
+    s.encoding = map.substr(0, a);
+    s.clockRate = (uint32_t)strtoul(map.c_str() + a + 1, nullptr, 10);
+    s.channels = b == std::string::npos ? 1 : (uint32_t)strtoul(map.c_str() + b + 1, nullptr, 10);
+    if (s.channels == 0) s.channels = 1;
+    std::string base = headerValue(resp, "Content-Base");
+    size_t ctl = sdp.find("a=control:");
+    std::string track = ctl == std::string::npos ? "" : sdp.substr(ctl + 10, sdp.find("\r\n", ctl) - ctl - 10);
+    if (track.compare(0, 7, "rtsp://") == 0) s.controlUrl = track;
+    else if (!base.empty()) s.controlUrl = base + (base.back() == '/' ? "" : "/") + track;
+    return s.clockRate > 0;
+}
+
+bool startSession(const Options &o, Session &s) {
+    s = Session();
+    s.fd = connectTcp(o, 5.0);
+    if (s.fd < 0) return false;
+    std::string resp;
+    if (!request(s, "OPTIONS", o.url, "", resp, 5.0)) return false;
+    if (!request(s, "DESCRIBE", o.url, "Accept: application/sdp\r\n", resp, 5.0)) return false;
+    if (!parseSdp(s, resp)) return false;
+    if (s.controlUrl.empty()) s.controlUrl = o.url + "/track1";
+    if (!request(s, "SETUP", s.controlUrl, "Transport: RTP/AVP/TCP;unicast;interleaved=0-1\r\n", resp, 5.0)) {
+        return false;
+    }
+    s.sessionId = headerValue(resp, "Session");
+    s.sessionId = s.sessionId.substr(0, s.sessionId.find(';'));
+    if (!request(s, "PLAY", o.url, "Session: " + s.sessionId + "\r\nRange: npt=0.000-\r\n", resp, 5.0)) {
+        return false;
+    }
+    s.lastKeepAlive = nowSec();
+    return true;
+}
+
+void addSteadyState(const Session &s, Stats &st) {
+    if (!s.haveRef) return;
+    st.streamSec += s.lastArrival - s.refArrival;
+    st.mediaSec += (double)(s.tsSpan - s.refTsSpan) / s.clockRate;
+    st.streamBytes += s.bytes - s.refBytes;
+}
+
+void endSession(Session &s, Stats &st, bool teardown) {
+    if (s.fd < 0) return;
+    if (teardown) {
+        std::string req = "TEARDOWN " + s.controlUrl + " RTSP/1.0\r\nCSeq: " + std::to_string(++s.cseq) +
+                          "\r\nSession: " + s.sessionId + "\r\n\r\n";
+        sendAll(s.fd, req);
+    }
+    close(s.fd);
+    s.fd = -1;
+    addSteadyState(s, st);
+}
+
+void onRtp(Session &s, Stats &st, const uint8_t *p, size_t len, double arrival) {
+    if (len < 12 || (p[0] >> 6) != 2) {
+        st.badFrames++;
+        return;
+    }
+    size_t hdr = 12 + 4 * (size_t)(p[0] & 0x0F);
+    if (p[0] & 0x10) {   // header extension
+        if (len < hdr + 4) { st.badFrames++; return; }
+        hdr += 4 + 4 * (((size_t)p[hdr + 2] << 8) | p[hdr + 3]);
+    }
+    if (len < hdr) { st.badFrames++; return; }
+    size_t payload = len - hdr;
+    if ((p[0] & 0x20) && payload > 0) payload -= std::min<size_t>(payload, p[len - 1]);   // padding
+    uint16_t seq = (uint16_t)((p[2] << 8) | p[3]);
+    uint32_t ts = ((uint32_t)p[4] << 24) | ((uint32_t)p[5] << 16) | ((uint32_t)p[6] << 8) | p[7];
+    uint32_t ssrc = ((uint32_t)p[8] << 24) | ((uint32_t)p[9] << 16) | ((uint32_t)p[10] << 8) | p[11];
+    uint32_t bytesPerSample = s.encoding == "L8" ? 1 : 2;
+    uint32_t samples = (uint32_t)(payload / (bytesPerSample * s.channels));
+
+    st.packets++;
+    st.payloadBytes += payload;
+    st.intervalBytes += payload;
+
+    if (!s.havePrev) {
+        s.havePrev = true;
+        s.ssrc = ssrc;
+        s.firstArrival = arrival;
+    } else {
+        if (ssrc != s.ssrc) {
+            st.ssrcChanges++;
+            s.ssrc = ssrc;
+        }
+        int16_t d = (int16_t)(uint16_t)(seq - s.prevSeq);
+        if (d <= 0) {
+            st.duplicates++;
+            return;   // keep the newest packet as the reference
+        }
+        st.lost += (uint64_t)(d - 1);
+        uint32_t expectTs = s.prevTs + s.prevSamples * (uint32_t)d;
+        if (ts != expectTs) st.tsJumps++;
+        s.tsSpan += (uint32_t)(ts - s.prevTs);
+
+        double gapMs = (arrival - s.prevArrival) * 1000.0;
+        int b = 0;
+        while (b < GAP_BUCKETS - 1 && gapMs >= (double)(1u << b)) b++;
+        st.gapHist[b]++;
+        if (gapMs > st.maxGapMs) st.maxGapMs = gapMs;
+        if (gapMs > 100.0) st.gapsOver100ms++;
+        if (gapMs > 1000.0) st.gapsOver1s++;
+
+        // RFC 3550 6.4.1: D = (Rj - Ri) - (Sj - Si), J += (|D| - J) / 16, in timestamp units.
+        double dTs = (double)(int32_t)(ts - s.prevTs) / s.clockRate;
+        double dev = std::fabs((arrival - s.prevArrival) - dTs) * 1000.0;
+        st.jitterMs += (dev - st.jitterMs) / 16.0;
+        if (st.jitterMs > st.jitterMaxMs) st.jitterMaxMs = st.jitterMs;
+    }
+    s.bytes += payload;
+    if (!s.haveRef && arrival - s.firstArrival >= 1.0) {
+        s.haveRef = true;
+        s.refArrival = arrival;
+        s.refTsSpan = s.tsSpan;
+        s.refBytes = s.bytes;
+    }
+    s.prevSeq = seq;
+    s.prevTs = ts;
+    s.prevSamples = samples;
+    s.prevArrival = arrival;
+    s.lastArrival = arrival;
+}
+
+// Handles everything complete in the buffer. Returns the number of RTP packets seen.
+int drain(Session &s, Stats &st, double arrival) {
+    int packets = 0;
+    for (;;) {
+        if (s.buf.empty()) break;
+        if (s.buf[0] == '$') {
+            if (s.buf.size() < 4) break;
+            size_t len = ((size_t)s.buf[2] << 8) | s.buf[3];
+            if (s.buf.size() < 4 + len) break;
+            if (s.buf[1] == 0) {
+                onRtp(s, st, s.buf.data() + 4, len, arrival);
+                packets++;
+            } else if (s.buf[1] != 1) {
+                st.badFrames++;
+            }
+            s.buf.erase(s.buf.begin(), s.buf.begin() + (long)(4 + len));
+        } else {
+            std::string resp;
+            if (takeResponse(s, resp)) continue;   // keep-alive replies
+            if (s.buf[0] != 'R') {
+                st.badFrames++;   // out of sync: skip to the next frame start
+                auto it = std::find(s.buf.begin() + 1, s.buf.end(), (uint8_t)'$');
+                s.buf.erase(s.buf.begin(), it);
+                continue;
+            }
+            break;
+        }
+    }
+    return packets;
+}
+
+std::string jsonString(const std::string &v) {
+    std::string out = "\"";
+    for (char c : v) {
+        if (c == '"' || c == '\\') out += '\\';
+        if ((unsigned char)c < 0x20) continue;
+        out += c;
+    }
+    return out + "\"";
+}
+
+std::string summaryJson(const Options &o, const Stats &st, double elapsed) {
+    char b[256];
+    std::string j = "{";
+    j += "\"label\":" + jsonString(o.label) + ",";
+    j += "\"url\":" + jsonString(o.url) + ",";
+    snprintf(b, sizeof(b), "\"elapsed_s\":%.1f,", elapsed);
+    j += b;
+    j += "\"encoding\":" + jsonString(st.encoding) + ",";
+    j += "\"clock_rate\":" + std::to_string(st.clockRate) + ",";
+    j += "\"channels\":" + std::to_string(st.channels) + ",";
+    j += "\"packets\":" + std::to_string(st.packets) + ",";
+    j += "\"payload_bytes\":" + std::to_string(st.payloadBytes) + ",";
+    uint64_t expected = st.packets + st.lost;
+    snprintf(b, sizeof(b), "\"lost\":%llu,\"loss_pct\":%.4f,\"duplicates\":%llu,\"ts_jumps\":%llu,\"ssrc_changes\":%llu,\"bad_frames\":%llu,",
+             (unsigned long long)st.lost, expected ? 100.0 * (double)st.lost / (double)expected : 0.0,
+             (unsigned long long)st.duplicates, (unsigned long long)st.tsJumps,
+             (unsigned long long)st.ssrcChanges, (unsigned long long)st.badFrames);
+    j += b;
+    double kbps = st.streamSec > 0 ? (double)st.streamBytes * 8.0 / st.streamSec / 1000.0 : 0.0;
+    double nominalKbps = (double)st.clockRate * st.channels * (st.encoding == "L8" ? 8 : 16) / 1000.0;
+    // Media time vs wall time while streaming: > 0 means the sender's clock runs fast.
+    double driftPpm = st.streamSec > 1.0 ? (st.mediaSec / st.streamSec - 1.0) * 1e6 : 0.0;
+    snprintf(b, sizeof(b), "\"kbps\":%.2f,\"kbps_nominal\":%.2f,\"kbps_min\":%.2f,\"kbps_max\":%.2f,\"clock_drift_ppm\":%.0f,",
+             kbps, nominalKbps, st.minKbps < 0 ? 0.0 : st.minKbps, st.maxKbps, driftPpm);
+    j += b;
+    snprintf(b, sizeof(b), "\"jitter_ms\":%.3f,\"jitter_max_ms\":%.3f,\"gap_max_ms\":%.1f,\"gaps_over_100ms\":%llu,\"gaps_over_1s\":%llu,",
+             st.jitterMs, st.jitterMaxMs, st.maxGapMs, (unsigned long long)st.gapsOver100ms,
+             (unsigned long long)st.gapsOver1s);
+    j += b;
+    j += "\"gap_hist_ms\":{";
+    for (int i = 0; i < GAP_BUCKETS; i++) {
+        std::string key = i == 0 ? "<1" : (i == GAP_BUCKETS - 1 ? ">=" + std::to_string(1u << (i - 1))
+                                                                 : std::to_string(1u << (i - 1)) + "-" + std::to_string(1u << i));
+        if (i) j += ",";
+        j += "\"" + key + "\":" + std::to_string(st.gapHist[i]);
+    }
+    j += "},";
+    j += "\"sessions\":" + std::to_string(st.sessions) + ",";
+    j += "\"forced_disconnects\":" + std::to_string(st.forcedDisconnects) + ",";
+    j += "\"drops\":" + std::to_string(st.drops) + ",";
+    j += "\"failed_connects\":" + std::to_string(st.failedConnects) + ",";
+    if (st.reconnectMs.empty()) {
+        j += "\"reconnect_ms\":null";
+    } else {
+        std::vector<double> r = st.reconnectMs;
+        std::sort(r.begin(), r.end());
+        double sum = 0;
+        for (double v : r) sum += v;
+        snprintf(b, sizeof(b), "\"reconnect_ms\":{\"count\":%zu,\"min\":%.1f,\"avg\":%.1f,\"p95\":%.1f,\"max\":%.1f}",
+                 r.size(), r.front(), sum / (double)r.size(), r[(size_t)((double)(r.size() - 1) * 0.95)], r.back());
+        j += b;
+    }
+    return j + "}\n";
+}
+
+void writeSummary(const Options &o, const std::string &json) {
+    if (o.jsonPath.empty()) return;
+    std::string tmp = o.jsonPath + ".tmp";
+    FILE *f = fopen(tmp.c_str(), "w");
+    if (!f) return;
+    fputs(json.c_str(), f);
+    fclose(f);
+    rename(tmp.c_str(), o.jsonPath.c_str());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    Options o;
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        auto next = [&](void) -> const char * {
+            if (i + 1 >= argc) {
+                usage(argv[0]);
+                exit(2);
+            }
+            return argv[++i];
+        };
+        if (a == "--url") {
+            if (!parseUrl(next(), o)) {
+                fprintf(stderr, "bad URL %s\n", argv[i]);
+                return 2;
+            }
+        } else if (a == "--duration") {
+            o.durationSec = atof(next());
+        } else if (a == "--report") {
+            o.reportSec = atof(next());
+        } else if (a == "--disconnect-every") {
+            o.disconnectEverySec = atof(next());
+        } else if (a == "--json") {
+            o.jsonPath = next();
+        } else if (a == "--label") {
+            o.label = next();
+        } else if (a == "--fail-on-gap") {
+            o.failOnGapMs = atof(next());
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (o.url.empty()) o.url = "rtsp://" + o.host + ":" + std::to_string(o.port) + o.path;
+    if (o.reportSec <= 0) o.reportSec = 10.0;
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+
+    Stats st;
+    Session s;
+    const double start = nowSec();
+    double nextReport = start + o.reportSec;
+    double sessionStart = 0.0;
+    double reconnectStart = -1.0;   // set while waiting for the first packet after a reconnect
+    double lastPacket = 0.0;
+    double retryDelay = 0.5;
+    std::string lastJson;
+
+    while (!g_stop && (o.durationSec <= 0 || nowSec() - start < o.durationSec)) {
+        if (s.fd < 0) {
+            double t0 = nowSec();
+            if (!startSession(o, s)) {
+                endSession(s, st, false);
+                st.failedConnects++;
+                if (reconnectStart < 0 && st.sessions > 0) reconnectStart = t0;
+                usleep((useconds_t)(retryDelay * 1e6));
+                retryDelay = std::min(retryDelay * 2, 8.0);
+                continue;
+            }
+            retryDelay = 0.5;
+            st.encoding = s.encoding;
+            st.clockRate = s.clockRate;
+            st.channels = s.channels;
+            st.sessions++;
+            sessionStart = nowSec();
+            lastPacket = sessionStart;
+            if (st.sessions > 1 && reconnectStart < 0) reconnectStart = t0;
+        }
+
+        bool ok = fill(s, 50);
+        double t = nowSec();
+        if (drain(s, st, t) > 0) {
+            lastPacket = t;
+            if (reconnectStart >= 0) {
+                st.reconnectMs.push_back((t - reconnectStart) * 1000.0);
+                reconnectStart = -1.0;
+            }
+        }
+        if (!ok || t - lastPacket > 5.0) {
+            fprintf(stderr, "[soak] %s after %.1f s\n", ok ? "stream stalled" : "connection closed", t - sessionStart);
+            st.drops++;
+            endSession(s, st, false);
+            reconnectStart = t;
+            continue;
+        }
+        if (t - s.lastKeepAlive > 20.0) {
+            std::string req = "GET_PARAMETER " + o.url + " RTSP/1.0\r\nCSeq: " + std::to_string(++s.cseq) +
+                              "\r\nSession: " + s.sessionId + "\r\n\r\n";
+            sendAll(s.fd, req);
+            s.lastKeepAlive = t;
+        }
+        if (o.disconnectEverySec > 0 && t - sessionStart >= o.disconnectEverySec) {
+            st.forcedDisconnects++;
+            endSession(s, st, false);   // plain close, like a client that vanished
+            reconnectStart = nowSec();
+            continue;
+        }
+        if (t >= nextReport) {
+            double kbps = (double)st.intervalBytes * 8.0 / o.reportSec / 1000.0;
+            st.intervalBytes = 0;
+            if (st.minKbps < 0 || kbps < st.minKbps) st.minKbps = kbps;
+            if (kbps > st.maxKbps) st.maxKbps = kbps;
+            fprintf(stderr, "[soak] %6.0f s  pkts %llu  lost %llu  ts_jumps %llu  jitter %.2f ms  gap_max %.1f ms  %.1f kbps  reconnects %zu\n",
+                    t - start, (unsigned long long)st.packets, (unsigned long long)st.lost,
+                    (unsigned long long)st.tsJumps, st.jitterMs, st.maxGapMs, kbps, st.reconnectMs.size());
+            nextReport += o.reportSec;
+            if (nextReport < t) nextReport = t + o.reportSec;
+            Stats snap = st;
+            addSteadyState(s, snap);
+            writeSummary(o, summaryJson(o, snap, t - start));
+        }
+    }
+    endSession(s, st, true);
+    std::string json = summaryJson(o, st, nowSec() - start);
+    if (o.jsonPath.empty()) fputs(json.c_str(), stdout);
+    else writeSummary(o, json);
+    if (st.packets == 0) return 1;
+    if (o.failOnGapMs > 0 && (st.lost > 0 || st.maxGapMs > o.failOnGapMs)) {
+        fprintf(stderr, "[soak] FAIL: lost %llu, gap_max %.1f ms (limit %.0f ms)\n", (unsigned long long)st.lost,
+                st.maxGapMs, o.failOnGapMs);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,199 @@
+// Decision check for the stream watchdog (StreamWatchdog.h) with synthetic counters.
+//
+//   stream_watchdog
+//
+// Feeds tick() one second at a time with a chosen packet count (48 kHz / 1024 samples, so
+// 47 pkt/s nominal) and checks what it decides: warm-up after a stream (re)start, stall and
+// degraded detection, the escalation ladder log -> reset DSP -> restart I2S -> reconnect Wi-Fi
+// with its escalate and settle delays, the top step repeating, a degraded episode turning
+// into a stall without going back down the ladder, recovery after recoverSec healthy seconds
+// (credited to the last action), counters restarting from zero, and autoRecovery off (one log,
+// nothing else). Exits non-zero on the first failed check.
+#include <stdio.h>
+
+#include <vector>
+
+#include "StreamWatchdog.h"
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+    printf("  %-58s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok) failures++;
+}
+
+static const uint32_t NOMINAL = 47;
+
+struct Event {
+    uint32_t sec;
+    WatchdogAction action;
+};
+
+struct Sim {
+    StreamWatchdog wd;
+    WatchdogConfig cfg;
+    uint32_t sec = 0;
+    uint32_t packets = 0;
+    uint32_t samples = 0;
+    std::vector<Event> events;
+
+    Sim() {
+        wd.reset();
+        wd.clearStats();
+        cfg.minRate = 40;
+    }
+
+    WatchdogAction step(uint32_t dp, bool streaming = true) {
+        packets += dp;
+        samples += dp * 1024;
+        sec++;
+        WatchdogAction a = wd.tick(cfg, sec * 1000, streaming, packets, samples, NOMINAL);
+        if (a != WD_NONE) events.push_back({sec, a});
+        return a;
+    }
+    void run(uint32_t seconds, uint32_t dp) {
+        for (uint32_t i = 0; i < seconds; i++) step(dp);
+    }
+    // Stream start plus warm-up at the nominal rate
+    void start() {
+        step(0);
+        run(cfg.warmupSec, NOMINAL);
+    }
+};
+
+static bool actionsAre(const Sim &s, const std::vector<WatchdogAction> &want) {
+    if (s.events.size() != want.size()) return false;
+    for (size_t i = 0; i < want.size(); i++) {
+        if (s.events[i].action != want[i]) return false;
+    }
+    return true;
+}
+
+static void warmup() {
+    printf("warm-up\n");
+    Sim s;
+    s.step(0);
+    s.run(s.cfg.warmupSec, 0);
+    check(s.events.empty() && s.wd.stallSeconds() == 0, "no packets during warm-up: not counted");
+    check(s.wd.packetRate() < NOMINAL, "rate still tracked during warm-up");
+    s.run(s.cfg.stallSec - 1, 0);
+    check(s.events.empty() && s.wd.fault() == WD_FAULT_NONE, "stall below stallSec: no fault");
+    check(s.step(0) == WD_LOG && s.wd.fault() == WD_FAULT_STALL, "stallSec reached: stall, first step logs");
+}
+
+static void stallLadder() {
+    printf("stall ladder\n");
+    Sim s;
+    s.start();
+    const uint32_t t0 = s.sec;
+    s.run(45, 0);
+    const WatchdogConfig &c = s.cfg;
+    check(actionsAre(s, {WD_LOG, WD_RESET_DSP, WD_RESTART_I2S, WD_RECONNECT_WIFI, WD_RECONNECT_WIFI}),
+          "log, reset DSP, restart I2S, reconnect Wi-Fi, repeat");
+    if (s.events.size() == 5) {
+        check(s.events[0].sec == t0 + c.stallSec, "log when the stall reaches stallSec");
+        check(s.events[1].sec - s.events[0].sec == c.escalateSec + 1u, "next step escalateSec after a log");
+        check(s.events[2].sec - s.events[1].sec == c.settleSec + c.escalateSec + 1u,
+              "after an action: settleSec, then escalateSec");
+        check(s.events[4].sec - s.events[3].sec == c.settleSec + c.escalateSec + 1u, "top step repeats at that pace");
+    }
+    const WatchdogStats &st = s.wd.stats();
+    check(st.stalls == 1 && st.degradations == 0, "one stall episode");
+    check(st.actions[WD_LOG] == 1 && st.actions[WD_RESET_DSP] == 1 && st.actions[WD_RESTART_I2S] == 1 &&
+              st.actions[WD_RECONNECT_WIFI] == 2,
+          "actions counted per step");
+    check(st.longestStallSec == 45 && st.lastAction == WD_RECONNECT_WIFI, "longest stall and last action");
+}
+
+static void recovery() {
+    printf("settle and recovery\n");
+    Sim s;
+    s.start();
+    s.run(s.cfg.stallSec + s.cfg.escalateSec + 1, 0);   // log, then reset DSP
+    check(actionsAre(s, {WD_LOG, WD_RESET_DSP}), "stall escalated to reset DSP");
+    s.run(s.cfg.settleSec, 0);
+    check(s.events.size() == 2, "no judgement while settling");
+    s.run(s.cfg.recoverSec - 1, NOMINAL);
+    check(s.wd.fault() == WD_FAULT_STALL && s.wd.level() == WD_RESET_DSP, "healthy below recoverSec: episode open");
+    s.step(NOMINAL);
+    check(s.wd.fault() == WD_FAULT_NONE && s.wd.level() == 0, "recoverSec healthy seconds end the episode");
+    check(s.wd.stats().recoveries[WD_RESET_DSP] == 1, "recovery credited to the last action");
+    check(s.wd.packetRate() == NOMINAL, "rate back to nominal");
+
+    s.run(s.cfg.stallSec, 0);
+    check(s.events.size() == 3 && s.events[2].action == WD_LOG && s.wd.stats().stalls == 2,
+          "next stall starts at the bottom of the ladder");
+}
+
+static void degraded() {
+    printf("degraded\n");
+    Sim s;
+    s.start();
+    const uint32_t t0 = s.sec;
+    // EWMA 47 -> 20 with alpha 1/4 is 40 after the first low second, under minRate 40 after the second
+    s.run(s.cfg.degradeSec + 1, 20);
+    check(actionsAre(s, {WD_LOG}) && s.wd.fault() == WD_FAULT_DEGRADED, "low rate: degraded, first step logs");
+    check(!s.events.empty() && s.events[0].sec == t0 + s.cfg.degradeSec + 1, "after degradeSec seconds under minRate");
+    check(s.wd.stats().degradations == 1 && s.wd.stats().stalls == 0, "one degraded episode");
+    s.run(s.cfg.stallSec, 0);
+    check(s.wd.fault() == WD_FAULT_STALL && s.wd.stats().stalls == 1, "degraded turning into a stall counts a stall");
+    s.run(s.cfg.escalateSec, 0);
+    check(actionsAre(s, {WD_LOG, WD_RESET_DSP}), "ladder position kept: next step, no second log");
+
+    Sim w;
+    w.start();
+    w.run(30, 20);
+    check(w.wd.packetRate() == 20 && w.wd.windowRateX10() == 200 && w.wd.windowMin() == 20,
+          "EWMA and window follow the low rate");
+    Sim m;
+    m.start();
+    m.run(30, 39);
+    check(m.wd.stats().degradations == 1, "just under minRate is degraded");
+    Sim n;
+    n.start();
+    n.run(30, 40);
+    check(n.events.empty() && n.wd.stats().degradations == 0, "at minRate is healthy");
+}
+
+static void counters() {
+    printf("stream restarts\n");
+    Sim s;
+    s.start();
+    s.run(5, NOMINAL);
+    s.packets = 0;   // the sketch zeroes its counters on PLAY
+    s.samples = 0;
+    s.run(5, NOMINAL);
+    check(s.events.empty() && s.wd.packetRate() == NOMINAL, "counter reset is not a stall");
+    s.run(s.cfg.stallSec, 0);
+    check(s.events.size() == 1, "stall detected");
+    s.step(0, false);
+    check(s.wd.fault() == WD_FAULT_NONE && s.wd.level() == 0, "stream end clears the episode");
+    s.step(0);
+    s.run(s.cfg.warmupSec, 0);
+    check(s.events.size() == 1, "new stream: warm-up again");
+}
+
+static void noAutoRecovery() {
+    printf("autoRecovery off\n");
+    Sim s;
+    s.cfg.autoRecovery = false;
+    s.start();
+    s.run(120, 0);
+    const WatchdogStats &st = s.wd.stats();
+    check(actionsAre(s, {WD_LOG}), "one log per episode, nothing else");
+    check(st.actions[WD_RESET_DSP] == 0 && st.actions[WD_RESTART_I2S] == 0 && st.actions[WD_RECONNECT_WIFI] == 0,
+          "no recovery actions");
+    s.run(s.cfg.recoverSec, NOMINAL);
+    check(s.wd.fault() == WD_FAULT_NONE && st.recoveries[WD_LOG] == 1, "recovers on its own, credited to the log");
+}
+
+int main() {
+    warmup();
+    stallLadder();
+    recovery();
+    degraded();
+    counters();
+    noAutoRecovery();
+    printf("%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,311 @@
+// Golden byte vectors for the MQTT telemetry encoders (MqttTelemetry.h).
+//
+//   telemetry_golden
+//
+// The expected bytes are written out by hand from the MessagePack spec and RFC 8259, not
+// produced by the encoder: integer boundaries of every width (positive and negative fixint,
+// uint8/16/32/64, int8/16/32/64), float32 for the fixed-point types, nil/bool, str8/str16
+// lengths, fixmap vs. map16 headers around 15 entries, JSON string escaping and fixed-point
+// text. The delta cases check that telemetry_diff() picks exactly the changed fields and that
+// a delta mask emits only those, in table order, while the full mask emits all of them.
+// Exits non-zero if any vector differs (the first differing byte is printed).
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "MqttTelemetry.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+    printf("  %-58s %s\n", what, ok ? "ok" : "FAIL");
+    if (!ok) failures++;
+}
+
+static std::string hexdump(const Bytes &b) {
+    std::string s;
+    char t[4];
+    for (size_t i = 0; i < b.size(); i++) {
+        snprintf(t, sizeof(t), "%s%02X", i ? " " : "", b[i]);
+        s += t;
+    }
+    return s;
+}
+
+static void expectBytes(const Bytes &got, const Bytes &want, const char *what) {
+    bool ok = got == want;
+    check(ok, what);
+    if (!ok) {
+        printf("    want %s\n    got  %s\n", hexdump(want).c_str(), hexdump(got).c_str());
+    }
+}
+
+static void expectText(const Bytes &got, const char *want, const char *what) {
+    std::string s(got.begin(), got.end());
+    bool ok = s == want;
+    check(ok, what);
+    if (!ok) printf("    want %s\n    got  %s\n", want, s.c_str());
+}
+
+// Runs an encoder into a buffer that is large enough and returns the bytes.
+template <typename F>
+static Bytes encode(F f) {
+    uint8_t buf[2048];
+    TelemetryWriter w = {buf, sizeof(buf), 0};
+    f(w);
+    if (!w.ok()) return Bytes();
+    return Bytes(buf, buf + w.len);
+}
+
+static Bytes mpInt(int64_t v) {
+    return encode([&](TelemetryWriter &w) { telemetry_mpInt(w, v); });
+}
+
+// ---- MessagePack ----
+
+static void intCases() {
+    printf("MessagePack integers\n");
+    struct Case {
+        int64_t v;
+        Bytes want;
+        const char *what;
+    };
+    const Case cases[] = {
+        {0, {0x00}, "0: positive fixint"},
+        {127, {0x7F}, "127: largest positive fixint"},
+        {128, {0xCC, 0x80}, "128: uint8"},
+        {255, {0xCC, 0xFF}, "255: largest uint8"},
+        {256, {0xCD, 0x01, 0x00}, "256: uint16"},
+        {65535, {0xCD, 0xFF, 0xFF}, "65535: largest uint16"},
+        {65536, {0xCE, 0x00, 0x01, 0x00, 0x00}, "65536: uint32"},
+        {4294967295LL, {0xCE, 0xFF, 0xFF, 0xFF, 0xFF}, "2^32-1: largest uint32"},
+        {4294967296LL, {0xCF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00}, "2^32: uint64"},
+        {-1, {0xFF}, "-1: negative fixint"},
+        {-32, {0xE0}, "-32: smallest negative fixint"},
+        {-33, {0xD0, 0xDF}, "-33: int8"},
+        {-128, {0xD0, 0x80}, "-128: smallest int8"},
+        {-129, {0xD1, 0xFF, 0x7F}, "-129: int16"},
+        {-32768, {0xD1, 0x80, 0x00}, "-32768: smallest int16"},
+        {-32769, {0xD2, 0xFF, 0xFF, 0x7F, 0xFF}, "-32769: int32"},
+        {-2147483648LL, {0xD2, 0x80, 0x00, 0x00, 0x00}, "-2^31: smallest int32"},
+        {-2147483649LL, {0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF}, "-2^31-1: int64"},
+    };
+    for (const Case &c : cases) expectBytes(mpInt(c.v), c.want, c.what);
+}
+
+static void scalarCases() {
+    printf("MessagePack float32, bool, nil, str\n");
+    static const TelemetryField f[] = {
+        {"a", TELEMETRY_FIXED1}, {"b", TELEMETRY_FIXED2}, {"c", TELEMETRY_FIXED2},
+        {"d", TELEMETRY_FIXED1}, {"e", TELEMETRY_BOOL},   {"f", TELEMETRY_BOOL},
+        {"g", TELEMETRY_UINT},
+    };
+    TelemetryValue v[7];
+    telemetry_setNum(v[0], 215);    // 21.5   = 0x41AC0000
+    telemetry_setNum(v[1], -150);   // -1.5   = 0xBFC00000
+    telemetry_setNum(v[2], 0);      // 0.0    = 0x00000000
+    telemetry_setNum(v[3], 1);      // 0.1f   = 0x3DCCCCCD
+    telemetry_setNum(v[4], 1);
+    telemetry_setNum(v[5], 0);
+    telemetry_setNull(v[6]);
+    const TelemetryMask all = telemetry_fullMask(7);
+    Bytes got = encode([&](TelemetryWriter &w) { telemetry_encodeMsgpack(f, v, 7, all, w); });
+    expectBytes(got,
+                {0x87,
+                 0xA1, 'a', 0xCA, 0x41, 0xAC, 0x00, 0x00,
+                 0xA1, 'b', 0xCA, 0xBF, 0xC0, 0x00, 0x00,
+                 0xA1, 'c', 0xCA, 0x00, 0x00, 0x00, 0x00,
+                 0xA1, 'd', 0xCA, 0x3D, 0xCC, 0xCC, 0xCD,
+                 0xA1, 'e', 0xC3,
+                 0xA1, 'f', 0xC2,
+                 0xA1, 'g', 0xC0},
+                "fixed1/fixed2 as float32, true, false, nil");
+
+    std::string s31(31, 'x'), s32(32, 'x'), s255(255, 'y'), s256(256, 'z');
+    Bytes want = {0xBF};
+    want.insert(want.end(), s31.begin(), s31.end());
+    expectBytes(encode([&](TelemetryWriter &w) { telemetry_mpStr(w, s31.c_str()); }), want, "31 chars: fixstr");
+    want = {0xD9, 0x20};
+    want.insert(want.end(), s32.begin(), s32.end());
+    expectBytes(encode([&](TelemetryWriter &w) { telemetry_mpStr(w, s32.c_str()); }), want, "32 chars: str8");
+    want = {0xD9, 0xFF};
+    want.insert(want.end(), s255.begin(), s255.end());
+    expectBytes(encode([&](TelemetryWriter &w) { telemetry_mpStr(w, s255.c_str()); }), want, "255 chars: str8");
+    want = {0xDA, 0x01, 0x00};
+    want.insert(want.end(), s256.begin(), s256.end());
+    expectBytes(encode([&](TelemetryWriter &w) { telemetry_mpStr(w, s256.c_str()); }), want, "256 chars: str16");
+    expectBytes(encode([&](TelemetryWriter &w) { telemetry_mpStr(w, ""); }), {0xA0}, "empty string");
+
+    TelemetryValue sv;
+    std::string longValue(60, 'q');
+    telemetry_setStr(sv, longValue.c_str());
+    check(strlen(sv.str) == TELEMETRY_STR_MAX - 1, "string value cut to TELEMETRY_STR_MAX - 1");
+}
+
+// Table of n UINT fields k00..kNN with value i, all selected.
+static Bytes mapOf(size_t n) {
+    static char keys[TELEMETRY_MAX_FIELDS][4];
+    static TelemetryField f[TELEMETRY_MAX_FIELDS];
+    static TelemetryValue v[TELEMETRY_MAX_FIELDS];
+    for (size_t i = 0; i < n; i++) {
+        snprintf(keys[i], sizeof(keys[i]), "k%02u", (unsigned)i);
+        f[i] = {keys[i], TELEMETRY_UINT};
+        telemetry_setNum(v[i], (int64_t)i);
+    }
+    return encode([&](TelemetryWriter &w) { telemetry_encodeMsgpack(f, v, n, telemetry_fullMask(n), w); });
+}
+
+static Bytes mapBody(size_t n) {
+    Bytes b;
+    char key[4];
+    for (size_t i = 0; i < n; i++) {
+        snprintf(key, sizeof(key), "k%02u", (unsigned)i);
+        b.push_back(0xA3);
+        b.insert(b.end(), key, key + 3);
+        b.push_back((uint8_t)i);
+    }
+    return b;
+}
+
+static void mapCases() {
+    printf("MessagePack map headers\n");
+    struct Case {
+        size_t n;
+        Bytes head;
+        const char *what;
+    };
+    const Case cases[] = {
+        {0, {0x80}, "0 entries: fixmap"},
+        {15, {0x8F}, "15 entries: largest fixmap"},
+        {16, {0xDE, 0x00, 0x10}, "16 entries: map16"},
+        {17, {0xDE, 0x00, 0x11}, "17 entries: map16"},
+        {64, {0xDE, 0x00, 0x40}, "64 entries (TELEMETRY_MAX_FIELDS): map16"},
+    };
+    for (const Case &c : cases) {
+        Bytes want = c.head;
+        Bytes body = mapBody(c.n);
+        want.insert(want.end(), body.begin(), body.end());
+        expectBytes(mapOf(c.n), want, c.what);
+    }
+    check(telemetry_fullMask(0) == 0 && telemetry_fullMask(3) == 7 && telemetry_fullMask(64) == ~(TelemetryMask)0,
+          "telemetry_fullMask at 0, 3 and 64 fields");
+}
+
+// ---- JSON ----
+
+static Bytes json(const TelemetryField *f, const TelemetryValue *v, size_t n, TelemetryMask mask) {
+    return encode([&](TelemetryWriter &w) { telemetry_encodeJson(f, v, n, mask, w); });
+}
+
+static void jsonCases() {
+    printf("JSON\n");
+    static const TelemetryField f[] = {{"s", TELEMETRY_STR}};
+    TelemetryValue v[1];
+    telemetry_setStr(v[0], "a\"b\\c\n\r\t\x01\x1f/\xC3\xA9");
+    expectText(json(f, v, 1, 1), "{\"s\":\"a\\\"b\\\\c\\n\\r\\t\\u0001\\u001f/\xC3\xA9\"}",
+               "escapes quote, backslash, CR/LF/tab and control bytes");
+
+    static const TelemetryField q[] = {{"k\"ey", TELEMETRY_BOOL}};
+    telemetry_setNum(v[0], 1);
+    expectText(json(q, v, 1, 1), "{\"k\\\"ey\":true}", "keys are escaped too");
+
+    static const TelemetryField t[] = {
+        {"u", TELEMETRY_UINT},   {"i", TELEMETRY_INT},    {"f1", TELEMETRY_FIXED1}, {"f2", TELEMETRY_FIXED2},
+        {"f3", TELEMETRY_FIXED2}, {"f4", TELEMETRY_FIXED1}, {"b", TELEMETRY_BOOL},    {"n", TELEMETRY_INT},
+    };
+    TelemetryValue tv[8];
+    telemetry_setNum(tv[0], 4000000000LL);
+    telemetry_setNum(tv[1], -42);
+    telemetry_setNum(tv[2], -5);
+    telemetry_setNum(tv[3], 7);
+    telemetry_setNum(tv[4], -12345);
+    telemetry_setNum(tv[5], 250);
+    telemetry_setNum(tv[6], 0);
+    telemetry_setNull(tv[7]);
+    expectText(json(t, tv, 8, telemetry_fullMask(8)),
+               "{\"u\":4000000000,\"i\":-42,\"f1\":-0.5,\"f2\":0.07,\"f3\":-123.45,\"f4\":25.0,\"b\":false,\"n\":null}",
+               "uint, int, fixed-point text, bool, null");
+    expectText(json(t, tv, 8, 0), "{}", "empty mask: empty object");
+    check(telemetry_fixed(21.46f, 10) == 215 && telemetry_fixed(-0.125f, 100) == -13 &&
+              telemetry_fixed(0.004f, 100) == 0,
+          "telemetry_fixed rounds half away from zero");
+
+    uint8_t small[8];
+    TelemetryWriter w = {small, sizeof(small), 0};
+    size_t len = telemetry_encodeJson(t, tv, 8, telemetry_fullMask(8), w);
+    TelemetryWriter probe = {nullptr, 0, 0};
+    telemetry_encodeJson(t, tv, 8, telemetry_fullMask(8), probe);
+    check(!w.ok() && len == json(t, tv, 8, telemetry_fullMask(8)).size() && probe.len == len,
+          "overflow detected; cap 0 measures the full length");
+}
+
+// ---- Delta vs. full ----
+
+static void deltaCases() {
+    printf("delta and full snapshots\n");
+    static const TelemetryField f[] = {
+        {"uptime_s", TELEMETRY_UINT}, {"rssi", TELEMETRY_INT},  {"streaming", TELEMETRY_BOOL},
+        {"temp_c", TELEMETRY_FIXED1}, {"ssid", TELEMETRY_STR},  {"gain", TELEMETRY_FIXED2},
+    };
+    const size_t n = 6;
+    TelemetryValue prev[n], cur[n];
+    telemetry_setNum(prev[0], 100);
+    telemetry_setNum(prev[1], -60);
+    telemetry_setNum(prev[2], 1);
+    telemetry_setNum(prev[3], 412);
+    telemetry_setStr(prev[4], "birds");
+    telemetry_setNum(prev[5], 150);
+    memcpy(cur, prev, sizeof(cur));
+    check(telemetry_diff(prev, cur, n) == 0, "no change: empty delta");
+
+    telemetry_setNum(cur[0], 160);
+    telemetry_setStr(cur[4], "birds-5g");
+    const TelemetryMask delta = telemetry_diff(prev, cur, n);
+    check(delta == ((1u << 0) | (1u << 4)), "diff marks exactly uptime_s and ssid");
+    expectText(json(f, cur, n, delta), "{\"uptime_s\":160,\"ssid\":\"birds-5g\"}", "JSON delta: changed fields only");
+    expectBytes(encode([&](TelemetryWriter &w) { telemetry_encodeMsgpack(f, cur, n, delta, w); }),
+                {0x82,
+                 0xA8, 'u', 'p', 't', 'i', 'm', 'e', '_', 's', 0xCC, 0xA0,
+                 0xA4, 's', 's', 'i', 'd', 0xA8, 'b', 'i', 'r', 'd', 's', '-', '5', 'g'},
+                "MessagePack delta: changed fields only");
+
+    telemetry_setNull(cur[1]);
+    check(telemetry_diff(prev, cur, n) == (delta | (1u << 1)), "value -> null counts as a change");
+    telemetry_setNum(cur[1], -60);
+
+    expectText(json(f, cur, n, telemetry_fullMask(n)),
+               "{\"uptime_s\":160,\"rssi\":-60,\"streaming\":true,\"temp_c\":41.2,\"ssid\":\"birds-5g\",\"gain\":1.50}",
+               "JSON full snapshot: all fields in table order");
+    Bytes full = encode([&](TelemetryWriter &w) { telemetry_encodeMsgpack(f, cur, n, telemetry_fullMask(n), w); });
+    check(!full.empty() && full[0] == 0x86, "MessagePack full snapshot: fixmap of 6");
+
+    // Field 40 alone: mask bits above 31 must work on a 32-bit target too.
+    TelemetryField wide[41];
+    TelemetryValue wv[41];
+    static char keys[41][4];
+    for (int i = 0; i < 41; i++) {
+        snprintf(keys[i], sizeof(keys[i]), "w%02d", i);
+        wide[i] = {keys[i], TELEMETRY_UINT};
+        telemetry_setNum(wv[i], 1);
+    }
+    TelemetryValue wprev[41];
+    memcpy(wprev, wv, sizeof(wprev));
+    telemetry_setNum(wv[40], 2);
+    TelemetryMask m = telemetry_diff(wprev, wv, 41);
+    check(m == ((TelemetryMask)1 << 40), "diff of field 40 sets bit 40 only");
+    expectText(json(wide, wv, 41, m), "{\"w40\":2}", "delta of field 40");
+}
+
+int main() {
+    intCases();
+    scalarCases();
+    mapCases();
+    jsonCases();
+    deltaCases();
+    printf("%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -2,30 +2,57 @@
 set -euo pipefail
 
 ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
-HTML_FILE="${ROOT_DIR}/webui/index.html"
+WEBUI_DIR="${ROOT_DIR}/webui"
+HTML_FILE="${WEBUI_DIR}/index.html"
+JS_FILE="${WEBUI_DIR}/app.js"
+CSS_FILE="${WEBUI_DIR}/app.css"
 OUT_FILE="${ROOT_DIR}/WebUI_gz.h"
 
-if [[ ! -f "${HTML_FILE}" ]]; then
-  echo "Missing HTML source: ${HTML_FILE}" >&2
-  exit 1
-fi
+for f in "${HTML_FILE}" "${JS_FILE}" "${CSS_FILE}"; do
+  if [[ ! -f "${f}" ]]; then
+    echo "Missing Web UI source: ${f}" >&2
+    exit 1
+  fi
+done
 
-TMP_GZ="$(mktemp)"
-trap 'rm -f "${TMP_GZ}"' EXIT
+TMP_DIR="$(mktemp -d)"
+trap 'rm -rf "${TMP_DIR}"' EXIT
 
-gzip -n -9 -c "${HTML_FILE}" > "${TMP_GZ}"
-GZ_LEN="$(wc -c < "${TMP_GZ}")"
+# Short content hash (first 16 hex chars of SHA-256) used for ETags and asset URLs.
+content_hash() {
+  sha256sum "$1" | cut -c1-16
+}
+
+JS_HASH="$(content_hash "${JS_FILE}")"
+CSS_HASH="$(content_hash "${CSS_FILE}")"
+
+# index.html references the assets by hash, so any JS/CSS change also changes the page hash.
+sed -e "s/__WEBUI_APP_JS_HASH__/${JS_HASH}/g" \
+    -e "s/__WEBUI_APP_CSS_HASH__/${CSS_HASH}/g" \
+    "${HTML_FILE}" > "${TMP_DIR}/index.html"
+INDEX_HASH="$(content_hash "${TMP_DIR}/index.html")"
+
+emit_asset() {
+  local name="$1" src="$2" hash="$3" gz="${TMP_DIR}/$1.gz"
+  gzip -n -9 -c "${src}" > "${gz}"
+  echo
+  echo "static const uint8_t WEBUI_${name}_GZ[] PROGMEM = {"
+  xxd -i < "${gz}"
+  echo "};"
+  echo
+  echo "static const size_t WEBUI_${name}_GZ_LEN = $(wc -c < "${gz}");"
+  echo "static const char WEBUI_${name}_HASH[] = \"${hash}\";"
+}
 
 {
   echo "#pragma once"
   echo "#include <Arduino.h>"
   echo "#include <pgmspace.h>"
   echo
-  echo "static const uint8_t WEBUI_INDEX_GZ[] PROGMEM = {"
-  xxd -i "${TMP_GZ}" | sed '1d' | head -n -2
-  echo "};"
-  echo
-  echo "static const size_t WEBUI_INDEX_GZ_LEN = ${GZ_LEN};"
+  echo "// Generated by tools/gen_webui_gzip_header.sh from webui/ - do not edit."
+  emit_asset INDEX "${TMP_DIR}/index.html" "${INDEX_HASH}"
+  emit_asset APP_JS "${JS_FILE}" "${JS_HASH}"
+  emit_asset APP_CSS "${CSS_FILE}" "${CSS_HASH}"
 } > "${OUT_FILE}"
 
-echo "Generated ${OUT_FILE} (${GZ_LEN} bytes gzipped)"
+echo "Generated ${OUT_FILE} (index ${INDEX_HASH}, app.js ${JS_HASH}, app.css ${CSS_HASH})"
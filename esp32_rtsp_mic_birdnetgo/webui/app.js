@@ -0,0 +1 @@
+const T={en:{title:'ESP32 RTSP Mic for BirdNET-Go',status:'Status',ip:'IP Address',wifi_rssi:'WiFi RSSI',wifi_tx:'WiFi TX Power',heap:'Free Heap (min)',uptime:'Uptime',rtsp_server:'RTSP Server',client:'Client',streaming:'Streaming',pkt_rate:'Packet Rate',last_connect:'Last RTSP Connect',last_play:'Last Stream Start',time:'Time & Network',time_sync:'Sync Status',time_sync_en:'Time Sync',last_sync:'Last Sync',local_time:'Device Local Time',utc_time:'UTC Time',time_unavailable:'Unavailable (unsynced)',offset:'Time Offset',mdns:'mDNS',stream_ip:'RTSP (IP)',stream_mdns:'RTSP (mDNS)',sync_now:'Sync Time Now',net_reset:'Reset Wi-Fi',net_reset_confirm:'Reset Wi-Fi credentials and reboot? You will need to reconfigure via the setup AP.',wifi_reconnect:'Reconnect Wi-Fi',download_logs:'Download Logs',download_logs_persist:'Download Flash Log',rtsp_label:'RTSP',or:'or',theme:'Theme',theme_auto:'Auto',theme_light:'Light',theme_dark:'Dark',yes:'YES',no:'NO',audio:'Audio',rate:'Sample Rate',gain:'Gain',buf:'Buffer Size',latency:'Latency',profile:'Profile',perf:'Reliability',auto:'Auto Recovery',wifi:'WiFi',wifi_tx2:'TX Power (dBm)',thermal:'Thermal',logs:'Logs',bsrvon:'Server ON',bsrvoff:'Server OFF',breset:'Reset I2S',breboot:'Reboot',bdefaults:'Defaults',restarting:'Restarting device...',resetting:'Restoring defaults and rebooting...',advanced_settings:'Advanced Settings',shift:'I2S Shift',thr:'Restart Threshold',chk:'Check Interval',thr_mode:'Threshold Mode',sched:'Scheduled Reset',hours:'Reset After',frag:'Fragmentation Alert',heap_health:'Heap Health',task_cpu:'CPU / Tasks',task_na:'N/A (FreeRTOS run-time stats not enabled in this build)',nvs:'Settings Flash',nvs_pending:'save pending',wd:'Stream Watchdog',wd_ok:'OK',wd_stall:'STALL',wd_degraded:'DEGRADED',frag_alert:'ALERT',cpu:'CPU Frequency',pwr:'Power Profile',set:'Set',profile_ultra:'Ultra-Low Latency (Higher CPU, may have dropouts)',profile_balanced:'Balanced (Moderate CPU, good stability)',profile_stable:'Stable Streaming (Lower CPU, excellent stability)',profile_high:'High Stability (Lowest CPU, max stability)',adv_buf512:'If stream drops, try Buffer 512 or higher.',adv_buf1024:'For unstable Wi-Fi, Buffer 1024 is usually best.',adv_gain:'High Gain can clip. Lower Gain or increase I2S Shift.',help_rate:'Higher sample rate gives more detail but uses more bandwidth.',help_gain:'Amplifies audio after I2S shift; too high will clip.',help_buf:'More samples per packet means more stability and higher latency.',help_auto:'Stream watchdog: on a stall or a packet rate below the threshold it escalates every few seconds (reset DSP, restart I2S, reconnect Wi-Fi). OFF only logs.',help_tx:'Wi-Fi TX power; lowering can reduce RF noise.',help_shift:'Digital right shift before gain scaling.',help_thr:'Minimum packet rate before auto-recovery triggers.',help_chk:'How often the long-term packet rate statistics are updated. Stalls are detected within seconds regardless.',help_sched:'Periodic device restart for long-term stability.',help_hours:'Interval between scheduled restarts.',help_frag:'Logs a warning when the share of free heap not usable as one block reaches this value (0 = off). Compare with the value shown after boot.',help_cpu:'Lower MHz runs cooler but can increase latency.',help_pwr:'Performance: fixed clock, Wi-Fi power save off. Balanced: clock scales between 80 MHz and CPU Frequency with the load. Saver: balanced plus Wi-Fi modem sleep and light sleep when no stream runs; expect more latency jitter. The power figure is an estimate for comparing profiles.',help_offset:'Manual timezone/clock correction in hours. Negative = west (UTC-), positive = east (UTC+).',help_time_sync:'If internet time is unavailable, disable Time Sync to avoid repeated NTP retries.',therm_protect:'Overheat Protection',therm_limit:'Shutdown Limit',therm_status:'Status',therm_now:'Current Temp',therm_max:'Peak Temp',therm_cpu:'CPU Clock',therm_power:'CPU Load / Power',therm_power_fmt:'%LOAD%% (avg %AVG%%, peak %PEAK%%) · ~%MA% mA est.',therm_last:'Last Shutdown',therm_status_ready:'Protection ready',therm_status_disabled:'Protection disabled',therm_status_latched:'Cooling required - restart manually',therm_status_sensor_fault:'Sensor unavailable - protection paused',therm_status_latched_persist:'Protection latched - acknowledge to re-enable',therm_last_none:'No shutdown recorded yet.',therm_last_fmt:'Stopped at %TEMP% C (limit %LIMIT% C) after %TIME% uptime (%AGO%).',therm_last_sensor_fault:'Thermal protection disabled: temperature sensor unavailable.',therm_latch_notice:'Thermal shutdown latched the RTSP server. Confirm only after hardware cools down.',therm_clear_btn:'Acknowledge and re-enable RTSP',therm_time_unknown:'unknown time',therm_time_ago_unknown:'just now',help_therm_protect:'Stops streaming when ESP32 exceeds the limit to protect board and mic preamp.',help_therm_limit:'Temperature threshold for shutdown. 80 C is a safe default.'}};const HELP_EXT_EN={hpf:'High-pass',hpf_cut:'HPF Cutoff',help_hpf:'Cuts low-frequency rumble.',help_hpf_cut:'High-pass cutoff in Hz.',help_thr_mode:'Auto = computed threshold; Manual = your value.',level:'Signal Level',help_level:'Keep peaks below clipping.',clip_ok:'OK',clip_warn:'High level - close to clipping.',clip_bad:'CLIPPING! Reduce Gain or raise I2S Shift.'};Object.assign(T.en, HELP_EXT_EN);let lang='en'; let theme=localStorage.getItem('theme')||'auto'; const $=id=>document.getElementById(id);function applyTheme(){ const root=document.documentElement; if(theme==='light'||theme==='dark'){ root.setAttribute('data-theme', theme); } else { root.removeAttribute('data-theme'); theme='auto'; } const ts=$('themeSel'); if(ts) ts.value=theme; }const SCHED_TXT={en:{stream_sched_en:'Stream Schedule',stream_start:'Stream Start',stream_stop:'Stream Stop',stream_sched_state:'Schedule Status',help_stream_sched_en:'Automatically turns RTSP server ON/OFF by local device time. If time is unavailable, fail-open keeps stream allowed.',help_stream_start:'Start of the allowed streaming window in local device time. Start and stop must differ.',help_stream_stop:'End of the allowed streaming window in local device time. Cross-midnight windows are supported (for example 22:00-06:00). If start equals stop, the window is empty and stream is blocked.',state_off:'Schedule disabled',state_wait:'Time unavailable - fail-open (stream allowed)',state_allow:'Inside allowed window',state_block:'Outside allowed window',state_invalid:'Invalid window (start = stop) - stream blocked',deep_sleep_sched:'Deep Sleep (Outside Window)',deep_sleep_state:'Deep Sleep Status',help_deep_sleep_sched:'Uses deep sleep only outside the stream window. Requires valid synchronized time and no active client/stream. While sleeping, RTSP, Web UI, API, and OTA are unavailable.',ds_confirm_table:'Deep Sleep confirmation:\n\nPower-saving mode outside the allowed stream window.\n\nImportant behavior:\n- RTSP, Web UI, API, and OTA are unreachable while sleeping\n- Any active stream/client is stopped before entering sleep\n- Sleep is allowed only with valid synchronized time\n- If time is unsynced, deep sleep is blocked and device stays awake\n- Timer wake only; one cycle is capped to 8 hours\n- Device wakes about 5 minutes before next stream window\n\nEnable only if temporary offline periods are acceptable.',ds_confirm_1:'Enable Deep Sleep (Outside Window) now?',ds_confirm_2:'Second confirmation: enable deep sleep and allow temporary offline periods?',ds_disabled:'Deep sleep disabled',ds_need_sched:'Enable Stream Schedule first',ds_invalid:'Invalid schedule window (start = stop) - deep sleep blocked',ds_need_time:'Time not synchronized - deep sleep blocked',ds_inside:'Inside stream window - device stays awake',ds_grace:'Startup grace period - waiting',ds_wait:'Outside window detected - waiting for stability',ds_client:'Client connected - sleep postponed',ds_streaming:'Streaming active - sleep postponed',ds_reboot:'Reboot pending - sleep postponed',ds_soon:'Next stream window is soon - no sleep',ds_ready:'Outside window - deep sleep armed'}};function minsToHHMM(mins){ mins=parseInt(mins,10); if(isNaN(mins)) mins=0; mins=((mins%1440)+1440)%1440; const h=Math.floor(mins/60), m=mins%60; return String(h).padStart(2,'0')+':'+String(m).padStart(2,'0'); }function hhmmToMins(v){ if(!v || v.indexOf(':')<0) return null; const p=v.split(':'); if(p.length!==2) return null; const h=parseInt(p[0],10), m=parseInt(p[1],10); if(isNaN(h)||isNaN(m)||h<0||h>23||m<0||m>59) return null; return h*60+m; }function fmtSecondsBrief(sec){ sec=parseInt(sec,10); if(!isFinite(sec)||sec<0) sec=0; const h=Math.floor(sec/3600), m=Math.floor((sec%3600)/60), s=sec%60; if(h>0) return h+'h '+m+'m'; if(m>0) return m+'m '+s+'s'; return s+'s'; }function setStreamScheduleTime(kind){ const id=(kind==='start')?'in_stream_start':'in_stream_stop'; const key=(kind==='start')?'stream_start_min':'stream_stop_min'; const el=$(id); if(!el) return; const mins=hhmmToMins(el.value); if(mins===null) return; setv(key,String(mins)); }function setDeepSleepSched(){ const el=$('sel_deep_sleep_sched'); if(!el) return; const v=(el.value==='on')?'on':'off'; const L=(SCHED_TXT[lang]||SCHED_TXT.en); if(v==='on'){ const table=L.ds_confirm_table||L.ds_confirm_1||''; if(!confirm(table)) return; if(!confirm(L.ds_confirm_2)) return; } setv('deep_sleep_sched',v); }function deepSleepStatusHTML(code,nextSec,L){ let cls='muted', txt=L.ds_disabled||'Deep sleep disabled'; if(code==='schedule_disabled'){ cls='bad'; txt=L.ds_need_sched; } else if(code==='schedule_invalid'){ cls='bad'; txt=L.ds_invalid; } else if(code==='time_invalid'){ cls='warn'; txt=L.ds_need_time; } else if(code==='inside_window'){ cls='ok'; txt=L.ds_inside; } else if(code==='grace_boot'){ cls='muted'; txt=L.ds_grace; } else if(code==='outside_stabilizing'){ cls='muted'; txt=L.ds_wait; } else if(code==='client_connected'){ cls='warn'; txt=L.ds_client; } else if(code==='streaming_active'){ cls='warn'; txt=L.ds_streaming; } else if(code==='reboot_pending'){ cls='warn'; txt=L.ds_reboot; } else if(code==='next_window_soon'){ cls='muted'; txt=L.ds_soon; } else if(code==='ready'){ cls='warn'; txt=L.ds_ready; } if(nextSec>0){ txt += ' ('+fmtSecondsBrief(nextSec)+')'; } return '<span class='+cls+'>'+txt+'</span>'; }function applyScheduleLang(){ const L=(SCHED_TXT[lang]||SCHED_TXT.en); const st=(id,t)=>{const e=$(id); if(e) e.textContent=t}; const tt=(id,t)=>{const e=$(id); if(e) e.setAttribute('title',t)}; st('t_stream_sched_en',L.stream_sched_en); st('t_stream_start',L.stream_start); st('t_stream_stop',L.stream_stop); st('t_stream_sched_state',L.stream_sched_state); st('txt_stream_sched_en_hint',L.help_stream_sched_en); st('txt_stream_start_hint',L.help_stream_start); st('txt_stream_stop_hint',L.help_stream_stop); st('t_deep_sleep_sched',L.deep_sleep_sched); st('t_deep_sleep_state',L.deep_sleep_state); st('txt_deep_sleep_sched_hint',L.help_deep_sleep_sched); tt('h_stream_sched_en',L.help_stream_sched_en); tt('h_stream_start',L.help_stream_start); tt('h_stream_stop',L.help_stream_stop); tt('h_deep_sleep_sched',L.help_deep_sleep_sched); const setTxt=(T[lang]&&T[lang].set)?T[lang].set:'Set'; st('btn_stream_sched_en_set',setTxt); st('btn_stream_start_set',setTxt); st('btn_stream_stop_set',setTxt); st('btn_deep_sleep_sched_set',setTxt); }function applyLang(){const L=T[lang]; const st=(id,t)=>{const e=$(id); if(e) e.textContent=t}; const help=(k)=>{const b=L[k]||''; return b}; st('t_title',L.title); st('t_status',L.status); st('t_ip',L.ip); st('t_wifi_rssi',L.wifi_rssi); st('t_wifi_tx',L.wifi_tx); st('t_heap',L.heap); st('t_uptime',L.uptime); st('t_rtsp_label',L.rtsp_label); st('t_or',L.or); st('t_theme',L.theme); st('opt_theme_auto',L.theme_auto); st('opt_theme_light',L.theme_light); st('opt_theme_dark',L.theme_dark); st('t_rtsp_server',L.rtsp_server); st('t_client',L.client); st('t_streaming',L.streaming); st('t_pkt_rate',L.pkt_rate); st('t_last_connect',L.last_connect); st('t_last_play',L.last_play); st('t_time',L.time); st('t_time_sync',L.time_sync); st('t_time_sync_en',L.time_sync_en); st('t_last_sync',L.last_sync); st('t_local_time',L.local_time); st('t_utc_time',L.utc_time); st('t_offset',L.offset); st('t_mdns',L.mdns); st('t_stream_ip',L.stream_ip); st('t_stream_mdns',L.stream_mdns); st('t_audio',L.audio); st('t_rate',L.rate); st('t_gain',L.gain); st('t_buf',L.buf); st('t_latency',L.latency); st('t_level',L.level); st('t_profile',L.profile); st('t_perf',L.perf); st('t_auto',L.auto); st('t_wifi',L.wifi); st('t_wifi_tx2',L.wifi_tx2); st('t_thermal',L.thermal); st('t_therm_protect',L.therm_protect); st('t_therm_limit',L.therm_limit); st('t_therm_status',L.therm_status); st('t_therm_now',L.therm_now); st('t_therm_max',L.therm_max); st('t_therm_cpu',L.therm_cpu); st('t_therm_last',L.therm_last); st('t_logs',L.logs); st('b_srv_on',L.bsrvon); st('b_srv_off',L.bsrvoff); st('b_reset',L.breset); st('b_reboot',L.breboot); st('b_defaults',L.bdefaults); st('b_sync_now',L.sync_now); st('b_wifi_reconnect',L.wifi_reconnect); st('b_net_reset',L.net_reset); st('b_log_dl',L.download_logs); st('b_log_dl_p',L.download_logs_persist); st('t_advanced_settings',L.advanced_settings); st('t_shift',L.shift); st('t_thr',L.thr); st('t_chk',L.chk); st('t_thr_mode',L.thr_mode); st('t_sched',L.sched); st('t_hours',L.hours); st('t_frag',L.frag); st('t_heap_health',L.heap_health); st('t_task_cpu',L.task_cpu); st('t_nvs',L.nvs); st('t_wd',L.wd); st('t_cpu',L.cpu); st('t_pwr',L.pwr); st('t_therm_power',L.therm_power); const hm=(id,k)=>{const e=$(id); if(e) e.setAttribute('title',help(k))}; hm('h_rate','help_rate'); hm('h_gain','help_gain'); hm('h_hpf','help_hpf'); hm('h_hpf_cut','help_hpf_cut'); hm('h_buf','help_buf'); hm('h_auto','help_auto'); hm('h_tx','help_tx'); hm('h_thr','help_thr'); hm('h_chk','help_chk'); hm('h_shift','help_shift'); hm('h_sched','help_sched'); hm('h_hours','help_hours'); hm('h_frag','help_frag'); hm('h_cpu','help_cpu'); hm('h_pwr','help_pwr'); hm('h_thr_mode','help_thr_mode'); hm('h_level','help_level'); hm('h_therm_protect','help_therm_protect'); hm('h_therm_limit','help_therm_limit'); hm('h_offset','help_offset'); hm('h_time_sync','help_time_sync'); st('btn_rate_set',L.set); st('btn_gain_set',L.set); st('btn_buf_set',L.set); st('btn_auto_set',L.set); st('btn_thrmode_set',L.set); st('btn_thr_set',L.set); st('btn_sched_set',L.set); st('btn_hours_set',L.set); st('btn_shift_set',L.set); st('btn_chk_set',L.set); st('btn_tx_set',L.set); st('btn_cpu_set',L.set); st('btn_oh_enable',L.set); st('btn_oh_limit',L.set); st('btn_offset_set',L.set); st('btn_time_sync_set',L.set); st('btn_mdns_set',L.set); st('btn_hp_set',L.set); st('btn_hpf_cut_set',L.set); const sht=(id,k)=>{const e=$(id); if(e) e.textContent=help(k)}; sht('txt_rate_hint','help_rate'); sht('txt_gain_hint','help_gain'); sht('txt_hpf_hint','help_hpf'); sht('txt_hpf_cut_hint','help_hpf_cut'); sht('txt_buf_hint','help_buf'); sht('txt_auto_hint','help_auto'); sht('txt_thr_hint','help_thr'); sht('txt_thr_mode_hint','help_thr_mode'); sht('txt_sched_hint','help_sched'); sht('txt_hours_hint','help_hours'); sht('txt_frag_hint','help_frag'); sht('txt_shift_hint','help_shift'); sht('txt_chk_hint','help_chk'); sht('txt_tx_hint','help_tx'); sht('txt_cpu_hint','help_cpu'); sht('txt_pwr_hint','help_pwr'); sht('txt_level_hint','help_level'); sht('txt_therm_hint_protect','help_therm_protect'); sht('txt_therm_hint_limit','help_therm_limit'); sht('txt_offset_hint','help_offset'); sht('txt_time_sync_hint','help_time_sync'); st('t_hpf',L.hpf); st('t_hpf_cut',L.hpf_cut); document.title=L.title;}function profileText(buf){const L=T[lang]; buf=parseInt(buf,10)||0; if(buf<=256) return L.profile_ultra; if(buf<=512) return L.profile_balanced; if(buf<=1024) return L.profile_stable; return L.profile_high;}function fmtBool(b){const L=T[lang]; return b?`<span class=ok>${L.yes||'YES'}</span>`:`<span class=bad>${L.no||'NO'}</span>`}function fmtSrv(b){return b?'<span class=ok>ENABLED</span>':'<span class=bad>DISABLED</span>'}function showOverlay(msg){ $('ovr_msg').textContent=msg; $('ovr').style.display='flex'; }function rebootSequence(kind){ const L=T[lang]; const msg=(kind==='factory_reset')?L.resetting:L.restarting; showOverlay(msg); function tick(){ fetch('/api/status',{cache:'no-store'}).then(r=>{ if(r.ok){ location.reload(); } else { setTimeout(tick,2000); } }).catch(()=>setTimeout(tick,2000)); } setTimeout(tick,4000); }function mutationFetch(url,body){return fetch(url,{method:'POST',cache:'no-store',headers:{'Content-Type':'application/x-www-form-urlencoded;charset=UTF-8','X-ESP32MIC-CSRF':'1'},body:body||''})}function act(a){mutationFetch('/api/action/'+a,'').then(r=>r.json()).then(loadAll)}function rebootNow(){ rebootSequence('reboot'); act('reboot'); }function defaultsNow(){ rebootSequence('factory_reset'); act('factory_reset'); }const locks={}; const edits={};const LOG_STICKY_PX=24; let logAutoScroll=true; let logCursor=0; const LOG_VIEW_MAX=65536;function isLogNearBottom(el){ return (el.scrollHeight - el.scrollTop - el.clientHeight) <= LOG_STICKY_PX; }function bindLogScroll(){ const lg=$('logs'); if(!lg || lg.dataset.bound==='1') return; lg.dataset.bound='1'; lg.addEventListener('scroll',()=>{ logAutoScroll=isLogNearBottom(lg); }); }function setv(k,v){v=String(v??'').trim().replace(',', '.'); if(v==='')return; locks[k]=Date.now()+5000; delete edits[k]; const body='key='+encodeURIComponent(k)+'&value='+encodeURIComponent(v); mutationFetch('/api/set',body).then(r=>r.json()).then(loadAll)}function setvRaw(k,v){v=String(v??'').trim(); locks[k]=Date.now()+5000; delete edits[k]; const body='key='+encodeURIComponent(k)+'&value='+encodeURIComponent(v); mutationFetch('/api/set',body).then(r=>r.json()).then(loadAll)}function bindSaver(el,key){if(!el)return; el.addEventListener('keydown',e=>{if(e.key==='Enter'){setv(key,el.value)}})}function bindEnter(el,fn){if(!el)return; el.addEventListener('keydown',e=>{if(e.key==='Enter'){fn()}})}function trackEdit(el,key){if(!el)return; const bump=()=>{edits[key]=Date.now()+10000; toggleDirty(el,key)}; el.addEventListener('input',bump); el.addEventListener('change',bump)}function toggleDirty(el,key){ if(!el)return; const now=Date.now(); const d=(edits[key]&&now<edits[key]); el.classList.toggle('dirty', !!d); if(!d){ delete edits[key]; } }function setToggleState(on){const onb=$('b_srv_on'), offb=$('b_srv_off'); if(onb&&offb){onb.classList.toggle('active',on); offb.classList.toggle('active',!on); onb.disabled=on; offb.disabled=!on;}}function renderTimeRows(j){ const L=T[lang]||T.en; const lm=$('local_time'), um=$('utc_time'); const m=parseInt(j.time_offset_min||0,10)||0; const s=(m>=0)?'+':'-'; const a=Math.abs(m); const oh=String(Math.floor(a/60)).padStart(2,'0'); const om=String(a%60).padStart(2,'0'); const off='UTC'+s+oh+':'+om; const synced=!!j.time_synced; if(lm){ if(synced && j.local_time && j.local_time!=='unavailable'){ lm.innerHTML='<span class=ok>'+j.local_time+' ('+off+')</span>'; } else { lm.innerHTML='<span class=warn>'+(L.time_unavailable||'Unavailable (unsynced)')+'</span>'; } } if(um){ if(synced && j.utc_time && j.utc_time!=='unavailable'){ um.innerHTML='<span class=ok>'+j.utc_time+'</span>'; } else { um.innerHTML='<span class=warn>'+(L.time_unavailable||'Unavailable (unsynced)')+'</span>'; } } }function loadStreamSchedule(j){ const now=Date.now(); const L=(SCHED_TXT[lang]||SCHED_TXT.en); const en=$('sel_stream_sched_en'); if(en){ const editing=(edits['stream_sched']&&now<edits['stream_sched']); if(!(locks['stream_sched']&&now<locks['stream_sched']) && !editing) en.value=j.stream_schedule_enabled?'on':'off'; toggleDirty(en,'stream_sched'); } const st=$('in_stream_start'); if(st){ const editing=(edits['stream_start_min']&&now<edits['stream_start_min']); if(!(locks['stream_start_min']&&now<locks['stream_start_min']) && !editing) st.value=minsToHHMM(j.stream_schedule_start_min||0); toggleDirty(st,'stream_start_min'); } const sp=$('in_stream_stop'); if(sp){ const editing=(edits['stream_stop_min']&&now<edits['stream_stop_min']); if(!(locks['stream_stop_min']&&now<locks['stream_stop_min']) && !editing) sp.value=minsToHHMM(j.stream_schedule_stop_min||0); toggleDirty(sp,'stream_stop_min'); } const ds=$('sel_deep_sleep_sched'); if(ds){ const editing=(edits['deep_sleep_sched']&&now<edits['deep_sleep_sched']); if(!(locks['deep_sleep_sched']&&now<locks['deep_sleep_sched']) && !editing) ds.value=j.deep_sleep_sched_enabled?'on':'off'; toggleDirty(ds,'deep_sleep_sched'); } const state=$('stream_sched_state'); if(state){ const start=(j.stream_schedule_start_min||0), stop=(j.stream_schedule_stop_min||0); const win=' ('+minsToHHMM(start)+'-'+minsToHHMM(stop)+')'; if(!j.stream_schedule_enabled){ state.innerHTML='<span class=muted>'+L.state_off+'</span>'; } else if(start===stop){ state.innerHTML='<span class=bad>'+L.state_invalid+win+'</span>'; } else if(!j.stream_schedule_time_valid){ state.innerHTML='<span class=warn>'+L.state_wait+win+'</span>'; } else if(j.stream_schedule_allow_now){ state.innerHTML='<span class=ok>'+L.state_allow+win+'</span>'; } else { state.innerHTML='<span class=bad>'+L.state_block+win+'</span>'; } } const dsState=$('deep_sleep_state'); if(dsState){ const code=String(j.deep_sleep_status_code||'disabled'); const next=parseInt(j.deep_sleep_next_sec||0,10)||0; dsState.innerHTML=deepSleepStatusHTML(code,next,L); } }function setMqttHost(){ const el=$('in_mqtt_host'); if(!el) return; setvRaw('mqtt_host',el.value); }function setMqttPort(){ const el=$('in_mqtt_port'); if(!el) return; setv('mqtt_port',el.value); }function setMqttUser(){ const el=$('in_mqtt_user'); if(!el) return; setvRaw('mqtt_user',el.value); }function setMqttPass(){ const el=$('in_mqtt_pass'); if(!el) return; setvRaw('mqtt_pass',el.value); el.value=''; }function setMqttTopic(){ const el=$('in_mqtt_topic'); if(!el) return; setvRaw('mqtt_topic',el.value); }function setMqttDiscovery(){ const el=$('in_mqtt_discovery'); if(!el) return; setvRaw('mqtt_discovery',el.value); }function setMqttClientId(){ const el=$('in_mqtt_client_id'); if(!el) return; setvRaw('mqtt_client_id',el.value); }function setMqttInterval(){ const el=$('in_mqtt_interval'); if(!el) return; setv('mqtt_interval',el.value); }function setMqttFullEvery(){ const el=$('in_mqtt_full_every'); if(!el) return; setv('mqtt_full_every',el.value); }function loadMqtt(j){ const now=Date.now(); const en=$('sel_mqtt_en'); if(en){ const editing=(edits['mqtt_enable']&&now<edits['mqtt_enable']); if(!(locks['mqtt_enable']&&now<locks['mqtt_enable']) && !editing) en.value=j.mqtt_enabled?'on':'off'; toggleDirty(en,'mqtt_enable'); } const host=$('in_mqtt_host'); if(host){ const editing=(edits['mqtt_host']&&now<edits['mqtt_host']); if(!(locks['mqtt_host']&&now<locks['mqtt_host']) && !editing) host.value=j.mqtt_host||''; toggleDirty(host,'mqtt_host'); } const port=$('in_mqtt_port'); if(port){ const editing=(edits['mqtt_port']&&now<edits['mqtt_port']); if(!(locks['mqtt_port']&&now<locks['mqtt_port']) && !editing) port.value=j.mqtt_port||1883; toggleDirty(port,'mqtt_port'); } const user=$('in_mqtt_user'); if(user){ const editing=(edits['mqtt_user']&&now<edits['mqtt_user']); if(!(locks['mqtt_user']&&now<locks['mqtt_user']) && !editing) user.value=j.mqtt_user||''; toggleDirty(user,'mqtt_user'); } const topic=$('in_mqtt_topic'); if(topic){ const editing=(edits['mqtt_topic']&&now<edits['mqtt_topic']); if(!(locks['mqtt_topic']&&now<locks['mqtt_topic']) && !editing) topic.value=j.mqtt_topic||''; toggleDirty(topic,'mqtt_topic'); } const disc=$('in_mqtt_discovery'); if(disc){ const editing=(edits['mqtt_discovery']&&now<edits['mqtt_discovery']); if(!(locks['mqtt_discovery']&&now<locks['mqtt_discovery']) && !editing) disc.value=j.mqtt_discovery||''; toggleDirty(disc,'mqtt_discovery'); } const cid=$('in_mqtt_client_id'); if(cid){ const editing=(edits['mqtt_client_id']&&now<edits['mqtt_client_id']); if(!(locks['mqtt_client_id']&&now<locks['mqtt_client_id']) && !editing) cid.value=j.mqtt_client_id||''; toggleDirty(cid,'mqtt_client_id'); } const iv=$('in_mqtt_interval'); if(iv){ const editing=(edits['mqtt_interval']&&now<edits['mqtt_interval']); if(!(locks['mqtt_interval']&&now<locks['mqtt_interval']) && !editing) iv.value=j.mqtt_interval_sec||60; toggleDirty(iv,'mqtt_interval'); } const dl=$('sel_mqtt_delta'); if(dl){ const editing=(edits['mqtt_delta']&&now<edits['mqtt_delta']); if(!(locks['mqtt_delta']&&now<locks['mqtt_delta']) && !editing) dl.value=j.mqtt_delta?'on':'off'; toggleDirty(dl,'mqtt_delta'); } const fe=$('in_mqtt_full_every'); if(fe){ const editing=(edits['mqtt_full_every']&&now<edits['mqtt_full_every']); if(!(locks['mqtt_full_every']&&now<locks['mqtt_full_every']) && !editing) fe.value=j.mqtt_full_every||10; toggleDirty(fe,'mqtt_full_every'); } const mp=$('sel_mqtt_msgpack'); if(mp){ const editing=(edits['mqtt_msgpack']&&now<edits['mqtt_msgpack']); if(!(locks['mqtt_msgpack']&&now<locks['mqtt_msgpack']) && !editing) mp.value=j.mqtt_msgpack?'on':'off'; toggleDirty(mp,'mqtt_msgpack'); } const by=$('mqtt_bytes'); if(by){ if(!j.mqtt_state_publishes){ by.textContent='-'; } else { let t='avg '+j.mqtt_state_bytes_avg+' B JSON (full '+j.mqtt_state_full_bytes_avg+' B), last '+j.mqtt_state_bytes_last+' B'; if(j.mqtt_msgpack) t+=', MessagePack avg '+j.mqtt_msgpack_bytes_avg+' B'; by.textContent=t; } } const conn=$('mqtt_conn'); if(conn){ if(!j.mqtt_enabled){ conn.innerHTML='<span class=muted>Disabled</span>'; } else if(j.mqtt_connected){ conn.innerHTML='<span class=ok>Connected</span>'; } else { conn.innerHTML='<span class=warn>Disconnected</span>'; } } const err=$('mqtt_err'); if(err){ err.textContent=j.mqtt_last_error||''; } }function loadStatus(){fetch('/api/status',{cache:'no-store'}).then(r=>r.json()).then(j=>{ $('ip').textContent=j.ip; $('rssi').textContent=j.wifi_rssi+' dBm'; $('wtx').textContent=j.wifi_tx_dbm.toFixed(1)+' dBm'; $('heap').textContent=j.free_heap_kb+' KB ('+j.min_free_heap_kb+' KB)'; $('uptime').textContent=j.uptime; $('srv').innerHTML=fmtSrv(j.rtsp_server_enabled); setToggleState(j.rtsp_server_enabled); $('client').textContent=j.client || 'Waiting...'; $('stream').innerHTML=fmtBool(j.streaming); $('rate').textContent=j.current_rate_pkt_s+' pkt/s'; $('lcon').textContent=j.last_rtsp_connect; $('lplay').textContent=j.last_stream_start; $('time_sync').innerHTML=fmtBool(j.time_synced); $('last_sync').textContent=j.last_time_sync; renderTimeRows(j); const now=Date.now(); const stx=$('sel_tx'); if(stx){ const editing=(edits['wifi_tx']&&now<edits['wifi_tx']); if(!(locks['wifi_tx']&&now<locks['wifi_tx']) && !editing) stx.value=j.wifi_tx_dbm.toFixed(1); toggleDirty(stx,'wifi_tx'); } const md=$('sel_mdns'); if(md){ const editing=(edits['mdns_enable']&&now<edits['mdns_enable']); if(!(locks['mdns_enable']&&now<locks['mdns_enable']) && !editing) md.value=j.mdns_enabled?'on':'off'; toggleDirty(md,'mdns_enable'); } const mh=$('in_mdns_host'); if(mh){ const editing=(edits['mdns_hostname']&&now<edits['mdns_hostname']); if(!(locks['mdns_hostname']&&now<locks['mdns_hostname']) && !editing) mh.value=j.mdns_hostname||''; toggleDirty(mh,'mdns_hostname'); } const tse=$('sel_time_sync'); if(tse){ const editing=(edits['time_sync']&&now<edits['time_sync']); if(!(locks['time_sync']&&now<locks['time_sync']) && !editing) tse.value=j.time_sync_enabled?'on':'off'; toggleDirty(tse,'time_sync'); } const offSel=$('sel_offset'); if(offSel){ const editing=(edits['time_offset']&&now<edits['time_offset']); const hours=Math.round((j.time_offset_min||0)/60); if(!(locks['time_offset']&&now<locks['time_offset']) && !editing) offSel.value=String(hours); toggleDirty(offSel,'time_offset'); } const fv=$('fwv'); if(fv && j.fw_version){ fv.textContent='v'+j.fw_version; } const ui=$('url_ip'); if(ui){ ui.textContent=j.stream_url_ip; ui.href=j.stream_url_ip; } const um=$('url_mdns'); const umw=$('url_mdns_wrap'); if(um){ if(j.mdns_enabled){ um.textContent=j.stream_url_mdns; um.href=j.stream_url_mdns; um.style.opacity='1'; if(umw) umw.style.display=''; } else { um.textContent='—'; um.removeAttribute('href'); um.style.opacity='0.6'; if(umw) umw.style.display='none'; } } const topIp=$('rtsp_ip'); if(topIp){ topIp.textContent=j.stream_url_ip; topIp.href=j.stream_url_ip; } const topMdns=$('rtsp_mdns'); const wrap=$('rtsp_mdns_wrap'); if(topMdns){ if(j.mdns_enabled){ topMdns.textContent=j.stream_url_mdns; topMdns.href=j.stream_url_mdns; if(wrap) wrap.style.display='inline'; } else { topMdns.textContent=''; topMdns.removeAttribute('href'); if(wrap) wrap.style.display='none'; } } loadStreamSchedule(j); loadMqtt(j); })}function loadAudio(){fetch('/api/audio_status',{cache:'no-store'}).then(r=>r.json()).then(j=>{ const r=$('in_rate'); const g=$('in_gain'); const sb=$('sel_buf'); const s=$('in_shift'); const hp=$('sel_hp'); const hpc=$('in_hp_cutoff'); const now=Date.now(); if(r){ const editing=(edits['rate']&&now<edits['rate']); if(!(locks['rate']&&now<locks['rate']) && !editing) r.value=j.sample_rate; toggleDirty(r,'rate'); } if(g){ const editing=(edits['gain']&&now<edits['gain']); if(!(locks['gain']&&now<locks['gain']) && !editing) g.value=j.gain.toFixed(2); toggleDirty(g,'gain'); } if(sb){ const editing=(edits['buffer']&&now<edits['buffer']); if(!(locks['buffer']&&now<locks['buffer']) && !editing) sb.value=j.buffer_size; toggleDirty(sb,'buffer'); } if(s){ const editing=(edits['shift']&&now<edits['shift']); if(!(locks['shift']&&now<locks['shift']) && !editing) s.value=j.i2s_shift; toggleDirty(s,'shift'); } if(hp){ const editing=(edits['hp_enable']&&now<edits['hp_enable']); if(!(locks['hp_enable']&&now<locks['hp_enable']) && !editing) hp.value=j.hp_enable?'on':'off'; toggleDirty(hp,'hp_enable'); } if(hpc){ const editing=(edits['hp_cutoff']&&now<edits['hp_cutoff']); if(!(locks['hp_cutoff']&&now<locks['hp_cutoff']) && !editing) hpc.value=j.hp_cutoff_hz; toggleDirty(hpc,'hp_cutoff'); } { let t=j.latency_ms.toFixed(1)+' ms'; if(j.lat_blocks) t+=' (measured p50 '+(j.lat_total_p50_us/1000).toFixed(1)+' / p95 '+(j.lat_total_p95_us/1000).toFixed(1)+' / max '+(j.lat_total_max_us/1000).toFixed(1)+' ms)'; $('lat').textContent=t; } $('profile').textContent=profileText(j.buffer_size); const L=T[lang]; const lvl=$('level'); if(lvl){ const pct=j.peak_pct||0, db=j.peak_dbfs||-90, clip=j.clip, cc=j.clip_count||0; if(clip){ lvl.innerHTML = `<span class='bad'>${L.clip_bad}</span> Peak ${pct.toFixed(0)}% (${db.toFixed(1)} dBFS), clips: ${cc}`; } else if(pct>=90){ lvl.innerHTML = `<span class='warn'>${L.clip_warn}</span> Peak ${pct.toFixed(0)}% (${db.toFixed(1)} dBFS)`; } else { lvl.textContent = `Peak ${pct.toFixed(0)}% (${db.toFixed(1)} dBFS) — ${L.clip_ok}`; } } updateAdvice(j); })}function updateAdvice(a){const L=T[lang]; let tips=[]; if(a.buffer_size<512) tips.push(L.adv_buf512); if(a.buffer_size<1024) tips.push(L.adv_buf1024); if(a.gain>20) tips.push(L.adv_gain); $('adv').textContent=tips.join(' ');}function loadPerf(){fetch('/api/perf_status',{cache:'no-store'}).then(r=>r.json()).then(j=>{ const el=$('in_auto'); if(el) el.value=j.auto_recovery?'on':'off'; const thr=$('in_thr'); const chk=$('in_chk'); const mode=$('in_thr_mode'); const sch=$('in_sched'); const hrs=$('in_hours'); const now=Date.now(); if(mode){ const editing=(edits['thr_mode']&&now<edits['thr_mode']); if(!(locks['thr_mode']&&now<locks['thr_mode']) && !editing) mode.value=j.auto_threshold?'auto':'manual'; toggleDirty(mode,'thr_mode'); } if(thr){ const editing=(edits['min_rate']&&now<edits['min_rate']); if(!(locks['min_rate']&&now<locks['min_rate']) && !editing) thr.value=j.restart_threshold_pkt_s; toggleDirty(thr,'min_rate'); } if(chk){ const editing=(edits['check_interval']&&now<edits['check_interval']); if(!(locks['check_interval']&&now<locks['check_interval']) && !editing) chk.value=j.check_interval_min; toggleDirty(chk,'check_interval'); } if(sch){ const editing=(edits['sched_reset']&&now<edits['sched_reset']); if(!(locks['sched_reset']&&now<locks['sched_reset']) && !editing) sch.value=j.scheduled_reset?'on':'off'; toggleDirty(sch,'sched_reset'); } if(hrs){ const editing=(edits['reset_hours']&&now<edits['reset_hours']); if(!(locks['reset_hours']&&now<locks['reset_hours']) && !editing) hrs.value=j.reset_hours; toggleDirty(hrs,'reset_hours'); } const frag=$('in_frag'); if(frag){ const editing=(edits['heap_frag_alert']&&now<edits['heap_frag_alert']); if(!(locks['heap_frag_alert']&&now<locks['heap_frag_alert']) && !editing) frag.value=j.heap_frag_alert_pct; toggleDirty(frag,'heap_frag_alert'); } const wdEl=$('wd_status'); if(wdEl){ const L=T[lang]; const st={ok:L.wd_ok,stall:L.wd_stall,degraded:L.wd_degraded}[j.wd_state]||j.wd_state; wdEl.textContent=`${st} — ${j.wd_pkt_rate} pkt/s (10 s avg ${j.wd_window_pkt_rate}, min ${j.wd_window_min_pkt}), stalls ${j.wd_stalls}`+(j.wd_last_action!=='none'?`, last action ${j.wd_last_action} ${j.wd_last_action_ago_s} s ago`:''); } const hh=$('heap_health'); if(hh){ hh.textContent=`${j.heap_frag_pct}% frag (max ${j.heap_frag_max_pct}%), largest block ${Math.round(j.heap_largest_block/1024)} KB (min ${Math.round(j.heap_min_largest_block/1024)} KB)`+(j.heap_frag_alert?' — '+T[lang].frag_alert:''); } const tc=$('task_cpu'); if(tc){ if(j.task_stats_available&&typeof j.cpu_idle_pct==='number'){ tc.textContent=`idle ${j.cpu_idle_pct.toFixed(1)}%, loop ${j.cpu_loop_pct.toFixed(1)}%, min stack ${j.stack_min_free} B (${j.stack_min_task})`; } else tc.textContent=T[lang].task_na; } const tt=$('task_top'); if(tt&&Array.isArray(j.tasks)){ tt.textContent=j.tasks.filter(t=>!/^IDLE/.test(t.name)).slice(0,5).map(t=>`${t.name} ${t.cpu_pct.toFixed(1)}% / ${t.stack_free} B`).join(' · '); } const nv=$('nvs_stats'); if(nv&&typeof j.nvs_flushes==='number'){ nv.textContent=`${j.nvs_keys_written} keys written in ${j.nvs_flushes} saves (${j.nvs_keys_skipped} unchanged skipped), ${j.nvs_free_entries} entries free`+(j.nvs_pending?' — '+T[lang].nvs_pending:''); } $('row_min_rate').style.display=j.auto_threshold?'none':''; })}function loadTherm(){fetch('/api/thermal',{cache:'no-store'}).then(r=>r.json()).then(j=>{ const now=Date.now(); const L=T[lang]; const en=$('sel_oh_enable'); if(en){ const editing=(edits['oh_enable']&&now<edits['oh_enable']); if(!(locks['oh_enable']&&now<locks['oh_enable']) && !editing) en.value=j.protection_enabled?'on':'off'; toggleDirty(en,'oh_enable'); } const lim=$('sel_oh_limit'); if(lim){ const editing=(edits['oh_limit']&&now<edits['oh_limit']); if(!(locks['oh_limit']&&now<locks['oh_limit']) && !editing) lim.value=(Number(j.shutdown_c)||80).toFixed(0); toggleDirty(lim,'oh_limit'); } const sc=$('sel_cpu'); if(sc && !(locks['cpu_freq']&&now<locks['cpu_freq'])){ sc.value=(j.cpu_max_mhz||j.cpu_mhz); } const sp=$('sel_pwr'); if(sp && j.power_profile){ const editing=(edits['power_profile']&&now<edits['power_profile']); if(!(locks['power_profile']&&now<locks['power_profile']) && !editing) sp.value=j.power_profile; toggleDirty(sp,'power_profile'); } const currentValid=(j.current_valid&&typeof j.current_c==='number'&&isFinite(j.current_c)); const cur=$('therm_now'); if(cur) cur.textContent=currentValid?j.current_c.toFixed(1)+' °C':'N/A'; const max=$('therm_max'); if(max){ const maxValid=(typeof j.max_c==='number'&&isFinite(j.max_c)); max.textContent=maxValid?j.max_c.toFixed(1)+' °C':'N/A'; } const cpu=$('therm_cpu'); if(cpu) cpu.textContent=j.cpu_mhz+' MHz'+((j.power_min_mhz&&j.power_min_mhz!==j.power_max_mhz)?' ('+j.power_min_mhz+'–'+j.power_max_mhz+')':''); const pw=$('therm_power'); if(pw){ if(typeof j.cpu_load_pct==='number'){ pw.textContent=L.therm_power_fmt.replace('%LOAD%',j.cpu_load_pct).replace('%AVG%',j.cpu_load_avg_pct).replace('%PEAK%',j.cpu_load_peak_pct).replace('%MA%',Number(j.power_est_ma||0).toFixed(0)); } else pw.textContent='N/A'; } const status=$('therm_status'); if(status){ if(j.sensor_fault){ status.innerHTML='<span class=warn>'+L.therm_status_sensor_fault+'</span>'; } else if(j.latched_persist){ status.innerHTML='<span class=warn>'+L.therm_status_latched_persist+'</span>'; } else if(!j.protection_enabled){ status.innerHTML='<span class=bad>'+L.therm_status_disabled+'</span>'; } else if(j.manual_restart || j.latched){ status.innerHTML='<span class=warn>'+L.therm_status_latched+'</span>'; } else { status.innerHTML='<span class=ok>'+L.therm_status_ready+'</span>'; } } const latchRow=$('row_therm_latch'); const latchMsg=$('txt_therm_latch'); const latchBtn=$('btn_therm_clear'); if(latchRow){ if(j.latched_persist){ latchRow.style.display=''; if(latchMsg) latchMsg.textContent=L.therm_latch_notice; if(latchBtn){ latchBtn.textContent=L.therm_clear_btn; latchBtn.disabled=false; } } else { latchRow.style.display='none'; if(latchBtn){ latchBtn.disabled=true; } } } const last=$('therm_last'); if(last){ if(j.sensor_fault){ last.textContent=L.therm_last_sensor_fault; } else if(j.last_trip_ts && j.last_trip_ts.length){ let msg=L.therm_last_fmt; const temp=(typeof j.last_trip_c==='number'&&isFinite(j.last_trip_c)&&j.last_trip_c>0)?j.last_trip_c.toFixed(1):'0'; const limit=(Number(j.shutdown_c)||0).toFixed(0); const ts=j.last_trip_ts||L.therm_time_unknown; const ago=j.last_trip_since||L.therm_time_ago_unknown; msg=msg.replace('%TEMP%',temp).replace('%LIMIT%',limit).replace('%TIME%',ts).replace('%AGO%',ago); last.textContent=msg; if(j.latched_persist){ last.textContent+=' — '+L.therm_status_latched_persist; } else if(j.manual_restart){ last.textContent+=' — '+L.therm_status_latched; } } else if(j.last_reason && j.last_reason.length){ last.textContent=j.last_reason; } else { last.textContent=L.therm_last_none; } } })}function loadLogs(){ const lg=$('logs'); if(!lg) return; bindLogScroll(); fetch('/api/logs?since='+logCursor,{cache:'no-store'}).then(r=>r.text().then(t=>[r,t])).then(([r,t])=>{ const next=parseInt(r.headers.get('X-Log-Next'),10); const first=parseInt(r.headers.get('X-Log-First'),10); if(!isNaN(next)&&next<=logCursor){ logCursor=0; lg.textContent=''; return; } const pinBottom = logAutoScroll || isLogNearBottom(lg); const bottomOffset = lg.scrollHeight - lg.scrollTop; let add=t; if(logCursor>0&&!isNaN(first)&&first>logCursor+1){ add='… '+(first-logCursor-1)+' lines dropped …\n'+add; } if(!isNaN(next)) logCursor=next-1; if(add.length){ let txt=lg.textContent+add; if(txt.length>LOG_VIEW_MAX){ txt=txt.slice(txt.indexOf('\n',txt.length-LOG_VIEW_MAX)+1); } lg.textContent=txt; } if(pinBottom){ lg.scrollTop=lg.scrollHeight; } else { lg.scrollTop=Math.max(0, lg.scrollHeight-bottomOffset); } })}function downloadLogs(persist){ fetch(persist?'/api/logs?persist=1&download=1':'/api/logs?download=1',{cache:'no-store'}).then(r=>r.blob()).then(b=>{ const url=URL.createObjectURL(b); const a=document.createElement('a'); a.href=url; a.download=persist?'esp32mic-log-persist.txt':'esp32mic-log.txt'; a.click(); setTimeout(()=>URL.revokeObjectURL(url),2000); }); }function setOffset(){ const sel=$('sel_offset'); if(!sel) return; const h=parseInt(sel.value,10); if(isNaN(h)) return; setv('time_offset', h*60); }function confirmNetReset(){ const L=T[lang]; if(confirm(L.net_reset_confirm||'Reset Wi-Fi settings and reboot?')){ act('network_reset'); } }function loadAll(){loadStatus();loadAudio();loadPerf();loadTherm();loadLogs()}function clearThermalLatch(){ const btn=$('btn_therm_clear'); if(btn) btn.disabled=true; mutationFetch('/api/thermal/clear','').then(r=>r.json()).then(j=>{ if(!j.ok){ console.warn('Thermal latch clear rejected'); } loadAll(); }).catch(()=>loadAll());}setInterval(loadAll,3000);const tsel=$('themeSel'); if(tsel){ tsel.value=theme; tsel.onchange=()=>{theme=tsel.value; localStorage.setItem('theme',theme); applyTheme();}; } applyTheme();applyLang(); applyScheduleLang();bindSaver($('in_rate'),'rate'); bindSaver($('in_gain'),'gain'); bindSaver($('in_shift'),'shift'); bindSaver($('in_thr'),'min_rate'); bindSaver($('in_chk'),'check_interval'); bindSaver($('in_hours'),'reset_hours'); bindSaver($('in_frag'),'heap_frag_alert'); bindSaver($('in_hp_cutoff'),'hp_cutoff'); bindEnter($('in_mdns_host'),()=>setvRaw('mdns_hostname',$('in_mdns_host').value));bindEnter($('in_mqtt_host'),setMqttHost); bindEnter($('in_mqtt_port'),setMqttPort); bindEnter($('in_mqtt_user'),setMqttUser); bindEnter($('in_mqtt_pass'),setMqttPass); bindEnter($('in_mqtt_topic'),setMqttTopic); bindEnter($('in_mqtt_discovery'),setMqttDiscovery); bindEnter($('in_mqtt_client_id'),setMqttClientId); bindEnter($('in_mqtt_interval'),setMqttInterval); bindEnter($('in_mqtt_full_every'),setMqttFullEvery);trackEdit($('in_rate'),'rate'); trackEdit($('in_gain'),'gain'); trackEdit($('in_shift'),'shift'); trackEdit($('in_thr'),'min_rate'); trackEdit($('in_chk'),'check_interval'); trackEdit($('in_hours'),'reset_hours'); trackEdit($('in_frag'),'heap_frag_alert'); trackEdit($('in_hp_cutoff'),'hp_cutoff');trackEdit($('in_auto'),'auto_recovery'); trackEdit($('in_thr_mode'),'thr_mode'); trackEdit($('in_sched'),'sched_reset'); trackEdit($('sel_buf'),'buffer'); trackEdit($('sel_tx'),'wifi_tx'); trackEdit($('sel_hp'),'hp_enable'); trackEdit($('sel_cpu'),'cpu_freq'); trackEdit($('sel_pwr'),'power_profile'); trackEdit($('sel_oh_enable'),'oh_enable'); trackEdit($('sel_oh_limit'),'oh_limit');trackEdit($('sel_mdns'),'mdns_enable'); trackEdit($('in_mdns_host'),'mdns_hostname'); trackEdit($('sel_offset'),'time_offset'); trackEdit($('sel_time_sync'),'time_sync'); trackEdit($('sel_stream_sched_en'),'stream_sched'); trackEdit($('in_stream_start'),'stream_start_min'); trackEdit($('in_stream_stop'),'stream_stop_min'); trackEdit($('sel_deep_sleep_sched'),'deep_sleep_sched'); trackEdit($('sel_mqtt_en'),'mqtt_enable'); trackEdit($('in_mqtt_host'),'mqtt_host'); trackEdit($('in_mqtt_port'),'mqtt_port'); trackEdit($('in_mqtt_user'),'mqtt_user'); trackEdit($('in_mqtt_pass'),'mqtt_pass'); trackEdit($('in_mqtt_topic'),'mqtt_topic'); trackEdit($('in_mqtt_discovery'),'mqtt_discovery'); trackEdit($('in_mqtt_client_id'),'mqtt_client_id'); trackEdit($('in_mqtt_interval'),'mqtt_interval'); trackEdit($('sel_mqtt_delta'),'mqtt_delta'); trackEdit($('in_mqtt_full_every'),'mqtt_full_every'); trackEdit($('sel_mqtt_msgpack'),'mqtt_msgpack');const H=(hid,rid)=>{const h=$(hid), r=$(rid); if(h&&r){ h.onclick=()=>{ r.style.display = (r.style.display==='none')?'':'none'; }; }};H('h_rate','row_rate_hint'); H('h_gain','row_gain_hint'); H('h_hpf','row_hpf_hint'); H('h_hpf_cut','row_hpf_cut_hint'); H('h_buf','row_buf_hint'); H('h_auto','row_auto_hint'); H('h_thr','row_thr_hint'); H('h_thr_mode','row_thrmode_hint'); H('h_chk','row_chk_hint'); H('h_sched','row_sched_hint'); H('h_hours','row_hours_hint'); H('h_frag','row_frag_hint'); H('h_tx','row_tx_hint'); H('h_shift','row_shift_hint'); H('h_cpu','row_cpu_hint'); H('h_pwr','row_pwr_hint'); H('h_level','row_level_hint'); H('h_therm_protect','row_therm_hint_protect'); H('h_therm_limit','row_therm_hint_limit'); H('h_offset','row_offset_hint'); H('h_time_sync','row_time_sync_hint'); H('h_stream_sched_en','row_stream_sched_en_hint'); H('h_stream_start','row_stream_start_hint'); H('h_stream_stop','row_stream_stop_hint'); H('h_deep_sleep_sched','row_deep_sleep_sched_hint');loadAll();
\ No newline at end of file